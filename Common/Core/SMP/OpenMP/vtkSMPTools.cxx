@@ -34,11 +34,6 @@ void vtkSMPTools::Initialize(int numThreads)
   }
 }
 
-int vtkSMPTools::GetEstimatedNumberOfThreads()
-{
-  return vtk::detail::smp::GetNumberOfThreads();
-}
-
 int vtk::detail::smp::GetNumberOfThreads()
 {
   return vtkSMPNumberOfSpecifiedThreads ? vtkSMPNumberOfSpecifiedThreads :
@@ -49,13 +44,22 @@ void vtk::detail::smp::vtkSMPTools_Impl_For_OpenMP(vtkIdType first,
   vtkIdType last, vtkIdType grain, ExecuteFunctorPtrType functorExecuter,
   void *functor)
 {
+  // A scoped limit can only lower the number of threads, as with the other
+  // back-ends.
+  int numThreads = omp_get_max_threads();
+  int maxThreads = vtk::detail::smp::GetScopedMaxNumberOfThreads();
+  if (maxThreads > 0 && maxThreads < numThreads)
+  {
+    numThreads = maxThreads;
+  }
+
   if (grain <= 0)
   {
-    vtkIdType estimateGrain = (last - first)/(omp_get_max_threads() * 4);
+    vtkIdType estimateGrain = (last - first)/(numThreads * 4);
     grain = (estimateGrain > 0) ? estimateGrain : 1;
   }
 
-# pragma omp parallel for schedule(runtime)
+# pragma omp parallel for num_threads(numThreads) schedule(runtime)
   for (vtkIdType from = first; from < last; from += grain)
   {
     functorExecuter(functor, from, grain, last);
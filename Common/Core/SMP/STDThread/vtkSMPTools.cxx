@@ -0,0 +1,419 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkSMPTools.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Implementation based on a persistent pool of std::thread workers with work
+// stealing.
+//
+// Each call to For() is a job. The range of a job is recursively halved: the
+// upper half is pushed as a task on the deque of the splitting thread, which
+// continues with the lower half until it is no larger than the grain. A
+// thread first pops the most recent task of its own deque (depth first, which
+// keeps the data it touches in cache) and, when its deque is empty, steals the
+// oldest task of another deque, which is also the largest one. Irregular work
+// is therefore balanced dynamically rather than statically split up front.
+//
+// The thread calling For() participates in the job and returns once all of
+// its items have been processed. While waiting it only executes tasks of its
+// own job: a nested For() called from a worker thus never re-enters the
+// functor of an enclosing job on the same thread (which would corrupt its
+// thread local storage), and since a job only waits for its own tasks, nested
+// parallelism cannot deadlock.
+//
+// A job started under a scoped thread limit (vtkSMPTools::LocalScope()) counts
+// its active threads: the pool workers only take one of its tasks while the
+// limit is not reached.
+
+namespace
+{
+
+//--------------------------------------------------------------------------------
+struct vtkSMPJob
+{
+  vtk::detail::smp::ExecuteFunctorPtrType Executer;
+  void *Functor;
+  vtkIdType Grain;
+  vtkIdType Last;
+  int MaxThreads; // 0 when unlimited
+  std::atomic<int> ActiveThreads;
+  std::atomic<vtkIdType> Remaining; // Number of items left to process
+
+  // Register a pool worker as working on this job, if the limit allows it.
+  bool TryEnter()
+  {
+    if (this->MaxThreads <= 0)
+    {
+      return true;
+    }
+    int active = this->ActiveThreads.load();
+    while (active < this->MaxThreads)
+    {
+      if (this->ActiveThreads.compare_exchange_weak(active, active + 1))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+struct vtkSMPTask
+{
+  vtkSMPJob *Job;
+  vtkIdType Begin;
+  vtkIdType End;
+};
+
+//--------------------------------------------------------------------------------
+// Deque of tasks. The owner pushes and pops at the back, thieves steal from
+// the front. When job is not null, only tasks of that job are returned,
+// otherwise only tasks of a job the caller could enter.
+class vtkSMPTaskQueue
+{
+public:
+  void Push(const vtkSMPTask& task)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Tasks.push_back(task);
+  }
+
+  bool Pop(vtkSMPTask& task, const vtkSMPJob *job)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    for (auto iter = this->Tasks.rbegin(); iter != this->Tasks.rend(); ++iter)
+    {
+      if (job ? iter->Job == job : iter->Job->TryEnter())
+      {
+        task = *iter;
+        this->Tasks.erase(std::next(iter).base());
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Steal(vtkSMPTask& task, const vtkSMPJob *job)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    for (auto iter = this->Tasks.begin(); iter != this->Tasks.end(); ++iter)
+    {
+      if (job ? iter->Job == job : iter->Job->TryEnter())
+      {
+        task = *iter;
+        this->Tasks.erase(iter);
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::mutex Mutex;
+  std::deque<vtkSMPTask> Tasks;
+};
+
+//--------------------------------------------------------------------------------
+class vtkSMPThreadPool
+{
+public:
+  explicit vtkSMPThreadPool(int numThreads);
+  ~vtkSMPThreadPool();
+
+  // Process [first,last) of the job from the calling thread.
+  void Run(vtkSMPJob& job, vtkIdType first, vtkIdType last);
+
+  int GetNumberOfThreads() const
+  {
+    return static_cast<int>(this->Threads.size()) + 1;
+  }
+
+private:
+  void WorkerLoop(int queueIndex);
+  bool GetTask(int queueIndex, vtkSMPTask& task, const vtkSMPJob *job);
+  void Push(int queueIndex, const vtkSMPTask& task);
+  void Execute(int queueIndex, vtkSMPTask task, bool entered);
+  void Notify();
+  int GetQueueIndex() const;
+
+  std::vector<std::thread> Threads;
+  // Queue 0 is shared by the threads that do not belong to the pool, queue i
+  // belongs to worker i.
+  std::vector<std::unique_ptr<vtkSMPTaskQueue> > Queues;
+  // Incremented each time a task may have become available.
+  std::atomic<unsigned int> Generation;
+  std::mutex WakeMutex;
+  std::condition_variable WakeCondition;
+  bool Stop;
+
+  vtkSMPThreadPool(const vtkSMPThreadPool&) = delete;
+  void operator=(const vtkSMPThreadPool&) = delete;
+};
+
+// Identifies the pool (and queue) the current thread is a worker of.
+thread_local const vtkSMPThreadPool *vtkSMPCurrentPool = nullptr;
+thread_local int vtkSMPCurrentQueueIndex = 0;
+
+//--------------------------------------------------------------------------------
+vtkSMPThreadPool::vtkSMPThreadPool(int numThreads)
+  : Generation(0), Stop(false)
+{
+  int numWorkers = numThreads > 1 ? numThreads - 1 : 0;
+  for (int i = 0; i <= numWorkers; ++i)
+  {
+    this->Queues.emplace_back(new vtkSMPTaskQueue);
+  }
+  for (int i = 1; i <= numWorkers; ++i)
+  {
+    this->Threads.emplace_back(&vtkSMPThreadPool::WorkerLoop, this, i);
+  }
+}
+
+//--------------------------------------------------------------------------------
+vtkSMPThreadPool::~vtkSMPThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->WakeMutex);
+    this->Stop = true;
+  }
+  this->WakeCondition.notify_all();
+  for (auto& thread : this->Threads)
+  {
+    thread.join();
+  }
+}
+
+//--------------------------------------------------------------------------------
+int vtkSMPThreadPool::GetQueueIndex() const
+{
+  return vtkSMPCurrentPool == this ? vtkSMPCurrentQueueIndex : 0;
+}
+
+//--------------------------------------------------------------------------------
+void vtkSMPThreadPool::WorkerLoop(int queueIndex)
+{
+  vtkSMPCurrentPool = this;
+  vtkSMPCurrentQueueIndex = queueIndex;
+
+  for (;;)
+  {
+    unsigned int generation = this->Generation.load();
+    vtkSMPTask task;
+    if (this->GetTask(queueIndex, task, nullptr))
+    {
+      // Nested For() calls inherit the configuration of the job.
+      vtk::detail::smp::vtkSMPToolsScope scope(task.Job->MaxThreads, nullptr);
+      this->Execute(queueIndex, task, true);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(this->WakeMutex);
+    this->WakeCondition.wait(lock, [this, generation]()
+      { return this->Stop || this->Generation.load() != generation; });
+    if (this->Stop)
+    {
+      return;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------
+bool vtkSMPThreadPool::GetTask(int queueIndex, vtkSMPTask& task,
+                               const vtkSMPJob *job)
+{
+  const int numQueues = static_cast<int>(this->Queues.size());
+  bool found = this->Queues[queueIndex]->Pop(task, job);
+  for (int i = 1; !found && i < numQueues; ++i)
+  {
+    found = this->Queues[(queueIndex + i) % numQueues]->Steal(task, job);
+  }
+  return found;
+}
+
+//--------------------------------------------------------------------------------
+void vtkSMPThreadPool::Push(int queueIndex, const vtkSMPTask& task)
+{
+  this->Queues[queueIndex]->Push(task);
+  this->Notify();
+}
+
+//--------------------------------------------------------------------------------
+void vtkSMPThreadPool::Notify()
+{
+  {
+    // Synchronize with the predicate check of sleeping workers.
+    std::lock_guard<std::mutex> lock(this->WakeMutex);
+    ++this->Generation;
+  }
+  this->WakeCondition.notify_one();
+}
+
+//--------------------------------------------------------------------------------
+void vtkSMPThreadPool::Execute(int queueIndex, vtkSMPTask task, bool entered)
+{
+  vtkSMPJob *job = task.Job;
+  const vtkIdType grain = job->Grain;
+
+  // Split off the upper halves (on grain boundaries) so that other threads
+  // can steal them.
+  while (task.End - task.Begin > grain)
+  {
+    vtkIdType numChunks = (task.End - task.Begin + grain - 1) / grain;
+    vtkIdType mid = task.Begin + (numChunks / 2) * grain;
+    vtkSMPTask upper = { job, mid, task.End };
+    this->Push(queueIndex, upper);
+    task.End = mid;
+  }
+
+  job->Executer(job->Functor, task.Begin, grain, job->Last);
+  if (entered && job->MaxThreads > 0)
+  {
+    // Leave before the job can be seen as done (and destroyed).
+    --job->ActiveThreads;
+    this->Notify();
+  }
+  job->Remaining -= task.End - task.Begin;
+}
+
+//--------------------------------------------------------------------------------
+void vtkSMPThreadPool::Run(vtkSMPJob& job, vtkIdType first, vtkIdType last)
+{
+  if (this->Threads.empty())
+  {
+    for (vtkIdType from = first; from < last; from += job.Grain)
+    {
+      job.Executer(job.Functor, from, job.Grain, job.Last);
+    }
+    return;
+  }
+
+  const int queueIndex = this->GetQueueIndex();
+  vtkSMPTask task = { &job, first, last };
+  this->Execute(queueIndex, task, false);
+
+  // Help with the remaining tasks of this job until it is done.
+  while (job.Remaining.load() > 0)
+  {
+    if (this->GetTask(queueIndex, task, &job))
+    {
+      this->Execute(queueIndex, task, false);
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------
+int vtkSMPNumberOfSpecifiedThreads = 0;
+std::mutex vtkSMPThreadPoolMutex;
+std::unique_ptr<vtkSMPThreadPool> vtkSMPGlobalThreadPool;
+std::atomic<int> vtkSMPNumberOfActiveJobs(0);
+
+// Get the pool, creating it if needed, and mark it as in use. A pool whose
+// size no longer matches the requested number of threads (Initialize() was
+// called while it was in use) is replaced as soon as it is idle.
+vtkSMPThreadPool& AcquireThreadPool()
+{
+  std::lock_guard<std::mutex> lock(vtkSMPThreadPoolMutex);
+  const int numThreads = vtk::detail::smp::GetNumberOfThreads();
+  if (vtkSMPGlobalThreadPool && vtkSMPNumberOfActiveJobs.load() == 0 &&
+      vtkSMPGlobalThreadPool->GetNumberOfThreads() != numThreads)
+  {
+    vtkSMPGlobalThreadPool.reset();
+  }
+  if (!vtkSMPGlobalThreadPool)
+  {
+    vtkSMPGlobalThreadPool.reset(new vtkSMPThreadPool(numThreads));
+  }
+  ++vtkSMPNumberOfActiveJobs;
+  return *vtkSMPGlobalThreadPool;
+}
+
+void ReleaseThreadPool()
+{
+  --vtkSMPNumberOfActiveJobs;
+}
+
+} // anonymous namespace
+
+//--------------------------------------------------------------------------------
+void vtkSMPTools::Initialize(int numThreads)
+{
+  std::lock_guard<std::mutex> lock(vtkSMPThreadPoolMutex);
+  if (numThreads > 0 && numThreads != vtkSMPNumberOfSpecifiedThreads)
+  {
+    vtkSMPNumberOfSpecifiedThreads = numThreads;
+    // The pool is resized lazily. It cannot be replaced while in use: it
+    // is then replaced by the first job started once it is idle.
+    if (vtkSMPGlobalThreadPool && vtkSMPNumberOfActiveJobs.load() == 0)
+    {
+      vtkSMPGlobalThreadPool.reset();
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------
+int vtk::detail::smp::GetNumberOfThreads()
+{
+  if (vtkSMPNumberOfSpecifiedThreads)
+  {
+    return vtkSMPNumberOfSpecifiedThreads;
+  }
+  int numThreads = static_cast<int>(std::thread::hardware_concurrency());
+  return numThreads > 0 ? numThreads : 1;
+}
+
+//--------------------------------------------------------------------------------
+void vtk::detail::smp::vtkSMPTools_Impl_For_STDThread(vtkIdType first,
+  vtkIdType last, vtkIdType grain, ExecuteFunctorPtrType functorExecuter,
+  void *functor)
+{
+  vtkSMPThreadPool& pool = AcquireThreadPool();
+  int maxThreads = vtk::detail::smp::GetScopedMaxNumberOfThreads();
+  if (maxThreads >= pool.GetNumberOfThreads())
+  {
+    maxThreads = 0;
+  }
+  if (grain <= 0)
+  {
+    // Work stealing makes fine grains cheap, so use more chunks than threads
+    // to balance irregular work.
+    int numThreads = maxThreads > 0 ? maxThreads : pool.GetNumberOfThreads();
+    vtkIdType estimateGrain = (last - first) / (numThreads * 8);
+    grain = (estimateGrain > 0) ? estimateGrain : 1;
+  }
+
+  vtkSMPJob job;
+  job.Executer = functorExecuter;
+  job.Functor = functor;
+  job.Grain = grain;
+  job.Last = last;
+  job.MaxThreads = maxThreads;
+  job.ActiveThreads = 1; // The calling thread
+  job.Remaining = last - first;
+
+  pool.Run(job, first, last);
+  ReleaseThreadPool();
+}
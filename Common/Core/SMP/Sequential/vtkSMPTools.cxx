@@ -22,7 +22,7 @@ void vtkSMPTools::Initialize(int)
 {
 }
 
-int vtkSMPTools::GetEstimatedNumberOfThreads()
+int vtk::detail::smp::GetNumberOfThreads()
 {
   return 1;
 }
@@ -18,7 +18,15 @@
 #include "vtkObjectFactory.h"
 #include "vtkSMPTools.h"
 #include "vtkSMPThreadLocalObject.h"
+#include "vtkDataArrayRange.h"
+#include "vtkIntArray.h"
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <cstring>
 #include <functional>
+#include <string>
+#include <thread>
 #include <vector>
 
 static const int Target = 10000;
@@ -91,6 +99,184 @@ public:
 
 };
 
+// Executes a parallel loop from within a parallel loop.
+class NestedFunctor
+{
+public:
+  std::atomic<int> Total;
+
+  NestedFunctor() : Total(0)
+  {
+  }
+
+  struct Inner
+  {
+    std::atomic<int>& Total;
+    Inner(std::atomic<int>& total) : Total(total) {}
+    void operator()(vtkIdType begin, vtkIdType end) const
+    {
+      this->Total += static_cast<int>(end - begin);
+    }
+  };
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType i=begin; i<end; i++)
+    {
+      Inner inner(this->Total);
+      vtkSMPTools::For(0, 100, 1, inner);
+    }
+  }
+};
+
+// Records the maximum number of threads concurrently executing the functor.
+class ConcurrencyFunctor
+{
+public:
+  std::atomic<int> Active;
+  std::atomic<int> MaxActive;
+  int SleepMilliseconds; // Lets the threads overlap even on a single core
+
+  explicit ConcurrencyFunctor(int sleepMilliseconds = 0)
+    : Active(0), MaxActive(0), SleepMilliseconds(sleepMilliseconds)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    int active = ++this->Active;
+    int maxActive = this->MaxActive.load();
+    while (active > maxActive &&
+           !this->MaxActive.compare_exchange_weak(maxActive, active))
+    {
+    }
+    volatile double sum = 0;
+    for (vtkIdType i=begin * 1000; i<end * 1000; i++)
+    {
+      sum = sum + i;
+    }
+    if (this->SleepMilliseconds > 0)
+    {
+      std::this_thread::sleep_for(
+        std::chrono::milliseconds(this->SleepMilliseconds));
+    }
+    --this->Active;
+  }
+};
+
+// Request a new number of threads while the job is running.
+class InitializeFunctor
+{
+public:
+  void operator()(vtkIdType begin, vtkIdType)
+  {
+    if (begin == 0)
+    {
+      vtkSMPTools::Initialize(2);
+    }
+  }
+};
+
+// Exercise the parallel algorithms, on raw pointers, std::vector and data
+// array ranges.
+struct IsEven
+{
+  bool operator()(int value) const { return value % 2 == 0; }
+};
+
+struct Square
+{
+  double operator()(double value) const { return value * value; }
+};
+
+static bool TestAlgorithms()
+{
+  const int n = 100003;
+
+  vtkNew<vtkIntArray> array;
+  array->SetNumberOfValues(n);
+  auto range = vtk::DataArrayValueRange<1>(array);
+  vtkSMPTools::Fill(range.begin(), range.end(), 1);
+  int *values = array->GetPointer(0);
+  std::vector<int> scan(n);
+  vtkSMPTools::InclusiveScan(values, values + n, scan.begin());
+  if (scan[0] != 1 || scan[n-1] != n)
+  {
+    cerr << "Error: bad Fill or InclusiveScan" << endl;
+    return false;
+  }
+
+  // In place exclusive scan: 0, 1, 2, ...
+  vtkSMPTools::ExclusiveScan(range.begin(), range.end(), range.begin(), 0);
+  for (int i=0; i<n; ++i)
+  {
+    if (values[i] != i)
+    {
+      cerr << "Error: bad ExclusiveScan at " << i << endl;
+      return false;
+    }
+  }
+
+  std::vector<double> doubles(n);
+  vtkSMPTools::Transform(values, values + n, doubles.begin(),
+    [](int value) { return 0.5 * value; });
+  vtkSMPTools::Transform(doubles.begin(), doubles.end(), values,
+    doubles.begin(), [](double a, int b) { return a + 0.5 * b; });
+  if (doubles[n-1] != n - 1)
+  {
+    cerr << "Error: bad Transform" << endl;
+    return false;
+  }
+
+  long long sum = vtkSMPTools::Reduce(values, values + n, 0LL);
+  double sumSquares = vtkSMPTools::TransformReduce(doubles.begin(),
+    doubles.end(), 0., std::plus<double>(), Square());
+  double expected = 0.;
+  for (int i=0; i<n; ++i)
+  {
+    expected += static_cast<double>(i) * i;
+  }
+  if (sum != static_cast<long long>(n) * (n - 1) / 2 ||
+      std::abs(sumSquares - expected) > 1e-12 * expected)
+  {
+    cerr << "Error: bad Reduce or TransformReduce" << endl;
+    return false;
+  }
+
+  // The result of a reduction does not depend on the number of threads.
+  double reference = vtkSMPTools::TransformReduce(doubles.begin(),
+    doubles.end(), 0., std::plus<double>(), Square());
+  vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]()
+  {
+    reference = vtkSMPTools::TransformReduce(doubles.begin(),
+      doubles.end(), 0., std::plus<double>(), Square());
+  });
+  if (reference != sumSquares)
+  {
+    cerr << "Error: TransformReduce is not reproducible" << endl;
+    return false;
+  }
+
+  // Even values first, in their original order, then odd ones.
+  int *middle = vtkSMPTools::StablePartition(values, values + n, IsEven());
+  if (middle - values != (n + 1) / 2)
+  {
+    cerr << "Error: bad StablePartition point" << endl;
+    return false;
+  }
+  for (int i=0; i<n; ++i)
+  {
+    int value = i < (n + 1) / 2 ? 2 * i : 2 * (i - (n + 1) / 2) + 1;
+    if (values[i] != value)
+    {
+      cerr << "Error: bad StablePartition at " << i << endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
 // For sorting comparison
 bool myComp (double a, double b) { return (a<b); }
 
@@ -140,6 +326,65 @@ int TestSMP(int, char*[])
     return 1;
   }
 
+  // Test nested parallelism
+  NestedFunctor functor3;
+  vtkSMPTools::For(0, 100, 1, functor3);
+  if (functor3.Total != 100*100)
+  {
+    cerr << "Error: NestedFunctor did not generate " << 100*100 << endl;
+    return 1;
+  }
+
+  // Test scoped configurations
+  bool scopeOk = true;
+  ConcurrencyFunctor functor4;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(2), [&]()
+  {
+    if (vtkSMPTools::GetEstimatedNumberOfThreads() > 2)
+    {
+      cerr << "Error: LocalScope did not limit the number of threads" << endl;
+      scopeOk = false;
+    }
+    vtkSMPTools::For(0, 1000, 1, functor4);
+  });
+  if (functor4.MaxActive > 2)
+  {
+    cerr << "Error: " << functor4.MaxActive << " threads used within a "
+         << "LocalScope limited to 2" << endl;
+    return 1;
+  }
+
+  ConcurrencyFunctor functor5;
+  const std::string backend = vtkSMPTools::GetBackend();
+  vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]()
+  {
+    if (strcmp(vtkSMPTools::GetBackend(), "Sequential") != 0 ||
+        vtkSMPTools::GetEstimatedNumberOfThreads() != 1)
+    {
+      cerr << "Error: LocalScope did not select the Sequential backend" << endl;
+      scopeOk = false;
+    }
+    vtkSMPTools::For(0, 1000, 1, functor5);
+  });
+  if (!scopeOk || functor5.MaxActive != 1 ||
+      backend != vtkSMPTools::GetBackend())
+  {
+    cerr << "Error: Sequential LocalScope not honored or not restored" << endl;
+    return 1;
+  }
+
+  if (vtkSMPTools::SetBackend("NotABackend") ||
+      backend != vtkSMPTools::GetBackend())
+  {
+    cerr << "Error: SetBackend accepted an invalid backend" << endl;
+    return 1;
+  }
+
+  if (!TestAlgorithms())
+  {
+    return 1;
+  }
+
   // Test sorting
   double data0[] = {2,1,0,3,9,6,7,3,8,4,5};
   std::vector<double> myvector (data0, data0+11);
@@ -167,5 +412,21 @@ int TestSMP(int, char*[])
     }
   }
 
+  // A thread count requested during a job applies to the following ones.
+  if (backend == "STDThread")
+  {
+    vtkSMPTools::Initialize(4);
+    InitializeFunctor functor6;
+    vtkSMPTools::For(0, 1000, 1, functor6);
+    ConcurrencyFunctor functor7(1);
+    vtkSMPTools::For(0, 100, 1, functor7);
+    if (functor7.MaxActive > 2)
+    {
+      cerr << "Error: " << functor7.MaxActive << " threads used after "
+           << "Initialize(2) was called during a job" << endl;
+      return 1;
+    }
+  }
+
   return 0;
 }
@@ -0,0 +1,154 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkSMPTools.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Runtime configuration shared by all the back-ends: selection between the
+// compiled back-end and Sequential, and per-thread scoped limits.
+
+#include "vtkSMPTools.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <atomic>
+#include <cstring>
+
+namespace
+{
+
+// Back-ends that can be selected at runtime. Only one parallel back-end is
+// compiled in.
+enum
+{
+  vtkSMPSequentialBackend = 0,
+  vtkSMPCompiledBackend = 1,
+  vtkSMPNumberOfBackends = 2
+};
+
+const char *vtkSMPBackendNames[vtkSMPNumberOfBackends] = { "Sequential",
+                                                           VTK_SMP_BACKEND };
+
+// Returns -1 if the back-end is not available.
+int vtkSMPGetBackendId(const char *name)
+{
+  for (int i = 0; i < vtkSMPNumberOfBackends; ++i)
+  {
+    if (strcmp(name, vtkSMPBackendNames[i]) == 0)
+    {
+      return i;
+    }
+  }
+  vtkGenericWarningMacro("SMP back-end \"" << name << "\" is not available, "
+    "the available ones are Sequential and " VTK_SMP_BACKEND ".");
+  return -1;
+}
+
+std::atomic<int>& vtkSMPGlobalBackend()
+{
+  static std::atomic<int> backend([]() {
+    std::string name;
+    int id = -1;
+    if (vtksys::SystemTools::GetEnv("VTK_SMP_BACKEND_IN_USE", name))
+    {
+      id = vtkSMPGetBackendId(name.c_str());
+    }
+    return id >= 0 ? id : static_cast<int>(vtkSMPCompiledBackend);
+  }());
+  return backend;
+}
+
+// Configuration of the current thread set by vtkSMPToolsScope. A negative
+// backend means the global one.
+thread_local int vtkSMPScopedMaxNumberOfThreads = 0;
+thread_local int vtkSMPScopedBackend = -1;
+
+int vtkSMPGetBackendInUse()
+{
+  return vtkSMPScopedBackend >= 0 ? vtkSMPScopedBackend :
+                                    vtkSMPGlobalBackend().load();
+}
+
+} // anonymous namespace
+
+//--------------------------------------------------------------------------------
+bool vtk::detail::smp::IsSequentialExecution()
+{
+  return vtkSMPScopedMaxNumberOfThreads == 1 ||
+         vtkSMPGetBackendInUse() == vtkSMPSequentialBackend;
+}
+
+//--------------------------------------------------------------------------------
+int vtk::detail::smp::GetScopedMaxNumberOfThreads()
+{
+  return vtkSMPScopedMaxNumberOfThreads;
+}
+
+//--------------------------------------------------------------------------------
+vtk::detail::smp::vtkSMPToolsScope::vtkSMPToolsScope(int maxNumberOfThreads,
+                                                     const char *backend)
+  : PreviousMaxNumberOfThreads(vtkSMPScopedMaxNumberOfThreads),
+    PreviousBackend(vtkSMPScopedBackend)
+{
+  if (maxNumberOfThreads > 0)
+  {
+    vtkSMPScopedMaxNumberOfThreads = maxNumberOfThreads;
+  }
+  if (backend && *backend)
+  {
+    int id = vtkSMPGetBackendId(backend);
+    if (id >= 0)
+    {
+      vtkSMPScopedBackend = id;
+    }
+  }
+}
+
+//--------------------------------------------------------------------------------
+vtk::detail::smp::vtkSMPToolsScope::~vtkSMPToolsScope()
+{
+  vtkSMPScopedMaxNumberOfThreads = this->PreviousMaxNumberOfThreads;
+  vtkSMPScopedBackend = this->PreviousBackend;
+}
+
+//--------------------------------------------------------------------------------
+int vtkSMPTools::GetEstimatedNumberOfThreads()
+{
+  if (vtk::detail::smp::IsSequentialExecution())
+  {
+    return 1;
+  }
+  int numThreads = vtk::detail::smp::GetNumberOfThreads();
+  int maxThreads = vtkSMPScopedMaxNumberOfThreads;
+  return (maxThreads > 0 && maxThreads < numThreads) ? maxThreads : numThreads;
+}
+
+//--------------------------------------------------------------------------------
+bool vtkSMPTools::SetBackend(const char *backend)
+{
+  if (!backend)
+  {
+    return false;
+  }
+  int id = vtkSMPGetBackendId(backend);
+  if (id < 0)
+  {
+    return false;
+  }
+  vtkSMPGlobalBackend() = id;
+  return true;
+}
+
+//--------------------------------------------------------------------------------
+const char *vtkSMPTools::GetBackend()
+{
+  return vtkSMPBackendNames[vtkSMPGetBackendInUse()];
+}
@@ -19,8 +19,15 @@
  * vtkSMPTools provides a set of utility functions that can
  * be used to parallelize parts of VTK code using multiple threads.
  * There are several back-end implementations of parallel functionality
- * (currently Sequential, TBB and X-Kaapi) that actual execution is
- * delegated to.
+ * (currently Sequential, STDThread, OpenMP and TBB) that actual execution is
+ * delegated to. The STDThread back-end only depends on the C++ standard
+ * library: it uses a persistent pool of threads and work stealing, and
+ * supports nested parallelism (calling For() from within a functor).
+ *
+ * The back-end can be switched to Sequential at runtime (SetBackend() or the
+ * VTK_SMP_BACKEND_IN_USE environment variable) and LocalScope() runs code
+ * with a per-thread limit on the number of threads, which avoids
+ * oversubscription when VTK filters are executed concurrently.
 */
 
 #ifndef vtkSMPTools_h
@@ -32,6 +39,12 @@
 #include "vtkSMPThreadLocal.h" // For Initialized
 #include "vtkSMPToolsInternal.h"
 
+#include <functional> // For std::plus
+#include <iterator> // For std::iterator_traits
+#include <string> // For std::string
+#include <utility> // For std::forward
+#include <vector> // For std::vector
+
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 #ifndef __VTK_WRAP__
@@ -41,6 +54,63 @@ namespace detail
 {
 namespace smp
 {
+/**
+ * Number of threads the active back-end would use without any scoped limit.
+ */
+int VTKCOMMONCORE_EXPORT GetNumberOfThreads();
+
+/**
+ * Whether a For() called from the current thread must run sequentially,
+ * either because the Sequential back-end is in use or because of a scoped
+ * limit of one thread.
+ */
+bool VTKCOMMONCORE_EXPORT IsSequentialExecution();
+
+/**
+ * Maximum number of threads a For() called from the current thread may use,
+ * 0 when there is no scoped limit.
+ */
+int VTKCOMMONCORE_EXPORT GetScopedMaxNumberOfThreads();
+
+/**
+ * Apply a configuration (see vtkSMPTools::LocalScope()) to the calling
+ * thread for the lifetime of the object. A maxNumberOfThreads <= 0 or a null
+ * or empty backend keeps the current value.
+ */
+class VTKCOMMONCORE_EXPORT vtkSMPToolsScope
+{
+public:
+  vtkSMPToolsScope(int maxNumberOfThreads, const char *backend);
+  ~vtkSMPToolsScope();
+
+private:
+  int PreviousMaxNumberOfThreads;
+  int PreviousBackend;
+
+  vtkSMPToolsScope(const vtkSMPToolsScope&) = delete;
+  void operator=(const vtkSMPToolsScope&) = delete;
+};
+
+template <typename FunctorInternal>
+void vtkSMPTools_Impl_For_Sequential(
+  vtkIdType first, vtkIdType last, vtkIdType grain,
+  FunctorInternal& fi)
+{
+  if (first == last)
+  {
+    return;
+  }
+  if (grain <= 0 || grain >= last - first)
+  {
+    fi.Execute(first, last);
+    return;
+  }
+  for (vtkIdType b = first; b < last; b += grain)
+  {
+    fi.Execute(b, (last - b > grain) ? b + grain : last);
+  }
+}
+
 template <typename T>
 class vtkSMPTools_Has_Initialize
 {
@@ -79,7 +149,14 @@ struct vtkSMPTools_FunctorInternal<Functor, false>
   }
   void For(vtkIdType first, vtkIdType last, vtkIdType grain)
   {
-    vtk::detail::smp::vtkSMPTools_Impl_For(first, last, grain, *this);
+    if (vtk::detail::smp::IsSequentialExecution())
+    {
+      vtk::detail::smp::vtkSMPTools_Impl_For_Sequential(first, last, grain, *this);
+    }
+    else
+    {
+      vtk::detail::smp::vtkSMPTools_Impl_For(first, last, grain, *this);
+    }
   }
   vtkSMPTools_FunctorInternal<Functor, false>& operator=(
     const vtkSMPTools_FunctorInternal<Functor, false>&);
@@ -105,7 +182,14 @@ struct vtkSMPTools_FunctorInternal<Functor, true>
   }
   void For(vtkIdType first, vtkIdType last, vtkIdType grain)
   {
-    vtk::detail::smp::vtkSMPTools_Impl_For(first, last, grain, *this);
+    if (vtk::detail::smp::IsSequentialExecution())
+    {
+      vtk::detail::smp::vtkSMPTools_Impl_For_Sequential(first, last, grain, *this);
+    }
+    else
+    {
+      vtk::detail::smp::vtkSMPTools_Impl_For(first, last, grain, *this);
+    }
     this->F.Reduce();
   }
   vtkSMPTools_FunctorInternal<Functor, true>& operator=(
@@ -129,6 +213,293 @@ class vtkSMPTools_Lookup_For<Functor const>
 public:
   typedef vtkSMPTools_FunctorInternal<Functor const, init> type;
 };
+
+//--------------------------------------------------------------------------------
+// Functors used by the parallel algorithms of vtkSMPTools.
+
+template <typename InputIt, typename OutputIt, typename UnaryOp>
+struct vtkSMPTools_UnaryTransform
+{
+  InputIt In;
+  OutputIt Out;
+  UnaryOp Op;
+
+  vtkSMPTools_UnaryTransform(InputIt in, OutputIt out, UnaryOp op)
+    : In(in), Out(out), Op(op) {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    InputIt in = this->In + begin;
+    OutputIt out = this->Out + begin;
+    for (vtkIdType i = begin; i < end; ++i, ++in, ++out)
+    {
+      *out = this->Op(*in);
+    }
+  }
+};
+
+template <typename InputIt1, typename InputIt2, typename OutputIt,
+          typename BinaryOp>
+struct vtkSMPTools_BinaryTransform
+{
+  InputIt1 In1;
+  InputIt2 In2;
+  OutputIt Out;
+  BinaryOp Op;
+
+  vtkSMPTools_BinaryTransform(InputIt1 in1, InputIt2 in2, OutputIt out,
+                              BinaryOp op)
+    : In1(in1), In2(in2), Out(out), Op(op) {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    InputIt1 in1 = this->In1 + begin;
+    InputIt2 in2 = this->In2 + begin;
+    OutputIt out = this->Out + begin;
+    for (vtkIdType i = begin; i < end; ++i, ++in1, ++in2, ++out)
+    {
+      *out = this->Op(*in1, *in2);
+    }
+  }
+};
+
+template <typename Iterator, typename T>
+struct vtkSMPTools_Fill
+{
+  Iterator Begin;
+  const T& Value;
+
+  vtkSMPTools_Fill(Iterator begin, const T& value)
+    : Begin(begin), Value(value) {}
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    Iterator it = this->Begin + begin;
+    for (vtkIdType i = begin; i < end; ++i, ++it)
+    {
+      *it = this->Value;
+    }
+  }
+};
+
+struct vtkSMPTools_Identity
+{
+  template <typename U>
+  U&& operator()(U&& u) const
+  {
+    return std::forward<U>(u);
+  }
+};
+
+// The reductions, scans and partitions process the range in blocks whose
+// size only depends on the size of the range, not on the number of threads,
+// so that results are reproducible (e.g. floating point sums) from one run
+// or back-end to the other. Only the associativity of the operations is
+// required.
+struct vtkSMPTools_Blocks
+{
+  vtkIdType Size;
+  vtkIdType BlockSize;
+  vtkIdType NumberOfBlocks;
+
+  explicit vtkSMPTools_Blocks(vtkIdType size) : Size(size)
+  {
+    this->BlockSize = size / 256;
+    this->BlockSize = this->BlockSize < 1 ? 1 :
+      (this->BlockSize > 8192 ? 8192 : this->BlockSize);
+    this->NumberOfBlocks = (size + this->BlockSize - 1) / this->BlockSize;
+  }
+
+  vtkIdType GetBegin(vtkIdType block) const
+  {
+    return block * this->BlockSize;
+  }
+
+  vtkIdType GetEnd(vtkIdType block) const
+  {
+    vtkIdType end = (block + 1) * this->BlockSize;
+    return end < this->Size ? end : this->Size;
+  }
+};
+
+// Computes the transformed reduction of each (non empty) block.
+template <typename InputIt, typename T, typename ReduceOp,
+          typename TransformOp>
+struct vtkSMPTools_BlockReduce
+{
+  InputIt In;
+  const vtkSMPTools_Blocks& Blocks;
+  std::vector<T>& Partials;
+  ReduceOp Reduce;
+  TransformOp Transform;
+
+  vtkSMPTools_BlockReduce(InputIt in, const vtkSMPTools_Blocks& blocks,
+                          std::vector<T>& partials, ReduceOp reduce,
+                          TransformOp transform)
+    : In(in), Blocks(blocks), Partials(partials), Reduce(reduce),
+      Transform(transform) {}
+
+  void operator()(vtkIdType beginBlock, vtkIdType endBlock)
+  {
+    for (vtkIdType block = beginBlock; block < endBlock; ++block)
+    {
+      const vtkIdType end = this->Blocks.GetEnd(block);
+      vtkIdType i = this->Blocks.GetBegin(block);
+      InputIt in = this->In + i;
+      T acc = this->Transform(*in);
+      for (++i, ++in; i < end; ++i, ++in)
+      {
+        acc = this->Reduce(acc, this->Transform(*in));
+      }
+      this->Partials[block] = acc;
+    }
+  }
+};
+
+// Second pass of the scans: scan each block starting from its carry, the
+// reduction of all the previous values. Carries[block] is undefined (and
+// unused) when block == 0 and !HasInitialCarry.
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+struct vtkSMPTools_BlockScan
+{
+  InputIt In;
+  OutputIt Out;
+  const vtkSMPTools_Blocks& Blocks;
+  const std::vector<T>& Carries;
+  bool HasInitialCarry;
+  bool Exclusive;
+  BinaryOp Op;
+
+  vtkSMPTools_BlockScan(InputIt in, OutputIt out,
+                        const vtkSMPTools_Blocks& blocks,
+                        const std::vector<T>& carries, bool hasInitialCarry,
+                        bool exclusive, BinaryOp op)
+    : In(in), Out(out), Blocks(blocks), Carries(carries),
+      HasInitialCarry(hasInitialCarry), Exclusive(exclusive), Op(op) {}
+
+  void operator()(vtkIdType beginBlock, vtkIdType endBlock)
+  {
+    for (vtkIdType block = beginBlock; block < endBlock; ++block)
+    {
+      const vtkIdType end = this->Blocks.GetEnd(block);
+      vtkIdType i = this->Blocks.GetBegin(block);
+      InputIt in = this->In + i;
+      OutputIt out = this->Out + i;
+      if (this->Exclusive)
+      {
+        // Read before writing to support in-place scans.
+        T acc = this->Carries[block];
+        for (; i < end; ++i, ++in, ++out)
+        {
+          T value = *in;
+          *out = acc;
+          acc = this->Op(acc, value);
+        }
+      }
+      else
+      {
+        T acc = (block > 0 || this->HasInitialCarry) ?
+          this->Op(this->Carries[block], *in) : T(*in);
+        *out = acc;
+        for (++i, ++in, ++out; i < end; ++i, ++in, ++out)
+        {
+          acc = this->Op(acc, *in);
+          *out = acc;
+        }
+      }
+    }
+  }
+};
+
+// First pass of StablePartition(): evaluate the predicate and count the
+// selected values of each block.
+template <typename Iterator, typename Predicate>
+struct vtkSMPTools_PartitionCount
+{
+  Iterator In;
+  const vtkSMPTools_Blocks& Blocks;
+  std::vector<unsigned char>& Selected;
+  std::vector<vtkIdType>& Counts;
+  Predicate Pred;
+
+  vtkSMPTools_PartitionCount(Iterator in, const vtkSMPTools_Blocks& blocks,
+                             std::vector<unsigned char>& selected,
+                             std::vector<vtkIdType>& counts, Predicate pred)
+    : In(in), Blocks(blocks), Selected(selected), Counts(counts), Pred(pred) {}
+
+  void operator()(vtkIdType beginBlock, vtkIdType endBlock)
+  {
+    for (vtkIdType block = beginBlock; block < endBlock; ++block)
+    {
+      const vtkIdType end = this->Blocks.GetEnd(block);
+      vtkIdType i = this->Blocks.GetBegin(block);
+      Iterator in = this->In + i;
+      vtkIdType count = 0;
+      for (; i < end; ++i, ++in)
+      {
+        this->Selected[i] = this->Pred(*in) ? 1 : 0;
+        count += this->Selected[i];
+      }
+      this->Counts[block] = count;
+    }
+  }
+};
+
+// Second pass of StablePartition(): scatter the values of each block to
+// their final position in a temporary buffer.
+template <typename Iterator, typename ValueType>
+struct vtkSMPTools_PartitionScatter
+{
+  Iterator In;
+  const vtkSMPTools_Blocks& Blocks;
+  const std::vector<unsigned char>& Selected;
+  const std::vector<vtkIdType>& Offsets; // Selected values before the block
+  vtkIdType NumberOfSelected;
+  std::vector<ValueType>& Buffer;
+
+  vtkSMPTools_PartitionScatter(Iterator in, const vtkSMPTools_Blocks& blocks,
+                               const std::vector<unsigned char>& selected,
+                               const std::vector<vtkIdType>& offsets,
+                               vtkIdType numberOfSelected,
+                               std::vector<ValueType>& buffer)
+    : In(in), Blocks(blocks), Selected(selected), Offsets(offsets),
+      NumberOfSelected(numberOfSelected), Buffer(buffer) {}
+
+  void operator()(vtkIdType beginBlock, vtkIdType endBlock) const
+  {
+    for (vtkIdType block = beginBlock; block < endBlock; ++block)
+    {
+      const vtkIdType end = this->Blocks.GetEnd(block);
+      vtkIdType i = this->Blocks.GetBegin(block);
+      vtkIdType selected = this->Offsets[block];
+      vtkIdType rejected = this->NumberOfSelected + i - selected;
+      Iterator in = this->In + i;
+      for (; i < end; ++i, ++in)
+      {
+        this->Buffer[this->Selected[i] ? selected++ : rejected++] = *in;
+      }
+    }
+  }
+};
+
+template <typename Iterator, typename ValueType>
+struct vtkSMPTools_MoveFromBuffer
+{
+  Iterator Out;
+  std::vector<ValueType>& Buffer;
+
+  vtkSMPTools_MoveFromBuffer(Iterator out, std::vector<ValueType>& buffer)
+    : Out(out), Buffer(buffer) {}
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    Iterator out = this->Out + begin;
+    for (vtkIdType i = begin; i < end; ++i, ++out)
+    {
+      *out = std::move(this->Buffer[i]);
+    }
+  }
+};
 } // namespace smp
 } // namespace detail
 } // namespace vtk
@@ -210,7 +581,7 @@ public:
    * not required as it is automatically called before the first
    * execution of any parallel code. However, it can be used to
    * control the maximum number of threads used when the back-end
-   * supports it (currently Simple and TBB only). Make sure to call
+   * supports it (currently STDThread, OpenMP and TBB). Make sure to call
    * it before any other parallel operation.
    * When using Kaapi, use the KAAPI_CPUCOUNT env. variable to control
    * the number of threads used in the thread pool.
@@ -221,10 +592,70 @@ public:
    * Get the estimated number of threads being used by the backend.
    * This should be used as just an estimate since the number of threads may
    * vary dynamically and a particular task may not be executed on all the
-   * available threads.
+   * available threads. The configuration of an enclosing LocalScope() is
+   * taken into account.
    */
   static int GetEstimatedNumberOfThreads();
 
+  //@{
+  /**
+   * Select the back-end used for execution at runtime. Only the back-end
+   * chosen at configuration time (VTK_SMP_IMPLEMENTATION_TYPE) and
+   * "Sequential" are available. The initial value can be set with the
+   * VTK_SMP_BACKEND_IN_USE environment variable. SetBackend() returns false
+   * (and keeps the current back-end) if the requested one is not available.
+   * GetBackend() returns the back-end used by the calling thread, which can
+   * differ from the global one inside a LocalScope().
+   */
+  static bool SetBackend(const char *backend);
+  static const char *GetBackend();
+  //@}
+
+  /**
+   * Configuration applied by LocalScope(). A MaxNumberOfThreads <= 0 or an
+   * empty Backend keeps the current value.
+   */
+  struct Config
+  {
+    int MaxNumberOfThreads;
+    std::string Backend;
+
+    Config() : MaxNumberOfThreads(0) {}
+    Config(int maxNumberOfThreads) : MaxNumberOfThreads(maxNumberOfThreads) {}
+    Config(std::string backend) : MaxNumberOfThreads(0), Backend(backend) {}
+    Config(const char *backend) : MaxNumberOfThreads(0), Backend(backend) {}
+    Config(int maxNumberOfThreads, std::string backend)
+      : MaxNumberOfThreads(maxNumberOfThreads), Backend(backend) {}
+  };
+
+  /**
+   * Call lambda (any callable taking no argument) with the given
+   * configuration, e.g. to cap the number of threads used by one filter
+   * execution:
+   *
+   * \code
+   * vtkSMPTools::LocalScope(vtkSMPTools::Config(2), [&]() { filter->Update(); });
+   * \endcode
+   *
+   * The configuration only applies to the calling thread, so that several
+   * threads of an application pool can each run VTK code with their own
+   * limit; a MaxNumberOfThreads larger than the number of threads of the
+   * back-end has no effect. The previous configuration is restored on
+   * return. Only the STDThread back-end propagates the configuration to the
+   * worker threads executing the For() it starts: with the other back-ends,
+   * GetBackend(), GetEstimatedNumberOfThreads() and a For() called from a
+   * functor do not see the configuration of the enclosing scope. Note that a
+   * limited For() nested in another one can add its own threads to the ones
+   * of the enclosing For().
+   */
+  template <typename T>
+  static void LocalScope(Config const& config, T&& lambda)
+  {
+    vtk::detail::smp::vtkSMPToolsScope scope(
+      config.MaxNumberOfThreads, config.Backend.c_str());
+    lambda();
+  }
+
   /**
    * A convenience method for sorting data. It is a drop in replacement for
    * std::sort(). Under the hood different methods are used. For example,
@@ -249,6 +680,239 @@ public:
     vtk::detail::smp::vtkSMPTools_Impl_Sort(begin,end,comp);
   }
 
+  /**
+   * Parallel algorithms, drop in replacements for their std counterparts
+   * (with the C++17 semantics for Reduce(), TransformReduce() and the scans).
+   * They operate on random access iterators: raw pointers, std::vector and
+   * the iterators of vtk::DataArrayValueRange and vtk::DataArrayTupleRange,
+   * e.g.
+   *
+   * \code
+   * auto range = vtk::DataArrayValueRange<1>(array);
+   * double sum = vtkSMPTools::Reduce(range.begin(), range.end(), 0.);
+   * \endcode
+   *
+   * The reductions, scans and partitions process the input in blocks whose
+   * size only depends on the size of the input, so that their results are
+   * reproducible (even for floating point values) whatever the back-end or
+   * the number of threads. The operations they use must be associative but
+   * do not need to be commutative. Functors are copied like in std
+   * algorithms, and a copy may be called concurrently from several threads.
+   */
+
+  //@{
+  /**
+   * Assign op(*it) to each element of [outFirst, outFirst + (inLast-inFirst))
+   * or op(*it1, *it2) with a binary operation. The output can be the input.
+   * Returns the end of the output range.
+   */
+  template <typename InputIt, typename OutputIt, typename UnaryOp>
+  static OutputIt Transform(InputIt inFirst, InputIt inLast, OutputIt outFirst,
+                            UnaryOp op)
+  {
+    const vtkIdType n = static_cast<vtkIdType>(inLast - inFirst);
+    vtk::detail::smp::vtkSMPTools_UnaryTransform<InputIt, OutputIt, UnaryOp>
+      worker(inFirst, outFirst, op);
+    vtkSMPTools::For(0, n, worker);
+    return outFirst + n;
+  }
+  template <typename InputIt1, typename InputIt2, typename OutputIt,
+            typename BinaryOp>
+  static OutputIt Transform(InputIt1 inFirst, InputIt1 inLast,
+                            InputIt2 inFirst2, OutputIt outFirst, BinaryOp op)
+  {
+    const vtkIdType n = static_cast<vtkIdType>(inLast - inFirst);
+    vtk::detail::smp::vtkSMPTools_BinaryTransform<InputIt1, InputIt2,
+      OutputIt, BinaryOp> worker(inFirst, inFirst2, outFirst, op);
+    vtkSMPTools::For(0, n, worker);
+    return outFirst + n;
+  }
+  //@}
+
+  /**
+   * Assign value to each element of [first, last).
+   */
+  template <typename Iterator, typename T>
+  static void Fill(Iterator first, Iterator last, const T& value)
+  {
+    vtk::detail::smp::vtkSMPTools_Fill<Iterator, T> worker(first, value);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(last - first), worker);
+  }
+
+  /**
+   * Reduce the result of transform(*it) for each element of [first, last)
+   * with reduce, starting from init.
+   */
+  template <typename InputIt, typename T, typename ReduceOp,
+            typename TransformOp>
+  static T TransformReduce(InputIt first, InputIt last, T init,
+                           ReduceOp reduce, TransformOp transform)
+  {
+    const vtkIdType n = static_cast<vtkIdType>(last - first);
+    if (n <= 0)
+    {
+      return init;
+    }
+    vtk::detail::smp::vtkSMPTools_Blocks blocks(n);
+    std::vector<T> partials(blocks.NumberOfBlocks, init);
+    vtk::detail::smp::vtkSMPTools_BlockReduce<InputIt, T, ReduceOp,
+      TransformOp> worker(first, blocks, partials, reduce, transform);
+    vtkSMPTools::For(0, blocks.NumberOfBlocks, worker);
+    for (const T& partial : partials)
+    {
+      init = reduce(init, partial);
+    }
+    return init;
+  }
+
+  //@{
+  /**
+   * Reduce the elements of [first, last) with op (addition by default),
+   * starting from init.
+   */
+  template <typename InputIt, typename T, typename BinaryOp>
+  static T Reduce(InputIt first, InputIt last, T init, BinaryOp op)
+  {
+    return vtkSMPTools::TransformReduce(first, last, init, op,
+      vtk::detail::smp::vtkSMPTools_Identity());
+  }
+  template <typename InputIt, typename T>
+  static T Reduce(InputIt first, InputIt last, T init)
+  {
+    return vtkSMPTools::Reduce(first, last, init, std::plus<T>());
+  }
+  //@}
+
+  //@{
+  /**
+   * Exclusive scan (prefix sum by default): the i-th output is the reduction
+   * of init and of the elements before the i-th input. The output can be the
+   * input. Returns the end of the output range.
+   */
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  static OutputIt ExclusiveScan(InputIt first, InputIt last, OutputIt out,
+                                T init, BinaryOp op)
+  {
+    return vtkSMPTools::Scan(first, last, out, &init, true, op);
+  }
+  template <typename InputIt, typename OutputIt, typename T>
+  static OutputIt ExclusiveScan(InputIt first, InputIt last, OutputIt out,
+                                T init)
+  {
+    return vtkSMPTools::ExclusiveScan(first, last, out, init, std::plus<T>());
+  }
+  //@}
+
+  //@{
+  /**
+   * Inclusive scan (prefix sum by default): the i-th output is the reduction
+   * of (init if provided and of) the elements up to and including the i-th
+   * input. The output can be the input. Returns the end of the output range.
+   */
+  template <typename InputIt, typename OutputIt, typename BinaryOp, typename T>
+  static OutputIt InclusiveScan(InputIt first, InputIt last, OutputIt out,
+                                BinaryOp op, T init)
+  {
+    return vtkSMPTools::Scan(first, last, out, &init, false, op);
+  }
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  static OutputIt InclusiveScan(InputIt first, InputIt last, OutputIt out,
+                                BinaryOp op)
+  {
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    return vtkSMPTools::Scan(first, last, out, static_cast<const T*>(nullptr),
+                             false, op);
+  }
+  template <typename InputIt, typename OutputIt>
+  static OutputIt InclusiveScan(InputIt first, InputIt last, OutputIt out)
+  {
+    typedef typename std::iterator_traits<InputIt>::value_type T;
+    return vtkSMPTools::InclusiveScan(first, last, out, std::plus<T>());
+  }
+  //@}
+
+  /**
+   * Reorder [first, last) so that the elements for which pred returns true
+   * precede the others, preserving the relative order within both groups
+   * (like std::stable_partition). Returns an iterator to the first element
+   * of the second group. The elements are copied through a temporary buffer:
+   * their value type must be default constructible.
+   */
+  template <typename Iterator, typename Predicate>
+  static Iterator StablePartition(Iterator first, Iterator last,
+                                  Predicate pred)
+  {
+    typedef typename std::iterator_traits<Iterator>::value_type ValueType;
+    const vtkIdType n = static_cast<vtkIdType>(last - first);
+    if (n <= 0)
+    {
+      return first;
+    }
+    vtk::detail::smp::vtkSMPTools_Blocks blocks(n);
+    std::vector<unsigned char> selected(n);
+    std::vector<vtkIdType> offsets(blocks.NumberOfBlocks);
+    vtk::detail::smp::vtkSMPTools_PartitionCount<Iterator, Predicate>
+      count(first, blocks, selected, offsets, pred);
+    vtkSMPTools::For(0, blocks.NumberOfBlocks, count);
+
+    vtkIdType numberOfSelected = 0;
+    for (vtkIdType& offset : offsets)
+    {
+      vtkIdType blockCount = offset;
+      offset = numberOfSelected;
+      numberOfSelected += blockCount;
+    }
+
+    std::vector<ValueType> buffer(n);
+    vtk::detail::smp::vtkSMPTools_PartitionScatter<Iterator, ValueType>
+      scatter(first, blocks, selected, offsets, numberOfSelected, buffer);
+    vtkSMPTools::For(0, blocks.NumberOfBlocks, scatter);
+    vtk::detail::smp::vtkSMPTools_MoveFromBuffer<Iterator, ValueType>
+      move(first, buffer);
+    vtkSMPTools::For(0, n, move);
+    return first + numberOfSelected;
+  }
+
+private:
+  // Implementation of the scans. init may be null for inclusive scans.
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  static OutputIt Scan(InputIt first, InputIt last, OutputIt out,
+                       const T* init, bool exclusive, BinaryOp op)
+  {
+    const vtkIdType n = static_cast<vtkIdType>(last - first);
+    if (n <= 0)
+    {
+      return out;
+    }
+
+    // Reduce each block but the last one, then turn these reductions into
+    // the carries of the blocks.
+    vtk::detail::smp::vtkSMPTools_Blocks blocks(n);
+    std::vector<T> carries(blocks.NumberOfBlocks);
+    vtk::detail::smp::vtkSMPTools_BlockReduce<InputIt, T, BinaryOp,
+      vtk::detail::smp::vtkSMPTools_Identity> reduce(first, blocks, carries,
+      op, vtk::detail::smp::vtkSMPTools_Identity());
+    vtkSMPTools::For(0, blocks.NumberOfBlocks - 1, reduce);
+
+    T carry = init ? *init : T();
+    bool hasCarry = (init != nullptr);
+    for (vtkIdType block = 0; block < blocks.NumberOfBlocks; ++block)
+    {
+      T total = carries[block];
+      carries[block] = carry;
+      if (block < blocks.NumberOfBlocks - 1)
+      {
+        carry = hasCarry ? op(carry, total) : total;
+        hasCarry = true;
+      }
+    }
+
+    vtk::detail::smp::vtkSMPTools_BlockScan<InputIt, OutputIt, T, BinaryOp>
+      scan(first, out, blocks, carries, init != nullptr, exclusive, op);
+    vtkSMPTools::For(0, blocks.NumberOfBlocks, scan);
+    return out + n;
+  }
+
 };
 
 #endif
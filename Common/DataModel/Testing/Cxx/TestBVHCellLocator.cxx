@@ -0,0 +1,289 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestBVHCellLocator.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the queries of vtkBVHCellLocator against a brute force search over
+// the cells, that the batched line intersections match the single ones, and
+// that the hierarchy built in parallel is the same as the sequential one.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+// Jittered hexahedra in the unit cube.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  const int res = 10;
+  const double h = 1.0 / res;
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= res; ++k)
+  {
+    for (int j = 0; j <= res; ++j)
+    {
+      for (int i = 0; i <= res; ++i)
+      {
+        double jitter = (i > 0 && i < res && j > 0 && j < res && k > 0 && k < res)
+          ? 0.15 * h : 0.0;
+        points->InsertNextPoint(i * h + jitter * sin(7.0 * (i + j + k)),
+                                j * h + jitter * cos(5.0 * (i - j)),
+                                k * h + jitter * sin(3.0 * (i * j + k)));
+      }
+    }
+  }
+  vtkSmartPointer<vtkUnstructuredGrid> grid =
+    vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  const vtkIdType dj = res + 1;
+  const vtkIdType dk = (res + 1) * (res + 1);
+  for (int k = 0; k < res; ++k)
+  {
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        vtkIdType p0 = i + dj * j + dk * k;
+        vtkIdType hex[8] = { p0, p0 + 1, p0 + 1 + dj, p0 + dj, p0 + dk,
+          p0 + 1 + dk, p0 + 1 + dj + dk, p0 + dj + dk };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+      }
+    }
+  }
+  return grid;
+}
+
+vtkSmartPointer<vtkPolyData> MakeSphere(int resolution)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(resolution);
+  sphere->SetPhiResolution(resolution);
+  sphere->Update();
+  return sphere->GetOutput();
+}
+
+// Random lines crossing the unit sphere, some of them missing it.
+void MakeLines(vtkIdType numLines, std::vector<double>& p1,
+               std::vector<double>& p2)
+{
+  p1.resize(3 * numLines);
+  p2.resize(3 * numLines);
+  for (vtkIdType i = 0; i < numLines; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      p1[3 * i + j] = vtkMath::Random(-1.0, 1.0);
+      p2[3 * i + j] = vtkMath::Random(-1.0, 1.0);
+    }
+    // Lines along the axes test the slabs parallel to the lines
+    if (i % 10 == 0)
+    {
+      p2[3 * i] = p1[3 * i];
+      p2[3 * i + 1] = p1[3 * i + 1];
+    }
+  }
+}
+
+// The closest intersection over all the cells, the smallest id on ties.
+vtkIdType BruteForceIntersect(vtkDataSet* dataSet, const double* p1,
+                              const double* p2, double tol, double& tBest)
+{
+  vtkNew<vtkGenericCell> cell;
+  vtkIdType best = -1;
+  for (vtkIdType cellId = 0; cellId < dataSet->GetNumberOfCells(); ++cellId)
+  {
+    double t, x[3], pcoords[3];
+    int subId;
+    dataSet->GetCell(cellId, cell);
+    if (cell->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId) &&
+        (best < 0 || t < tBest))
+    {
+      best = cellId;
+      tBest = t;
+    }
+  }
+  return best;
+}
+
+bool TestLines(vtkPolyData* sphere, vtkIdType numLines, vtkIdType numChecked)
+{
+  const double tol = 1.0e-6;
+  std::vector<double> p1, p2;
+  MakeLines(numLines, p1, p2);
+
+  // The hierarchy and the intersections do not depend on the threads
+  vtkNew<vtkBVHCellLocator> serial;
+  vtkNew<vtkBVHCellLocator> threaded;
+  serial->SetDataSet(sphere);
+  threaded->SetDataSet(sphere);
+  std::vector<vtkIdType> serialIds(numLines), threadedIds(numLines);
+  std::vector<double> serialT(numLines), threadedT(numLines);
+  std::vector<double> threadedX(3 * numLines);
+  vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+    serial->BuildLocator();
+    serial->IntersectWithLines(numLines, p1.data(), p2.data(), tol,
+                               serialIds.data(), serialT.data());
+  });
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+    threaded->BuildLocator();
+    threaded->IntersectWithLines(numLines, p1.data(), p2.data(), tol,
+                                 threadedIds.data(), threadedT.data(),
+                                 threadedX.data());
+  });
+  if (serial->GetNumberOfNodes() != threaded->GetNumberOfNodes() ||
+      serial->GetLevel() != threaded->GetLevel() || serialIds != threadedIds ||
+      serialT != threadedT)
+  {
+    cerr << "Different hierarchies or intersections with threads: "
+         << threaded->GetNumberOfNodes() << " nodes instead of "
+         << serial->GetNumberOfNodes() << endl;
+    return false;
+  }
+
+  vtkNew<vtkGenericCell> cell;
+  vtkIdType numHits = 0;
+  for (vtkIdType i = 0; i < numLines; ++i)
+  {
+    double t = 0.0, x[3], pcoords[3];
+    int subId;
+    vtkIdType cellId;
+    threaded->IntersectWithLine(&p1[3 * i], &p2[3 * i], tol, t, x, pcoords,
+                                subId, cellId, cell);
+    if (cellId != threadedIds[i] ||
+        (cellId >= 0 && (t != threadedT[i] || x[0] != threadedX[3 * i] ||
+                         x[1] != threadedX[3 * i + 1] ||
+                         x[2] != threadedX[3 * i + 2])))
+    {
+      cerr << "Batched intersection " << threadedIds[i] << " of line " << i
+           << " differs from the single one " << cellId << endl;
+      return false;
+    }
+    numHits += (cellId >= 0);
+    if (i < numChecked)
+    {
+      double tBest = 0.0;
+      vtkIdType best = BruteForceIntersect(sphere, &p1[3 * i], &p2[3 * i],
+                                           tol, tBest);
+      if ((best < 0) != (cellId < 0) || (best >= 0 && tBest != t))
+      {
+        cerr << "Wrong intersection of line " << i << ": cell " << cellId
+             << " at " << t << " instead of cell " << best << " at " << tBest
+             << endl;
+        return false;
+      }
+    }
+  }
+  if (numHits < numLines / 4)
+  {
+    cerr << "Only " << numHits << " lines of " << numLines
+         << " intersect the sphere" << endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestFindCell(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkBVHCellLocator> locator;
+  locator->SetDataSet(grid);
+  locator->BuildLocator();
+  vtkNew<vtkGenericCell> cell;
+  double pcoords[3], weights[8], dist2;
+  int subId;
+  for (int i = 0; i < 1000; ++i)
+  {
+    double x[3] = { vtkMath::Random(-0.1, 1.1), vtkMath::Random(-0.1, 1.1),
+                    vtkMath::Random(-0.1, 1.1) };
+    vtkIdType cellId = locator->FindCell(x, 0.0, cell, pcoords, weights);
+    bool inside = false;
+    for (vtkIdType j = 0; j < grid->GetNumberOfCells() && !inside; ++j)
+    {
+      grid->GetCell(j, cell);
+      inside = cell->EvaluatePosition(x, nullptr, subId, pcoords, dist2,
+                                      weights) == 1;
+    }
+    if ((cellId >= 0) != inside)
+    {
+      cerr << "Wrong cell " << cellId << " found for point " << i << endl;
+      return false;
+    }
+
+    double closest[3], closestDist2;
+    vtkIdType closestId;
+    locator->FindClosestPoint(x, closest, cell, closestId, subId, closestDist2);
+    double bestDist2 = VTK_DOUBLE_MAX;
+    for (vtkIdType j = 0; j < grid->GetNumberOfCells(); ++j)
+    {
+      double point[3];
+      grid->GetCell(j, cell);
+      if (cell->EvaluatePosition(x, point, subId, pcoords, dist2, weights) != -1)
+      {
+        bestDist2 = std::min(bestDist2, dist2);
+      }
+    }
+    if (closestId < 0 || closestDist2 != bestDist2)
+    {
+      cerr << "Wrong closest point for point " << i << ": " << closestDist2
+           << " instead of " << bestDist2 << endl;
+      return false;
+    }
+  }
+
+  vtkNew<vtkIdList> cells;
+  double bbox[6] = { 0.22, 0.41, 0.05, 0.12, 0.5, 0.73 };
+  locator->FindCellsWithinBounds(bbox, cells);
+  vtkIdType numCells = 0;
+  for (vtkIdType j = 0; j < grid->GetNumberOfCells(); ++j)
+  {
+    double b[6];
+    grid->GetCellBounds(j, b);
+    numCells += b[0] <= bbox[1] && bbox[0] <= b[1] && b[2] <= bbox[3] &&
+      bbox[2] <= b[3] && b[4] <= bbox[5] && bbox[4] <= b[5];
+  }
+  if (cells->GetNumberOfIds() != numCells || numCells == 0)
+  {
+    cerr << cells->GetNumberOfIds() << " cells within bounds instead of "
+         << numCells << endl;
+    return false;
+  }
+  return true;
+}
+
+}
+
+int TestBVHCellLocator(int, char*[])
+{
+  vtkMath::RandomSeed(1234);
+
+  // A small sphere checked against brute force, and a sphere large enough
+  // for the hierarchy to be built in parallel.
+  if (!TestLines(MakeSphere(40), 2000, 2000) ||
+      !TestLines(MakeSphere(300), 20000, 100) || !TestFindCell(MakeGrid()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,397 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCellArray.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Exercise the offsets/connectivity storage of vtkCellArray: 32/64-bit
+// storage, random access, legacy format compatibility and concurrent
+// traversal with vtkCellArrayIterator and vtkUnstructuredGrid queries.
+
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellType.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <atomic>
+
+#define TEST_ASSERT(cond, msg) \
+  if (!(cond)) \
+  { \
+    cerr << "Failure (line " << __LINE__ << "): " << msg << endl; \
+    return false; \
+  }
+
+namespace
+{
+
+// Cells of increasing size: cell i has i%5+1 points, starting at point i.
+void FillCells(vtkCellArray *ca, vtkIdType numCells)
+{
+  vtkIdType pts[5];
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    vtkIdType npts = cellId % 5 + 1;
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      pts[i] = cellId + i;
+    }
+    ca->InsertNextCell(npts, pts);
+  }
+}
+
+bool CheckCells(vtkCellArray *ca, vtkIdType numCells)
+{
+  TEST_ASSERT(ca->GetNumberOfCells() == numCells,
+              "Wrong number of cells: " << ca->GetNumberOfCells());
+  vtkIdType npts;
+  const vtkIdType *pts;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    ca->GetCellAtId(cellId, npts, pts);
+    TEST_ASSERT(npts == cellId % 5 + 1, "Wrong size for cell " << cellId);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      TEST_ASSERT(pts[i] == cellId + i, "Wrong point id in cell " << cellId);
+    }
+  }
+  return true;
+}
+
+bool TestStorage(bool use64Bit)
+{
+  const vtkIdType numCells = 100;
+  vtkNew<vtkCellArray> ca;
+  if (use64Bit)
+  {
+    ca->Use64BitStorage();
+  }
+  else
+  {
+    ca->Use32BitStorage();
+  }
+  FillCells(ca, numCells);
+  TEST_ASSERT(ca->IsStorage64Bit() == use64Bit, "Wrong storage type");
+  TEST_ASSERT(ca->IsValid(), "Invalid cell array");
+  TEST_ASSERT(ca->GetNumberOfOffsets() == numCells + 1, "Wrong offsets");
+  TEST_ASSERT(ca->GetOffset(numCells) == ca->GetNumberOfConnectivityIds(),
+              "Last offset should be the connectivity size");
+  TEST_ASSERT(ca->GetMaxCellSize() == 5, "Wrong maximum cell size");
+  if (!CheckCells(ca, numCells))
+  {
+    return false;
+  }
+
+  // Conversions preserve the cells.
+  TEST_ASSERT(ca->ConvertTo64BitStorage(), "Conversion to 64 bits failed");
+  TEST_ASSERT(ca->CanConvertTo32BitStorage(), "Cannot convert to 32 bits");
+  TEST_ASSERT(ca->ConvertTo32BitStorage(), "Conversion to 32 bits failed");
+  TEST_ASSERT(!ca->IsStorage64Bit(), "Storage should be 32 bits");
+  if (!CheckCells(ca, numCells))
+  {
+    return false;
+  }
+
+  // Modification by cell id.
+  vtkIdType repl[3] = { 7, 8, 9 };
+  ca->ReplaceCellAtId(2, 3, repl);
+  ca->ReverseCellAtId(2);
+  vtkNew<vtkIdList> ids;
+  ca->GetCellAtId(2, ids);
+  TEST_ASSERT(ids->GetNumberOfIds() == 3 && ids->GetId(0) == 9 &&
+              ids->GetId(2) == 7, "ReplaceCellAtId/ReverseCellAtId failed");
+
+  // Append shifts the point ids.
+  vtkNew<vtkCellArray> ca2;
+  ca2->DeepCopy(ca);
+  ca2->Append(ca, 1000);
+  TEST_ASSERT(ca2->GetNumberOfCells() == 2 * numCells, "Append failed");
+  ca2->GetCellAtId(numCells + 2, ids);
+  TEST_ASSERT(ids->GetId(0) == 1009, "Append did not offset point ids");
+
+#ifdef VTK_USE_64BIT_IDS
+  // Shifted point ids that no longer fit in 32 bits switch to 64 bits.
+  vtkNew<vtkCellArray> ca3;
+  ca3->Use32BitStorage();
+  vtkIdType large = 1500000000;
+  ca3->InsertNextCell(1, &large);
+  ca2->Use32BitStorage();
+  FillCells(ca2, 1);
+  ca2->Append(ca3, 1000000000);
+  TEST_ASSERT(ca2->IsStorage64Bit(), "Append overflowed 32-bit storage");
+  ca2->GetCellAtId(1, ids);
+  TEST_ASSERT(ids->GetId(0) == 2500000000, "Append overflowed point ids");
+#endif
+  return true;
+}
+
+bool TestLegacy()
+{
+  const vtkIdType numCells = 50;
+  vtkNew<vtkCellArray> ca;
+  FillCells(ca, numCells);
+
+  // Export and import round trip.
+  vtkNew<vtkIdTypeArray> legacy;
+  ca->ExportLegacyFormat(legacy);
+  TEST_ASSERT(legacy->GetNumberOfValues() ==
+              ca->GetNumberOfConnectivityIds() + numCells,
+              "Wrong legacy size");
+  vtkNew<vtkCellArray> imported;
+  imported->ImportLegacyFormat(legacy);
+  if (!CheckCells(imported, numCells))
+  {
+    return false;
+  }
+
+  // Legacy locations are still accepted.
+  vtkIdType loc = 0;
+  vtkIdType npts, *pts;
+  for (vtkIdType cellId = 0; cellId < 10; ++cellId)
+  {
+    loc += cellId % 5 + 1 + 1;
+  }
+  ca->GetCell(loc, npts, pts);
+  TEST_ASSERT(npts == 1 && pts[0] == 10, "Legacy GetCell failed");
+
+  // Writes through the legacy pointer are picked up.
+  vtkIdType *data = ca->GetPointer();
+  data[1] = 42;
+  vtkNew<vtkIdList> ids;
+  ca->GetCellAtId(0, ids);
+  TEST_ASSERT(ids->GetNumberOfIds() == 1 && ids->GetId(0) == 42,
+              "Legacy write was lost");
+
+  // SetCells() shares the legacy array.
+  vtkNew<vtkCellArray> shared;
+  shared->SetCells(numCells, legacy);
+  TEST_ASSERT(shared->GetNumberOfCells() == numCells, "SetCells failed");
+  if (!CheckCells(shared, numCells))
+  {
+    return false;
+  }
+
+  // Traversal.
+  vtkIdType count = 0;
+  for (ca->InitTraversal(); ca->GetNextCell(npts, pts); ++count)
+  {
+  }
+  TEST_ASSERT(count == numCells, "Traversal visited " << count << " cells");
+
+  // vtkPolyData hands out cells in the legacy layout without switching its
+  // cell arrays back to it.
+  vtkNew<vtkPolyData> polyData;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numCells + 7);
+  vtkNew<vtkCellArray> polys;
+  vtkIdType polyPts[7];
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    npts = cellId % 5 + 3;
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      polyPts[i] = cellId + i;
+    }
+    polys->InsertNextCell(npts, polyPts);
+  }
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+  polyData->BuildCells();
+  vtkIdType *cell;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    polyData->GetCell(cellId, cell);
+    TEST_ASSERT(cell[0] == cellId % 5 + 3 && cell[1] == cellId &&
+                cell[cell[0]] == cellId + cell[0] - 1,
+                "Wrong legacy cell " << cellId);
+  }
+  TEST_ASSERT(!polys->IsLegacyDataPending(),
+              "GetCell() switched the polygons to the legacy layout");
+  return true;
+}
+
+struct SumPointIds
+{
+  vtkCellArray *Cells;
+  vtkSMPThreadLocalObject<vtkCellArrayIterator> Iterator;
+  std::atomic<vtkIdType> Sum;
+
+  SumPointIds(vtkCellArray *cells) : Cells(cells), Sum(0) {}
+
+  void Initialize()
+  {
+    this->Iterator.Local()->SetCellArray(this->Cells);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkCellArrayIterator *iter = this->Iterator.Local();
+    vtkIdType npts, sum = 0;
+    const vtkIdType *pts;
+    for (iter->GoToCell(begin); iter->GetCurrentCellId() < end;
+         iter->GoToNextCell())
+    {
+      iter->GetCurrentCell(npts, pts);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        sum += pts[i];
+      }
+    }
+    this->Sum += sum;
+  }
+
+  void Reduce() {}
+};
+
+bool TestIterator(bool use64Bit)
+{
+  const vtkIdType numCells = 100000;
+  vtkNew<vtkCellArray> ca;
+  if (use64Bit)
+  {
+    ca->Use64BitStorage();
+  }
+  else
+  {
+    ca->Use32BitStorage();
+  }
+  FillCells(ca, numCells);
+
+  vtkIdType expected = 0;
+  vtkSmartPointer<vtkCellArrayIterator> iter =
+    vtkSmartPointer<vtkCellArrayIterator>::Take(ca->NewIterator());
+  vtkIdType npts;
+  const vtkIdType *pts;
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal();
+       iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      expected += pts[i];
+    }
+  }
+
+  SumPointIds sum(ca);
+  vtkSMPTools::For(0, numCells, sum);
+  TEST_ASSERT(sum.Sum == expected, "Parallel traversal mismatch");
+  return true;
+}
+
+// vtkUnstructuredGrid queries fill the caller's cell or id list: they can be
+// run concurrently whatever the storage, and never import pending legacy data.
+struct CheckGridCells
+{
+  vtkUnstructuredGrid *Grid;
+  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkSMPThreadLocalObject<vtkIdList> PointIds;
+  std::atomic<vtkIdType> NumberOfErrors;
+
+  CheckGridCells(vtkUnstructuredGrid *grid) : Grid(grid), NumberOfErrors(0) {}
+
+  void Initialize() {}
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkGenericCell *cell = this->Cell.Local();
+    vtkIdList *ptIds = this->PointIds.Local();
+    vtkIdType npts, errors = 0;
+    const vtkIdType *pts;
+    double bounds[6];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      vtkIdType expected = cellId % 5 + 1;
+      this->Grid->GetCell(cellId, cell);
+      this->Grid->GetCellPoints(cellId, ptIds);
+      this->Grid->GetCellPoints(cellId, npts, pts, ptIds);
+      this->Grid->GetCellBounds(cellId, bounds);
+      if (cell->GetNumberOfPoints() != expected ||
+          ptIds->GetNumberOfIds() != expected || npts != expected ||
+          bounds[0] != cellId || bounds[1] != cellId + expected - 1)
+      {
+        ++errors;
+        continue;
+      }
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        if (cell->GetPointId(i) != cellId + i ||
+            ptIds->GetId(i) != cellId + i || pts[i] != cellId + i)
+        {
+          ++errors;
+          break;
+        }
+      }
+    }
+    this->NumberOfErrors += errors;
+  }
+
+  void Reduce() {}
+};
+
+bool TestGridQueries(bool use64Bit, bool legacyPending)
+{
+  const vtkIdType numCells = 100000;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numCells + 5);
+  for (vtkIdType ptId = 0; ptId < numCells + 5; ++ptId)
+  {
+    points->SetPoint(ptId, ptId, 0., 0.);
+  }
+  vtkNew<vtkCellArray> ca;
+  if (use64Bit)
+  {
+    ca->Use64BitStorage();
+  }
+  else
+  {
+    ca->Use32BitStorage();
+  }
+  FillCells(ca, numCells);
+
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  grid->SetCells(VTK_POLY_VERTEX, ca);
+  if (legacyPending)
+  {
+    grid->GetCells()->GetData();
+  }
+
+  CheckGridCells check(grid);
+  vtkSMPTools::For(0, numCells, check);
+  TEST_ASSERT(check.NumberOfErrors == 0,
+              check.NumberOfErrors << " cells queried incorrectly");
+  TEST_ASSERT(grid->GetCells()->IsLegacyDataPending() == legacyPending,
+              "Queries modified the cell array");
+  return true;
+}
+
+} // end anon namespace
+
+int TestCellArray(int, char*[])
+{
+  if (!TestStorage(false) || !TestStorage(true) || !TestLegacy() ||
+      !TestIterator(false) || !TestIterator(true) ||
+      !TestGridQueries(false, false) || !TestGridQueries(true, false) ||
+      !TestGridQueries(false, true))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,160 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestStaticPointLocatorUpdate.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that updating vtkStaticPointLocator after the points moved gives
+// the same buckets as building it again with the same bounds and divisions.
+
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticPointLocator.h"
+
+namespace
+{
+
+// Compare the buckets of the locator with the ones of a locator built from
+// scratch with the same bounds and divisions.
+bool SameBuckets(vtkStaticPointLocator* locator, vtkDataSet* dataSet)
+{
+  vtkNew<vtkStaticPointLocator> reference;
+  reference->SetDataSet(dataSet);
+  reference->AutomaticOff();
+  reference->SetDivisions(locator->GetDivisions());
+  reference->BuildLocator(locator->GetBounds());
+
+  vtkNew<vtkIdList> ids, referenceIds;
+  for (vtkIdType bucket = 0; bucket < locator->GetNumberOfBuckets(); ++bucket)
+  {
+    locator->GetBucketIds(bucket, ids);
+    reference->GetBucketIds(bucket, referenceIds);
+    bool same = ids->GetNumberOfIds() == referenceIds->GetNumberOfIds();
+    for (vtkIdType i = 0; same && i < ids->GetNumberOfIds(); ++i)
+    {
+      same = ids->GetId(i) == referenceIds->GetId(i);
+    }
+    if (!same)
+    {
+      cerr << "Bucket " << bucket << " differs from a fresh build" << endl;
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 100; ++i)
+  {
+    double x[3] = { vtkMath::Random(0.0, 1.0), vtkMath::Random(0.0, 1.0),
+                    vtkMath::Random(0.0, 1.0) };
+    vtkIdType ptId = locator->FindClosestPoint(x);
+    if (ptId != reference->FindClosestPoint(x))
+    {
+      cerr << "Wrong closest point " << ptId << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Move a fraction of the points a little, keeping them in the unit cube.
+void MovePoints(vtkPoints* points, double fraction)
+{
+  double x[3];
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    if (vtkMath::Random() < fraction)
+    {
+      points->GetPoint(ptId, x);
+      for (int i = 0; i < 3; ++i)
+      {
+        x[i] += vtkMath::Random(-0.05, 0.05);
+        x[i] = x[i] < 0.0 ? 0.0 : (x[i] > 1.0 ? 1.0 : x[i]);
+      }
+      points->SetPoint(ptId, x);
+    }
+  }
+  points->Modified();
+}
+
+}
+
+int TestStaticPointLocatorUpdate(int, char*[])
+{
+  vtkMath::RandomSeed(5678);
+  const vtkIdType numPts = 100000;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    points->SetPoint(ptId, vtkMath::Random(0.0, 1.0),
+                     vtkMath::Random(0.0, 1.0), vtkMath::Random(0.0, 1.0));
+  }
+  // Pin the bounds to the unit cube
+  points->SetPoint(0, 0.0, 0.0, 0.0);
+  points->SetPoint(1, 1.0, 1.0, 1.0);
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(polyData);
+  locator->SetNumberOfPointsPerBucket(4);
+  locator->IncrementalUpdateOn();
+  locator->BuildLocator();
+
+  // The queries update the locator after the points moved
+  for (int step = 0; step < 3; ++step)
+  {
+    MovePoints(points, 0.1);
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+      locator->FindClosestPoint(0.5, 0.5, 0.5);
+    });
+    if (locator->GetNumberOfMovedPoints() <= 0 ||
+        !SameBuckets(locator, polyData))
+    {
+      cerr << "Step " << step << ": " << locator->GetNumberOfMovedPoints()
+           << " moved points" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Rebind the locator to new coordinates of the points
+  vtkNew<vtkPoints> newPoints;
+  newPoints->DeepCopy(points);
+  MovePoints(newPoints, 0.5);
+  vtkNew<vtkPolyData> newPolyData;
+  newPolyData->SetPoints(newPoints);
+  vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+    locator->UpdateLocator(newPolyData);
+  });
+  if (locator->GetDataSet() != newPolyData.GetPointer() ||
+      locator->GetNumberOfMovedPoints() <= 0 ||
+      !SameBuckets(locator, newPolyData))
+  {
+    cerr << "Wrong update with new coordinates" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // A point leaving the bounds forces a full build
+  newPoints->SetPoint(10, 1.5, 0.5, 0.5);
+  newPoints->Modified();
+  locator->UpdateLocator();
+  if (locator->GetNumberOfMovedPoints() != -1 ||
+      locator->FindClosestPoint(1.4, 0.5, 0.5) != 10)
+  {
+    cerr << "The locator was not rebuilt" << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -22,6 +22,59 @@
 #include "vtkPoints.h"
 #include "vtkDataSet.h"
 #include "vtkMath.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+//----------------------------------------------------------------------------
+// Find the cells containing a range of points, with a generic cell and
+// scratch parametric coordinates and weights per thread.
+struct FindCellsWorker
+{
+  vtkAbstractCellLocator *Locator;
+  const double *X;
+  double Tol2;
+  vtkIdType *CellIds;
+  double *PCoords;
+  double *Weights;
+  int MaxCellSize;
+  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkSMPThreadLocal<std::vector<double>> ScratchWeights;
+
+  void Initialize()
+  {
+    this->ScratchWeights.Local().resize(this->MaxCellSize);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkGenericCell *cell = this->Cell.Local();
+    double *scratchWeights = this->ScratchWeights.Local().data();
+    double x[3], pcoords[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      x[0] = this->X[3*i];
+      x[1] = this->X[3*i+1];
+      x[2] = this->X[3*i+2];
+      this->CellIds[i] = this->Locator->FindCell(x, this->Tol2, cell,
+        this->PCoords ? this->PCoords + 3*i : pcoords,
+        this->Weights ? this->Weights + this->MaxCellSize*i : scratchWeights);
+    }
+  }
+
+  void Reduce()
+  {
+  }
+};
+
+} // anonymous namespace
+
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
 vtkAbstractCellLocator::vtkAbstractCellLocator()
@@ -199,6 +252,42 @@ vtkIdType vtkAbstractCellLocator::FindCell(
   }
   return returnVal;
 }
+//----------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindCells(vtkIdType numPts, const double *x,
+  double tol2, vtkIdType *cellIds, double *pcoords, double *weights)
+{
+  if ( numPts <= 0 || !this->DataSet || this->DataSet->GetNumberOfCells() < 1 )
+  {
+    for (vtkIdType i=0; i < numPts; ++i)
+    {
+      cellIds[i] = -1;
+    }
+    return;
+  }
+
+  FindCellsWorker worker;
+  worker.Locator = this;
+  worker.X = x;
+  worker.Tol2 = tol2;
+  worker.CellIds = cellIds;
+  worker.PCoords = pcoords;
+  worker.Weights = weights;
+  worker.MaxCellSize = std::max(this->DataSet->GetMaxCellSize(), 1);
+
+  if ( ! this->HasThreadSafeQueries() )
+  {
+    worker.Initialize();
+    worker(0, numPts);
+    return;
+  }
+
+  // Build the locator, and the cell structures of the dataset that are
+  // built on first access, before the threads query them.
+  this->BuildLocator();
+  this->DataSet->GetCell(0, this->GenericCell);
+  vtkSMPTools::For(0, numPts, worker);
+}
+
 //----------------------------------------------------------------------------
 bool vtkAbstractCellLocator::InsideCellBounds(double x[3], vtkIdType cell_ID)
 {
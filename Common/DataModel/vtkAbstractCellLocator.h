@@ -260,6 +260,20 @@ public:
     double x[3], double tol2, vtkGenericCell *GenCell,
     double pcoords[3], double *weights);
 
+  /**
+   * Batched version of FindCell(): find the cells containing the numPts
+   * points x (x-y-z triples) and store their ids (or -1) in cellIds, which
+   * must be allocated by the caller. If not null, pcoords receives the
+   * parametric coordinates of each point (3 values per point) and weights its
+   * interpolation weights (DataSet->GetMaxCellSize() values per point). When
+   * HasThreadSafeQueries() is true, the locator is built first and the points
+   * are then processed in parallel, otherwise they are processed one after
+   * the other. The results are the same either way.
+   */
+  void FindCells(vtkIdType numPts, const double *x, double tol2,
+                 vtkIdType *cellIds, double *pcoords = nullptr,
+                 double *weights = nullptr);
+
   /**
    * Quickly test if a point is inside the bounds of a particular cell.
    * Some locators cache cell bounds and this function can make use
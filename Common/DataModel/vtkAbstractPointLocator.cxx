@@ -16,6 +16,88 @@
 
 #include "vtkDataSet.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+//-----------------------------------------------------------------------------
+// Find the closest point of a range of positions.
+struct ClosestPointsWorker
+{
+  vtkAbstractPointLocator *Locator;
+  const double *X;
+  vtkIdType *PtIds;
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      this->PtIds[i] = this->Locator->FindClosestPoint(this->X + 3*i);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Find the points within the radius of a range of positions. The points
+// found by each thread are appended to a thread local buffer, and the
+// buffer and the location in it of the points of each position are
+// recorded so that they can be gathered in order afterwards.
+struct PointsWithinRadiusWorker
+{
+  vtkAbstractPointLocator *Locator;
+  double Radius;
+  const double *X;
+  vtkIdType *Counts;
+  const std::vector<vtkIdType> **Buffers;
+  vtkIdType *Starts;
+  vtkSMPThreadLocalObject<vtkIdList> Result;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Buffer;
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkIdList *result = this->Result.Local();
+    std::vector<vtkIdType> &buffer = this->Buffer.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      this->Locator->FindPointsWithinRadius(this->Radius, this->X + 3*i, result);
+      vtkIdType numIds = result->GetNumberOfIds();
+      this->Counts[i] = numIds;
+      this->Buffers[i] = &buffer;
+      this->Starts[i] = static_cast<vtkIdType>(buffer.size());
+      buffer.insert(buffer.end(), result->GetPointer(0),
+                    result->GetPointer(0) + numIds);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Copy the gathered points of a range of positions to their final place.
+struct GatherPointsWorker
+{
+  const vtkIdType *Offsets;
+  const std::vector<vtkIdType> **Buffers;
+  const vtkIdType *Starts;
+  vtkIdType *Ids;
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType *src = this->Buffers[i]->data() + this->Starts[i];
+      std::copy(src, src + (this->Offsets[i+1] - this->Offsets[i]),
+                this->Ids + this->Offsets[i]);
+    }
+  }
+};
+
+} // anonymous namespace
 
 
 //-----------------------------------------------------------------------------
@@ -66,6 +148,84 @@ void vtkAbstractPointLocator::FindPointsWithinRadius(double R, double x,
   this->FindPointsWithinRadius(R,p,result);
 }
 
+//-----------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindClosestPoints(vtkIdType numPts,
+                                                const double *x,
+                                                vtkIdType *ptIds)
+{
+  if ( numPts <= 0 )
+  {
+    return;
+  }
+
+  if ( ! this->HasThreadSafeQueries() )
+  {
+    for (vtkIdType i=0; i < numPts; ++i)
+    {
+      ptIds[i] = this->FindClosestPoint(x + 3*i);
+    }
+    return;
+  }
+
+  this->BuildLocator();
+  ClosestPointsWorker worker = { this, x, ptIds };
+  vtkSMPTools::For(0, numPts, worker);
+}
+
+//-----------------------------------------------------------------------------
+void vtkAbstractPointLocator::FindPointsWithinRadius(double R,
+                                                     vtkIdType numPts,
+                                                     const double *x,
+                                                     vtkIdTypeArray *offsets,
+                                                     vtkIdTypeArray *ids)
+{
+  offsets->SetNumberOfComponents(1);
+  offsets->SetNumberOfTuples(numPts + 1);
+  vtkIdType *o = offsets->GetPointer(0);
+  o[0] = 0;
+  ids->SetNumberOfComponents(1);
+
+  if ( ! this->HasThreadSafeQueries() )
+  {
+    vtkIdList *result = vtkIdList::New();
+    ids->SetNumberOfTuples(0);
+    for (vtkIdType i=0; i < numPts; ++i)
+    {
+      this->FindPointsWithinRadius(R, x + 3*i, result);
+      for (vtkIdType j=0; j < result->GetNumberOfIds(); ++j)
+      {
+        ids->InsertNextValue(result->GetId(j));
+      }
+      o[i+1] = ids->GetNumberOfTuples();
+    }
+    result->Delete();
+    return;
+  }
+
+  // The points of each position are found in parallel into thread local
+  // buffers, then copied in position order once the offsets are known.
+  this->BuildLocator();
+  std::vector<const std::vector<vtkIdType>*> buffers(numPts);
+  std::vector<vtkIdType> starts(numPts);
+  PointsWithinRadiusWorker worker;
+  worker.Locator = this;
+  worker.Radius = R;
+  worker.X = x;
+  worker.Counts = o + 1;
+  worker.Buffers = buffers.data();
+  worker.Starts = starts.data();
+  vtkSMPTools::For(0, numPts, worker);
+
+  for (vtkIdType i=0; i < numPts; ++i)
+  {
+    o[i+1] += o[i];
+  }
+  ids->SetNumberOfTuples(o[numPts]);
+  GatherPointsWorker gather = { o, buffers.data(), starts.data(),
+                                ids->GetPointer(0) };
+  vtkSMPTools::For(0, numPts, gather);
+}
+
 //-----------------------------------------------------------------------------
 void vtkAbstractPointLocator::GetBounds(double* bnds)
 {
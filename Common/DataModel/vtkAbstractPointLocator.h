@@ -34,6 +34,7 @@
 #include "vtkLocator.h"
 
 class vtkIdList;
+class vtkIdTypeArray;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkAbstractPointLocator : public vtkLocator
 {
@@ -93,6 +94,23 @@ public:
                                       vtkIdList *result);
   //@}
 
+  //@{
+  /**
+   * Batched queries over the numPts positions x (x-y-z triples).
+   * FindClosestPoints() stores the id of the point closest to each position
+   * in ptIds, which must be allocated by the caller. FindPointsWithinRadius()
+   * stores the points within the radius R of position i in ids, from
+   * offsets[i] to offsets[i+1] (offsets has numPts+1 values); the points of
+   * each position are in the order FindPointsWithinRadius(R, x, result)
+   * returns them. When HasThreadSafeQueries() is true, the locator is built
+   * first and the positions are then processed in parallel, otherwise they
+   * are processed one after the other. The results are the same either way.
+   */
+  void FindClosestPoints(vtkIdType numPts, const double *x, vtkIdType *ptIds);
+  void FindPointsWithinRadius(double R, vtkIdType numPts, const double *x,
+                              vtkIdTypeArray *offsets, vtkIdTypeArray *ids);
+  //@}
+
   //@{
   /**
    * Provide an accessor to the bounds. Valid after the locator is built.
@@ -0,0 +1,1285 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBVHCellLocator.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkBVHCellLocator.h"
+
+#include "vtkCellArray.h"
+#include "vtkDataSet.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+vtkStandardNewMacro(vtkBVHCellLocator);
+
+namespace
+{
+
+// Number of lines traversing the hierarchy together in IntersectWithLines().
+const int PacketSize = 8;
+
+// Nodes with at least this many cells are binned in parallel, and
+// hierarchies over at least this many cells are split in subtrees which are
+// built in parallel.
+const vtkIdType ParallelSize = 65536;
+
+//-----------------------------------------------------------------------------
+inline void InitializeBounds(double b[6])
+{
+  b[0] = b[2] = b[4] = VTK_DOUBLE_MAX;
+  b[1] = b[3] = b[5] = -VTK_DOUBLE_MAX;
+}
+
+//-----------------------------------------------------------------------------
+inline void AddBounds(double b[6], const double c[6])
+{
+  b[0] = std::min(b[0], c[0]);
+  b[1] = std::max(b[1], c[1]);
+  b[2] = std::min(b[2], c[2]);
+  b[3] = std::max(b[3], c[3]);
+  b[4] = std::min(b[4], c[4]);
+  b[5] = std::max(b[5], c[5]);
+}
+
+//-----------------------------------------------------------------------------
+// Half of the surface area of a box, which is proportional to the
+// probability that a random line hitting the parent also hits the box.
+inline double HalfArea(const double b[6])
+{
+  double dx = b[1] - b[0];
+  double dy = b[3] - b[2];
+  double dz = b[5] - b[4];
+  return dx*dy + dy*dz + dz*dx;
+}
+
+//-----------------------------------------------------------------------------
+inline bool InBounds(const double b[6], const double x[3])
+{
+  return b[0] <= x[0] && x[0] <= b[1] && b[2] <= x[1] && x[1] <= b[3] &&
+    b[4] <= x[2] && x[2] <= b[5];
+}
+
+//-----------------------------------------------------------------------------
+inline bool BoundsIntersect(const double b[6], const double c[6])
+{
+  return b[0] <= c[1] && c[0] <= b[1] && b[2] <= c[3] && c[2] <= b[3] &&
+    b[4] <= c[5] && c[4] <= b[5];
+}
+
+//-----------------------------------------------------------------------------
+inline double Distance2ToBounds(const double b[6], const double x[3])
+{
+  double dist2 = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    double d = std::max(std::max(b[2*i] - x[i], x[i] - b[2*i+1]), 0.0);
+    dist2 += d*d;
+  }
+  return dist2;
+}
+
+//-----------------------------------------------------------------------------
+// The inverse of the direction of the line (p1,p2). Null or tiny components
+// are replaced by a large finite value so that the slab tests below never
+// produce NaN.
+inline void InverseDirection(const double p1[3], const double p2[3],
+                             double inv[3])
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    double d = p2[i] - p1[i];
+    inv[i] = (d != 0.0 ? 1.0 / d : VTK_DOUBLE_MAX);
+    if (std::isinf(inv[i]))
+    {
+      inv[i] = (d > 0.0 ? VTK_DOUBLE_MAX : -VTK_DOUBLE_MAX);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Slab test of the line starting at o with inverse direction inv against
+// the box enlarged by tol, for the parametric coordinates in [0,tMax].
+inline bool IntersectBox(const double b[6], const double o[3],
+                         const double inv[3], double tol, double tMax)
+{
+  double t0 = 0.0, t1 = tMax;
+  for (int i = 0; i < 3; ++i)
+  {
+    double ta = (b[2*i] - tol - o[i]) * inv[i];
+    double tb = (b[2*i+1] + tol - o[i]) * inv[i];
+    t0 = std::max(t0, std::min(ta, tb));
+    t1 = std::min(t1, std::max(ta, tb));
+  }
+  return t0 <= t1;
+}
+
+//-----------------------------------------------------------------------------
+// The lines of a packet, in structure of arrays layout so that the slab
+// tests of a box against all the lines are one loop over the lines.
+struct LinePacket
+{
+  double O[3][PacketSize];
+  double Inv[3][PacketSize];
+  double TMax[PacketSize];
+  bool Hit[PacketSize];
+
+  // Return the number of lines of the packet hitting the box.
+  int IntersectBox(const double b[6], double tol)
+  {
+    double t0[PacketSize], t1[PacketSize];
+    for (int l = 0; l < PacketSize; ++l)
+    {
+      t0[l] = 0.0;
+      t1[l] = this->TMax[l];
+    }
+    for (int i = 0; i < 3; ++i)
+    {
+      const double lo = b[2*i] - tol;
+      const double hi = b[2*i+1] + tol;
+      for (int l = 0; l < PacketSize; ++l)
+      {
+        double ta = (lo - this->O[i][l]) * this->Inv[i][l];
+        double tb = (hi - this->O[i][l]) * this->Inv[i][l];
+        t0[l] = std::max(t0[l], std::min(ta, tb));
+        t1[l] = std::min(t1[l], std::max(ta, tb));
+      }
+    }
+    int numHits = 0;
+    for (int l = 0; l < PacketSize; ++l)
+    {
+      this->Hit[l] = t0[l] <= t1[l];
+      numHits += this->Hit[l];
+    }
+    return numHits;
+  }
+};
+
+//-----------------------------------------------------------------------------
+// The closest intersection found so far along a line.
+struct LineHit
+{
+  vtkIdType CellId;
+  double T;
+  double X[3];
+  double PCoords[3];
+  int SubId;
+
+  void Initialize()
+  {
+    this->CellId = -1;
+    this->T = 1.0;
+    this->SubId = 0;
+  }
+
+  // Intersect the line with the cell (already loaded in cell) and keep the
+  // intersection if it is closer than the current one, or as close and
+  // with a smaller cell id, so that the result does not depend on the
+  // order in which the cells are visited.
+  void Update(vtkIdType cellId, vtkGenericCell *cell, const double p1[3],
+              const double p2[3], double tol)
+  {
+    double t, x[3], pcoords[3];
+    int subId;
+    if ( cell->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId) &&
+         (this->CellId < 0 || t < this->T ||
+          (t == this->T && cellId < this->CellId)) )
+    {
+      this->CellId = cellId;
+      this->T = t;
+      this->X[0] = x[0];
+      this->X[1] = x[1];
+      this->X[2] = x[2];
+      this->PCoords[0] = pcoords[0];
+      this->PCoords[1] = pcoords[1];
+      this->PCoords[2] = pcoords[2];
+      this->SubId = subId;
+    }
+  }
+};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// The hierarchy: the nodes, the root being the first one, and the ids and
+// bounds of the cells in the order of the leaves.
+struct vtkBVHTree
+{
+  // A node of the flattened hierarchy. The two children of an interior node
+  // (Count == 0) are the nodes Index and Index+1, split along Axis. A leaf
+  // holds the Count cells from position Index in the cells sorted in the
+  // order of the leaves.
+  struct Node
+  {
+    double Bounds[6];
+    vtkIdType Index;
+    vtkIdType Count;
+    int Axis;
+  };
+
+  std::vector<Node> Nodes;
+  std::vector<vtkIdType> CellIds;
+  std::vector<double> CellBounds;
+  int Depth;
+  int MaxCellSize;
+
+  //---------------------------------------------------------------------------
+  // Closest intersection of a line with the cells.
+  void IntersectWithLine(vtkDataSet *ds, const double p1[3],
+                         const double p2[3], double tol, vtkGenericCell *cell,
+                         LineHit &hit, std::vector<vtkIdType> &stack) const
+  {
+    double inv[3];
+    InverseDirection(p1, p2, inv);
+    hit.Initialize();
+    stack.clear();
+    stack.push_back(0);
+    while ( ! stack.empty() )
+    {
+      const Node &node = this->Nodes[stack.back()];
+      stack.pop_back();
+      if ( ! IntersectBox(node.Bounds, p1, inv, tol, hit.T) )
+      {
+        continue;
+      }
+      if ( node.Count > 0 )
+      {
+        for (vtkIdType k = node.Index; k < node.Index + node.Count; ++k)
+        {
+          if ( IntersectBox(&this->CellBounds[6*k], p1, inv, tol, hit.T) )
+          {
+            ds->GetCell(this->CellIds[k], cell);
+            hit.Update(this->CellIds[k], cell, p1, p2, tol);
+          }
+        }
+      }
+      else
+      {
+        // Visit first the child on the side of the start of the line
+        bool leftFirst = inv[node.Axis] > 0.0;
+        stack.push_back(node.Index + (leftFirst ? 1 : 0));
+        stack.push_back(node.Index + (leftFirst ? 0 : 1));
+      }
+    }
+  }
+
+  //---------------------------------------------------------------------------
+  // Closest intersections of the numLines (at most PacketSize) lines
+  // (p1[l],p2[l]) with the cells. The lines traverse the hierarchy together:
+  // a node is visited if one of them hits its box, and each cell is loaded
+  // once for all the lines hitting its bounds.
+  void IntersectWithLines(vtkDataSet *ds, int numLines, const double *p1,
+                          const double *p2, double tol, vtkGenericCell *cell,
+                          LineHit *hits, std::vector<vtkIdType> &stack) const
+  {
+    LinePacket packet;
+    for (int l = 0; l < PacketSize; ++l)
+    {
+      double inv[3] = { 1.0, 1.0, 1.0 };
+      if ( l < numLines )
+      {
+        InverseDirection(p1 + 3*l, p2 + 3*l, inv);
+        hits[l].Initialize();
+      }
+      for (int i = 0; i < 3; ++i)
+      {
+        packet.O[i][l] = (l < numLines ? p1[3*l+i] : 0.0);
+        packet.Inv[i][l] = inv[i];
+      }
+      // The unused lanes never hit anything
+      packet.TMax[l] = (l < numLines ? 1.0 : -1.0);
+    }
+
+    stack.clear();
+    stack.push_back(0);
+    while ( ! stack.empty() )
+    {
+      const Node &node = this->Nodes[stack.back()];
+      stack.pop_back();
+      if ( packet.IntersectBox(node.Bounds, tol) == 0 )
+      {
+        continue;
+      }
+      if ( node.Count > 0 )
+      {
+        for (vtkIdType k = node.Index; k < node.Index + node.Count; ++k)
+        {
+          if ( packet.IntersectBox(&this->CellBounds[6*k], tol) == 0 )
+          {
+            continue;
+          }
+          vtkIdType cellId = this->CellIds[k];
+          ds->GetCell(cellId, cell);
+          for (int l = 0; l < numLines; ++l)
+          {
+            if ( packet.Hit[l] )
+            {
+              hits[l].Update(cellId, cell, p1 + 3*l, p2 + 3*l, tol);
+              packet.TMax[l] = hits[l].T;
+            }
+          }
+        }
+      }
+      else
+      {
+        bool leftFirst = packet.Inv[node.Axis][0] > 0.0;
+        stack.push_back(node.Index + (leftFirst ? 1 : 0));
+        stack.push_back(node.Index + (leftFirst ? 0 : 1));
+      }
+    }
+  }
+};
+
+namespace
+{
+
+typedef vtkBVHTree::Node BVHNode;
+
+//-----------------------------------------------------------------------------
+// Compute the bounds and the centers of the cells.
+struct ComputeCellBounds
+{
+  vtkDataSet *DataSet;
+  double *Bounds;
+  double *Centers;
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      double *b = this->Bounds + 6*cellId;
+      this->DataSet->GetCellBounds(cellId, b);
+      this->Centers[3*cellId] = 0.5 * (b[0] + b[1]);
+      this->Centers[3*cellId+1] = 0.5 * (b[2] + b[3]);
+      this->Centers[3*cellId+2] = 0.5 * (b[4] + b[5]);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// A bin of cell centers used to evaluate the surface area heuristic.
+struct BVHBin
+{
+  double Bounds[6];
+  vtkIdType Count;
+
+  void Initialize()
+  {
+    InitializeBounds(this->Bounds);
+    this->Count = 0;
+  }
+
+  void Add(const BVHBin &bin)
+  {
+    AddBounds(this->Bounds, bin.Bounds);
+    this->Count += bin.Count;
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Top-down construction of the hierarchy over a range of the cell ids.
+struct BVHBuilder
+{
+  const double *Bounds; // per cell id
+  const double *Centers; // per cell id
+  vtkIdType *Ids; // permuted in the order of the leaves
+  int NumberOfBins;
+  vtkIdType LeafSize;
+
+  // A range of cells to process into a node
+  struct Range
+  {
+    vtkIdType Node;
+    vtkIdType Begin;
+    vtkIdType End;
+    int Depth;
+  };
+
+  // The bin of a center along an axis, given the bounds of the centers
+  int GetBin(vtkIdType id, int axis, const double centerBounds[6]) const
+  {
+    const double scale = this->NumberOfBins /
+      (centerBounds[2*axis+1] - centerBounds[2*axis]);
+    int bin = static_cast<int>(
+      (this->Centers[3*id+axis] - centerBounds[2*axis]) * scale);
+    return std::min(bin, this->NumberOfBins - 1);
+  }
+
+  // Bounds of the cells [begin,end) and of their centers
+  void ComputeBounds(vtkIdType begin, vtkIdType end, double bounds[6],
+                     double centerBounds[6]) const
+  {
+    InitializeBounds(bounds);
+    InitializeBounds(centerBounds);
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      vtkIdType id = this->Ids[i];
+      AddBounds(bounds, this->Bounds + 6*id);
+      const double *c = this->Centers + 3*id;
+      double cb[6] = { c[0], c[0], c[1], c[1], c[2], c[2] };
+      AddBounds(centerBounds, cb);
+    }
+  }
+
+  // Bin the cells [begin,end) along the three axes
+  void ComputeBins(vtkIdType begin, vtkIdType end,
+                   const double centerBounds[6], BVHBin *bins) const
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if ( centerBounds[2*axis+1] <= centerBounds[2*axis] )
+      {
+        continue;
+      }
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        vtkIdType id = this->Ids[i];
+        BVHBin &bin = bins[axis*this->NumberOfBins +
+                           this->GetBin(id, axis, centerBounds)];
+        AddBounds(bin.Bounds, this->Bounds + 6*id);
+        bin.Count++;
+      }
+    }
+  }
+
+  void ComputeBoundsAndBins(vtkIdType begin, vtkIdType end, bool parallel,
+                            double bounds[6], double centerBounds[6],
+                            std::vector<BVHBin> &bins) const;
+
+  // Choose the split of the bins with the smallest surface area heuristic
+  // cost. Returns false if the centers cannot be split.
+  bool FindSplit(const std::vector<BVHBin> &bins,
+                 const double centerBounds[6], int &bestAxis,
+                 int &bestSplit) const
+  {
+    const int numBins = this->NumberOfBins;
+    std::vector<double> rightCost(numBins);
+    double bestCost = VTK_DOUBLE_MAX;
+    bool found = false;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if ( centerBounds[2*axis+1] <= centerBounds[2*axis] )
+      {
+        continue;
+      }
+      const BVHBin *axisBins = &bins[axis*numBins];
+
+      // Cost of the bins right of each split, then sweep from the left
+      BVHBin side;
+      side.Initialize();
+      for (int b = numBins - 1; b > 0; --b)
+      {
+        side.Add(axisBins[b]);
+        rightCost[b] = (side.Count > 0 ? side.Count * HalfArea(side.Bounds) : 0.0);
+      }
+      vtkIdType total = side.Count + axisBins[0].Count;
+      side.Initialize();
+      for (int b = 1; b < numBins; ++b)
+      {
+        side.Add(axisBins[b-1]);
+        if ( side.Count == 0 || side.Count == total )
+        {
+          continue;
+        }
+        double cost = side.Count * HalfArea(side.Bounds) + rightCost[b];
+        if ( cost < bestCost )
+        {
+          bestCost = cost;
+          bestAxis = axis;
+          bestSplit = b;
+          found = true;
+        }
+      }
+    }
+    return found;
+  }
+
+  // Build the subtree of the node root over the cells [begin,end) into
+  // nodes. If tasks is not null, the ranges of at most taskSize cells are
+  // recorded in it instead of being processed. Returns the depth of the
+  // subtree.
+  int Build(std::vector<BVHNode> &nodes, vtkIdType root, vtkIdType begin,
+            vtkIdType end, bool parallel, vtkIdType taskSize,
+            std::vector<Range> *tasks) const
+  {
+    std::vector<BVHBin> bins(3*this->NumberOfBins);
+    std::vector<Range> stack(1, Range{ root, begin, end, 1 });
+    int depth = 0;
+    while ( ! stack.empty() )
+    {
+      Range range = stack.back();
+      stack.pop_back();
+      const vtkIdType count = range.End - range.Begin;
+      depth = std::max(depth, range.Depth);
+      if ( tasks && count <= taskSize )
+      {
+        tasks->push_back(range);
+        continue;
+      }
+
+      double bounds[6], centerBounds[6];
+      this->ComputeBoundsAndBins(range.Begin, range.End,
+                                 parallel && count >= ParallelSize,
+                                 bounds, centerBounds, bins);
+      BVHNode &node = nodes[range.Node];
+      std::copy(bounds, bounds + 6, node.Bounds);
+      node.Axis = 0;
+
+      int axis = 0, split = 0;
+      vtkIdType mid;
+      if ( count <= this->LeafSize )
+      {
+        node.Index = range.Begin;
+        node.Count = count;
+        continue;
+      }
+      else if ( this->FindSplit(bins, centerBounds, axis, split) )
+      {
+        mid = std::partition(this->Ids + range.Begin, this->Ids + range.End,
+          [&](vtkIdType id) {
+            return this->GetBin(id, axis, centerBounds) < split;
+          }) - this->Ids;
+      }
+      else
+      {
+        // All the centers coincide: split the cells in two halves
+        mid = range.Begin + count / 2;
+      }
+
+      vtkIdType child = static_cast<vtkIdType>(nodes.size());
+      node.Index = child;
+      node.Count = 0;
+      node.Axis = axis;
+      nodes.resize(child + 2);
+      stack.push_back(Range{ child + 1, mid, range.End, range.Depth + 1 });
+      stack.push_back(Range{ child, range.Begin, mid, range.Depth + 1 });
+    }
+    return depth;
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Compute in parallel the bounds of a range of cells, of their centers, and
+// their bins.
+struct BinCells
+{
+  const BVHBuilder *Builder;
+  const double *CenterBounds; // null for the bounds pass
+  int NumberOfBins;
+  vtkSMPThreadLocal<std::vector<double>> LocalBounds;
+  vtkSMPThreadLocal<std::vector<BVHBin>> LocalBins;
+  std::vector<double> Bounds;
+  std::vector<BVHBin> Bins;
+
+  void Initialize()
+  {
+    std::vector<double> &bounds = this->LocalBounds.Local();
+    bounds.resize(12);
+    InitializeBounds(bounds.data());
+    InitializeBounds(bounds.data() + 6);
+    std::vector<BVHBin> &bins = this->LocalBins.Local();
+    bins.resize(3*this->NumberOfBins);
+    for (BVHBin &bin : bins)
+    {
+      bin.Initialize();
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    if ( this->CenterBounds )
+    {
+      this->Builder->ComputeBins(begin, end, this->CenterBounds,
+                                 this->LocalBins.Local().data());
+    }
+    else
+    {
+      double *bounds = this->LocalBounds.Local().data();
+      double b[6], cb[6];
+      this->Builder->ComputeBounds(begin, end, b, cb);
+      AddBounds(bounds, b);
+      AddBounds(bounds + 6, cb);
+    }
+  }
+
+  void Reduce()
+  {
+    this->Bounds.resize(12);
+    InitializeBounds(this->Bounds.data());
+    InitializeBounds(this->Bounds.data() + 6);
+    this->Bins.resize(3*this->NumberOfBins);
+    for (BVHBin &bin : this->Bins)
+    {
+      bin.Initialize();
+    }
+    for (const std::vector<double> &bounds : this->LocalBounds)
+    {
+      AddBounds(this->Bounds.data(), bounds.data());
+      AddBounds(this->Bounds.data() + 6, bounds.data() + 6);
+    }
+    for (const std::vector<BVHBin> &bins : this->LocalBins)
+    {
+      for (int i = 0; i < 3*this->NumberOfBins; ++i)
+      {
+        this->Bins[i].Add(bins[i]);
+      }
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+void BVHBuilder::ComputeBoundsAndBins(vtkIdType begin, vtkIdType end,
+                                      bool parallel, double bounds[6],
+                                      double centerBounds[6],
+                                      std::vector<BVHBin> &bins) const
+{
+  if ( ! parallel )
+  {
+    this->ComputeBounds(begin, end, bounds, centerBounds);
+    for (BVHBin &bin : bins)
+    {
+      bin.Initialize();
+    }
+    this->ComputeBins(begin, end, centerBounds, bins.data());
+    return;
+  }
+
+  // The bounds and the bins are minima, maxima and counts, so that they do
+  // not depend on how the cells are distributed over the threads.
+  BinCells boundsPass;
+  boundsPass.Builder = this;
+  boundsPass.CenterBounds = nullptr;
+  boundsPass.NumberOfBins = this->NumberOfBins;
+  vtkSMPTools::For(begin, end, boundsPass);
+  std::copy(boundsPass.Bounds.begin(), boundsPass.Bounds.begin() + 6, bounds);
+  std::copy(boundsPass.Bounds.begin() + 6, boundsPass.Bounds.end(),
+            centerBounds);
+
+  BinCells binPass;
+  binPass.Builder = this;
+  binPass.CenterBounds = centerBounds;
+  binPass.NumberOfBins = this->NumberOfBins;
+  vtkSMPTools::For(begin, end, binPass);
+  bins = binPass.Bins;
+}
+
+//-----------------------------------------------------------------------------
+// Build the subtrees of the top of the hierarchy, each one in its own
+// array of nodes.
+struct BuildSubtrees
+{
+  const BVHBuilder *Builder;
+  const std::vector<BVHBuilder::Range> *Tasks;
+  std::vector<std::vector<BVHNode>> *Nodes;
+  std::vector<int> *Depths;
+
+  void operator()(vtkIdType task, vtkIdType endTask)
+  {
+    for ( ; task < endTask; ++task)
+    {
+      const BVHBuilder::Range &range = (*this->Tasks)[task];
+      std::vector<BVHNode> &nodes = (*this->Nodes)[task];
+      nodes.resize(1);
+      (*this->Depths)[task] = this->Builder->Build(nodes, 0, range.Begin,
+        range.End, false, 0, nullptr);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Gather the bounds of the cells in the order of the leaves.
+struct SortCellBounds
+{
+  const double *Bounds;
+  const vtkIdType *Ids;
+  double *SortedBounds;
+
+  void operator()(vtkIdType i, vtkIdType end)
+  {
+    for ( ; i < end; ++i)
+    {
+      std::copy(this->Bounds + 6*this->Ids[i], this->Bounds + 6*this->Ids[i] + 6,
+                this->SortedBounds + 6*i);
+    }
+  }
+};
+
+//-----------------------------------------------------------------------------
+// Whether the lines go in the same octant of directions. Only such coherent
+// lines, as cast from a camera, are likely to visit the same nodes; the
+// others are better traced one by one.
+bool SameOctant(int numLines, const double *p1, const double *p2)
+{
+  for (int l = 1; l < numLines; ++l)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      if ( (p2[3*l+i] >= p1[3*l+i]) != (p2[i] >= p1[i]) )
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+// Intersect batches of lines with the cells, packet by packet.
+struct IntersectLines
+{
+  const vtkBVHTree *Tree;
+  vtkDataSet *DataSet;
+  vtkIdType NumberOfLines;
+  const double *P1;
+  const double *P2;
+  double Tol;
+  vtkIdType *CellIds;
+  double *T;
+  double *X;
+  double *PCoords;
+  int *SubIds;
+  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Stack;
+
+  void operator()(vtkIdType packet, vtkIdType endPacket)
+  {
+    vtkGenericCell *cell = this->Cell.Local();
+    std::vector<vtkIdType> &stack = this->Stack.Local();
+    LineHit hits[PacketSize];
+    for ( ; packet < endPacket; ++packet)
+    {
+      vtkIdType first = packet * PacketSize;
+      int numLines = static_cast<int>(
+        std::min<vtkIdType>(PacketSize, this->NumberOfLines - first));
+      const double *p1 = this->P1 + 3*first;
+      const double *p2 = this->P2 + 3*first;
+      if ( SameOctant(numLines, p1, p2) )
+      {
+        this->Tree->IntersectWithLines(this->DataSet, numLines, p1, p2,
+                                       this->Tol, cell, hits, stack);
+      }
+      else
+      {
+        for (int l = 0; l < numLines; ++l)
+        {
+          this->Tree->IntersectWithLine(this->DataSet, p1 + 3*l, p2 + 3*l,
+                                        this->Tol, cell, hits[l], stack);
+        }
+      }
+      for (int l = 0; l < numLines; ++l)
+      {
+        vtkIdType i = first + l;
+        this->CellIds[i] = hits[l].CellId;
+        if ( this->T )
+        {
+          this->T[i] = hits[l].T;
+        }
+        if ( this->X )
+        {
+          std::copy(hits[l].X, hits[l].X + 3, this->X + 3*i);
+        }
+        if ( this->PCoords )
+        {
+          std::copy(hits[l].PCoords, hits[l].PCoords + 3, this->PCoords + 3*i);
+        }
+        if ( this->SubIds )
+        {
+          this->SubIds[i] = hits[l].SubId;
+        }
+      }
+    }
+  }
+};
+
+} // anonymous namespace
+
+//-----------------------------------------------------------------------------
+// Here is the VTK class proper.
+vtkBVHCellLocator::vtkBVHCellLocator()
+{
+  this->NumberOfBins = 16;
+  this->NumberOfCellsPerNode = 8;
+  this->CacheCellBounds = 1;
+  this->Tree = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+vtkBVHCellLocator::~vtkBVHCellLocator()
+{
+  this->FreeSearchStructure();
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::FreeSearchStructure()
+{
+  delete this->Tree;
+  this->Tree = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::GetNumberOfNodes()
+{
+  return this->Tree ? static_cast<vtkIdType>(this->Tree->Nodes.size()) : 0;
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocator()
+{
+  vtkDebugMacro( << "Building BVH cell locator" );
+
+  // Do we need to build?
+  if ( (this->Tree != nullptr) && (this->BuildTime > this->MTime)
+       && (this->BuildTime > this->DataSet->GetMTime()) )
+  {
+    return;
+  }
+
+  vtkIdType numCells;
+  if ( !this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1 )
+  {
+    vtkErrorMacro( << "No cells to build");
+    return;
+  }
+
+  if ( this->Tree )
+  {
+    this->FreeSearchStructure();
+  }
+
+  // Compute the cell bounds in parallel. The first call is serial to
+  // build the cell structures of the dataset that GetCellBounds() uses.
+  std::vector<double> bounds(6*numCells);
+  std::vector<double> centers(3*numCells);
+  ComputeCellBounds cellBounds = { this->DataSet, bounds.data(),
+                                   centers.data() };
+  cellBounds(0, 1);
+  vtkSMPTools::For(1, numCells, cellBounds);
+
+  vtkBVHTree *tree = new vtkBVHTree;
+  tree->MaxCellSize = std::max(this->DataSet->GetMaxCellSize(), 1);
+  tree->CellIds.resize(numCells);
+  for (vtkIdType i = 0; i < numCells; ++i)
+  {
+    tree->CellIds[i] = i;
+  }
+
+  BVHBuilder builder;
+  builder.Bounds = bounds.data();
+  builder.Centers = centers.data();
+  builder.Ids = tree->CellIds.data();
+  builder.NumberOfBins = this->NumberOfBins;
+  builder.LeafSize = this->NumberOfCellsPerNode;
+
+  // The top of the hierarchy is split, binning the large nodes in
+  // parallel, until the subtrees are small enough to be built in parallel,
+  // each one by a single thread. The subtrees are then appended to the top
+  // of the hierarchy in order, so the result does not depend on the number
+  // of threads.
+  std::vector<BVHNode> &nodes = tree->Nodes;
+  nodes.reserve(2 * (numCells / std::max<vtkIdType>(builder.LeafSize/2, 1)) + 1);
+  nodes.resize(1);
+  std::vector<BVHBuilder::Range> tasks;
+  const bool parallel = numCells >= ParallelSize;
+  const vtkIdType taskSize = std::max<vtkIdType>(numCells / 256, builder.LeafSize);
+  tree->Depth = builder.Build(nodes, 0, 0, numCells, parallel, taskSize,
+                              parallel ? &tasks : nullptr);
+
+  if ( ! tasks.empty() )
+  {
+    std::vector<std::vector<BVHNode>> subtrees(tasks.size());
+    std::vector<int> depths(tasks.size());
+    BuildSubtrees buildSubtrees = { &builder, &tasks, &subtrees, &depths };
+    vtkSMPTools::For(0, static_cast<vtkIdType>(tasks.size()), 1, buildSubtrees);
+
+    // The root of each subtree replaces its node in the top of the
+    // hierarchy, the other nodes are appended, their children renumbered.
+    for (size_t task = 0; task < tasks.size(); ++task)
+    {
+      const std::vector<BVHNode> &subtree = subtrees[task];
+      const vtkIdType offset = static_cast<vtkIdType>(nodes.size()) - 1;
+      for (size_t i = 0; i < subtree.size(); ++i)
+      {
+        BVHNode node = subtree[i];
+        if ( node.Count == 0 )
+        {
+          node.Index += offset;
+        }
+        if ( i == 0 )
+        {
+          nodes[tasks[task].Node] = node;
+        }
+        else
+        {
+          nodes.push_back(node);
+        }
+      }
+      tree->Depth = std::max(tree->Depth, tasks[task].Depth - 1 + depths[task]);
+    }
+  }
+
+  tree->CellBounds.resize(6*numCells);
+  SortCellBounds sortBounds = { bounds.data(), tree->CellIds.data(),
+                                tree->CellBounds.data() };
+  vtkSMPTools::For(0, numCells, sortBounds);
+
+  this->Tree = tree;
+  this->Level = tree->Depth;
+  this->BuildTime.Modified();
+}
+
+//-----------------------------------------------------------------------------
+int vtkBVHCellLocator::
+IntersectWithLine(const double p1[3], const double p2[3], double tol,
+                  double &t, double x[3], double pcoords[3],
+                  int &subId, vtkIdType &cellId, vtkGenericCell *cell)
+{
+  cellId = -1;
+  subId = 0;
+  this->BuildLocator();
+  if ( ! this->Tree )
+  {
+    return 0;
+  }
+
+  LineHit hit;
+  std::vector<vtkIdType> stack;
+  this->Tree->IntersectWithLine(this->DataSet, p1, p2, tol, cell, hit, stack);
+  if ( hit.CellId < 0 )
+  {
+    return 0;
+  }
+
+  this->DataSet->GetCell(hit.CellId, cell);
+  cellId = hit.CellId;
+  t = hit.T;
+  x[0] = hit.X[0];
+  x[1] = hit.X[1];
+  x[2] = hit.X[2];
+  pcoords[0] = hit.PCoords[0];
+  pcoords[1] = hit.PCoords[1];
+  pcoords[2] = hit.PCoords[2];
+  subId = hit.SubId;
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::
+IntersectWithLines(vtkIdType numLines, const double *p1, const double *p2,
+                   double tol, vtkIdType *cellIds, double *t, double *x,
+                   double *pcoords, int *subIds)
+{
+  this->BuildLocator();
+  if ( ! this->Tree )
+  {
+    std::fill(cellIds, cellIds + numLines, -1);
+    return;
+  }
+
+  // Warm up the cell structures of the dataset before the threads use them
+  this->DataSet->GetCell(0, this->GenericCell);
+
+  IntersectLines intersect;
+  intersect.Tree = this->Tree;
+  intersect.DataSet = this->DataSet;
+  intersect.NumberOfLines = numLines;
+  intersect.P1 = p1;
+  intersect.P2 = p2;
+  intersect.Tol = tol;
+  intersect.CellIds = cellIds;
+  intersect.T = t;
+  intersect.X = x;
+  intersect.PCoords = pcoords;
+  intersect.SubIds = subIds;
+  vtkSMPTools::For(0, (numLines + PacketSize - 1) / PacketSize, intersect);
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::
+FindClosestPoint(const double x[3], double closestPoint[3],
+                 vtkGenericCell *cell, vtkIdType &cellId, int &subId,
+                 double& dist2)
+{
+  int inside;
+  double point[3] = { x[0], x[1], x[2] };
+  this->FindClosestPointWithinRadius(point, VTK_DOUBLE_MAX, closestPoint,
+                                     cell, cellId, subId, dist2, inside);
+}
+
+//-----------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::
+FindClosestPointWithinRadius(double x[3], double radius,
+                             double closestPoint[3], vtkGenericCell *cell,
+                             vtkIdType &cellId, int &subId, double& dist2,
+                             int &inside)
+{
+  cellId = -1;
+  subId = 0;
+  inside = 0;
+  this->BuildLocator();
+  if ( ! this->Tree )
+  {
+    return 0;
+  }
+
+  const vtkBVHTree *tree = this->Tree;
+  std::vector<double> weights(tree->MaxCellSize);
+  double bestDist2 = (radius < VTK_FLOAT_MAX ? radius*radius : VTK_DOUBLE_MAX);
+  double point[3], pcoords[3], d2;
+  int sub;
+  std::vector<vtkIdType> stack(1, 0);
+  while ( ! stack.empty() )
+  {
+    const BVHNode &node = tree->Nodes[stack.back()];
+    stack.pop_back();
+    if ( Distance2ToBounds(node.Bounds, x) > bestDist2 )
+    {
+      continue;
+    }
+    if ( node.Count > 0 )
+    {
+      for (vtkIdType k = node.Index; k < node.Index + node.Count; ++k)
+      {
+        vtkIdType id = tree->CellIds[k];
+        if ( Distance2ToBounds(&tree->CellBounds[6*k], x) > bestDist2 )
+        {
+          continue;
+        }
+        this->DataSet->GetCell(id, cell);
+        int status = cell->EvaluatePosition(x, point, sub, pcoords, d2,
+                                            weights.data());
+        if ( status != -1 && (d2 < bestDist2 ||
+             (d2 == bestDist2 && (cellId < 0 || id < cellId))) )
+        {
+          bestDist2 = d2;
+          cellId = id;
+          subId = sub;
+          inside = status;
+          closestPoint[0] = point[0];
+          closestPoint[1] = point[1];
+          closestPoint[2] = point[2];
+        }
+      }
+    }
+    else
+    {
+      // Visit first the closest child
+      const BVHNode *children = &tree->Nodes[node.Index];
+      bool leftFirst = Distance2ToBounds(children[0].Bounds, x) <=
+        Distance2ToBounds(children[1].Bounds, x);
+      stack.push_back(node.Index + (leftFirst ? 1 : 0));
+      stack.push_back(node.Index + (leftFirst ? 0 : 1));
+    }
+  }
+
+  if ( cellId < 0 )
+  {
+    return 0;
+  }
+  this->DataSet->GetCell(cellId, cell);
+  dist2 = bestDist2;
+  return 1;
+}
+
+//-----------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::
+FindCell(double pos[3], double, vtkGenericCell *cell,
+         double pcoords[3], double* weights)
+{
+  this->BuildLocator();
+  if ( ! this->Tree )
+  {
+    return -1;
+  }
+
+  const vtkBVHTree *tree = this->Tree;
+  double dist2;
+  int subId;
+  std::vector<vtkIdType> stack(1, 0);
+  while ( ! stack.empty() )
+  {
+    const BVHNode &node = tree->Nodes[stack.back()];
+    stack.pop_back();
+    if ( ! InBounds(node.Bounds, pos) )
+    {
+      continue;
+    }
+    if ( node.Count > 0 )
+    {
+      for (vtkIdType k = node.Index; k < node.Index + node.Count; ++k)
+      {
+        if ( InBounds(&tree->CellBounds[6*k], pos) )
+        {
+          this->DataSet->GetCell(tree->CellIds[k], cell);
+          if ( cell->EvaluatePosition(pos, nullptr, subId, pcoords, dist2,
+                                      weights) == 1 )
+          {
+            return tree->CellIds[k];
+          }
+        }
+      }
+    }
+    else
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+    }
+  }
+  return -1;
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::FindCellsWithinBounds(double *bbox, vtkIdList *cells)
+{
+  cells->Reset();
+  this->BuildLocator();
+  if ( ! this->Tree )
+  {
+    return;
+  }
+
+  const vtkBVHTree *tree = this->Tree;
+  std::vector<vtkIdType> stack(1, 0);
+  while ( ! stack.empty() )
+  {
+    const BVHNode &node = tree->Nodes[stack.back()];
+    stack.pop_back();
+    if ( ! BoundsIntersect(node.Bounds, bbox) )
+    {
+      continue;
+    }
+    if ( node.Count > 0 )
+    {
+      for (vtkIdType k = node.Index; k < node.Index + node.Count; ++k)
+      {
+        if ( BoundsIntersect(&tree->CellBounds[6*k], bbox) )
+        {
+          cells->InsertNextId(tree->CellIds[k]);
+        }
+      }
+    }
+    else
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::
+FindCellsAlongLine(const double p1[3], const double p2[3], double tolerance,
+                   vtkIdList *cells)
+{
+  cells->Reset();
+  this->BuildLocator();
+  if ( ! this->Tree )
+  {
+    return;
+  }
+
+  const vtkBVHTree *tree = this->Tree;
+  double inv[3];
+  InverseDirection(p1, p2, inv);
+  std::vector<vtkIdType> stack(1, 0);
+  while ( ! stack.empty() )
+  {
+    const BVHNode &node = tree->Nodes[stack.back()];
+    stack.pop_back();
+    if ( ! IntersectBox(node.Bounds, p1, inv, tolerance, 1.0) )
+    {
+      continue;
+    }
+    if ( node.Count > 0 )
+    {
+      for (vtkIdType k = node.Index; k < node.Index + node.Count; ++k)
+      {
+        if ( IntersectBox(&tree->CellBounds[6*k], p1, inv, tolerance, 1.0) )
+        {
+          cells->InsertNextId(tree->CellIds[k]);
+        }
+      }
+    }
+    else
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::GenerateRepresentation(int level, vtkPolyData *pd)
+{
+  this->BuildLocator();
+  if ( ! this->Tree )
+  {
+    return;
+  }
+
+  vtkPoints *pts = vtkPoints::New();
+  vtkCellArray *polys = vtkCellArray::New();
+
+  // The boxes of the nodes at the given level, or of the leaves above it
+  static const int faces[6][4] = { {0,2,6,4}, {1,5,7,3}, {0,4,5,1},
+                                   {2,3,7,6}, {0,1,3,2}, {4,6,7,5} };
+  std::vector<std::pair<vtkIdType,int>> stack(1, std::make_pair(0, 0));
+  while ( ! stack.empty() )
+  {
+    const BVHNode &node = this->Tree->Nodes[stack.back().first];
+    int depth = stack.back().second;
+    stack.pop_back();
+    if ( node.Count == 0 && depth < level )
+    {
+      stack.push_back(std::make_pair(node.Index + 1, depth + 1));
+      stack.push_back(std::make_pair(node.Index, depth + 1));
+      continue;
+    }
+
+    const double *b = node.Bounds;
+    vtkIdType ids[8];
+    for (int i = 0; i < 8; ++i)
+    {
+      ids[i] = pts->InsertNextPoint(b[i & 1], b[2 + ((i >> 1) & 1)],
+                                    b[4 + ((i >> 2) & 1)]);
+    }
+    for (int f = 0; f < 6; ++f)
+    {
+      vtkIdType quad[4] = { ids[faces[f][0]], ids[faces[f][1]],
+                            ids[faces[f][2]], ids[faces[f][3]] };
+      polys->InsertNextCell(4, quad);
+    }
+  }
+
+  pd->SetPoints(pts);
+  pd->SetPolys(polys);
+  pts->Delete();
+  polys->Delete();
+}
+
+//-----------------------------------------------------------------------------
+void vtkBVHCellLocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os,indent);
+
+  os << indent << "Number of Bins: " << this->NumberOfBins << "\n";
+  os << indent << "Number of Nodes: " << this->GetNumberOfNodes() << "\n";
+}
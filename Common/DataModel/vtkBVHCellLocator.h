@@ -0,0 +1,195 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkBVHCellLocator.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkBVHCellLocator
+ * @brief   cell locator based on a bounding volume hierarchy
+ *
+ * vtkBVHCellLocator is a type of vtkAbstractCellLocator that organizes the
+ * bounding boxes of the cells in a binary bounding volume hierarchy (BVH).
+ * It is intended for ray casting against large meshes: intersecting lines
+ * with the cells, finding the closest point on the cells, and finding the
+ * cell containing a point.
+ *
+ * The hierarchy is built top-down with the surface area heuristic (SAH),
+ * evaluated over NumberOfBins bins of the cell centers along each axis. The
+ * bounds of the cells and the binning of large nodes are computed in
+ * parallel (via vtkSMPTools), and once the top of the hierarchy has been
+ * split in enough subtrees, the subtrees are built in parallel. The nodes
+ * are stored in a single flat array, and the bounds of the cells in the
+ * order of the leaves, so that the traversals access contiguous memory. The
+ * hierarchy does not depend on the number of threads.
+ *
+ * IntersectWithLines() intersects a batch of lines with the cells: the
+ * lines are processed in parallel, in packets of consecutive lines which
+ * traverse the hierarchy together, testing the boxes of the nodes against
+ * all the lines of the packet in one loop. Each line gets the same cell as
+ * IntersectWithLine() returns for it: the intersection closest to the
+ * start of the line, and on ties the cell with the smallest id.
+ *
+ * All the queries are thread safe once the locator has been built.
+ *
+ * @warning
+ * This class *always* caches cell bounds.
+ *
+ * @sa
+ * vtkLocator vtkAbstractCellLocator vtkStaticCellLocator vtkCellLocator
+ * vtkCellTreeLocator vtkModifiedBSPTree vtkOBBTree
+ */
+
+#ifndef vtkBVHCellLocator_h
+#define vtkBVHCellLocator_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkAbstractCellLocator.h"
+
+// Forward declaration for PIMPL
+struct vtkBVHTree;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkBVHCellLocator : public vtkAbstractCellLocator
+{
+public:
+  //@{
+  /**
+   * Standard methods to instantiate, print and obtain type-related information.
+   */
+  static vtkBVHCellLocator *New();
+  vtkTypeMacro(vtkBVHCellLocator,vtkAbstractCellLocator);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  //@}
+
+  //@{
+  /**
+   * Set the number of bins along each axis over which the surface area
+   * heuristic is evaluated when a node is split. More bins give a better
+   * hierarchy but a slower build. Default 16.
+   */
+  vtkSetClampMacro(NumberOfBins,int,2,256);
+  vtkGetMacro(NumberOfBins,int);
+  //@}
+
+  using vtkAbstractCellLocator::IntersectWithLine;
+  using vtkAbstractCellLocator::FindClosestPoint;
+  using vtkAbstractCellLocator::FindClosestPointWithinRadius;
+
+  /**
+   * Return the intersection closest to p1 (if any) of the finite line
+   * (p1,p2) with the cells, and the cell which was intersected. The cell is
+   * returned as a cell id and as a generic cell. On ties, the cell with the
+   * smallest id is returned.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol,
+                        double& t, double x[3], double pcoords[3],
+                        int &subId, vtkIdType &cellId,
+                        vtkGenericCell *cell) override;
+
+  /**
+   * Batched version of IntersectWithLine(): intersect the numLines lines
+   * (p1[i],p2[i]), given as x-y-z triples, with the cells. The id of the
+   * intersected cell (or -1) of each line is stored in cellIds; if not null,
+   * t, x, pcoords and subIds receive the parametric coordinate along the
+   * line, the intersection point, the parametric coordinates in the cell and
+   * the sub-id of the intersections. All the arrays are allocated by the
+   * caller. The lines are processed in parallel.
+   */
+  void IntersectWithLines(vtkIdType numLines, const double *p1,
+                          const double *p2, double tol, vtkIdType *cellIds,
+                          double *t = nullptr, double *x = nullptr,
+                          double *pcoords = nullptr, int *subIds = nullptr);
+
+  /**
+   * Return the closest point and the cell which is closest to the point x.
+   * The closest point is somewhere on a cell, it need not be one of the
+   * vertices of the cell. If a cell is found, "cell" contains the points and
+   * ptIds for the cell "cellId" upon exit.
+   */
+  void FindClosestPoint(const double x[3], double closestPoint[3],
+                        vtkGenericCell *cell, vtkIdType &cellId,
+                        int &subId, double& dist2) override;
+
+  /**
+   * Return the closest point within a specified radius and the cell which is
+   * closest to the point x. This method returns 1 if a point is found within
+   * the specified radius, and 0 otherwise. See vtkAbstractCellLocator for
+   * the description of the parameters.
+   */
+  vtkIdType FindClosestPointWithinRadius(double x[3], double radius,
+                                         double closestPoint[3],
+                                         vtkGenericCell *cell,
+                                         vtkIdType &cellId, int &subId,
+                                         double& dist2, int &inside) override;
+
+  /**
+   * Test a point to find if it is inside a cell. Returns the cellId if inside
+   * or -1 if not.
+   */
+  vtkIdType FindCell(double pos[3], double vtkNotUsed, vtkGenericCell *cell,
+                     double pcoords[3], double* weights) override;
+
+  /**
+   * Reimplemented from vtkAbstractCellLocator to support bad compilers.
+   */
+  vtkIdType FindCell(double x[3]) override
+    { return this->Superclass::FindCell(x); }
+
+  /**
+   * Return a list of unique cell ids whose bounds intersect the given
+   * bounding box. The user must provide the vtkIdList to populate.
+   */
+  void FindCellsWithinBounds(double *bbox, vtkIdList *cells) override;
+
+  /**
+   * Given a finite line defined by the two points (p1,p2), return the list
+   * of unique cell ids whose bounds, enlarged by the tolerance, intersect
+   * the line. The user must provide the vtkIdList to populate.
+   */
+  void FindCellsAlongLine(const double p1[3], const double p2[3],
+                          double tolerance, vtkIdList *cells) override;
+
+  //@{
+  /**
+   * Satisfy vtkLocator abstract interface. GenerateRepresentation() creates
+   * the boxes of the nodes at the given level of the hierarchy (or of the
+   * leaves above it).
+   */
+  void GenerateRepresentation(int level, vtkPolyData *pd) override;
+  void FreeSearchStructure() override;
+  void BuildLocator() override;
+  //@}
+
+  /**
+   * The queries are thread safe once the locator is built, so the batched
+   * FindCells() processes the points in parallel.
+   */
+  bool HasThreadSafeQueries() override { return true; }
+
+  /**
+   * Return the number of nodes of the hierarchy. This has meaning only
+   * after the locator has been built.
+   */
+  vtkIdType GetNumberOfNodes();
+
+protected:
+  vtkBVHCellLocator();
+  ~vtkBVHCellLocator() override;
+
+  int NumberOfBins;
+  vtkBVHTree *Tree; // The hierarchy (PIMPL)
+
+private:
+  vtkBVHCellLocator(const vtkBVHCellLocator&) = delete;
+  void operator=(const vtkBVHCellLocator&) = delete;
+};
+
+#endif
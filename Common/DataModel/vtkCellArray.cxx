@@ -13,116 +13,1138 @@
 
 =========================================================================*/
 #include "vtkCellArray.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkDataArrayRange.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <limits>
 
 vtkStandardNewMacro(vtkCellArray);
 
+namespace
+{
+
+//----------------------------------------------------------------------------
+// Helpers operating on the typed storage.
+
+template <typename ArrayT>
+vtkSmartPointer<ArrayT> NewEmptyOffsets()
+{
+  vtkSmartPointer<ArrayT> offsets = vtkSmartPointer<ArrayT>::New();
+  offsets->InsertNextValue(0);
+  return offsets;
+}
+
+template <typename ArrayT>
+void ResetState(vtkCellArray::VisitState<ArrayT>& state)
+{
+  state.Offsets = NewEmptyOffsets<ArrayT>();
+  state.Connectivity = vtkSmartPointer<ArrayT>::New();
+}
+
+// Copy the content of one state into another one (possibly of a different
+// width).
+template <typename SrcArrayT, typename DstArrayT>
+void CopyState(vtkCellArray::VisitState<SrcArrayT>& src,
+               vtkCellArray::VisitState<DstArrayT>& dst)
+{
+  typedef typename DstArrayT::ValueType DstValueType;
+  dst.Offsets = vtkSmartPointer<DstArrayT>::New();
+  dst.Connectivity = vtkSmartPointer<DstArrayT>::New();
+
+  const vtkIdType numOffsets = src.Offsets->GetNumberOfValues();
+  const vtkIdType numConn = src.Connectivity->GetNumberOfValues();
+  dst.Offsets->SetNumberOfValues(numOffsets);
+  dst.Connectivity->SetNumberOfValues(numConn);
+
+  const auto srcOffsets = src.Offsets->GetPointer(0);
+  const auto srcConn = src.Connectivity->GetPointer(0);
+  DstValueType *dstOffsets = dst.Offsets->GetPointer(0);
+  DstValueType *dstConn = dst.Connectivity->GetPointer(0);
+  for (vtkIdType i = 0; i < numOffsets; ++i)
+  {
+    dstOffsets[i] = static_cast<DstValueType>(srcOffsets[i]);
+  }
+  for (vtkIdType i = 0; i < numConn; ++i)
+  {
+    dstConn[i] = static_cast<DstValueType>(srcConn[i]);
+  }
+}
+
+struct CanConvertTo32BitImpl
+{
+  template <typename CellStateT>
+  bool operator()(CellStateT& state)
+  {
+    typedef typename CellStateT::ValueType ValueType;
+    const vtkIdType max32 =
+      static_cast<vtkIdType>(std::numeric_limits<vtkTypeInt32>::max());
+    if (sizeof(ValueType) <= 4 ||
+        state.GetNumberOfConnectivityIds() == 0)
+    {
+      return true;
+    }
+    if (state.GetNumberOfConnectivityIds() > max32)
+    {
+      return false;
+    }
+    const ValueType *conn = state.GetConnectivity()->GetPointer(0);
+    const vtkIdType numConn = state.GetNumberOfConnectivityIds();
+    for (vtkIdType i = 0; i < numConn; ++i)
+    {
+      if (conn[i] > max32 || conn[i] < 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+// The cell sizes are independent of each other, so the maximum is computed
+// in parallel (this is used to size scratch space in many filters).
+template <typename CellStateT>
+struct MaxCellSizeWorker
+{
+  CellStateT& State;
+  vtkSMPThreadLocal<vtkIdType> LocalMaxSize;
+  vtkIdType MaxSize;
+
+  MaxCellSizeWorker(CellStateT& state) : State(state), MaxSize(0) {}
+
+  void Initialize()
+  {
+    this->LocalMaxSize.Local() = 0;
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdType& localMaxSize = this->LocalMaxSize.Local();
+    for ( ; cellId < endCellId; ++cellId )
+    {
+      localMaxSize = std::max(localMaxSize, this->State.GetCellSize(cellId));
+    }
+  }
+
+  void Reduce()
+  {
+    for (auto iter = this->LocalMaxSize.begin();
+         iter != this->LocalMaxSize.end(); ++iter)
+    {
+      this->MaxSize = std::max(this->MaxSize, *iter);
+    }
+  }
+};
+
+struct GetMaxPointIdImpl
+{
+  template <typename CellStateT>
+  vtkIdType operator()(CellStateT& state)
+  {
+    typedef typename CellStateT::ValueType ValueType;
+    const vtkIdType numConn = state.GetNumberOfConnectivityIds();
+    if (numConn == 0)
+    {
+      return -1;
+    }
+    const ValueType *conn = state.GetConnectivity()->GetPointer(0);
+    return static_cast<vtkIdType>(*std::max_element(conn, conn + numConn));
+  }
+};
+
+struct GetMaxCellSizeImpl
+{
+  template <typename CellStateT>
+  int operator()(CellStateT& state)
+  {
+    MaxCellSizeWorker<CellStateT> worker(state);
+    vtkSMPTools::For(0, state.GetNumberOfCells(), 10000, worker);
+    return static_cast<int>(worker.MaxSize);
+  }
+};
+
+struct ReplaceCellAtIdImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType cellId, vtkIdType npts,
+                  const vtkIdType pts[])
+  {
+    typedef typename CellStateT::ValueType ValueType;
+    ValueType *cell = state.GetCellPoints(cellId);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      cell[i] = static_cast<ValueType>(pts[i]);
+    }
+  }
+};
+
+struct ReverseCellAtIdImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType cellId)
+  {
+    auto cell = state.GetCellPoints(cellId);
+    std::reverse(cell, cell + state.GetCellSize(cellId));
+  }
+};
+
+struct IsValidImpl
+{
+  template <typename CellStateT>
+  bool operator()(CellStateT& state)
+  {
+    const vtkIdType numOffsets = state.GetOffsets()->GetNumberOfValues();
+    if (numOffsets < 1 || state.GetBeginOffset(0) != 0)
+    {
+      return false;
+    }
+    for (vtkIdType i = 1; i < numOffsets; ++i)
+    {
+      if (state.GetBeginOffset(i) < state.GetBeginOffset(i-1))
+      {
+        return false;
+      }
+    }
+    return state.GetBeginOffset(numOffsets - 1) ==
+      state.GetNumberOfConnectivityIds();
+  }
+};
+
+// Binary search of the cell whose legacy location (offset + cellId) is loc.
+// Returns the number of cells if loc is at (or past) the end of the legacy
+// layout.
+struct LegacyLocationToCellIdImpl
+{
+  template <typename CellStateT>
+  vtkIdType operator()(CellStateT& state, vtkIdType loc)
+  {
+    vtkIdType low = 0;
+    vtkIdType high = state.GetNumberOfCells();
+    while (low < high)
+    {
+      const vtkIdType mid = low + (high - low) / 2;
+      if (state.GetBeginOffset(mid) + mid < loc)
+      {
+        low = mid + 1;
+      }
+      else
+      {
+        high = mid;
+      }
+    }
+    return low;
+  }
+};
+
+struct ExportLegacyFormatImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdTypeArray *data)
+  {
+    const vtkIdType numCells = state.GetNumberOfCells();
+    data->SetNumberOfValues(numCells + state.GetNumberOfConnectivityIds());
+    vtkIdType *out = data->GetPointer(0);
+    const auto conn = state.GetConnectivity()->GetPointer(0);
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      const vtkIdType begin = state.GetBeginOffset(cellId);
+      const vtkIdType end = state.GetEndOffset(cellId);
+      *out++ = end - begin;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        *out++ = static_cast<vtkIdType>(conn[i]);
+      }
+    }
+  }
+};
+
+// Check whether legacy data describes exactly the cells in the storage.
+struct MatchesLegacyFormatImpl
+{
+  template <typename CellStateT>
+  bool operator()(CellStateT& state, const vtkIdType *data, vtkIdType len,
+                  vtkIdType numCells)
+  {
+    if (numCells != state.GetNumberOfCells() ||
+        len != numCells + state.GetNumberOfConnectivityIds())
+    {
+      return false;
+    }
+    const auto conn = state.GetConnectivity()->GetPointer(0);
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      const vtkIdType begin = state.GetBeginOffset(cellId);
+      const vtkIdType end = state.GetEndOffset(cellId);
+      if (*data++ != end - begin)
+      {
+        return false;
+      }
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        if (*data++ != static_cast<vtkIdType>(conn[i]))
+        {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+// Append legacy data. The data has been validated (see ScanLegacyFormat()),
+// so that it contains exactly numCells cells and numConn point ids.
+struct AppendLegacyFormatImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, const vtkIdType *data, vtkIdType numCells,
+                  vtkIdType numConn, vtkIdType ptOffset)
+  {
+    typedef typename CellStateT::ValueType ValueType;
+    const vtkIdType cellBegin = state.GetNumberOfCells();
+    const vtkIdType connBegin = state.GetNumberOfConnectivityIds();
+    state.GetOffsets()->SetNumberOfValues(cellBegin + numCells + 1);
+    state.GetConnectivity()->SetNumberOfValues(connBegin + numConn);
+    ValueType *offsets = state.GetOffsets()->GetPointer(cellBegin + 1);
+    ValueType *conn = state.GetConnectivity()->GetPointer(connBegin);
+    vtkIdType offset = connBegin;
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      const vtkIdType npts = *data++;
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        *conn++ = static_cast<ValueType>(*data++ + ptOffset);
+      }
+      offset += npts;
+      *offsets++ = static_cast<ValueType>(offset);
+    }
+  }
+};
+
+struct AppendImpl
+{
+  // Append the cells of a source state to a destination state.
+  template <typename SrcStateT, typename DstStateT>
+  void Append(SrcStateT& src, DstStateT& dst, vtkIdType ptOffset)
+  {
+    typedef typename DstStateT::ValueType ValueType;
+    const vtkIdType numCells = src.GetNumberOfCells();
+    const vtkIdType numConn = src.GetNumberOfConnectivityIds();
+    const vtkIdType cellBegin = dst.GetNumberOfCells();
+    const vtkIdType connBegin = dst.GetNumberOfConnectivityIds();
+    dst.GetOffsets()->SetNumberOfValues(cellBegin + numCells + 1);
+    dst.GetConnectivity()->SetNumberOfValues(connBegin + numConn);
+
+    const auto srcOffsets = src.GetOffsets()->GetPointer(0);
+    const auto srcConn = src.GetConnectivity()->GetPointer(0);
+    ValueType *offsets = dst.GetOffsets()->GetPointer(cellBegin);
+    ValueType *conn = dst.GetConnectivity()->GetPointer(connBegin);
+    for (vtkIdType i = 1; i <= numCells; ++i)
+    {
+      offsets[i] = static_cast<ValueType>(srcOffsets[i] + connBegin);
+    }
+    for (vtkIdType i = 0; i < numConn; ++i)
+    {
+      conn[i] = static_cast<ValueType>(srcConn[i] + ptOffset);
+    }
+  }
+
+  template <typename SrcStateT>
+  void operator()(SrcStateT& src, vtkCellArray* dst, vtkIdType ptOffset)
+  {
+    if (dst->IsStorage64Bit())
+    {
+      vtkCellArray::VisitState<vtkCellArray::ArrayType64> dstState;
+      dstState.Offsets = dst->GetOffsetsArray64();
+      dstState.Connectivity = dst->GetConnectivityArray64();
+      this->Append(src, dstState, ptOffset);
+    }
+    else
+    {
+      vtkCellArray::VisitState<vtkCellArray::ArrayType32> dstState;
+      dstState.Offsets = dst->GetOffsetsArray32();
+      dstState.Connectivity = dst->GetConnectivityArray32();
+      this->Append(src, dstState, ptOffset);
+    }
+  }
+};
+
+// Count the cells and point ids contained in legacy data. At most maxCells
+// cells are considered (if maxCells >= 0). Returns false if the data is
+// truncated or malformed.
+bool ScanLegacyFormat(const vtkIdType *data, vtkIdType len, vtkIdType maxCells,
+                      vtkIdType ptOffset, vtkIdType& numCells,
+                      vtkIdType& numConn, vtkIdType& maxId)
+{
+  numCells = 0;
+  numConn = 0;
+  maxId = -1;
+  vtkIdType loc = 0;
+  while (loc < len && (maxCells < 0 || numCells < maxCells))
+  {
+    const vtkIdType npts = data[loc++];
+    if (npts < 0 || loc + npts > len)
+    {
+      return false;
+    }
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      maxId = std::max(maxId, data[loc++] + ptOffset);
+    }
+    numConn += npts;
+    ++numCells;
+  }
+  return maxCells < 0 || numCells == maxCells;
+}
+
+// Convert an arbitrary integral array into a storage array.
+template <typename DstArrayT>
+struct CopyToStorageWorker
+{
+  vtkSmartPointer<DstArrayT> Result;
+
+  template <typename SrcArrayT>
+  void operator()(SrcArrayT *src)
+  {
+    typedef typename DstArrayT::ValueType ValueType;
+    this->Result = vtkSmartPointer<DstArrayT>::New();
+    this->Result->SetNumberOfValues(src->GetNumberOfValues());
+    const auto range = vtk::DataArrayValueRange<1>(src);
+    ValueType *out = this->Result->GetPointer(0);
+    for (const auto value : range)
+    {
+      *out++ = static_cast<ValueType>(value);
+    }
+  }
+};
+
+template <typename DstArrayT>
+vtkSmartPointer<DstArrayT> CopyToStorage(vtkDataArray *src)
+{
+  CopyToStorageWorker<DstArrayT> worker;
+  typedef vtkArrayDispatch::Integrals Integrals;
+  if (!vtkArrayDispatch::DispatchByValueType<Integrals>::Execute(src, worker))
+  {
+    worker(src);
+  }
+  return worker.Result;
+}
+
+} // end anon namespace
+
 //----------------------------------------------------------------------------
 vtkCellArray::vtkCellArray()
 {
-  this->Ia = vtkIdTypeArray::New();
-  this->NumberOfCells = 0;
-  this->InsertLocation = 0;
-  this->TraversalLocation = 0;
+  this->Storage64Bit = (sizeof(vtkIdType) == 8);
+  this->TraversalCellId = 0;
+  this->TempCell = vtkIdList::New();
+  this->LegacyState = LEGACY_NONE;
+  this->LegacyNumberOfCells = 0;
+  this->LegacyDataIsExternal = false;
+  this->LegacyData = nullptr;
 }
 
 //----------------------------------------------------------------------------
-void vtkCellArray::DeepCopy (vtkCellArray *ca)
+vtkCellArray::~vtkCellArray()
 {
-  // Do nothing on a nullptr input.
-  if (ca == nullptr)
+  this->TempCell->Delete();
+  if (this->LegacyData)
   {
-    return;
+    this->LegacyData->Delete();
   }
+}
 
-  this->Ia->DeepCopy(ca->Ia);
-  this->NumberOfCells = ca->NumberOfCells;
-  this->InsertLocation = ca->InsertLocation;
-  this->TraversalLocation = ca->TraversalLocation;
+//----------------------------------------------------------------------------
+bool vtkCellArray::AllocateExact(vtkIdType numCells,
+                                 vtkIdType connectivitySize)
+{
+  this->Reset();
+  bool ok;
+  if (this->Storage64Bit)
+  {
+    ok = this->Storage64.Offsets->Allocate(numCells + 1) != 0 &&
+      this->Storage64.Connectivity->Allocate(connectivitySize) != 0;
+    this->Storage64.Offsets->InsertNextValue(0);
+  }
+  else
+  {
+    ok = this->Storage32.Offsets->Allocate(numCells + 1) != 0 &&
+      this->Storage32.Connectivity->Allocate(connectivitySize) != 0;
+    this->Storage32.Offsets->InsertNextValue(0);
+  }
+  return ok;
 }
 
 //----------------------------------------------------------------------------
-vtkCellArray::~vtkCellArray()
+bool vtkCellArray::ResizeExact(vtkIdType numCells, vtkIdType connectivitySize)
 {
-  this->Ia->Delete();
+  this->Synchronize();
+  this->StorageModified();
+  if (this->Storage64Bit)
+  {
+    this->Storage64.Offsets->SetNumberOfValues(numCells + 1);
+    this->Storage64.Connectivity->SetNumberOfValues(connectivitySize);
+    this->Storage64.Offsets->SetValue(numCells, connectivitySize);
+  }
+  else
+  {
+    this->Storage32.Offsets->SetNumberOfValues(numCells + 1);
+    this->Storage32.Connectivity->SetNumberOfValues(connectivitySize);
+    this->Storage32.Offsets->SetValue(numCells,
+      static_cast<ArrayType32::ValueType>(connectivitySize));
+  }
+  return this->GetNumberOfCells() == numCells &&
+    this->GetNumberOfConnectivityIds() == connectivitySize;
 }
 
 //----------------------------------------------------------------------------
 void vtkCellArray::Initialize()
 {
-  this->Ia->Initialize();
-  this->NumberOfCells = 0;
-  this->InsertLocation = 0;
-  this->TraversalLocation = 0;
+  ResetState(this->Storage32);
+  ResetState(this->Storage64);
+  this->TraversalCellId = 0;
+  this->LegacyState = LEGACY_NONE;
+  this->LegacyDataIsExternal = false;
+  if (this->LegacyData)
+  {
+    this->LegacyData->Delete();
+    this->LegacyData = nullptr;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::Reset()
+{
+  this->TraversalCellId = 0;
+  this->LegacyState = LEGACY_NONE;
+  if (this->LegacyDataIsExternal)
+  {
+    this->LegacyData->Delete();
+    this->LegacyData = nullptr;
+    this->LegacyDataIsExternal = false;
+  }
+  else if (this->LegacyData)
+  {
+    this->LegacyData->Reset();
+  }
+
+  if (this->Storage64Bit)
+  {
+    this->Storage64.Offsets->Reset();
+    this->Storage64.Offsets->InsertNextValue(0);
+    this->Storage64.Connectivity->Reset();
+  }
+  else
+  {
+    this->Storage32.Offsets->Reset();
+    this->Storage32.Offsets->InsertNextValue(0);
+    this->Storage32.Connectivity->Reset();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::Squeeze()
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
+  {
+    this->Storage64.Offsets->Squeeze();
+    this->Storage64.Connectivity->Squeeze();
+  }
+  else
+  {
+    this->Storage32.Offsets->Squeeze();
+    this->Storage32.Connectivity->Squeeze();
+  }
+
+  // The legacy mirror is not needed anymore.
+  this->LegacyState = LEGACY_NONE;
+  if (this->LegacyData)
+  {
+    this->LegacyData->Delete();
+    this->LegacyData = nullptr;
+    this->LegacyDataIsExternal = false;
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkCellArray::IsValid()
+{
+  return this->Visit(IsValidImpl{});
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ReplaceCellAtId(vtkIdType cellId, vtkIdType cellSize,
+                                   const vtkIdType cellPoints[])
+{
+  if (cellSize != this->GetCellSize(cellId))
+  {
+    vtkErrorMacro("Cannot replace cell " << cellId << " of size "
+                  << this->GetCellSize(cellId) << " with a cell of size "
+                  << cellSize);
+    return;
+  }
+  this->Visit(ReplaceCellAtIdImpl{}, cellId, cellSize, cellPoints);
+  this->StorageModified();
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ReplaceCellAtId(vtkIdType cellId, vtkIdList *list)
+{
+  this->ReplaceCellAtId(cellId, list->GetNumberOfIds(), list->GetPointer(0));
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ReverseCellAtId(vtkIdType cellId)
+{
+  this->Visit(ReverseCellAtIdImpl{}, cellId);
+  this->StorageModified();
+}
+
+//----------------------------------------------------------------------------
+vtkCellArrayIterator *vtkCellArray::NewIterator()
+{
+  vtkCellArrayIterator *iter = vtkCellArrayIterator::New();
+  iter->SetCellArray(this);
+  iter->GoToFirstCell();
+  return iter;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::Append(vtkCellArray *src, vtkIdType pointOffset)
+{
+  if (src == nullptr || src->GetNumberOfCells() == 0)
+  {
+    return;
+  }
+  this->Synchronize();
+
+  // Make sure that the result fits into the storage, shifted point ids
+  // included.
+  const vtkIdType max32 =
+    static_cast<vtkIdType>(std::numeric_limits<vtkTypeInt32>::max());
+  if (!this->Storage64Bit &&
+      (this->GetNumberOfConnectivityIds() + src->GetNumberOfConnectivityIds() >
+         max32 ||
+       !src->CanConvertTo32BitStorage() ||
+       src->Visit(GetMaxPointIdImpl{}) + pointOffset > max32))
+  {
+    this->ConvertTo64BitStorage();
+  }
+
+  src->Visit(AppendImpl{}, this, pointOffset);
+  this->StorageModified();
 }
 
 //----------------------------------------------------------------------------
-// Returns the size of the largest cell. The size is the number of points
-// defining the cell.
 int vtkCellArray::GetMaxCellSize()
 {
-  int npts=0, maxSize=0;
-  vtkIdType i, count=this->Ia->GetMaxId();
+  return this->Visit(GetMaxCellSizeImpl{});
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::Use32BitStorage()
+{
+  this->Initialize();
+  this->Storage64Bit = false;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::Use64BitStorage()
+{
+  this->Initialize();
+  this->Storage64Bit = true;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::UseDefaultStorage()
+{
+  this->Initialize();
+  this->Storage64Bit = (sizeof(vtkIdType) == 8);
+}
+
+//----------------------------------------------------------------------------
+bool vtkCellArray::CanConvertTo32BitStorage()
+{
+  return this->Visit(CanConvertTo32BitImpl{});
+}
+
+//----------------------------------------------------------------------------
+bool vtkCellArray::ConvertTo32BitStorage()
+{
+  this->Synchronize();
+  if (!this->Storage64Bit)
+  {
+    return true;
+  }
+  if (!this->CanConvertTo32BitStorage())
+  {
+    return false;
+  }
+  CopyState(this->Storage64, this->Storage32);
+  ResetState(this->Storage64);
+  this->Storage64Bit = false;
+  return true;
+}
 
-  for (i=0; i<count; i+=(npts+1))
+//----------------------------------------------------------------------------
+bool vtkCellArray::ConvertTo64BitStorage()
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
   {
-    if ( (npts=this->Ia->GetValue(i)) > maxSize )
-    {
-      maxSize = npts;
-    }
+    return true;
   }
-  return maxSize;
+  CopyState(this->Storage32, this->Storage64);
+  ResetState(this->Storage32);
+  this->Storage64Bit = true;
+  return true;
 }
 
 //----------------------------------------------------------------------------
-// Specify a group of cells.
-void vtkCellArray::SetCells(vtkIdType ncells, vtkIdTypeArray *cells)
+bool vtkCellArray::ConvertToDefaultStorage()
+{
+  return sizeof(vtkIdType) == 8 ? this->ConvertTo64BitStorage() :
+                                  this->ConvertTo32BitStorage();
+}
+
+//----------------------------------------------------------------------------
+bool vtkCellArray::ConvertToSmallestStorage()
+{
+  if (this->CanConvertTo32BitStorage())
+  {
+    return this->ConvertTo32BitStorage();
+  }
+  return this->ConvertTo64BitStorage();
+}
+
+//----------------------------------------------------------------------------
+vtkDataArray* vtkCellArray::GetOffsetsArray()
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
+  {
+    return this->Storage64.Offsets;
+  }
+  return this->Storage32.Offsets;
+}
+
+//----------------------------------------------------------------------------
+vtkDataArray* vtkCellArray::GetConnectivityArray()
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
+  {
+    return this->Storage64.Connectivity;
+  }
+  return this->Storage32.Connectivity;
+}
+
+//----------------------------------------------------------------------------
+vtkCellArray::ArrayType32* vtkCellArray::GetOffsetsArray32()
+{
+  this->Synchronize();
+  return this->Storage64Bit ? nullptr : this->Storage32.Offsets.Get();
+}
+
+//----------------------------------------------------------------------------
+vtkCellArray::ArrayType32* vtkCellArray::GetConnectivityArray32()
+{
+  this->Synchronize();
+  return this->Storage64Bit ? nullptr : this->Storage32.Connectivity.Get();
+}
+
+//----------------------------------------------------------------------------
+vtkCellArray::ArrayType64* vtkCellArray::GetOffsetsArray64()
+{
+  this->Synchronize();
+  return this->Storage64Bit ? this->Storage64.Offsets.Get() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+vtkCellArray::ArrayType64* vtkCellArray::GetConnectivityArray64()
+{
+  this->Synchronize();
+  return this->Storage64Bit ? this->Storage64.Connectivity.Get() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::SetData(ArrayType32 *offsets, ArrayType32 *connectivity)
+{
+  this->Initialize();
+  this->Storage64Bit = false;
+  this->Storage32.Offsets = offsets;
+  this->Storage32.Connectivity = connectivity;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::SetData(ArrayType64 *offsets, ArrayType64 *connectivity)
+{
+  this->Initialize();
+  this->Storage64Bit = true;
+  this->Storage64.Offsets = offsets;
+  this->Storage64.Connectivity = connectivity;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+bool vtkCellArray::SetData(vtkDataArray *offsets, vtkDataArray *connectivity)
+{
+  if (offsets == nullptr || connectivity == nullptr ||
+      offsets->GetNumberOfComponents() != 1 ||
+      connectivity->GetNumberOfComponents() != 1 ||
+      offsets->GetNumberOfValues() < 1)
+  {
+    vtkErrorMacro("Invalid offsets or connectivity array.");
+    return false;
+  }
+
+  // Share the arrays whenever possible.
+  ArrayType32 *offsets32 = vtkArrayDownCast<ArrayType32>(offsets);
+  ArrayType32 *conn32 = vtkArrayDownCast<ArrayType32>(connectivity);
+  if (offsets32 && conn32)
+  {
+    this->SetData(offsets32, conn32);
+    return true;
+  }
+  ArrayType64 *offsets64 = vtkArrayDownCast<ArrayType64>(offsets);
+  ArrayType64 *conn64 = vtkArrayDownCast<ArrayType64>(connectivity);
+  if (offsets64 && conn64)
+  {
+    this->SetData(offsets64, conn64);
+    return true;
+  }
+
+  // Copy anything else into the default storage.
+  if (sizeof(vtkIdType) == 8)
+  {
+    this->SetData(CopyToStorage<ArrayType64>(offsets).Get(),
+                  CopyToStorage<ArrayType64>(connectivity).Get());
+  }
+  else
+  {
+    this->SetData(CopyToStorage<ArrayType32>(offsets).Get(),
+                  CopyToStorage<ArrayType32>(connectivity).Get());
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::DeepCopy(vtkCellArray *ca)
+{
+  // Do nothing on a nullptr input.
+  if (ca == nullptr || ca == this)
+  {
+    return;
+  }
+
+  ca->Synchronize();
+  this->Initialize();
+  this->Storage64Bit = ca->Storage64Bit;
+  if (this->Storage64Bit)
+  {
+    CopyState(ca->Storage64, this->Storage64);
+  }
+  else
+  {
+    CopyState(ca->Storage32, this->Storage32);
+  }
+  this->TraversalCellId = ca->TraversalCellId;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ShallowCopy(vtkCellArray *ca)
+{
+  if (ca == nullptr || ca == this)
+  {
+    return;
+  }
+
+  ca->Synchronize();
+  this->Initialize();
+  this->Storage64Bit = ca->Storage64Bit;
+  this->Storage32.Offsets = ca->Storage32.Offsets;
+  this->Storage32.Connectivity = ca->Storage32.Connectivity;
+  this->Storage64.Offsets = ca->Storage64.Offsets;
+  this->Storage64.Connectivity = ca->Storage64.Connectivity;
+  this->TraversalCellId = ca->TraversalCellId;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ImportLegacyFormat(vtkIdTypeArray *data)
 {
-  if ( cells && cells != this->Ia )
+  this->ImportLegacyFormat(data->GetPointer(0), data->GetNumberOfValues());
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ImportLegacyFormat(const vtkIdType *data, vtkIdType len)
+{
+  this->Reset();
+  this->AppendLegacyFormat(data, len, 0);
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::AppendLegacyFormat(vtkIdTypeArray *data,
+                                      vtkIdType ptOffset)
+{
+  this->AppendLegacyFormat(data->GetPointer(0), data->GetNumberOfValues(),
+                           ptOffset);
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::AppendLegacyFormat(const vtkIdType *data, vtkIdType len,
+                                      vtkIdType ptOffset)
+{
+  vtkIdType numCells, numConn, maxId;
+  if (!ScanLegacyFormat(data, len, -1, ptOffset, numCells, numConn, maxId))
   {
-    this->Modified();
-    this->Ia->Delete();
-    this->Ia = cells;
-    this->Ia->Register(this);
+    vtkErrorMacro("Invalid legacy cell data.");
+    return;
+  }
 
-    this->NumberOfCells = ncells;
-    this->InsertLocation = cells->GetMaxId() + 1;
-    this->TraversalLocation = 0;
+  this->Synchronize();
+  if (!this->Storage64Bit &&
+      (maxId > std::numeric_limits<vtkTypeInt32>::max() ||
+       this->GetNumberOfConnectivityIds() + numConn >
+         std::numeric_limits<vtkTypeInt32>::max()))
+  {
+    this->ConvertTo64BitStorage();
   }
+  this->Visit(AppendLegacyFormatImpl{}, data, numCells, numConn, ptOffset);
+  this->StorageModified();
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ExportLegacyFormat(vtkIdTypeArray *data)
+{
+  this->Visit(ExportLegacyFormatImpl{}, data);
 }
 
 //----------------------------------------------------------------------------
 unsigned long vtkCellArray::GetActualMemorySize()
 {
-  return this->Ia->GetActualMemorySize();
+  unsigned long size = 0;
+  if (this->Storage64Bit)
+  {
+    size += this->Storage64.Offsets->GetActualMemorySize();
+    size += this->Storage64.Connectivity->GetActualMemorySize();
+  }
+  else
+  {
+    size += this->Storage32.Offsets->GetActualMemorySize();
+    size += this->Storage32.Connectivity->GetActualMemorySize();
+  }
+  if (this->LegacyData)
+  {
+    size += this->LegacyData->GetActualMemorySize();
+  }
+  return size;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::SetNumberOfCells(vtkIdType numCells)
+{
+  this->ExportLegacyData();
+  this->LegacyState = LEGACY_PENDING;
+  this->LegacyNumberOfCells = numCells;
 }
 
 //----------------------------------------------------------------------------
 int vtkCellArray::GetNextCell(vtkIdList *pts)
 {
-  vtkIdType npts, *ppts;
-  if (this->GetNextCell(npts, ppts))
+  if (this->TraversalCellId < this->GetNumberOfCells())
   {
-    pts->SetNumberOfIds(npts);
-    for (vtkIdType i = 0; i < npts; i++)
-    {
-      pts->SetId(i, ppts[i]);
-    }
+    this->GetCellAtId(this->TraversalCellId++, pts);
     return 1;
   }
+  pts->Reset();
   return 0;
 }
 
+//----------------------------------------------------------------------------
+vtkIdType vtkCellArray::GetSize()
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
+  {
+    return this->Storage64.Offsets->GetSize() +
+      this->Storage64.Connectivity->GetSize();
+  }
+  return this->Storage32.Offsets->GetSize() +
+    this->Storage32.Connectivity->GetSize();
+}
+
 //----------------------------------------------------------------------------
 void vtkCellArray::GetCell(vtkIdType loc, vtkIdList *pts)
 {
-  vtkIdType npts = this->Ia->GetValue(loc++);
-  vtkIdType *ppts = this->Ia->GetPointer(loc);
-  pts->SetNumberOfIds(npts);
-  for (vtkIdType i = 0; i < npts; i++)
+  this->GetCellAtId(this->GetCellIdFromLegacyLocation(loc), pts);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkCellArray::GetTraversalLocation()
+{
+  return this->GetOffset(this->TraversalCellId) + this->TraversalCellId;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::SetTraversalLocation(vtkIdType loc)
+{
+  this->TraversalCellId = this->GetCellIdFromLegacyLocation(loc);
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ReverseCell(vtkIdType loc)
+{
+  this->ReverseCellAtId(this->GetCellIdFromLegacyLocation(loc));
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::ReplaceCell(vtkIdType loc, int npts, const vtkIdType pts[])
+{
+  // As before, the number of points of the cell is left unchanged: only the
+  // first npts point ids are overwritten.
+  const vtkIdType cellId = this->GetCellIdFromLegacyLocation(loc);
+  if (npts > this->GetCellSize(cellId))
   {
-    pts->SetId(i, ppts[i]);
+    vtkErrorMacro("Cannot replace cell " << cellId << " of size "
+                  << this->GetCellSize(cellId) << " with a cell of size "
+                  << npts);
+    return;
   }
+  this->Visit(ReplaceCellAtIdImpl{}, cellId, static_cast<vtkIdType>(npts),
+              pts);
+  this->StorageModified();
+}
+
+//----------------------------------------------------------------------------
+vtkIdType *vtkCellArray::GetPointer()
+{
+  return this->GetData()->GetPointer(0);
+}
+
+//----------------------------------------------------------------------------
+vtkIdType *vtkCellArray::WritePointer(const vtkIdType ncells,
+                                      const vtkIdType size)
+{
+  this->ExportLegacyData();
+  this->LegacyState = LEGACY_PENDING;
+  this->LegacyNumberOfCells = ncells;
+  this->TraversalCellId = 0;
+  return this->LegacyData->WritePointer(0, size);
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArray::SetCells(vtkIdType ncells, vtkIdTypeArray *cells)
+{
+  if (cells == nullptr)
+  {
+    return;
+  }
+
+  if (cells != this->LegacyData)
+  {
+    cells->Register(this);
+    if (this->LegacyData)
+    {
+      this->LegacyData->Delete();
+    }
+    this->LegacyData = cells;
+    this->LegacyDataIsExternal = true;
+  }
+  this->LegacyState = LEGACY_PENDING;
+  this->LegacyNumberOfCells = ncells;
+  this->TraversalCellId = 0;
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+vtkIdTypeArray* vtkCellArray::GetData()
+{
+  this->ExportLegacyData();
+  this->LegacyState = LEGACY_PENDING;
+  return this->LegacyData;
+}
+
+//----------------------------------------------------------------------------
+// Make sure that LegacyData mirrors the storage (unless it is already
+// authoritative).
+void vtkCellArray::ExportLegacyData()
+{
+  if (this->LegacyState != LEGACY_NONE)
+  {
+    return;
+  }
+
+  if (this->LegacyData == nullptr || this->LegacyDataIsExternal)
+  {
+    if (this->LegacyData)
+    {
+      this->LegacyData->Delete();
+    }
+    this->LegacyData = vtkIdTypeArray::New();
+    this->LegacyDataIsExternal = false;
+  }
+  this->ExportLegacyFormat(this->LegacyData);
+  this->LegacyNumberOfCells = this->GetNumberOfCells();
+  this->LegacyState = LEGACY_SYNCED;
+}
+
+//----------------------------------------------------------------------------
+// Rebuild the storage from the authoritative legacy data.
+void vtkCellArray::ImportPendingLegacyData()
+{
+  // Prevent recursion: from now on the storage is accessed directly.
+  this->LegacyState = LEGACY_NONE;
+
+  const vtkIdType *data = this->LegacyData->GetPointer(0);
+  const vtkIdType len = this->LegacyData->GetMaxId() + 1;
+
+  // Read-only accesses through GetData()/GetPointer() are common, in which
+  // case the storage does not need to be rebuilt.
+  if (this->Visit(MatchesLegacyFormatImpl{}, data, len,
+                  this->LegacyNumberOfCells))
+  {
+    this->LegacyState =
+      this->LegacyDataIsExternal ? LEGACY_NONE : LEGACY_SYNCED;
+    return;
+  }
+
+  vtkIdType numCells, numConn, maxId;
+  if (!ScanLegacyFormat(data, len, this->LegacyNumberOfCells, 0,
+                        numCells, numConn, maxId))
+  {
+    vtkWarningMacro("Legacy cell data is inconsistent with the number of "
+                    "cells: importing " << numCells << " of "
+                    << this->LegacyNumberOfCells << " cells.");
+  }
+
+  // Build new arrays rather than overwriting the current ones, since they
+  // may be shared with another cell array (see ShallowCopy()).
+  bool use64Bit = this->Storage64Bit ||
+    maxId > std::numeric_limits<vtkTypeInt32>::max() ||
+    numConn > std::numeric_limits<vtkTypeInt32>::max();
+  ResetState(this->Storage32);
+  ResetState(this->Storage64);
+  this->Storage64Bit = use64Bit;
+  this->Visit(AppendLegacyFormatImpl{}, data, numCells, numConn, 0);
+
+  // Keep the legacy data as a mirror if it describes exactly the cells, so
+  // that pointers previously returned by GetPointer() remain meaningful.
+  this->LegacyState = (!this->LegacyDataIsExternal &&
+                       len == numCells + numConn) ? LEGACY_SYNCED : LEGACY_NONE;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkCellArray::GetCellIdFromLegacyLocation(vtkIdType loc)
+{
+  return this->Visit(LegacyLocationToCellIdImpl{}, loc);
 }
 
 //----------------------------------------------------------------------------
@@ -130,7 +1152,8 @@ void vtkCellArray::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os,indent);
 
-  os << indent << "Number Of Cells: " << this->NumberOfCells << endl;
-  os << indent << "Insert Location: " << this->InsertLocation << endl;
-  os << indent << "Traversal Location: " << this->TraversalLocation << endl;
+  os << indent << "Number Of Cells: " << this->GetNumberOfCells() << endl;
+  os << indent << "Storage: " << (this->Storage64Bit ? "64" : "32")
+     << "-bit" << endl;
+  os << indent << "Traversal Cell Id: " << this->TraversalCellId << endl;
 }
@@ -17,19 +17,56 @@
  * @brief   object to represent cell connectivity
  *
  * vtkCellArray is a supporting object that explicitly represents cell
- * connectivity. The cell array structure is a raw integer list
- * of the form: (n,id1,id2,...,idn, n,id1,id2,...,idn, ...)
- * where n is the number of points in the cell, and id is a zero-offset index
- * into an associated point list.
+ * connectivity. The cells are stored in two arrays: a connectivity array
+ * containing the point ids of all cells laid end to end, and an offsets
+ * array of size (numCells+1) such that the point ids of cell i are found in
+ * connectivity[offsets[i]] up to (but not including)
+ * connectivity[offsets[i+1]]. For example, the three cells (0,1,2),
+ * (3,4,5,6) and (7,8) are represented as
  *
- * Advantages of this data structure are its compactness, simplicity, and
- * easy interface to external data.  However, it is totally inadequate for
- * random access.  This functionality (when necessary) is accomplished by
- * using the vtkCellTypes and vtkCellLinks objects to extend the definition of
- * the data structure.
+ * \code
+ * offsets:      0, 3, 7, 9
+ * connectivity: 0, 1, 2, 3, 4, 5, 6, 7, 8
+ * \endcode
+ *
+ * Since the number of points and the location of each cell are implicit in
+ * the offsets, any cell can be accessed in constant time (see
+ * GetCellAtId()), which makes it possible to process the cells of a
+ * vtkCellArray in parallel (e.g., with vtkSMPTools).
+ *
+ * The offsets and connectivity arrays are stored either as 32-bit
+ * (vtkTypeInt32Array) or 64-bit (vtkTypeInt64Array) integers. The default
+ * storage matches the size of vtkIdType; when the number of connectivity
+ * entries and all point ids fit into 32 bits, ConvertTo32BitStorage() (or
+ * ConvertToSmallestStorage()) roughly halves the memory consumed by the
+ * topology. Typed, zero-overhead access to the underlying arrays is
+ * available through the Visit() method; a per-thread cursor over a range of
+ * cells is provided by vtkCellArrayIterator.
+ *
+ * For backward compatibility, the "legacy" interleaved layout
+ * (n,id1,id2,...,idn, n,id1,id2,...,idn, ...) is still supported through
+ * GetData(), GetPointer(), WritePointer() and SetCells(). These methods
+ * export the cells into (or import them from) an internal vtkIdTypeArray:
+ * the exported data is treated as authoritative, and is imported back into
+ * the offsets/connectivity storage the next time the cells are accessed
+ * through any other method. Legacy "locations" (offsets into the legacy
+ * layout, as used by GetCell(loc,...), ReplaceCell() and ReverseCell()) are
+ * converted to cell ids on the fly. New code should use the cell id based
+ * methods instead.
+ *
+ * @warning
+ * The random access methods taking a caller-provided vtkIdList (and the
+ * Visit() method) are safe to call concurrently from several threads, as
+ * long as the cell array is not modified at the same time and no legacy
+ * access (GetData(), GetPointer(), WritePointer(), SetCells()) is pending.
+ * Accessing the cell array once from the calling thread (e.g., with
+ * GetNumberOfConnectivityIds()) before entering the parallel section
+ * guarantees the latter; QueryCellAtId() does not require it. The
+ * traversal methods InitTraversal() and GetNextCell() share a single cursor
+ * and are not thread safe; use vtkCellArrayIterator instead.
  *
  * @sa
- * vtkCellTypes vtkCellLinks
+ * vtkCellArrayIterator vtkCellTypes vtkCellLinks vtkStaticCellLinks
 */
 
 #ifndef vtkCellArray_h
@@ -38,8 +75,18 @@
 #include "vtkCommonDataModelModule.h" // For export macro
 #include "vtkObject.h"
 
-#include "vtkIdTypeArray.h" // Needed for inline methods
 #include "vtkCell.h" // Needed for inline methods
+#include "vtkIdList.h" // Needed for inline methods
+#include "vtkIdTypeArray.h" // Needed for inline methods
+#include "vtkSmartPointer.h" // For storage
+#include "vtkTypeInt32Array.h" // For storage
+#include "vtkTypeInt64Array.h" // For storage
+
+#include <algorithm> // For std::copy
+#include <type_traits> // For std::is_same
+#include <utility> // For std::forward
+
+class vtkCellArrayIterator;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkCellArray : public vtkObject
 {
@@ -47,36 +94,146 @@ public:
   vtkTypeMacro(vtkCellArray,vtkObject);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  //@{
+  /**
+   * The array types used for 32 and 64-bit storage.
+   */
+  typedef vtkTypeInt32Array ArrayType32;
+  typedef vtkTypeInt64Array ArrayType64;
+  //@}
+
+#ifndef __VTK_WRAP__
+  /**
+   * Typed access to the offsets and connectivity arrays, see Visit().
+   */
+  template <typename ArrayT>
+  struct VisitState
+  {
+    typedef ArrayT ArrayType;
+    typedef typename ArrayType::ValueType ValueType;
+
+    VisitState()
+      : Offsets(vtkSmartPointer<ArrayType>::New())
+      , Connectivity(vtkSmartPointer<ArrayType>::New())
+    {
+      this->Offsets->InsertNextValue(0);
+    }
+
+    ArrayType* GetOffsets() {return this->Offsets;}
+    ArrayType* GetConnectivity() {return this->Connectivity;}
+
+    vtkIdType GetNumberOfCells() const
+      {return this->Offsets->GetNumberOfValues() - 1;}
+    vtkIdType GetNumberOfConnectivityIds() const
+      {return this->Connectivity->GetNumberOfValues();}
+    vtkIdType GetBeginOffset(vtkIdType cellId) const
+      {return static_cast<vtkIdType>(this->Offsets->GetValue(cellId));}
+    vtkIdType GetEndOffset(vtkIdType cellId) const
+      {return static_cast<vtkIdType>(this->Offsets->GetValue(cellId+1));}
+    vtkIdType GetCellSize(vtkIdType cellId) const
+      {return this->GetEndOffset(cellId) - this->GetBeginOffset(cellId);}
+
+    /**
+     * Pointer to the first point id of cell cellId.
+     */
+    ValueType* GetCellPoints(vtkIdType cellId)
+      {return this->Connectivity->GetPointer(this->GetBeginOffset(cellId));}
+
+    vtkSmartPointer<ArrayType> Offsets;
+    vtkSmartPointer<ArrayType> Connectivity;
+  };
+#endif
+
   /**
    * Instantiate cell array (connectivity list).
    */
   static vtkCellArray *New();
 
   /**
-   * Allocate memory and set the size to extend by.
+   * Allocate memory. The size sz is expressed in terms of the legacy layout
+   * (i.e., numCells + number of connectivity entries), and is used as an
+   * upper bound for both the offsets and the connectivity arrays. The
+   * extension size is ignored. Prefer AllocateEstimate() or AllocateExact().
+   */
+  vtkTypeBool Allocate(vtkIdType sz, vtkIdType vtkNotUsed(ext)=1000)
+    {return this->AllocateExact(sz, sz) ? 1 : 0;}
+
+  /**
+   * Pre-allocate memory for numCells cells of (on average) maxCellSize
+   * points each. Existing cells are discarded. Returns true on success.
+   */
+  bool AllocateEstimate(vtkIdType numCells, vtkIdType maxCellSize)
+    {return this->AllocateExact(numCells, numCells * maxCellSize);}
+
+  /**
+   * Pre-allocate memory for exactly numCells cells using a total of
+   * connectivitySize point ids. Existing cells are discarded. Returns true
+   * on success.
+   */
+  bool AllocateExact(vtkIdType numCells, vtkIdType connectivitySize);
+
+  /**
+   * Resize the internal storage to hold exactly numCells cells using
+   * connectivitySize point ids. The new entries are uninitialized and must
+   * be filled in (e.g., through Visit()) before the cells are used; the last
+   * offset is set to connectivitySize. This is the preferred way of building
+   * a cell array in parallel: compute the sizes up front, resize, then fill
+   * the offsets and connectivity from several threads.
    */
-  vtkTypeBool Allocate(vtkIdType sz, vtkIdType ext=1000)
-    {return this->Ia->Allocate(sz,ext);}
+  bool ResizeExact(vtkIdType numCells, vtkIdType connectivitySize);
 
   /**
    * Free any memory and reset to an empty state.
    */
   void Initialize();
 
-  //@{
+  /**
+   * Reuse list. Reset to initial condition.
+   */
+  void Reset();
+
+  /**
+   * Reclaim any extra memory.
+   */
+  void Squeeze();
+
+  /**
+   * Check that the offsets are non-decreasing, start at 0 and end at the
+   * number of connectivity entries. Returns true if the array is valid.
+   */
+  bool IsValid();
+
   /**
    * Get the number of cells in the array.
    */
-  vtkGetMacro(NumberOfCells, vtkIdType);
-  //@}
+  vtkIdType GetNumberOfCells();
 
-  //@{
   /**
-   * Set the number of cells in the array.
-   * DO NOT do any kind of allocation, advanced use only.
+   * Get the number of elements in the offsets array. This is the number of
+   * cells plus one.
    */
-  vtkSetMacro(NumberOfCells, vtkIdType);
-  //@}
+  vtkIdType GetNumberOfOffsets()
+    {return this->GetNumberOfCells() + 1;}
+
+  /**
+   * Get the size of the connectivity array, i.e., the sum of the number of
+   * points of all cells.
+   */
+  vtkIdType GetNumberOfConnectivityIds();
+
+  /**
+   * Get the offset of cell cellId into the connectivity array. cellId may
+   * be equal to the number of cells, in which case the size of the
+   * connectivity array is returned.
+   */
+  vtkIdType GetOffset(vtkIdType cellId)
+    VTK_EXPECTS(0 <= cellId && cellId <= GetNumberOfCells());
+
+  /**
+   * Return the number of points of cell cellId.
+   */
+  vtkIdType GetCellSize(vtkIdType cellId)
+    VTK_EXPECTS(0 <= cellId && cellId < GetNumberOfCells());
 
   /**
    * Utility routines help manage memory of cell array. EstimateSize()
@@ -84,61 +241,99 @@ public:
    * on number of cells and maximum number of points making up cell.  If
    * every cell is the same size (in terms of number of points), then the
    * memory estimate is guaranteed exact. (If not exact, use Squeeze() to
-   * reclaim any extra memory.)
+   * reclaim any extra memory.) The value is expressed in terms of the
+   * legacy layout, see Allocate().
    */
   vtkIdType EstimateSize(vtkIdType numCells, int maxPtsPerCell)
     {return numCells*(1+maxPtsPerCell);}
 
+  //@{
   /**
-   * A cell traversal methods that is more efficient than vtkDataSet traversal
-   * methods.  InitTraversal() initializes the traversal of the list of cells.
+   * Random access to the points of cell cellId. The point ids are returned
+   * through pts, which is valid until the next modification of the cell
+   * array (or of ptIds). When the storage type matches vtkIdType, pts points
+   * directly into the connectivity array and ptIds is left untouched;
+   * otherwise the ids are copied into ptIds. This method is thread safe
+   * as long as each thread uses its own ptIds.
    */
-  void InitTraversal() {this->TraversalLocation=0;};
+  void GetCellAtId(vtkIdType cellId, vtkIdType &npts,
+                   vtkIdType const* &pts, vtkIdList *ptIds)
+    VTK_EXPECTS(0 <= cellId && cellId < GetNumberOfCells());
+  //@}
 
   /**
-   * A cell traversal methods that is more efficient than vtkDataSet traversal
-   * methods.  GetNextCell() gets the next cell in the list. If end of list
-   * is encountered, 0 is returned. A value of 1 is returned whenever
-   * npts and pts have been updated without error.
+   * Random access to the points of cell cellId. The ids are copied into
+   * pts. This method is thread safe as long as each thread uses its own
+   * vtkIdList.
    */
-  int GetNextCell(vtkIdType& npts, vtkIdType* &pts)
+  void GetCellAtId(vtkIdType cellId, vtkIdList *pts)
+    VTK_EXPECTS(0 <= cellId && cellId < GetNumberOfCells());
+
+  /**
+   * Random access to the points of cell cellId using an internal scratch
+   * list when the storage type does not match vtkIdType. This method is NOT
+   * thread safe; the returned pointer is valid until the next call.
+   */
+  void GetCellAtId(vtkIdType cellId, vtkIdType &npts, vtkIdType const* &pts)
+    VTK_EXPECTS(0 <= cellId && cellId < GetNumberOfCells())
     VTK_SIZEHINT(pts, npts);
 
+  //@{
   /**
-   * A cell traversal methods that is more efficient than vtkDataSet traversal
-   * methods.  GetNextCell() gets the next cell in the list. If end of list
-   * is encountered, 0 is returned.
+   * Variants of GetCellAtId() for the query paths of datasets that keep the
+   * legacy location of each cell (see
+   * vtkUnstructuredGrid::GetCellLocationsArray()). These methods never
+   * modify the cell array: pending legacy data (see GetData()) is not
+   * imported, the cell is read in place at its legacy location loc instead.
+   * The overloads taking a ptIds list are thread safe as long as each thread
+   * uses its own list; the last overload uses an internal scratch list and
+   * is NOT thread safe.
    */
-  int GetNextCell(vtkIdList *pts);
+  void QueryCellAtId(vtkIdType cellId, vtkIdType loc, vtkIdList *ptIds);
+  void QueryCellAtId(vtkIdType cellId, vtkIdType loc, vtkIdType &npts,
+                     vtkIdType const* &pts, vtkIdList *ptIds);
+  void QueryCellAtId(vtkIdType cellId, vtkIdType loc, vtkIdType &npts,
+                     vtkIdType const* &pts);
+  //@}
 
   /**
-   * Get the size of the allocated connectivity array.
+   * Return true if the cells were handed out (or defined) in the legacy
+   * layout through GetData(), GetPointer(), WritePointer() or SetCells(),
+   * and will be imported into the offsets/connectivity storage the next
+   * time they are accessed.
    */
-  vtkIdType GetSize()
-    {return this->Ia->GetSize();}
+  bool IsLegacyDataPending() const
+    {return this->LegacyState == LEGACY_PENDING;}
 
   /**
-   * Get the total number of entries (i.e., data values) in the connectivity
-   * array. This may be much less than the allocated size (i.e., return value
-   * from GetSize().)
+   * Replace the point ids of cell cellId. The number of points must not
+   * change. Calling this method does not mark the vtkCellArray as modified.
    */
-  vtkIdType GetNumberOfConnectivityEntries()
-    {return this->Ia->GetMaxId()+1;}
+  void ReplaceCellAtId(vtkIdType cellId, vtkIdType cellSize,
+                       const vtkIdType cellPoints[])
+    VTK_EXPECTS(0 <= cellId && cellId < GetNumberOfCells())
+    VTK_SIZEHINT(cellPoints, cellSize);
 
   /**
-   * Internal method used to retrieve a cell given an offset into
-   * the internal array.
+   * Replace the point ids of cell cellId. The number of points must not
+   * change. Calling this method does not mark the vtkCellArray as modified.
    */
-  void GetCell(vtkIdType loc, vtkIdType &npts, vtkIdType* &pts)
-    VTK_EXPECTS(0 <= loc && loc < GetSize())
-    VTK_SIZEHINT(pts, npts);
+  void ReplaceCellAtId(vtkIdType cellId, vtkIdList *list)
+    VTK_EXPECTS(0 <= cellId && cellId < GetNumberOfCells());
 
   /**
-   * Internal method used to retrieve a cell given an offset into
-   * the internal array.
+   * Reverse the order of the point ids of cell cellId.
    */
-  void GetCell(vtkIdType loc, vtkIdList* pts)
-    VTK_EXPECTS(0 <= loc && loc < GetSize());
+  void ReverseCellAtId(vtkIdType cellId)
+    VTK_EXPECTS(0 <= cellId && cellId < GetNumberOfCells());
+
+  /**
+   * Return a new iterator over the cells of this array. Several iterators
+   * may traverse the same (unmodified) cell array concurrently, e.g., one
+   * per thread within vtkSMPTools::For(). The caller takes ownership of the
+   * returned object.
+   */
+  VTK_NEWINSTANCE vtkCellArrayIterator *NewIterator();
 
   /**
    * Insert a cell object. Return the cell id of the cell.
@@ -179,73 +374,120 @@ public:
   void UpdateCellCount(int npts);
 
   /**
-   * Computes the current insertion location within the internal array.
-   * Used in conjunction with GetCell(int loc,...).
+   * Append the cells of src to this array, adding pointOffset to every
+   * point id.
    */
-  vtkIdType GetInsertLocation(int npts)
-    {return (this->InsertLocation - npts - 1);};
+  void Append(vtkCellArray *src, vtkIdType pointOffset = 0);
 
   /**
-   * Get/Set the current traversal location.
+   * Returns the size of the largest cell. The size is the number of points
+   * defining the cell.
    */
-  vtkIdType GetTraversalLocation()
-    {return this->TraversalLocation;}
-  void SetTraversalLocation(vtkIdType loc)
-    {this->TraversalLocation = loc;}
+  int GetMaxCellSize();
 
+  //@{
   /**
-   * Computes the current traversal location within the internal array. Used
-   * in conjunction with GetCell(int loc,...).
+   * Storage management. Use32BitStorage(), Use64BitStorage() and
+   * UseDefaultStorage() discard the current content and select the integer
+   * width used by the (empty) arrays. The default storage matches the size
+   * of vtkIdType. The ConvertTo*() methods preserve the content and return
+   * false if the conversion is impossible (e.g., some ids do not fit into 32
+   * bits). ConvertToSmallestStorage() picks 32-bit storage whenever
+   * possible.
    */
-  vtkIdType GetTraversalLocation(vtkIdType npts)
-    {return(this->TraversalLocation-npts-1);}
+  void Use32BitStorage();
+  void Use64BitStorage();
+  void UseDefaultStorage();
+  bool CanConvertTo32BitStorage();
+  bool CanConvertTo64BitStorage() {return true;}
+  bool ConvertTo32BitStorage();
+  bool ConvertTo64BitStorage();
+  bool ConvertToDefaultStorage();
+  bool ConvertToSmallestStorage();
+  //@}
 
   /**
-   * Special method inverts ordering of current cell. Must be called
-   * carefully or the cell topology may be corrupted.
+   * Return true if the offsets and connectivity arrays use 64-bit integers.
    */
-  void ReverseCell(vtkIdType loc)
-    VTK_EXPECTS(0 <= loc && loc < GetSize());
+  bool IsStorage64Bit() const
+    {return this->Storage64Bit;}
 
   /**
-   * Replace the point ids of the cell with a different list of point ids.
-   * Calling this method does not mark the vtkCellArray as modified.  This is
-   * the responsibility of the caller and may be done after multiple calls to
-   * ReplaceCell.
+   * Return true if the storage type matches vtkIdType. In that case pointers
+   * into the connectivity array can be handed out as vtkIdType pointers
+   * without copying (see GetCellAtId()).
    */
-  void ReplaceCell(vtkIdType loc, int npts, const vtkIdType pts[])
-    VTK_EXPECTS(0 <= loc && loc < GetSize())
-    VTK_SIZEHINT(pts, npts);
+  bool IsStorageShareable() const
+    {
+    return this->Storage64Bit ?
+      std::is_same<ArrayType64::ValueType, vtkIdType>::value :
+      std::is_same<ArrayType32::ValueType, vtkIdType>::value;
+    }
 
+  //@{
   /**
-   * Returns the size of the largest cell. The size is the number of points
-   * defining the cell.
+   * Access the offsets and connectivity arrays. The 32/64-bit specific
+   * accessors return nullptr if the storage does not match.
    */
-  int GetMaxCellSize();
+  vtkDataArray* GetOffsetsArray();
+  vtkDataArray* GetConnectivityArray();
+  ArrayType32* GetOffsetsArray32();
+  ArrayType32* GetConnectivityArray32();
+  ArrayType64* GetOffsetsArray64();
+  ArrayType64* GetConnectivityArray64();
+  //@}
 
+  //@{
   /**
-   * Get pointer to array of cell data.
+   * Set the offsets and connectivity arrays. The arrays are shared when
+   * they are both vtkTypeInt32Array (or vtkTypeInt64Array, or vtkIdTypeArray
+   * when the storage is shareable); other integral arrays are copied into
+   * the default storage. The offsets array must contain numCells+1 values.
+   * Returns false if the arrays are unusable.
    */
-  vtkIdType *GetPointer()
-    {return this->Ia->GetPointer(0);}
+  void SetData(ArrayType32 *offsets, ArrayType32 *connectivity);
+  void SetData(ArrayType64 *offsets, ArrayType64 *connectivity);
+  bool SetData(vtkDataArray *offsets, vtkDataArray *connectivity);
+  //@}
 
   /**
-   * Get pointer to data array for purpose of direct writes of data. Size is the
-   * total storage consumed by the cell array. ncells is the number of cells
-   * represented in the array.
+   * Visit the typed storage. The functor is called with a
+   * vtkCellArray::VisitState<ArrayType32> or VisitState<ArrayType64>
+   * reference as its first argument, followed by args. This gives direct,
+   * non-virtual access to the offsets and connectivity values and is the
+   * recommended way to process cells in inner loops and vtkSMPTools
+   * workers. The functor should use a templated operator(), e.g.:
+   *
+   * \code
+   * struct CountPoints
+   * {
+   *   template <typename CellStateT>
+   *   vtkIdType operator()(CellStateT& state, vtkIdType cellId)
+   *   {
+   *     return state.GetCellSize(cellId);
+   *   }
+   * };
+   * vtkIdType n = cellArray->Visit(CountPoints{}, 0);
+   * \endcode
    */
-  vtkIdType *WritePointer(const vtkIdType ncells, const vtkIdType size);
+#ifndef __VTK_WRAP__
+  template <typename Functor, typename... Args>
+  auto Visit(Functor &&functor, Args&&... args)
+    -> decltype(functor(std::declval<VisitState<ArrayType64>&>(),
+                        std::forward<Args>(args)...));
+#endif
 
   /**
-   * Define multiple cells by providing a connectivity list. The list is in
-   * the form (npts,p0,p1,...p(npts-1), repeated for each cell). Be careful
-   * using this method because it discards the old cells, and anything
-   * referring these cells becomes invalid (for example, if BuildCells() has
-   * been called see vtkPolyData).  The traversal location is reset to the
-   * beginning of the list; the insertion location is set to the end of the
-   * list.
+   * Visit the point ids of cell cellId without modifying the cell array
+   * (see QueryCellAtId()). The functor is called with the number of points
+   * and a const pointer to the typed point ids (vtkIdType for pending legacy
+   * data, which is read at the legacy location loc), followed by args.
    */
-  void SetCells(vtkIdType ncells, vtkIdTypeArray *cells);
+#ifndef __VTK_WRAP__
+  template <typename Functor, typename... Args>
+  void VisitCellAtId(vtkIdType cellId, vtkIdType loc, Functor &&functor,
+                     Args&&... args);
+#endif
 
   /**
    * Perform a deep copy (no reference counting) of the given cell array.
@@ -253,21 +495,28 @@ public:
   void DeepCopy(vtkCellArray *ca);
 
   /**
-   * Return the underlying data as a data array.
+   * Shallow copy: the offsets and connectivity arrays are shared.
    */
-  vtkIdTypeArray* GetData()
-    {return this->Ia;}
+  void ShallowCopy(vtkCellArray *ca);
 
+  //@{
   /**
-   * Reuse list. Reset to initial condition.
+   * Import/append cells expressed in the legacy layout
+   * (n,id1,id2,...,idn, ...). The data is copied.
    */
-  void Reset();
+  void ImportLegacyFormat(vtkIdTypeArray *data);
+  void ImportLegacyFormat(const vtkIdType *data, vtkIdType len)
+    VTK_SIZEHINT(data, len);
+  void AppendLegacyFormat(vtkIdTypeArray *data, vtkIdType ptOffset = 0);
+  void AppendLegacyFormat(const vtkIdType *data, vtkIdType len,
+                          vtkIdType ptOffset = 0)
+    VTK_SIZEHINT(data, len);
+  //@}
 
   /**
-   * Reclaim any extra memory.
+   * Fill data with the cells expressed in the legacy layout.
    */
-  void Squeeze()
-    {this->Ia->Squeeze();}
+  void ExportLegacyFormat(vtkIdTypeArray *data);
 
   /**
    * Return the memory in kibibytes (1024 bytes) consumed by this cell array. Used to
@@ -279,140 +528,545 @@ public:
    */
   unsigned long GetActualMemorySize();
 
+  //============================================================================
+  // Legacy interface. The following methods operate on (or return) the
+  // interleaved (n,id1,...,idn, ...) layout, or on legacy locations (offsets
+  // into that layout). They are retained for backward compatibility.
+
+  /**
+   * Set the number of cells in the array. This only makes sense together
+   * with direct writes through GetData(), GetPointer() or WritePointer():
+   * it specifies how many cells the legacy data contains.
+   * DO NOT do any kind of allocation, advanced use only.
+   */
+  void SetNumberOfCells(vtkIdType numCells);
+
+  /**
+   * A cell traversal methods that is more efficient than vtkDataSet traversal
+   * methods.  InitTraversal() initializes the traversal of the list of cells.
+   */
+  void InitTraversal() {this->TraversalCellId=0;};
+
+  /**
+   * A cell traversal methods that is more efficient than vtkDataSet traversal
+   * methods.  GetNextCell() gets the next cell in the list. If end of list
+   * is encountered, 0 is returned. A value of 1 is returned whenever
+   * npts and pts have been updated without error. When the storage does
+   * not match vtkIdType, pts points into an internal scratch list and
+   * modifications through it are not reflected in the cell array.
+   */
+  int GetNextCell(vtkIdType& npts, vtkIdType* &pts)
+    VTK_SIZEHINT(pts, npts);
+
+  /**
+   * A cell traversal methods that is more efficient than vtkDataSet traversal
+   * methods.  GetNextCell() gets the next cell in the list. If end of list
+   * is encountered, 0 is returned.
+   */
+  int GetNextCell(vtkIdList *pts);
+
+  /**
+   * Get the size of the allocated offsets and connectivity arrays.
+   */
+  vtkIdType GetSize();
+
+  /**
+   * Get the total number of entries in the legacy layout, i.e., the number
+   * of cells plus the number of connectivity entries. This may be much less
+   * than the allocated size (i.e., return value from GetSize().)
+   */
+  vtkIdType GetNumberOfConnectivityEntries();
+
+  /**
+   * Internal method used to retrieve a cell given a legacy location. Prefer
+   * GetCellAtId().
+   */
+  void GetCell(vtkIdType loc, vtkIdType &npts, vtkIdType* &pts)
+    VTK_EXPECTS(0 <= loc && loc < GetNumberOfConnectivityEntries())
+    VTK_SIZEHINT(pts, npts);
+
+  /**
+   * Internal method used to retrieve a cell given a legacy location. Prefer
+   * GetCellAtId().
+   */
+  void GetCell(vtkIdType loc, vtkIdList* pts)
+    VTK_EXPECTS(0 <= loc && loc < GetNumberOfConnectivityEntries());
+
+  /**
+   * Computes the legacy location of the last inserted cell. Used in
+   * conjunction with GetCell(int loc,...).
+   */
+  vtkIdType GetInsertLocation(int npts)
+    {return (this->GetNumberOfConnectivityEntries() - npts - 1);};
+
+  //@{
+  /**
+   * Get/Set the current traversal location, expressed as a legacy location.
+   * GetTraversalCellId()/SetTraversalCellId() express the same using cell
+   * ids.
+   */
+  vtkIdType GetTraversalLocation();
+  void SetTraversalLocation(vtkIdType loc);
+  vtkIdType GetTraversalCellId()
+    {return this->TraversalCellId;}
+  void SetTraversalCellId(vtkIdType cellId)
+    {this->TraversalCellId = cellId;}
+  //@}
+
+  /**
+   * Computes the current traversal location within the legacy layout. Used
+   * in conjunction with GetCell(int loc,...).
+   */
+  vtkIdType GetTraversalLocation(vtkIdType npts)
+    {return(this->GetTraversalLocation()-npts-1);}
+
+  /**
+   * Special method inverts ordering of the cell at legacy location loc.
+   * Prefer ReverseCellAtId().
+   */
+  void ReverseCell(vtkIdType loc)
+    VTK_EXPECTS(0 <= loc && loc < GetNumberOfConnectivityEntries());
+
+  /**
+   * Replace the point ids of the cell at legacy location loc with a
+   * different list of point ids. Calling this method does not mark the
+   * vtkCellArray as modified.  This is the responsibility of the caller and
+   * may be done after multiple calls to ReplaceCell. Prefer
+   * ReplaceCellAtId().
+   */
+  void ReplaceCell(vtkIdType loc, int npts, const vtkIdType pts[])
+    VTK_EXPECTS(0 <= loc && loc < GetNumberOfConnectivityEntries())
+    VTK_SIZEHINT(pts, npts);
+
+  /**
+   * Get pointer to the cells expressed in the legacy layout. The cells are
+   * exported into an internal array, which then becomes authoritative (see
+   * the class documentation).
+   */
+  vtkIdType *GetPointer();
+
+  /**
+   * Get pointer to data array for purpose of direct writes of data in the
+   * legacy layout. Size is the total storage consumed by the cell array.
+   * ncells is the number of cells represented in the array. The data is
+   * imported the next time the cells are accessed.
+   */
+  vtkIdType *WritePointer(const vtkIdType ncells, const vtkIdType size);
+
+  /**
+   * Define multiple cells by providing a connectivity list. The list is in
+   * the form (npts,p0,p1,...p(npts-1), repeated for each cell). Be careful
+   * using this method because it discards the old cells, and anything
+   * referring these cells becomes invalid (for example, if BuildCells() has
+   * been called see vtkPolyData).  The traversal location is reset to the
+   * beginning of the list. The list is imported the next time the cells are
+   * accessed; prefer ImportLegacyFormat() or SetData().
+   */
+  void SetCells(vtkIdType ncells, vtkIdTypeArray *cells);
+
+  /**
+   * Return the cells expressed in the legacy layout as a data array. See
+   * GetPointer().
+   */
+  vtkIdTypeArray* GetData();
+
 protected:
   vtkCellArray();
   ~vtkCellArray() override;
 
-  vtkIdType NumberOfCells;
-  vtkIdType InsertLocation;     //keep track of current insertion point
-  vtkIdType TraversalLocation;   //keep track of traversal position
-  vtkIdTypeArray *Ia;
+  // State of the legacy data with respect to the offsets/connectivity
+  // storage.
+  enum LegacyStates
+  {
+    LEGACY_NONE = 0,  // no (valid) legacy data
+    LEGACY_SYNCED,    // legacy data mirrors the storage
+    LEGACY_PENDING    // legacy data is authoritative, storage is stale
+  };
+
+  /**
+   * Import pending legacy data, if any. Called by all methods accessing
+   * the offsets/connectivity storage.
+   */
+  void Synchronize()
+  {
+    if (this->LegacyState == LEGACY_PENDING)
+    {
+      this->ImportPendingLegacyData();
+    }
+  }
+
+  /**
+   * Invalidate the legacy mirror after the storage has been modified.
+   */
+  void StorageModified()
+  {
+    if (this->LegacyState == LEGACY_SYNCED)
+    {
+      this->LegacyState = LEGACY_NONE;
+    }
+  }
+
+  void ImportPendingLegacyData();
+  void ExportLegacyData();
+  vtkIdType GetCellIdFromLegacyLocation(vtkIdType loc);
+
+  bool Storage64Bit;
+#ifndef __VTK_WRAP__
+  VisitState<ArrayType32> Storage32;
+  VisitState<ArrayType64> Storage64;
+#endif
+
+  vtkIdType TraversalCellId; //keep track of traversal position
+  vtkIdList *TempCell; // scratch space for the non thread-safe methods
+
+  int LegacyState;
+  vtkIdType LegacyNumberOfCells;
+  bool LegacyDataIsExternal; // LegacyData was provided by SetCells()
+  vtkIdTypeArray *LegacyData;
 
 private:
   vtkCellArray(const vtkCellArray&) = delete;
   void operator=(const vtkCellArray&) = delete;
 };
 
+#ifndef __VTK_WRAP__
+//----------------------------------------------------------------------------
+template <typename Functor, typename... Args>
+inline auto vtkCellArray::Visit(Functor &&functor, Args&&... args)
+  -> decltype(functor(std::declval<VisitState<ArrayType64>&>(),
+                      std::forward<Args>(args)...))
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
+  {
+    return functor(this->Storage64, std::forward<Args>(args)...);
+  }
+  return functor(this->Storage32, std::forward<Args>(args)...);
+}
 
 //----------------------------------------------------------------------------
-inline vtkIdType vtkCellArray::InsertNextCell(vtkIdType npts,
-                                              const vtkIdType pts[]) VTK_SIZEHINT(pts, npts)
+template <typename Functor, typename... Args>
+inline void vtkCellArray::VisitCellAtId(vtkIdType cellId, vtkIdType loc,
+                                        Functor &&functor, Args&&... args)
 {
-  vtkIdType i = this->Ia->GetMaxId() + 1;
-  vtkIdType *ptr = this->Ia->WritePointer(i, npts+1);
+  if (this->LegacyState == LEGACY_PENDING)
+  {
+    const vtkIdType *cell = this->LegacyData->GetPointer(loc);
+    functor(cell[0], cell + 1, std::forward<Args>(args)...);
+  }
+  else if (this->Storage64Bit)
+  {
+    const ArrayType64::ValueType *cellPts =
+      this->Storage64.GetCellPoints(cellId);
+    functor(this->Storage64.GetCellSize(cellId), cellPts,
+            std::forward<Args>(args)...);
+  }
+  else
+  {
+    const ArrayType32::ValueType *cellPts =
+      this->Storage32.GetCellPoints(cellId);
+    functor(this->Storage32.GetCellSize(cellId), cellPts,
+            std::forward<Args>(args)...);
+  }
+}
 
-  for ( *ptr++ = npts, i = 0; i < npts; i++)
+namespace vtkCellArray_detail
+{
+
+struct InsertNextCellImpl
+{
+  template <typename CellStateT>
+  vtkIdType operator()(CellStateT& state, vtkIdType npts,
+                       const vtkIdType pts[])
+  {
+    typedef typename CellStateT::ValueType ValueType;
+    const vtkIdType cellId = state.GetNumberOfCells();
+    const vtkIdType begin = state.GetNumberOfConnectivityIds();
+    if (npts > 0)
+    {
+      ValueType *conn = state.GetConnectivity()->WritePointer(begin, npts);
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        conn[i] = static_cast<ValueType>(pts[i]);
+      }
+    }
+    state.GetOffsets()->InsertNextValue(static_cast<ValueType>(begin + npts));
+    return cellId;
+  }
+
+  // Reserve space for a cell of npts points to be filled with
+  // InsertCellPoint().
+  template <typename CellStateT>
+  vtkIdType operator()(CellStateT& state, vtkIdType npts)
+  {
+    typedef typename CellStateT::ValueType ValueType;
+    const vtkIdType cellId = state.GetNumberOfCells();
+    const vtkIdType begin = state.GetNumberOfConnectivityIds();
+    state.GetOffsets()->InsertNextValue(static_cast<ValueType>(begin + npts));
+    return cellId;
+  }
+};
+
+struct GetCellAtIdImpl
+{
+  // Shareable storage: hand out a pointer into the connectivity array.
+  template <typename CellStateT>
+  typename std::enable_if<
+    std::is_same<typename CellStateT::ValueType, vtkIdType>::value>::type
+  operator()(CellStateT& state, vtkIdType cellId, vtkIdType& npts,
+             vtkIdType const*& pts, vtkIdList* vtkNotUsed(ptIds))
   {
-    *ptr++ = *pts++;
+    const vtkIdType begin = state.GetBeginOffset(cellId);
+    npts = state.GetEndOffset(cellId) - begin;
+    pts = state.GetConnectivity()->GetPointer(begin);
   }
 
-  this->NumberOfCells++;
-  this->InsertLocation += npts + 1;
+  // Otherwise copy into the provided list.
+  template <typename CellStateT>
+  typename std::enable_if<
+    !std::is_same<typename CellStateT::ValueType, vtkIdType>::value>::type
+  operator()(CellStateT& state, vtkIdType cellId, vtkIdType& npts,
+             vtkIdType const*& pts, vtkIdList* ptIds)
+  {
+    const vtkIdType begin = state.GetBeginOffset(cellId);
+    npts = state.GetEndOffset(cellId) - begin;
+    ptIds->SetNumberOfIds(npts);
+    const typename CellStateT::ValueType *conn =
+      state.GetConnectivity()->GetPointer(begin);
+    vtkIdType *ids = ptIds->GetPointer(0);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      ids[i] = static_cast<vtkIdType>(conn[i]);
+    }
+    pts = ids;
+  }
+
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType cellId, vtkIdList* ids)
+  {
+    const vtkIdType begin = state.GetBeginOffset(cellId);
+    const vtkIdType npts = state.GetEndOffset(cellId) - begin;
+    ids->SetNumberOfIds(npts);
+    const typename CellStateT::ValueType *conn =
+      state.GetConnectivity()->GetPointer(begin);
+    std::copy(conn, conn + npts, ids->GetPointer(0));
+  }
+};
+
+// Functors for vtkCellArray::VisitCellAtId().
+struct QueryCellAtIdImpl
+{
+  template <typename ValueType>
+  void operator()(vtkIdType npts, const ValueType *cellPts, vtkIdList *ptIds)
+  {
+    ptIds->SetNumberOfIds(npts);
+    std::copy(cellPts, cellPts + npts, ptIds->GetPointer(0));
+  }
 
-  return this->NumberOfCells - 1;
+  // The ids are already vtkIdType: hand out the pointer.
+  void operator()(vtkIdType cellSize, const vtkIdType *cellPts,
+                  vtkIdType& npts, vtkIdType const*& pts,
+                  vtkIdList* vtkNotUsed(ptIds))
+  {
+    npts = cellSize;
+    pts = cellPts;
+  }
+
+  template <typename ValueType>
+  void operator()(vtkIdType cellSize, const ValueType *cellPts,
+                  vtkIdType& npts, vtkIdType const*& pts, vtkIdList* ptIds)
+  {
+    (*this)(cellSize, cellPts, ptIds);
+    npts = cellSize;
+    pts = ptIds->GetPointer(0);
+  }
+};
+
+} // end namespace vtkCellArray_detail
+#endif // __VTK_WRAP__
+
+//----------------------------------------------------------------------------
+inline vtkIdType vtkCellArray::GetNumberOfCells()
+{
+  if (this->LegacyState == LEGACY_PENDING)
+  {
+    return this->LegacyNumberOfCells;
+  }
+  return this->Storage64Bit ? this->Storage64.GetNumberOfCells() :
+                              this->Storage32.GetNumberOfCells();
 }
 
 //----------------------------------------------------------------------------
-inline vtkIdType vtkCellArray::InsertNextCell(int npts)
+inline vtkIdType vtkCellArray::GetNumberOfConnectivityIds()
 {
-  this->InsertLocation = this->Ia->InsertNextValue(npts) + 1;
-  this->NumberOfCells++;
+  this->Synchronize();
+  return this->Storage64Bit ? this->Storage64.GetNumberOfConnectivityIds() :
+                              this->Storage32.GetNumberOfConnectivityIds();
+}
 
-  return this->NumberOfCells - 1;
+//----------------------------------------------------------------------------
+inline vtkIdType vtkCellArray::GetNumberOfConnectivityEntries()
+{
+  if (this->LegacyState == LEGACY_PENDING)
+  {
+    return this->LegacyData->GetMaxId() + 1;
+  }
+  return this->GetNumberOfConnectivityIds() + this->GetNumberOfCells();
 }
 
 //----------------------------------------------------------------------------
-inline void vtkCellArray::InsertCellPoint(vtkIdType id)
+inline vtkIdType vtkCellArray::GetOffset(vtkIdType cellId)
 {
-  this->Ia->InsertValue(this->InsertLocation++, id);
+  this->Synchronize();
+  return this->Storage64Bit ? this->Storage64.GetBeginOffset(cellId) :
+                              this->Storage32.GetBeginOffset(cellId);
 }
 
 //----------------------------------------------------------------------------
-inline void vtkCellArray::UpdateCellCount(int npts)
+inline vtkIdType vtkCellArray::GetCellSize(vtkIdType cellId)
 {
-  this->Ia->SetValue(this->InsertLocation-npts-1, npts);
+  this->Synchronize();
+  return this->Storage64Bit ? this->Storage64.GetCellSize(cellId) :
+                              this->Storage32.GetCellSize(cellId);
 }
 
 //----------------------------------------------------------------------------
-inline vtkIdType vtkCellArray::InsertNextCell(vtkIdList *pts)
+inline void vtkCellArray::GetCellAtId(vtkIdType cellId, vtkIdType &npts,
+                                      vtkIdType const* &pts, vtkIdList *ptIds)
 {
-  return this->InsertNextCell(pts->GetNumberOfIds(), pts->GetPointer(0));
+  this->Visit(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, npts, pts, ptIds);
 }
 
 //----------------------------------------------------------------------------
-inline vtkIdType vtkCellArray::InsertNextCell(vtkCell *cell)
+inline void vtkCellArray::GetCellAtId(vtkIdType cellId, vtkIdList *pts)
 {
-  return this->InsertNextCell(cell->GetNumberOfPoints(),
-                              cell->PointIds->GetPointer(0));
+  this->Visit(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, pts);
 }
 
 //----------------------------------------------------------------------------
-inline void vtkCellArray::Reset()
+inline void vtkCellArray::GetCellAtId(vtkIdType cellId, vtkIdType &npts,
+                                      vtkIdType const* &pts)
 {
-  this->NumberOfCells = 0;
-  this->InsertLocation = 0;
-  this->TraversalLocation = 0;
-  this->Ia->Reset();
+  this->Visit(vtkCellArray_detail::GetCellAtIdImpl{}, cellId, npts, pts,
+              this->TempCell);
 }
 
 //----------------------------------------------------------------------------
-inline int vtkCellArray::GetNextCell(vtkIdType& npts, vtkIdType* &pts)
+inline void vtkCellArray::QueryCellAtId(vtkIdType cellId, vtkIdType loc,
+                                        vtkIdList *ptIds)
 {
-  if ( this->Ia->GetMaxId() >= 0 &&
-       this->TraversalLocation <= this->Ia->GetMaxId() )
-  {
-    npts = this->Ia->GetValue(this->TraversalLocation++);
-    pts = this->Ia->GetPointer(this->TraversalLocation);
-    this->TraversalLocation += npts;
-    return 1;
-  }
-  npts=0;
-  pts=nullptr;
-  return 0;
+  this->VisitCellAtId(cellId, loc, vtkCellArray_detail::QueryCellAtIdImpl{},
+                      ptIds);
 }
 
 //----------------------------------------------------------------------------
-inline void vtkCellArray::GetCell(vtkIdType loc, vtkIdType &npts,
-                                  vtkIdType* &pts)
+inline void vtkCellArray::QueryCellAtId(vtkIdType cellId, vtkIdType loc,
+                                        vtkIdType &npts, vtkIdType const* &pts,
+                                        vtkIdList *ptIds)
+{
+  this->VisitCellAtId(cellId, loc, vtkCellArray_detail::QueryCellAtIdImpl{},
+                      npts, pts, ptIds);
+}
+
+//----------------------------------------------------------------------------
+inline void vtkCellArray::QueryCellAtId(vtkIdType cellId, vtkIdType loc,
+                                        vtkIdType &npts, vtkIdType const* &pts)
 {
-  npts = this->Ia->GetValue(loc++);
-  pts  = this->Ia->GetPointer(loc);
+  this->QueryCellAtId(cellId, loc, npts, pts, this->TempCell);
 }
 
 //----------------------------------------------------------------------------
-inline void vtkCellArray::ReverseCell(vtkIdType loc)
+inline vtkIdType vtkCellArray::InsertNextCell(vtkIdType npts,
+                                              const vtkIdType pts[]) VTK_SIZEHINT(pts, npts)
 {
-  int i;
-  vtkIdType tmp;
-  vtkIdType npts=this->Ia->GetValue(loc);
-  vtkIdType *pts=this->Ia->GetPointer(loc+1);
-  for (i=0; i < (npts/2); i++)
+  vtkIdType cellId =
+    this->Visit(vtkCellArray_detail::InsertNextCellImpl{}, npts, pts);
+  this->StorageModified();
+  return cellId;
+}
+
+//----------------------------------------------------------------------------
+inline vtkIdType vtkCellArray::InsertNextCell(int npts)
+{
+  vtkIdType cellId = this->Visit(vtkCellArray_detail::InsertNextCellImpl{},
+                                 static_cast<vtkIdType>(npts));
+  this->StorageModified();
+  return cellId;
+}
+
+//----------------------------------------------------------------------------
+inline void vtkCellArray::InsertCellPoint(vtkIdType id)
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
+  {
+    this->Storage64.Connectivity->InsertNextValue(
+      static_cast<ArrayType64::ValueType>(id));
+  }
+  else
+  {
+    this->Storage32.Connectivity->InsertNextValue(
+      static_cast<ArrayType32::ValueType>(id));
+  }
+  this->StorageModified();
+}
+
+//----------------------------------------------------------------------------
+inline void vtkCellArray::UpdateCellCount(int npts)
+{
+  this->Synchronize();
+  if (this->Storage64Bit)
+  {
+    vtkIdType last = this->Storage64.GetNumberOfCells();
+    this->Storage64.Offsets->SetValue(last,
+      this->Storage64.Offsets->GetValue(last-1) + npts);
+  }
+  else
   {
-    tmp = pts[i];
-    pts[i] = pts[npts-i-1];
-    pts[npts-i-1] = tmp;
+    vtkIdType last = this->Storage32.GetNumberOfCells();
+    this->Storage32.Offsets->SetValue(last,
+      this->Storage32.Offsets->GetValue(last-1) + npts);
   }
+  this->StorageModified();
 }
 
 //----------------------------------------------------------------------------
-inline void vtkCellArray::ReplaceCell(vtkIdType loc, int npts,
-                                      const vtkIdType pts[])
+inline vtkIdType vtkCellArray::InsertNextCell(vtkIdList *pts)
+{
+  return this->InsertNextCell(pts->GetNumberOfIds(), pts->GetPointer(0));
+}
+
+//----------------------------------------------------------------------------
+inline vtkIdType vtkCellArray::InsertNextCell(vtkCell *cell)
+{
+  return this->InsertNextCell(cell->GetNumberOfPoints(),
+                              cell->PointIds->GetPointer(0));
+}
+
+//----------------------------------------------------------------------------
+inline int vtkCellArray::GetNextCell(vtkIdType& npts, vtkIdType* &pts)
 {
-  vtkIdType *oldPts=this->Ia->GetPointer(loc+1);
-  for (int i=0; i < npts; i++)
+  if (this->TraversalCellId < this->GetNumberOfCells())
   {
-    oldPts[i] = pts[i];
+    const vtkIdType *cellPts;
+    this->GetCellAtId(this->TraversalCellId++, npts, cellPts);
+    // Shareable storage returns a pointer into the connectivity array,
+    // otherwise the ids live in TempCell: both are writable.
+    pts = const_cast<vtkIdType*>(cellPts);
+    return 1;
   }
+  npts=0;
+  pts=nullptr;
+  return 0;
 }
 
 //----------------------------------------------------------------------------
-inline vtkIdType *vtkCellArray::WritePointer(const vtkIdType ncells,
-                                             const vtkIdType size)
+inline void vtkCellArray::GetCell(vtkIdType loc, vtkIdType &npts,
+                                  vtkIdType* &pts)
 {
-  this->NumberOfCells = ncells;
-  this->InsertLocation = size;
-  this->TraversalLocation = 0;
-  return this->Ia->WritePointer(0,size);
+  const vtkIdType *cellPts;
+  this->GetCellAtId(this->GetCellIdFromLegacyLocation(loc), npts, cellPts);
+  pts = const_cast<vtkIdType*>(cellPts);
 }
 
 #endif
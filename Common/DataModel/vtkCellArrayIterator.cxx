@@ -0,0 +1,61 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCellArrayIterator.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkCellArrayIterator.h"
+
+#include "vtkObjectFactory.h"
+
+vtkStandardNewMacro(vtkCellArrayIterator);
+
+//----------------------------------------------------------------------------
+vtkCellArrayIterator::vtkCellArrayIterator()
+{
+  this->TempCell = vtkIdList::New();
+  this->CurrentCellId = 0;
+  this->NumberOfCells = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkCellArrayIterator::~vtkCellArrayIterator()
+{
+  this->TempCell->Delete();
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArrayIterator::SetCellArray(vtkCellArray *cells)
+{
+  if (this->CellArray != cells)
+  {
+    this->CellArray = cells;
+    this->Modified();
+  }
+  // Make sure that pending legacy data is imported now, so that the
+  // traversal itself never modifies the cell array.
+  this->NumberOfCells = cells ? cells->GetNumberOfCells() : 0;
+  if (cells)
+  {
+    cells->GetNumberOfConnectivityIds();
+  }
+  this->CurrentCellId = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkCellArrayIterator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os,indent);
+
+  os << indent << "Cell Array: " << this->CellArray.Get() << endl;
+  os << indent << "Current Cell Id: " << this->CurrentCellId << endl;
+  os << indent << "Number Of Cells: " << this->NumberOfCells << endl;
+}
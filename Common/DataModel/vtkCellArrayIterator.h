@@ -0,0 +1,148 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkCellArrayIterator.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkCellArrayIterator
+ * @brief   traverse the cells of a vtkCellArray
+ *
+ * vtkCellArrayIterator is a cursor over the cells of a vtkCellArray. Unlike
+ * vtkCellArray::InitTraversal()/GetNextCell(), each iterator owns its
+ * traversal position and scratch space, so several iterators may traverse
+ * the same (unmodified) cell array concurrently. This makes it suitable for
+ * use within vtkSMPTools::For(), where each thread processes a range of
+ * cells:
+ *
+ * \code
+ * void operator()(vtkIdType begin, vtkIdType end)
+ * {
+ *   vtkCellArrayIterator *iter = this->Iterator.Local(); // thread local
+ *   vtkIdType npts;
+ *   const vtkIdType *pts;
+ *   for (iter->GoToCell(begin); iter->GetCurrentCellId() < end;
+ *        iter->GoToNextCell())
+ *   {
+ *     iter->GetCurrentCell(npts, pts);
+ *     ...
+ *   }
+ * }
+ * \endcode
+ *
+ * Iterators are created with vtkCellArray::NewIterator().
+ *
+ * @sa
+ * vtkCellArray
+*/
+
+#ifndef vtkCellArrayIterator_h
+#define vtkCellArrayIterator_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include "vtkCellArray.h" // Needed for inline methods
+#include "vtkIdList.h" // Needed for inline methods
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+
+class VTKCOMMONDATAMODEL_EXPORT vtkCellArrayIterator : public vtkObject
+{
+public:
+  //@{
+  /**
+   * Standard methods for instantiation, type information, and printing.
+   */
+  static vtkCellArrayIterator *New();
+  vtkTypeMacro(vtkCellArrayIterator,vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  //@}
+
+  //@{
+  /**
+   * Specify the cell array to traverse. The traversal is reset to the
+   * first cell.
+   */
+  void SetCellArray(vtkCellArray *cells);
+  vtkCellArray *GetCellArray()
+    {return this->CellArray;}
+  //@}
+
+  /**
+   * Position the iterator on cell cellId.
+   */
+  void GoToCell(vtkIdType cellId)
+    {this->CurrentCellId = cellId;}
+
+  /**
+   * Position the iterator on the first cell.
+   */
+  void GoToFirstCell()
+    {this->CurrentCellId = 0;}
+
+  /**
+   * Advance the iterator to the next cell.
+   */
+  void GoToNextCell()
+    {++this->CurrentCellId;}
+
+  /**
+   * Return true if the iterator is past the last cell.
+   */
+  bool IsDoneWithTraversal()
+    {return this->CurrentCellId >= this->NumberOfCells;}
+
+  /**
+   * Return the id of the current cell.
+   */
+  vtkIdType GetCurrentCellId() const
+    {return this->CurrentCellId;}
+
+  /**
+   * Get the points of the current cell. The returned pointer is valid until
+   * the iterator is used again (or the cell array is modified).
+   */
+  void GetCurrentCell(vtkIdType &npts, vtkIdType const* &pts)
+    VTK_SIZEHINT(pts, npts)
+    {
+    this->CellArray->GetCellAtId(this->CurrentCellId, npts, pts,
+                                 this->TempCell);
+    }
+
+  /**
+   * Copy the points of the current cell into ids.
+   */
+  void GetCurrentCell(vtkIdList *ids)
+    {this->CellArray->GetCellAtId(this->CurrentCellId, ids);}
+
+  /**
+   * Random access to the points of any cell, using the scratch space of
+   * this iterator. The traversal position is left unchanged.
+   */
+  void GetCellAtId(vtkIdType cellId, vtkIdType &npts, vtkIdType const* &pts)
+    VTK_SIZEHINT(pts, npts)
+    {this->CellArray->GetCellAtId(cellId, npts, pts, this->TempCell);}
+
+protected:
+  vtkCellArrayIterator();
+  ~vtkCellArrayIterator() override;
+
+  vtkSmartPointer<vtkCellArray> CellArray;
+  vtkIdList *TempCell;
+  vtkIdType CurrentCellId;
+  vtkIdType NumberOfCells;
+
+private:
+  vtkCellArrayIterator(const vtkCellArrayIterator&) = delete;
+  void operator=(const vtkCellArrayIterator&) = delete;
+};
+
+#endif
@@ -249,7 +249,10 @@ void vtkExplicitStructuredGrid::GetPointCells(vtkIdType ptId, vtkIdList* cellIds
 //----------------------------------------------------------------------------
 vtkIdType* vtkExplicitStructuredGrid::GetCellPoints(vtkIdType cellId)
 {
-  return this->Cells->GetData()->GetPointer(cellId * 9) + 1;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  this->Cells->GetCellAtId(cellId, npts, pts);
+  return const_cast<vtkIdType*>(pts);
 }
 
 //----------------------------------------------------------------------------
@@ -1224,7 +1227,7 @@ void vtkExplicitStructuredGrid::ReorderCellsPoints(const int* ptsMap, const int
           std::swap(ptsTmp, ptsTmp2);
         }
       }
-      cells->ReplaceCell(cellId * 9, 8, ptsTmp);
+      cells->ReplaceCellAtId(cellId, 8, ptsTmp);
       this->GetCellPoints(cellId, npts, pts);
     }
   }
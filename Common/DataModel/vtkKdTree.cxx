@@ -116,6 +116,34 @@ static void LastInputDeletedCallback(vtkObject * vtkNotUsed(caller),
 // helper class for ordering the points in vtkKdTree::FindClosestNPoints()
 namespace
 {
+  // Collect the ids of the regions below node whose data bounds intersect
+  // the sphere, like vtkBSPIntersections::IntersectsSphere2() does.
+  int IntersectsSphere2UsingDataBounds(vtkKdNode *node, int *ids, int len,
+    double x, double y, double z, double rSquared)
+  {
+    if (!node->IntersectsSphere2(x, y, z, rSquared, 1))
+    {
+      return 0;
+    }
+
+    if (node->GetLeft() == nullptr)
+    {
+      ids[0] = node->GetID();
+      return 1;
+    }
+
+    int nnodes1 = IntersectsSphere2UsingDataBounds(node->GetLeft(), ids, len,
+                                                   x, y, z, rSquared);
+    int nnodes2 = 0;
+    if (len - nnodes1 > 0)
+    {
+      nnodes2 = IntersectsSphere2UsingDataBounds(node->GetRight(),
+        ids + nnodes1, len - nnodes1, x, y, z, rSquared);
+    }
+
+    return nnodes1 + nnodes2;
+  }
+
   class OrderPoints
   {
   public:
@@ -2380,12 +2408,11 @@ int vtkKdTree::FindClosestPointInSphere(double x, double y, double z,
   }
   int *regionIds = new int [this->NumberOfRegions];
 
-  this->BSPCalculator->ComputeIntersectionsUsingDataBoundsOn();
-
-  int nRegions =
-    this->BSPCalculator->IntersectsSphere2(regionIds, this->NumberOfRegions, x, y, z, radius*radius);
-
-  this->BSPCalculator->ComputeIntersectionsUsingDataBoundsOff();
+  // The regions are found with the data bounds by a traversal of the tree
+  // rather than with the BSPCalculator, so that the query does not modify
+  // the state of the tree and stays thread safe.
+  int nRegions = IntersectsSphere2UsingDataBounds(this->Top, regionIds,
+    this->NumberOfRegions, x, y, z, radius*radius);
 
   double minDistance2 = 4 * this->MaxWidth * this->MaxWidth;
   int localCloseId = -1;
@@ -85,6 +85,12 @@ public:
   void GenerateRepresentation(int level, vtkPolyData *pd) override;
   //@}
 
+  /**
+   * The queries are thread safe once the locator is built, so the batched
+   * queries of vtkAbstractPointLocator are processed in parallel.
+   */
+  bool HasThreadSafeQueries() override { return true; }
+
 protected:
   vtkKdTreePointLocator();
   ~vtkKdTreePointLocator() override;
@@ -146,6 +146,14 @@ public:
    */
   virtual void FreeSearchStructure() = 0;
 
+  /**
+   * Return whether the queries of the locator are thread safe once
+   * BuildLocator() has been called from a single thread. The batched queries
+   * of vtkAbstractPointLocator and vtkAbstractCellLocator are processed in
+   * parallel by the locators that return true. False by default.
+   */
+  virtual bool HasThreadSafeQueries() { return false; }
+
   /**
    * Method to build a representation at a particular level. Note that the
    * method GetLevel() returns the maximum number of levels available for
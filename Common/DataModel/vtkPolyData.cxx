@@ -60,7 +60,7 @@ vtkPolyData::vtkPolyData () :
   Vertex(nullptr), PolyVertex(nullptr), Line(nullptr), PolyLine(nullptr),
   Triangle(nullptr), Quad(nullptr), Polygon(nullptr), TriangleStrip(nullptr),
   EmptyCell(nullptr), Verts(nullptr), Lines(nullptr), Polys(nullptr),
-  Strips(nullptr), Cells(nullptr), Links(nullptr)
+  Strips(nullptr), Cells(nullptr), Links(nullptr), LegacyCell(nullptr)
 {
   this->Information->Set(vtkDataObject::DATA_EXTENT_TYPE(), VTK_PIECES_EXTENT);
   this->Information->Set(vtkDataObject::DATA_PIECE_NUMBER(), -1);
@@ -117,6 +117,11 @@ vtkPolyData::~vtkPolyData()
   {
     this->EmptyCell->Delete();
   }
+
+  if (this->LegacyCell)
+  {
+    this->LegacyCell->Delete();
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -223,7 +228,8 @@ int vtkPolyData::GetCellType(vtkIdType cellId)
 vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
 {
   vtkIdType i, loc;
-  vtkIdType *pts, numPts;
+  const vtkIdType *pts;
+  vtkIdType numPts;
   vtkCell *cell = nullptr;
   unsigned char type;
 
@@ -243,7 +249,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->Vertex = vtkVertex::New();
       }
       cell = this->Vertex;
-      this->Verts->GetCell(loc,numPts,pts);
+      this->Verts->GetCellAtId(loc,numPts,pts);
       break;
 
     case VTK_POLY_VERTEX:
@@ -252,7 +258,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->PolyVertex = vtkPolyVertex::New();
       }
       cell = this->PolyVertex;
-      this->Verts->GetCell(loc,numPts,pts);
+      this->Verts->GetCellAtId(loc,numPts,pts);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
@@ -263,7 +269,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->Line = vtkLine::New();
       }
       cell = this->Line;
-      this->Lines->GetCell(loc,numPts,pts);
+      this->Lines->GetCellAtId(loc,numPts,pts);
       break;
 
     case VTK_POLY_LINE:
@@ -272,7 +278,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->PolyLine = vtkPolyLine::New();
       }
       cell = this->PolyLine;
-      this->Lines->GetCell(loc,numPts,pts);
+      this->Lines->GetCellAtId(loc,numPts,pts);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
@@ -283,7 +289,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->Triangle = vtkTriangle::New();
       }
       cell = this->Triangle;
-      this->Polys->GetCell(loc,numPts,pts);
+      this->Polys->GetCellAtId(loc,numPts,pts);
       break;
 
     case VTK_QUAD:
@@ -292,7 +298,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->Quad = vtkQuad::New();
       }
       cell = this->Quad;
-      this->Polys->GetCell(loc,numPts,pts);
+      this->Polys->GetCellAtId(loc,numPts,pts);
       break;
 
     case VTK_POLYGON:
@@ -301,7 +307,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->Polygon = vtkPolygon::New();
       }
       cell = this->Polygon;
-      this->Polys->GetCell(loc,numPts,pts);
+      this->Polys->GetCellAtId(loc,numPts,pts);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
@@ -312,7 +318,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
         this->TriangleStrip = vtkTriangleStrip::New();
       }
       cell = this->TriangleStrip;
-      this->Strips->GetCell(loc,numPts,pts);
+      this->Strips->GetCellAtId(loc,numPts,pts);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
@@ -339,7 +345,7 @@ vtkCell *vtkPolyData::GetCell(vtkIdType cellId)
 void vtkPolyData::GetCell(vtkIdType cellId, vtkGenericCell *cell)
 {
   vtkIdType       i, loc;
-  vtkIdType       *pts=nullptr;
+  const vtkIdType *pts=nullptr;
   vtkIdType       numPts;
   unsigned char   type;
   double           x[3];
@@ -352,52 +358,54 @@ void vtkPolyData::GetCell(vtkIdType cellId, vtkGenericCell *cell)
   type = this->Cells->GetCellType(cellId);
   loc = this->Cells->GetCellLocation(cellId);
 
+  // The ids are copied into the cell's own id list (unless they can be
+  // shared), so that concurrent calls do not share any scratch space.
   switch (type)
   {
     case VTK_VERTEX:
       cell->SetCellTypeToVertex();
-      this->Verts->GetCell(loc,numPts,pts);
+      this->Verts->GetCellAtId(loc,numPts,pts,cell->PointIds);
       break;
 
     case VTK_POLY_VERTEX:
       cell->SetCellTypeToPolyVertex();
-      this->Verts->GetCell(loc,numPts,pts);
+      this->Verts->GetCellAtId(loc,numPts,pts,cell->PointIds);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
 
     case VTK_LINE:
       cell->SetCellTypeToLine();
-      this->Lines->GetCell(loc,numPts,pts);
+      this->Lines->GetCellAtId(loc,numPts,pts,cell->PointIds);
       break;
 
     case VTK_POLY_LINE:
       cell->SetCellTypeToPolyLine();
-      this->Lines->GetCell(loc,numPts,pts);
+      this->Lines->GetCellAtId(loc,numPts,pts,cell->PointIds);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
 
     case VTK_TRIANGLE:
       cell->SetCellTypeToTriangle();
-      this->Polys->GetCell(loc,numPts,pts);
+      this->Polys->GetCellAtId(loc,numPts,pts,cell->PointIds);
       break;
 
     case VTK_QUAD:
       cell->SetCellTypeToQuad();
-      this->Polys->GetCell(loc,numPts,pts);
+      this->Polys->GetCellAtId(loc,numPts,pts,cell->PointIds);
       break;
 
     case VTK_POLYGON:
       cell->SetCellTypeToPolygon();
-      this->Polys->GetCell(loc,numPts,pts);
+      this->Polys->GetCellAtId(loc,numPts,pts,cell->PointIds);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
 
     case VTK_TRIANGLE_STRIP:
       cell->SetCellTypeToTriangleStrip();
-      this->Strips->GetCell(loc,numPts,pts);
+      this->Strips->GetCellAtId(loc,numPts,pts,cell->PointIds);
       cell->PointIds->SetNumberOfIds(numPts); //reset number of points
       cell->Points->SetNumberOfPoints(numPts);
       break;
@@ -489,15 +497,58 @@ void vtkPolyData::CopyCells(vtkPolyData *pd, vtkIdList *idList,
   cell->Delete();
 }
 
+//----------------------------------------------------------------------------
+namespace
+{
+// Support GetCellBounds(): read the typed point ids of the cell in place, so
+// that no scratch id list is needed.
+struct CellBoundsImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType cellId, vtkPoints *points,
+                  double bounds[6])
+  {
+    const vtkIdType numPts = state.GetCellSize(cellId);
+    const typename CellStateT::ValueType *pts = state.GetCellPoints(cellId);
+    double x[3];
+
+    // carefully compute the bounds
+    if (numPts)
+    {
+      points->GetPoint( pts[0], x );
+      bounds[0] = x[0];
+      bounds[2] = x[1];
+      bounds[4] = x[2];
+      bounds[1] = x[0];
+      bounds[3] = x[1];
+      bounds[5] = x[2];
+      for (vtkIdType i=1; i < numPts; i++)
+      {
+        points->GetPoint( pts[i], x );
+        bounds[0] = (x[0] < bounds[0] ? x[0] : bounds[0]);
+        bounds[1] = (x[0] > bounds[1] ? x[0] : bounds[1]);
+        bounds[2] = (x[1] < bounds[2] ? x[1] : bounds[2]);
+        bounds[3] = (x[1] > bounds[3] ? x[1] : bounds[3]);
+        bounds[4] = (x[2] < bounds[4] ? x[2] : bounds[4]);
+        bounds[5] = (x[2] > bounds[5] ? x[2] : bounds[5]);
+      }
+    }
+    else
+    {
+      vtkMath::UninitializeBounds(bounds);
+    }
+  }
+};
+} // anonymous namespace
+
 //----------------------------------------------------------------------------
 // Fast implementation of GetCellBounds().  Bounds are calculated without
 // constructing a cell.
 void vtkPolyData::GetCellBounds(vtkIdType cellId, double bounds[6])
 {
-  vtkIdType i, loc;
-  vtkIdType *pts, numPts;
+  vtkIdType loc;
   unsigned char type;
-  double x[3];
+  vtkCellArray *cells;
 
   if ( !this->Cells )
   {
@@ -511,22 +562,22 @@ void vtkPolyData::GetCellBounds(vtkIdType cellId, double bounds[6])
   {
     case VTK_VERTEX:
     case VTK_POLY_VERTEX:
-      this->Verts->GetCell(loc,numPts,pts);
+      cells = this->Verts;
       break;
 
     case VTK_LINE:
     case VTK_POLY_LINE:
-      this->Lines->GetCell(loc,numPts,pts);
+      cells = this->Lines;
       break;
 
     case VTK_TRIANGLE:
     case VTK_QUAD:
     case VTK_POLYGON:
-      this->Polys->GetCell(loc,numPts,pts);
+      cells = this->Polys;
       break;
 
     case VTK_TRIANGLE_STRIP:
-      this->Strips->GetCell(loc,numPts,pts);
+      cells = this->Strips;
       break;
 
     default:
@@ -535,31 +586,7 @@ void vtkPolyData::GetCellBounds(vtkIdType cellId, double bounds[6])
       return;
   }
 
-  // carefully compute the bounds
-  if (numPts)
-  {
-    this->Points->GetPoint( pts[0], x );
-    bounds[0] = x[0];
-    bounds[2] = x[1];
-    bounds[4] = x[2];
-    bounds[1] = x[0];
-    bounds[3] = x[1];
-    bounds[5] = x[2];
-    for (i=1; i < numPts; i++)
-    {
-      this->Points->GetPoint( pts[i], x );
-      bounds[0] = (x[0] < bounds[0] ? x[0] : bounds[0]);
-      bounds[1] = (x[0] > bounds[1] ? x[0] : bounds[1]);
-      bounds[2] = (x[1] < bounds[2] ? x[1] : bounds[2]);
-      bounds[3] = (x[1] > bounds[3] ? x[1] : bounds[3]);
-      bounds[4] = (x[2] < bounds[4] ? x[2] : bounds[4]);
-      bounds[5] = (x[2] > bounds[5] ? x[2] : bounds[5]);
-    }
-  }
-  else
-  {
-    vtkMath::UninitializeBounds(bounds);
-  }
+  cells->Visit(CellBoundsImpl{}, loc, this->Points, bounds);
 }
 
 
@@ -947,103 +974,55 @@ void vtkPolyData::BuildCells()
   vtkIdTypeArray *locs = vtkIdTypeArray::New();
   vtkIdType *pLocs = locs->WritePointer(0, nCells);
 
-  // record locations and type of each cell.
+  // record the location (the cell id within its vtkCellArray) and the type
+  // of each cell. The cell sizes are read from the offsets, so no pass over
+  // the connectivity is required.
   // verts
-  vtkIdType numCellPts;
-  vtkIdType nextCellPts;
-  if (nVerts)
-  {
-    vtkIdType *pVerts = vertCells->GetData()->GetPointer(0);
-    numCellPts = pVerts[0];
-    nextCellPts = numCellPts + 1;
-    pLocs[0] = 0;
-    pTypes[0] = numCellPts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX;
-    for (vtkIdType i = 1; i < nVerts; ++i)
-    {
-      numCellPts = pVerts[nextCellPts];
-      pLocs[i] = nextCellPts;
-      pTypes[i] = numCellPts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX;
-      nextCellPts += numCellPts + 1;
-    }
-    pLocs += nVerts;
-    pTypes += nVerts;
+  for (vtkIdType i = 0; i < nVerts; ++i)
+  {
+    pLocs[i] = i;
+    pTypes[i] = vertCells->GetCellSize(i) > 1 ? VTK_POLY_VERTEX : VTK_VERTEX;
   }
+  pLocs += nVerts;
+  pTypes += nVerts;
 
   // lines
-  if (nLines)
+  for (vtkIdType i = 0; i < nLines; ++i)
   {
-    vtkIdType *pLines = lineCells->GetData()->GetPointer(0);
-    numCellPts = pLines[0];
-    pLocs[0] = 0;
-    pTypes[0] = numCellPts > 2 ? VTK_POLY_LINE : VTK_LINE;
+    vtkIdType numCellPts = lineCells->GetCellSize(i);
+    pLocs[i] = i;
+    pTypes[i] = numCellPts > 2 ? VTK_POLY_LINE : VTK_LINE;
     if (numCellPts == 1)
     {
-      vtkWarningMacro("Building VTK_LINE 0 with only one point, but VTK_LINE "
-      "needs at least two points. Check the input.");
+      vtkWarningMacro("Building VTK_LINE " << i <<" with only one point, but "
+      "VTK_LINE needs at least two points. Check the input.");
     }
-    nextCellPts = numCellPts + 1;
-    for (vtkIdType i = 1; i < nLines; ++i)
-    {
-      numCellPts = pLines[nextCellPts];
-      pLocs[i] = nextCellPts;
-      pTypes[i] = numCellPts > 2 ? VTK_POLY_LINE : VTK_LINE;
-      if (numCellPts == 1)
-      {
-        vtkWarningMacro("Building VTK_LINE " << i <<" with only one point, but "
-        "VTK_LINE needs at least two points. Check the input.");
-      }
-      nextCellPts += numCellPts + 1;
-    }
-    pLocs += nLines;
-    pTypes += nLines;
   }
+  pLocs += nLines;
+  pTypes += nLines;
 
   // polys
-  if (nPolys)
+  for (vtkIdType i = 0; i < nPolys; ++i)
   {
-    vtkIdType *pPolys = polyCells->GetData()->GetPointer(0);
-    numCellPts = pPolys[0];
-    pLocs[0] = 0;
+    vtkIdType numCellPts = polyCells->GetCellSize(i);
+    pLocs[i] = i;
     if (numCellPts < 3)
     {
-      vtkWarningMacro("Building VTK_TRIANGLE 0 with less than three points, but"
-      " VTK_TRIANGLE needs at least three points. Check the input.");
+      vtkWarningMacro("Building VTK_TRIANGLE "<< i << " with less than three "
+      "points, but VTK_TRIANGLE needs at least three points. "
+      "Check the input.");
     }
-    pTypes[0] = numCellPts == 3 ? VTK_TRIANGLE :
+    pTypes[i] = numCellPts == 3 ? VTK_TRIANGLE :
       numCellPts == 4 ? VTK_QUAD : VTK_POLYGON;
-    nextCellPts = numCellPts + 1;
-    for (vtkIdType i = 1; i < nPolys; ++i)
-    {
-      numCellPts = pPolys[nextCellPts];
-      pLocs[i] = nextCellPts;
-      if (numCellPts < 3)
-      {
-        vtkWarningMacro("Building VTK_TRIANGLE "<< i << " with less than three "
-        "points, but VTK_TRIANGLE needs at least three points. "
-        "Check the input.");
-      }
-      pTypes[i] = numCellPts == 3 ? VTK_TRIANGLE :
-        numCellPts == 4 ? VTK_QUAD : VTK_POLYGON;
-      nextCellPts += numCellPts + 1;
-    }
-    pLocs += nPolys;
-    pTypes += nPolys;
   }
+  pLocs += nPolys;
+  pTypes += nPolys;
 
   // strips
-  if (nStrips)
-  {
-    std::fill_n(pTypes, nStrips, VTK_TRIANGLE_STRIP);
-    vtkIdType *pStrips = stripCells->GetData()->GetPointer(0);
-    numCellPts = pStrips[0];
-    pLocs[0] = 0;
-    nextCellPts = numCellPts + 1;
-    for (vtkIdType i = 1; i < nStrips; ++i)
-    {
-      numCellPts = pStrips[nextCellPts];
-      pLocs[i] = nextCellPts;
-      nextCellPts += numCellPts + 1;
-    }
+  std::fill_n(pTypes, nStrips, VTK_TRIANGLE_STRIP);
+  for (vtkIdType i = 0; i < nStrips; ++i)
+  {
+    pLocs[i] = i;
   }
 
   // set up the cell types data structure
@@ -1096,31 +1075,40 @@ void vtkPolyData::BuildLinks(int initialSize)
 }
 
 //----------------------------------------------------------------------------
-// Copy a cells point ids into list provided. (Less efficient.)
+// Copy a cells point ids into list provided. (Less efficient.) This is
+// thread safe once the cells have been built, as long as each thread uses
+// its own ptIds.
 void vtkPolyData::GetCellPoints(vtkIdType cellId, vtkIdList *ptIds)
 {
-  vtkIdType i;
-  vtkIdType *pts, npts;
-
   ptIds->Reset();
   if ( this->Cells == nullptr )
   {
     this->BuildCells();
   }
 
-  this->vtkPolyData::GetCellPoints(cellId, npts, pts);
-  if ( npts < 1 )
-  {
-    ptIds->Reset();
-  }
-  else
+  vtkCellArray *cells;
+  switch (this->Cells->GetCellType(cellId))
   {
-    ptIds->InsertId(npts-1,pts[npts-1]);
-    for (i=0; i<npts-1; i++)
-    {
-      ptIds->SetId(i,pts[i]);
-    }
+    case VTK_VERTEX: case VTK_POLY_VERTEX:
+      cells = this->Verts;
+      break;
+
+    case VTK_LINE: case VTK_POLY_LINE:
+      cells = this->Lines;
+      break;
+
+    case VTK_TRIANGLE: case VTK_QUAD: case VTK_POLYGON:
+      cells = this->Polys;
+      break;
+
+    case VTK_TRIANGLE_STRIP:
+      cells = this->Strips;
+      break;
+
+    default:
+      return;
   }
+  cells->GetCellAtId(this->Cells->GetCellLocation(cellId), ptIds);
 }
 
 //----------------------------------------------------------------------------
@@ -1265,19 +1253,19 @@ vtkIdType vtkPolyData::InsertNextCell(int type, int npts, const vtkIdType pts[])
     case VTK_VERTEX: case VTK_POLY_VERTEX:
       this->Verts->InsertNextCell(npts,pts);
       id = this->Cells->InsertNextCell(type,
-                                       this->Verts->GetInsertLocation(npts));
+                                       this->Verts->GetNumberOfCells() - 1);
       break;
 
     case VTK_LINE: case VTK_POLY_LINE:
       this->Lines->InsertNextCell(npts,pts);
       id = this->Cells->InsertNextCell(type,
-                                       this->Lines->GetInsertLocation(npts));
+                                       this->Lines->GetNumberOfCells() - 1);
       break;
 
     case VTK_TRIANGLE: case VTK_QUAD: case VTK_POLYGON:
       this->Polys->InsertNextCell(npts,pts);
       id = this->Cells->InsertNextCell(type,
-                                       this->Polys->GetInsertLocation(npts));
+                                       this->Polys->GetNumberOfCells() - 1);
       break;
 
     case VTK_PIXEL: //need to rearrange vertices
@@ -1289,14 +1277,14 @@ vtkIdType vtkPolyData::InsertNextCell(int type, int npts, const vtkIdType pts[])
       pixPts[3] = pts[2];
       this->Polys->InsertNextCell(npts,pixPts);
       id = this->Cells->InsertNextCell(VTK_QUAD,
-                                       this->Polys->GetInsertLocation(npts));
+                                       this->Polys->GetNumberOfCells() - 1);
       break;
     }
 
     case VTK_TRIANGLE_STRIP:
       this->Strips->InsertNextCell(npts,pts);
       id = this->Cells->InsertNextCell(type,
-                                       this->Strips->GetInsertLocation(npts));
+                                       this->Strips->GetNumberOfCells() - 1);
       break;
 
     default:
@@ -1315,7 +1303,6 @@ vtkIdType vtkPolyData::InsertNextCell(int type, int npts, const vtkIdType pts[])
 vtkIdType vtkPolyData::InsertNextCell(int type, vtkIdList *pts)
 {
   vtkIdType id;
-  vtkIdType npts = pts->GetNumberOfIds();
 
   if ( !this->Cells )
   {
@@ -1327,17 +1314,17 @@ vtkIdType vtkPolyData::InsertNextCell(int type, vtkIdList *pts)
   {
     case VTK_VERTEX: case VTK_POLY_VERTEX:
       this->Verts->InsertNextCell(pts);
-      id = this->Cells->InsertNextCell(type, this->Verts->GetInsertLocation(npts));
+      id = this->Cells->InsertNextCell(type, this->Verts->GetNumberOfCells() - 1);
       break;
 
     case VTK_LINE: case VTK_POLY_LINE:
       this->Lines->InsertNextCell(pts);
-      id = this->Cells->InsertNextCell(type, this->Lines->GetInsertLocation(npts));
+      id = this->Cells->InsertNextCell(type, this->Lines->GetNumberOfCells() - 1);
       break;
 
     case VTK_TRIANGLE: case VTK_QUAD: case VTK_POLYGON:
       this->Polys->InsertNextCell(pts);
-      id = this->Cells->InsertNextCell(type, this->Polys->GetInsertLocation(npts));
+      id = this->Cells->InsertNextCell(type, this->Polys->GetNumberOfCells() - 1);
       break;
 
     case VTK_PIXEL: //need to rearrange vertices
@@ -1348,13 +1335,13 @@ vtkIdType vtkPolyData::InsertNextCell(int type, vtkIdList *pts)
       pixPts[2] = pts->GetId(3);
       pixPts[3] = pts->GetId(2);
       this->Polys->InsertNextCell(4,pixPts);
-      id = this->Cells->InsertNextCell(VTK_QUAD, this->Polys->GetInsertLocation(npts));
+      id = this->Cells->InsertNextCell(VTK_QUAD, this->Polys->GetNumberOfCells() - 1);
       break;
     }
 
     case VTK_TRIANGLE_STRIP:
       this->Strips->InsertNextCell(pts);
-      id = this->Cells->InsertNextCell(type, this->Strips->GetInsertLocation(npts));
+      id = this->Cells->InsertNextCell(type, this->Strips->GetNumberOfCells() - 1);
       break;
 
     case VTK_EMPTY_CELL:
@@ -1441,19 +1428,19 @@ void vtkPolyData::ReverseCell(vtkIdType cellId)
   switch (type)
   {
     case VTK_VERTEX: case VTK_POLY_VERTEX:
-     this->Verts->ReverseCell(loc);
+     this->Verts->ReverseCellAtId(loc);
      break;
 
     case VTK_LINE: case VTK_POLY_LINE:
-      this->Lines->ReverseCell(loc);
+      this->Lines->ReverseCellAtId(loc);
       break;
 
     case VTK_TRIANGLE: case VTK_QUAD: case VTK_POLYGON:
-      this->Polys->ReverseCell(loc);
+      this->Polys->ReverseCellAtId(loc);
       break;
 
     case VTK_TRIANGLE_STRIP:
-      this->Strips->ReverseCell(loc);
+      this->Strips->ReverseCellAtId(loc);
       break;
 
     default:
@@ -1540,19 +1527,19 @@ void vtkPolyData::ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
   switch (type)
   {
     case VTK_VERTEX: case VTK_POLY_VERTEX:
-     this->Verts->ReplaceCell(loc,npts,pts);
+     this->Verts->ReplaceCellAtId(loc,npts,pts);
      break;
 
     case VTK_LINE: case VTK_POLY_LINE:
-      this->Lines->ReplaceCell(loc,npts,pts);
+      this->Lines->ReplaceCellAtId(loc,npts,pts);
       break;
 
     case VTK_TRIANGLE: case VTK_QUAD: case VTK_POLYGON:
-      this->Polys->ReplaceCell(loc,npts,pts);
+      this->Polys->ReplaceCellAtId(loc,npts,pts);
       break;
 
     case VTK_TRIANGLE_STRIP:
-      this->Strips->ReplaceCell(loc,npts,pts);
+      this->Strips->ReplaceCellAtId(loc,npts,pts);
       break;
 
     default:
@@ -1575,19 +1562,19 @@ void vtkPolyData::ReplaceLinkedCell(vtkIdType cellId, int npts, const vtkIdType
   switch (type)
   {
     case VTK_VERTEX: case VTK_POLY_VERTEX:
-     this->Verts->ReplaceCell(loc,npts,pts);
+     this->Verts->ReplaceCellAtId(loc,npts,pts);
      break;
 
     case VTK_LINE: case VTK_POLY_LINE:
-      this->Lines->ReplaceCell(loc,npts,pts);
+      this->Lines->ReplaceCellAtId(loc,npts,pts);
       break;
 
     case VTK_TRIANGLE: case VTK_QUAD: case VTK_POLYGON:
-      this->Polys->ReplaceCell(loc,npts,pts);
+      this->Polys->ReplaceCellAtId(loc,npts,pts);
       break;
 
     case VTK_TRIANGLE_STRIP:
-      this->Strips->ReplaceCell(loc,npts,pts);
+      this->Strips->ReplaceCellAtId(loc,npts,pts);
       break;
 
     default:
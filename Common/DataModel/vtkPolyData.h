@@ -318,10 +318,11 @@ public:
       vtkIdType& npts, vtkIdType* &pts) VTK_SIZEHINT(pts, npts);
 
   /**
-   * Get a pointer to the cell, ie [npts pid1 .. pidn]. More efficient
-   * because pointer points directly to cell array internals and this
-   * is not a virtual call. However, this requires that cells have been
-   * built (with BuildCells()). The cell type is returned.
+   * Get a pointer to the cell, ie [npts pid1 .. pidn]. The cell is copied
+   * in this layout to a scratch list of the poly data, so the returned
+   * pointer is valid until the next call, and this method is not thread
+   * safe. This requires that cells have been built (with BuildCells()).
+   * The cell type is returned.
    */
   unsigned char GetCell(vtkIdType cellId, vtkIdType* &pts);
 
@@ -590,6 +591,7 @@ protected:
   // built only when necessary
   vtkCellTypes *Cells; //enables random access to cells
   vtkCellLinks *Links; //topological links from points to cells using each point
+  vtkIdList *LegacyCell; //[npts pid1 .. pidn] returned by GetCell(cellId, cell)
 
 private:
   // Hide these from the user and the compiler.
@@ -753,8 +755,9 @@ inline unsigned char vtkPolyData::GetCellPoints(
       pts = nullptr;
       return 0;
   }
-  vtkIdType loc = this->Cells->GetCellLocation(cellId);
-  cells->GetCell(loc, npts, pts);
+  const vtkIdType *cellPts;
+  cells->GetCellAtId(this->Cells->GetCellLocation(cellId), npts, cellPts);
+  pts = const_cast<vtkIdType*>(cellPts);
   return type;
 }
 
@@ -786,8 +789,19 @@ inline unsigned char vtkPolyData::GetCell(
       cell = nullptr;
       return 0;
   }
-  vtkIdType loc = this->Cells->GetCellLocation(cellId);
-  cell = cells->GetData()->GetPointer(loc);
+  // Copy the cell size followed by the point ids, leaving the cell array in
+  // its offsets/connectivity storage.
+  vtkIdType npts;
+  const vtkIdType *pts;
+  cells->GetCellAtId(this->Cells->GetCellLocation(cellId), npts, pts);
+  if (!this->LegacyCell)
+  {
+    this->LegacyCell = vtkIdList::New();
+  }
+  this->LegacyCell->SetNumberOfIds(npts + 1);
+  cell = this->LegacyCell->GetPointer(0);
+  cell[0] = npts;
+  std::copy(pts, pts + npts, cell + 1);
   return type;
 }
 
@@ -23,6 +23,7 @@
 #include "vtkUnstructuredGrid.h"
 #include "vtkExplicitStructuredGrid.h"
 #include "vtkSMPTools.h"
+#include <algorithm>
 #include <array>
 #include <atomic>
 
@@ -164,6 +165,51 @@ BuildLinks(vtkDataSet *ds)
   cellPts->Delete();
 }
 
+//----------------------------------------------------------------------------
+// Functors visiting the offsets/connectivity storage of vtkCellArray. The
+// point ids of all cells are contiguous in the connectivity array, so point
+// uses can be counted without traversing the cells one by one.
+
+namespace { //anonymous
+
+struct CountPointUses
+{
+  template <typename CellStateT, typename TIds>
+  void operator()(CellStateT& state, TIds *counts)
+  {
+    const vtkIdType numIds = state.GetNumberOfConnectivityIds();
+    const auto *conn = state.GetConnectivity()->GetPointer(0);
+    for (vtkIdType i=0; i < numIds; ++i)
+    {
+      counts[conn[i]]++;
+    }
+  }
+};
+
+// Insert the cells into the links. The offsets are expected to point to the
+// end of each point's run; they are decremented as cells are inserted.
+struct InsertCellLinks
+{
+  template <typename CellStateT, typename TIds>
+  void operator()(CellStateT& state, TIds *offsets, TIds *links,
+                  vtkIdType cellIdOffset)
+  {
+    const vtkIdType numCells = state.GetNumberOfCells();
+    const auto *conn = state.GetConnectivity()->GetPointer(0);
+    for (vtkIdType cellId=0; cellId < numCells; ++cellId)
+    {
+      const vtkIdType endOffset = state.GetEndOffset(cellId);
+      for (vtkIdType i=state.GetBeginOffset(cellId); i < endOffset; ++i)
+      {
+        const vtkIdType ptId = static_cast<vtkIdType>(conn[i]);
+        links[--offsets[ptId]] = static_cast<TIds>(cellIdOffset + cellId);
+      }
+    }
+  }
+};
+
+} //anonymous
+
 //----------------------------------------------------------------------------
 // Build the link list array for unstructured grids. Note this is a serial
 // implementation: while there is another method (threaded) that is usually
@@ -177,53 +223,30 @@ SerialBuildLinks(const vtkIdType numPts, const vtkIdType numCells,
   this->NumPts = numPts;
   this->NumCells = numCells;
 
-  // Trick follows: the size of the Links array is equal to
-  // the size of the cell array, minus the number of cells.
-  this->LinksSize =
-    cellArray->GetNumberOfConnectivityEntries() - numCells;
-  const vtkIdType *cells = cellArray->GetPointer();
+  // The size of the Links array is equal to the size of the connectivity.
+  this->LinksSize = cellArray->GetNumberOfConnectivityIds();
 
   // Extra one allocated to simplify later pointer manipulation
   this->Links = new TIds[this->LinksSize+1];
   this->Links[this->LinksSize] = this->NumPts;
   this->Offsets = new TIds[numPts+1];
-  memset(this->Offsets, 0, numPts*sizeof(TIds));
-
-  // Now create the links.
-  vtkIdType npts, cellId, ptId;
-  const vtkIdType *cell=cells;
-  int i;
+  std::fill_n(this->Offsets, numPts+1, 0);
 
   // Count number of point uses
-  for ( cellId=0; cellId < numCells; ++cellId )
-  {
-    npts = *cell++;
-    for (i=0; i<npts; ++i)
-    {
-      this->Offsets[*cell++]++;
-    }
-  }
+  cellArray->Visit(CountPointUses{}, this->Offsets);
 
   // Perform prefix sum
-  for ( ptId=0; ptId < numPts; ++ptId )
+  for ( vtkIdType ptId=1; ptId < numPts; ++ptId )
   {
-    npts = this->Offsets[ptId+1];
-    this->Offsets[ptId+1] = this->Offsets[ptId] + npts;
+    this->Offsets[ptId] += this->Offsets[ptId-1];
   }
 
   // Now build the links. The summation from the prefix sum indicates where
   // the cells are to be inserted. Each time a cell is inserted, the offset
   // is decremented. In the end, the offset array is also constructed as it
   // points to the beginning of each cell run.
-  for ( cell=cells, cellId=0; cellId < numCells; ++cellId )
-  {
-    npts = *cell++;
-    for (i=0; i<npts; ++i)
-    {
-      this->Offsets[*cell]--;
-      this->Links[this->Offsets[*cell++]] = cellId;
-    }
-  }
+  cellArray->Visit(InsertCellLinks{}, this->Offsets, this->Links,
+                   static_cast<vtkIdType>(0));
   this->Offsets[numPts] = this->LinksSize;
 }
 
@@ -232,71 +255,84 @@ SerialBuildLinks(const vtkIdType numPts, const vtkIdType numCells,
 
 namespace { //anonymous
 
-template <typename TIds>
+template <typename CellStateT, typename TIds>
 struct CountUses
 {
-  const vtkIdType *Cells;
-  const vtkIdType *Locations;
+  CellStateT& State;
   std::atomic<TIds> *Counts;
 
-  CountUses(const vtkIdType *cells, const vtkIdType *locs,
-            std::atomic<TIds>* counts) :
-    Cells(cells), Locations(locs), Counts(counts)
+  CountUses(CellStateT& state, std::atomic<TIds>* counts) :
+    State(state), Counts(counts)
   {
   }
 
-  void  operator()(vtkIdType cellId, vtkIdType endCellId)
+  // Loop over a range of the connectivity array
+  void  operator()(vtkIdType idx, vtkIdType endIdx)
   {
-    const vtkIdType loc = this->Locations[cellId];
-    const vtkIdType *cell = this->Cells + loc;
-    vtkIdType npts;
-
-    for ( ; cellId < endCellId; ++cellId )
+    const auto *conn = this->State.GetConnectivity()->GetPointer(0);
+    for ( ; idx < endIdx; ++idx )
     {
-      npts = *cell++;
-      for (auto i=0; i<npts; ++i)
-      {
-        this->Counts[*cell++]++;
-      }
-    }//for all cells in this batch of cells
+      this->Counts[conn[idx]]++;
+    }
   }
 };
 
-template <typename TIds>
+template <typename CellStateT, typename TIds>
 struct InsertLinks
 {
-  const vtkIdType *Cells;
-  const vtkIdType *Locations;
+  CellStateT& State;
   std::atomic<TIds> *Counts;
   const TIds *Offsets;
   TIds *Links;
 
-  InsertLinks(const vtkIdType *cells, const vtkIdType *locs,
-              std::atomic<TIds>* counts, const TIds *offsets, TIds *links) :
-    Cells(cells), Locations(locs), Counts(counts), Offsets(offsets), Links(links)
+  InsertLinks(CellStateT& state, std::atomic<TIds>* counts,
+              const TIds *offsets, TIds *links) :
+    State(state), Counts(counts), Offsets(offsets), Links(links)
   {
   }
 
   void  operator()(vtkIdType cellId, vtkIdType endCellId)
   {
-    const vtkIdType loc = this->Locations[cellId];
-    const vtkIdType *cell = this->Cells + loc;
-    vtkIdType npts, offset;
+    const auto *conn = this->State.GetConnectivity()->GetPointer(0);
+    vtkIdType ptId, offset;
 
     for ( ; cellId < endCellId; ++cellId )
     {
-      npts = *cell++;
-      for (auto i=0; i<npts; ++i)
+      const vtkIdType endOffset = this->State.GetEndOffset(cellId);
+      for (vtkIdType i=this->State.GetBeginOffset(cellId); i < endOffset; ++i)
       {
-        offset = this->Offsets[*cell] + this->Counts[*cell].fetch_sub(1) - 1;
-        this->Links[offset] = cellId;
-        ++cell;
+        ptId = static_cast<vtkIdType>(conn[i]);
+        offset = this->Offsets[ptId] + this->Counts[ptId].fetch_sub(1) - 1;
+        this->Links[offset] = static_cast<TIds>(cellId);
       }
     }//for all cells in this batch of cells
   }
 };
 
-
+struct ThreadedBuildLinksImpl
+{
+  template <typename CellStateT, typename TIds>
+  void operator()(CellStateT& state, vtkIdType numPts, TIds *offsets,
+                  TIds *links)
+  {
+    // Create an array of atomics with initial count=0. This will keep
+    // track of point uses. Count them in parallel.
+    std::atomic<TIds>* counts = new std::atomic<TIds> [numPts] {};
+    CountUses<CellStateT,TIds> count(state, counts);
+    vtkSMPTools::For(0, state.GetNumberOfConnectivityIds(), count);
+
+    // Perform prefix sum to determine offsets
+    vtkSMPTools::ExclusiveScan(counts, counts + numPts, offsets,
+                               static_cast<TIds>(0));
+
+    // Now insert cell ids into cell links.
+    InsertLinks<CellStateT,TIds> insertLinks(state, counts, offsets, links);
+    vtkSMPTools::For(0, state.GetNumberOfCells(), insertLinks);
+
+    // Clean up
+    delete [] counts;
+  }
+};
 
 } //anonymous
 
@@ -306,45 +342,23 @@ struct InsertLinks
 // implementation: it uses SMPTools and atomics to prevent race situations.
 template <typename TIds> void vtkStaticCellLinksTemplate<TIds>::
 ThreadedBuildLinks(const vtkIdType numPts, const vtkIdType numCells,
-                   vtkCellArray *cellArray, vtkIdType *locs)
+                   vtkCellArray *cellArray)
 {
   // Basic information about the grid
   this->NumPts = numPts;
   this->NumCells = numCells;
 
-  // Trick follows: the size of the Links array is equal to
-  // the size of the cell array, minus the number of cells.
-  this->LinksSize =
-    cellArray->GetNumberOfConnectivityEntries() - numCells;
-  const vtkIdType *cells = cellArray->GetPointer();
+  // The size of the Links array is equal to the size of the connectivity.
+  this->LinksSize = cellArray->GetNumberOfConnectivityIds();
 
   // Extra one allocated to simplify later pointer manipulation
   this->Links = new TIds[this->LinksSize+1];
   this->Links[this->LinksSize] = this->NumPts;
-
-  // Create an array of atomics with initial count=0. This will keep
-  // track of point uses. Count them in parallel.
-  std::atomic<TIds>* counts = new std::atomic<TIds> [numPts] {};
-  CountUses<TIds> count(cells, locs, counts);
-  vtkSMPTools::For(0,numCells, count);
-
-  // Perform prefix sum to determine offsets
-  vtkIdType ptId, npts;
   this->Offsets = new TIds[numPts+1];
-  this->Offsets[0] = 0;
-  for ( ptId=1; ptId < numPts; ++ptId )
-  {
-    npts = counts[ptId-1];
-    this->Offsets[ptId] = this->Offsets[ptId-1] + npts;
-  }
   this->Offsets[numPts] = this->LinksSize;
 
-  // Now insert cell ids into cell links.
-  InsertLinks<TIds> insertLinks(cells, locs, counts, this->Offsets, this->Links);
-  vtkSMPTools::For(0,numCells, insertLinks);
-
-  // Clean up
-  delete [] counts;
+  cellArray->Visit(ThreadedBuildLinksImpl{}, numPts, this->Offsets,
+                   this->Links);
 }
 
 //----------------------------------------------------------------------------
@@ -362,8 +376,7 @@ BuildLinks(vtkUnstructuredGrid *ugrid)
   // Use serial or threaded implementations
   if ( ! this->SequentialProcessing )
   {
-    vtkIdType *locs = static_cast<vtkIdType*>(ugrid->GetCellLocationsArray()->GetVoidPointer(0));
-    this->ThreadedBuildLinks(numPts, numCells, cellArray, locs);
+    this->ThreadedBuildLinks(numPts, numCells, cellArray);
   }
   else
   {
@@ -383,8 +396,15 @@ BuildLinks(vtkExplicitStructuredGrid *esgrid)
   // We're going to get into the guts of the class
   vtkCellArray *cellArray = esgrid->GetCells();
 
-  // Use serial implementation. TODO: add threaded implementation
-  this->SerialBuildLinks(numPts, numCells, cellArray);
+  // Use serial or threaded implementations
+  if ( ! this->SequentialProcessing )
+  {
+    this->ThreadedBuildLinks(numPts, numCells, cellArray);
+  }
+  else
+  {
+    this->SerialBuildLinks(numPts, numCells, cellArray);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -412,7 +432,7 @@ BuildLinks(vtkPolyData *pd)
     if ( cellArrays[i] != nullptr )
     {
       numCells[i] = cellArrays[i]->GetNumberOfCells();
-      sizes[i] = cellArrays[i]->GetNumberOfConnectivityEntries() - numCells[i];
+      sizes[i] = cellArrays[i]->GetNumberOfConnectivityIds();
     }
     else
     {
@@ -421,58 +441,58 @@ BuildLinks(vtkPolyData *pd)
     }
   }//for the four polydata arrays
 
+  // When only one of the arrays has cells, the cell ids of the polydata are
+  // the ones of the array and the threaded implementation can be used.
+  int numArrays = 0;
+  for (i=0, j=0; i<4; ++i)
+  {
+    if ( numCells[i] > 0 )
+    {
+      numArrays++;
+      j = i;
+    }
+  }
+  if ( ! this->SequentialProcessing && numArrays == 1 )
+  {
+    this->ThreadedBuildLinks(this->NumPts, numCells[j], cellArrays[j]);
+    return;
+  }
+
   // Allocate
   this->LinksSize = sizes[0] + sizes[1] + sizes[2] + sizes[3];
   this->Links = new TIds[this->LinksSize+1];
   this->Links[this->LinksSize] = this->NumPts;
   this->Offsets = new TIds[this->NumPts+1];
-  this->Offsets[this->NumPts] = this->LinksSize;
-  std::fill_n(this->Offsets, this->NumPts, 0);
+  std::fill_n(this->Offsets, this->NumPts+1, 0);
 
-  // Now create the links.
-  vtkIdType npts, cellId, CellId, ptId;
-  const vtkIdType *cell;
-
-  // Visit the four arrays
-  for ( CellId=0, j=0; j < 4; ++j )
+  // Count number of point uses over the four arrays
+  for ( j=0; j < 4; ++j )
   {
-    // Count number of point uses
-    cell = cellArrays[j]->GetPointer();
-    for ( cellId=0; cellId < numCells[j]; ++cellId )
+    if ( numCells[j] > 0 )
     {
-      npts = *cell++;
-      for (i=0; i<npts; ++i)
-      {
-        this->Offsets[CellId+(*cell++)]++;
-      }
+      cellArrays[j]->Visit(CountPointUses{}, this->Offsets);
     }
-    CellId += numCells[j];
-  } //for each of the four polydata cell arrays
+  }
 
   // Perform prefix sum
-  for ( ptId=0; ptId < this->NumPts; ++ptId )
+  for ( vtkIdType ptId=1; ptId < this->NumPts; ++ptId )
   {
-    npts = this->Offsets[ptId+1];
-    this->Offsets[ptId+1] = this->Offsets[ptId] + npts;
+    this->Offsets[ptId] += this->Offsets[ptId-1];
   }
 
   // Now build the links. The summation from the prefix sum indicates where
   // the cells are to be inserted. Each time a cell is inserted, the offset
   // is decremented. In the end, the offset array is also constructed as it
   // points to the beginning of each cell run.
-  for ( CellId=0, j=0; j < 4; ++j )
+  vtkIdType cellIdOffset = 0;
+  for ( j=0; j < 4; ++j )
   {
-    cell = cellArrays[j]->GetPointer();
-    for ( cellId=0; cellId < numCells[j]; ++cellId )
+    if ( numCells[j] > 0 )
     {
-      npts = *cell++;
-      for (i=0; i<npts; ++i)
-      {
-        this->Offsets[*cell]--;
-        this->Links[this->Offsets[*cell++]] = CellId+cellId;
-      }
+      cellArrays[j]->Visit(InsertCellLinks{}, this->Offsets, this->Links,
+                           cellIdOffset);
     }
-    CellId += numCells[j];
+    cellIdOffset += numCells[j];
   }//for each of the four polydata arrays
   this->Offsets[this->NumPts] = this->LinksSize;
 }
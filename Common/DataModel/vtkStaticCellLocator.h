@@ -200,6 +200,14 @@ public:
   void BuildLocator() override;
   //@}
 
+  /**
+   * Once the locator is built, FindCell() only reads the bins and calls
+   * vtkDataSet::GetCell(cellId, vtkGenericCell*), which fills the given
+   * cell without shared scratch space. The batched FindCells() thus
+   * processes the points in parallel.
+   */
+  bool HasThreadSafeQueries() override { return true; }
+
   //@{
   /**
    * Set the maximum number of buckets in the locator. By default the value
@@ -20,13 +20,16 @@
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
+#include "vtkPointSet.h"
 #include "vtkPolyData.h"
 #include "vtkBoundingBox.h"
 #include "vtkBox.h"
 #include "vtkLine.h"
 #include "vtkSMPTools.h"
+#include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
 
+#include <algorithm>
 #include <vector>
 
 vtkStandardNewMacro(vtkStaticPointLocator);
@@ -109,6 +112,7 @@ struct vtkBucketList
   // Virtuals for templated subclasses
   virtual ~vtkBucketList() = default;
   virtual void BuildLocator() = 0;
+  virtual vtkIdType UpdateLocator() = 0;
 
   // place points in appropriate buckets
   void GetBucketNeighbors(NeighborBuckets* buckets,
@@ -445,6 +449,7 @@ struct BucketList : public vtkBucketList
   // Okay the various ivars
   LocatorTuple<TIds> *Map; //the map to be sorted
   TIds               *Offsets; //offsets for each bucket into the map
+  std::vector<TIds>  PointBuckets; //bucket of each point, for the updates
 
   // Construction
   BucketList(vtkStaticPointLocator *loc, vtkIdType numPts, int numBuckets) :
@@ -681,19 +686,35 @@ struct BucketList : public vtkBucketList
     }
   };
 
-  // Merge points that are coincident within a tolerance. Operates in
-  // parallel on points. Needs to check neighbor buckets which slows it down
-  // considerably. Note that merging is one direction: larger ids are merged
-  // to lower.
+  // Merge points that are coincident within a tolerance. The points must
+  // have been merged precisely first: the points precisely coincident with
+  // a lower id point are merged like it. The neighbors of the other points
+  // are found in parallel (which needs to check neighbor buckets and so is
+  // slower than the precise merge); only the neighbors with a lower id are
+  // kept. Then a sequential sweep in id order merges each point to the
+  // lowest id point within the tolerance that has not itself been merged.
+  // This is the greedy result of processing the points one by one in id
+  // order, and does not depend on the number of threads. Note that merging
+  // is one direction: larger ids are merged to lower.
   template <typename T>
   struct MergeClose
   {
+    // The lower id neighbors of a contiguous range of points: the neighbors
+    // of point Begin+i are Neighbors[Offsets[i],Offsets[i+1]).
+    struct NeighborBatch
+    {
+      vtkIdType Begin;
+      std::vector<vtkIdType> Offsets;
+      std::vector<vtkIdType> Neighbors;
+    };
+
     BucketList<T> *BList;
     vtkDataSet *DataSet;
     vtkIdType *MergeMap;
     double Tol;
 
     vtkSMPThreadLocalObject<vtkIdList> PIds;
+    vtkSMPThreadLocal<std::vector<NeighborBatch>> Batches;
 
     MergeClose(BucketList<T> *blist, double tol, vtkIdType *mergeMap) :
       BList(blist), MergeMap(mergeMap), Tol(tol)
@@ -711,37 +732,78 @@ struct BucketList : public vtkBucketList
     void  operator()(vtkIdType ptId, vtkIdType endPtId)
     {
       BucketList<T> *bList=this->BList;
-      vtkIdType *mergeMap=this->MergeMap;
-      int i;
+      const vtkIdType *mergeMap=this->MergeMap;
+      vtkIdType i;
       double p[3];
       vtkIdType nearId, numIds;
       vtkIdList*& nearby = this->PIds.Local();
 
+      std::vector<NeighborBatch>& batches = this->Batches.Local();
+      batches.emplace_back();
+      NeighborBatch& batch = batches.back();
+      batch.Begin = ptId;
+      batch.Offsets.reserve(endPtId - ptId + 1);
+      batch.Offsets.push_back(0);
+
       for ( ; ptId < endPtId; ++ptId )
       {
-        if ( mergeMap[ptId] < 0 )
+        if ( mergeMap[ptId] == ptId )
         {
-          mergeMap[ptId] = ptId;
           this->DataSet->GetPoint(ptId, p);
           bList->FindPointsWithinRadius(this->Tol, p, nearby);
-          if ( (numIds = nearby->GetNumberOfIds()) > 0 )
+          numIds = nearby->GetNumberOfIds();
+          for (i=0; i < numIds; i++)
           {
-            for (i=0; i < numIds; i++)
+            nearId = nearby->GetId(i);
+            if ( nearId < ptId && mergeMap[nearId] == nearId )
             {
-              nearId = nearby->GetId(i);
-              if ( ptId < nearId &&
-                   (mergeMap[nearId] < 0 || ptId < mergeMap[nearId]) )
-              {
-                mergeMap[nearId] = ptId;
-              }
+              batch.Neighbors.push_back(nearId);
             }
           }
-        }//if point not yet processed
+        }//if point not precisely merged
+        batch.Offsets.push_back(static_cast<vtkIdType>(batch.Neighbors.size()));
       }//for all points in this batch
     }
 
+    // Sweep the points in id order to merge them.
     void Reduce()
-    {}
+    {
+      std::vector<const NeighborBatch*> batches;
+      for ( auto it=this->Batches.begin(); it != this->Batches.end(); ++it )
+      {
+        for ( const NeighborBatch& batch : *it )
+        {
+          batches.push_back(&batch);
+        }
+      }
+      std::sort(batches.begin(), batches.end(),
+                [](const NeighborBatch *a, const NeighborBatch *b)
+                { return a->Begin < b->Begin; });
+
+      vtkIdType *mergeMap=this->MergeMap;
+      for ( const NeighborBatch *batch : batches )
+      {
+        vtkIdType ptId = batch->Begin;
+        const vtkIdType *nei = batch->Neighbors.data();
+        for ( size_t i=1; i < batch->Offsets.size(); ++i, ++ptId )
+        {
+          if ( mergeMap[ptId] != ptId )
+          {
+            mergeMap[ptId] = mergeMap[mergeMap[ptId]];
+            continue;
+          }
+          vtkIdType mergeId = ptId;
+          for ( vtkIdType j=batch->Offsets[i-1]; j < batch->Offsets[i]; ++j )
+          {
+            if ( nei[j] < mergeId && mergeMap[nei[j]] == nei[j] )
+            {
+              mergeId = nei[j];
+            }
+          }
+          mergeMap[ptId] = mergeId;
+        }
+      }
+    }
   };
 
   // Build the map and other structures to support locator operations
@@ -789,6 +851,205 @@ struct BucketList : public vtkBucketList
     MapOffsets<TIds> offMapper(this);
     vtkSMPTools::For(0,numBatches, offMapper);
   }
+
+  // Record the bucket of each point, as found in the map.
+  template <typename T>
+  struct MapPointBuckets
+  {
+    BucketList<T> *BList;
+
+    MapPointBuckets(BucketList<T> *blist) : BList(blist)
+    {
+    }
+
+    void  operator()(vtkIdType idx, vtkIdType end)
+    {
+      T *pointBuckets = this->BList->PointBuckets.data();
+      const LocatorTuple<T> *t = this->BList->Map + idx;
+      for ( ; idx < end; ++idx, ++t )
+      {
+        pointBuckets[t->PtId] = t->Bucket;
+      }
+    }
+  };
+
+  // Find the points which changed buckets since the map was last updated.
+  // The points are traversed in parallel, and their new bucket compared with
+  // the bucket of each point recorded in PointBuckets. The moved points,
+  // with their new bucket, are gathered in thread local lists.
+  template <typename T>
+  struct FindMovedPoints
+  {
+    BucketList<T> *BList;
+    const float *FPts;
+    const double *DPts;
+    vtkSMPThreadLocal<std::vector<LocatorTuple<T>>> Moved;
+    vtkSMPThreadLocal<unsigned char> Outside;
+
+    FindMovedPoints(BucketList<T> *blist) :
+      BList(blist), FPts(nullptr), DPts(nullptr)
+    {
+      vtkPointSet *ps = vtkPointSet::SafeDownCast(blist->DataSet);
+      if ( ps && ps->GetPoints() )
+      {
+        int dataType = ps->GetPoints()->GetDataType();
+        void *pts = ps->GetPoints()->GetVoidPointer(0);
+        if ( dataType == VTK_FLOAT )
+        {
+          this->FPts = static_cast<const float*>(pts);
+        }
+        else if ( dataType == VTK_DOUBLE )
+        {
+          this->DPts = static_cast<const double*>(pts);
+        }
+      }
+    }
+
+    void GetPoint(vtkIdType ptId, double p[3]) const
+    {
+      if ( this->FPts )
+      {
+        const float *x = this->FPts + 3*ptId;
+        p[0] = x[0]; p[1] = x[1]; p[2] = x[2];
+      }
+      else if ( this->DPts )
+      {
+        const double *x = this->DPts + 3*ptId;
+        p[0] = x[0]; p[1] = x[1]; p[2] = x[2];
+      }
+      else
+      {
+        this->BList->DataSet->GetPoint(ptId,p);
+      }
+    }
+
+    void Initialize()
+    {
+      this->Outside.Local() = 0;
+    }
+
+    void operator()(vtkIdType ptId, vtkIdType end)
+    {
+      const BucketList<T> *bList = this->BList;
+      const double *bds = bList->Bounds;
+      const T *pointBuckets = bList->PointBuckets.data();
+      std::vector<LocatorTuple<T>> &moved = this->Moved.Local();
+      unsigned char &outside = this->Outside.Local();
+      LocatorTuple<T> tuple;
+      double p[3];
+      for ( ; ptId < end && !outside; ++ptId )
+      {
+        this->GetPoint(ptId,p);
+        if ( !(p[0] >= bds[0] && p[0] <= bds[1] && p[1] >= bds[2] &&
+               p[1] <= bds[3] && p[2] >= bds[4] && p[2] <= bds[5]) )
+        {
+          outside = 1; //the locator has to be rebuilt
+        }
+        else if ( (tuple.Bucket = static_cast<T>(bList->GetBucketIndex(p)))
+                  != pointBuckets[ptId] )
+        {
+          tuple.PtId = static_cast<T>(ptId);
+          moved.push_back(tuple);
+        }
+      }
+    }
+
+    void Reduce()
+    {
+    }
+  };
+
+  // Update the map after the points moved, keeping the bounds and divisions.
+  // Return the number of points which changed buckets, or -1 if a point left
+  // the bounds of the locator. The moved points are removed from the map,
+  // sorted, and merged back in the map: both sequences being sorted, the
+  // result is the map a full sort would produce. The bucket of each point is
+  // recorded on the first update, so that the points are then traversed in
+  // order rather than through the map.
+  vtkIdType UpdateLocator() override
+  {
+    if ( this->PointBuckets.empty() )
+    {
+      this->PointBuckets.resize(this->NumPts);
+      MapPointBuckets<TIds> bucketMapper(this);
+      vtkSMPTools::For(0,this->NumPts, bucketMapper);
+    }
+
+    FindMovedPoints<TIds> finder(this);
+    vtkSMPTools::For(0,this->NumPts, finder);
+    for ( unsigned char outside : finder.Outside )
+    {
+      if ( outside )
+      {
+        return -1;
+      }
+    }
+
+    std::vector<LocatorTuple<TIds>> moved;
+    for ( const std::vector<LocatorTuple<TIds>> &tMoved : finder.Moved )
+    {
+      moved.insert(moved.end(), tMoved.begin(), tMoved.end());
+    }
+    vtkIdType numMoved = static_cast<vtkIdType>(moved.size());
+    if ( numMoved == 0 )
+    {
+      return 0;
+    }
+
+    // Locate the moved points in the map: the point ids are sorted in each
+    // bucket, so a binary search in the previous bucket finds them.
+    LocatorTuple<TIds> *map = this->Map;
+    std::vector<vtkIdType> movedIdx(numMoved);
+    for ( vtkIdType i=0; i < numMoved; ++i )
+    {
+      TIds ptId = moved[i].PtId;
+      TIds bucket = this->PointBuckets[ptId];
+      LocatorTuple<TIds> key;
+      key.PtId = ptId;
+      key.Bucket = bucket;
+      movedIdx[i] = std::lower_bound(map + this->Offsets[bucket],
+                                     map + this->Offsets[bucket+1], key) - map;
+      this->PointBuckets[ptId] = moved[i].Bucket;
+    }
+    vtkSMPTools::Sort(movedIdx.begin(), movedIdx.end());
+    vtkSMPTools::Sort(moved.begin(), moved.end());
+
+    // Compact the remaining points (only after the first moved one)...
+    vtkIdType numKept = movedIdx[0];
+    for ( vtkIdType i=movedIdx[0], k=0; i < this->NumPts; ++i )
+    {
+      if ( k < numMoved && movedIdx[k] == i )
+      {
+        ++k;
+      }
+      else
+      {
+        map[numKept++] = map[i];
+      }
+    }
+
+    // ...and merge the moved points back, from the end of the map
+    vtkIdType i = numKept - 1, j = numMoved - 1, out = this->NumPts - 1;
+    for ( ; j >= 0; --out )
+    {
+      if ( i >= 0 && moved[j] < map[i] )
+      {
+        map[out] = map[i--];
+      }
+      else
+      {
+        map[out] = moved[j--];
+      }
+    }
+
+    // The offsets are built again, in parallel
+    int numBatches = static_cast<int>(
+      ceil(static_cast<double>(this->NumPts) / this->BatchSize));
+    MapOffsets<TIds> offMapper(this);
+    vtkSMPTools::For(0,numBatches, offMapper);
+
+    return numMoved;
+  }
 };
 
 //-----------------------------------------------------------------------------
@@ -1413,8 +1674,9 @@ IntersectWithLine(double a0[3], double a1[3], double tol, double& t,
 //-----------------------------------------------------------------------------
 // Merge points based on tolerance. Return a point map. There are two
 // separate paths: when the tolerance is precisely 0.0, and when tol >
-// 0.0. Both are executed in parallel, although the second uses a
-// checkerboard approach to avoid write collisions.
+// 0.0. Both are executed in parallel, although the second merges the points
+// in a final sequential sweep so that the result does not depend on the
+// order in which the threads process the points.
 template <typename TIds> void BucketList<TIds>::
 MergePoints(double tol, vtkIdType *mergeMap)
 {
@@ -1431,9 +1693,13 @@ MergePoints(double tol, vtkIdType *mergeMap)
 
   // Merge within a tolerance. This is a greedy algorithm that can give
   // weird results since exactly which points to merge with is not an
-  // obvious answer (without doing fancy clustering etc).
+  // obvious answer (without doing fancy clustering etc). The results are
+  // however repeatable. Precisely coincident points are merged first, which
+  // saves searching the neighborhood of each of them.
   else
   {
+    MergePrecise<TIds> mergePrecise(this, mergeMap);
+    vtkSMPTools::For(0,this->NumBuckets, mergePrecise);
     MergeClose<TIds> merge(this, tol, mergeMap);
     vtkSMPTools::For(0,this->NumPts, merge);
   }
@@ -1673,6 +1939,8 @@ vtkStaticPointLocator::vtkStaticPointLocator()
   this->Buckets = nullptr;
   this->MaxNumberOfBuckets = VTK_INT_MAX;
   this->LargeIds = false;
+  this->IncrementalUpdate = false;
+  this->NumberOfMovedPoints = -1;
 }
 
 //-----------------------------------------------------------------------------
@@ -1708,10 +1976,18 @@ void vtkStaticPointLocator::BuildLocator()
   int i;
   vtkIdType numPts;
 
-  if ( (this->Buckets != nullptr) && (this->BuildTime > this->MTime)
-       && (this->BuildTime > this->DataSet->GetMTime()) )
+  if ( (this->Buckets != nullptr) && (this->BuildTime > this->MTime) )
   {
-    return;
+    if ( this->BuildTime > this->DataSet->GetMTime() )
+    {
+      return;
+    }
+    // Only the points moved: try to patch the map
+    if ( this->IncrementalUpdate && this->UpdateBuckets() )
+    {
+      this->BuildTime.Modified();
+      return;
+    }
   }
 
   vtkDebugMacro( << "Hashing points..." );
@@ -1784,6 +2060,7 @@ void vtkStaticPointLocator::BuildLocator()
 
   // Actually construct the locator
   this->Buckets->BuildLocator();
+  this->NumberOfMovedPoints = -1;
 
   this->BuildTime.Modified();
 }
@@ -1799,10 +2076,18 @@ void vtkStaticPointLocator::BuildLocator(const double *bds)
   int i;
   vtkIdType numPts;
 
-  if ( (this->Buckets != nullptr) && (this->BuildTime > this->MTime)
-       && (this->BuildTime > this->DataSet->GetMTime()) )
+  if ( (this->Buckets != nullptr) && (this->BuildTime > this->MTime) )
   {
-    return;
+    if ( this->BuildTime > this->DataSet->GetMTime() )
+    {
+      return;
+    }
+    // Only the points moved: try to patch the map
+    if ( this->IncrementalUpdate && this->UpdateBuckets() )
+    {
+      this->BuildTime.Modified();
+      return;
+    }
   }
 
   vtkDebugMacro( << "Hashing points..." );
@@ -1875,10 +2160,66 @@ void vtkStaticPointLocator::BuildLocator(const double *bds)
 
   // Actually construct the locator
   this->Buckets->BuildLocator();
+  this->NumberOfMovedPoints = -1;
 
   this->BuildTime.Modified();
 }
 
+//-----------------------------------------------------------------------------
+// Patch the sorted map of the existing buckets after the points moved.
+bool vtkStaticPointLocator::UpdateBuckets()
+{
+  if ( !this->Buckets || !this->DataSet ||
+       this->DataSet->GetNumberOfPoints() != this->Buckets->NumPts )
+  {
+    return false;
+  }
+
+  vtkDebugMacro( << "Updating hashed points..." );
+  this->Buckets->DataSet = this->DataSet;
+  vtkIdType numMoved = this->Buckets->UpdateLocator();
+  if ( numMoved < 0 )
+  {
+    return false;
+  }
+  this->NumberOfMovedPoints = numMoved;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+void vtkStaticPointLocator::UpdateLocator()
+{
+  if ( this->UpdateBuckets() )
+  {
+    this->BuildTime.Modified();
+    return;
+  }
+
+  // Rebuild the locator from scratch
+  this->FreeSearchStructure();
+  this->BuildLocator();
+}
+
+//-----------------------------------------------------------------------------
+// Rebind the locator to a dataset without modifying the locator (as
+// SetDataSet() does, which would force a full rebuild).
+void vtkStaticPointLocator::UpdateLocator(vtkDataSet *ds)
+{
+  if ( ds != this->DataSet )
+  {
+    if ( ds )
+    {
+      ds->Register(this);
+    }
+    if ( this->DataSet )
+    {
+      this->DataSet->UnRegister(this);
+    }
+    this->DataSet = ds;
+  }
+  this->UpdateLocator();
+}
+
 //-----------------------------------------------------------------------------
 // These methods satisfy the vtkStaticPointLocator API. The implementation is
 // with the templated BucketList class. Note that a lot of the complexity here
@@ -2116,4 +2457,10 @@ void vtkStaticPointLocator::PrintSelf(ostream& os, vtkIndent indent)
      << this->MaxNumberOfBuckets << "\n";
 
   os << indent << "Large IDs: " << this->LargeIds << "\n";
+
+  os << indent << "Incremental Update: "
+     << (this->IncrementalUpdate ? "On\n" : "Off\n");
+
+  os << indent << "Number Of Moved Points: "
+     << this->NumberOfMovedPoints << "\n";
 }
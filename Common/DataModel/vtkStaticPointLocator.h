@@ -28,6 +28,13 @@
  * (i.e., incremental point insertion is not supported). If you need to
  * incrementally insert points, use the vtkPointLocator or its kin to do so.
  *
+ * The points may however move after the locator has been built, as in
+ * particle simulations. UpdateLocator() (or BuildLocator() when
+ * IncrementalUpdate is enabled) then only moves the points which changed
+ * buckets in the sorted map, instead of binning and sorting all the points
+ * again. The bounds and divisions of the locator are kept, so the locator
+ * is fully rebuilt when a point leaves the bounds.
+ *
  * @warning
  * This class is templated. It may run slower than serial execution if the code
  * is not optimized during compilation. Build in Release or ReleaseWithDebugInfo.
@@ -95,6 +102,18 @@ public:
   vtkGetVectorMacro(Divisions,int,3);
   //@}
 
+  //@{
+  /**
+   * Enable incremental updates of the locator. When enabled, and the locator
+   * is built again because only the points of the dataset were modified
+   * (the number of points being the same), BuildLocator() updates the
+   * locator like UpdateLocator() does. By default this is off.
+   */
+  vtkSetMacro(IncrementalUpdate,bool);
+  vtkGetMacro(IncrementalUpdate,bool);
+  vtkBooleanMacro(IncrementalUpdate,bool);
+  //@}
+
   // Re-use any superclass signatures that we don't override.
   using vtkAbstractPointLocator::FindClosestPoint;
   using vtkAbstractPointLocator::FindClosestNPoints;
@@ -161,7 +180,9 @@ public:
    * represents the mapping of "concident" point ids to a single point. Note
    * the number of points in the merge map is the number of points the
    * locator was built with. The user is expected to pass in an allocated
-   * mergeMap.
+   * mergeMap. Points are merged to the point with the lowest id they are
+   * coincident with (within the tolerance, and greedily in id order when
+   * tol > 0); the map is the same whatever the number of threads used.
    */
   void MergePoints(double tol, vtkIdType *mergeMap);
 
@@ -176,6 +197,36 @@ public:
   void BuildLocator(const double *bounds);
   //@}
 
+  //@{
+  /**
+   * Update the locator after the points of the dataset moved, the number of
+   * points being the same. The bounds and divisions of the locator are kept:
+   * the points which changed buckets are found in parallel, and moved in the
+   * sorted map, which then is the same as if the locator was built with
+   * these bounds and divisions. If the locator was not built, the number of
+   * points changed, or a point left the bounds of the locator, the locator
+   * is fully rebuilt instead. Since the bounds are not shrunk, fully rebuild
+   * the locator (with BuildLocator() after Modified()) when the points
+   * gathered in a small region. The second signature rebinds the locator to
+   * another dataset, e.g. holding the new coordinates of the points, without
+   * modifying the locator. These methods are not thread safe.
+   */
+  void UpdateLocator();
+  void UpdateLocator(vtkDataSet *ds);
+  //@}
+
+  /**
+   * Return the number of points which changed buckets during the last
+   * incremental update, or -1 if the locator was fully built.
+   */
+  vtkGetMacro(NumberOfMovedPoints,vtkIdType);
+
+  /**
+   * The queries are thread safe once the locator is built, so the batched
+   * queries of vtkAbstractPointLocator are processed in parallel.
+   */
+  bool HasThreadSafeQueries() override { return true; }
+
   /**
    * Populate a polydata with the faces of the bins that potentially contain cells.
    * Note that the level parameter has no effect on this method as there is no
@@ -244,6 +295,12 @@ protected:
   vtkBucketList *Buckets; // Lists of point ids in each bucket
   vtkIdType MaxNumberOfBuckets; // Maximum number of buckets in locator
   bool LargeIds; //indicate whether integer ids are small or large
+  bool IncrementalUpdate; // Patch the map when only the points moved
+  vtkIdType NumberOfMovedPoints; // Moved points in the last update, or -1
+
+  // Move the points which changed buckets in the sorted map. Returns false
+  // if the locator cannot be updated, and must be fully rebuilt.
+  bool UpdateBuckets();
 
 private:
   vtkStaticPointLocator(const vtkStaticPointLocator&) = delete;
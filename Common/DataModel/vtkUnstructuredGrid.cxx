@@ -545,13 +545,12 @@ int vtkUnstructuredGrid::GetCellType(vtkIdType cellId)
 vtkCell *vtkUnstructuredGrid::GetCell(vtkIdType cellId)
 {
   vtkIdType i;
-  vtkIdType loc;
   vtkCell *cell = nullptr;
-  vtkIdType *pts, numPts;
+  const vtkIdType *pts;
+  vtkIdType numPts;
 
-  loc = this->Locations->GetValue(cellId);
-  vtkDebugMacro(<< "location = " <<  loc);
-  this->Connectivity->GetCell(loc,numPts,pts);
+  this->Connectivity->QueryCellAtId(cellId,this->Locations->GetValue(cellId),
+                                    numPts,pts);
 
   int cellType = static_cast<int>(this->Types->GetValue(cellId));
   switch (cellType)
@@ -911,18 +910,13 @@ vtkCell *vtkUnstructuredGrid::GetCell(vtkIdType cellId)
 //----------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell *cell)
 {
-  vtkIdType loc;
-  vtkIdType *pts, numPts;
-
   int cellType = static_cast<int>(this->Types->GetValue(cellId));
   cell->SetCellType(cellType);
 
-  loc = this->Locations->GetValue(cellId);
-  this->Connectivity->GetCell(loc,numPts,pts);
-
-  cell->PointIds->SetNumberOfIds(numPts);
-
-  std::copy(pts, pts + numPts, cell->PointIds->GetPointer(0));
+  // Fill the cell's own id list, so that concurrent calls do not share any
+  // scratch space.
+  this->Connectivity->QueryCellAtId(cellId,this->Locations->GetValue(cellId),
+                                    cell->PointIds);
   this->Points->GetPoints(cell->PointIds, cell->Points);
 
   // Explicit face representation
@@ -942,8 +936,8 @@ void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell *cell)
 //----------------------------------------------------------------------------
 // Support GetCellBounds()
 namespace { //anonymous
-  template <typename T>
-  void ComputeCellBounds(const T *p, vtkIdType numPts, const vtkIdType *pts,
+  template <typename T, typename IdT>
+  void ComputeCellBounds(const T *p, vtkIdType numPts, const IdT *pts,
                          double bounds[6])
   {
     const T *x = p + 3*pts[0];
@@ -964,117 +958,73 @@ namespace { //anonymous
       bounds[5] = (x[2] > bounds[5] ? x[2] : bounds[5]);
     }
   }
-}//anonymous
 
-//----------------------------------------------------------------------------
-// Faster implementation of GetCellBounds().  Bounds are calculated without
-// constructing a cell.
-void vtkUnstructuredGrid::GetCellBounds(vtkIdType cellId, double bounds[6])
-{
-  vtkIdType i;
-  vtkIdType loc;
-  double x[3];
-  vtkIdType *pts, numPts;
-
-  loc = this->Locations->GetValue(cellId);
-  this->Connectivity->GetCell(loc,numPts,pts);
-
-  // carefully compute the bounds
-  if (numPts)
+  // Called by vtkCellArray::VisitCellAtId() with the typed point ids of the
+  // cell, so that no scratch id list is needed.
+  struct CellBoundsWorker
   {
-    // Slightly faster paths for real types - not sure it's worth it
-    if ( this->Points->GetDataType() == VTK_FLOAT )
-    {
-      ComputeCellBounds(static_cast<float*>(this->Points->GetVoidPointer(0)),
-                                            numPts,pts,bounds);
-    }
-    else if ( this->Points->GetDataType() == VTK_DOUBLE )
-    {
-      ComputeCellBounds(static_cast<double*>(this->Points->GetVoidPointer(0)),
-                                             numPts,pts,bounds);
-    }
-    else
+    template <typename IdT>
+    void operator()(vtkIdType numPts, const IdT *pts, vtkPoints *points,
+                    double bounds[6])
     {
-      this->Points->GetPoint( pts[0], x );
-      bounds[0] = x[0];
-      bounds[2] = x[1];
-      bounds[4] = x[2];
-      bounds[1] = x[0];
-      bounds[3] = x[1];
-      bounds[5] = x[2];
-      for (i=1; i < numPts; i++)
+      // carefully compute the bounds
+      if (!numPts)
       {
-        this->Points->GetPoint( pts[i], x );
-        bounds[0] = (x[0] < bounds[0] ? x[0] : bounds[0]);
-        bounds[1] = (x[0] > bounds[1] ? x[0] : bounds[1]);
-        bounds[2] = (x[1] < bounds[2] ? x[1] : bounds[2]);
-        bounds[3] = (x[1] > bounds[3] ? x[1] : bounds[3]);
-        bounds[4] = (x[2] < bounds[4] ? x[2] : bounds[4]);
-        bounds[5] = (x[2] > bounds[5] ? x[2] : bounds[5]);
+        vtkMath::UninitializeBounds(bounds);
+        return;
       }
-    }
-  }
-  else
-  {
-    vtkMath::UninitializeBounds(bounds);
-  }
-}
 
-// Define threaded functor supporting GetMaxCellSize()
-namespace {
-  struct MaxCellSize
-  {
-    const vtkIdType *Conn;
-    const vtkIdType *Locs;
-    int MaxSize; //Reduced maximum size (over all threads)
-    vtkSMPThreadLocal<int> LocalMaxSize; //for this thread
-    MaxCellSize(const vtkIdType *conn, const vtkIdType *locs) :
-      Conn(conn), Locs(locs), MaxSize(0) {}
-    void Initialize()
-    {
-      int& localMaxSize = this->LocalMaxSize.Local();
-      localMaxSize = 0;
-    }
-    void operator()(vtkIdType cellId, vtkIdType endCellId)
-    {
-      const vtkIdType *conn = this->Conn;
-      const vtkIdType *locs = this->Locs;
-      int size;
-      int& localMaxSize = this->LocalMaxSize.Local();
-      for ( ; cellId < endCellId; ++cellId )
+      // Slightly faster paths for real types - not sure it's worth it
+      if ( points->GetDataType() == VTK_FLOAT )
       {
-        size = static_cast<int>(*(conn + locs[cellId]));
-        localMaxSize = (size > localMaxSize ? size : localMaxSize);
+        ComputeCellBounds(static_cast<float*>(points->GetVoidPointer(0)),
+                          numPts,pts,bounds);
       }
-    }
-    void Reduce()
-    {
-      auto mEnd=this->LocalMaxSize.end();
-      auto mIter=this->LocalMaxSize.begin();
-      for ( ; mIter != mEnd; ++mIter )
+      else if ( points->GetDataType() == VTK_DOUBLE )
       {
-        this->MaxSize = ( *mIter > this->MaxSize ? *mIter : this->MaxSize );
+        ComputeCellBounds(static_cast<double*>(points->GetVoidPointer(0)),
+                          numPts,pts,bounds);
+      }
+      else
+      {
+        double x[3];
+        points->GetPoint( pts[0], x );
+        bounds[0] = x[0];
+        bounds[2] = x[1];
+        bounds[4] = x[2];
+        bounds[1] = x[0];
+        bounds[3] = x[1];
+        bounds[5] = x[2];
+        for (vtkIdType i=1; i < numPts; i++)
+        {
+          points->GetPoint( pts[i], x );
+          bounds[0] = (x[0] < bounds[0] ? x[0] : bounds[0]);
+          bounds[1] = (x[0] > bounds[1] ? x[0] : bounds[1]);
+          bounds[2] = (x[1] < bounds[2] ? x[1] : bounds[2]);
+          bounds[3] = (x[1] > bounds[3] ? x[1] : bounds[3]);
+          bounds[4] = (x[2] < bounds[4] ? x[2] : bounds[4]);
+          bounds[5] = (x[2] > bounds[5] ? x[2] : bounds[5]);
+        }
       }
     }
   };
-}//anonymous namespace
+}//anonymous
+
+//----------------------------------------------------------------------------
+// Faster implementation of GetCellBounds().  Bounds are calculated without
+// constructing a cell.
+void vtkUnstructuredGrid::GetCellBounds(vtkIdType cellId, double bounds[6])
+{
+  this->Connectivity->VisitCellAtId(cellId, this->Locations->GetValue(cellId),
+                                    CellBoundsWorker{}, this->Points, bounds);
+}
 
 //----------------------------------------------------------------------------
 // Return the number of points from the cell defined by the maximum number of
 // points/
 int vtkUnstructuredGrid::GetMaxCellSize()
 {
-  // Try threaded fast path first, it should always be called except in
-  // exceptional situations.
-  if (this->Connectivity && this->Locations)
-  {
-    MaxCellSize maxSize(this->Connectivity->GetPointer(),
-                        static_cast<vtkIdType*>(this->Locations->GetVoidPointer(0)));
-    vtkIdType numCells = this->Connectivity->GetNumberOfCells();
-    vtkSMPTools::For(0,numCells, 10000, maxSize);
-    return maxSize.MaxSize;
-  }
-  else if (this->Connectivity)
+  if (this->Connectivity)
   {
     return this->Connectivity->GetMaxCellSize();
   }
@@ -1171,7 +1121,7 @@ vtkIdType vtkUnstructuredGrid::InternalInsertNextCell(int type, vtkIdType npts,
     }
 
     // insert cell location
-    this->Locations->InsertNextValue(this->Connectivity->GetData()->GetMaxId()+1);
+    this->Locations->InsertNextValue(this->Connectivity->GetNumberOfConnectivityEntries());
     // insert face location
     this->FaceLocations->InsertNextValue(this->Faces->GetMaxId()+1);
     // insert cell connectivity and faces stream
@@ -1351,7 +1301,7 @@ void vtkUnstructuredGrid::SetCells(int *types, vtkCellArray *cells)
   for (i=0, cells->InitTraversal(); cells->GetNextCell(npts,pts); i++)
   {
     cellTypes->InsertNextValue(static_cast<unsigned char>(types[i]));
-    cellLocations->InsertNextValue(newCells->GetData()->GetMaxId()+1);
+    cellLocations->InsertNextValue(newCells->GetNumberOfConnectivityEntries());
     if (types[i] != VTK_POLYHEDRON)
     {
       newCells->InsertNextCell(npts, pts);
@@ -1415,7 +1365,7 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray *cellTypes,
   vtkIdType npts, nfaces, realnpts, *pts;
   for (i=0, cells->InitTraversal(); cells->GetNextCell(npts,pts); i++)
   {
-    newCellLocations->InsertNextValue(newCells->GetData()->GetMaxId()+1);
+    newCellLocations->InsertNextValue(newCells->GetNumberOfConnectivityEntries());
     if (cellTypes->GetValue(i) != VTK_POLYHEDRON)
     {
       newCells->InsertNextCell(npts, pts);
@@ -1562,17 +1512,8 @@ GetPointCells(vtkIdType ptId, unsigned short& ncells, vtkIdType*& cells)
 //----------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetCellPoints(vtkIdType cellId, vtkIdList *ptIds)
 {
-  vtkIdType i, loc;
-  vtkIdType *pts, numPts;
-
-  loc = this->Locations->GetValue(cellId);
-  this->Connectivity->GetCell(loc,numPts,pts);
-  ptIds->SetNumberOfIds(numPts);
-  for (i=0; i<numPts; i++)
-  {
-    ptIds->SetId(i,pts[i]);
-  }
-
+  this->Connectivity->QueryCellAtId(cellId,this->Locations->GetValue(cellId),
+                                    ptIds);
 }
 
 namespace
@@ -1852,10 +1793,7 @@ void vtkUnstructuredGrid::ResizeCellList(vtkIdType ptId, int size)
 void vtkUnstructuredGrid::InternalReplaceCell(vtkIdType cellId, int npts,
                                               const vtkIdType pts[])
 {
-  vtkIdType loc;
-
-  loc = this->Locations->GetValue(cellId);
-  this->Connectivity->ReplaceCell(loc,npts,pts);
+  this->Connectivity->ReplaceCellAtId(cellId,npts,pts);
 }
 
 //----------------------------------------------------------------------------
@@ -148,12 +148,29 @@ public:
   /**
    * A higher-performing variant of the virtual vtkDataSet::GetCellPoints()
    * for unstructured grids. Given a cellId, return the number of defining
-   * points and the list of points defining the cell.
+   * points and the list of points defining the cell. Unless the cells are
+   * stored as vtkIdType, the point ids are copied into a scratch list shared
+   * by all callers: use the overload taking a ptIds list from several
+   * threads.
    */
   void GetCellPoints(vtkIdType cellId, vtkIdType& npts, vtkIdType* &pts)
   {
-    vtkIdType loc = this->Locations->GetValue(cellId);
-    this->Connectivity->GetCell(loc,npts,pts);
+    const vtkIdType *cellPts;
+    this->Connectivity->QueryCellAtId(
+      cellId,this->Locations->GetValue(cellId),npts,cellPts);
+    pts = const_cast<vtkIdType*>(cellPts);
+  }
+
+  /**
+   * Thread safe variant of GetCellPoints(cellId, npts, pts): pts either
+   * points directly into the cells or into ptIds, which must not be shared
+   * between threads.
+   */
+  void GetCellPoints(vtkIdType cellId, vtkIdType& npts,
+                     vtkIdType const* &pts, vtkIdList *ptIds)
+  {
+    this->Connectivity->QueryCellAtId(
+      cellId,this->Locations->GetValue(cellId),npts,pts,ptIds);
   }
 
   //@{
@@ -180,7 +197,9 @@ public:
 
   /**
    * Get the array of all the starting indices of cell definitions
-   * in the cell array.
+   * in the legacy layout of the cell array (see
+   * vtkCellArray::ExportLegacyFormat()). Prefer random access by cell id
+   * through GetCells()->GetCellAtId().
    */
   vtkIdTypeArray* GetCellLocationsArray() { return this->Locations; }
 
@@ -484,9 +503,10 @@ protected:
   // The heart of the data represention. The points are managed by the
   // superclass vtkPointSet. A cell is defined by its connectivity (i.e., the
   // point ids that define the cell) and the cell type, represented by the
-  // Connectivity and Types arrays. Random access to the cells is provided by
-  // the Locations, which for each cell is an offset into the Connectivity
-  // array. Finally, when certain topological information is needed (e.g.,
+  // Connectivity and Types arrays. The Connectivity provides random access to
+  // the cells by cell id; the Locations (the offset of each cell in the legacy
+  // layout of the Connectivity) are only kept for backward compatibility.
+  // Finally, when certain topological information is needed (e.g.,
   // all the cells that use a point), the cell links array is built.
   vtkCellArray *Connectivity;
   vtkUnsignedCharArray *Types;
@@ -22,8 +22,6 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
-#include <cassert>
-
 vtkStandardNewMacro(vtkUnstructuredGridCellIterator)
 
 //------------------------------------------------------------------------------
@@ -38,12 +36,10 @@ void vtkUnstructuredGridCellIterator::PrintSelf(ostream &os, vtkIndent indent)
      << static_cast<void*>(this->CellTypePtr) << endl;
   os << indent << "CellTypeEnd: "
      << static_cast<void*>(this->CellTypeEnd) << endl;
-  os << indent << "ConnectivityBegin: " << this->ConnectivityBegin << endl;
-  os << indent << "ConnectivityPtr: " << this->ConnectivityPtr << endl;
+  os << indent << "Cells: " << this->Cells.Get() << endl;
   os << indent << "FacesBegin: " << this->FacesBegin<< endl;
   os << indent << "FacesLocsBegin: " << this->FacesLocsBegin << endl;
   os << indent << "FacesLocsPtr: " << this->FacesLocsPtr << endl;
-  os << indent << "SkippedCells: " << this->SkippedCells << endl;
   os << indent << "UnstructuredGridPoints: " <<
         this->UnstructuredGridPoints << endl;
 }
@@ -70,7 +66,7 @@ void vtkUnstructuredGridCellIterator::SetUnstructuredGrid(
     this->CellTypeEnd += cellTypeArray ? cellTypeArray->GetNumberOfTuples() : 0;
 
     // CellArray
-    this->ConnectivityBegin = this->ConnectivityPtr = cellArray->GetPointer();
+    this->Cells = cellArray;
 
     // Point
     this->UnstructuredGridPoints = points;
@@ -98,38 +94,9 @@ void vtkUnstructuredGridCellIterator::SetUnstructuredGrid(
     this->FacesBegin = nullptr;
     this->FacesLocsBegin = nullptr;
     this->FacesLocsPtr = nullptr;
-    this->ConnectivityBegin= nullptr;
-    this->ConnectivityPtr = nullptr;
+    this->Cells = nullptr;
     this->UnstructuredGridPoints = nullptr;
   }
-
-  this->SkippedCells = 0;
-}
-
-//------------------------------------------------------------------------------
-void vtkUnstructuredGridCellIterator::CatchUpSkippedCells()
-{
-  // catch up on skipped cells -- cache misses make incrementing Connectivity
-  // in IncrementToNextCell() too expensive, so we delay it until here. Special
-  // cases are used for 0 or 1 skipped cells to reduce the number of jumps.
-  switch (this->SkippedCells)
-  {
-    default:
-      while (this->SkippedCells > 1)
-      {
-        this->ConnectivityPtr += *this->ConnectivityPtr + 1;
-        this->SkippedCells--;
-      }
-      assert(this->SkippedCells == 1);
-      VTK_FALLTHROUGH;
-    case 1:
-      this->ConnectivityPtr += *this->ConnectivityPtr + 1;
-      --this->SkippedCells;
-      VTK_FALLTHROUGH;
-    case 0:
-      // do nothing.
-      break;
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -149,9 +116,6 @@ void vtkUnstructuredGridCellIterator::IncrementToNextCell()
 {
   ++this->CellTypePtr;
 
-  // Bookkeeping for ConnectivityPtr
-  ++this->SkippedCells;
-
   // Note that we may be incrementing an invalid pointer here...check
   // if FacesLocsBegin is nullptr before dereferencing this!
   ++this->FacesLocsPtr;
@@ -163,12 +127,9 @@ vtkUnstructuredGridCellIterator::vtkUnstructuredGridCellIterator()
     CellTypeBegin(nullptr),
     CellTypePtr(nullptr),
     CellTypeEnd(nullptr),
-    ConnectivityBegin(nullptr),
-    ConnectivityPtr(nullptr),
     FacesBegin(nullptr),
     FacesLocsBegin(nullptr),
     FacesLocsPtr(nullptr),
-    SkippedCells(0),
     UnstructuredGridPoints(nullptr)
 {
 }
@@ -181,8 +142,6 @@ void vtkUnstructuredGridCellIterator::ResetToFirstCell()
 {
   this->CellTypePtr = this->CellTypeBegin;
   this->FacesLocsPtr = this->FacesLocsBegin;
-  this->ConnectivityPtr = this->ConnectivityBegin;
-  this->SkippedCells = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -194,12 +153,7 @@ void vtkUnstructuredGridCellIterator::FetchCellType()
 //------------------------------------------------------------------------------
 void vtkUnstructuredGridCellIterator::FetchPointIds()
 {
-  CatchUpSkippedCells();
-  const vtkIdType *connPtr = this->ConnectivityPtr;
-  vtkIdType numCellPoints = *(connPtr++);
-  this->PointIds->SetNumberOfIds(numCellPoints);
-  vtkIdType *cellPtr = this->PointIds->GetPointer(0);
-  std::copy(connPtr, connPtr + numCellPoints, cellPtr);
+  this->Cells->GetCellAtId(this->GetCellId(), this->PointIds);
 }
 
 //------------------------------------------------------------------------------
@@ -59,18 +59,12 @@ protected:
   unsigned char *CellTypePtr;
   unsigned char *CellTypeEnd;
 
-  vtkIdType *ConnectivityBegin;
-  vtkIdType *ConnectivityPtr;
+  // The cell array provides random access to the point ids by cell id.
+  vtkSmartPointer<vtkCellArray> Cells;
   vtkIdType *FacesBegin;
   vtkIdType *FacesLocsBegin;
   vtkIdType *FacesLocsPtr;
 
-  // Cache misses make updating ConnectivityPtr in IncrementToNextCell too
-  // expensive, so we wait to walk through the array until the point ids are
-  // needed. This variable keeps track of how far we need to increment.
-  vtkIdType SkippedCells;
-  void CatchUpSkippedCells();
-
   vtkSmartPointer<vtkPoints> UnstructuredGridPoints;
 
 private:
@@ -87,6 +87,7 @@ static int TestScalarLogic();
 static int TestVectorLogic();
 static int TestMiscFunctions();
 static int TestErrors();
+static int TestBatch();
 
 int UnitTestFunctionParser(int,char *[])
 {
@@ -121,6 +122,7 @@ int UnitTestFunctionParser(int,char *[])
 
   status += TestMiscFunctions();
   status += TestErrors();
+  status += TestBatch();
   if (status != 0)
   {
     return EXIT_FAILURE;
@@ -1116,3 +1118,103 @@ int TestErrors()
   }
   return status;
 }
+
+int TestBatch()
+{
+  int status = 0;
+  std::cout << "Testing Batch" << "...";
+
+  vtkSmartPointer<vtkFunctionParser> parser =
+    vtkSmartPointer<vtkFunctionParser>::New();
+  vtkSmartPointer<vtkTest::ErrorObserver> errorObserver =
+    vtkSmartPointer<vtkTest::ErrorObserver>::New();
+  parser->AddObserver(vtkCommand::ErrorEvent, errorObserver);
+
+  // The values of s and v vary, the ones of t and w are constant. Some
+  // values are zero or out of the domain of the functions.
+  const vtkIdType numberOfValues = 300;
+  std::vector<double> s(numberOfValues);
+  std::vector<double> v(3 * numberOfValues);
+  for (vtkIdType i = 0; i < numberOfValues; ++i)
+  {
+    s[i] = (i % 7 == 0) ? 0.0 : vtkMath::Random(-2.0, 2.0);
+    for (int c = 0; c < 3; ++c)
+    {
+      v[3 * i + c] = (i % 11 == 0) ? 0.0 : vtkMath::Random(-2.0, 2.0);
+    }
+  }
+  parser->SetScalarVariableValue("s", 0.0);
+  parser->SetScalarVariableValue("t", 0.5);
+  parser->SetVectorVariableValue("v", 0.0, 0.0, 0.0);
+  parser->SetVectorVariableValue("w", 1.0, -2.0, 3.0);
+  const double* scalarValues[2] = { s.data(), nullptr };
+  const double* vectorValues[2] = { v.data(), nullptr };
+
+  const char* functions[] = {
+    "-s + t - s * t / s ^ 2", "abs(s) + exp(s) + ceil(s) + floor(s)",
+    "ln(s) + log10(s) + sqrt(s)", "sin(s) + cos(s) + tan(s) + atan(s)",
+    "asin(s) + acos(s) + sinh(s) + cosh(s) + tanh(s)",
+    "min(s, t) + max(s, t) + sign(s)",
+    "if(s < t, s, t) + if(s > t, s, t) + if(s = 0, 1, t)",
+    "(s < t) | (s > 1) + (s < t) & (s > 1)", "cross(v, w) + w", "-v",
+    "v . w + mag(v)", "norm(v) - s * v + v * t - v / s",
+    "if(s > 0, v, w) + iHat + jHat + kHat"
+  };
+
+  for (int replace = 0; replace < 2; ++replace)
+  {
+    parser->SetReplaceInvalidValues(replace);
+    parser->SetReplacementValue(-1.0);
+    for (size_t f = 0; f < sizeof(functions) / sizeof(functions[0]); ++f)
+    {
+      parser->SetFunction(functions[f]);
+      int size = parser->IsVectorResult() ? 3 : 1;
+      if (replace && size == 1 && !parser->IsScalarResult())
+      {
+        std::cout << "\nCould not evaluate " << functions[f];
+        status++;
+        continue;
+      }
+      std::vector<double> batch(size * numberOfValues);
+      parser->EvaluateBatch(
+        numberOfValues, scalarValues, vectorValues, batch.data());
+
+      for (vtkIdType i = 0; i < numberOfValues; ++i)
+      {
+        parser->SetScalarVariableValue("s", s[i]);
+        parser->SetVectorVariableValue("v", &v[3 * i]);
+        double expected[3];
+        if (size == 1)
+        {
+          expected[0] = parser->GetScalarResult();
+        }
+        else
+        {
+          parser->GetVectorResult(expected);
+        }
+        for (int c = 0; c < size; ++c)
+        {
+          double value = batch[size * i + c];
+          if (value != expected[c] &&
+              !(vtkMath::IsNan(value) && vtkMath::IsNan(expected[c])))
+          {
+            std::cout << "\n" << functions[f] << " expected "
+                      << expected[c] << " but got " << value;
+            status++;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  if (status == 0)
+  {
+    std::cout << "PASSED\n";
+  }
+  else
+  {
+    std::cout << "FAILED\n";
+  }
+  return status;
+}
@@ -862,6 +862,513 @@ bool vtkFunctionParser::Evaluate()
   return true;
 }
 
+//-----------------------------------------------------------------------------
+namespace
+{
+
+// Number of sets of variable values interpreted together by EvaluateBatch().
+const vtkIdType vtkFunctionParserBlockSize = 128;
+
+// Apply an operation to the top of the stack of each set of a block.
+template <class Operation>
+void vtkApplyUnary(double* x, vtkIdType n, Operation op)
+{
+  for (vtkIdType k = 0; k < n; ++k)
+  {
+    x[k] = op(x[k]);
+  }
+}
+
+// Same for operations whose argument may be invalid, such as log(-1): the
+// result is the replacement value when there is one, or the set is flagged.
+template <class IsInvalid, class Operation>
+void vtkApplyChecked(double* x, vtkIdType n, bool replace,
+                     double replacement, char* invalid, bool& failed,
+                     IsInvalid isInvalid, Operation op)
+{
+  for (vtkIdType k = 0; k < n; ++k)
+  {
+    if (isInvalid(x[k]))
+    {
+      if (replace)
+      {
+        x[k] = replacement;
+      }
+      else
+      {
+        invalid[k] = 1;
+        failed = true;
+      }
+    }
+    else
+    {
+      x[k] = op(x[k]);
+    }
+  }
+}
+
+// Apply x = op(x, y) to the two values on top of the stacks of a block.
+template <class Operation>
+void vtkApplyBinary(double* x, const double* y, vtkIdType n, Operation op)
+{
+  for (vtkIdType k = 0; k < n; ++k)
+  {
+    x[k] = op(x[k], y[k]);
+  }
+}
+
+}
+
+//-----------------------------------------------------------------------------
+bool vtkFunctionParser::EvaluateBatch(vtkIdType numberOfValues,
+                                      const double* const* scalarValues,
+                                      const double* const* vectorValues,
+                                      double* result)
+{
+  if (this->FunctionMTime.GetMTime() > this->ParseMTime.GetMTime())
+  {
+    if (this->Parse() == 0)
+    {
+      return false;
+    }
+  }
+
+  // The stack of the block holds one row of values per stack position.
+  const vtkIdType blockSize = vtkFunctionParserBlockSize;
+  std::vector<double> stack(
+    static_cast<size_t>(this->StackSize + 1) * blockSize);
+  std::vector<char> invalid(blockSize);
+  const int numberOfScalarVariables = this->GetNumberOfScalarVariables();
+  const bool replace = this->ReplaceInvalidValues != 0;
+  const double replacement = this->ReplacementValue;
+  const char* error = nullptr;
+  bool success = true;
+
+  for (vtkIdType begin = 0; begin < numberOfValues; begin += blockSize)
+  {
+    const vtkIdType n = std::min(blockSize, numberOfValues - begin);
+    std::fill(invalid.begin(), invalid.end(), 0);
+    char* inv = invalid.data();
+    bool failed = false;
+    int numImmediatesProcessed = 0;
+    int stackPosition = -1;
+#define vtkStackRow(position) (stack.data() + (position) * blockSize)
+
+    for (int numBytesProcessed = 0; numBytesProcessed < this->ByteCodeSize;
+         numBytesProcessed++)
+    {
+      double* x = stackPosition >= 0 ? vtkStackRow(stackPosition) : nullptr;
+      double* y = stackPosition >= 1 ? vtkStackRow(stackPosition - 1) :
+        nullptr;
+      switch (this->ByteCode[numBytesProcessed])
+      {
+        case VTK_PARSER_IMMEDIATE:
+          x = vtkStackRow(++stackPosition);
+          std::fill(x, x + n, this->Immediates[numImmediatesProcessed++]);
+          break;
+        case VTK_PARSER_UNARY_MINUS:
+          vtkApplyUnary(x, n, [](double a) { return -a; });
+          break;
+        case VTK_PARSER_UNARY_PLUS:
+          break;
+        case VTK_PARSER_ADD:
+          vtkApplyBinary(y, x, n, [](double a, double b) { return a + b; });
+          stackPosition--;
+          break;
+        case VTK_PARSER_SUBTRACT:
+          vtkApplyBinary(y, x, n, [](double a, double b) { return a - b; });
+          stackPosition--;
+          break;
+        case VTK_PARSER_MULTIPLY:
+          vtkApplyBinary(y, x, n, [](double a, double b) { return a * b; });
+          stackPosition--;
+          break;
+        case VTK_PARSER_DIVIDE:
+          for (vtkIdType k = 0; k < n; ++k)
+          {
+            if (x[k] == 0)
+            {
+              if (replace)
+              {
+                y[k] = replacement;
+              }
+              else
+              {
+                inv[k] = 1;
+                failed = true;
+              }
+            }
+            else
+            {
+              y[k] /= x[k];
+            }
+          }
+          if (failed && !error)
+          {
+            error = "Trying to divide by zero";
+          }
+          stackPosition--;
+          break;
+        case VTK_PARSER_POWER:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return pow(a, b); });
+          stackPosition--;
+          break;
+        case VTK_PARSER_ABSOLUTE_VALUE:
+          vtkApplyUnary(x, n, [](double a) { return fabs(a); });
+          break;
+        case VTK_PARSER_EXPONENT:
+          vtkApplyUnary(x, n, [](double a) { return exp(a); });
+          break;
+        case VTK_PARSER_CEILING:
+          vtkApplyUnary(x, n, [](double a) { return ceil(a); });
+          break;
+        case VTK_PARSER_FLOOR:
+          vtkApplyUnary(x, n, [](double a) { return floor(a); });
+          break;
+        case VTK_PARSER_LOGARITHM:
+        case VTK_PARSER_LOGARITHME:
+          vtkApplyChecked(x, n, replace, replacement, inv, failed,
+                          [](double a) { return a <= 0; },
+                          [](double a) { return log(a); });
+          if (failed && !error)
+          {
+            error = "Trying to take a log of a non-positive value";
+          }
+          break;
+        case VTK_PARSER_LOGARITHM10:
+          vtkApplyChecked(x, n, replace, replacement, inv, failed,
+                          [](double a) { return a <= 0; },
+                          [](double a) { return log10(a); });
+          if (failed && !error)
+          {
+            error = "Trying to take a log10 of a non-positive value";
+          }
+          break;
+        case VTK_PARSER_SQUARE_ROOT:
+          vtkApplyChecked(x, n, replace, replacement, inv, failed,
+                          [](double a) { return a < 0; },
+                          [](double a) { return sqrt(a); });
+          if (failed && !error)
+          {
+            error = "Trying to take a square root of a negative value";
+          }
+          break;
+        case VTK_PARSER_SINE:
+          vtkApplyUnary(x, n, [](double a) { return sin(a); });
+          break;
+        case VTK_PARSER_COSINE:
+          vtkApplyUnary(x, n, [](double a) { return cos(a); });
+          break;
+        case VTK_PARSER_TANGENT:
+          vtkApplyUnary(x, n, [](double a) { return tan(a); });
+          break;
+        case VTK_PARSER_ARCSINE:
+          vtkApplyChecked(x, n, replace, replacement, inv, failed,
+                          [](double a) { return a < -1 || a > 1; },
+                          [](double a) { return asin(a); });
+          if (failed && !error)
+          {
+            error = "Trying to take asin of a value < -1 or > 1";
+          }
+          break;
+        case VTK_PARSER_ARCCOSINE:
+          vtkApplyChecked(x, n, replace, replacement, inv, failed,
+                          [](double a) { return a < -1 || a > 1; },
+                          [](double a) { return acos(a); });
+          if (failed && !error)
+          {
+            error = "Trying to take acos of a value < -1 or > 1";
+          }
+          break;
+        case VTK_PARSER_ARCTANGENT:
+          vtkApplyUnary(x, n, [](double a) { return atan(a); });
+          break;
+        case VTK_PARSER_HYPERBOLIC_SINE:
+          vtkApplyUnary(x, n, [](double a) { return sinh(a); });
+          break;
+        case VTK_PARSER_HYPERBOLIC_COSINE:
+          vtkApplyUnary(x, n, [](double a) { return cosh(a); });
+          break;
+        case VTK_PARSER_HYPERBOLIC_TANGENT:
+          vtkApplyUnary(x, n, [](double a) { return tanh(a); });
+          break;
+        case VTK_PARSER_MIN:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return b < a ? b : a; });
+          stackPosition--;
+          break;
+        case VTK_PARSER_MAX:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return b > a ? b : a; });
+          stackPosition--;
+          break;
+        case VTK_PARSER_CROSS:
+        {
+          double* ux = vtkStackRow(stackPosition - 5);
+          double* uy = vtkStackRow(stackPosition - 4);
+          double* uz = vtkStackRow(stackPosition - 3);
+          const double* vx = vtkStackRow(stackPosition - 2);
+          const double* vy = vtkStackRow(stackPosition - 1);
+          const double* vz = vtkStackRow(stackPosition);
+          for (vtkIdType k = 0; k < n; ++k)
+          {
+            double cx = uy[k] * vz[k] - uz[k] * vy[k];
+            double cy = uz[k] * vx[k] - ux[k] * vz[k];
+            double cz = ux[k] * vy[k] - uy[k] * vx[k];
+            ux[k] = cx;
+            uy[k] = cy;
+            uz[k] = cz;
+          }
+          stackPosition -= 3;
+          break;
+        }
+        case VTK_PARSER_SIGN:
+          vtkApplyUnary(x, n, [](double a)
+                        { return a < 0 ? -1.0 : (a == 0 ? 0.0 : 1.0); });
+          break;
+        case VTK_PARSER_VECTOR_UNARY_MINUS:
+          for (int c = 0; c < 3; ++c)
+          {
+            vtkApplyUnary(vtkStackRow(stackPosition - c), n,
+                          [](double a) { return -a; });
+          }
+          break;
+        case VTK_PARSER_VECTOR_UNARY_PLUS:
+          break;
+        case VTK_PARSER_DOT_PRODUCT:
+        {
+          double* ux = vtkStackRow(stackPosition - 5);
+          const double* uy = vtkStackRow(stackPosition - 4);
+          const double* uz = vtkStackRow(stackPosition - 3);
+          const double* vx = vtkStackRow(stackPosition - 2);
+          const double* vy = vtkStackRow(stackPosition - 1);
+          const double* vz = vtkStackRow(stackPosition);
+          for (vtkIdType k = 0; k < n; ++k)
+          {
+            double pz = uz[k] * vz[k];
+            double py = uy[k] * vy[k];
+            double px = ux[k] * vx[k];
+            ux[k] = px + py + pz;
+          }
+          stackPosition -= 5;
+          break;
+        }
+        case VTK_PARSER_VECTOR_ADD:
+        case VTK_PARSER_VECTOR_SUBTRACT:
+        {
+          const bool add =
+            this->ByteCode[numBytesProcessed] == VTK_PARSER_VECTOR_ADD;
+          for (int c = 0; c < 3; ++c)
+          {
+            double* u = vtkStackRow(stackPosition - 3 - c);
+            const double* v = vtkStackRow(stackPosition - c);
+            if (add)
+            {
+              vtkApplyBinary(u, v, n,
+                             [](double a, double b) { return a + b; });
+            }
+            else
+            {
+              vtkApplyBinary(u, v, n,
+                             [](double a, double b) { return a - b; });
+            }
+          }
+          stackPosition -= 3;
+          break;
+        }
+        case VTK_PARSER_SCALAR_TIMES_VECTOR:
+        {
+          // The scaled vector replaces the scalar below the vector.
+          double* s = vtkStackRow(stackPosition - 3);
+          double* vx = vtkStackRow(stackPosition - 2);
+          double* vy = vtkStackRow(stackPosition - 1);
+          const double* vz = vtkStackRow(stackPosition);
+          for (vtkIdType k = 0; k < n; ++k)
+          {
+            double scale = s[k];
+            s[k] = vx[k] * scale;
+            vx[k] = vy[k] * scale;
+            vy[k] = vz[k] * scale;
+          }
+          stackPosition--;
+          break;
+        }
+        case VTK_PARSER_VECTOR_TIMES_SCALAR:
+          for (int c = 1; c <= 3; ++c)
+          {
+            vtkApplyBinary(vtkStackRow(stackPosition - c), x, n,
+                           [](double a, double b) { return a * b; });
+          }
+          stackPosition--;
+          break;
+        case VTK_PARSER_VECTOR_OVER_SCALAR:
+          for (int c = 1; c <= 3; ++c)
+          {
+            vtkApplyBinary(vtkStackRow(stackPosition - c), x, n,
+                           [](double a, double b)
+                           { return b != 0.0 ? a / b : a; });
+          }
+          stackPosition--;
+          break;
+        case VTK_PARSER_MAGNITUDE:
+        case VTK_PARSER_NORMALIZE:
+        {
+          double* vx = vtkStackRow(stackPosition - 2);
+          double* vy = vtkStackRow(stackPosition - 1);
+          double* vz = vtkStackRow(stackPosition);
+          if (this->ByteCode[numBytesProcessed] == VTK_PARSER_MAGNITUDE)
+          {
+            for (vtkIdType k = 0; k < n; ++k)
+            {
+              vx[k] = sqrt(pow(vz[k], 2) + pow(vy[k], 2) + pow(vx[k], 2));
+            }
+            stackPosition -= 2;
+          }
+          else
+          {
+            for (vtkIdType k = 0; k < n; ++k)
+            {
+              double magnitude =
+                sqrt(pow(vz[k], 2) + pow(vy[k], 2) + pow(vx[k], 2));
+              if (magnitude != 0)
+              {
+                vz[k] /= magnitude;
+                vy[k] /= magnitude;
+                vx[k] /= magnitude;
+              }
+            }
+          }
+          break;
+        }
+        case VTK_PARSER_IHAT:
+        case VTK_PARSER_JHAT:
+        case VTK_PARSER_KHAT:
+        {
+          const int one =
+            this->ByteCode[numBytesProcessed] - VTK_PARSER_IHAT;
+          for (int c = 0; c < 3; ++c)
+          {
+            x = vtkStackRow(++stackPosition);
+            std::fill(x, x + n, c == one ? 1.0 : 0.0);
+          }
+          break;
+        }
+        case VTK_PARSER_LESS_THAN:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return double(a < b); });
+          stackPosition--;
+          break;
+        case VTK_PARSER_GREATER_THAN:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return double(a > b); });
+          stackPosition--;
+          break;
+        case VTK_PARSER_EQUAL_TO:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return double(a == b); });
+          stackPosition--;
+          break;
+        case VTK_PARSER_AND:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return double(a && b); });
+          stackPosition--;
+          break;
+        case VTK_PARSER_OR:
+          vtkApplyBinary(y, x, n,
+                         [](double a, double b) { return double(a || b); });
+          stackPosition--;
+          break;
+        case VTK_PARSER_IF:
+        case VTK_PARSER_VECTOR_IF:
+        {
+          // The boolean is on top of the true and false values, the result
+          // replaces the false value.
+          const int size =
+            this->ByteCode[numBytesProcessed] == VTK_PARSER_IF ? 1 : 3;
+          for (int c = 0; c < size; ++c)
+          {
+            double* valFalse = vtkStackRow(stackPosition - 2 * size + c);
+            const double* valTrue = vtkStackRow(stackPosition - size + c);
+            for (vtkIdType k = 0; k < n; ++k)
+            {
+              valFalse[k] = x[k] != 0.0 ? valTrue[k] : valFalse[k];
+            }
+          }
+          stackPosition -= size + 1;
+          break;
+        }
+        default:
+        {
+          int variable =
+            this->ByteCode[numBytesProcessed] - VTK_PARSER_BEGIN_VARIABLES;
+          if (variable < numberOfScalarVariables)
+          {
+            x = vtkStackRow(++stackPosition);
+            const double* values =
+              scalarValues ? scalarValues[variable] : nullptr;
+            if (values)
+            {
+              std::copy(values + begin, values + begin + n, x);
+            }
+            else
+            {
+              std::fill(x, x + n, this->ScalarVariableValues[variable]);
+            }
+          }
+          else
+          {
+            variable -= numberOfScalarVariables;
+            const double* values =
+              vectorValues ? vectorValues[variable] : nullptr;
+            for (int c = 0; c < 3; ++c)
+            {
+              x = vtkStackRow(++stackPosition);
+              if (values)
+              {
+                for (vtkIdType k = 0; k < n; ++k)
+                {
+                  x[k] = values[3 * (begin + k) + c];
+                }
+              }
+              else
+              {
+                std::fill(x, x + n, this->VectorVariableValues[variable][c]);
+              }
+            }
+          }
+        }
+      }
+    }
+
+    // Gather the results of the block, scalar or vector as IsScalarResult()
+    // and IsVectorResult() tell.
+    const int size = stackPosition + 1;
+    if (size != 1 && size != 3)
+    {
+      vtkErrorMacro("EvaluateBatch: the function has no valid result");
+      return false;
+    }
+    for (int c = 0; c < size; ++c)
+    {
+      const double* row = vtkStackRow(c);
+      double* out = result + size * begin + c;
+      for (vtkIdType k = 0; k < n; ++k)
+      {
+        out[size * k] = inv[k] ? VTK_PARSER_ERROR_RESULT : row[k];
+      }
+    }
+#undef vtkStackRow
+    success = success && !failed;
+  }
+
+  if (error)
+  {
+    vtkErrorMacro(<< error);
+  }
+  return success;
+}
+
 //-----------------------------------------------------------------------------
 int vtkFunctionParser::IsScalarResult()
 {
@@ -177,6 +177,31 @@ public:
     result[0] = r[0]; result[1] = r[1]; result[2] = r[2]; };
   //@}
 
+  /**
+   * Evaluate the function for numberOfValues sets of variable values at
+   * once. scalarValues[i] points to the numberOfValues values of the ith
+   * scalar variable and vectorValues[i] to the 3*numberOfValues interleaved
+   * components of the ith vector variable. A null pointer, for a variable or
+   * for all of them, stands for the value set with SetScalarVariableValue()
+   * or SetVectorVariableValue(). result receives one value per set for a
+   * scalar function and three for a vector function, as given by
+   * IsScalarResult() and IsVectorResult().
+   *
+   * The byte code is interpreted on blocks of values so that each
+   * operation is a loop the compiler can vectorize, and the results are
+   * those of GetScalarResult() and GetVectorResult(): invalid values are
+   * replaced by ReplacementValue when ReplaceInvalidValues is on, and
+   * otherwise make the result of their set VTK_PARSER_ERROR_RESULT.
+   * Returns false if the function can not be parsed or an invalid value
+   * was not replaced.
+   *
+   * Once the function is parsed, for instance by IsScalarResult(), this
+   * method does not modify the parser and may be called concurrently.
+   */
+  bool EvaluateBatch(vtkIdType numberOfValues,
+                     const double* const* scalarValues,
+                     const double* const* vectorValues, double* result);
+
   //@{
   /**
    * Set the value of a scalar variable.  If a variable with this name
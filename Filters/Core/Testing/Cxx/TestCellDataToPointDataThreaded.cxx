@@ -0,0 +1,254 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCellDataToPointDataThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkCellDataToPointData and vtkPointDataToCellData give the
+// same values in parallel as sequentially, on structured and unstructured
+// datasets, for arrays of several types, and that these values are the
+// averages of the values of the cells using each point, or of the points of
+// each cell.
+
+#include "vtkCellData.h"
+#include "vtkCellDataToPointData.h"
+#include "vtkDataSetTriangleFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPointDataToCellData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+
+namespace
+{
+
+void AddArrays(vtkDataSetAttributes* attributes, vtkIdType numTuples)
+{
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  vtkNew<vtkUnsignedCharArray> chars;
+  chars->SetName("Chars");
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    vectors->InsertNextTuple3(0.1 * i, sin(0.37 * i), 1.0e6 / (i + 1));
+    ints->InsertNextValue(static_cast<int>((i * 7919) % 1001) - 500);
+    chars->InsertNextValue(static_cast<unsigned char>((i * 31) % 256));
+  }
+  attributes->AddArray(vectors);
+  attributes->AddArray(ints);
+  attributes->AddArray(chars);
+}
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+vtkSmartPointer<vtkDataSet> CellToPoint(vtkDataSet* input, int option)
+{
+  vtkNew<vtkCellDataToPointData> filter;
+  filter->SetInputData(input);
+  filter->SetContributingCellOption(option);
+  filter->Update();
+  return filter->GetOutput();
+}
+
+vtkSmartPointer<vtkDataSet> PointToCell(vtkDataSet* input)
+{
+  vtkNew<vtkPointDataToCellData> filter;
+  filter->SetInputData(input);
+  filter->Update();
+  return filter->GetOutput();
+}
+
+// The point vectors are the averages of the vectors of the cells using the
+// points, and the cell vectors the averages of the vectors of their points.
+bool TestAverages(vtkDataSet* input, const char* label)
+{
+  vtkSmartPointer<vtkDataSet> points;
+  vtkSmartPointer<vtkDataSet> cells;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+    points = CellToPoint(input, vtkCellDataToPointData::All);
+    cells = PointToCell(input);
+  });
+
+  vtkDataArray* pointVectors = points->GetPointData()->GetArray("Vectors");
+  vtkDataArray* cellVectors = input->GetCellData()->GetArray("Vectors");
+  vtkNew<vtkIdList> ids;
+  for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+  {
+    input->GetPointCells(ptId, ids);
+    for (int c = 0; c < 3 && ids->GetNumberOfIds() > 0; ++c)
+    {
+      double sum = 0.0;
+      for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+      {
+        sum += cellVectors->GetComponent(ids->GetId(i), c);
+      }
+      double expected = sum / ids->GetNumberOfIds();
+      if (fabs(pointVectors->GetComponent(ptId, c) - expected) >
+          1e-12 * (1.0 + fabs(expected)))
+      {
+        cerr << "Wrong average at point " << ptId << " of " << label << endl;
+        return false;
+      }
+    }
+  }
+
+  cellVectors = cells->GetCellData()->GetArray("Vectors");
+  pointVectors = input->GetPointData()->GetArray("Vectors");
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    input->GetCellPoints(cellId, ids);
+    for (int c = 0; c < 3; ++c)
+    {
+      double sum = 0.0;
+      for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+      {
+        sum += pointVectors->GetComponent(ids->GetId(i), c);
+      }
+      double expected = sum / ids->GetNumberOfIds();
+      if (fabs(cellVectors->GetComponent(cellId, c) - expected) >
+          1e-12 * (1.0 + fabs(expected)))
+      {
+        cerr << "Wrong average at cell " << cellId << " of " << label << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TestDataSet(vtkDataSet* input, const char* label)
+{
+  for (int option = 0; option < 4; ++option)
+  {
+    vtkSmartPointer<vtkDataSet> serial;
+    vtkSmartPointer<vtkDataSet> threaded;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+      serial = option < 3 ? CellToPoint(input, option) : PointToCell(input);
+    });
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+      threaded = option < 3 ? CellToPoint(input, option) : PointToCell(input);
+    });
+    if (!SameArrays(serial->GetPointData(), threaded->GetPointData()) ||
+        !SameArrays(serial->GetCellData(), threaded->GetCellData()))
+    {
+      cerr << "Wrong " << (option < 3 ? "point" : "cell") << " data for "
+           << label << " (option " << option << ")" << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+int TestCellDataToPointDataThreaded(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 19, -2, 14, 3, 15);
+  AddArrays(image->GetPointData(), image->GetNumberOfPoints());
+  AddArrays(image->GetCellData(), image->GetNumberOfCells());
+
+  // The corner points use a single cell.
+  vtkSmartPointer<vtkDataSet> output =
+    CellToPoint(image, vtkCellDataToPointData::All);
+  vtkDataArray* ints = output->GetPointData()->GetArray("Ints");
+  vtkIdType lastPoint = image->GetNumberOfPoints() - 1;
+  vtkIdType lastCell = image->GetNumberOfCells() - 1;
+  if (ints->GetTuple1(0) != image->GetCellData()->GetArray("Ints")->GetTuple1(0) ||
+      ints->GetTuple1(lastPoint) !=
+        image->GetCellData()->GetArray("Ints")->GetTuple1(lastCell))
+  {
+    cerr << "Wrong point data at the corners of the image" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkStructuredGrid> grid;
+  grid->SetDimensions(12, 9, 7);
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < 7; ++k)
+  {
+    for (int j = 0; j < 9; ++j)
+    {
+      for (int i = 0; i < 12; ++i)
+      {
+        points->InsertNextPoint(i, j + 0.1 * i, k);
+      }
+    }
+  }
+  grid->SetPoints(points);
+  AddArrays(grid->GetPointData(), grid->GetNumberOfPoints());
+  AddArrays(grid->GetCellData(), grid->GetNumberOfCells());
+
+  vtkNew<vtkDataSetTriangleFilter> tetrahedralize;
+  tetrahedralize->SetInputData(image);
+  tetrahedralize->Update();
+  vtkUnstructuredGrid* tetras = tetrahedralize->GetOutput();
+  tetras->GetPointData()->Initialize();
+  tetras->GetCellData()->Initialize();
+  AddArrays(tetras->GetPointData(), tetras->GetNumberOfPoints());
+
+  // Add a few triangles and vertices, so that the contributing cell options
+  // make a difference.
+  for (vtkIdType i = 0; i < tetras->GetNumberOfPoints() - 2; i += 13)
+  {
+    vtkIdType triangle[3] = { i, i + 1, i + 2 };
+    tetras->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+    tetras->InsertNextCell(VTK_VERTEX, 1, triangle);
+  }
+  AddArrays(tetras->GetCellData(), tetras->GetNumberOfCells());
+
+  if (!TestAverages(image, "image data") ||
+      !TestAverages(tetras, "unstructured grid") ||
+      !TestDataSet(image, "image data") ||
+      !TestDataSet(grid, "structured grid") ||
+      !TestDataSet(tetras, "unstructured grid"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,384 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestConnectivityFilterThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkConnectivityFilter and vtkPolyDataConnectivityFilter find
+// the same regions with ParallelConnectivity as with the wave propagation
+// (same cells, region ids and region sizes; the points are numbered
+// differently), in all the extraction modes, with and without scalar
+// connectivity, and that the parallel labeling does not depend on the
+// number of threads.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkConnectivityFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataConnectivityFilter.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+
+namespace
+{
+
+// Arrays whose size is the number of tuples of the dataset are compared
+// entirely, the other ones (the region ids of the input cells and points
+// which are not extracted are not set) are compared on their first tuples.
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b,
+                vtkIdType numTuples)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfComponents() != arrayB->GetNumberOfComponents())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < numTuples * arrayA->GetNumberOfComponents(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameRegionSizes(vtkIdTypeArray* a, vtkIdTypeArray* b)
+{
+  if (a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetValue(i) != b->GetValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Same cells, made of the same input points (compared through their
+// coordinates and data) but possibly numbered differently. If exact, the
+// point numbering must be the same too.
+bool SameOutput(vtkPointSet* a, vtkPointSet* b, bool exact, bool compareCellData)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+      a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType i = 0; i < a->GetNumberOfCells(); ++i)
+  {
+    a->GetCellPoints(i, ptsA);
+    b->GetCellPoints(i, ptsB);
+    if (a->GetCellType(i) != b->GetCellType(i) ||
+        ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < ptsA->GetNumberOfIds(); ++j)
+    {
+      const vtkIdType idA = ptsA->GetId(j);
+      const vtkIdType idB = ptsB->GetId(j);
+      if (exact && idA != idB)
+      {
+        return false;
+      }
+      double x[3];
+      double y[3];
+      a->GetPoint(idA, x);
+      b->GetPoint(idB, y);
+      if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+      {
+        return false;
+      }
+      vtkPointData* pdA = a->GetPointData();
+      vtkPointData* pdB = b->GetPointData();
+      for (int k = 0; k < pdA->GetNumberOfArrays(); ++k)
+      {
+        vtkDataArray* arrayB = pdB->GetArray(pdA->GetArray(k)->GetName());
+        if (!arrayB ||
+            pdA->GetArray(k)->GetComponent(idA, 0) != arrayB->GetComponent(idB, 0))
+        {
+          return false;
+        }
+      }
+    }
+  }
+  return !compareCellData ||
+    SameArrays(a->GetCellData(), b->GetCellData(), a->GetNumberOfCells());
+}
+
+// Cells of a grid, some of them missing, so that the remaining ones form
+// many regions, some touching by a single point.
+bool KeepCell(int i, int j, int k)
+{
+  return ((i * 7 + j * 13 + k * 5 + (i * j) % 3) % 5) != 0;
+}
+
+vtkSmartPointer<vtkPolyData> MakePolyData()
+{
+  const int res = 60;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (int j = 0; j <= res; ++j)
+  {
+    for (int i = 0; i <= res; ++i)
+    {
+      points->InsertNextPoint(i + 0.1 * sin(1.7 * j), j, 0.2 * cos(0.3 * i));
+      scalars->InsertNextValue(sin(0.21 * i) * cos(0.17 * j));
+    }
+  }
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkCellArray> lines;
+  vtkNew<vtkCellArray> verts;
+  for (int j = 0; j < res; ++j)
+  {
+    for (int i = 0; i < res; ++i)
+    {
+      vtkIdType p0 = i + (res + 1) * j;
+      vtkIdType quad[4] = { p0, p0 + 1, p0 + res + 2, p0 + res + 1 };
+      if (KeepCell(i, j, 0))
+      {
+        vtkIdType tri[3] = { quad[0], quad[1], quad[2] };
+        polys->InsertNextCell(3, tri);
+        tri[1] = quad[2];
+        tri[2] = quad[3];
+        polys->InsertNextCell(3, tri);
+      }
+      else if ((i + j) % 7 == 0)
+      {
+        lines->InsertNextCell(2, quad);
+      }
+      else if ((i + 2 * j) % 11 == 0)
+      {
+        verts->InsertNextCell(1, quad + 2);
+      }
+    }
+  }
+  vtkSmartPointer<vtkPolyData> polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+  polyData->SetLines(lines);
+  polyData->SetVerts(verts);
+  polyData->GetPointData()->SetScalars(scalars);
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellIds");
+  for (vtkIdType i = 0; i < polyData->GetNumberOfCells(); ++i)
+  {
+    cellIds->InsertNextValue(i);
+  }
+  polyData->GetCellData()->AddArray(cellIds);
+  return polyData;
+}
+
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  const int res = 16;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (int k = 0; k <= res; ++k)
+  {
+    for (int j = 0; j <= res; ++j)
+    {
+      for (int i = 0; i <= res; ++i)
+      {
+        points->InsertNextPoint(i, j + 0.05 * sin(1.3 * i), k);
+        scalars->InsertNextValue(sin(0.3 * i) + cos(0.4 * j) * sin(0.2 * k));
+      }
+    }
+  }
+  vtkSmartPointer<vtkUnstructuredGrid> grid =
+    vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  const vtkIdType dj = res + 1;
+  const vtkIdType dk = (res + 1) * (res + 1);
+  for (int k = 0; k < res; ++k)
+  {
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        vtkIdType p0 = i + dj * j + dk * k;
+        vtkIdType hex[8] = { p0, p0 + 1, p0 + 1 + dj, p0 + dj, p0 + dk,
+          p0 + 1 + dk, p0 + 1 + dj + dk, p0 + dj + dk };
+        if (KeepCell(i, j, k) && KeepCell(j, k, i))
+        {
+          grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+        }
+        else if ((i + j + k) % 4 == 0)
+        {
+          grid->InsertNextCell(VTK_TETRA, 4, hex);
+        }
+      }
+    }
+  }
+  grid->GetPointData()->SetScalars(scalars);
+  return grid;
+}
+
+vtkSmartPointer<vtkImageData> MakeImage()
+{
+  vtkSmartPointer<vtkImageData> image = vtkSmartPointer<vtkImageData>::New();
+  image->SetDimensions(18, 15, 12);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    image->GetPoint(i, x);
+    scalars->InsertNextValue(sin(0.9 * x[0]) * cos(0.7 * x[1]) + 0.1 * x[2]);
+  }
+  image->GetPointData()->SetScalars(scalars);
+  return image;
+}
+
+// Options: the extraction mode and, in the higher bits, the scalar
+// connectivity, full scalar connectivity and region id assignment.
+template <typename FilterT>
+void Configure(FilterT* filter, int option, bool parallel)
+{
+  const int mode = option % 6 + 1;
+  filter->SetExtractionMode(mode);
+  filter->SetParallelConnectivity(parallel);
+  filter->ColorRegionsOn();
+  filter->SetScalarConnectivity((option / 6) % 2);
+  filter->SetScalarRange(-0.2, 0.4);
+  filter->SetClosestPoint(7.3, 4.1, 2.0);
+  filter->InitializeSeedList();
+  filter->AddSeed(mode == VTK_EXTRACT_POINT_SEEDED_REGIONS ? 100 : 7);
+  filter->AddSeed(mode == VTK_EXTRACT_POINT_SEEDED_REGIONS ? 1900 : 900);
+  filter->InitializeSpecifiedRegionList();
+  filter->AddSpecifiedRegion(0);
+  filter->AddSpecifiedRegion(2);
+  filter->AddSpecifiedRegion(5);
+}
+
+vtkSmartPointer<vtkPointSet> Connectivity(vtkDataSet* input, int option,
+                                          bool parallel,
+                                          vtkSmartPointer<vtkIdTypeArray>& sizes)
+{
+  vtkNew<vtkConnectivityFilter> connectivity;
+  connectivity->SetInputData(input);
+  Configure(connectivity.GetPointer(), option, parallel);
+  if (option / 12 == 1 && option % 6 + 1 == VTK_EXTRACT_ALL_REGIONS)
+  {
+    connectivity->SetRegionIdAssignmentMode(
+      vtkConnectivityFilter::CELL_COUNT_DESCENDING);
+  }
+  connectivity->Update();
+  // The region sizes are not exposed by vtkConnectivityFilter.
+  sizes = vtkSmartPointer<vtkIdTypeArray>::New();
+  sizes->InsertNextValue(connectivity->GetNumberOfExtractedRegions());
+  return connectivity->GetOutput();
+}
+
+vtkSmartPointer<vtkPointSet> PolyDataConnectivity(vtkDataSet* input, int option,
+                                                  bool parallel,
+                                                  vtkSmartPointer<vtkIdTypeArray>& sizes)
+{
+  vtkNew<vtkPolyDataConnectivityFilter> connectivity;
+  connectivity->SetInputData(input);
+  Configure(connectivity.GetPointer(), option, parallel);
+  connectivity->SetFullScalarConnectivity(option / 12 == 1);
+  connectivity->Update();
+  sizes = vtkSmartPointer<vtkIdTypeArray>::New();
+  sizes->DeepCopy(connectivity->GetRegionSizes());
+  return connectivity->GetOutput();
+}
+
+bool TestInput(vtkDataSet* input, bool polyDataFilter, const char* label)
+{
+  auto run = polyDataFilter ? PolyDataConnectivity : Connectivity;
+  for (int option = 0; option < 24; ++option)
+  {
+    vtkSmartPointer<vtkIdTypeArray> sizes[3];
+    vtkSmartPointer<vtkPointSet> wave = run(input, option, false, sizes[0]);
+    vtkSmartPointer<vtkPointSet> serial;
+    vtkSmartPointer<vtkPointSet> threaded;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+      serial = run(input, option, true, sizes[1]);
+    });
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+      threaded = run(input, option, true, sizes[2]);
+    });
+
+    // The region ids of the input cells are only set for the extracted
+    // cells in the seeded modes.
+    const int mode = option % 6 + 1;
+    const bool allCellsVisited = mode == VTK_EXTRACT_SPECIFIED_REGIONS ||
+      mode == VTK_EXTRACT_LARGEST_REGION || mode == VTK_EXTRACT_ALL_REGIONS;
+    if (wave->GetNumberOfCells() == 0 ||
+        !SameRegionSizes(sizes[0], sizes[1]) ||
+        !SameOutput(wave, serial, false, allCellsVisited))
+    {
+      cerr << "Wrong regions for " << label << " (option " << option << "): "
+           << serial->GetNumberOfCells() << " cells in "
+           << sizes[1]->GetNumberOfValues() << " regions instead of "
+           << wave->GetNumberOfCells() << " cells in "
+           << sizes[0]->GetNumberOfValues() << " regions" << endl;
+      return false;
+    }
+    if (!SameRegionSizes(sizes[1], sizes[2]) ||
+        !SameOutput(serial, threaded, true, true) ||
+        !SameArrays(serial->GetPointData(), threaded->GetPointData(),
+                    serial->GetNumberOfPoints()))
+    {
+      cerr << "Wrong parallel output for " << label << " (option " << option
+           << ")" << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+int TestConnectivityFilterThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> polyData = MakePolyData();
+  vtkSmartPointer<vtkUnstructuredGrid> grid = MakeGrid();
+  vtkSmartPointer<vtkImageData> image = MakeImage();
+
+  if (!TestInput(polyData, true, "polydata") ||
+      !TestInput(polyData, false, "polydata (vtkConnectivityFilter)") ||
+      !TestInput(grid, false, "unstructured grid") ||
+      !TestInput(image, false, "image data"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
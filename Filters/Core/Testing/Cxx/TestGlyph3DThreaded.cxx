@@ -0,0 +1,351 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestGlyph3DThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkGlyph3D and vtkTensorGlyph generate the same glyphs in
+// parallel as sequentially (same points, cells, normals and data), for
+// sources made of one kind of cells and for sources the filters glyph
+// sequentially, and that unoriented glyphs are placed where expected.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkGlyph3D.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTensorGlyph.h"
+#include "vtkTransform.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cmath>
+
+namespace
+{
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SamePolyData(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+      a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType i = 0; i < a->GetNumberOfCells(); ++i)
+  {
+    a->GetCellPoints(i, ptsA);
+    b->GetCellPoints(i, ptsB);
+    if (a->GetCellType(i) != b->GetCellType(i) ||
+        ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < ptsA->GetNumberOfIds(); ++j)
+    {
+      if (ptsA->GetId(j) != ptsB->GetId(j))
+      {
+        return false;
+      }
+    }
+  }
+  return SameArrays(a->GetPointData(), b->GetPointData()) &&
+    SameArrays(a->GetCellData(), b->GetCellData());
+}
+
+vtkSmartPointer<vtkPolyData> MakeInput()
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkDoubleArray> tensors;
+  tensors->SetName("Tensors");
+  tensors->SetNumberOfComponents(9);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  for (vtkIdType i = 0; i < 1000; ++i)
+  {
+    points->InsertNextPoint(0.01 * i * sin(0.1 * i), cos(0.13 * i), 0.002 * i);
+    if (i % 17 == 0)
+    {
+      vectors->InsertNextTuple3(-1.5, 0.0, 0.0);
+    }
+    else
+    {
+      vectors->InsertNextTuple3(sin(0.3 * i), cos(0.7 * i), sin(0.11 * i) - 0.2);
+    }
+    scalars->InsertNextValue(i % 23 == 0 ? 0.0 : 1.5 * sin(0.05 * i));
+    double tensor[9];
+    for (int j = 0; j < 9; ++j)
+    {
+      tensor[j] = sin(0.37 * i + 1.3 * j) * (j % 4 == 0 ? 2.0 : 0.6);
+    }
+    tensors->InsertNextTuple(tensor);
+    ints->InsertNextValue(static_cast<int>((i * 7919) % 1001) - 500);
+    ghosts->InsertNextValue(
+      i % 31 == 0 ? vtkDataSetAttributes::DUPLICATEPOINT : 0);
+  }
+
+  vtkSmartPointer<vtkPolyData> input = vtkSmartPointer<vtkPolyData>::New();
+  input->SetPoints(points);
+  input->GetPointData()->SetVectors(vectors);
+  input->GetPointData()->SetScalars(scalars);
+  input->GetPointData()->SetTensors(tensors);
+  input->GetPointData()->AddArray(ints);
+  input->GetPointData()->AddArray(ghosts);
+  return input;
+}
+
+vtkSmartPointer<vtkPolyData> Glyph(vtkPolyData* input, vtkPolyData* source,
+                                   int option)
+{
+  vtkNew<vtkGlyph3D> glyph;
+  glyph->SetInputData(input);
+  glyph->SetSourceData(source);
+  glyph->SetScaleMode(option % 4);
+  glyph->SetColorMode((option / 4) % 3);
+  glyph->SetClamping(option % 7 == 1);
+  glyph->SetRange(-0.5, 1.2);
+  glyph->SetScaleFactor(0.37);
+  glyph->SetFillCellData(option % 2);
+  glyph->SetGeneratePointIds(option % 3 == 0);
+  if (option % 5 == 1)
+  {
+    glyph->SetOutputPointsPrecision(vtkAlgorithm::DOUBLE_PRECISION);
+  }
+  if (option % 6 == 5)
+  {
+    vtkNew<vtkTransform> transform;
+    transform->RotateX(30.0);
+    transform->Scale(1.0, 2.0, 0.5);
+    glyph->SetSourceTransform(transform);
+  }
+  glyph->Update();
+  return glyph->GetOutput();
+}
+
+vtkSmartPointer<vtkPolyData> TensorGlyph(vtkPolyData* input,
+                                         vtkPolyData* source, int option)
+{
+  vtkNew<vtkTensorGlyph> glyph;
+  glyph->SetInputData(input);
+  glyph->SetSourceData(source);
+  glyph->SetThreeGlyphs(option % 2);
+  glyph->SetSymmetric((option / 2) % 2);
+  glyph->SetExtractEigenvalues(option % 3 != 2);
+  glyph->SetClampScaling(option % 5 == 1);
+  glyph->SetMaxScaleFactor(0.8);
+  glyph->SetColorMode((option / 4) % 2);
+  glyph->SetColorGlyphs(option % 7 != 3);
+  glyph->Update();
+  return glyph->GetOutput();
+}
+
+// Without orientation, the glyph points are the input point translated by
+// the source points scaled by (1, 1, 1) for vtkGlyph3D without scaling, and by
+// the diagonal (2, 3, 4) of the tensor for vtkTensorGlyph.
+bool TestPositions(vtkPolyData* input, vtkPolyData* source)
+{
+  vtkNew<vtkPolyData> points;
+  points->SetPoints(input->GetPoints());
+  vtkNew<vtkDoubleArray> tensors;
+  tensors->SetNumberOfComponents(9);
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    tensors->InsertNextTuple9(2.0, 0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, 4.0);
+  }
+  points->GetPointData()->SetTensors(tensors);
+
+  for (int filter = 0; filter < 2; ++filter)
+  {
+    vtkSmartPointer<vtkPolyData> output;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+      if (filter)
+      {
+        vtkNew<vtkTensorGlyph> glyph;
+        glyph->SetInputData(points);
+        glyph->SetSourceData(source);
+        glyph->ExtractEigenvaluesOff();
+        glyph->Update();
+        output = glyph->GetOutput();
+      }
+      else
+      {
+        vtkNew<vtkGlyph3D> glyph;
+        glyph->SetInputData(points);
+        glyph->SetSourceData(source);
+        glyph->OrientOff();
+        glyph->ScalingOff();
+        glyph->Update();
+        output = glyph->GetOutput();
+      }
+    });
+
+    const double scale[3] = { filter ? 2.0 : 1.0, filter ? 3.0 : 1.0,
+                              filter ? 4.0 : 1.0 };
+    vtkIdType numSourcePts = source->GetNumberOfPoints();
+    if (output->GetNumberOfPoints() !=
+        points->GetNumberOfPoints() * numSourcePts)
+    {
+      cerr << "Wrong number of glyph points of "
+           << (filter ? "vtkTensorGlyph" : "vtkGlyph3D") << endl;
+      return false;
+    }
+    for (vtkIdType i = 0; i < output->GetNumberOfPoints(); ++i)
+    {
+      double p[3];
+      double x[3];
+      double y[3];
+      points->GetPoint(i / numSourcePts, p);
+      source->GetPoint(i % numSourcePts, x);
+      output->GetPoint(i, y);
+      for (int c = 0; c < 3; ++c)
+      {
+        if (fabs(p[c] + scale[c] * x[c] - y[c]) > 1e-5)
+        {
+          cerr << "Wrong glyph point " << i << " of "
+               << (filter ? "vtkTensorGlyph" : "vtkGlyph3D") << endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+bool TestSource(vtkPolyData* input, vtkPolyData* source, const char* label)
+{
+  for (int option = 0; option < 24; ++option)
+  {
+    for (int filter = 0; filter < 2; ++filter)
+    {
+      vtkSmartPointer<vtkPolyData> serial;
+      vtkSmartPointer<vtkPolyData> threaded;
+      vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+        serial = filter ? TensorGlyph(input, source, option) :
+                          Glyph(input, source, option);
+      });
+      vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+        threaded = filter ? TensorGlyph(input, source, option) :
+                            Glyph(input, source, option);
+      });
+      if (serial->GetNumberOfCells() == 0 || !SamePolyData(serial, threaded))
+      {
+        cerr << "Wrong output of " << (filter ? "vtkTensorGlyph" : "vtkGlyph3D")
+             << " for " << label << " (option " << option << "): "
+             << threaded->GetNumberOfCells() << " cells instead of "
+             << serial->GetNumberOfCells() << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestGlyph3DThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> input = MakeInput();
+
+  // Triangles with normals, glyphed in parallel.
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(6);
+  sphere->SetPhiResolution(4);
+  sphere->Update();
+
+  // Lines with texture coordinates, glyphed in parallel.
+  vtkNew<vtkPolyData> lines;
+  vtkNew<vtkPoints> linePoints;
+  vtkNew<vtkFloatArray> tcoords;
+  tcoords->SetNumberOfComponents(2);
+  for (int i = 0; i < 5; ++i)
+  {
+    linePoints->InsertNextPoint(i, 0.3 * i * i, -i);
+    tcoords->InsertNextTuple2(0.1 * i, 0.7);
+  }
+  vtkNew<vtkCellArray> lineCells;
+  vtkIdType lineIds[5] = { 0, 1, 2, 3, 4 };
+  lineCells->InsertNextCell(2, lineIds);
+  lineCells->InsertNextCell(3, lineIds + 2);
+  lineCells->InsertNextCell(5, lineIds);
+  lines->SetPoints(linePoints);
+  lines->SetLines(lineCells);
+  lines->GetPointData()->SetTCoords(tcoords);
+
+  // Vertices and triangles, glyphed sequentially.
+  vtkNew<vtkPolyData> mixed;
+  mixed->DeepCopy(sphere->GetOutput());
+  vtkNew<vtkCellArray> verts;
+  vtkIdType vertId = 0;
+  verts->InsertNextCell(1, &vertId);
+  mixed->SetVerts(verts);
+
+  if (!TestPositions(input, lines) ||
+      !TestSource(input, sphere->GetOutput(), "triangles") ||
+      !TestSource(input, lines, "lines") ||
+      !TestSource(input, mixed, "vertices and triangles"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
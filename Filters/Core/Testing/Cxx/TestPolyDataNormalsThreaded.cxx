@@ -0,0 +1,203 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPolyDataNormalsThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the normals, the split points and the polygons computed by
+// vtkPolyDataNormals with several threads are the ones computed serially,
+// and that the normals auto oriented on the closed spheres point outwards.
+
+#include "vtkAppendPolyData.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCubeSource.h"
+#include "vtkDataArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataNormals.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+#include <algorithm>
+
+namespace
+{
+
+vtkSmartPointer<vtkPolyData> ComputeNormals(vtkPolyData* mesh, int mode)
+{
+  vtkNew<vtkPolyDataNormals> normals;
+  normals->SetInputData(mesh);
+  normals->ComputeCellNormalsOn();
+  switch (mode)
+  {
+    case 1:
+      normals->AutoOrientNormalsOn();
+      break;
+    case 2:
+      normals->SetFeatureAngle(10.0);
+      normals->FlipNormalsOn();
+      break;
+    case 3:
+      normals->ConsistencyOff();
+      normals->SplittingOff();
+      break;
+  }
+  normals->Update();
+  return normals->GetOutput();
+}
+
+bool SameValues(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (a->GetVariantValue(i) != b->GetVariantValue(i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The center of the convex shape a point belongs to.
+void ShapeCenter(const double x[3], double center[3])
+{
+  center[0] = x[0] > 1.5 ? 3.0 : (x[0] < -1.5 ? -3.0 : 0.0);
+  center[1] = center[2] = 0.0;
+}
+
+// The polygon normals of the spheres point away from their center, and the
+// point normals of the smooth sphere are radial. The faces of the cube are not
+// connected, so auto orientation has no meaning for them.
+bool NormalsOutwards(vtkPolyData* output)
+{
+  vtkDataArray* cellNormals = output->GetCellData()->GetNormals();
+  vtkNew<vtkIdList> pts;
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    output->GetCellPoints(cellId, pts);
+    double centroid[3] = { 0.0, 0.0, 0.0 };
+    for (vtkIdType i = 0; i < pts->GetNumberOfIds(); ++i)
+    {
+      double x[3];
+      output->GetPoint(pts->GetId(i), x);
+      vtkMath::Add(centroid, x, centroid);
+    }
+    vtkMath::MultiplyScalar(centroid, 1.0 / pts->GetNumberOfIds());
+    double center[3];
+    ShapeCenter(centroid, center);
+    if (center[0] == 3.0)
+    {
+      continue;
+    }
+    double outwards[3];
+    vtkMath::Subtract(centroid, center, outwards);
+    if (vtkMath::Dot(cellNormals->GetTuple3(cellId), outwards) <= 0.0)
+    {
+      return false;
+    }
+  }
+  vtkDataArray* pointNormals = output->GetPointData()->GetNormals();
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    output->GetPoint(ptId, x);
+    double center[3];
+    ShapeCenter(x, center);
+    if (center[0] == 0.0)
+    {
+      vtkMath::Normalize(x);
+      if (vtkMath::Dot(pointNormals->GetTuple3(ptId), x) < 0.99)
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestPolyDataNormalsThreaded(int, char*[])
+{
+  // A smooth sphere, a cube with sharp edges and a coarse sphere, with some
+  // polygons in the wrong orientation.
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkCubeSource> cube;
+  cube->SetCenter(3.0, 0.0, 0.0);
+  vtkNew<vtkSphereSource> coarseSphere;
+  coarseSphere->SetCenter(-3.0, 0.0, 0.0);
+  coarseSphere->SetThetaResolution(8);
+  coarseSphere->SetPhiResolution(5);
+  vtkNew<vtkAppendPolyData> append;
+  append->AddInputConnection(sphere->GetOutputPort());
+  append->AddInputConnection(cube->GetOutputPort());
+  append->AddInputConnection(coarseSphere->GetOutputPort());
+  append->Update();
+  vtkNew<vtkPolyData> mesh;
+  mesh->DeepCopy(append->GetOutput());
+  for (vtkIdType i = 0; i < mesh->GetNumberOfPolys(); i += 7)
+  {
+    mesh->GetPolys()->ReverseCellAtId(i);
+  }
+
+  for (int mode = 0; mode < 4; ++mode)
+  {
+    vtkSmartPointer<vtkPolyData> serial;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"),
+                            [&]() { serial = ComputeNormals(mesh, mode); });
+    vtkSmartPointer<vtkPolyData> threaded;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4),
+                            [&]() { threaded = ComputeNormals(mesh, mode); });
+
+    vtkIdTypeArray* polys = serial->GetPolys()->GetData();
+    vtkIdTypeArray* threadedPolys = threaded->GetPolys()->GetData();
+    if (serial->GetNumberOfPoints() != threaded->GetNumberOfPoints() ||
+        !SameValues(serial->GetPoints()->GetData(),
+                    threaded->GetPoints()->GetData()) ||
+        polys->GetNumberOfValues() != threadedPolys->GetNumberOfValues() ||
+        !std::equal(polys->GetPointer(0),
+                    polys->GetPointer(0) + polys->GetNumberOfValues(),
+                    threadedPolys->GetPointer(0)))
+    {
+      cerr << "Wrong points or polygons in mode " << mode << endl;
+      return EXIT_FAILURE;
+    }
+
+    if (!SameValues(serial->GetPointData()->GetNormals(),
+                    threaded->GetPointData()->GetNormals()) ||
+        !SameValues(serial->GetCellData()->GetNormals(),
+                    threaded->GetCellData()->GetNormals()))
+    {
+      cerr << "Wrong normals in mode " << mode << endl;
+      return EXIT_FAILURE;
+    }
+
+    if (mode == 1 && !NormalsOutwards(serial))
+    {
+      cerr << "Normals not oriented outwards" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
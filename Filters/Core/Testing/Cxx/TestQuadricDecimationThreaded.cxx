@@ -0,0 +1,256 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestQuadricDecimationThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkQuadricDecimation gives the same output in parallel as
+// sequentially, with and without the attribute error metric and volume
+// preservation, on the whole mesh and split in partitions, and that the
+// partitions are stitched back without cracks. A flat square must stay a
+// flat square of the same area.
+
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFeatureEdges.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPlaneSource.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkQuadricDecimation.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTriangle.h"
+#include "vtkTriangleFilter.h"
+
+#include <cmath>
+
+namespace
+{
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SamePolyData(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+      a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType i = 0; i < a->GetNumberOfCells(); ++i)
+  {
+    a->GetCellPoints(i, ptsA);
+    b->GetCellPoints(i, ptsB);
+    if (ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < ptsA->GetNumberOfIds(); ++j)
+    {
+      if (ptsA->GetId(j) != ptsB->GetId(j))
+      {
+        return false;
+      }
+    }
+  }
+  return SameArrays(a->GetPointData(), b->GetPointData());
+}
+
+void AddScalars(vtkPolyData* polyData, double amount)
+{
+  vtkPoints* points = polyData->GetPoints();
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    points->GetPoint(i, x);
+    points->SetPoint(i, x[0] + amount * sin(7.0 * i),
+                     x[1] + amount * cos(3.0 * i), x[2] + amount * sin(5.0 * i));
+    scalars->InsertNextValue(sin(4.0 * x[0]) + x[1]);
+  }
+  polyData->GetPointData()->SetScalars(scalars);
+}
+
+vtkSmartPointer<vtkPolyData> Decimate(vtkPolyData* input, int option,
+                                      int numberOfPartitions)
+{
+  vtkNew<vtkQuadricDecimation> decimate;
+  decimate->SetInputData(input);
+  decimate->SetTargetReduction(0.8);
+  decimate->SetAttributeErrorMetric(option & 1);
+  decimate->SetVolumePreservation((option & 2) != 0);
+  decimate->SetNumberOfPartitions(numberOfPartitions);
+  decimate->Update();
+  return decimate->GetOutput();
+}
+
+vtkIdType NumberOfOpenEdges(vtkPolyData* polyData)
+{
+  vtkNew<vtkFeatureEdges> edges;
+  edges->SetInputData(polyData);
+  edges->BoundaryEdgesOn();
+  edges->NonManifoldEdgesOn();
+  edges->FeatureEdgesOff();
+  edges->ManifoldEdgesOff();
+  edges->Update();
+  return edges->GetOutput()->GetNumberOfCells();
+}
+
+// The decimated unit square in the z = 0 plane stays in that plane with the
+// same area: the collapses of its interior and its straight boundary do not
+// change its shape.
+bool TestFlatSquare(vtkPolyData* square)
+{
+  for (int numberOfPartitions = 1; numberOfPartitions < 8;
+       numberOfPartitions += 3)
+  {
+    vtkSmartPointer<vtkPolyData> output;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+      output = Decimate(square, 0, numberOfPartitions);
+    });
+    double area = 0.0;
+    vtkNew<vtkIdList> pts;
+    for (vtkIdType i = 0; i < output->GetNumberOfCells(); ++i)
+    {
+      output->GetCellPoints(i, pts);
+      double x[3][3];
+      for (int j = 0; j < 3; ++j)
+      {
+        output->GetPoint(pts->GetId(j), x[j]);
+        if (fabs(x[j][2]) > 1e-6)
+        {
+          cerr << "Square not flat (" << numberOfPartitions << " partitions)"
+               << endl;
+          return false;
+        }
+      }
+      area += vtkTriangle::TriangleArea(x[0], x[1], x[2]);
+    }
+    if (output->GetNumberOfCells() == 0 || fabs(area - 1.0) > 1e-5)
+    {
+      cerr << "Wrong square area " << area << " (" << numberOfPartitions
+           << " partitions)" << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestInput(vtkPolyData* input, const char* label)
+{
+  const vtkIdType numOpenEdges = NumberOfOpenEdges(input);
+  for (int option = 0; option < 4; ++option)
+  {
+    for (int numberOfPartitions = 1; numberOfPartitions < 8;
+         numberOfPartitions += 3)
+    {
+      vtkSmartPointer<vtkPolyData> serial;
+      vtkSmartPointer<vtkPolyData> threaded;
+      vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+        serial = Decimate(input, option, numberOfPartitions);
+      });
+      vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+        threaded = Decimate(input, option, numberOfPartitions);
+      });
+      if (!SamePolyData(serial, threaded))
+      {
+        cerr << "Wrong output for " << label << " (option " << option << ", "
+             << numberOfPartitions << " partitions): "
+             << threaded->GetNumberOfCells() << " cells instead of "
+             << serial->GetNumberOfCells() << endl;
+        return false;
+      }
+      if (serial->GetNumberOfCells() > 0.3 * input->GetNumberOfCells())
+      {
+        cerr << "Mesh not decimated for " << label << " (option " << option
+             << ", " << numberOfPartitions << " partitions)" << endl;
+        return false;
+      }
+      if (numOpenEdges == 0 && NumberOfOpenEdges(serial) != 0)
+      {
+        cerr << "Cracks between the partitions of " << label << " (option "
+             << option << ", " << numberOfPartitions << " partitions)" << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestQuadricDecimationThreaded(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphereSource;
+  sphereSource->SetThetaResolution(60);
+  sphereSource->SetPhiResolution(40);
+  sphereSource->Update();
+  vtkNew<vtkPolyData> sphere;
+  sphere->DeepCopy(sphereSource->GetOutput());
+  AddScalars(sphere, 0.01);
+
+  vtkNew<vtkPlaneSource> planeSource;
+  planeSource->SetResolution(40, 30);
+  vtkNew<vtkTriangleFilter> triangles;
+  triangles->SetInputConnection(planeSource->GetOutputPort());
+  triangles->Update();
+  vtkNew<vtkPolyData> plane;
+  plane->DeepCopy(triangles->GetOutput());
+  AddScalars(plane, 0.005);
+
+  if (!TestFlatSquare(triangles->GetOutput()) ||
+      !TestInput(sphere, "a sphere") || !TestInput(plane, "a plane"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,453 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestStaticCleanPolyData.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkStaticCleanPolyData gives the output of the former serial
+// implementation (reimplemented here), that it converts the cells
+// degenerated by the merging of points when they are cleaned, and that it
+// gives the same output in parallel as sequentially, with and without a
+// merging tolerance.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticCleanPolyData.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SamePolyData(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+      a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType i = 0; i < a->GetNumberOfCells(); ++i)
+  {
+    a->GetCellPoints(i, ptsA);
+    b->GetCellPoints(i, ptsB);
+    if (a->GetCellType(i) != b->GetCellType(i) ||
+        ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < ptsA->GetNumberOfIds(); ++j)
+    {
+      if (ptsA->GetId(j) != ptsB->GetId(j))
+      {
+        return false;
+      }
+    }
+  }
+  return SameArrays(a->GetPointData(), b->GetPointData()) &&
+    SameArrays(a->GetCellData(), b->GetCellData());
+}
+
+// A triangle soup (every triangle has its own points) sampling a wavy
+// surface, with some lines, vertices and strips on the same points. The
+// points are jittered so that merging with a tolerance degenerates cells.
+vtkSmartPointer<vtkPolyData> MakeInput()
+{
+  const int res = 60;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkCellArray> lines;
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkCellArray> strips;
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("PointScalars");
+  for (int j = 0; j < res; ++j)
+  {
+    for (int i = 0; i < res; ++i)
+    {
+      vtkIdType ids[6];
+      const double corners[6][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 },
+                                     { 0, 0 }, { 1, 1 }, { 0, 1 } };
+      for (int k = 0; k < 6; ++k)
+      {
+        double x = (i + corners[k][0]) / res;
+        double y = (j + corners[k][1]) / res;
+        vtkIdType id = points->GetNumberOfPoints();
+        double jitter = 0.002 * sin(7.3 * id) / res;
+        ids[k] = points->InsertNextPoint(x + jitter, y - jitter,
+                                         0.1 * sin(6.0 * x) * cos(5.0 * y));
+        pointScalars->InsertNextValue(static_cast<double>(id % 17));
+      }
+      polys->InsertNextCell(3, ids);
+      polys->InsertNextCell(3, ids + 3);
+      vtkIdType cell = i + res * j;
+      if (cell % 5 == 0)
+      {
+        vtkIdType line[3] = { ids[0], ids[3], ids[1] };
+        lines->InsertNextCell(3, line);
+      }
+      if (cell % 7 == 0)
+      {
+        verts->InsertNextCell(2, ids + 1);
+      }
+      if (cell % 11 == 0)
+      {
+        vtkIdType strip[5] = { ids[0], ids[1], ids[5], ids[2], ids[4] };
+        strips->InsertNextCell(5, strip);
+      }
+    }
+  }
+
+  vtkSmartPointer<vtkPolyData> input = vtkSmartPointer<vtkPolyData>::New();
+  input->SetPoints(points);
+  input->SetVerts(verts);
+  input->SetLines(lines);
+  input->SetPolys(polys);
+  input->SetStrips(strips);
+  input->GetPointData()->AddArray(pointScalars);
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  for (vtkIdType i = 0; i < input->GetNumberOfCells(); ++i)
+  {
+    cellIds->InsertNextValue(static_cast<int>(i));
+  }
+  input->GetCellData()->AddArray(cellIds);
+  return input;
+}
+
+vtkSmartPointer<vtkPolyData> Clean(vtkPolyData* input, double tolerance,
+                                   int option, bool removeDuplicates)
+{
+  vtkNew<vtkStaticCleanPolyData> clean;
+  clean->SetInputData(input);
+  clean->ToleranceIsAbsoluteOn();
+  clean->SetAbsoluteTolerance(tolerance);
+  clean->SetConvertLinesToPoints((option & 1) == 0);
+  clean->SetConvertPolysToLines((option & 2) == 0);
+  clean->SetConvertStripsToPolys((option & 4) == 0);
+  clean->SetRemoveDuplicateCellPoints(removeDuplicates);
+  clean->Update();
+  return clean->GetOutput();
+}
+
+// The former serial implementation: the points are processed in id order,
+// each point not yet merged absorbing the points within the tolerance not
+// yet merged; all the points are then copied in id order (so the last one
+// merged into an output point wins); the cells keep all their points but
+// the closing point of polygons, and are converted by number of points.
+vtkSmartPointer<vtkPolyData> ReferenceClean(vtkPolyData* input,
+                                            double tolerance, int option)
+{
+  const bool convertLinesToPoints = (option & 1) == 0;
+  const bool convertPolysToLines = (option & 2) == 0;
+  const bool convertStripsToPolys = (option & 4) == 0;
+
+  // Brute force merging, over the points sorted along x.
+  vtkIdType numPts = input->GetNumberOfPoints();
+  std::vector<vtkIdType> sorted(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    sorted[i] = i;
+  }
+  std::sort(sorted.begin(), sorted.end(), [input](vtkIdType a, vtkIdType b) {
+    return input->GetPoint(a)[0] < input->GetPoint(b)[0];
+  });
+  std::vector<vtkIdType> rank(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    rank[sorted[i]] = i;
+  }
+  std::vector<vtkIdType> mergeMap(numPts, -1);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    if (mergeMap[i] >= 0)
+    {
+      continue;
+    }
+    mergeMap[i] = i;
+    double x[3];
+    input->GetPoint(i, x);
+    for (int dir = -1; dir <= 1; dir += 2)
+    {
+      for (vtkIdType r = rank[i] + dir; r >= 0 && r < numPts; r += dir)
+      {
+        double y[3];
+        input->GetPoint(sorted[r], y);
+        if (std::abs(y[0] - x[0]) > tolerance)
+        {
+          break;
+        }
+        if (sorted[r] > i && mergeMap[sorted[r]] < 0 &&
+            vtkMath::Distance2BetweenPoints(x, y) <= tolerance * tolerance)
+        {
+          mergeMap[sorted[r]] = i;
+        }
+      }
+    }
+  }
+
+  std::vector<vtkIdType> pointMap(numPts);
+  vtkIdType numNewPts = 0;
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    pointMap[i] = mergeMap[i] == i ? numNewPts++ : pointMap[mergeMap[i]];
+  }
+  vtkNew<vtkPoints> points;
+  points->SetDataType(input->GetPoints()->GetDataType());
+  points->SetNumberOfPoints(numNewPts);
+  vtkSmartPointer<vtkPolyData> output = vtkSmartPointer<vtkPolyData>::New();
+  output->GetPointData()->CopyAllocate(input->GetPointData(), numNewPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    points->SetPoint(pointMap[i], input->GetPoint(i));
+    output->GetPointData()->CopyData(input->GetPointData(), i, pointMap[i]);
+  }
+  output->SetPoints(points);
+
+  // The cells of each output type, with their input cell ids.
+  vtkNew<vtkCellArray> cells[4];
+  std::vector<vtkIdType> cellIds[4];
+  vtkCellArray* inCells[4] = { input->GetVerts(), input->GetLines(),
+                               input->GetPolys(), input->GetStrips() };
+  vtkIdType inCellId = 0;
+  vtkNew<vtkIdList> pts;
+  for (int type = 0; type < 4; ++type)
+  {
+    for (vtkIdType i = 0; i < inCells[type]->GetNumberOfCells(); ++i)
+    {
+      inCells[type]->GetCellAtId(i, pts);
+      vtkIdType npts = pts->GetNumberOfIds();
+      for (vtkIdType j = 0; j < npts; ++j)
+      {
+        pts->SetId(j, pointMap[pts->GetId(j)]);
+      }
+      if (type == 2 && npts > 2 && pts->GetId(0) == pts->GetId(npts - 1))
+      {
+        pts->SetNumberOfIds(--npts);
+      }
+      int outType = -1;
+      if (type == 0)
+      {
+        outType = npts > 0 ? 0 : -1;
+      }
+      else if (type == 3 && (npts > 3 || !convertStripsToPolys))
+      {
+        outType = 3;
+      }
+      else if (type >= 2 && (npts > 2 || !convertPolysToLines))
+      {
+        outType = 2;
+      }
+      else if (npts > 1 || !convertLinesToPoints)
+      {
+        outType = 1;
+      }
+      else if (npts == 1)
+      {
+        outType = 0;
+      }
+      if (outType >= 0)
+      {
+        cells[outType]->InsertNextCell(pts);
+        cellIds[outType].push_back(inCellId);
+      }
+      ++inCellId;
+    }
+  }
+  output->SetVerts(cells[0]);
+  output->SetLines(cells[1]);
+  output->SetPolys(cells[2]);
+  output->SetStrips(cells[3]);
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(input->GetCellData(), inCellId);
+  vtkIdType outCellId = 0;
+  for (int type = 0; type < 4; ++type)
+  {
+    for (vtkIdType cellId : cellIds[type])
+    {
+      outCD->CopyData(input->GetCellData(), cellId, outCellId++);
+    }
+  }
+  return output;
+}
+
+// The merged points must have been removed from the cells.
+bool NoDegeneratePoints(vtkPolyData* output)
+{
+  vtkNew<vtkIdList> pts;
+  for (vtkIdType i = 0; i < output->GetNumberOfCells(); ++i)
+  {
+    output->GetCellPoints(i, pts);
+    int type = output->GetCellType(i);
+    if (type == VTK_VERTEX || type == VTK_POLY_VERTEX)
+    {
+      continue;
+    }
+    for (vtkIdType j = 1; j < pts->GetNumberOfIds(); ++j)
+    {
+      if (pts->GetId(j) == pts->GetId(j - 1))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestStaticCleanPolyData(int, char*[])
+{
+  // Two points merged into one: the last one is output. By default, the
+  // triangle and the line keep their merged points. When these are removed,
+  // the triangle becomes a line and the line a vertex.
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0.0, 0.0, 0.0);
+  points->InsertNextPoint(1.0, 0.0, 0.0);
+  points->InsertNextPoint(1.0, 0.0, 0.0);
+  points->InsertNextPoint(0.0, 0.0, 0.0);
+  vtkNew<vtkDoubleArray> pointScalars;
+  pointScalars->SetName("PointScalars");
+  for (int i = 0; i < 4; ++i)
+  {
+    pointScalars->InsertNextValue(i);
+  }
+  vtkNew<vtkCellArray> lines;
+  vtkIdType line[2] = { 0, 3 };
+  lines->InsertNextCell(2, line);
+  vtkNew<vtkCellArray> polys;
+  vtkIdType triangle[3] = { 0, 1, 2 };
+  polys->InsertNextCell(3, triangle);
+  vtkNew<vtkPolyData> degenerate;
+  degenerate->SetPoints(points);
+  degenerate->SetLines(lines);
+  degenerate->SetPolys(polys);
+  degenerate->GetPointData()->AddArray(pointScalars);
+  vtkSmartPointer<vtkPolyData> cleaned = Clean(degenerate, 0.0, 0, false);
+  vtkDataArray* scalars = cleaned->GetPointData()->GetArray("PointScalars");
+  vtkNew<vtkIdList> linePts;
+  cleaned->GetCellPoints(0, linePts);
+  if (cleaned->GetNumberOfPoints() != 2 || cleaned->GetNumberOfCells() != 2 ||
+      scalars->GetTuple1(0) != 3.0 || scalars->GetTuple1(1) != 2.0 ||
+      cleaned->GetCellType(0) != VTK_LINE ||
+      linePts->GetNumberOfIds() != 2 ||
+      cleaned->GetCellType(1) != VTK_TRIANGLE)
+  {
+    cerr << "Wrong merging of degenerate cells" << endl;
+    return EXIT_FAILURE;
+  }
+  cleaned = Clean(degenerate, 0.0, 0, true);
+  if (cleaned->GetNumberOfPoints() != 2 || cleaned->GetNumberOfCells() != 2 ||
+      cleaned->GetCellType(0) != VTK_VERTEX ||
+      cleaned->GetCellType(1) != VTK_LINE)
+  {
+    cerr << "Wrong conversion of degenerate cells" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkSmartPointer<vtkPolyData> input = MakeInput();
+  const double tolerances[3] = { 0.0, 0.0005, 0.02 };
+  for (int t = 0; t < 3; ++t)
+  {
+    // The largest tolerance collapses cells, which must then be converted
+    // (cells with too few points are reported when the output is built).
+    const int numOptions = t == 2 ? 1 : 8;
+    for (int option = 0; option < numOptions; ++option)
+    {
+      for (int removeDuplicates = 0; removeDuplicates < 2; ++removeDuplicates)
+      {
+        vtkSmartPointer<vtkPolyData> serial;
+        vtkSmartPointer<vtkPolyData> threaded;
+        vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+          serial = Clean(input, tolerances[t], option, removeDuplicates != 0);
+        });
+        vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+          threaded = Clean(input, tolerances[t], option, removeDuplicates != 0);
+        });
+        if (!SamePolyData(serial, threaded))
+        {
+          cerr << "Wrong output for tolerance " << tolerances[t]
+               << " (option " << option << ", removing duplicates "
+               << removeDuplicates << "): " << threaded->GetNumberOfPoints()
+               << " points instead of " << serial->GetNumberOfPoints()
+               << endl;
+          return EXIT_FAILURE;
+        }
+        if (serial->GetNumberOfPoints() >= input->GetNumberOfPoints())
+        {
+          cerr << "Points not merged for tolerance " << tolerances[t]
+               << " (option " << option << ")" << endl;
+          return EXIT_FAILURE;
+        }
+        if (removeDuplicates ? !NoDegeneratePoints(serial) :
+            !SamePolyData(serial, ReferenceClean(input, tolerances[t], option)))
+        {
+          cerr << "Output differing from the "
+               << (removeDuplicates ? "cleaned cells" : "serial reference")
+               << " for tolerance " << tolerances[t] << " (option " << option
+               << ")" << endl;
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
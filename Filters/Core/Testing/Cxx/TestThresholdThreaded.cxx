@@ -0,0 +1,304 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestThresholdThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkThreshold extracts the same cells, with the same point
+// numbering, in parallel as sequentially, on the dataset types it processes
+// in parallel and for the different threshold criteria, and that the cells
+// kept by a simple criterion are the ones expected from their values.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataSetTriangleFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStructuredGrid.h"
+#include "vtkThreshold.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+
+namespace
+{
+
+void AddArrays(vtkDataSetAttributes* attributes, vtkIdType numTuples)
+{
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    vectors->InsertNextTuple3(sin(0.37 * i), cos(0.11 * i), 0.001 * i);
+    ints->InsertNextValue(static_cast<int>((i * 7919) % 1001) - 500);
+  }
+  attributes->AddArray(vectors);
+  attributes->AddArray(ints);
+}
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameGrids(vtkUnstructuredGrid* a, vtkUnstructuredGrid* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+      a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType i = 0; i < a->GetNumberOfCells(); ++i)
+  {
+    a->GetCellPoints(i, ptsA);
+    b->GetCellPoints(i, ptsB);
+    if (a->GetCellType(i) != b->GetCellType(i) ||
+        ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < ptsA->GetNumberOfIds(); ++j)
+    {
+      if (ptsA->GetId(j) != ptsB->GetId(j))
+      {
+        return false;
+      }
+    }
+  }
+  return SameArrays(a->GetPointData(), b->GetPointData()) &&
+    SameArrays(a->GetCellData(), b->GetCellData());
+}
+
+vtkSmartPointer<vtkUnstructuredGrid> Threshold(vtkDataSet* input, int option)
+{
+  vtkNew<vtkThreshold> threshold;
+  threshold->SetInputData(input);
+  bool cellScalars = (option & 1) != 0;
+  threshold->SetInputArrayToProcess(0, 0, 0, cellScalars ?
+    vtkDataObject::FIELD_ASSOCIATION_CELLS :
+    vtkDataObject::FIELD_ASSOCIATION_POINTS, "Vectors");
+  switch ((option >> 1) % 3)
+  {
+    case 0:
+      threshold->ThresholdByUpper(0.25);
+      break;
+    case 1:
+      threshold->ThresholdByLower(-0.4);
+      break;
+    default:
+      threshold->ThresholdBetween(-0.3, 0.6);
+  }
+  switch ((option / 6) % 4)
+  {
+    case 0:
+      threshold->AllScalarsOn();
+      break;
+    case 1:
+      threshold->AllScalarsOff();
+      break;
+    case 2:
+      threshold->AllScalarsOff();
+      threshold->UseContinuousCellRangeOn();
+      break;
+    default:
+      threshold->SetComponentModeToUseAny();
+  }
+  threshold->SetSelectedComponent(option % 5 == 0 ? 1 : 0);
+  threshold->SetInvert(option % 7 == 3);
+  threshold->Update();
+  return threshold->GetOutput();
+}
+
+// With option 1, the non empty cells whose first vector component, the sine
+// of 0.37 times their id, is at least 0.25 are kept in order. The third
+// component is 0.001 times their id.
+bool ExpectedCells(vtkDataSet* input, vtkUnstructuredGrid* output)
+{
+  vtkDataArray* vectors = output->GetCellData()->GetArray("Vectors");
+  vtkIdType outId = 0;
+  for (vtkIdType i = 0; i < input->GetNumberOfCells(); ++i)
+  {
+    if (input->GetCellType(i) != VTK_EMPTY_CELL && sin(0.37 * i) >= 0.25)
+    {
+      if (outId >= output->GetNumberOfCells() ||
+          output->GetCellType(outId) != input->GetCellType(i) ||
+          vectors->GetComponent(outId, 2) != 0.001 * i)
+      {
+        return false;
+      }
+      ++outId;
+    }
+  }
+  return outId == output->GetNumberOfCells();
+}
+
+bool TestDataSet(vtkDataSet* input, const char* label)
+{
+  int numPartialOutputs = 0;
+  for (int option = 0; option < 24; ++option)
+  {
+    vtkSmartPointer<vtkUnstructuredGrid> serial;
+    vtkSmartPointer<vtkUnstructuredGrid> threaded;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"),
+                            [&]() { serial = Threshold(input, option); });
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4),
+                            [&]() { threaded = Threshold(input, option); });
+    if (!SameGrids(serial, threaded))
+    {
+      cerr << "Wrong output for " << label << " (option " << option << "): "
+           << threaded->GetNumberOfCells() << " cells instead of "
+           << serial->GetNumberOfCells() << endl;
+      return false;
+    }
+    if (option == 1 && !ExpectedCells(input, serial))
+    {
+      cerr << "Unexpected cells kept for " << label << endl;
+      return false;
+    }
+    if (serial->GetNumberOfCells() > 0 &&
+        serial->GetNumberOfCells() < input->GetNumberOfCells())
+    {
+      ++numPartialOutputs;
+    }
+  }
+  if (numPartialOutputs < 12)
+  {
+    cerr << "Too few partial outputs for " << label << endl;
+    return false;
+  }
+  return true;
+}
+
+}
+
+int TestThresholdThreaded(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 15, -2, 11, 3, 12);
+  AddArrays(image->GetPointData(), image->GetNumberOfPoints());
+  AddArrays(image->GetCellData(), image->GetNumberOfCells());
+
+  vtkNew<vtkStructuredGrid> grid;
+  grid->SetDimensions(12, 9, 7);
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < 7; ++k)
+  {
+    for (int j = 0; j < 9; ++j)
+    {
+      for (int i = 0; i < 12; ++i)
+      {
+        points->InsertNextPoint(i, j + 0.1 * i, k);
+      }
+    }
+  }
+  grid->SetPoints(points);
+  AddArrays(grid->GetPointData(), grid->GetNumberOfPoints());
+  AddArrays(grid->GetCellData(), grid->GetNumberOfCells());
+  grid->BlankCell(17);
+  grid->BlankCell(213);
+
+  vtkNew<vtkDataSetTriangleFilter> tetrahedralize;
+  tetrahedralize->SetInputData(image);
+  tetrahedralize->Update();
+  vtkUnstructuredGrid* tetras = tetrahedralize->GetOutput();
+  tetras->GetPointData()->Initialize();
+  tetras->GetCellData()->Initialize();
+  AddArrays(tetras->GetPointData(), tetras->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < tetras->GetNumberOfPoints() - 2; i += 13)
+  {
+    vtkIdType triangle[3] = { i, i + 1, i + 2 };
+    tetras->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+    tetras->InsertNextCell(VTK_VERTEX, 1, triangle);
+  }
+  tetras->InsertNextCell(VTK_EMPTY_CELL, 0, nullptr);
+  AddArrays(tetras->GetCellData(), tetras->GetNumberOfCells());
+
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkCellArray> lines;
+  vtkNew<vtkCellArray> polys;
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints() - 13; ++i)
+  {
+    vtkIdType quad[4] = { i, i + 1, i + 13, i + 12 };
+    switch (i % 4)
+    {
+      case 0:
+        verts->InsertNextCell(1, quad);
+        break;
+      case 1:
+        lines->InsertNextCell(2, quad);
+        break;
+      default:
+        polys->InsertNextCell(4, quad);
+    }
+  }
+  polyData->SetPolys(polys);
+  polyData->SetLines(lines);
+  polyData->SetVerts(verts);
+  AddArrays(polyData->GetPointData(), polyData->GetNumberOfPoints());
+  AddArrays(polyData->GetCellData(), polyData->GetNumberOfCells());
+
+  if (!TestDataSet(image, "image data") ||
+      !TestDataSet(grid, "structured grid") ||
+      !TestDataSet(tetras, "unstructured grid") ||
+      !TestDataSet(polyData, "polydata"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
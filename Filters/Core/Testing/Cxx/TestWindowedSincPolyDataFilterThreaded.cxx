@@ -0,0 +1,383 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestWindowedSincPolyDataFilterThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkWindowedSincPolyDataFilter and vtkSmoothPolyDataFilter
+// smooth the same way in parallel as sequentially (same points and error
+// arrays), on a closed surface with vertices and lines, on a non-manifold
+// surface with boundaries, and on triangle strips. The Jacobi iterations of
+// vtkSmoothPolyDataFilter are checked with and without a source surface,
+// and against Jacobi iterations computed here. The windowed sinc filter must
+// keep a flat plane flat, with its boundary in place.
+
+#include "vtkAppendPolyData.h"
+#include "vtkCellArray.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPlaneSource.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSmoothPolyDataFilter.h"
+#include "vtkSphereSource.h"
+#include "vtkStripper.h"
+#include "vtkWindowedSincPolyDataFilter.h"
+
+#include <cmath>
+#include <set>
+#include <vector>
+
+namespace
+{
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(i);
+    if (arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SamePoints(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      return false;
+    }
+  }
+  return SameArrays(a->GetPointData(), b->GetPointData());
+}
+
+void Jitter(vtkPolyData* polyData, double amount)
+{
+  vtkPoints* points = polyData->GetPoints();
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    points->GetPoint(i, x);
+    points->SetPoint(i, x[0] + amount * sin(7.0 * i),
+                     x[1] + amount * cos(3.0 * i), x[2] + amount * sin(5.0 * i));
+  }
+}
+
+// A sphere with fixed vertices, open lines and a closed loop.
+vtkSmartPointer<vtkPolyData> MakeSphere()
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(60);
+  sphere->SetPhiResolution(40);
+  sphere->Update();
+  vtkSmartPointer<vtkPolyData> polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->DeepCopy(sphere->GetOutput());
+  Jitter(polyData, 0.02);
+
+  vtkNew<vtkCellArray> lines;
+  vtkIdType line[5] = { 5, 6, 7, 8, 9 };
+  lines->InsertNextCell(5, line);
+  vtkIdType loop[6] = { 100, 101, 102, 103, 104, 100 };
+  lines->InsertNextCell(6, loop);
+  vtkIdType branch[3] = { 7, 200, 201 };
+  lines->InsertNextCell(3, branch);
+  vtkNew<vtkCellArray> verts;
+  vtkIdType vert = 300;
+  verts->InsertNextCell(1, &vert);
+  polyData->SetLines(lines);
+  polyData->SetVerts(verts);
+  return polyData;
+}
+
+// A plane with a fin attached along a non-manifold edge.
+vtkSmartPointer<vtkPolyData> MakeNonManifold()
+{
+  vtkNew<vtkPlaneSource> plane;
+  plane->SetResolution(20, 20);
+  vtkNew<vtkPlaneSource> fin;
+  fin->SetResolution(20, 10);
+  fin->SetOrigin(-0.5, 0.0, 0.0);
+  fin->SetPoint1(0.5, 0.0, 0.0);
+  fin->SetPoint2(-0.5, 0.0, 0.5);
+  vtkNew<vtkAppendPolyData> append;
+  append->AddInputConnection(plane->GetOutputPort());
+  append->AddInputConnection(fin->GetOutputPort());
+  append->Update();
+  vtkSmartPointer<vtkPolyData> polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->DeepCopy(append->GetOutput());
+  Jitter(polyData, 0.01);
+  return polyData;
+}
+
+vtkSmartPointer<vtkPolyData> WindowedSinc(vtkPolyData* input, int option)
+{
+  vtkNew<vtkWindowedSincPolyDataFilter> smooth;
+  smooth->SetInputData(input);
+  smooth->SetFeatureEdgeSmoothing(option & 1);
+  smooth->SetBoundarySmoothing((option & 2) != 0);
+  smooth->SetNonManifoldSmoothing((option & 4) != 0);
+  smooth->SetNormalizeCoordinates((option & 8) != 0);
+  smooth->SetGenerateErrorScalars((option & 16) != 0);
+  smooth->SetGenerateErrorVectors((option & 16) != 0);
+  smooth->SetFeatureAngle(30.0);
+  smooth->SetNumberOfIterations(15 + option);
+  smooth->Update();
+  return smooth->GetOutput();
+}
+
+vtkSmartPointer<vtkPolyData> Laplacian(vtkPolyData* input, int option,
+                                       vtkPolyData* source = nullptr)
+{
+  vtkNew<vtkSmoothPolyDataFilter> smooth;
+  smooth->SetInputData(input);
+  smooth->SetSourceData(source);
+  smooth->SetFeatureEdgeSmoothing(option & 1);
+  smooth->SetBoundarySmoothing((option & 2) != 0);
+  smooth->SetJacobiSmoothing((option & 4) != 0);
+  smooth->SetConvergence((option & 8) ? 0.001 : 0.0);
+  smooth->SetGenerateErrorScalars((option & 16) != 0);
+  smooth->SetGenerateErrorVectors((option & 16) != 0);
+  smooth->SetFeatureAngle(30.0);
+  smooth->SetNumberOfIterations(10 + option);
+  smooth->Update();
+  return smooth->GetOutput();
+}
+
+bool TestInput(vtkPolyData* input, const char* label)
+{
+  for (int option = 0; option < 32; ++option)
+  {
+    for (int filter = 0; filter < 2; ++filter)
+    {
+      vtkSmartPointer<vtkPolyData> serial;
+      vtkSmartPointer<vtkPolyData> threaded;
+      vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+        serial = filter ? Laplacian(input, option) : WindowedSinc(input, option);
+      });
+      vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+        threaded = filter ? Laplacian(input, option) : WindowedSinc(input, option);
+      });
+      if (!SamePoints(serial, threaded))
+      {
+        cerr << "Wrong output of "
+             << (filter ? "vtkSmoothPolyDataFilter" : "vtkWindowedSincPolyDataFilter")
+             << " for " << label << " (option " << option << ")" << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Two Jacobi iterations move each point of a closed triangle mesh towards the
+// mean of its neighbors of the previous iteration, by the relaxation factor.
+bool TestJacobi(vtkPolyData* input)
+{
+  vtkSmartPointer<vtkPolyData> smoothed;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+    vtkNew<vtkSmoothPolyDataFilter> smooth;
+    smooth->SetInputData(input);
+    smooth->JacobiSmoothingOn();
+    smooth->FeatureEdgeSmoothingOff();
+    smooth->SetConvergence(0.0);
+    smooth->SetRelaxationFactor(0.1);
+    smooth->SetNumberOfIterations(2);
+    smooth->Update();
+    smoothed = smooth->GetOutput();
+  });
+
+  vtkIdType numPts = input->GetNumberOfPoints();
+  std::vector<std::set<vtkIdType> > neighbors(numPts);
+  vtkNew<vtkIdList> pts;
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    input->GetCellPoints(cellId, pts);
+    for (vtkIdType i = 0; i < pts->GetNumberOfIds(); ++i)
+    {
+      for (vtkIdType j = 0; j < pts->GetNumberOfIds(); ++j)
+      {
+        if (pts->GetId(i) != pts->GetId(j))
+        {
+          neighbors[pts->GetId(i)].insert(pts->GetId(j));
+        }
+      }
+    }
+  }
+  std::vector<double> coords(3 * numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    input->GetPoint(i, coords.data() + 3 * i);
+  }
+  for (int iteration = 0; iteration < 2; ++iteration)
+  {
+    std::vector<double> next(coords);
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      for (int k = 0; k < 3; ++k)
+      {
+        double mean = 0.0;
+        for (vtkIdType j : neighbors[i])
+        {
+          mean += coords[3 * j + k];
+        }
+        mean /= neighbors[i].size();
+        next[3 * i + k] += 0.1 * (mean - coords[3 * i + k]);
+      }
+    }
+    coords.swap(next);
+  }
+
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double x[3];
+    smoothed->GetPoint(i, x);
+    for (int k = 0; k < 3; ++k)
+    {
+      if (fabs(x[k] - coords[3 * i + k]) > 1e-5)
+      {
+        cerr << "Wrong Jacobi iterations at point " << i << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// A jittered flat plane stays flat, and its boundary is not moved without
+// boundary smoothing.
+bool TestFlatPlane()
+{
+  vtkNew<vtkPlaneSource> plane;
+  plane->SetResolution(20, 20);
+  plane->Update();
+  vtkNew<vtkPolyData> input;
+  input->DeepCopy(plane->GetOutput());
+  vtkPoints* points = input->GetPoints();
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    points->GetPoint(i, x);
+    if (fabs(x[0]) < 0.45 && fabs(x[1]) < 0.45)
+    {
+      points->SetPoint(i, x[0] + 0.01 * sin(7.0 * i), x[1] + 0.01 * cos(3.0 * i),
+                       0.0);
+    }
+  }
+
+  vtkSmartPointer<vtkPolyData> smoothed;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4),
+                          [&]() { smoothed = WindowedSinc(input, 0); });
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    points->GetPoint(i, x);
+    smoothed->GetPoint(i, y);
+    bool boundary = fabs(x[0]) > 0.49 || fabs(x[1]) > 0.49;
+    if (y[2] != 0.0 || (boundary && (x[0] != y[0] || x[1] != y[1])))
+    {
+      cerr << "Flat plane not kept at point " << i << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+int TestWindowedSincPolyDataFilterThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> sphere = MakeSphere();
+  vtkSmartPointer<vtkPolyData> nonManifold = MakeNonManifold();
+  vtkNew<vtkStripper> stripper;
+  stripper->SetInputData(sphere);
+  stripper->Update();
+
+  if (!TestInput(sphere, "a sphere with lines") ||
+      !TestInput(nonManifold, "a non-manifold surface") ||
+      !TestInput(stripper->GetOutput(), "triangle strips"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Jacobi iterations constrained to a (coarser) source surface.
+  vtkNew<vtkSphereSource> source;
+  source->SetThetaResolution(20);
+  source->SetPhiResolution(15);
+  source->Update();
+  vtkSmartPointer<vtkPolyData> serial;
+  vtkSmartPointer<vtkPolyData> threaded;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+    serial = Laplacian(sphere, 6, source->GetOutput());
+  });
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+    threaded = Laplacian(sphere, 6, source->GetOutput());
+  });
+  if (!SamePoints(serial, threaded))
+  {
+    cerr << "Wrong output of vtkSmoothPolyDataFilter with a source" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // The smoothing must have moved the interior points.
+  vtkSmartPointer<vtkPolyData> smoothed = WindowedSinc(sphere, 2);
+  double x[3];
+  double y[3];
+  sphere->GetPoint(1000, x);
+  smoothed->GetPoint(1000, y);
+  if (x[0] == y[0] && x[1] == y[1] && x[2] == y[2])
+  {
+    cerr << "Points not smoothed" << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkSphereSource> closedSphere;
+  closedSphere->SetThetaResolution(30);
+  closedSphere->SetPhiResolution(20);
+  closedSphere->Update();
+  vtkNew<vtkPolyData> jittered;
+  jittered->DeepCopy(closedSphere->GetOutput());
+  Jitter(jittered, 0.02);
+  if (!TestJacobi(jittered) || !TestFlatPlane())
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
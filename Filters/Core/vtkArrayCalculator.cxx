@@ -29,11 +29,164 @@
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkTable.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkArrayCalculator);
 
+namespace
+{
+
+// Number of tuples whose variables are gathered and evaluated together.
+const vtkIdType vtkArrayCalculatorBlockSize = 1024;
+
+// Where the values of a variable of the function parser come from: the
+// components of an input array or the point coordinates. Variables with
+// neither keep the value set in the parser.
+struct vtkArrayCalculatorSource
+{
+  vtkArrayCalculatorSource() : Array(nullptr), Coordinates(false)
+  {
+    this->Components[0] = this->Components[1] = this->Components[2] = 0;
+  }
+
+  vtkDataArray* Array;
+  bool Coordinates;
+  int Components[3];
+};
+
+// Evaluate the function on blocks of tuples with
+// vtkFunctionParser::EvaluateBatch(). The parser must have been parsed.
+class vtkArrayCalculatorFunctor
+{
+public:
+  vtkArrayCalculatorFunctor(
+    vtkFunctionParser* parser, vtkDataSet* dsInput, vtkGraph* graphInput,
+    const std::vector<vtkArrayCalculatorSource>& scalarSources,
+    const std::vector<vtkArrayCalculatorSource>& vectorSources,
+    vtkDataArray* result)
+    : Parser(parser), DataSetInput(dsInput), GraphInput(graphInput),
+      ScalarSources(scalarSources), VectorSources(vectorSources),
+      Result(result)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    const vtkIdType blockSize = vtkArrayCalculatorBlockSize;
+    const size_t numScalars = this->ScalarSources.size();
+    const size_t numVectors = this->VectorSources.size();
+    const int resultSize = this->Result->GetNumberOfComponents();
+    bool needPoints = false;
+    for (size_t v = 0; v < numScalars; ++v)
+    {
+      needPoints |= this->ScalarSources[v].Coordinates;
+    }
+    for (size_t v = 0; v < numVectors; ++v)
+    {
+      needPoints |= this->VectorSources[v].Coordinates;
+    }
+
+    // Columns of the scalar variables, then of the vector variables, then
+    // of the results.
+    std::vector<double>& values = this->Values.Local();
+    values.resize((numScalars + 3 * numVectors + resultSize) * blockSize);
+    std::vector<double*> scalarValues(numScalars, nullptr);
+    std::vector<double*> vectorValues(numVectors, nullptr);
+    for (size_t v = 0; v < numScalars; ++v)
+    {
+      if (this->ScalarSources[v].Array || this->ScalarSources[v].Coordinates)
+      {
+        scalarValues[v] = values.data() + v * blockSize;
+      }
+    }
+    for (size_t v = 0; v < numVectors; ++v)
+    {
+      if (this->VectorSources[v].Array || this->VectorSources[v].Coordinates)
+      {
+        vectorValues[v] = values.data() + (numScalars + 3 * v) * blockSize;
+      }
+    }
+    double* result = values.data() + (numScalars + 3 * numVectors) * blockSize;
+
+    double pt[3] = { 0.0, 0.0, 0.0 };
+    for (vtkIdType blockBegin = begin; blockBegin < end;
+         blockBegin += blockSize)
+    {
+      const vtkIdType n = std::min(blockSize, end - blockBegin);
+      for (vtkIdType k = 0; k < n; ++k)
+      {
+        const vtkIdType i = blockBegin + k;
+        if (needPoints)
+        {
+          if (this->DataSetInput)
+          {
+            this->DataSetInput->GetPoint(i, pt);
+          }
+          else
+          {
+            this->GraphInput->GetPoint(i, pt);
+          }
+        }
+        for (size_t v = 0; v < numScalars; ++v)
+        {
+          const vtkArrayCalculatorSource& source = this->ScalarSources[v];
+          double* value = scalarValues[v];
+          if (source.Array)
+          {
+            value[k] = source.Array->GetComponent(i, source.Components[0]);
+          }
+          else if (source.Coordinates)
+          {
+            value[k] = pt[source.Components[0]];
+          }
+        }
+        for (size_t v = 0; v < numVectors; ++v)
+        {
+          const vtkArrayCalculatorSource& source = this->VectorSources[v];
+          double* value = vectorValues[v] + 3 * k;
+          for (int c = 0; c < 3; ++c)
+          {
+            if (source.Array)
+            {
+              value[c] = source.Array->GetComponent(i, source.Components[c]);
+            }
+            else if (source.Coordinates)
+            {
+              value[c] = pt[source.Components[c]];
+            }
+          }
+        }
+      }
+
+      // Invalid values are reported by the parser and give the error result.
+      this->Parser->EvaluateBatch(n,
+        numScalars ? scalarValues.data() : nullptr,
+        numVectors ? vectorValues.data() : nullptr, result);
+      for (vtkIdType k = 0; k < n; ++k)
+      {
+        this->Result->SetTuple(blockBegin + k, result + resultSize * k);
+      }
+    }
+  }
+
+private:
+  vtkFunctionParser* Parser;
+  vtkDataSet* DataSetInput;
+  vtkGraph* GraphInput;
+  const std::vector<vtkArrayCalculatorSource>& ScalarSources;
+  const std::vector<vtkArrayCalculatorSource>& VectorSources;
+  vtkDataArray* Result;
+  vtkSMPThreadLocal<std::vector<double> > Values;
+};
+
+}
+
 vtkArrayCalculator::vtkArrayCalculator()
 {
   this->FunctionParser = vtkFunctionParser::New();
@@ -417,15 +570,12 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject *input, vtkDataObject *o
   {
     resultArray->SetNumberOfComponents(1);
     resultArray->SetNumberOfTuples(numTuples);
-    double scalarResult = this->FunctionParser->GetScalarResult();
-    resultArray->SetTuple(0, &scalarResult);
   }
   else
   {
     resultArray->Allocate(numTuples * 3);
     resultArray->SetNumberOfComponents(3);
     resultArray->SetNumberOfTuples(numTuples);
-    resultArray->SetTuple(0, this->FunctionParser->GetVectorResult());
   }
 
   // Save array pointers to avoid looking them up for each tuple.
@@ -478,66 +628,57 @@ int vtkArrayCalculator::ProcessDataObject(vtkDataObject *input, vtkDataObject *o
     }
   }
 
-  for (vtkIdType i = 1; i < numTuples; i++)
+  // Gather where the values of the variables come from, the other
+  // variables keep the values of the first tuple.
+  std::vector<vtkArrayCalculatorSource> scalarSources(
+    this->FunctionParser->GetNumberOfScalarVariables());
+  std::vector<vtkArrayCalculatorSource> vectorSources(
+    this->FunctionParser->GetNumberOfVectorVariables());
+  for (int j = 0; j < this->NumberOfScalarArrays; j++)
   {
-    for (int j = 0; j < this->NumberOfScalarArrays; j++)
+    if (scalarArrays[j])
     {
-      if ((currentArray = scalarArrays[j]))
-      {
-        this->FunctionParser->
-          SetScalarVariableValue(scalarArrayIndicies[j],
-            currentArray->GetComponent(i, this->SelectedScalarComponents[j]));
-      }
+      vtkArrayCalculatorSource& source = scalarSources[scalarArrayIndicies[j]];
+      source.Array = scalarArrays[j];
+      source.Components[0] = this->SelectedScalarComponents[j];
     }
-    for (int j = 0; j < this->NumberOfVectorArrays; j++)
+  }
+  for (int j = 0; j < this->NumberOfVectorArrays; j++)
+  {
+    if (vectorArrays[j])
     {
-      if ((currentArray = vectorArrays[j]))
-      {
-        this->FunctionParser->SetVectorVariableValue(vectorArrayIndicies[j],
-            currentArray->GetComponent(i, this->SelectedVectorComponents[j][0]),
-            currentArray->GetComponent(
-              i, this->SelectedVectorComponents[j][1]),
-            currentArray->GetComponent(i, this->SelectedVectorComponents[j][2]));
-      }
+      vtkArrayCalculatorSource& source = vectorSources[vectorArrayIndicies[j]];
+      source.Array = vectorArrays[j];
+      std::copy(this->SelectedVectorComponents[j],
+                this->SelectedVectorComponents[j] + 3, source.Components);
     }
-    if (attributeType == vtkDataObject::POINT || attributeType == vtkDataObject::VERTEX)
-    {
-      double* pt = nullptr;
-      if (dsInput)
-      {
-        pt = dsInput->GetPoint(i);
-      }
-      else
-      {
-        pt = graphInput->GetPoint(i);
-      }
-      for (int j = 0; j < this->NumberOfCoordinateScalarArrays; j++)
-      {
-        this->FunctionParser->
-          SetScalarVariableValue(
-            j+this->NumberOfScalarArrays, pt[this->SelectedCoordinateScalarComponents[j]]);
-      }
-      for (int j = 0; j < this->NumberOfCoordinateVectorArrays; j++)
-      {
-        this->FunctionParser->
-          SetVectorVariableValue(
-            j+this->NumberOfVectorArrays,
-            pt[this->SelectedCoordinateVectorComponents[j][0]],
-            pt[this->SelectedCoordinateVectorComponents[j][1]],
-            pt[this->SelectedCoordinateVectorComponents[j][2]]);
-      }
-    }
-    if (resultType == SCALAR_RESULT)
+  }
+  if (attributeType == vtkDataObject::POINT || attributeType == vtkDataObject::VERTEX)
+  {
+    for (int j = 0; j < this->NumberOfCoordinateScalarArrays &&
+         j + this->NumberOfScalarArrays < static_cast<int>(scalarSources.size()); j++)
     {
-      double scalarResult = this->FunctionParser->GetScalarResult();
-      resultArray->SetTuple(i, &scalarResult);
+      vtkArrayCalculatorSource& source = scalarSources[j + this->NumberOfScalarArrays];
+      source.Array = nullptr;
+      source.Coordinates = true;
+      source.Components[0] = this->SelectedCoordinateScalarComponents[j];
     }
-    else
+    for (int j = 0; j < this->NumberOfCoordinateVectorArrays &&
+         j + this->NumberOfVectorArrays < static_cast<int>(vectorSources.size()); j++)
     {
-      resultArray->SetTuple(i, this->FunctionParser->GetVectorResult());
+      vtkArrayCalculatorSource& source = vectorSources[j + this->NumberOfVectorArrays];
+      source.Array = nullptr;
+      source.Coordinates = true;
+      std::copy(this->SelectedCoordinateVectorComponents[j],
+                this->SelectedCoordinateVectorComponents[j] + 3, source.Components);
     }
   }
 
+  // The function is parsed, so that the tuples can be evaluated in parallel.
+  vtkArrayCalculatorFunctor functor(this->FunctionParser, dsInput, graphInput,
+                                    scalarSources, vectorSources, resultArray);
+  vtkSMPTools::For(0, numTuples, functor);
+
   output->ShallowCopy(input);
   if (resultPoints)
   {
@@ -54,6 +54,9 @@
  * tuple-wise (i.e., tuple-by-tuple). The user must specify which arrays to use as
  * vectors and/or scalars, and the name of the output data array.
  *
+ * The tuples are evaluated in blocks, in parallel with vtkSMPTools, using
+ * vtkFunctionParser::EvaluateBatch().
+ *
  * @sa
  * vtkFunctionParser
 */
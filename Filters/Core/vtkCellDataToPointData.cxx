@@ -14,23 +14,36 @@
   =========================================================================*/
 #include "vtkCellDataToPointData.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkCell.h"
+#include "vtkCellType.h"
+#include "vtkCellTypes.h"
+#include "vtkDataArrayAccessor.h"
 #include "vtkDataSet.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
+#include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticCellLinks.h"
+#include "vtkStructuredData.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUniformGrid.h"
-#include "vtkUnsignedIntArray.h"
 
 #include <algorithm>
-#include <functional>
+#include <memory>
 #include <set>
+#include <vector>
 
 #define VTK_MAX_CELLS_PER_POINT 4096
 
@@ -39,88 +52,253 @@ vtkStandardNewMacro(vtkCellDataToPointData);
 namespace
 {
 //----------------------------------------------------------------------------
-// Helper template function that implement the major part of the algorighm
-// which will be expanded by the vtkTemplateMacro. The template function is
-// provided so that coverage test can cover this function.
-  template <typename T>
-  void __spread (vtkDataSet* const src, vtkUnsignedIntArray* const num,
-                 vtkDataArray* const srcarray, vtkDataArray* const dstarray,
-                 vtkIdType ncells, vtkIdType npoints, vtkIdType ncomps,
-                 int highestCellDimension, int contributingCellOption)
-  {
-    T const* const srcptr = static_cast<T const*>(srcarray->GetVoidPointer(0));
-    T      * const dstptr = static_cast<T      *>(dstarray->GetVoidPointer(0));
-
-    // zero initialization
-    std::fill_n(dstptr, npoints*ncomps, T(0));
-
-    // accumulate
-    if (contributingCellOption != vtkCellDataToPointData::Patch)
+// Type-erased access to a pair of matching cell and point data arrays, so
+// that all the arrays are processed in a single (threaded) pass over the
+// points.
+struct BaseArrayPair
+{
+  virtual ~BaseArrayPair() = default;
+
+  // Average the tuples ids with equal weights, accumulated in double
+  // precision. This gives the same values as
+  // vtkDataSetAttributes::InterpolatePoint().
+  virtual void Average(vtkIdType numIds, const vtkIdType *ids,
+                       vtkIdType outId) = 0;
+
+  // Sum the tuples ids in the value type of the arrays, then divide by the
+  // number of ids (zero if there are none).
+  virtual void Mean(vtkIdType numIds, const vtkIdType *ids,
+                    vtkIdType outId) = 0;
+};
+
+template <typename InArrayT, typename OutArrayT>
+struct ArrayPair : public BaseArrayPair
+{
+  using ValueType = typename vtkDataArrayAccessor<InArrayT>::APIType;
+
+  vtkDataArrayAccessor<InArrayT> Input;
+  vtkDataArrayAccessor<OutArrayT> Output;
+  int NumComp;
+
+  ArrayPair(InArrayT *in, OutArrayT *out) :
+    Input(in), Output(out), NumComp(in->GetNumberOfComponents())
+  {
+  }
+
+  void Average(vtkIdType numIds, const vtkIdType *ids,
+               vtkIdType outId) override
+  {
+    const double weight = numIds > 0 ? 1.0 / numIds : 0.0;
+    for (int c = 0; c < this->NumComp; ++c)
     {
-      T const* srcbeg = srcptr;
-      for (vtkIdType cid = 0; cid < ncells; ++cid, srcbeg += ncomps)
+      double val = 0.0;
+      for (vtkIdType i = 0; i < numIds; ++i)
       {
-        vtkCell* cell = src->GetCell(cid);
-        if (cell->GetCellDimension() >= highestCellDimension)
-        {
-          vtkIdList* pids = cell->GetPointIds();
-          for (vtkIdType i = 0, I = pids->GetNumberOfIds(); i < I; ++i)
-          {
-            T* const dstbeg = dstptr + pids->GetId(i)*ncomps;
-            // accumulate cell data to point data <==> point_data += cell_data
-            std::transform(srcbeg,srcbeg+ncomps,dstbeg,dstbeg,std::plus<T>());
-          }
-        }
+        val += weight * static_cast<double>(this->Input.Get(ids[i], c));
       }
-      // average
-      T* dstbeg = dstptr;
-      for (vtkIdType pid = 0; pid < npoints; ++pid, dstbeg += ncomps)
+      ValueType valT;
+      vtkMath::RoundDoubleToIntegralIfNecessary(val, &valT);
+      this->Output.Set(outId, c, valT);
+    }
+  }
+
+  void Mean(vtkIdType numIds, const vtkIdType *ids, vtkIdType outId) override
+  {
+    for (int c = 0; c < this->NumComp; ++c)
+    {
+      ValueType sum = 0;
+      for (vtkIdType i = 0; i < numIds; ++i)
       {
-        // guard against divide by zero
-        if (unsigned int const denom = num->GetValue(pid))
-        {
-          // divide point data by the number of cells using it <==>
-          // point_data /= denum
-          std::transform(dstbeg, dstbeg+ncomps, dstbeg,
-                         std::bind(std::divides<T>(), std::placeholders::_1, denom));
-        }
+        sum += this->Input.Get(ids[i], c);
+      }
+      if (numIds > 0)
+      {
+        sum /= static_cast<ValueType>(numIds);
       }
+      this->Output.Set(outId, c, sum);
     }
-    else
-    { // compute over cell patches
-      vtkNew<vtkIdList> cellsOnPoint;
-      std::vector<T> data(4*ncomps);
-      for (vtkIdType pid = 0; pid < npoints; ++pid)
+  }
+};
+
+struct ArrayPairFactory
+{
+  BaseArrayPair *Pair = nullptr;
+
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT *in, OutArrayT *out)
+  {
+    this->Pair = new ArrayPair<InArrayT, OutArrayT>(in, out);
+  }
+};
+
+// The list of array pairs to process.
+struct ArrayPairList
+{
+  std::vector<std::unique_ptr<BaseArrayPair>> Pairs;
+
+  // Add a pair of arrays; the output array is resized to numTuples. Returns
+  // false if the pair is not supported by the array dispatcher (e.g., bit
+  // arrays).
+  bool Add(vtkDataArray *in, vtkDataArray *out, vtkIdType numTuples)
+  {
+    ArrayPairFactory factory;
+    if (in->GetNumberOfComponents() != out->GetNumberOfComponents() ||
+      !vtkArrayDispatch::Dispatch2SameValueType::Execute(in, out, factory))
+    {
+      return false;
+    }
+    out->SetNumberOfTuples(numTuples);
+    this->Pairs.emplace_back(factory.Pair);
+    return true;
+  }
+
+  void Average(vtkIdType numIds, const vtkIdType *ids, vtkIdType outId)
+  {
+    for (auto& pair : this->Pairs)
+    {
+      pair->Average(numIds, ids, outId);
+    }
+  }
+
+  void Mean(vtkIdType numIds, const vtkIdType *ids, vtkIdType outId)
+  {
+    for (auto& pair : this->Pairs)
+    {
+      pair->Mean(numIds, ids, outId);
+    }
+  }
+};
+
+//----------------------------------------------------------------------------
+// Sort the cells using each point so that the data is accumulated in cell
+// id order whatever the way the links were built.
+struct SortLinks
+{
+  vtkStaticCellLinks *Links;
+
+  SortLinks(vtkStaticCellLinks *links) : Links(links) {}
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      vtkIdType *cells = this->Links->GetCells(ptId);
+      std::sort(cells, cells + this->Links->GetNcells(ptId));
+    }
+  }
+};
+
+// Look up the dimension of each cell from its type.
+struct ComputeCellDimensions
+{
+  vtkDataSet *Input;
+  const int *TypeDimensions;
+  unsigned char *CellDimensions;
+
+  ComputeCellDimensions(vtkDataSet *input, const int *typeDimensions,
+                        unsigned char *cellDimensions) :
+    Input(input), TypeDimensions(typeDimensions),
+    CellDimensions(cellDimensions)
+  {
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      this->CellDimensions[cellId] = static_cast<unsigned char>(
+        this->TypeDimensions[this->Input->GetCellType(cellId)]);
+    }
+  }
+};
+
+// Average the data of the cells using each point, over the cell links.
+// Only the cells of dimension HighestCellDimension or more contribute; with
+// the Patch option, only the cells of highest dimension using the point.
+struct SpreadCellData
+{
+  vtkStaticCellLinks *Links;
+  const unsigned char *CellDimensions;
+  int HighestCellDimension;
+  bool Patch;
+  ArrayPairList *Arrays;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> CellIds;
+
+  SpreadCellData(vtkStaticCellLinks *links,
+                 const unsigned char *cellDimensions,
+                 int highestCellDimension, bool patch,
+                 ArrayPairList *arrays) :
+    Links(links), CellDimensions(cellDimensions),
+    HighestCellDimension(highestCellDimension), Patch(patch), Arrays(arrays)
+  {
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    std::vector<vtkIdType>& cellIds = this->CellIds.Local();
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType *cells = this->Links->GetCells(ptId);
+      const vtkIdType numCells = this->Links->GetNcells(ptId);
+
+      int dimension = this->HighestCellDimension;
+      if (this->Patch)
       {
-        std::fill(data.begin(), data.end(), 0);
-        T numPointCells[4] = {0, 0, 0, 0};
-        // Get all cells touching this point.
-        src->GetPointCells(pid, cellsOnPoint);
-        vtkIdType numPatchCells = cellsOnPoint->GetNumberOfIds();
-        for (vtkIdType pc = 0; pc  < numPatchCells; pc++)
+        for (vtkIdType i = 0; i < numCells; ++i)
         {
-          vtkIdType cellId = cellsOnPoint->GetId(pc);
-          int cellDimension = src->GetCell(cellId)->GetCellDimension();
-          numPointCells[cellDimension] += 1;
-          for (int comp=0;comp<ncomps;comp++)
-          {
-            data[comp+ncomps*cellDimension] += srcptr[comp+cellId*ncomps];
-          }
+          dimension = std::max<int>(dimension,
+                                    this->CellDimensions[cells[i]]);
         }
-        for (int dimension=3;dimension>=0;dimension--)
+      }
+
+      cellIds.clear();
+      for (vtkIdType i = 0; i < numCells; ++i)
+      {
+        if (this->CellDimensions[cells[i]] >= dimension)
         {
-          if (numPointCells[dimension])
-          {
-            for (int comp=0;comp<ncomps;comp++)
-            {
-              dstptr[comp+pid*ncomps] = data[comp+dimension*ncomps] / numPointCells[dimension];
-            }
-            break;
-          }
+          cellIds.push_back(cells[i]);
         }
       }
+      this->Arrays->Mean(static_cast<vtkIdType>(cellIds.size()),
+                         cellIds.data(), ptId);
     }
   }
+};
+
+// Average the data of the cells using each point of a structured dataset,
+// whose point cells are implicit.
+struct AverageStructuredCellData
+{
+  int Dimensions[3];
+  ArrayPairList *Arrays;
+  vtkSMPThreadLocalObject<vtkIdList> CellIds;
+
+  AverageStructuredCellData(const int dims[3], ArrayPairList *arrays) :
+    Arrays(arrays)
+  {
+    std::copy(dims, dims + 3, this->Dimensions);
+  }
+
+  void Initialize()
+  {
+    this->CellIds.Local()->Allocate(8);
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    vtkIdList *cellIds = this->CellIds.Local();
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      vtkStructuredData::GetPointCells(ptId, cellIds, this->Dimensions);
+      this->Arrays->Average(cellIds->GetNumberOfIds(), cellIds->GetPointer(0),
+                            ptId);
+    }
+  }
+
+  void Reduce()
+  {
+  }
+};
 } // end anonymous namespace
 
 class vtkCellDataToPointData::Internals
@@ -213,6 +391,92 @@ class vtkCellDataToPointData::Internals
 
       return 1;
     }
+
+    // Threaded traversal for vtkImageData, vtkRectilinearGrid and
+    // vtkStructuredGrid without blanking: the cells using a point are
+    // implicit, so no links are needed. Returns false if some arrays cannot
+    // be processed this way, in which case the generic (serial) path is used.
+    bool InterpolateStructuredPointData(vtkCellDataToPointData* filter,
+                                        vtkDataSet *input, vtkDataSet *output)
+    {
+      int dims[3];
+      if (vtkImageData *image = vtkImageData::SafeDownCast(input))
+      {
+        image->GetDimensions(dims);
+      }
+      else if (vtkRectilinearGrid *rGrid = vtkRectilinearGrid::SafeDownCast(input))
+      {
+        rGrid->GetDimensions(dims);
+      }
+      else if (vtkStructuredGrid *sGrid = vtkStructuredGrid::SafeDownCast(input))
+      {
+        sGrid->GetDimensions(dims);
+      }
+      else
+      {
+        return false;
+      }
+
+      vtkIdType numPts = input->GetNumberOfPoints();
+
+      vtkCellData *inputInCD = input->GetCellData();
+      vtkSmartPointer<vtkCellData> inCD;
+      vtkPointData *outPD = output->GetPointData();
+
+      if (!filter->GetProcessAllArrays())
+      {
+        inCD = vtkSmartPointer<vtkCellData>::New();
+
+        for (const auto &name : this->CellDataArrays)
+        {
+          vtkAbstractArray *arr = inputInCD->GetAbstractArray(name.c_str());
+          if (arr == nullptr)
+          {
+            vtkWarningWithObjectMacro(filter, "cell data array name not found.");
+            continue;
+          }
+          inCD->AddArray(arr);
+        }
+      }
+      else
+      {
+        inCD = inputInCD;
+      }
+
+      outPD->InterpolateAllocate(inCD,numPts);
+
+      // Pair the cell arrays with the point arrays just allocated for them.
+      // The other point arrays (passed from the input) already have tuples.
+      ArrayPairList arrays;
+      for (int i = 0; i < inCD->GetNumberOfArrays(); ++i)
+      {
+        vtkAbstractArray *inArray = inCD->GetAbstractArray(i);
+        if (!inArray->GetName())
+        {
+          return false;
+        }
+        vtkAbstractArray *outArray = outPD->GetAbstractArray(inArray->GetName());
+        if (!outArray || outArray->GetNumberOfTuples() > 0 ||
+            outArray == input->GetPointData()->GetAbstractArray(inArray->GetName()))
+        {
+          continue;
+        }
+        int attribute = inCD->IsArrayAnAttribute(i);
+        vtkDataArray *inDA = vtkArrayDownCast<vtkDataArray>(inArray);
+        vtkDataArray *outDA = vtkArrayDownCast<vtkDataArray>(outArray);
+        if (!inDA || !outDA || (attribute != -1 &&
+            inCD->GetCopyAttribute(attribute, vtkDataSetAttributes::INTERPOLATE) == 2) ||
+            !arrays.Add(inDA, outDA, numPts))
+        {
+          return false;
+        }
+      }
+
+      AverageStructuredCellData average(dims, &arrays);
+      vtkSMPTools::For(0, numPts, average);
+
+      return true;
+    }
 };
 
 //----------------------------------------------------------------------------
@@ -319,6 +583,10 @@ int vtkCellDataToPointData::RequestData(
   {
     result = this->Implementation->InterpolatePointDataWithMask(this, uniformGrid, output);
   }
+  else if (this->Implementation->InterpolateStructuredPointData(this, input, output))
+  {
+    result = 1;
+  }
   else
   {
     result = this->InterpolatePointData(input, output);
@@ -368,46 +636,38 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData
     return 1;
   }
 
-  // count the number of cells associated with each point. if we are doing patches
-  // though we will do that later on.
-  vtkSmartPointer<vtkUnsignedIntArray> num;
-  int highestCellDimension = 0;
-  if (this->ContributingCellOption != vtkCellDataToPointData::Patch)
+  // Look up the dimension of the cells from the distinct cell types.
+  vtkNew<vtkCellTypes> cellTypes;
+  src->GetCellTypes(cellTypes);
+  int typeDimensions[VTK_NUMBER_OF_CELL_TYPES];
+  std::fill_n(typeDimensions, VTK_NUMBER_OF_CELL_TYPES, 0);
+  int maxCellDimension = 0;
+  for (vtkIdType i = 0; i < cellTypes->GetNumberOfTypes(); ++i)
   {
-    num = vtkSmartPointer<vtkUnsignedIntArray>::New();
-    num->SetNumberOfComponents(1);
-    num->SetNumberOfTuples(npoints);
-    std::fill_n(num->GetPointer(0), npoints, 0u);
-    if (this->ContributingCellOption == vtkCellDataToPointData::DataSetMax)
-    {
-      int maxDimension = src->IsA("vtkPolyData") == 1 ? 2 : 3;
-      for (vtkIdType i=0;i<src->GetNumberOfCells();i++)
-      {
-        int dim = src->GetCell(i)->GetCellDimension();
-        if (dim > highestCellDimension)
-        {
-          highestCellDimension = dim;
-          if (highestCellDimension == maxDimension)
-          {
-            break;
-          }
-        }
-      }
-    }
-    vtkNew<vtkIdList> pids;
-    for (vtkIdType cid = 0; cid < ncells; ++cid)
+    int type = cellTypes->GetCellType(i);
+    if (vtkCell *cell = vtkGenericCell::InstantiateCell(type))
     {
-      if (src->GetCell(cid)->GetCellDimension() >= highestCellDimension)
-      {
-        src->GetCellPoints(cid, pids);
-        for (vtkIdType i = 0, I = pids->GetNumberOfIds(); i < I; ++i)
-        {
-          vtkIdType const pid = pids->GetId(i);
-          num->SetValue(pid, num->GetValue(pid)+1);
-        }
-      }
+      typeDimensions[type] = cell->GetCellDimension();
+      maxCellDimension = std::max(maxCellDimension, typeDimensions[type]);
+      cell->Delete();
     }
   }
+  std::vector<unsigned char> cellDimensions(ncells);
+  ComputeCellDimensions computeCellDimensions(src, typeDimensions,
+                                              cellDimensions.data());
+  vtkSMPTools::For(0, ncells, computeCellDimensions);
+
+  int highestCellDimension = 0;
+  if (this->ContributingCellOption == vtkCellDataToPointData::DataSetMax)
+  {
+    highestCellDimension = maxCellDimension;
+  }
+
+  // The cells using each point, sorted by id.
+  vtkNew<vtkStaticCellLinks> links;
+  links->BuildLinks(src);
+  SortLinks sortLinks(links);
+  vtkSMPTools::For(0, npoints, sortLinks);
 
   // First, copy the input to the output as a starting point
   dst->CopyStructure(src);
@@ -458,30 +718,17 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData
   cfl.InitializeFieldList(processedCellData);
   opd->InterpolateAllocate(cfl, npoints, npoints);
 
-  const auto nfields = processedCellData->GetNumberOfArrays();
-  int fid = 0;
-  auto f = [this, &fid, nfields, npoints, src, num, ncells, highestCellDimension](
+  // Collect the (cell, point) array pairs, and average them all at once.
+  // The arrays that the array dispatcher does not support (e.g., bit arrays)
+  // are left unset.
+  ArrayPairList arrays;
+  auto f = [&arrays, npoints](
              vtkAbstractArray* aa_srcarray, vtkAbstractArray* aa_dstarray) {
-    // update progress and check for an abort request.
-    this->UpdateProgress((fid + 1.0) / nfields);
-    ++fid;
-
-    if (this->GetAbortExecute())
-    {
-      return;
-    }
-
     vtkDataArray* const srcarray = vtkDataArray::FastDownCast(aa_srcarray);
     vtkDataArray* const dstarray = vtkDataArray::FastDownCast(aa_dstarray);
-    if (srcarray && dstarray)
+    if (srcarray && dstarray && !arrays.Add(srcarray, dstarray, npoints))
     {
       dstarray->SetNumberOfTuples(npoints);
-      vtkIdType const ncomps = srcarray->GetNumberOfComponents();
-      switch (srcarray->GetDataType())
-      {
-        vtkTemplateMacro(__spread<VTK_TT>(src, num, srcarray, dstarray, ncells, npoints, ncomps,
-          highestCellDimension, this->ContributingCellOption));
-      }
     }
   };
 
@@ -490,6 +737,10 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData
     cfl.TransformData(0, processedCellData, dst->GetPointData(), f);
   }
 
+  SpreadCellData spread(links, cellDimensions.data(), highestCellDimension,
+    this->ContributingCellOption == vtkCellDataToPointData::Patch, &arrays);
+  vtkSMPTools::For(0, npoints, spread);
+
   if (!this->PassCellData)
   {
     dst->GetCellData()->CopyAllOff();
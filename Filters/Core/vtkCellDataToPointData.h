@@ -29,6 +29,10 @@
  * All (default), Patch and DataSetMax. Patch uses only the highest dimension
  * cells attached to a point. DataSetMax uses the highest cell dimension in
  * the entire data set.
+ * The averaging is performed in parallel with vtkSMPTools, over all the
+ * arrays at once: unstructured grids and polydata traverse the cells using
+ * each point with vtkStaticCellLinks, while vtkImageData, vtkRectilinearGrid
+ * and vtkStructuredGrid (without blanking) need no links at all.
  *
  * @warning
  * This filter is an abstract filter, that is, the output is an abstract type
@@ -0,0 +1,537 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkConnectedRegionsInternal.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkConnectedRegionsInternal
+ * @brief   label the connected regions of a dataset in parallel
+ *
+ * vtkConnectedRegionsInternal finds the regions of cells connected through
+ * shared points with vtkSMPTools. The cells using each point (given by a
+ * vtkStaticCellLinks) are joined in a lock-free union-find whose roots are
+ * the smallest cell ids of their sets, so the regions are numbered in the
+ * order of their first cell, as by the serial wave propagation of
+ * vtkConnectivityFilter and vtkPolyDataConnectivityFilter. With a scalar
+ * criterion, only the cells satisfying it are joined, and a cell which does
+ * not satisfy it starts its own region, taking the neighboring regions
+ * not reached by a smaller cell, as the wave propagation does.
+ *
+ * The points of the labeled cells are numbered in the order of their first
+ * use by the cells, in increasing cell id.
+ *
+ * @warning
+ * This is a private include file shared by the connectivity filters; its
+ * API may change without notice.
+ *
+ * @sa
+ * vtkConnectivityFilter vtkPolyDataConnectivityFilter
+ */
+
+#ifndef vtkConnectedRegionsInternal_h
+#define vtkConnectedRegionsInternal_h
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticCellLinks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace { //anonymous namespace
+
+class vtkConnectedRegionsInternal
+{
+public:
+  vtkConnectedRegionsInternal(vtkDataSet *input) :
+    Input(input), NumPts(input->GetNumberOfPoints()),
+    NumCells(input->GetNumberOfCells()), Scalars(nullptr),
+    FullScalarConnectivity(false)
+  {
+    this->ScalarRange[0] = 0.0;
+    this->ScalarRange[1] = 1.0;
+  }
+
+  // Only join the cells whose scalars (first component, in single
+  // precision) are in the range: all of them if full is set, any of them
+  // otherwise.
+  void SetScalarCriterion(vtkDataArray *scalars, const double range[2],
+                          bool full)
+  {
+    this->Scalars = scalars;
+    this->ScalarRange[0] = range[0];
+    this->ScalarRange[1] = range[1];
+    this->FullScalarConnectivity = full;
+  }
+
+  // Build the links and join the cells sharing points.
+  void BuildRegions();
+
+  // The cells using a point.
+  vtkIdType GetNumberOfPointCells(vtkIdType ptId)
+  {
+    return this->Links->GetNumberOfCells(ptId);
+  }
+  const vtkIdType *GetPointCells(vtkIdType ptId)
+  {
+    return this->Links->GetCells(ptId);
+  }
+
+  // Label every cell with its region number and fill the region sizes;
+  // return the number of regions.
+  vtkIdType LabelAllRegions(vtkIdType *regionIds, vtkIdTypeArray *regionSizes);
+
+  // Label with 0 the seed cells and the cells connected to them (the other
+  // cells get -1); return the number of labeled cells.
+  vtkIdType LabelSeededRegion(vtkIdList *seedCells, vtkIdType *regionIds);
+
+  // Number the points of the labeled cells in the order of their first use,
+  // and give each new point the smallest region number of its cells (if
+  // pointRegionIds is not null); return the number of points.
+  vtkIdType NumberPoints(const vtkIdType *regionIds, vtkIdType *pointMap,
+                         vtkIdType *pointRegionIds);
+
+private:
+  vtkDataSet *Input;
+  vtkIdType NumPts;
+  vtkIdType NumCells;
+  vtkDataArray *Scalars;
+  double ScalarRange[2];
+  bool FullScalarConnectivity;
+
+  vtkNew<vtkStaticCellLinks> Links;
+  std::unique_ptr<std::atomic<vtkIdType>[]> Parents;
+  std::vector<vtkIdType> Roots;
+  std::vector<unsigned char> Connected;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+
+  bool IsConnected(vtkIdType cellId) const
+  {
+    return this->Connected.empty() || this->Connected[cellId];
+  }
+
+  // Path halving only stores ancestors in the parents of non-root cells,
+  // so it does not interfere with the linking of roots.
+  vtkIdType Find(vtkIdType cellId)
+  {
+    vtkIdType parent = this->Parents[cellId].load(std::memory_order_relaxed);
+    while (parent != cellId)
+    {
+      const vtkIdType grandParent =
+        this->Parents[parent].load(std::memory_order_relaxed);
+      this->Parents[cellId].store(grandParent, std::memory_order_relaxed);
+      cellId = parent;
+      parent = grandParent;
+    }
+    return cellId;
+  }
+
+  // The larger root is linked to the smaller one, so the root of a set is
+  // its smallest cell id.
+  void Union(vtkIdType cellId0, vtkIdType cellId1)
+  {
+    for (;;)
+    {
+      cellId0 = this->Find(cellId0);
+      cellId1 = this->Find(cellId1);
+      if (cellId0 == cellId1)
+      {
+        return;
+      }
+      if (cellId0 > cellId1)
+      {
+        std::swap(cellId0, cellId1);
+      }
+      vtkIdType expected = cellId1;
+      if (this->Parents[cellId1].compare_exchange_strong(expected, cellId0))
+      {
+        return;
+      }
+    }
+  }
+
+  static void AtomicMin(std::atomic<vtkIdType> &value, vtkIdType candidate)
+  {
+    vtkIdType current = value.load(std::memory_order_relaxed);
+    while (candidate < current &&
+      !value.compare_exchange_weak(current, candidate,
+                                   std::memory_order_relaxed))
+    {
+    }
+  }
+
+  vtkIdList *GetCellPoints(vtkIdType cellId)
+  {
+    vtkIdList *cellPts = this->CellPoints.Local();
+    this->Input->GetCellPoints(cellId, cellPts);
+    return cellPts;
+  }
+
+  // The scalar criterion of a cell, as evaluated by the connectivity
+  // filters.
+  bool SatisfiesCriterion(vtkIdList *cellPts) const
+  {
+    double range[2] = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+    for (vtkIdType i = 0; i < cellPts->GetNumberOfIds(); ++i)
+    {
+      const double s = static_cast<float>(
+        this->Scalars->GetComponent(cellPts->GetId(i), 0));
+      range[0] = std::min(range[0], s);
+      range[1] = std::max(range[1], s);
+    }
+    if (this->FullScalarConnectivity)
+    {
+      return range[0] >= this->ScalarRange[0] &&
+        range[1] <= this->ScalarRange[1];
+    }
+    return range[1] >= this->ScalarRange[0] &&
+      range[0] <= this->ScalarRange[1];
+  }
+};
+
+//----------------------------------------------------------------------------
+void vtkConnectedRegionsInternal::BuildRegions()
+{
+  this->Links->BuildLinks(this->Input);
+
+  // Make sure the cells are built before they are accessed concurrently.
+  vtkNew<vtkIdList> cellPts;
+  this->Input->GetCellPoints(0, cellPts);
+
+  this->Parents.reset(new std::atomic<vtkIdType>[this->NumCells]);
+  vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+    for ( ; cellId < end; ++cellId)
+    {
+      this->Parents[cellId].store(cellId, std::memory_order_relaxed);
+    }
+  });
+
+  if (this->Scalars)
+  {
+    this->Connected.resize(this->NumCells);
+    vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+      for ( ; cellId < end; ++cellId)
+      {
+        this->Connected[cellId] =
+          this->SatisfiesCriterion(this->GetCellPoints(cellId)) ? 1 : 0;
+      }
+    });
+  }
+  else
+  {
+    this->Connected.clear();
+  }
+
+  // Join the connected cells using each point.
+  vtkSMPTools::For(0, this->NumPts, [&](vtkIdType ptId, vtkIdType end) {
+    for ( ; ptId < end; ++ptId)
+    {
+      const vtkIdType numCells = this->Links->GetNumberOfCells(ptId);
+      const vtkIdType *cells = this->Links->GetCells(ptId);
+      vtkIdType first = -1;
+      for (vtkIdType i = 0; i < numCells; ++i)
+      {
+        if (!this->IsConnected(cells[i]))
+        {
+          continue;
+        }
+        if (first < 0)
+        {
+          first = cells[i];
+        }
+        else
+        {
+          this->Union(first, cells[i]);
+        }
+      }
+    }
+  });
+
+  this->Roots.resize(this->NumCells);
+  vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+    for ( ; cellId < end; ++cellId)
+    {
+      this->Roots[cellId] = this->Find(cellId);
+    }
+  });
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkConnectedRegionsInternal::
+LabelAllRegions(vtkIdType *regionIds, vtkIdTypeArray *regionSizes)
+{
+  // Each region is identified by the cell starting it: the root of a set
+  // of connected cells, or, with a scalar criterion, the smallest cell not
+  // satisfying it and sharing a point with the set, if it is smaller.
+  if (this->Connected.empty())
+  {
+    std::copy(this->Roots.begin(), this->Roots.end(), regionIds);
+  }
+  else
+  {
+    vtkSMPTools::For(0, this->NumPts, [&](vtkIdType ptId, vtkIdType end) {
+      for ( ; ptId < end; ++ptId)
+      {
+        const vtkIdType numCells = this->Links->GetNumberOfCells(ptId);
+        const vtkIdType *cells = this->Links->GetCells(ptId);
+        vtkIdType root = -1;
+        vtkIdType start = VTK_ID_MAX;
+        for (vtkIdType i = 0; i < numCells; ++i)
+        {
+          if (this->Connected[cells[i]])
+          {
+            root = this->Roots[cells[i]];
+          }
+          else
+          {
+            start = std::min(start, cells[i]);
+          }
+        }
+        if (root >= 0 && start != VTK_ID_MAX)
+        {
+          AtomicMin(this->Parents[root], start);
+        }
+      }
+    });
+    vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+      for ( ; cellId < end; ++cellId)
+      {
+        regionIds[cellId] = this->Connected[cellId] ?
+          this->Parents[this->Roots[cellId]].load(std::memory_order_relaxed) :
+          cellId;
+      }
+    });
+  }
+
+  // Number the regions in the order of their starting cells.
+  std::vector<vtkIdType> regionNumbers(this->NumCells + 1);
+  vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+    for ( ; cellId < end; ++cellId)
+    {
+      regionNumbers[cellId] = regionIds[cellId] == cellId ? 1 : 0;
+    }
+  });
+  regionNumbers[this->NumCells] = 0;
+  vtkSMPTools::ExclusiveScan(regionNumbers.begin(), regionNumbers.end(),
+                             regionNumbers.begin(), vtkIdType(0));
+  const vtkIdType numRegions = regionNumbers[this->NumCells];
+
+  // The cells of a region are mostly contiguous, so the sizes are counted
+  // along runs of cells of the same region.
+  std::unique_ptr<std::atomic<vtkIdType>[]> sizes(
+    new std::atomic<vtkIdType>[numRegions]);
+  vtkSMPTools::Fill(sizes.get(), sizes.get() + numRegions, 0);
+  vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+    vtkIdType region = -1;
+    vtkIdType count = 0;
+    for ( ; cellId < end; ++cellId)
+    {
+      const vtkIdType cellRegion = regionNumbers[regionIds[cellId]];
+      regionIds[cellId] = cellRegion;
+      if (cellRegion != region)
+      {
+        if (count > 0)
+        {
+          sizes[region].fetch_add(count, std::memory_order_relaxed);
+        }
+        region = cellRegion;
+        count = 0;
+      }
+      count++;
+    }
+    if (count > 0)
+    {
+      sizes[region].fetch_add(count, std::memory_order_relaxed);
+    }
+  });
+
+  regionSizes->SetNumberOfValues(numRegions);
+  for (vtkIdType i = 0; i < numRegions; ++i)
+  {
+    regionSizes->SetValue(i, sizes[i].load(std::memory_order_relaxed));
+  }
+  return numRegions;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkConnectedRegionsInternal::
+LabelSeededRegion(vtkIdList *seedCells, vtkIdType *regionIds)
+{
+  // The seed cells are extracted whether they satisfy the scalar criterion
+  // or not, with the sets of connected cells they share points with.
+  enum { Seed = 1, Reached = 2 };
+  std::vector<unsigned char> marks(this->NumCells, 0);
+  vtkNew<vtkIdList> cellPts;
+  for (vtkIdType i = 0; i < seedCells->GetNumberOfIds(); ++i)
+  {
+    const vtkIdType cellId = seedCells->GetId(i);
+    marks[cellId] |= Seed;
+    if (this->Connected.empty())
+    {
+      marks[this->Roots[cellId]] |= Reached;
+      continue;
+    }
+    this->Input->GetCellPoints(cellId, cellPts);
+    for (vtkIdType j = 0; j < cellPts->GetNumberOfIds(); ++j)
+    {
+      const vtkIdType ptId = cellPts->GetId(j);
+      const vtkIdType numCells = this->Links->GetNumberOfCells(ptId);
+      const vtkIdType *cells = this->Links->GetCells(ptId);
+      for (vtkIdType k = 0; k < numCells; ++k)
+      {
+        if (this->Connected[cells[k]])
+        {
+          marks[this->Roots[cells[k]]] |= Reached;
+          break;
+        }
+      }
+    }
+  }
+
+  vtkSMPThreadLocal<vtkIdType> numLabeled(0);
+  vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+    vtkIdType &count = numLabeled.Local();
+    for ( ; cellId < end; ++cellId)
+    {
+      if ((marks[cellId] & Seed) || (this->IsConnected(cellId) &&
+           (marks[this->Roots[cellId]] & Reached)))
+      {
+        regionIds[cellId] = 0;
+        count++;
+      }
+      else
+      {
+        regionIds[cellId] = -1;
+      }
+    }
+  });
+
+  vtkIdType total = 0;
+  for (auto count : numLabeled)
+  {
+    total += count;
+  }
+  return total;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkConnectedRegionsInternal::
+NumberPoints(const vtkIdType *regionIds, vtkIdType *pointMap,
+             vtkIdType *pointRegionIds)
+{
+  // The first labeled cell using each point, and the smallest region
+  // number of the cells using it.
+  std::vector<vtkIdType> firstCells(this->NumPts);
+  std::vector<vtkIdType> pointRegions(pointRegionIds ? this->NumPts : 0);
+  vtkSMPTools::For(0, this->NumPts, [&](vtkIdType ptId, vtkIdType end) {
+    for ( ; ptId < end; ++ptId)
+    {
+      const vtkIdType numCells = this->Links->GetNumberOfCells(ptId);
+      const vtkIdType *cells = this->Links->GetCells(ptId);
+      vtkIdType first = VTK_ID_MAX;
+      vtkIdType region = VTK_ID_MAX;
+      for (vtkIdType i = 0; i < numCells; ++i)
+      {
+        if (regionIds[cells[i]] >= 0)
+        {
+          first = std::min(first, cells[i]);
+          region = std::min(region, regionIds[cells[i]]);
+        }
+      }
+      firstCells[ptId] = first == VTK_ID_MAX ? -1 : first;
+      if (pointRegionIds)
+      {
+        pointRegions[ptId] = region;
+      }
+      pointMap[ptId] = -1;
+    }
+  });
+
+  // Count the points used for the first time by each cell.
+  auto isFirstUse = [&](vtkIdList *cellPts, vtkIdType cellId, vtkIdType i) {
+    const vtkIdType ptId = cellPts->GetId(i);
+    if (firstCells[ptId] != cellId)
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < i; ++j)
+    {
+      if (cellPts->GetId(j) == ptId)
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+  std::vector<vtkIdType> firstPointIds(this->NumCells + 1, 0);
+  vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+    for ( ; cellId < end; ++cellId)
+    {
+      if (regionIds[cellId] < 0)
+      {
+        continue;
+      }
+      vtkIdList *cellPts = this->GetCellPoints(cellId);
+      vtkIdType count = 0;
+      for (vtkIdType i = 0; i < cellPts->GetNumberOfIds(); ++i)
+      {
+        if (isFirstUse(cellPts, cellId, i))
+        {
+          count++;
+        }
+      }
+      firstPointIds[cellId] = count;
+    }
+  });
+  vtkSMPTools::ExclusiveScan(firstPointIds.begin(), firstPointIds.end(),
+                             firstPointIds.begin(), vtkIdType(0));
+
+  vtkSMPTools::For(0, this->NumCells, [&](vtkIdType cellId, vtkIdType end) {
+    for ( ; cellId < end; ++cellId)
+    {
+      if (regionIds[cellId] < 0)
+      {
+        continue;
+      }
+      vtkIdList *cellPts = this->GetCellPoints(cellId);
+      vtkIdType newPtId = firstPointIds[cellId];
+      for (vtkIdType i = 0; i < cellPts->GetNumberOfIds(); ++i)
+      {
+        if (isFirstUse(cellPts, cellId, i))
+        {
+          const vtkIdType ptId = cellPts->GetId(i);
+          pointMap[ptId] = newPtId;
+          if (pointRegionIds)
+          {
+            pointRegionIds[newPtId] = pointRegions[ptId];
+          }
+          newPtId++;
+        }
+      }
+    }
+  });
+
+  return firstPointIds[this->NumCells];
+}
+
+} //anonymous namespace
+
+#endif // vtkConnectedRegionsInternal_h
+// VTK-HeaderTest-Exclude: vtkConnectedRegionsInternal.h
@@ -16,6 +16,7 @@
 
 #include "vtkCell.h"
 #include "vtkCellData.h"
+#include "vtkConnectedRegionsInternal.h"
 #include "vtkDataSet.h"
 #include "vtkDemandDrivenPipeline.h"
 #include "vtkFloatArray.h"
@@ -31,6 +32,7 @@
 #include "vtkUnstructuredGrid.h"
 #include "vtkIdTypeArray.h"
 
+#include <algorithm>
 #include <map>
 
 vtkObjectFactoryNewMacro(vtkConnectivityFilter);
@@ -62,6 +64,8 @@ vtkConnectivityFilter::vtkConnectivityFilter()
   this->NewCellScalars = nullptr;
 
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
+
+  this->ParallelConnectivity = 0;
 }
 
 vtkConnectivityFilter::~vtkConnectivityFilter()
@@ -242,7 +246,11 @@ int vtkConnectivityFilter::RequestData(
   this->PointIds = vtkIdList::New();
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
 
-  if ( this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  if ( this->ParallelConnectivity )
+  {
+    largestRegionId = this->LabelRegionsInParallel(input);
+  }
+  else if ( this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
   this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
   this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION )
   { //visit all cells marking with region number
@@ -535,6 +543,105 @@ int vtkConnectivityFilter::RequestData(
 }
 
 
+// Label the regions with a union-find over the cells sharing points. The
+// regions are numbered as by the wave propagation; the points are numbered
+// in the order of their first use by the cells.
+vtkIdType vtkConnectivityFilter::LabelRegionsInParallel(vtkDataSet *input)
+{
+  vtkIdType numPts = input->GetNumberOfPoints();
+  vtkIdType numCells = input->GetNumberOfCells();
+  vtkIdType largestRegionId = 0;
+  vtkIdType i, j;
+
+  vtkConnectedRegionsInternal regions(input);
+  if ( this->InScalars )
+  {
+    regions.SetScalarCriterion(this->InScalars, this->ScalarRange, false);
+  }
+  regions.BuildRegions();
+  this->UpdateProgress (0.5);
+
+  if ( this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
+  this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION )
+  {
+    this->RegionNumber =
+      regions.LabelAllRegions(this->Visited, this->RegionSizes);
+
+    vtkIdType maxCellsInRegion = 0;
+    for (i=0; i < this->RegionNumber; i++)
+    {
+      if ( this->RegionSizes->GetValue(i) > maxCellsInRegion )
+      {
+        maxCellsInRegion = this->RegionSizes->GetValue(i);
+        largestRegionId = i;
+      }
+    }
+  }
+  else // regions have been seeded, everything considered in same region
+  {
+    vtkNew<vtkIdList> seedCells;
+    if ( this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS )
+    {
+      for (i=0; i < this->Seeds->GetNumberOfIds(); i++)
+      {
+        vtkIdType ptId = this->Seeds->GetId(i);
+        if ( ptId >= 0 && ptId < numPts )
+        {
+          const vtkIdType *cells = regions.GetPointCells(ptId);
+          for (j=0; j < regions.GetNumberOfPointCells(ptId); j++)
+          {
+            seedCells->InsertNextId(cells[j]);
+          }
+        }
+      }
+    }
+    else if ( this->ExtractionMode == VTK_EXTRACT_CELL_SEEDED_REGIONS )
+    {
+      for (i=0; i < this->Seeds->GetNumberOfIds(); i++)
+      {
+        vtkIdType cellId = this->Seeds->GetId(i);
+        if ( cellId >= 0 && cellId < numCells )
+        {
+          seedCells->InsertNextId(cellId);
+        }
+      }
+    }
+    else if ( this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION )
+    {//loop over points, find closest one
+      double minDist2, dist2, x[3];
+      vtkIdType minId = 0;
+      for (minDist2=VTK_DOUBLE_MAX, i=0; i<numPts; i++)
+      {
+        input->GetPoint(i,x);
+        dist2 = vtkMath::Distance2BetweenPoints(x,this->ClosestPoint);
+        if ( dist2 < minDist2 )
+        {
+          minId = i;
+          minDist2 = dist2;
+        }
+      }
+      const vtkIdType *cells = regions.GetPointCells(minId);
+      for (j=0; j < regions.GetNumberOfPointCells(minId); j++)
+      {
+        seedCells->InsertNextId(cells[j]);
+      }
+    }
+
+    this->RegionSizes->InsertValue(
+      this->RegionNumber, regions.LabelSeededRegion(seedCells, this->Visited));
+  }
+  this->UpdateProgress (0.8);
+
+  this->PointNumber = regions.NumberPoints(this->Visited, this->PointMap,
+                                           this->NewScalars->GetPointer(0));
+  std::copy(this->Visited, this->Visited + numCells,
+            this->NewCellScalars->GetPointer(0));
+  this->UpdateProgress (0.9);
+
+  return largestRegionId;
+}
+
 // Mark current cell as visited and assign region number.  Note:
 // traversal occurs across shared vertices.
 //
@@ -778,4 +885,6 @@ void vtkConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Scalar Range: (" << range[0] << ", " << range[1] << ")\n";
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision
      << "\n";
+  os << indent << "Parallel Connectivity: "
+     << (this->ParallelConnectivity ? "On\n" : "Off\n");
 }
@@ -50,6 +50,12 @@
  * was processed and has no other significance with respect to the size of
  * or number of cells.
  *
+ * If ParallelConnectivity is on, the regions are labeled in parallel with
+ * a union-find over the cells sharing points instead of the serial wave
+ * propagation. The regions, their numbering and their sizes are the same,
+ * but the output points are numbered in the order of their first use by
+ * the cells instead of the order of the propagation.
+ *
  * @sa
  * vtkPolyDataConnectivityFilter
 */
@@ -208,6 +214,19 @@ public:
   vtkGetMacro(OutputPointsPrecision,int);
   //@}
 
+  //@{
+  /**
+   * Turn on/off the labeling of the regions in parallel, with a union-find
+   * over the cells sharing points. The regions, region ids and region
+   * sizes are the same as with the serial wave propagation, only the
+   * numbering of the output points differs: the points are numbered in the
+   * order of their first use by the (increasing) cells. Off by default.
+   */
+  vtkSetMacro(ParallelConnectivity,vtkTypeBool);
+  vtkGetMacro(ParallelConnectivity,vtkTypeBool);
+  vtkBooleanMacro(ParallelConnectivity,vtkTypeBool);
+  //@}
+
   vtkTypeBool ProcessRequest(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
 protected:
@@ -235,8 +254,13 @@ protected:
 
   int RegionIdAssignmentMode;
 
+  vtkTypeBool ParallelConnectivity;
+
   void TraverseAndMark(vtkDataSet *input);
 
+  // Label the regions in parallel; return the largest region.
+  vtkIdType LabelRegionsInParallel(vtkDataSet *input);
+
   void OrderRegionIds(vtkIdTypeArray* pointRegionIds, vtkIdTypeArray* cellRegionIds);
 
 private:
@@ -14,6 +14,8 @@
 =========================================================================*/
 #include "vtkGlyph3D.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCell.h"
 #include "vtkFloatArray.h"
@@ -22,10 +24,12 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
@@ -33,9 +37,518 @@
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkGlyph3D);
 vtkCxxSetObjectMacro(vtkGlyph3D, SourceTransform, vtkTransform);
 
+//----------------------------------------------------------------------------
+namespace
+{
+// When a single glyph is used, the glyphs are generated in parallel. The
+// glyph of each visible input point goes to a location known in advance
+// (from the number of visible points before it), so the points, cells and
+// attributes are written directly into preallocated arrays. The glyph
+// transformation is composed with the same operations as the vtkTransform
+// of the serial path, so the output is the same.
+
+// Concatenate a translation, a rotation or a scale to the right of the
+// matrix, as vtkTransform does (in PreMultiply mode).
+void GlyphTranslate(double matrix[16], double x, double y, double z)
+{
+  if (x == 0.0 && y == 0.0 && z == 0.0)
+  {
+    return;
+  }
+  double op[16];
+  vtkMatrix4x4::Identity(op);
+  op[3] = x;
+  op[7] = y;
+  op[11] = z;
+  vtkMatrix4x4::Multiply4x4(matrix, op, matrix);
+}
+
+void GlyphRotateWXYZ(double matrix[16], double angle,
+                     double x, double y, double z)
+{
+  if (angle == 0.0 || (x == 0.0 && y == 0.0 && z == 0.0))
+  {
+    return;
+  }
+
+  // the quaternion of the rotation
+  angle = vtkMath::RadiansFromDegrees(angle);
+  double w = cos(0.5 * angle);
+  double f = sin(0.5 * angle) / sqrt(x * x + y * y + z * z);
+  x *= f;
+  y *= f;
+  z *= f;
+
+  double ww = w * w;
+  double wx = w * x;
+  double wy = w * y;
+  double wz = w * z;
+  double xx = x * x;
+  double yy = y * y;
+  double zz = z * z;
+  double xy = x * y;
+  double xz = x * z;
+  double yz = y * z;
+  double s = ww - xx - yy - zz;
+
+  double op[16];
+  vtkMatrix4x4::Identity(op);
+  op[0] = xx * 2 + s;
+  op[4] = (xy + wz) * 2;
+  op[8] = (xz - wy) * 2;
+  op[1] = (xy - wz) * 2;
+  op[5] = yy * 2 + s;
+  op[9] = (yz + wx) * 2;
+  op[2] = (xz + wy) * 2;
+  op[6] = (yz - wx) * 2;
+  op[10] = zz * 2 + s;
+  vtkMatrix4x4::Multiply4x4(matrix, op, matrix);
+}
+
+void GlyphScale(double matrix[16], double x, double y, double z)
+{
+  if (x == 1.0 && y == 1.0 && z == 1.0)
+  {
+    return;
+  }
+  double op[16];
+  vtkMatrix4x4::Identity(op);
+  op[0] = x;
+  op[5] = y;
+  op[10] = z;
+  vtkMatrix4x4::Multiply4x4(matrix, op, matrix);
+}
+
+// Transform the (double) source points and normals of a glyph with the
+// given matrix, and store them in the output arrays, as vtkLinearTransform
+// does.
+template <typename T>
+void TransformGlyphPoints(const double matrix[16], const double *in,
+                          vtkIdType numPts, T *out)
+{
+  for (vtkIdType i = 0; i < numPts; ++i, in += 3, out += 3)
+  {
+    out[0] = static_cast<T>(
+      matrix[0] * in[0] + matrix[1] * in[1] + matrix[2] * in[2] + matrix[3]);
+    out[1] = static_cast<T>(
+      matrix[4] * in[0] + matrix[5] * in[1] + matrix[6] * in[2] + matrix[7]);
+    out[2] = static_cast<T>(
+      matrix[8] * in[0] + matrix[9] * in[1] + matrix[10] * in[2] + matrix[11]);
+  }
+}
+
+// The normals are transformed by the transposed inverse matrix, and
+// normalized in float, unless the source normals are neither float nor
+// double (vtkLinearTransform then normalizes them in double).
+void TransformGlyphNormals(const double matrix[16], const double *in,
+                           vtkIdType numPts, bool normalizeInDouble,
+                           float *out)
+{
+  double m[16];
+  vtkMatrix4x4::DeepCopy(m, matrix);
+  vtkMatrix4x4::Invert(m, m);
+  vtkMatrix4x4::Transpose(m, m);
+  for (vtkIdType i = 0; i < numPts; ++i, in += 3, out += 3)
+  {
+    if (normalizeInDouble)
+    {
+      double n[3] = { m[0] * in[0] + m[1] * in[1] + m[2] * in[2],
+                      m[4] * in[0] + m[5] * in[1] + m[6] * in[2],
+                      m[8] * in[0] + m[9] * in[1] + m[10] * in[2] };
+      vtkMath::Normalize(n);
+      out[0] = static_cast<float>(n[0]);
+      out[1] = static_cast<float>(n[1]);
+      out[2] = static_cast<float>(n[2]);
+    }
+    else
+    {
+      out[0] = static_cast<float>(m[0] * in[0] + m[1] * in[1] + m[2] * in[2]);
+      out[1] = static_cast<float>(m[4] * in[0] + m[5] * in[1] + m[6] * in[2]);
+      out[2] = static_cast<float>(m[8] * in[0] + m[9] * in[1] + m[10] * in[2]);
+      vtkMath::Normalize(out);
+    }
+  }
+}
+
+// The source of the glyphs, converted once for all the glyphs.
+struct GlyphSource
+{
+  vtkIdType NumberOfPoints;
+  std::vector<double> Points;  // after the source transform, if any
+  std::vector<double> Normals; // empty if the source has no normals
+  bool NormalizeInDouble;
+  std::vector<float> TCoords;  // empty if the source has no texture coords
+  int NumberOfTCoordComponents;
+  // The cells, which are all of the same kind: verts (0), lines (1),
+  // polys (2) or strips (3).
+  int CellCategory;
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> Connectivity;
+};
+
+// The type vtkPolyData::BuildCells() gives to a cell of a category.
+int GetBuiltCellType(int category, vtkIdType npts)
+{
+  switch (category)
+  {
+    case 0:
+      return npts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX;
+    case 1:
+      return npts > 2 ? VTK_POLY_LINE : VTK_LINE;
+    case 2:
+      return npts == 3 ? VTK_TRIANGLE : (npts == 4 ? VTK_QUAD : VTK_POLYGON);
+    default:
+      return VTK_TRIANGLE_STRIP;
+  }
+}
+
+// Convert the source for parallel glyphing. Return false if the source
+// cannot be glyphed in parallel: its cells are not all of the same kind, or
+// their types are not the types vtkPolyData::BuildCells() would give them,
+// or its attributes do not match its points.
+bool BuildGlyphSource(vtkPolyData *source, vtkTransform *sourceTransform,
+                      GlyphSource &glyphSource)
+{
+  vtkCellArray *categories[4] = { source->GetVerts(), source->GetLines(),
+                                  source->GetPolys(), source->GetStrips() };
+  glyphSource.CellCategory = -1;
+  for (int i = 0; i < 4; ++i)
+  {
+    if (categories[i]->GetNumberOfCells() > 0)
+    {
+      if (glyphSource.CellCategory >= 0)
+      {
+        return false;
+      }
+      glyphSource.CellCategory = i;
+    }
+  }
+
+  const vtkIdType numPts = source->GetNumberOfPoints();
+  vtkDataArray *normals = source->GetPointData()->GetNormals();
+  vtkDataArray *tcoords = source->GetPointData()->GetTCoords();
+  if ((normals && normals->GetNumberOfTuples() != numPts) ||
+      (tcoords && (tcoords->GetNumberOfTuples() < numPts ||
+                   tcoords->GetNumberOfComponents() > 3)))
+  {
+    return false;
+  }
+
+  // The cells, in the order vtkPolyData::GetCellPoints() gives them.
+  const vtkIdType numCells = source->GetNumberOfCells();
+  vtkNew<vtkIdList> cellPts;
+  glyphSource.Offsets.resize(numCells + 1);
+  glyphSource.Connectivity.clear();
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    source->GetCellPoints(cellId, cellPts);
+    vtkIdType npts = cellPts->GetNumberOfIds();
+    if (source->GetCellType(cellId) !=
+        GetBuiltCellType(glyphSource.CellCategory, npts))
+    {
+      return false;
+    }
+    glyphSource.Offsets[cellId] = glyphSource.Connectivity.size();
+    glyphSource.Connectivity.insert(glyphSource.Connectivity.end(),
+      cellPts->GetPointer(0), cellPts->GetPointer(0) + npts);
+  }
+  glyphSource.Offsets[numCells] = glyphSource.Connectivity.size();
+
+  glyphSource.NumberOfPoints = numPts;
+  glyphSource.Points.resize(3 * numPts);
+  vtkPoints *points = source->GetPoints();
+  vtkNew<vtkPoints> transformedPoints;
+  if (sourceTransform)
+  {
+    transformedPoints->SetDataTypeToDouble();
+    sourceTransform->TransformPoints(points, transformedPoints);
+    points = transformedPoints;
+  }
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    points->GetPoint(i, glyphSource.Points.data() + 3 * i);
+  }
+
+  glyphSource.Normals.clear();
+  glyphSource.NormalizeInDouble = false;
+  if (normals)
+  {
+    glyphSource.Normals.resize(3 * numPts);
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      normals->GetTuple(i, glyphSource.Normals.data() + 3 * i);
+    }
+    glyphSource.NormalizeInDouble = normals->GetDataType() != VTK_FLOAT &&
+      normals->GetDataType() != VTK_DOUBLE;
+  }
+
+  glyphSource.TCoords.clear();
+  glyphSource.NumberOfTCoordComponents = 0;
+  if (tcoords)
+  {
+    int numComps = tcoords->GetNumberOfComponents();
+    glyphSource.NumberOfTCoordComponents = numComps;
+    glyphSource.TCoords.resize(numComps * numPts);
+    double tc[3];
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      tcoords->GetTuple(i, tc);
+      for (int j = 0; j < numComps; ++j)
+      {
+        glyphSource.TCoords[numComps * i + j] = static_cast<float>(tc[j]);
+      }
+    }
+  }
+  return true;
+}
+
+// Generate the glyphs of a range of input points.
+struct GlyphGenerator
+{
+  // The input and the filter parameters
+  vtkDataSet *Input;
+  const vtkIdType *GlyphIds; // numPts+1 glyph offsets of the input points
+  vtkDataArray *ScaleScalars;
+  vtkDataArray *ColorScalars; // when colored by scalar
+  vtkDataArray *Vectors; // the vectors (or normals) if used
+  int ScaleMode;
+  int ColorMode;
+  bool Scaling;
+  bool Clamping;
+  bool Orient;
+  double ScaleFactor;
+  double Range[2];
+  double Den;
+  const GlyphSource *Source;
+
+  // The output
+  float *FloatPoints;
+  double *DoublePoints;
+  float *NewNormals;
+  float *NewVectors;
+  float *NewTCoords;
+  vtkDataArray *NewScalars;
+  float *NewScalarValues; // when colored by scale or vector
+  vtkIdType *PointIds;
+  vtkIdType *Offsets;
+  vtkIdType *Connectivity;
+  ArrayList *PointData; // null if the point data are copied serially
+  ArrayList *CellData;  // null if the cell data are not copied in parallel
+
+  void operator()(vtkIdType inPtId, vtkIdType endPtId)
+  {
+    const GlyphSource &source = *this->Source;
+    const vtkIdType numSourcePts = source.NumberOfPoints;
+    const vtkIdType numSourceCells =
+      static_cast<vtkIdType>(source.Offsets.size()) - 1;
+    const vtkIdType connSize = source.Connectivity.size();
+    double x[3], v[3] = { 0.0, 0.0, 0.0 }, vNew[3], matrix[16], p[16];
+    double s, vMag = 0.0, scalex, scaley, scalez;
+
+    for ( ; inPtId < endPtId; ++inPtId)
+    {
+      const vtkIdType glyphId = this->GlyphIds[inPtId];
+      if (glyphId == this->GlyphIds[inPtId + 1])
+      {
+        continue; // not visible
+      }
+      const vtkIdType ptIncr = glyphId * numSourcePts;
+
+      // Get the scalar and vector data
+      scalex = scaley = scalez = 1.0;
+      if (this->ScaleScalars)
+      {
+        s = this->ScaleScalars->GetComponent(inPtId, 0);
+        if (this->ScaleMode == VTK_SCALE_BY_SCALAR ||
+            this->ScaleMode == VTK_DATA_SCALING_OFF)
+        {
+          scalex = scaley = scalez = s;
+        }
+      }
+      if (this->Vectors)
+      {
+        v[0] = 0;
+        v[1] = 0;
+        v[2] = 0;
+        this->Vectors->GetTuple(inPtId, v);
+        vMag = vtkMath::Norm(v);
+        if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
+        {
+          scalex = v[0];
+          scaley = v[1];
+          scalez = v[2];
+        }
+        else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
+        {
+          scalex = scaley = scalez = vMag;
+        }
+      }
+
+      // Clamp data scale if enabled
+      if (this->Clamping)
+      {
+        const double *range = this->Range;
+        scalex = (scalex < range[0] ? range[0] :
+                  (scalex > range[1] ? range[1] : scalex));
+        scalex = (scalex - range[0]) / this->Den;
+        scaley = (scaley < range[0] ? range[0] :
+                  (scaley > range[1] ? range[1] : scaley));
+        scaley = (scaley - range[0]) / this->Den;
+        scalez = (scalez < range[0] ? range[0] :
+                  (scalez > range[1] ? range[1] : scalez));
+        scalez = (scalez - range[0]) / this->Den;
+      }
+
+      // Copy all topology (transformation independent)
+      vtkIdType *offsets = this->Offsets + glyphId * numSourceCells;
+      for (vtkIdType cellId = 0; cellId < numSourceCells; ++cellId)
+      {
+        offsets[cellId] = glyphId * connSize + source.Offsets[cellId];
+      }
+      vtkIdType *conn = this->Connectivity + glyphId * connSize;
+      for (vtkIdType i = 0; i < connSize; ++i)
+      {
+        conn[i] = source.Connectivity[i] + ptIncr;
+      }
+
+      // translate Source to Input point
+      vtkMatrix4x4::Identity(p);
+      this->Input->GetPoint(inPtId, x);
+      GlyphTranslate(p, x[0], x[1], x[2]);
+
+      if (this->Vectors)
+      {
+        // Copy Input vector
+        float *newVectors = this->NewVectors + 3 * ptIncr;
+        for (vtkIdType i = 0; i < numSourcePts; ++i, newVectors += 3)
+        {
+          newVectors[0] = static_cast<float>(v[0]);
+          newVectors[1] = static_cast<float>(v[1]);
+          newVectors[2] = static_cast<float>(v[2]);
+        }
+        if (this->Orient && (vMag > 0.0))
+        {
+          // if there is no y or z component
+          if (v[1] == 0.0 && v[2] == 0.0)
+          {
+            if (v[0] < 0) //just flip x if we need to
+            {
+              GlyphRotateWXYZ(p, 180.0, 0, 1, 0);
+            }
+          }
+          else
+          {
+            vNew[0] = (v[0] + vMag) / 2.0;
+            vNew[1] = v[1] / 2.0;
+            vNew[2] = v[2] / 2.0;
+            GlyphRotateWXYZ(p, 180.0, vNew[0], vNew[1], vNew[2]);
+          }
+        }
+      }
+
+      if (this->NewTCoords)
+      {
+        std::copy(source.TCoords.begin(), source.TCoords.end(),
+                  this->NewTCoords + ptIncr * source.NumberOfTCoordComponents);
+      }
+
+      // Copy scalar value
+      if (this->NewScalarValues)
+      {
+        float value = static_cast<float>(
+          this->ColorMode == VTK_COLOR_BY_VECTOR ? vMag : scalex);
+        std::fill_n(this->NewScalarValues + ptIncr, numSourcePts, value);
+      }
+      else if (this->ColorScalars)
+      {
+        for (vtkIdType i = 0; i < numSourcePts; ++i)
+        {
+          this->NewScalars->SetTuple(ptIncr + i, inPtId, this->ColorScalars);
+        }
+      }
+
+      // scale data if appropriate
+      if (this->Scaling)
+      {
+        if (this->ScaleMode == VTK_DATA_SCALING_OFF)
+        {
+          scalex = scaley = scalez = this->ScaleFactor;
+        }
+        else
+        {
+          scalex *= this->ScaleFactor;
+          scaley *= this->ScaleFactor;
+          scalez *= this->ScaleFactor;
+        }
+
+        if (scalex == 0.0)
+        {
+          scalex = 1.0e-10;
+        }
+        if (scaley == 0.0)
+        {
+          scaley = 1.0e-10;
+        }
+        if (scalez == 0.0)
+        {
+          scalez = 1.0e-10;
+        }
+        GlyphScale(p, scalex, scaley, scalez);
+      }
+
+      // multiply points and normals by resulting matrix
+      vtkMatrix4x4::Identity(matrix);
+      vtkMatrix4x4::Multiply4x4(matrix, p, matrix);
+      if (this->FloatPoints)
+      {
+        TransformGlyphPoints(matrix, source.Points.data(), numSourcePts,
+                             this->FloatPoints + 3 * ptIncr);
+      }
+      else
+      {
+        TransformGlyphPoints(matrix, source.Points.data(), numSourcePts,
+                             this->DoublePoints + 3 * ptIncr);
+      }
+      if (this->NewNormals)
+      {
+        TransformGlyphNormals(matrix, source.Normals.data(), numSourcePts,
+                              source.NormalizeInDouble,
+                              this->NewNormals + 3 * ptIncr);
+      }
+
+      // Copy point data from source (if possible)
+      if (this->PointData)
+      {
+        for (vtkIdType i = 0; i < numSourcePts; ++i)
+        {
+          this->PointData->Copy(inPtId, ptIncr + i);
+        }
+      }
+      if (this->CellData)
+      {
+        for (vtkIdType i = 0; i < numSourceCells; ++i)
+        {
+          this->CellData->Copy(inPtId, glyphId * numSourceCells + i);
+        }
+      }
+
+      // If point ids are to be generated, do it here
+      if (this->PointIds)
+      {
+        std::fill_n(this->PointIds + ptIncr, numSourcePts, inPtId);
+      }
+    }
+  }
+};
+
+}
+
 //----------------------------------------------------------------------------
 // Construct object with scaling on, scaling mode is by scalar value,
 // scale factor = 1.0, the range is (0,1), orient geometry is on, and
@@ -414,294 +927,472 @@ bool vtkGlyph3D::Execute(
   transformedSourcePts->SetDataTypeToDouble();
   transformedSourcePts->Allocate(numSourcePts);
 
-  // Traverse all Input points, transforming Source points and copying
-  // point attributes.
-  //
-  ptIncr=0;
-  cellIncr=0;
-  for (inPtId=0; inPtId < numPts; inPtId++)
+  // With a single source whose cells are all of the same kind, the glyphs
+  // are generated in parallel, directly into the preallocated output.
+  vtkDataArray *array3D = nullptr;
+  if ( haveVectors )
   {
-    scalex = scaley = scalez = 1.0;
-    if ( ! (inPtId % 10000) )
+    array3D = this->VectorMode == VTK_USE_NORMAL? inNormals : inVectors;
+  }
+  GlyphSource glyphSource;
+  if ( this->IndexMode == VTK_INDEXING_OFF &&
+       (!array3D || (array3D->GetNumberOfComponents() <= 3 &&
+                     array3D->GetDataType() != VTK_BIT)) &&
+       (!inSScalars || inSScalars->GetDataType() != VTK_BIT) &&
+       (!newScalars || newScalars->GetDataType() != VTK_BIT) &&
+       BuildGlyphSource(source, this->SourceTransform, glyphSource) )
+  {
+    // Each visible point gets the next glyph.
+    std::vector<vtkIdType> glyphIds(numPts + 1);
+    vtkIdType numGlyphs = 0;
+    for (inPtId=0; inPtId < numPts; inPtId++)
     {
-      this->UpdateProgress(static_cast<double>(inPtId)/numPts);
-      if (this->GetAbortExecute())
+      glyphIds[inPtId] = numGlyphs;
+      if ( !(inGhostLevels &&
+             inGhostLevels[inPtId] & vtkDataSetAttributes::DUPLICATEPOINT) &&
+           !(inputUG && !inputUG->IsPointVisible(inPtId)) &&
+           this->IsPointVisible(input, inPtId) )
       {
-        break;
+        numGlyphs++;
       }
     }
+    glyphIds[numPts] = numGlyphs;
 
-    // Get the scalar and vector data
-    if ( inSScalars )
+    const vtkIdType numOutPts = numGlyphs * numSourcePts;
+    const vtkIdType numOutCells = numGlyphs * numSourceCells;
+    const vtkIdType connSize = glyphSource.Connectivity.size();
+    newPts->SetNumberOfPoints(numOutPts);
+    if ( pointIds )
     {
-      s = inSScalars->GetComponent(inPtId, 0);
-      if ( this->ScaleMode == VTK_SCALE_BY_SCALAR ||
-           this->ScaleMode == VTK_DATA_SCALING_OFF )
-      {
-        scalex = scaley = scalez = s;
-      }
+      pointIds->SetNumberOfValues(numOutPts);
+    }
+    if ( newScalars )
+    {
+      newScalars->SetNumberOfTuples(numOutPts);
+    }
+    if ( newVectors )
+    {
+      newVectors->SetNumberOfTuples(numOutPts);
+    }
+    if ( newNormals )
+    {
+      newNormals->SetNumberOfTuples(numOutPts);
+    }
+    if ( newTCoords )
+    {
+      newTCoords->SetNumberOfTuples(numOutPts);
+    }
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(numOutCells + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(numGlyphs * connSize);
+
+    // The attributes are copied in parallel unless some arrays cannot be
+    // (for example bit arrays).
+    ArrayList pointArrays;
+    if ( pointIds )
+    {
+      pointArrays.ExcludeArray(pointIds);
+    }
+    pointArrays.AddArrays(numOutPts, pd, outputPD, 0.0, false);
+    bool copyPointData = (pointArrays.GetNumberOfArrays() ==
+                          outputPD->GetNumberOfArrays() - (pointIds ? 1 : 0));
+    ArrayList cellArrays;
+    bool copyCellData = false;
+    if ( this->FillCellData )
+    {
+      cellArrays.AddArrays(numOutCells, pd, outputCD, 0.0, false);
+      copyCellData =
+        (cellArrays.GetNumberOfArrays() == outputCD->GetNumberOfArrays());
     }
 
-    if ( haveVectors )
+    GlyphGenerator generator;
+    generator.Input = input;
+    generator.GlyphIds = glyphIds.data();
+    generator.ScaleScalars = inSScalars;
+    generator.ColorScalars =
+      (this->ColorMode == VTK_COLOR_BY_SCALAR ? inCScalars : nullptr);
+    generator.Vectors = array3D;
+    generator.ScaleMode = this->ScaleMode;
+    generator.ColorMode = this->ColorMode;
+    generator.Scaling = this->Scaling != 0;
+    generator.Clamping = this->Clamping != 0;
+    generator.Orient = this->Orient != 0;
+    generator.ScaleFactor = this->ScaleFactor;
+    generator.Range[0] = this->Range[0];
+    generator.Range[1] = this->Range[1];
+    generator.Den = den;
+    generator.Source = &glyphSource;
+    generator.FloatPoints = (newPts->GetDataType() == VTK_FLOAT ?
+      static_cast<float *>(newPts->GetVoidPointer(0)) : nullptr);
+    generator.DoublePoints = (newPts->GetDataType() == VTK_DOUBLE ?
+      static_cast<double *>(newPts->GetVoidPointer(0)) : nullptr);
+    generator.NewNormals = (newNormals ?
+      static_cast<vtkFloatArray *>(newNormals)->GetPointer(0) : nullptr);
+    generator.NewVectors = (newVectors ?
+      static_cast<vtkFloatArray *>(newVectors)->GetPointer(0) : nullptr);
+    generator.NewTCoords = (newTCoords ?
+      static_cast<vtkFloatArray *>(newTCoords)->GetPointer(0) : nullptr);
+    generator.NewScalars = newScalars;
+    generator.NewScalarValues = nullptr;
+    if ( newScalars && this->ColorMode != VTK_COLOR_BY_SCALAR )
+    {
+      generator.NewScalarValues =
+        static_cast<vtkFloatArray *>(newScalars)->GetPointer(0);
+    }
+    generator.PointIds = (pointIds ? pointIds->GetPointer(0) : nullptr);
+    generator.Offsets = offsets->GetPointer(0);
+    generator.Connectivity = connectivity->GetPointer(0);
+    generator.PointData = (copyPointData ? &pointArrays : nullptr);
+    generator.CellData = (copyCellData ? &cellArrays : nullptr);
+
+    // Some datasets build their structures on the first call to GetPoint().
+    input->GetPoint(0, x);
+    vtkSMPTools::For(0, numPts, generator);
+    offsets->SetValue(numOutCells, numGlyphs * connSize);
+
+    // Copy the attributes that could not be copied in parallel.
+    if ( !copyPointData || (this->FillCellData && !copyCellData) )
     {
-      vtkDataArray *array3D = this->VectorMode == VTK_USE_NORMAL? inNormals : inVectors;
-      if(array3D->GetNumberOfComponents()>3)
+      for (inPtId=0; inPtId < numPts; inPtId++)
       {
-        vtkErrorMacro(<<"vtkDataArray "<<array3D->GetName()<<" has more than 3 components.\n");
-        pts->Delete();
-        trans->Delete();
-        if(newPts)
+        vtkIdType glyphId = glyphIds[inPtId];
+        if ( glyphId == glyphIds[inPtId + 1] )
         {
-          newPts->Delete();
+          continue;
         }
-        if(newVectors)
+        if ( !copyPointData )
         {
-          newVectors->Delete();
+          for (i = 0; i < numSourcePts; ++i)
+          {
+            srcPointIdList->SetId(i, inPtId);
+            dstPointIdList->SetId(i, glyphId * numSourcePts + i);
+          }
+          outputPD->CopyData(pd, srcPointIdList, dstPointIdList);
+        }
+        if ( this->FillCellData && !copyCellData )
+        {
+          for (i = 0; i < numSourceCells; ++i)
+          {
+            srcCellIdList->SetId(i, inPtId);
+            dstCellIdList->SetId(i, glyphId * numSourceCells + i);
+          }
+          outputCD->CopyData(pd, srcCellIdList, dstCellIdList);
         }
-        return false;
-      }
-
-      v[0] = 0;
-      v[1] = 0;
-      v[2] = 0;
-      array3D->GetTuple(inPtId, v);
-      vMag = vtkMath::Norm(v);
-      if ( this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS )
-      {
-        scalex = v[0];
-        scaley = v[1];
-        scalez = v[2];
-      }
-      else if ( this->ScaleMode == VTK_SCALE_BY_VECTOR )
-      {
-        scalex = scaley = scalez = vMag;
       }
     }
 
-    // Clamp data scale if enabled
-    if ( this->Clamping )
+    if ( numSourceCells > 0 )
     {
-      scalex = (scalex < this->Range[0] ? this->Range[0] :
-                (scalex > this->Range[1] ? this->Range[1] : scalex));
-      scalex = (scalex - this->Range[0]) / den;
-      scaley = (scaley < this->Range[0] ? this->Range[0] :
-                (scaley > this->Range[1] ? this->Range[1] : scaley));
-      scaley = (scaley - this->Range[0]) / den;
-      scalez = (scalez < this->Range[0] ? this->Range[0] :
-                (scalez > this->Range[1] ? this->Range[1] : scalez));
-      scalez = (scalez - this->Range[0]) / den;
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(offsets, connectivity);
+      switch ( glyphSource.CellCategory )
+      {
+        case 0:
+          output->SetVerts(cells);
+          break;
+        case 1:
+          output->SetLines(cells);
+          break;
+        case 2:
+          output->SetPolys(cells);
+          break;
+        default:
+          output->SetStrips(cells);
+      }
+      output->BuildCells();
     }
-
-    // Compute index into table of glyphs
-    if ( this->IndexMode != VTK_INDEXING_OFF )
+  }
+  else
+  {
+    // Traverse all Input points, transforming Source points and copying
+    // point attributes.
+    //
+    ptIncr=0;
+    cellIncr=0;
+    for (inPtId=0; inPtId < numPts; inPtId++)
     {
-      if ( this->IndexMode == VTK_INDEXING_BY_SCALAR )
+      scalex = scaley = scalez = 1.0;
+      if ( ! (inPtId % 10000) )
       {
-        value = s;
+        this->UpdateProgress(static_cast<double>(inPtId)/numPts);
+        if (this->GetAbortExecute())
+        {
+          break;
+        }
       }
-      else
+
+      // Get the scalar and vector data
+      if ( inSScalars )
       {
-        value = vMag;
+        s = inSScalars->GetComponent(inPtId, 0);
+        if ( this->ScaleMode == VTK_SCALE_BY_SCALAR ||
+             this->ScaleMode == VTK_DATA_SCALING_OFF )
+        {
+          scalex = scaley = scalez = s;
+        }
       }
 
-      int index = static_cast<int>((value - this->Range[0])*numberOfSources / den);
-      index = (index < 0 ? 0 :
-              (index >= numberOfSources ? (numberOfSources-1) : index));
+      if ( haveVectors )
+      {
+        if(array3D->GetNumberOfComponents()>3)
+        {
+          vtkErrorMacro(<<"vtkDataArray "<<array3D->GetName()<<" has more than 3 components.\n");
+          pts->Delete();
+          trans->Delete();
+          if(newPts)
+          {
+            newPts->Delete();
+          }
+          if(newVectors)
+          {
+            newVectors->Delete();
+          }
+          return false;
+        }
 
-      source = this->GetSource(index, sourceVector);
-      if ( source != nullptr )
+        v[0] = 0;
+        v[1] = 0;
+        v[2] = 0;
+        array3D->GetTuple(inPtId, v);
+        vMag = vtkMath::Norm(v);
+        if ( this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS )
+        {
+          scalex = v[0];
+          scaley = v[1];
+          scalez = v[2];
+        }
+        else if ( this->ScaleMode == VTK_SCALE_BY_VECTOR )
+        {
+          scalex = scaley = scalez = vMag;
+        }
+      }
+
+      // Clamp data scale if enabled
+      if ( this->Clamping )
       {
-        sourcePts = source->GetPoints();
-        sourceNormals = source->GetPointData()->GetNormals();
-        numSourcePts = sourcePts->GetNumberOfPoints();
-        numSourceCells = source->GetNumberOfCells();
+        scalex = (scalex < this->Range[0] ? this->Range[0] :
+                  (scalex > this->Range[1] ? this->Range[1] : scalex));
+        scalex = (scalex - this->Range[0]) / den;
+        scaley = (scaley < this->Range[0] ? this->Range[0] :
+                  (scaley > this->Range[1] ? this->Range[1] : scaley));
+        scaley = (scaley - this->Range[0]) / den;
+        scalez = (scalez < this->Range[0] ? this->Range[0] :
+                  (scalez > this->Range[1] ? this->Range[1] : scalez));
+        scalez = (scalez - this->Range[0]) / den;
       }
-    }
 
-    // Make sure we're not indexing into empty glyph
-    if ( source == nullptr )
-    {
-      continue;
-    }
+      // Compute index into table of glyphs
+      if ( this->IndexMode != VTK_INDEXING_OFF )
+      {
+        if ( this->IndexMode == VTK_INDEXING_BY_SCALAR )
+        {
+          value = s;
+        }
+        else
+        {
+          value = vMag;
+        }
 
-    // Check ghost points.
-    // If we are processing a piece, we do not want to duplicate
-    // glyphs on the borders.
-    if (inGhostLevels &&
-        inGhostLevels[inPtId] & vtkDataSetAttributes::DUPLICATEPOINT)
-    {
-      continue;
-    }
+        int index = static_cast<int>((value - this->Range[0])*numberOfSources / den);
+        index = (index < 0 ? 0 :
+                (index >= numberOfSources ? (numberOfSources-1) : index));
 
-    if (inputUG && !inputUG->IsPointVisible(inPtId))
-    {
-      // input is a vtkUniformGrid and the current point is blanked. Don't glyph
-      // it.
-      continue;
-    }
+        source = this->GetSource(index, sourceVector);
+        if ( source != nullptr )
+        {
+          sourcePts = source->GetPoints();
+          sourceNormals = source->GetPointData()->GetNormals();
+          numSourcePts = sourcePts->GetNumberOfPoints();
+          numSourceCells = source->GetNumberOfCells();
+        }
+      }
 
-    if (!this->IsPointVisible(input, inPtId))
-    {
-      continue;
-    }
+      // Make sure we're not indexing into empty glyph
+      if ( source == nullptr )
+      {
+        continue;
+      }
 
-    // Now begin copying/transforming glyph
-    trans->Identity();
+      // Check ghost points.
+      // If we are processing a piece, we do not want to duplicate
+      // glyphs on the borders.
+      if (inGhostLevels &&
+          inGhostLevels[inPtId] & vtkDataSetAttributes::DUPLICATEPOINT)
+      {
+        continue;
+      }
 
-    // Copy all topology (transformation independent)
-    for (cellId=0; cellId < numSourceCells; cellId++)
-    {
-      source->GetCellPoints(cellId, pointIdList);
-      cellPts = pointIdList;
-      npts = cellPts->GetNumberOfIds();
-      for (pts->Reset(), i=0; i < npts; i++)
+      if (inputUG && !inputUG->IsPointVisible(inPtId))
       {
-        pts->InsertId(i, cellPts->GetId(i) + ptIncr);
+        // input is a vtkUniformGrid and the current point is blanked. Don't glyph
+        // it.
+        continue;
       }
-      output->InsertNextCell(source->GetCellType(cellId), pts);
-    }
 
-    // translate Source to Input point
-    input->GetPoint(inPtId, x);
-    trans->Translate(x[0], x[1], x[2]);
+      if (!this->IsPointVisible(input, inPtId))
+      {
+        continue;
+      }
 
-    if ( haveVectors )
-    {
-      // Copy Input vector
-      for (i=0; i < numSourcePts; i++)
+      // Now begin copying/transforming glyph
+      trans->Identity();
+
+      // Copy all topology (transformation independent)
+      for (cellId=0; cellId < numSourceCells; cellId++)
       {
-        newVectors->InsertTuple(i+ptIncr, v);
+        source->GetCellPoints(cellId, pointIdList);
+        cellPts = pointIdList;
+        npts = cellPts->GetNumberOfIds();
+        for (pts->Reset(), i=0; i < npts; i++)
+        {
+          pts->InsertId(i, cellPts->GetId(i) + ptIncr);
+        }
+        output->InsertNextCell(source->GetCellType(cellId), pts);
       }
-      if (this->Orient && (vMag > 0.0))
+
+      // translate Source to Input point
+      input->GetPoint(inPtId, x);
+      trans->Translate(x[0], x[1], x[2]);
+
+      if ( haveVectors )
       {
-        // if there is no y or z component
-        if ( v[1] == 0.0 && v[2] == 0.0 )
+        // Copy Input vector
+        for (i=0; i < numSourcePts; i++)
         {
-          if (v[0] < 0) //just flip x if we need to
-          {
-            trans->RotateWXYZ(180.0,0,1,0);
-          }
+          newVectors->InsertTuple(i+ptIncr, v);
         }
-        else
+        if (this->Orient && (vMag > 0.0))
         {
-          vNew[0] = (v[0]+vMag) / 2.0;
-          vNew[1] = v[1] / 2.0;
-          vNew[2] = v[2] / 2.0;
-          trans->RotateWXYZ(180.0,vNew[0],vNew[1],vNew[2]);
+          // if there is no y or z component
+          if ( v[1] == 0.0 && v[2] == 0.0 )
+          {
+            if (v[0] < 0) //just flip x if we need to
+            {
+              trans->RotateWXYZ(180.0,0,1,0);
+            }
+          }
+          else
+          {
+            vNew[0] = (v[0]+vMag) / 2.0;
+            vNew[1] = v[1] / 2.0;
+            vNew[2] = v[2] / 2.0;
+            trans->RotateWXYZ(180.0,vNew[0],vNew[1],vNew[2]);
+          }
         }
       }
-    }
 
-    if (haveTCoords)
-    {
-      for (i = 0; i < numSourcePts; i++)
+      if (haveTCoords)
       {
-        sourceTCoords->GetTuple(i, tc);
-        newTCoords->InsertTuple(i+ptIncr, tc);
+        for (i = 0; i < numSourcePts; i++)
+        {
+          sourceTCoords->GetTuple(i, tc);
+          newTCoords->InsertTuple(i+ptIncr, tc);
+        }
       }
-    }
 
-    // determine scale factor from scalars if appropriate
-    // Copy scalar value
-    if (inSScalars && (this->ColorMode == VTK_COLOR_BY_SCALE))
-    {
-      for (i=0; i < numSourcePts; i++)
+      // determine scale factor from scalars if appropriate
+      // Copy scalar value
+      if (inSScalars && (this->ColorMode == VTK_COLOR_BY_SCALE))
       {
-        newScalars->InsertTuple(i+ptIncr, &scalex); // = scaley = scalez
+        for (i=0; i < numSourcePts; i++)
+        {
+          newScalars->InsertTuple(i+ptIncr, &scalex); // = scaley = scalez
+        }
       }
-    }
-    else if (inCScalars && (this->ColorMode == VTK_COLOR_BY_SCALAR))
-    {
-      for (i=0; i < numSourcePts; i++)
+      else if (inCScalars && (this->ColorMode == VTK_COLOR_BY_SCALAR))
       {
-        outputPD->CopyTuple(inCScalars, newScalars, inPtId, ptIncr+i);
+        for (i=0; i < numSourcePts; i++)
+        {
+          outputPD->CopyTuple(inCScalars, newScalars, inPtId, ptIncr+i);
+        }
       }
-    }
-    if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
-    {
-      for (i=0; i < numSourcePts; i++)
+      if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
       {
-        newScalars->InsertTuple(i+ptIncr, &vMag);
+        for (i=0; i < numSourcePts; i++)
+        {
+          newScalars->InsertTuple(i+ptIncr, &vMag);
+        }
       }
-    }
 
-    // scale data if appropriate
-    if ( this->Scaling )
-    {
-      if ( this->ScaleMode == VTK_DATA_SCALING_OFF )
+      // scale data if appropriate
+      if ( this->Scaling )
       {
-        scalex = scaley = scalez = this->ScaleFactor;
-      }
-      else
-      {
-        scalex *= this->ScaleFactor;
-        scaley *= this->ScaleFactor;
-        scalez *= this->ScaleFactor;
-      }
+        if ( this->ScaleMode == VTK_DATA_SCALING_OFF )
+        {
+          scalex = scaley = scalez = this->ScaleFactor;
+        }
+        else
+        {
+          scalex *= this->ScaleFactor;
+          scaley *= this->ScaleFactor;
+          scalez *= this->ScaleFactor;
+        }
 
-      if ( scalex == 0.0 )
-      {
-        scalex = 1.0e-10;
+        if ( scalex == 0.0 )
+        {
+          scalex = 1.0e-10;
+        }
+        if ( scaley == 0.0 )
+        {
+          scaley = 1.0e-10;
+        }
+        if ( scalez == 0.0 )
+        {
+          scalez = 1.0e-10;
+        }
+        trans->Scale(scalex,scaley,scalez);
       }
-      if ( scaley == 0.0 )
+
+      // multiply points and normals by resulting matrix
+      if (this->SourceTransform)
       {
-        scaley = 1.0e-10;
+        transformedSourcePts->Reset();
+        this->SourceTransform->TransformPoints(sourcePts, transformedSourcePts);
+        trans->TransformPoints(transformedSourcePts, newPts);
       }
-      if ( scalez == 0.0 )
+      else
       {
-        scalez = 1.0e-10;
+        trans->TransformPoints(sourcePts,newPts);
       }
-      trans->Scale(scalex,scaley,scalez);
-    }
-
-    // multiply points and normals by resulting matrix
-    if (this->SourceTransform)
-    {
-      transformedSourcePts->Reset();
-      this->SourceTransform->TransformPoints(sourcePts, transformedSourcePts);
-      trans->TransformPoints(transformedSourcePts, newPts);
-    }
-    else
-    {
-      trans->TransformPoints(sourcePts,newPts);
-    }
 
-    if ( haveNormals )
-    {
-      trans->TransformNormals(sourceNormals,newNormals);
-    }
-
-    // Copy point data from source (if possible)
-    if ( pd )
-    {
-      for (i = 0; i < numSourcePts; ++i)
+      if ( haveNormals )
       {
-        srcPointIdList->SetId(i, inPtId);
-        dstPointIdList->SetId(i, ptIncr + i);
+        trans->TransformNormals(sourceNormals,newNormals);
       }
-      outputPD->CopyData(pd, srcPointIdList, dstPointIdList);
-      if (this->FillCellData)
+
+      // Copy point data from source (if possible)
+      if ( pd )
       {
-        for (i = 0; i < numSourceCells; ++i)
+        for (i = 0; i < numSourcePts; ++i)
         {
-          srcCellIdList->SetId(i, inPtId);
-          dstCellIdList->SetId(i, cellIncr + i);
+          srcPointIdList->SetId(i, inPtId);
+          dstPointIdList->SetId(i, ptIncr + i);
+        }
+        outputPD->CopyData(pd, srcPointIdList, dstPointIdList);
+        if (this->FillCellData)
+        {
+          for (i = 0; i < numSourceCells; ++i)
+          {
+            srcCellIdList->SetId(i, inPtId);
+            dstCellIdList->SetId(i, cellIncr + i);
+          }
+          outputCD->CopyData(pd, srcCellIdList, dstCellIdList);
         }
-        outputCD->CopyData(pd, srcCellIdList, dstCellIdList);
       }
-    }
 
-    // If point ids are to be generated, do it here
-    if ( this->GeneratePointIds )
-    {
-      for (i=0; i < numSourcePts; i++)
+      // If point ids are to be generated, do it here
+      if ( this->GeneratePointIds )
       {
-        pointIds->InsertNextValue(inPtId);
+        for (i=0; i < numSourcePts; i++)
+        {
+          pointIds->InsertNextValue(inPtId);
+        }
       }
-    }
 
-    ptIncr += numSourcePts;
-    cellIncr += numSourceCells;
+      ptIncr += numSourcePts;
+      cellIncr += numSourceCells;
+    }
   }
 
   // Update ourselves and release memory
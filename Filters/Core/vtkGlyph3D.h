@@ -73,6 +73,12 @@
  * vtkAlgorithm. The first array is scalars, the next vectors, the next
  * normals and finally color scalars.
  *
+ * @warning
+ * When indexing is off and the cells of the source are all of the same
+ * kind (all vertices, lines, polygons or triangle strips), the glyphs are
+ * generated in parallel with vtkSMPTools. The output is the same as the
+ * one of the serial algorithm.
+ *
  * @sa
  * vtkTensorGlyph
 */
@@ -17,17 +17,27 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <memory>
 #include <set>
 #include <vector>
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayAccessor.h"
 #include "vtkDataSet.h"
 #include "vtkIdList.h"
+#include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStructuredData.h"
+#include "vtkStructuredGrid.h"
 
 #define VTK_EPSILON 1.e-6
 
@@ -149,6 +159,198 @@ vtkIdType Histogram::IndexOfLargestBin()
   return std::max_element(this->Bins.begin(), it2, BinCountCmp)->Index;
 }
 
+//----------------------------------------------------------------------------
+// Type-erased averaging of a pair of matching point and cell data arrays,
+// so that all the arrays are processed in a single (threaded) pass over the
+// cells.
+struct BaseArrayPair
+{
+  virtual ~BaseArrayPair() = default;
+
+  // Average the tuples ids with equal weights, accumulated in double
+  // precision. This gives the same values as
+  // vtkDataSetAttributes::InterpolatePoint().
+  virtual void Average(vtkIdType numIds, const vtkIdType *ids,
+                       vtkIdType outId) = 0;
+};
+
+template <typename InArrayT, typename OutArrayT>
+struct ArrayPair : public BaseArrayPair
+{
+  using ValueType = typename vtkDataArrayAccessor<InArrayT>::APIType;
+
+  vtkDataArrayAccessor<InArrayT> Input;
+  vtkDataArrayAccessor<OutArrayT> Output;
+  int NumComp;
+
+  ArrayPair(InArrayT *in, OutArrayT *out) :
+    Input(in), Output(out), NumComp(in->GetNumberOfComponents())
+  {
+  }
+
+  void Average(vtkIdType numIds, const vtkIdType *ids,
+               vtkIdType outId) override
+  {
+    const double weight = numIds > 0 ? 1.0 / numIds : 0.0;
+    for (int c = 0; c < this->NumComp; ++c)
+    {
+      double val = 0.0;
+      for (vtkIdType i = 0; i < numIds; ++i)
+      {
+        val += weight * static_cast<double>(this->Input.Get(ids[i], c));
+      }
+      ValueType valT;
+      vtkMath::RoundDoubleToIntegralIfNecessary(val, &valT);
+      this->Output.Set(outId, c, valT);
+    }
+  }
+};
+
+struct ArrayPairFactory
+{
+  BaseArrayPair *Pair = nullptr;
+
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT *in, OutArrayT *out)
+  {
+    this->Pair = new ArrayPair<InArrayT, OutArrayT>(in, out);
+  }
+};
+
+// The list of array pairs to process.
+struct ArrayPairList
+{
+  std::vector<std::unique_ptr<BaseArrayPair>> Pairs;
+
+  // Pair the point arrays with the cell arrays allocated for them by
+  // vtkDataSetAttributes::InterpolateAllocate(), and resize the latter to
+  // numCells. Returns false if some arrays cannot be averaged this way
+  // (non-numeric arrays, arrays interpolated by nearest neighbor, or arrays
+  // not supported by the array dispatcher).
+  bool Build(vtkPointData *inPD, vtkCellData *passedCD, vtkCellData *outCD,
+             vtkIdType numCells)
+  {
+    for (int i = 0; i < inPD->GetNumberOfArrays(); ++i)
+    {
+      vtkAbstractArray *inArray = inPD->GetAbstractArray(i);
+      const char *name = inArray->GetName();
+      if (!name)
+      {
+        return false;
+      }
+      // The other cell arrays (passed from the input) already have tuples.
+      vtkAbstractArray *outArray = outCD->GetAbstractArray(name);
+      if (!outArray || outArray->GetNumberOfTuples() > 0 ||
+          outArray == passedCD->GetAbstractArray(name))
+      {
+        continue;
+      }
+      int attribute = inPD->IsArrayAnAttribute(i);
+      vtkDataArray *inDA = vtkArrayDownCast<vtkDataArray>(inArray);
+      vtkDataArray *outDA = vtkArrayDownCast<vtkDataArray>(outArray);
+      ArrayPairFactory factory;
+      if (!inDA || !outDA || (attribute != -1 &&
+          inPD->GetCopyAttribute(attribute, vtkDataSetAttributes::INTERPOLATE) == 2) ||
+          inDA->GetNumberOfComponents() != outDA->GetNumberOfComponents() ||
+          !vtkArrayDispatch::Dispatch2SameValueType::Execute(inDA, outDA, factory))
+      {
+        return false;
+      }
+      outDA->SetNumberOfTuples(numCells);
+      this->Pairs.emplace_back(factory.Pair);
+    }
+    return true;
+  }
+
+  void Average(vtkIdType numIds, const vtkIdType *ids, vtkIdType outId)
+  {
+    for (auto& pair : this->Pairs)
+    {
+      pair->Average(numIds, ids, outId);
+    }
+  }
+};
+
+// Average the point data of each cell. The points of the cells of
+// structured datasets are computed directly (in the order of
+// vtkStructuredGrid::GetCellPoints() when HexahedronOrder is set); other
+// datasets must support concurrent GetCellPoints() calls.
+struct AveragePointData
+{
+  vtkDataSet *Input;
+  ArrayPairList *Arrays;
+  int MaxCellSize;
+  bool Structured;
+  bool HexahedronOrder;
+  int Dimensions[3];
+  int DataDescription;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+
+  AveragePointData(vtkDataSet *input, ArrayPairList *arrays) :
+    Input(input), Arrays(arrays), MaxCellSize(input->GetMaxCellSize()),
+    Structured(false), HexahedronOrder(false), DataDescription(VTK_EMPTY)
+  {
+    if (vtkImageData *image = vtkImageData::SafeDownCast(input))
+    {
+      this->Structured = true;
+      image->GetDimensions(this->Dimensions);
+    }
+    else if (vtkRectilinearGrid *rGrid = vtkRectilinearGrid::SafeDownCast(input))
+    {
+      this->Structured = true;
+      rGrid->GetDimensions(this->Dimensions);
+    }
+    else if (vtkStructuredGrid *sGrid = vtkStructuredGrid::SafeDownCast(input))
+    {
+      this->Structured = true;
+      this->HexahedronOrder = true;
+      sGrid->GetDimensions(this->Dimensions);
+    }
+    if (this->Structured)
+    {
+      this->DataDescription =
+        vtkStructuredData::GetDataDescription(this->Dimensions);
+    }
+  }
+
+  void Initialize()
+  {
+    this->CellPoints.Local()->Allocate(this->MaxCellSize);
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdList *cellPts = this->CellPoints.Local();
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      if (this->Structured)
+      {
+        vtkStructuredData::GetCellPoints(cellId, cellPts,
+          this->DataDescription, this->Dimensions);
+        if (this->HexahedronOrder && cellPts->GetNumberOfIds() >= 4)
+        {
+          vtkIdType *ids = cellPts->GetPointer(0);
+          std::swap(ids[2], ids[3]);
+          if (cellPts->GetNumberOfIds() == 8)
+          {
+            std::swap(ids[6], ids[7]);
+          }
+        }
+      }
+      else
+      {
+        this->Input->GetCellPoints(cellId, cellPts);
+      }
+      this->Arrays->Average(cellPts->GetNumberOfIds(), cellPts->GetPointer(0),
+                            cellId);
+    }
+  }
+
+  void Reduce()
+  {
+  }
+};
+
 }
 
 class vtkPointDataToCellData::Internals
@@ -308,7 +510,23 @@ int vtkPointDataToCellData::RequestData(
   // It's weird, but it works.
   outCD->InterpolateAllocate(inPD,numCells);
 
-  int abort=0;
+  // Without categorical data, the point data of the cells are averaged in
+  // parallel for unstructured grids, polydata and structured datasets.
+  ArrayPairList arrays;
+  bool threaded = !this->CategoricalData &&
+    (input->IsA("vtkUnstructuredGrid") || input->IsA("vtkPolyData") ||
+     input->IsA("vtkImageData") || input->IsA("vtkRectilinearGrid") ||
+     input->IsA("vtkStructuredGrid")) &&
+    arrays.Build(inPD, input->GetCellData(), outCD, numCells);
+  if (threaded)
+  {
+    // The first call builds the cells of polydata, if needed.
+    input->GetCellPoints(0, cellPts);
+    AveragePointData average(input, &arrays);
+    vtkSMPTools::For(0, numCells, average);
+  }
+
+  int abort=threaded;
   vtkIdType progressInterval=numCells/20 + 1;
   for (cellId=0; cellId < numCells && !abort; cellId++)
   {
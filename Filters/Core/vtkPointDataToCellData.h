@@ -23,6 +23,9 @@
  * several cell data arrays, the filter optionally supports selective
  * processing to speed up processing. Optionally, the input point
  * data can be passed through to the output as well.
+ * Unless CategoricalData is on, unstructured grids, polydata, vtkImageData,
+ * vtkRectilinearGrid and vtkStructuredGrid are processed in parallel with
+ * vtkSMPTools, over all the arrays at once.
  *
  * @warning
  * This filter is an abstract filter, that is, the output is an abstract type
@@ -17,6 +17,7 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCell.h"
+#include "vtkConnectedRegionsInternal.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
@@ -58,6 +59,8 @@ vtkPolyDataConnectivityFilter::vtkPolyDataConnectivityFilter()
   this->VisitedPointIds = vtkIdList::New();
 
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+
+  this->ParallelConnectivity = 0;
 }
 
 vtkPolyDataConnectivityFilter::~vtkPolyDataConnectivityFilter()
@@ -135,7 +138,14 @@ int vtkPolyDataConnectivityFilter::RequestData(
   //
   this->Mesh = vtkPolyData::New();
   this->Mesh->CopyStructure(input);
-  this->Mesh->BuildLinks();
+  if ( this->ParallelConnectivity )
+  {
+    this->Mesh->BuildCells();
+  }
+  else
+  {
+    this->Mesh->BuildLinks();
+  }
   this->UpdateProgress(0.10);
 
   // Remove all visited point ids
@@ -186,7 +196,11 @@ int vtkPolyDataConnectivityFilter::RequestData(
   this->PointIds = vtkIdList::New();
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
 
-  if ( this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  if ( this->ParallelConnectivity )
+  {
+    largestRegionId = this->LabelRegionsInParallel();
+  }
+  else if ( this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
   this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
   this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION )
   { //visit all cells marking with region number
@@ -446,6 +460,104 @@ int vtkPolyDataConnectivityFilter::RequestData(
   return 1;
 }
 
+// Label the regions with a union-find over the cells sharing points. The
+// regions are numbered as by the wave propagation; the points are numbered
+// in the order of their first use by the cells.
+vtkIdType vtkPolyDataConnectivityFilter::LabelRegionsInParallel()
+{
+  const vtkIdType numPts = this->Mesh->GetNumberOfPoints();
+  const vtkIdType numCells = this->Mesh->GetNumberOfCells();
+  vtkIdType largestRegionId = 0;
+  vtkIdType i, j;
+
+  vtkConnectedRegionsInternal regions(this->Mesh);
+  if ( this->InScalars )
+  {
+    regions.SetScalarCriterion(this->InScalars, this->ScalarRange,
+                               this->FullScalarConnectivity != 0);
+  }
+  regions.BuildRegions();
+  this->UpdateProgress (0.5);
+
+  if ( this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
+  this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION )
+  {
+    this->RegionNumber =
+      regions.LabelAllRegions(this->Visited, this->RegionSizes);
+
+    vtkIdType maxCellsInRegion = 0;
+    for (i=0; i < this->RegionNumber; i++)
+    {
+      if ( this->RegionSizes->GetValue(i) > maxCellsInRegion )
+      {
+        maxCellsInRegion = this->RegionSizes->GetValue(i);
+        largestRegionId = i;
+      }
+    }
+  }
+  else // regions have been seeded, everything considered in same region
+  {
+    vtkNew<vtkIdList> seedCells;
+    if ( this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_REGIONS )
+    {
+      for (i=0; i < this->Seeds->GetNumberOfIds(); i++)
+      {
+        vtkIdType ptId = this->Seeds->GetId(i);
+        if ( ptId >= 0 && ptId < numPts )
+        {
+          const vtkIdType *cells = regions.GetPointCells(ptId);
+          for (j=0; j < regions.GetNumberOfPointCells(ptId); j++)
+          {
+            seedCells->InsertNextId(cells[j]);
+          }
+        }
+      }
+    }
+    else if ( this->ExtractionMode == VTK_EXTRACT_CELL_SEEDED_REGIONS )
+    {
+      for (i=0; i < this->Seeds->GetNumberOfIds(); i++)
+      {
+        vtkIdType cellId = this->Seeds->GetId(i);
+        if ( cellId >= 0 && cellId < numCells )
+        {
+          seedCells->InsertNextId(cellId);
+        }
+      }
+    }
+    else if ( this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_REGION )
+    {//loop over points, find closest one
+      double minDist2, dist2, x[3];
+      vtkIdType minId = 0;
+      for (minDist2=VTK_DOUBLE_MAX, i=0; i<numPts; i++)
+      {
+        this->Mesh->GetPoint(i,x);
+        dist2 = vtkMath::Distance2BetweenPoints(x,this->ClosestPoint);
+        if ( dist2 < minDist2 )
+        {
+          minId = i;
+          minDist2 = dist2;
+        }
+      }
+      const vtkIdType *cells = regions.GetPointCells(minId);
+      for (j=0; j < regions.GetNumberOfPointCells(minId); j++)
+      {
+        seedCells->InsertNextId(cells[j]);
+      }
+    }
+
+    this->RegionSizes->InsertValue(
+      this->RegionNumber, regions.LabelSeededRegion(seedCells, this->Visited));
+  }
+  this->UpdateProgress (0.8);
+
+  this->PointNumber = regions.NumberPoints(this->Visited, this->PointMap,
+    vtkArrayDownCast<vtkIdTypeArray>(this->NewScalars)->GetPointer(0));
+  this->UpdateProgress (0.9);
+
+  return largestRegionId;
+}
+
 // Mark current cell as visited and assign region number.  Note:
 // traversal occurs across shared vertices.
 //
@@ -659,4 +771,6 @@ void vtkPolyDataConnectivityFilter::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Parallel Connectivity: "
+     << (this->ParallelConnectivity ? "On\n" : "Off\n");
 }
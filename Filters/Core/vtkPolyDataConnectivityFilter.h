@@ -43,6 +43,12 @@
  * This use of ScalarConnectivity is particularly useful for selecting cells
  * for later processing.
  *
+ * If ParallelConnectivity is on, the regions are labeled in parallel with
+ * a union-find over the cells sharing points instead of the serial wave
+ * propagation. The regions, their numbering and their sizes are the same,
+ * but the output points are numbered in the order of their first use by
+ * the cells instead of the order of the propagation.
+ *
  * @sa
  * vtkConnectivityFilter
 */
@@ -222,6 +228,19 @@ public:
   vtkGetMacro(OutputPointsPrecision,int);
   //@}
 
+  //@{
+  /**
+   * Turn on/off the labeling of the regions in parallel, with a union-find
+   * over the cells sharing points. The regions, region ids and region
+   * sizes are the same as with the serial wave propagation, only the
+   * numbering of the output points differs: the points are numbered in the
+   * order of their first use by the (increasing) cells. Off by default.
+   */
+  vtkSetMacro(ParallelConnectivity,vtkTypeBool);
+  vtkGetMacro(ParallelConnectivity,vtkTypeBool);
+  vtkBooleanMacro(ParallelConnectivity,vtkTypeBool);
+  //@}
+
 protected:
   vtkPolyDataConnectivityFilter();
   ~vtkPolyDataConnectivityFilter() override;
@@ -247,6 +266,9 @@ protected:
 
   void TraverseAndMark();
 
+  // Label the regions in parallel; return the largest region.
+  vtkIdType LabelRegionsInParallel();
+
   // used to support algorithm execution
   vtkDataArray *CellScalars;
   vtkIdList *NeighborCellPointIds;
@@ -266,6 +288,7 @@ protected:
 
   vtkTypeBool MarkVisitedPointIds;
   int OutputPointsPrecision;
+  vtkTypeBool ParallelConnectivity;
 
 private:
   vtkPolyDataConnectivityFilter(const vtkPolyDataConnectivityFilter&) = delete;
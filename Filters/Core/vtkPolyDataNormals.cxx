@@ -26,9 +26,15 @@
 #include "vtkPolygon.h"
 #include "vtkTriangleStrip.h"
 #include "vtkPriorityQueue.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticCellLinks.h"
 
 #include "vtkNew.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkPolyDataNormals);
 
 // Construct with feature angle=30, splitting and consistency turned on,
@@ -49,9 +55,11 @@ vtkPolyDataNormals::vtkPolyDataNormals()
   this->Wave = nullptr;
   this->Wave2 = nullptr;
   this->CellIds = nullptr;
-  this->Map = nullptr;
-  this->OldMesh = nullptr;
-  this->NewMesh = nullptr;
+  this->CellPoints = nullptr;
+  this->NeighborPoints = nullptr;
+  this->OldPolys = nullptr;
+  this->NewPolys = nullptr;
+  this->Links = nullptr;
   this->Visited = nullptr;
   this->PolyNormals = nullptr;
   this->CosAngle = 0.0;
@@ -60,6 +68,353 @@ vtkPolyDataNormals::vtkPolyDataNormals()
 #define VTK_CELL_NOT_VISITED     0
 #define VTK_CELL_VISITED         1
 
+namespace
+{
+
+// The cells using a point are visited in ascending order, as with
+// vtkCellLinks, so that the traversals do not depend on how the links were
+// built.
+struct SortLinks
+{
+  vtkStaticCellLinks *Links;
+
+  SortLinks(vtkStaticCellLinks *links) : Links(links) {}
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      vtkIdType *cells = this->Links->GetCells(ptId);
+      std::sort(cells, cells + this->Links->GetNcells(ptId));
+    }
+  }
+};
+
+// The cells other than cellId using the edge (p1,p2), in the order of the
+// cells using p1 (see vtkPolyData::GetCellEdgeNeighbors()).
+void GetCellEdgeNeighbors(vtkStaticCellLinks *links, vtkIdType cellId,
+                          vtkIdType p1, vtkIdType p2, vtkIdList *cellIds)
+{
+  cellIds->Reset();
+
+  const vtkIdType *cells1 = links->GetCells(p1);
+  const vtkIdType *cells1End = cells1 + links->GetNcells(p1);
+  const vtkIdType *cells2 = links->GetCells(p2);
+  const vtkIdType *cells2End = cells2 + links->GetNcells(p2);
+
+  for ( ; cells1 != cells1End; ++cells1)
+  {
+    if (*cells1 != cellId && std::find(cells2, cells2End, *cells1) != cells2End)
+    {
+      cellIds->InsertNextId(*cells1);
+    }
+  }
+}
+
+// Compute the normal of each polygon.
+struct ComputePolyNormals
+{
+  vtkPoints *Points;
+  vtkCellArray *Polys;
+  float *Normals;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+
+  ComputePolyNormals(vtkPoints *points, vtkCellArray *polys, float *normals) :
+    Points(points), Polys(polys), Normals(normals)
+  {
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdList *cellPoints = this->CellPoints.Local();
+    vtkIdType npts;
+    const vtkIdType *pts;
+    double n[3];
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      this->Polys->GetCellAtId(cellId, npts, pts, cellPoints);
+      vtkPolygon::ComputeNormal(this->Points, npts,
+                                const_cast<vtkIdType*>(pts), n);
+      float *normal = this->Normals + 3 * cellId;
+      normal[0] = static_cast<float>(n[0]);
+      normal[1] = static_cast<float>(n[1]);
+      normal[2] = static_cast<float>(n[2]);
+    }
+  }
+};
+
+// Around each point, label the regions of cells connected by edges that are
+// not feature edges. The label of the k-th cell using a point is stored at
+// the same position as the cell in the links. All the regions but the first
+// one get a new point, their number is stored in NumberOfSplits.
+struct MarkRegions
+{
+  vtkCellArray *Polys;
+  vtkStaticCellLinks *Links;
+  const float *PolyNormals;
+  double CosAngle;
+  int *Regions;
+  vtkIdType *NumberOfSplits;
+  vtkSMPThreadLocalObject<vtkIdList> CellIds;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+
+  MarkRegions(vtkCellArray *polys, vtkStaticCellLinks *links,
+              const float *polyNormals, double cosAngle, int *regions,
+              vtkIdType *numberOfSplits) :
+    Polys(polys), Links(links), PolyNormals(polyNormals), CosAngle(cosAngle),
+    Regions(regions), NumberOfSplits(numberOfSplits)
+  {
+  }
+
+  // The point next to ptId in the cell that is not nei.
+  static vtkIdType OtherPoint(vtkIdType numPts, const vtkIdType *pts,
+                              vtkIdType ptId, vtkIdType nei)
+  {
+    vtkIdType spot;
+    for (spot=0; spot < numPts; spot++)
+    {
+      if ( pts[spot] == ptId )
+      {
+        break;
+      }
+    }
+
+    if (spot == 0)
+    {
+      return (pts[spot+1] != nei ? pts[spot+1] : pts[numPts-1]);
+    }
+    else if (spot == (numPts-1))
+    {
+      return (pts[spot-1] != nei ? pts[spot-1] : pts[0]);
+    }
+    return (pts[spot+1] != nei ? pts[spot+1] : pts[spot-1]);
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    vtkIdList *cellIds = this->CellIds.Local();
+    vtkIdList *cellPoints = this->CellPoints.Local();
+    const vtkIdType *links = this->Links->GetCells(0);
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType ncells = this->Links->GetNcells(ptId);
+      const vtkIdType *cells = this->Links->GetCells(ptId);
+      int *visited = this->Regions + (cells - links);
+      this->NumberOfSplits[ptId] = 0;
+      if ( ncells <= 1 )
+      {
+        std::fill_n(visited, ncells, 0);
+        continue; //point does not need to be further disconnected
+      }
+      std::fill_n(visited, ncells, -1);
+
+      // A cell used twice by the point is labeled at its first position.
+      auto label = [cells, ncells, visited](vtkIdType cellId) -> int&
+      {
+        return visited[std::lower_bound(cells, cells + ncells, cellId) - cells];
+      };
+
+      // Starting from each unvisited cell, walk over the two edges using
+      // ptId while the neighbor is unique, unvisited and not separated by a
+      // feature edge.
+      vtkIdType numPts;
+      const vtkIdType *pts;
+      int numRegions = 0;
+      vtkIdType neiPt[2], nei, cellId, neiCellId;
+      double thisNormal[3], neiNormal[3];
+      for (vtkIdType j=0; j < ncells; j++)
+      {
+        if ( label(cells[j]) >= 0 )
+        {
+          continue;
+        }
+        label(cells[j]) = numRegions;
+        this->Polys->GetCellAtId(cells[j], numPts, pts, cellPoints);
+        neiPt[0] = OtherPoint(numPts, pts, ptId, -1);
+        neiPt[1] = OtherPoint(numPts, pts, ptId, neiPt[0]);
+
+        for (int i=0; i<2; i++) //for each of the two edges of the seed cell
+        {
+          cellId = cells[j];
+          nei = neiPt[i];
+          while ( cellId >= 0 ) //while we can grow this region
+          {
+            GetCellEdgeNeighbors(this->Links, cellId, ptId, nei, cellIds);
+            if ( cellIds->GetNumberOfIds() == 1 &&
+                 label((neiCellId=cellIds->GetId(0))) < 0 )
+            {
+              std::copy(this->PolyNormals + 3 * cellId,
+                        this->PolyNormals + 3 * cellId + 3, thisNormal);
+              std::copy(this->PolyNormals + 3 * neiCellId,
+                        this->PolyNormals + 3 * neiCellId + 3, neiNormal);
+              if ( vtkMath::Dot(thisNormal,neiNormal) > this->CosAngle )
+              {
+                //visit and arrange to visit next edge neighbor
+                label(neiCellId) = numRegions;
+                cellId = neiCellId;
+                this->Polys->GetCellAtId(cellId, numPts, pts, cellPoints);
+                nei = OtherPoint(numPts, pts, ptId, nei);
+              }
+              else
+              {
+                cellId = -1; //separated by edge angle
+              }
+            }
+            else
+            {
+              cellId = -1;//separated by previous visit, boundary, or non-manifold
+            }
+          }//while visit wave is propagating
+        }//for each of the two edges of the starting cell
+        numRegions++;
+      }//for all cells connected to point ptId
+
+      for (vtkIdType j=1; j < ncells; j++)
+      {
+        if ( cells[j] == cells[j-1] )
+        {
+          visited[j] = visited[j-1];
+        }
+      }
+      this->NumberOfSplits[ptId] = numRegions - 1;
+    }
+  }
+};
+
+// The new id of ptId in the k-th cell using it.
+inline vtkIdType GetNewPointId(vtkIdType ptId, vtkIdType k, vtkIdType numPts,
+                               const int *regions, const vtkIdType *links,
+                               const vtkIdType *cells,
+                               const vtkIdType *splitOffsets)
+{
+  const int region = regions[(cells - links) + k];
+  return (region > 0 ? numPts + splitOffsets[ptId] + region - 1 : ptId);
+}
+
+// Replace the points of the cells that are not in the first region around
+// the point with the split points.
+struct ReplaceSplitPoints
+{
+  template <typename CellStateT>
+  struct Impl
+  {
+    CellStateT& State;
+    vtkStaticCellLinks *Links;
+    const int *Regions;
+    const vtkIdType *SplitOffsets;
+    vtkIdType NumberOfPoints;
+
+    Impl(CellStateT& state, vtkStaticCellLinks *links, const int *regions,
+         const vtkIdType *splitOffsets, vtkIdType numPts) :
+      State(state), Links(links), Regions(regions),
+      SplitOffsets(splitOffsets), NumberOfPoints(numPts)
+    {
+    }
+
+    void operator()(vtkIdType cellId, vtkIdType endCellId)
+    {
+      typedef typename CellStateT::ValueType ValueType;
+      const vtkIdType *links = this->Links->GetCells(0);
+      for ( ; cellId < endCellId; ++cellId)
+      {
+        ValueType *cell = this->State.GetCellPoints(cellId);
+        const vtkIdType numPts = this->State.GetCellSize(cellId);
+        for (vtkIdType i = 0; i < numPts; ++i)
+        {
+          const vtkIdType ptId = static_cast<vtkIdType>(cell[i]);
+          const vtkIdType *cells = this->Links->GetCells(ptId);
+          const vtkIdType k = std::lower_bound(cells,
+            cells + this->Links->GetNcells(ptId), cellId) - cells;
+          cell[i] = static_cast<ValueType>(GetNewPointId(ptId, k,
+            this->NumberOfPoints, this->Regions, links, cells,
+            this->SplitOffsets));
+        }
+      }
+    }
+  };
+
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkStaticCellLinks *links,
+                  const int *regions, const vtkIdType *splitOffsets,
+                  vtkIdType numPts)
+  {
+    Impl<CellStateT> impl(state, links, regions, splitOffsets, numPts);
+    vtkSMPTools::For(0, state.GetNumberOfCells(), impl);
+  }
+};
+
+// Accumulate the normals of the polygons at their (possibly split) points.
+// The normals are summed in the order of the cells, as when they are
+// scattered from the polygons.
+struct AccumulatePointNormals
+{
+  vtkStaticCellLinks *Links;
+  const float *PolyNormals;
+  const int *Regions;
+  const vtkIdType *SplitOffsets;
+  vtkIdType NumberOfPoints;
+  float *Normals;
+
+  AccumulatePointNormals(vtkStaticCellLinks *links, const float *polyNormals,
+                         const int *regions, const vtkIdType *splitOffsets,
+                         vtkIdType numPts, float *normals) :
+    Links(links), PolyNormals(polyNormals), Regions(regions),
+    SplitOffsets(splitOffsets), NumberOfPoints(numPts), Normals(normals)
+  {
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    const vtkIdType *links = this->Links->GetCells(0);
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType ncells = this->Links->GetNcells(ptId);
+      const vtkIdType *cells = this->Links->GetCells(ptId);
+      for (vtkIdType k = 0; k < ncells; ++k)
+      {
+        const vtkIdType newId = this->Regions ?
+          GetNewPointId(ptId, k, this->NumberOfPoints, this->Regions, links,
+                        cells, this->SplitOffsets) : ptId;
+        const float *polyNormal = this->PolyNormals + 3 * cells[k];
+        float *normal = this->Normals + 3 * newId;
+        normal[0] += polyNormal[0];
+        normal[1] += polyNormal[1];
+        normal[2] += polyNormal[2];
+      }
+    }
+  }
+};
+
+struct NormalizePointNormals
+{
+  float *Normals;
+  double FlipDirection;
+
+  NormalizePointNormals(float *normals, double flipDirection) :
+    Normals(normals), FlipDirection(flipDirection)
+  {
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      float *normal = this->Normals + 3 * ptId;
+      const double length = sqrt(normal[0] * normal[0] +
+                                 normal[1] * normal[1] +
+                                 normal[2] * normal[2]) * this->FlipDirection;
+      if (length != 0.0)
+      {
+        normal[0] /= length;
+        normal[1] /= length;
+        normal[2] /= length;
+      }
+    }
+  }
+};
+
+} // anonymous namespace
+
 // Generate normals for polygon meshes
 int vtkPolyDataNormals::RequestData(
   vtkInformation *vtkNotUsed(request),
@@ -91,7 +446,7 @@ int vtkPolyDataNormals::RequestData(
   vtkDataSetAttributes* outCD = output->GetCellData();
   double n[3];
   vtkCellArray *newPolys;
-  vtkIdType ptId, oldId;
+  vtkIdType ptId;
 
   vtkDebugMacro(<<"Generating surface normals");
 
@@ -129,8 +484,6 @@ int vtkPolyDataNormals::RequestData(
   inPolys = input->GetPolys();
   inStrips = input->GetStrips();
 
-  this->OldMesh = vtkPolyData::New();
-  this->OldMesh->SetPoints(inPts);
   if ( numStrips > 0 ) //have to decompose strips into triangles
   {
     vtkDataSetAttributes* inCD = input->GetCellData();
@@ -167,37 +520,44 @@ int vtkPolyDataNormals::RequestData(
         outCD->CopyData(inCD, inCellIdx, outCellIdx++);
       }
     }
-    this->OldMesh->SetPolys(polys);
-    polys->Delete();
     numPolys = polys->GetNumberOfCells();//added some new triangles
   }
   else
   {
-    this->OldMesh->SetPolys(inPolys);
     polys = inPolys;
+    polys->Register(this);
   }
-  this->OldMesh->BuildLinks();
+  this->OldPolys = polys;
+
+  // The links are built over the polygons only, so that the cell ids are the
+  // polygon ids.
+  vtkNew<vtkPolyData> oldMesh;
+  oldMesh->SetPoints(inPts);
+  oldMesh->SetPolys(polys);
+  this->Links = vtkStaticCellLinks::New();
+  this->Links->BuildLinks(oldMesh);
+  SortLinks sortLinks(this->Links);
+  vtkSMPTools::For(0, numPts, sortLinks);
   this->UpdateProgress(0.10);
 
   pd = input->GetPointData();
   outPD = output->GetPointData();
 
-  this->NewMesh = vtkPolyData::New();
-  this->NewMesh->SetPoints(inPts);
   // create a copy because we're modifying it
   newPolys = vtkCellArray::New();
   newPolys->DeepCopy(polys);
-  this->NewMesh->SetPolys(newPolys);
-  this->NewMesh->BuildCells(); //builds connectivity
+  this->NewPolys = newPolys;
 
   // The visited array keeps track of which polygons have been visited.
   //
-  if ( this->Consistency || this->Splitting || this->AutoOrientNormals )
+  if ( this->Consistency || this->AutoOrientNormals )
   {
     this->Visited = new int[numPolys];
     memset(this->Visited, VTK_CELL_NOT_VISITED, numPolys*sizeof(int));
     this->CellIds = vtkIdList::New();
     this->CellIds->Allocate(VTK_CELL_SIZE);
+    this->CellPoints = vtkIdList::New();
+    this->NeighborPoints = vtkIdList::New();
   }
   else
   {
@@ -226,7 +586,7 @@ int vtkPolyDataNormals::RequestData(
     vtkIdType leftmostCellID=-1, currentPointID, currentCellID;
     vtkIdType *leftmostCells;
     vtkIdType nleftmostCells;
-    vtkIdType *cellPts;
+    const vtkIdType *cellPts;
     vtkIdType nCellPts;
     int cIdx;
     double bestNormalAbsXComponent;
@@ -258,7 +618,8 @@ int vtkPolyDataNormals::RequestData(
       // at that point
       do {
         currentPointID = leftmostPoints->Pop();
-        this->OldMesh->GetPointCells(currentPointID, nleftmostCells, leftmostCells);
+        nleftmostCells = this->Links->GetNcells(currentPointID);
+        leftmostCells = this->Links->GetCells(currentPointID);
         bestNormalAbsXComponent = 0.0;
         bestReverseFlag = 0;
         for (cIdx = 0; cIdx < nleftmostCells; cIdx++)
@@ -268,8 +629,10 @@ int vtkPolyDataNormals::RequestData(
           {
             continue;
           }
-          this->OldMesh->GetCellPoints(currentCellID, nCellPts, cellPts);
-          vtkPolygon::ComputeNormal(inPts, nCellPts, cellPts, n);
+          this->OldPolys->GetCellAtId(currentCellID, nCellPts, cellPts,
+                                      this->CellPoints);
+          vtkPolygon::ComputeNormal(inPts, nCellPts,
+                                    const_cast<vtkIdType*>(cellPts), n);
           // Ok, see if this leftmost cell candidate is the best
           // so far
           if (fabs(n[0]) > bestNormalAbsXComponent)
@@ -291,7 +654,7 @@ int vtkPolyDataNormals::RequestData(
         // normals, but if both are true, then we leave it as it is.
         if (bestReverseFlag ^ this->FlipNormals)
         {
-          this->NewMesh->ReverseCell(leftmostCellID);
+          this->NewPolys->ReverseCellAtId(leftmostCellID);
           this->NumFlips++;
         }
         this->Wave->InsertNextId(leftmostCellID);
@@ -321,7 +684,7 @@ int vtkPolyDataNormals::RequestData(
           if ( this->FlipNormals )
           {
             this->NumFlips++;
-            this->NewMesh->ReverseCell(cellId);
+            this->NewPolys->ReverseCellAtId(cellId);
           }
           this->Wave->InsertNextId(cellId);
           this->Visited[cellId] = VTK_CELL_VISITED;
@@ -338,6 +701,14 @@ int vtkPolyDataNormals::RequestData(
     }//Consistent ordering
   } // don't automatically orient normals
 
+  if ( this->Consistency || this->AutoOrientNormals )
+  {
+    delete [] this->Visited;
+    this->CellIds->Delete();
+    this->CellPoints->Delete();
+    this->NeighborPoints->Delete();
+  }
+
   this->UpdateProgress(0.333);
 
   //  Initial pass to compute polygon normals without effects of neighbors
@@ -358,50 +729,54 @@ int vtkPolyDataNormals::RequestData(
     this->PolyNormals->SetTuple(cellId, n);
   }
 
-  for (cellId=0, newPolys->InitTraversal(); newPolys->GetNextCell(npts,pts);
-       cellId++ )
-  {
-    if ((cellId % 1000) == 0)
-    {
-      this->UpdateProgress (0.333 + 0.333 * (double) cellId / (double) numPolys);
-      if (this->GetAbortExecute())
-      {
-        break;
-      }
-    }
-    vtkPolygon::ComputeNormal(inPts, npts, pts, n);
-    this->PolyNormals->SetTuple(offsetCells + cellId, n);
-  }
+  float *fPolyNormals = this->PolyNormals->WritePointer(3 * offsetCells, 3 * numPolys);
+  ComputePolyNormals computePolyNormals(inPts, newPolys, fPolyNormals);
+  vtkSMPTools::For(0, numPolys, computePolyNormals);
+  this->UpdateProgress(0.5);
 
   // Split mesh if sharp features
+  std::vector<int> regions;
+  std::vector<vtkIdType> splitOffsets;
   if ( this->Splitting )
   {
     //  Traverse all nodes; evaluate loops and feature edges.  If feature
     //  edges found, split mesh creating new nodes.  Update polygon
     // connectivity.
     //
-      this->CosAngle = cos( vtkMath::RadiansFromDegrees( this->FeatureAngle) );
-    //  Splitting will create new points.  We have to create index array
-    // to map new points into old points.
-    //
-    this->Map = vtkIdList::New();
-    this->Map->SetNumberOfIds(numPts);
-    for (vtkIdType i=0; i < numPts; i++)
-    {
-      this->Map->SetId(i,i);
-    }
-
-    for (ptId=0; ptId < numPts; ptId++)
-    {
-      this->MarkAndSplit(ptId);
-    }//for all input points
-
-    numNewPts = this->Map->GetNumberOfIds();
+    this->CosAngle = cos( vtkMath::RadiansFromDegrees( this->FeatureAngle) );
+    regions.resize(polys->GetNumberOfConnectivityIds());
+    splitOffsets.resize(numPts + 1);
+    MarkRegions markRegions(polys, this->Links, fPolyNormals, this->CosAngle,
+                            regions.data(), splitOffsets.data());
+    vtkSMPTools::For(0, numPts, markRegions);
+
+    // The points split around ptId are numbered consecutively, in the order
+    // of the input points.
+    splitOffsets[numPts] = 0;
+    vtkSMPTools::ExclusiveScan(splitOffsets.begin(), splitOffsets.end(),
+                               splitOffsets.begin(), static_cast<vtkIdType>(0));
+    numNewPts = numPts + splitOffsets[numPts];
+    newPolys->Visit(ReplaceSplitPoints{}, this->Links, regions.data(),
+                    splitOffsets.data(), numPts);
+    newPolys->Modified();
 
     vtkDebugMacro(<<"Created " << numNewPts-numPts << " new points");
 
     //  Now need to map attributes of old points into new points.
     //
+    vtkNew<vtkIdList> oldIds;
+    vtkNew<vtkIdList> newIds;
+    oldIds->SetNumberOfIds(numNewPts - numPts);
+    newIds->SetNumberOfIds(numNewPts - numPts);
+    for (ptId=0; ptId < numPts; ptId++)
+    {
+      for (vtkIdType i=splitOffsets[ptId]; i < splitOffsets[ptId+1]; i++)
+      {
+        oldIds->SetId(i, ptId);
+        newIds->SetId(i, numPts + i);
+      }
+    }
+
     outPD->CopyNormalsOff();
     outPD->CopyAllocate(pd,numNewPts);
 
@@ -430,13 +805,10 @@ int vtkPolyDataNormals::RequestData(
     }
 
     newPts->SetNumberOfPoints(numNewPts);
-    for (ptId=0; ptId < numNewPts; ptId++)
-    {
-      oldId = this->Map->GetId(ptId);
-      newPts->SetPoint(ptId,inPts->GetPoint(oldId));
-      outPD->CopyData(pd,oldId,ptId);
-    }
-    this->Map->Delete();
+    newPts->InsertPoints(0, numPts, 0, inPts);
+    newPts->InsertPoints(newIds, oldIds, inPts);
+    outPD->CopyData(pd, 0, numPts, 0);
+    outPD->CopyData(pd, oldIds, newIds);
   } //splitting
 
   else //no splitting, so no new points
@@ -446,12 +818,6 @@ int vtkPolyDataNormals::RequestData(
     outPD->PassData(pd);
   }
 
-  if ( this->Consistency || this->Splitting )
-  {
-    delete [] this->Visited;
-    this->CellIds->Delete();
-  }
-
   this->UpdateProgress(0.80);
 
   //  Finally, traverse all elements, computing polygon normals and
@@ -469,34 +835,15 @@ int vtkPolyDataNormals::RequestData(
   float *fNormals = newNormals->WritePointer(0, 3 * numNewPts);
   std::fill_n(fNormals, 3 * numNewPts, 0);
 
-  float *fPolyNormals = this->PolyNormals->WritePointer(3 * offsetCells, 3 * numPolys);
-
   if (this->ComputePointNormals)
   {
-    for (cellId=0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts);
-         ++cellId)
-    {
-      for (vtkIdType i = 0; i < npts; ++i)
-      {
-        fNormals[3 * pts[i]] += fPolyNormals[3 * cellId];
-        fNormals[3 * pts[i] + 1] += fPolyNormals[3 * cellId + 1];
-        fNormals[3 * pts[i] + 2] += fPolyNormals[3 * cellId + 2];
-      }
-    }
+    AccumulatePointNormals accumulate(this->Links, fPolyNormals,
+      this->Splitting ? regions.data() : nullptr, splitOffsets.data(), numPts,
+      fNormals);
+    vtkSMPTools::For(0, numPts, accumulate);
 
-    for (vtkIdType i = 0; i < numNewPts; ++i)
-    {
-      const double length = sqrt(fNormals[3 * i] * fNormals[3 * i] +
-                                 fNormals[3 * i + 1] * fNormals[3 * i + 1] +
-                                 fNormals[3 * i + 2] * fNormals[3 * i + 2]
-                                 ) * flipDirection;
-      if (length != 0.0)
-      {
-        fNormals[3 * i] /= length;
-        fNormals[3 * i + 1] /= length;
-        fNormals[3 * i + 2] /= length;
-      }
-    }
+    NormalizePointNormals normalize(fNormals, flipDirection);
+    vtkSMPTools::For(0, numNewPts, normalize);
   }
 
   //  Update ourselves.  If no new nodes have been created (i.e., no
@@ -534,8 +881,8 @@ int vtkPolyDataNormals::RequestData(
   output->SetVerts(input->GetVerts());
   output->SetLines(input->GetLines());
 
-  this->OldMesh->Delete();
-  this->NewMesh->Delete();
+  this->OldPolys->UnRegister(this);
+  this->Links->Delete();
 
   return 1;
 }
@@ -547,7 +894,8 @@ void vtkPolyDataNormals::TraverseAndOrder ()
   vtkIdType i, k;
   int j, l, j1;
   vtkIdType numIds, cellId;
-  vtkIdType *pts, *neiPts, npts, numNeiPts;
+  const vtkIdType *pts, *neiPts;
+  vtkIdType npts, numNeiPts;
   vtkIdType neighbor;
   vtkIdList *tmpWave;
 
@@ -558,11 +906,12 @@ void vtkPolyDataNormals::TraverseAndOrder ()
     {
       cellId = this->Wave->GetId(i);
 
-      this->NewMesh->GetCellPoints(cellId, npts, pts);
+      this->NewPolys->GetCellAtId(cellId, npts, pts, this->CellPoints);
 
       for (j = 0, j1 = 1; j < npts; ++j, (j1 = (++j1 < npts) ? j1 : 0)) //for each edge neighbor
       {
-        this->OldMesh->GetCellEdgeNeighbors(cellId, pts[j], pts[j1], this->CellIds);
+        GetCellEdgeNeighbors(this->Links, cellId, pts[j], pts[j1],
+                             this->CellIds);
 
         //  Check the direction of the neighbor ordering.  Should be
         //  consistent with us (i.e., if we are n1->n2,
@@ -575,7 +924,8 @@ void vtkPolyDataNormals::TraverseAndOrder ()
             if (this->Visited[this->CellIds->GetId(k)]==VTK_CELL_NOT_VISITED)
             {
               neighbor = this->CellIds->GetId(k);
-              this->NewMesh->GetCellPoints(neighbor,numNeiPts,neiPts);
+              this->NewPolys->GetCellAtId(neighbor, numNeiPts, neiPts,
+                                          this->NeighborPoints);
               for (l=0; l < numNeiPts; l++)
               {
                 if (neiPts[l] == pts[j1])
@@ -589,7 +939,7 @@ void vtkPolyDataNormals::TraverseAndOrder ()
               if ( neiPts[(l+1)%numNeiPts] != pts[j] )
               {
                 this->NumFlips++;
-                this->NewMesh->ReverseCell(neighbor);
+                this->NewPolys->ReverseCellAtId(neighbor);
               }
               this->Visited[neighbor] = VTK_CELL_VISITED;
               this->Wave2->InsertNextId(neighbor);
@@ -607,165 +957,6 @@ void vtkPolyDataNormals::TraverseAndOrder ()
   } //while wave still propagating
 }
 
-//
-//  Mark polygons around vertex.  Create new vertex (if necessary) and
-//  replace (i.e., split mesh).
-//
-void vtkPolyDataNormals::MarkAndSplit (vtkIdType ptId)
-{
-  int i,j;
-
-  // Get the cells using this point and make sure that we have to do something
-  vtkIdType ncells;
-  vtkIdType *cells;
-  this->OldMesh->GetPointCells(ptId,ncells,cells);
-  if ( ncells <= 1 )
-  {
-    return; //point does not need to be further disconnected
-  }
-
-  // Start moving around the "cycle" of points using the point. Label
-  // each point as requiring a visit. Then label each subregion of cells
-  // connected to this point that are connected (and not separated by
-  // a feature edge) with a given region number. For each N regions
-  // created, N-1 duplicate (split) points are created. The split point
-  // replaces the current point ptId in the polygons connectivity array.
-  //
-  // Start by initializing the cells as unvisited
-  for (i=0; i<ncells; i++)
-  {
-    this->Visited[cells[i]] = -1;
-  }
-
-  // Loop over all cells and mark the region that each is in.
-  //
-  vtkIdType numPts;
-  vtkIdType *pts;
-  int numRegions = 0;
-  vtkIdType spot, neiPt[2], nei, cellId, neiCellId;
-  double thisNormal[3], neiNormal[3];
-  for (j=0; j<ncells; j++) //for all cells connected to point
-  {
-    if ( this->Visited[cells[j]] < 0 ) //for all unvisited cells
-    {
-      this->Visited[cells[j]] = numRegions;
-      //okay, mark all the cells connected to this seed cell and using ptId
-      this->OldMesh->GetCellPoints(cells[j],numPts,pts);
-
-      //find the two edges
-      for (spot=0; spot < numPts; spot++)
-      {
-        if ( pts[spot] == ptId )
-        {
-          break;
-        }
-      }
-
-      if ( spot == 0 )
-      {
-        neiPt[0] = pts[spot+1];
-        neiPt[1] = pts[numPts-1];
-      }
-      else if ( spot == (numPts-1) )
-      {
-        neiPt[0] = pts[spot-1];
-        neiPt[1] = pts[0];
-      }
-      else
-      {
-        neiPt[0] = pts[spot+1];
-        neiPt[1] = pts[spot-1];
-      }
-
-      for (i=0; i<2; i++) //for each of the two edges of the seed cell
-      {
-        cellId = cells[j];
-        nei = neiPt[i];
-        while ( cellId >= 0 ) //while we can grow this region
-        {
-          this->OldMesh->GetCellEdgeNeighbors(cellId,ptId,nei,this->CellIds);
-          if ( this->CellIds->GetNumberOfIds() == 1 &&
-               this->Visited[(neiCellId=this->CellIds->GetId(0))] < 0 )
-          {
-            this->PolyNormals->GetTuple(cellId, thisNormal);
-            this->PolyNormals->GetTuple(neiCellId, neiNormal);
-
-            if ( vtkMath::Dot(thisNormal,neiNormal) > CosAngle )
-            {
-              //visit and arrange to visit next edge neighbor
-              this->Visited[neiCellId] = numRegions;
-              cellId = neiCellId;
-              this->OldMesh->GetCellPoints(cellId,numPts,pts);
-
-              for (spot=0; spot < numPts; spot++)
-              {
-                if ( pts[spot] == ptId )
-                {
-                  break;
-                }
-              }
-
-              if (spot == 0)
-              {
-                nei = (pts[spot+1] != nei ? pts[spot+1] : pts[numPts-1]);
-              }
-              else if (spot == (numPts-1))
-              {
-                nei = (pts[spot-1] != nei ? pts[spot-1] : pts[0]);
-              }
-              else
-              {
-                nei = (pts[spot+1] != nei ? pts[spot+1] : pts[spot-1]);
-              }
-
-            }//if not separated by edge angle
-            else
-            {
-              cellId = -1; //separated by edge angle
-            }
-          }//if can move to edge neighbor
-          else
-          {
-            cellId = -1;//separated by previous visit, boundary, or non-manifold
-          }
-        }//while visit wave is propagating
-      }//for each of the two edges of the starting cell
-      numRegions++;
-    }//if cell is unvisited
-  }//for all cells connected to point ptId
-
-  if ( numRegions <=1 )
-  {
-    return; //a single region, no splitting ever required
-  }
-
-  // Okay, for all cells not in the first region, the ptId is
-  // replaced with a new ptId, which is a duplicate of the first
-  // point, but disconnected topologically.
-  //
-  vtkIdType lastId = this->Map->GetNumberOfIds();
-  vtkIdType replacementPoint;
-  for (j=0; j<ncells; j++)
-  {
-    if (this->Visited[cells[j]] > 0 ) //replace point if splitting needed
-    {
-      replacementPoint = lastId + this->Visited[cells[j]] - 1;
-
-      this->Map->InsertId(replacementPoint, ptId);
-
-      this->NewMesh->GetCellPoints(cells[j],numPts,pts);
-      for (i=0; i < numPts; i++)
-      {
-        if ( pts[i] == ptId )
-        {
-          pts[i] = replacementPoint; // this is very nasty! direct write!
-          break;
-        }
-      }//replace ptId with split point
-    }//if not in first regions and requiring splitting
-  }//for all cells connected to ptId
-}
-
 void vtkPolyDataNormals::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os,indent);
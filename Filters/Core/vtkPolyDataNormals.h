@@ -39,6 +39,10 @@
  * are split and new points generated to prevent blurry edges (due to
  * Gouraud shading).
  *
+ * The polygon normals, the splitting of sharp edges and the accumulation of
+ * the point normals are threaded with vtkSMPTools over a vtkStaticCellLinks.
+ * The consistency and auto-orient traversals remain serial.
+ *
  * @warning
  * Normals are computed only for polygons and triangle strips. Normals are
  * not computed for lines or vertices.
@@ -60,9 +64,10 @@
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+class vtkCellArray;
 class vtkFloatArray;
 class vtkIdList;
-class vtkPolyData;
+class vtkStaticCellLinks;
 
 class VTKFILTERSCORE_EXPORT vtkPolyDataNormals : public vtkPolyDataAlgorithm
 {
@@ -195,9 +200,11 @@ private:
   vtkIdList *Wave;
   vtkIdList *Wave2;
   vtkIdList *CellIds;
-  vtkIdList *Map;
-  vtkPolyData *OldMesh;
-  vtkPolyData *NewMesh;
+  vtkIdList *CellPoints;
+  vtkIdList *NeighborPoints;
+  vtkCellArray *OldPolys;
+  vtkCellArray *NewPolys;
+  vtkStaticCellLinks *Links;
   int *Visited;
   vtkFloatArray *PolyNormals;
   double CosAngle;
@@ -206,11 +213,6 @@ private:
   // checked and properly ordered polygons.
   void TraverseAndOrder(void);
 
-  // Check the point id give to see whether it lies on a feature
-  // edge. If so, split the point (i.e., duplicate it) to topologically
-  // separate the mesh.
-  void MarkAndSplit(vtkIdType ptId);
-
 private:
   vtkPolyDataNormals(const vtkPolyDataNormals&) = delete;
   void operator=(const vtkPolyDataNormals&) = delete;
@@ -42,36 +42,638 @@
 #include "vtkQuadricDecimation.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
-#include "vtkEdgeTable.h"
-#include "vtkDoubleArray.h"
-#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkMath.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPointData.h"
-#include "vtkPriorityQueue.h"
-#include "vtkTriangle.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 vtkStandardNewMacro(vtkQuadricDecimation);
 
+//----------------------------------------------------------------------------
+// The working mesh, its edges and their costs are kept in flat arrays. They
+// are updated by the edge collapses exactly as vtkPolyData's cell links,
+// vtkEdgeTable and vtkPriorityQueue were, so that the edges are collapsed in
+// the same order (the order of the cells using a point, and of equal costs,
+// decides between otherwise equivalent collapses).
+class vtkQuadricDecimation::Internals
+{
+public:
+  // The triangles of the working mesh (3 point ids each), and whether they
+  // have been deleted.
+  std::vector<vtkIdType> Triangles;
+  std::vector<char> Deleted;
+
+  // The triangles using each point, in the order of vtkCellLinks, are
+  // Links[LinkLocations[ptId]] ... Links[LinkLocations[ptId]+LinkCounts[ptId]-1],
+  // with room for LinkSizes[ptId] triangles. A list that must grow is moved
+  // to the end of Links, which is compacted when half of it is unused.
+  std::vector<vtkIdType> Links;
+  std::vector<vtkIdType> LinkLocations;
+  std::vector<vtkIdType> LinkCounts;
+  std::vector<vtkIdType> LinkSizes;
+  vtkIdType UnusedLinks;
+
+  // The end points of the edges (edges are never removed). The edges of the
+  // input are found from their smaller end point in EdgeOffsets/EdgeIds, the
+  // edges created by the collapses are chained from FirstAddedEdges.
+  std::vector<vtkIdType> EndPoints;
+  std::vector<vtkIdType> EdgeOffsets;
+  std::vector<vtkIdType> EdgeIds;
+  std::vector<vtkIdType> FirstAddedEdges;
+  std::vector<vtkIdType> NextAddedEdges;
+
+  // The edge costs, in a binary heap indexed by edge id which inserts,
+  // removes and breaks ties as vtkPriorityQueue.
+  struct Item
+  {
+    double Priority;
+    vtkIdType Id;
+  };
+  std::vector<Item> Queue;
+  vtkIdType QueueMaxId;
+  std::vector<vtkIdType> QueueLocations;
+
+  // The target point (and attributes) of the collapse of each edge.
+  std::vector<double> TargetPoints;
+  int TargetSize;
+
+  // The error quadric (QuadricSize values) and the volume constraint (4
+  // values) of each point.
+  std::vector<double> Quadrics;
+  int QuadricSize;
+  std::vector<double> VolumeConstraints;
+
+  // The points which must not move, if any.
+  std::vector<char> LockedPoints;
+
+  vtkNew<vtkIdList> ChangedEdges;
+  vtkNew<vtkIdList> CollapseCellIds;
+
+  Internals() : UnusedLinks(0), QueueMaxId(-1), TargetSize(0), QuadricSize(0) {}
+
+  void Initialize()
+  {
+    std::vector<vtkIdType>().swap(this->Links);
+    std::vector<vtkIdType>().swap(this->LinkLocations);
+    std::vector<vtkIdType>().swap(this->LinkCounts);
+    std::vector<vtkIdType>().swap(this->LinkSizes);
+    std::vector<vtkIdType>().swap(this->EndPoints);
+    std::vector<vtkIdType>().swap(this->EdgeOffsets);
+    std::vector<vtkIdType>().swap(this->EdgeIds);
+    std::vector<vtkIdType>().swap(this->FirstAddedEdges);
+    std::vector<vtkIdType>().swap(this->NextAddedEdges);
+    std::vector<Item>().swap(this->Queue);
+    std::vector<vtkIdType>().swap(this->QueueLocations);
+    std::vector<double>().swap(this->TargetPoints);
+    std::vector<double>().swap(this->Quadrics);
+    std::vector<double>().swap(this->VolumeConstraints);
+    this->UnusedLinks = 0;
+    this->QueueMaxId = -1;
+  }
+
+  const vtkIdType *GetCellPoints(vtkIdType cellId) const
+  {
+    return this->Triangles.data() + 3 * cellId;
+  }
+
+  //--------------------------------------------------------------------------
+  // Cell links (see vtkCellLinks)
+  void BuildLinks(vtkIdType numPts)
+  {
+    vtkIdType numTris = static_cast<vtkIdType>(this->Deleted.size());
+    vtkIdType ptId, cellId, location = 0;
+    int i;
+
+    this->LinkCounts.assign(numPts, 0);
+    this->LinkLocations.resize(numPts);
+    this->LinkSizes.resize(numPts);
+    for (i = 0; i < 3 * numTris; i++)
+    {
+      this->LinkCounts[this->Triangles[i]]++;
+    }
+    for (ptId = 0; ptId < numPts; ptId++)
+    {
+      this->LinkLocations[ptId] = location;
+      this->LinkSizes[ptId] = this->LinkCounts[ptId];
+      location += this->LinkCounts[ptId];
+      this->LinkCounts[ptId] = 0;
+    }
+    this->Links.resize(location);
+    for (cellId = 0; cellId < numTris; cellId++)
+    {
+      const vtkIdType *pts = this->GetCellPoints(cellId);
+      for (i = 0; i < 3; i++)
+      {
+        this->AddCellReference(cellId, pts[i]);
+      }
+    }
+    this->UnusedLinks = 0;
+  }
+
+  const vtkIdType *GetPointCells(vtkIdType ptId, vtkIdType &ncells) const
+  {
+    ncells = this->LinkCounts[ptId];
+    return this->Links.data() + this->LinkLocations[ptId];
+  }
+
+  void GetPointCells(vtkIdType ptId, vtkIdList *cellIds) const
+  {
+    vtkIdType ncells;
+    const vtkIdType *cells = this->GetPointCells(ptId, ncells);
+    cellIds->SetNumberOfIds(ncells);
+    std::copy(cells, cells + ncells, cellIds->GetPointer(0));
+  }
+
+  void AddCellReference(vtkIdType cellId, vtkIdType ptId)
+  {
+    this->Links[this->LinkLocations[ptId] + this->LinkCounts[ptId]++] = cellId;
+  }
+
+  // Remove the cell from the lists of its points (see vtkPolyData).
+  void RemoveCellReference(vtkIdType cellId)
+  {
+    const vtkIdType *pts = this->GetCellPoints(cellId);
+    for (int i = 0; i < 3; i++)
+    {
+      vtkIdType *cells = this->Links.data() + this->LinkLocations[pts[i]];
+      vtkIdType *cellsEnd = cells + this->LinkCounts[pts[i]];
+      vtkIdType *cell = std::find(cells, cellsEnd, cellId);
+      if (cell != cellsEnd)
+      {
+        std::copy(cell + 1, cellsEnd, cell);
+        this->LinkCounts[pts[i]]--;
+      }
+    }
+  }
+
+  // Make room for size more cells using the point.
+  void ResizeCellList(vtkIdType ptId, vtkIdType size)
+  {
+    vtkIdType ncells = this->LinkCounts[ptId];
+    if (ncells + size <= this->LinkSizes[ptId])
+    {
+      return;
+    }
+    vtkIdType newSize = 2 * (ncells + size);
+    vtkIdType location = static_cast<vtkIdType>(this->Links.size());
+    this->Links.resize(location + newSize);
+    std::copy(this->Links.begin() + this->LinkLocations[ptId],
+              this->Links.begin() + this->LinkLocations[ptId] + ncells,
+              this->Links.begin() + location);
+    this->UnusedLinks += this->LinkSizes[ptId];
+    this->LinkLocations[ptId] = location;
+    this->LinkSizes[ptId] = newSize;
+    if (2 * this->UnusedLinks > static_cast<vtkIdType>(this->Links.size()))
+    {
+      this->CompactLinks();
+    }
+  }
+
+  void DeletePoint(vtkIdType ptId)
+  {
+    this->UnusedLinks += this->LinkSizes[ptId];
+    this->LinkCounts[ptId] = 0;
+    this->LinkSizes[ptId] = 0;
+  }
+
+  void CompactLinks()
+  {
+    std::vector<vtkIdType> links;
+    links.reserve(this->Links.size() - this->UnusedLinks);
+    vtkIdType numPts = static_cast<vtkIdType>(this->LinkLocations.size());
+    for (vtkIdType ptId = 0; ptId < numPts; ptId++)
+    {
+      vtkIdType location = static_cast<vtkIdType>(links.size());
+      links.insert(links.end(),
+                   this->Links.begin() + this->LinkLocations[ptId],
+                   this->Links.begin() + this->LinkLocations[ptId] +
+                     this->LinkCounts[ptId]);
+      links.resize(location + this->LinkSizes[ptId]);
+      this->LinkLocations[ptId] = location;
+    }
+    this->Links.swap(links);
+    this->UnusedLinks = 0;
+  }
+
+  // Whether a triangle uses the 3 points (see vtkPolyData::IsTriangle()).
+  bool IsTriangle(vtkIdType v1, vtkIdType v2, vtkIdType v3) const
+  {
+    const vtkIdType tVerts[3] = { v1, v2, v3 };
+    for (int i = 0; i < 3; i++)
+    {
+      vtkIdType ncells;
+      const vtkIdType *cells = this->GetPointCells(tVerts[i], ncells);
+      for (vtkIdType j = 0; j < ncells; j++)
+      {
+        const vtkIdType *tVerts2 = this->GetCellPoints(cells[j]);
+        if ( (tVerts[0] == tVerts2[0] || tVerts[0] == tVerts2[1] ||
+              tVerts[0] == tVerts2[2]) &&
+             (tVerts[1] == tVerts2[0] || tVerts[1] == tVerts2[1] ||
+              tVerts[1] == tVerts2[2]) &&
+             (tVerts[2] == tVerts2[0] || tVerts[2] == tVerts2[1] ||
+              tVerts[2] == tVerts2[2]) )
+        {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  // Whether the edge (p1,p2) of the cell is used by no other cell.
+  bool IsBoundaryEdge(vtkIdType cellId, vtkIdType p1, vtkIdType p2) const
+  {
+    vtkIdType ncells;
+    const vtkIdType *cells = this->GetPointCells(p1, ncells);
+    for (vtkIdType i = 0; i < ncells; i++)
+    {
+      const vtkIdType *pts = this->GetCellPoints(cells[i]);
+      if (cells[i] != cellId &&
+          (pts[0] == p2 || pts[1] == p2 || pts[2] == p2))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //--------------------------------------------------------------------------
+  // Edges (see vtkEdgeTable)
+  static bool HasEdge(const vtkIdType *pts, int numEdges, vtkIdType p1,
+                      vtkIdType p2)
+  {
+    for (int i = 0; i < numEdges; i++)
+    {
+      vtkIdType q1 = pts[i];
+      vtkIdType q2 = pts[(i+1)%3];
+      if ((q1 == p1 && q2 == p2) || (q1 == p2 && q2 == p1))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Number the edges of the triangles in the order they are first used, as
+  // when inserting them in a vtkEdgeTable cell after cell.
+  void BuildEdges(vtkIdType numPts)
+  {
+    vtkIdType numTris = static_cast<vtkIdType>(this->Deleted.size());
+    std::vector<vtkIdType> firstEdges(numTris + 1);
+    std::vector<unsigned char> newEdges(numTris);
+
+    vtkSMPTools::For(0, numTris, [&](vtkIdType cellId, vtkIdType endCellId) {
+      for ( ; cellId < endCellId; cellId++)
+      {
+        const vtkIdType *pts = this->GetCellPoints(cellId);
+        unsigned char mask = 0;
+        vtkIdType count = 0;
+        for (int j = 0; j < 3; j++)
+        {
+          vtkIdType p1 = pts[j];
+          vtkIdType p2 = pts[(j+1)%3];
+          bool isNew = !HasEdge(pts, j, p1, p2);
+          vtkIdType ncells;
+          const vtkIdType *cells = this->GetPointCells(p1, ncells);
+          for (vtkIdType i = 0; isNew && i < ncells && cells[i] < cellId; i++)
+          {
+            isNew = !HasEdge(this->GetCellPoints(cells[i]), 3, p1, p2);
+          }
+          if (isNew)
+          {
+            mask |= 1 << j;
+            count++;
+          }
+        }
+        newEdges[cellId] = mask;
+        firstEdges[cellId] = count;
+      }
+    });
+    vtkIdType numEdges = 0;
+    for (vtkIdType cellId = 0; cellId < numTris; cellId++)
+    {
+      vtkIdType count = firstEdges[cellId];
+      firstEdges[cellId] = numEdges;
+      numEdges += count;
+    }
+    firstEdges[numTris] = numEdges;
+
+    this->EndPoints.resize(2 * numEdges);
+    vtkSMPTools::For(0, numTris, [&](vtkIdType cellId, vtkIdType endCellId) {
+      for ( ; cellId < endCellId; cellId++)
+      {
+        const vtkIdType *pts = this->GetCellPoints(cellId);
+        vtkIdType edgeId = firstEdges[cellId];
+        for (int j = 0; j < 3; j++)
+        {
+          if (newEdges[cellId] & (1 << j))
+          {
+            this->EndPoints[2*edgeId] = pts[j];
+            this->EndPoints[2*edgeId+1] = pts[(j+1)%3];
+            edgeId++;
+          }
+        }
+      }
+    });
+
+    // Each point lists the edges of which it is the smaller end point, which
+    // are edges of the cells using it.
+    auto gatherEdges = [&](vtkIdType ptId, vtkIdType endPtId, bool fill) {
+      for ( ; ptId < endPtId; ptId++)
+      {
+        vtkIdType ncells, count = 0;
+        const vtkIdType *cells = this->GetPointCells(ptId, ncells);
+        for (vtkIdType i = 0; i < ncells; i++)
+        {
+          vtkIdType cellId = cells[i];
+          if (i > 0 && cellId == cells[i-1])
+          {
+            continue;
+          }
+          const vtkIdType *pts = this->GetCellPoints(cellId);
+          vtkIdType edgeId = firstEdges[cellId];
+          for (int j = 0; j < 3; j++)
+          {
+            if (newEdges[cellId] & (1 << j))
+            {
+              if (std::min(pts[j], pts[(j+1)%3]) == ptId)
+              {
+                if (fill)
+                {
+                  this->EdgeIds[this->EdgeOffsets[ptId] + count] = edgeId;
+                }
+                count++;
+              }
+              edgeId++;
+            }
+          }
+        }
+        if (!fill)
+        {
+          this->EdgeOffsets[ptId] = count;
+        }
+      }
+    };
+    this->EdgeOffsets.resize(numPts + 1);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      gatherEdges(ptId, endPtId, false);
+    });
+    vtkIdType offset = 0;
+    for (vtkIdType ptId = 0; ptId < numPts; ptId++)
+    {
+      vtkIdType count = this->EdgeOffsets[ptId];
+      this->EdgeOffsets[ptId] = offset;
+      offset += count;
+    }
+    this->EdgeOffsets[numPts] = offset;
+    this->EdgeIds.resize(offset);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      gatherEdges(ptId, endPtId, true);
+    });
+
+    this->FirstAddedEdges.assign(numPts, -1);
+    this->NextAddedEdges.assign(numEdges, -1);
+    this->QueueLocations.assign(numEdges, -1);
+    this->Queue.resize(numEdges > 0 ? numEdges : 1);
+    this->QueueMaxId = -1;
+  }
+
+  vtkIdType GetNumberOfEdges() const
+  {
+    return static_cast<vtkIdType>(this->EndPoints.size() / 2);
+  }
+
+  vtkIdType IsEdge(vtkIdType p1, vtkIdType p2) const
+  {
+    vtkIdType index = (p1 < p2 ? p1 : p2);
+    vtkIdType search = (p1 < p2 ? p2 : p1);
+    for (vtkIdType i = this->EdgeOffsets[index];
+         i < this->EdgeOffsets[index+1]; i++)
+    {
+      vtkIdType edgeId = this->EdgeIds[i];
+      if (std::max(this->EndPoints[2*edgeId],
+                   this->EndPoints[2*edgeId+1]) == search)
+      {
+        return edgeId;
+      }
+    }
+    for (vtkIdType edgeId = this->FirstAddedEdges[index]; edgeId >= 0;
+         edgeId = this->NextAddedEdges[edgeId])
+    {
+      if (std::max(this->EndPoints[2*edgeId],
+                   this->EndPoints[2*edgeId+1]) == search)
+      {
+        return edgeId;
+      }
+    }
+    return -1;
+  }
+
+  vtkIdType InsertEdge(vtkIdType p1, vtkIdType p2)
+  {
+    vtkIdType edgeId = this->GetNumberOfEdges();
+    vtkIdType index = (p1 < p2 ? p1 : p2);
+    this->EndPoints.push_back(p1);
+    this->EndPoints.push_back(p2);
+    this->NextAddedEdges.push_back(this->FirstAddedEdges[index]);
+    this->FirstAddedEdges[index] = edgeId;
+    this->QueueLocations.push_back(-1);
+    this->TargetPoints.resize((edgeId + 1) * this->TargetSize);
+    return edgeId;
+  }
+
+  // Whether the edge may not be collapsed.
+  bool IsLocked(vtkIdType edgeId) const
+  {
+    return !this->LockedPoints.empty() &&
+      (this->LockedPoints[this->EndPoints[2*edgeId]] ||
+       this->LockedPoints[this->EndPoints[2*edgeId+1]]);
+  }
+
+  //--------------------------------------------------------------------------
+  // Edge costs (see vtkPriorityQueue)
+  void Swap(vtkIdType i, vtkIdType j)
+  {
+    std::swap(this->Queue[i], this->Queue[j]);
+    this->QueueLocations[this->Queue[i].Id] = i;
+    this->QueueLocations[this->Queue[j].Id] = j;
+  }
+
+  void Insert(double priority, vtkIdType id)
+  {
+    if (this->QueueLocations[id] != -1)
+    {
+      return;
+    }
+    if (++this->QueueMaxId >= static_cast<vtkIdType>(this->Queue.size()))
+    {
+      this->Queue.resize(2 * this->Queue.size());
+    }
+    this->Queue[this->QueueMaxId].Priority = priority;
+    this->Queue[this->QueueMaxId].Id = id;
+    this->QueueLocations[id] = this->QueueMaxId;
+
+    vtkIdType i, idx;
+    for (i = this->QueueMaxId;
+         i > 0 && this->Queue[i].Priority < this->Queue[(idx=(i-1)/2)].Priority;
+         i = idx)
+    {
+      this->Swap(i, idx);
+    }
+  }
+
+  vtkIdType Pop(vtkIdType location, double &priority)
+  {
+    if (this->QueueMaxId < 0)
+    {
+      return -1;
+    }
+
+    vtkIdType id = this->Queue[location].Id;
+    priority = this->Queue[location].Priority;
+
+    // move the last item to the location specified and push into the tree
+    this->Queue[location] = this->Queue[this->QueueMaxId];
+    this->QueueLocations[this->Queue[location].Id] = location;
+    this->QueueLocations[id] = -1;
+
+    if (--this->QueueMaxId <= 0)
+    {
+      return id;
+    }
+
+    // percolate down the tree from the specified location
+    vtkIdType lastNodeToCheck = (this->QueueMaxId - 1) / 2;
+    for (vtkIdType j = 0, i = location; i <= lastNodeToCheck; i = j)
+    {
+      vtkIdType idx = 2 * i + 1;
+      if (idx == this->QueueMaxId ||
+          this->Queue[idx].Priority < this->Queue[idx+1].Priority)
+      {
+        j = idx;
+      }
+      else
+      {
+        j = idx + 1;
+      }
+      if (this->Queue[i].Priority > this->Queue[j].Priority)
+      {
+        this->Swap(i, j);
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    // percolate up the tree from the specified location
+    for (vtkIdType i = location, idx; i > 0; i = idx)
+    {
+      idx = (i - 1) / 2;
+      if (this->Queue[i].Priority < this->Queue[idx].Priority)
+      {
+        this->Swap(i, idx);
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    return id;
+  }
+
+  void DeleteId(vtkIdType id)
+  {
+    double priority;
+    if (this->QueueLocations[id] != -1)
+    {
+      this->Pop(this->QueueLocations[id], priority);
+    }
+  }
+};
+
+namespace
+{
+
+// Split the triangles [begin,end) into numParts compact groups of nearly
+// equal size (the partitions firstPart, firstPart+1...), cutting them
+// recursively at the median of their centers along the longest side of the
+// bounding box of the centers.
+void BisectTriangles(vtkIdType *begin, vtkIdType *end, int firstPart,
+                     int numParts, const float *centers, int *parts)
+{
+  if (numParts == 1)
+  {
+    for ( ; begin != end; ++begin)
+    {
+      parts[*begin] = firstPart;
+    }
+    return;
+  }
+
+  float bounds[6] = { VTK_FLOAT_MAX, -VTK_FLOAT_MAX, VTK_FLOAT_MAX,
+                      -VTK_FLOAT_MAX, VTK_FLOAT_MAX, -VTK_FLOAT_MAX };
+  for (vtkIdType *cell = begin; cell != end; ++cell)
+  {
+    const float *center = centers + 3 * (*cell);
+    for (int i = 0; i < 3; i++)
+    {
+      bounds[2*i] = std::min(bounds[2*i], center[i]);
+      bounds[2*i+1] = std::max(bounds[2*i+1], center[i]);
+    }
+  }
+  int axis = 0;
+  for (int i = 1; i < 3; i++)
+  {
+    if (bounds[2*i+1] - bounds[2*i] > bounds[2*axis+1] - bounds[2*axis])
+    {
+      axis = i;
+    }
+  }
+
+  int numLeftParts = numParts / 2;
+  vtkIdType *middle = begin + (end - begin) * numLeftParts / numParts;
+  std::nth_element(begin, middle, end, [&](vtkIdType a, vtkIdType b) {
+    float ca = centers[3*a+axis];
+    float cb = centers[3*b+axis];
+    return ca < cb || (ca == cb && a < b);
+  });
+  BisectTriangles(begin, middle, firstPart, numLeftParts, centers, parts);
+  BisectTriangles(middle, end, firstPart + numLeftParts,
+                  numParts - numLeftParts, centers, parts);
+}
+
+}
+
 
 //----------------------------------------------------------------------------
 vtkQuadricDecimation::vtkQuadricDecimation()
 {
-  this->Edges = vtkEdgeTable::New();
-  this->EdgeCosts = vtkPriorityQueue::New();
-  this->EndPoint1List = vtkIdList::New();
-  this->EndPoint2List = vtkIdList::New();
-  this->ErrorQuadrics = nullptr;
-  this->VolumeConstraints = nullptr;
-  this->TargetPoints = vtkDoubleArray::New();
+  this->Implementation = new Internals();
+  this->Mesh = nullptr;
 
   this->TargetReduction = 0.9;
+  this->NumberOfPartitions = 1;
   this->NumberOfEdgeCollapses = 0;
   this->NumberOfComponents = 0;
+  for (int i = 0; i < 6; i++)
+  {
+    this->AttributeComponents[i] = 0;
+    this->AttributeScale[i] = 1.0;
+  }
 
   this->AttributeErrorMetric = 0;
   this->VolumePreservation = 0;
@@ -93,11 +695,7 @@ vtkQuadricDecimation::vtkQuadricDecimation()
 //----------------------------------------------------------------------------
 vtkQuadricDecimation::~vtkQuadricDecimation()
 {
-  this->Edges->Delete();
-  this->EdgeCosts->Delete();
-  this->EndPoint1List->Delete();
-  this->EndPoint2List->Delete();
-  this->TargetPoints->Delete();
+  delete this->Implementation;
 }
 
 void vtkQuadricDecimation::SetPointAttributeArray(vtkIdType ptId,
@@ -187,19 +785,12 @@ int vtkQuadricDecimation::RequestData(
   vtkPolyData *output = vtkPolyData::SafeDownCast(
     outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
-  vtkIdType numPts = input->GetNumberOfPoints();
   vtkIdType numTris = input->GetNumberOfPolys();
-  vtkIdType edgeId, i;
-  int j;
-  double cost;
-  double *x;
+  vtkIdType i;
   vtkCellArray *polys;
   vtkDataArray *attrib;
   vtkPoints *points;
-  vtkPointData *pointData;
-  vtkIdType endPtIds[2];
   vtkIdList *outputCellList;
-  vtkIdType npts, *pts;
   vtkIdType numDeletedTris=0;
 
   // check some assumptions about the data
@@ -216,9 +807,7 @@ int vtkQuadricDecimation::RequestData(
     return 1;
   }
 
-  polys = vtkCellArray::New();
   points = vtkPoints::New();
-  pointData = vtkPointData::New();
   outputCellList = vtkIdList::New();
 
   // copy the input (only polys) to our working mesh
@@ -226,73 +815,121 @@ int vtkQuadricDecimation::RequestData(
   points->DeepCopy(input->GetPoints());
   this->Mesh->SetPoints(points);
   points->Delete();
-  polys->DeepCopy(input->GetPolys());
-  this->Mesh->SetPolys(polys);
-  polys->Delete();
   if (this->AttributeErrorMetric)
   {
     this->Mesh->GetPointData()->DeepCopy(input->GetPointData());
   }
-  pointData->Delete();
   this->Mesh->GetFieldData()->PassData(input->GetFieldData());
-  this->Mesh->BuildCells();
-  this->Mesh->BuildLinks();
 
-  this->ErrorQuadrics =
-    new vtkQuadricDecimation::ErrorQuadric[numPts];
-  if (this->VolumePreservation)
+  Internals *impl = this->Implementation;
+  impl->Triangles.resize(3 * numTris);
+  impl->Deleted.assign(numTris, 0);
+  polys = input->GetPolys();
+  vtkSMPThreadLocalObject<vtkIdList> cellPoints;
+  vtkSMPTools::For(0, numTris, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkIdList *ptIds = cellPoints.Local();
+    vtkIdType npts;
+    const vtkIdType *pts;
+    for ( ; cellId < endCellId; cellId++)
+    {
+      polys->GetCellAtId(cellId, npts, pts, ptIds);
+      for (int j = 0; j < 3; j++)
+      {
+        impl->Triangles[3*cellId+j] = pts[j < npts ? j : npts - 1];
+      }
+    }
+  });
+
+  this->NumberOfComponents = 0;
+  if (this->AttributeErrorMetric)
   {
-    this->VolumeConstraints =
-      new double[numPts * 4];
+    this->ComputeNumberOfComponents();
+  }
 
-    for (i = 0; i < numPts * 4; i++)
+  if (this->NumberOfPartitions > 1 && numTris > 1)
+  {
+    numDeletedTris = this->DecimatePartitions(numTris);
+  }
+  else
+  {
+    numDeletedTris = this->DecimateMesh(numTris);
+  }
+  this->ActualReduction = (numTris > 0 ?
+    static_cast<double>(numDeletedTris) / numTris : 0.0);
+
+  // copy the simplified mesh from the working mesh to the output mesh
+  polys = vtkCellArray::New();
+  polys->Allocate(3 * (numTris - numDeletedTris));
+  for (i = 0; i < numTris; i++)
+  {
+    if (!impl->Deleted[i])
     {
-      this->VolumeConstraints[i] = 0.0;
+      outputCellList->InsertNextId(polys->InsertNextCell(3,
+        impl->GetCellPoints(i)));
     }
   }
+  this->Mesh->SetPolys(polys);
+  polys->Delete();
+  this->Mesh->BuildCells();
+  impl->Initialize();
+  std::vector<vtkIdType>().swap(impl->Triangles);
+  std::vector<char>().swap(impl->Deleted);
 
-  vtkDebugMacro(<<"Computing Edges");
-  this->Edges->InitEdgeInsertion(numPts, 1); // storing edge id as attribute
-  this->EdgeCosts->Allocate(this->Mesh->GetPolys()->GetNumberOfCells() * 3);
-  for (i = 0; i <  this->Mesh->GetNumberOfCells(); i++)
-  {
-    this->Mesh->GetCellPoints(i, npts, pts);
+  output->Reset();
+  output->Allocate(this->Mesh, outputCellList->GetNumberOfIds());
+  output->GetPointData()->CopyAllocate(this->Mesh->GetPointData(),1);
+  output->CopyCells(this->Mesh, outputCellList);
 
-    for (j = 0; j < 3; j++)
+  this->Mesh->Delete();
+  this->Mesh = nullptr;
+  outputCellList->Delete();
+
+  // renormalize, clamp attributes
+  if (this->AttributeErrorMetric)
+  {
+    if (nullptr != (attrib = output->GetPointData()->GetNormals()))
     {
-      if (this->Edges->IsEdge(pts[j], pts[(j+1)%3]) == -1)
+      for (i = 0; i < attrib->GetNumberOfTuples(); i++)
       {
-        // If this edge has not been processed, get an id for it, add it to
-        // the edge list (Edges), and add its endpoints to the EndPoint1List
-        // and EndPoint2List (the 2 endpoints to different lists).
-        edgeId = this->Edges->GetNumberOfEdges();
-        this->Edges->InsertEdge(pts[j], pts[(j+1)%3], edgeId);
-        this->EndPoint1List->InsertId(edgeId, pts[j]);
-        this->EndPoint2List->InsertId(edgeId, pts[(j+1)%3]);
+        vtkMath::Normalize(attrib->GetTuple3(i));
       }
     }
+    // might want to add clamping texture coordinates??
   }
 
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkQuadricDecimation::DecimateMesh(vtkIdType numTris)
+{
+  Internals *impl = this->Implementation;
+  vtkIdType numPts = this->Mesh->GetNumberOfPoints();
+  vtkIdType edgeId, i;
+  double cost;
+  double *x;
+  vtkIdType endPtIds[2];
+  vtkIdType numDeletedTris=0;
+  const int size = 3 + this->NumberOfComponents + this->VolumePreservation;
+
+  vtkDebugMacro(<<"Computing Edges");
+  impl->BuildLinks(numPts);
+  impl->BuildEdges(numPts);
+
   this->UpdateProgress(0.1);
 
-  this->NumberOfComponents = 0;
-  if (this->AttributeErrorMetric)
-  {
-    this->ComputeNumberOfComponents();
-  }
-  x = new double [3+this->NumberOfComponents+this->VolumePreservation];
-  this->CollapseCellIds = vtkIdList::New();
-  this->TempX = new double [3+this->NumberOfComponents+this->VolumePreservation];
+  x = new double [size];
   this->TempQuad = new double[11 + 4 * this->NumberOfComponents+this->VolumePreservation];
 
-  this->TempB = new double [3 +  this->NumberOfComponents+this->VolumePreservation];
-  this->TempA = new double*[3 +  this->NumberOfComponents+this->VolumePreservation];
-  this->TempData = new double [(3 +  this->NumberOfComponents+this->VolumePreservation)*(3 +  this->NumberOfComponents+VolumePreservation)];
-  for (i = 0; i < 3 +  this->NumberOfComponents+this->VolumePreservation; i++)
+  this->TempB = new double [size];
+  this->TempA = new double*[size];
+  this->TempData = new double [size*size];
+  for (i = 0; i < size; i++)
   {
-    this->TempA[i] = this->TempData+i*(3 +  this->NumberOfComponents+this->VolumePreservation);
+    this->TempA[i] = this->TempData+i*size;
   }
-  this->TargetPoints->SetNumberOfComponents(3+this->NumberOfComponents+this->VolumePreservation);
+  impl->TargetSize = size;
+  impl->TargetPoints.resize(impl->GetNumberOfEdges() * size);
 
   vtkDebugMacro(<<"Computing Quadrics");
   this->InitializeQuadrics(numPts);
@@ -300,26 +937,51 @@ int vtkQuadricDecimation::RequestData(
   this->UpdateProgress(0.15);
 
   vtkDebugMacro(<<"Computing Costs");
-  // Compute the cost of and target point for collapsing each edge.
-  for (i = 0; i < this->Edges->GetNumberOfEdges(); i++)
-  {
-    if (this->AttributeErrorMetric)
+  // Compute the cost of and target point for collapsing each edge, then
+  // queue the edges in order.
+  std::vector<double> costs(impl->GetNumberOfEdges());
+  vtkSMPTools::For(0, impl->GetNumberOfEdges(),
+                   [&](vtkIdType id, vtkIdType endId) {
+    std::vector<double> quad(11 + 4 * this->NumberOfComponents);
+    std::vector<double> b(size);
+    std::vector<double> data(size * size);
+    std::vector<double*> A(size);
+    for (int k = 0; k < size; k++)
     {
-      cost = this->ComputeCost2(i, x);
+      A[k] = data.data() + k * size;
     }
-    else
+    for ( ; id < endId; id++)
+    {
+      double *target = impl->TargetPoints.data() + id * size;
+      if (impl->IsLocked(id))
+      {
+        continue;
+      }
+      else if (this->AttributeErrorMetric)
+      {
+        costs[id] = this->ComputeCost2(id, target, quad.data(), A.data(),
+                                       b.data());
+      }
+      else
+      {
+        costs[id] = this->ComputeCost(id, target, quad.data());
+      }
+    }
+  });
+  for (i = 0; i < impl->GetNumberOfEdges(); i++)
+  {
+    if (!impl->IsLocked(i))
     {
-      cost = this->ComputeCost(i, x);
+      impl->Insert(costs[i], i);
     }
-    this->EdgeCosts->Insert(cost, i);
-    this->TargetPoints->InsertTuple(i, x);
   }
+  std::vector<double>().swap(costs);
   this->UpdateProgress(0.20);
 
   // Okay collapse edges until desired reduction is reached
   this->ActualReduction = 0.0;
   this->NumberOfEdgeCollapses = 0;
-  edgeId = this->EdgeCosts->Pop(0,cost);
+  edgeId = impl->Pop(0,cost);
 
   int abort = 0;
   while ( !abort && edgeId >= 0 && cost < VTK_DOUBLE_MAX &&
@@ -332,9 +994,10 @@ int vtkQuadricDecimation::RequestData(
       abort = this->GetAbortExecute();
     }
 
-    endPtIds[0] = this->EndPoint1List->GetId(edgeId);
-    endPtIds[1] = this->EndPoint2List->GetId(edgeId);
-    this->TargetPoints->GetTuple(edgeId, x);
+    endPtIds[0] = impl->EndPoints[2*edgeId];
+    endPtIds[1] = impl->EndPoints[2*edgeId+1];
+    std::copy(impl->TargetPoints.begin() + edgeId * size,
+              impl->TargetPoints.begin() + (edgeId + 1) * size, x);
 
     // check for a poorly placed point
     if ( !this->IsGoodPlacement(endPtIds[0], endPtIds[1], x))
@@ -342,9 +1005,9 @@ int vtkQuadricDecimation::RequestData(
       vtkDebugMacro(<<"Poor placement detected " << edgeId << " " <<  cost);
       // return the point to the queue but with the max cost so that
       // when it is recomputed it will be reconsidered
-      this->EdgeCosts->Insert(VTK_DOUBLE_MAX, edgeId);
+      impl->Insert(VTK_DOUBLE_MAX, edgeId);
 
-      edgeId = this->EdgeCosts->Pop(0, cost);
+      edgeId = impl->Pop(0, cost);
       continue;
     }
 
@@ -363,101 +1026,244 @@ int vtkQuadricDecimation::RequestData(
     // Update the output triangles.
     numDeletedTris += this->CollapseEdge(endPtIds[0], endPtIds[1]);
     this->ActualReduction = (double) numDeletedTris / numTris;
-    edgeId = this->EdgeCosts->Pop(0, cost);
+    edgeId = impl->Pop(0, cost);
   }
 
   vtkDebugMacro(<<"Number Of Edge Collapses: "
                 << this->NumberOfEdgeCollapses << " Cost: " << cost);
 
   // clean up working data
-  for (i = 0; i < numPts; i++)
-  {
-    delete [] this->ErrorQuadrics[i].Quadric;
-  }
-  delete [] this->ErrorQuadrics;
-
-  if (this->VolumePreservation)
-    delete[] this->VolumeConstraints;
+  impl->Initialize();
   delete [] x;
-  this->CollapseCellIds->Delete();
-  delete [] this->TempX;
   delete [] this->TempQuad;
   delete [] this->TempB;
   delete [] this->TempA;
   delete [] this->TempData;
 
-  // copy the simplified mesh from the working mesh to the output mesh
-  for (i = 0; i < this->Mesh->GetNumberOfCells(); i++)
+  return numDeletedTris;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkQuadricDecimation::DecimatePartitions(vtkIdType numTris)
+{
+  Internals *impl = this->Implementation;
+  vtkIdType numPts = this->Mesh->GetNumberOfPoints();
+  vtkPoints *points = this->Mesh->GetPoints();
+  vtkPointData *pd = this->Mesh->GetPointData();
+  vtkIdType cellId, ptId;
+  int numParts = static_cast<int>(
+    std::min(static_cast<vtkIdType>(this->NumberOfPartitions), numTris));
+  int part, i;
+
+  vtkDebugMacro(<<"Splitting the mesh into " << numParts << " partitions");
+  std::vector<float> centers(3 * numTris);
+  vtkSMPTools::For(0, numTris, [&](vtkIdType id, vtkIdType endId) {
+    double x[3];
+    for ( ; id < endId; id++)
+    {
+      double center[3] = { 0.0, 0.0, 0.0 };
+      for (int j = 0; j < 3; j++)
+      {
+        points->GetPoint(impl->Triangles[3*id+j], x);
+        center[0] += x[0];
+        center[1] += x[1];
+        center[2] += x[2];
+      }
+      for (int j = 0; j < 3; j++)
+      {
+        centers[3*id+j] = static_cast<float>(center[j] / 3.0);
+      }
+    }
+  });
+  std::vector<vtkIdType> partTris(numTris);
+  std::vector<int> parts(numTris);
+  std::iota(partTris.begin(), partTris.end(), 0);
+  BisectTriangles(partTris.data(), partTris.data() + numTris, 0, numParts,
+                  centers.data(), parts.data());
+  std::vector<float>().swap(centers);
+
+  // The points used by triangles of several partitions are locked.
+  std::vector<int> owners(numPts, -1);
+  std::vector<char> locked(numPts, 0);
+  for (cellId = 0; cellId < numTris; cellId++)
   {
-    if (this->Mesh->GetCell(i)->GetCellType() != VTK_EMPTY_CELL)
+    for (i = 0; i < 3; i++)
     {
-      outputCellList->InsertNextId(i);
+      ptId = impl->Triangles[3*cellId+i];
+      if (owners[ptId] < 0)
+      {
+        owners[ptId] = parts[cellId];
+      }
+      else if (owners[ptId] != parts[cellId])
+      {
+        locked[ptId] = 1;
+      }
     }
   }
+  std::vector<int>().swap(owners);
 
-  output->Reset();
-  output->Allocate(this->Mesh, outputCellList->GetNumberOfIds());
-  output->GetPointData()->CopyAllocate(this->Mesh->GetPointData(),1);
-  output->CopyCells(this->Mesh, outputCellList);
-
-  this->Mesh->DeleteLinks();
-  this->Mesh->Delete();
-  outputCellList->Delete();
+  // The triangles of each partition, in ascending order.
+  std::vector<vtkIdType> partOffsets(numParts + 1, 0);
+  for (cellId = 0; cellId < numTris; cellId++)
+  {
+    partOffsets[parts[cellId]+1]++;
+  }
+  for (part = 0; part < numParts; part++)
+  {
+    partOffsets[part+1] += partOffsets[part];
+  }
+  std::vector<vtkIdType> partLocations(partOffsets.begin(), partOffsets.end() - 1);
+  for (cellId = 0; cellId < numTris; cellId++)
+  {
+    partTris[partLocations[parts[cellId]]++] = cellId;
+  }
+  std::vector<int>().swap(parts);
+  std::vector<vtkIdType>().swap(partLocations);
 
-  // renormalize, clamp attributes
-  if (this->AttributeErrorMetric)
+  std::vector<vtkSmartPointer<vtkQuadricDecimation> > workers(numParts);
+  for (part = 0; part < numParts; part++)
   {
-    if (nullptr != (attrib = output->GetPointData()->GetNormals()))
+    workers[part] = vtkSmartPointer<vtkQuadricDecimation>::New();
+    workers[part]->TargetReduction = this->TargetReduction;
+    workers[part]->AttributeErrorMetric = this->AttributeErrorMetric;
+    workers[part]->VolumePreservation = this->VolumePreservation;
+    workers[part]->NumberOfComponents = this->NumberOfComponents;
+    for (i = 0; i < 6; i++)
     {
-      for (i = 0; i < attrib->GetNumberOfTuples(); i++)
+      workers[part]->AttributeComponents[i] = this->AttributeComponents[i];
+      workers[part]->AttributeScale[i] = this->AttributeScale[i];
+    }
+  }
+
+  // Each partition is decimated in its own working mesh (with local point
+  // ids), then its triangles and moved points are copied back.
+  std::vector<vtkIdType> numDeleted(numParts, 0);
+  vtkSMPTools::For(0, numParts, 1, [&](vtkIdType p, vtkIdType endPart) {
+    for ( ; p < endPart; p++)
+    {
+      vtkQuadricDecimation *worker = workers[p];
+      Internals *local = worker->Implementation;
+      const vtkIdType *cells = partTris.data() + partOffsets[p];
+      vtkIdType numCells = partOffsets[p+1] - partOffsets[p];
+      vtkIdType k, id;
+      double x[3];
+
+      std::vector<vtkIdType> ptIds(3 * numCells);
+      for (k = 0; k < numCells; k++)
       {
-        vtkMath::Normalize(attrib->GetTuple3(i));
+        std::copy(impl->Triangles.begin() + 3 * cells[k],
+                  impl->Triangles.begin() + 3 * cells[k] + 3,
+                  ptIds.begin() + 3 * k);
+      }
+      std::sort(ptIds.begin(), ptIds.end());
+      ptIds.erase(std::unique(ptIds.begin(), ptIds.end()), ptIds.end());
+      vtkIdType numLocalPts = static_cast<vtkIdType>(ptIds.size());
+
+      vtkNew<vtkPoints> localPoints;
+      localPoints->SetDataType(points->GetDataType());
+      localPoints->SetNumberOfPoints(numLocalPts);
+      worker->Mesh = vtkPolyData::New();
+      worker->Mesh->SetPoints(localPoints);
+      vtkPointData *localPD = worker->Mesh->GetPointData();
+      if (this->AttributeErrorMetric)
+      {
+        localPD->CopyAllocate(pd, numLocalPts);
+      }
+      local->LockedPoints.resize(numLocalPts);
+      for (id = 0; id < numLocalPts; id++)
+      {
+        points->GetPoint(ptIds[id], x);
+        localPoints->SetPoint(id, x);
+        if (this->AttributeErrorMetric)
+        {
+          localPD->CopyData(pd, ptIds[id], id);
+        }
+        local->LockedPoints[id] = locked[ptIds[id]];
+      }
+      local->Triangles.resize(3 * numCells);
+      local->Deleted.assign(numCells, 0);
+      for (k = 0; k < 3 * numCells; k++)
+      {
+        local->Triangles[k] = std::lower_bound(ptIds.begin(), ptIds.end(),
+          impl->Triangles[3*cells[k/3]+k%3]) - ptIds.begin();
+      }
+
+      numDeleted[p] = worker->DecimateMesh(numCells);
+
+      for (id = 0; id < numLocalPts; id++)
+      {
+        if (!local->LockedPoints[id])
+        {
+          localPoints->GetPoint(id, x);
+          points->SetPoint(ptIds[id], x);
+          for (int attribute = 0; attribute < 5; attribute++)
+          {
+            if (this->AttributeErrorMetric &&
+                this->AttributeComponents[attribute] >
+                (attribute > 0 ? this->AttributeComponents[attribute-1] : 0))
+            {
+              pd->GetAttribute(attribute)->SetTuple(ptIds[id], id,
+                localPD->GetAttribute(attribute));
+            }
+          }
+        }
       }
+      for (k = 0; k < numCells; k++)
+      {
+        impl->Deleted[cells[k]] = local->Deleted[k];
+        for (int j = 0; j < 3; j++)
+        {
+          impl->Triangles[3*cells[k]+j] = ptIds[local->Triangles[3*k+j]];
+        }
+      }
+
+      std::vector<vtkIdType>().swap(local->Triangles);
+      std::vector<char>().swap(local->Deleted);
+      std::vector<char>().swap(local->LockedPoints);
+      worker->Mesh->Delete();
+      worker->Mesh = nullptr;
     }
-    // might want to add clamping texture coordinates??
-  }
+  });
 
-  return 1;
+  vtkIdType numDeletedTris = 0;
+  for (part = 0; part < numParts; part++)
+  {
+    numDeletedTris += numDeleted[part];
+  }
+  return numDeletedTris;
 }
 
 //----------------------------------------------------------------------------
 void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
 {
+  Internals *impl = this->Implementation;
   vtkPolyData *input = this->Mesh;
-  double *QEM;
-  vtkIdType ptId;
-  int i, j;
-  vtkCellArray *polys;
-  vtkIdType npts, *pts=nullptr;
-  double point0[3], point1[3], point2[3];
-  double n[3];
-  double tempP1[3], tempP2[3],  d, triArea2;
-  double data[16];
-  double *A[4], x[4];
-  int index[4];
-  A[0] = data;
-  A[1] = data+4;
-  A[2] = data+8;
-  A[3] = data+12;
-
-  // allocate local QEM sparse matrix
-  QEM = new double[11 + 4 * this->NumberOfComponents];
+  const int size = 11 + 4 * this->NumberOfComponents;
 
   // clear and allocate global QEM array
-  for (ptId = 0; ptId < numPts; ptId++)
+  impl->QuadricSize = size;
+  impl->Quadrics.assign(numPts * size, 0.0);
+  if (this->VolumePreservation)
   {
-    this->ErrorQuadrics[ptId].Quadric =
-      new double[11 + 4 * this->NumberOfComponents];
-    for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
-    {
-      this->ErrorQuadrics[ptId].Quadric[i] = 0.0;
-    }
+    impl->VolumeConstraints.assign(numPts * 4, 0.0);
   }
 
-  polys = input->GetPolys();
-  // compute the QEM for each face
-  for (polys->InitTraversal(); polys->GetNextCell(npts, pts); )
+  // compute the QEM of a face, return whether its attribute matrix could be
+  // factored (if not, the attributes do not contribute)
+  auto computeQEM = [&](const vtkIdType *pts, double *QEM, double n[3],
+                        double &d, double &triArea2) -> bool
   {
+    int i;
+    double point0[3], point1[3], point2[3];
+    double tempP1[3], tempP2[3];
+    double data[16];
+    double *A[4], x[4];
+    int index[4];
+    A[0] = data;
+    A[1] = data+4;
+    A[2] = data+8;
+    A[3] = data+12;
+
     input->GetPoint(pts[0], point0);
     input->GetPoint(pts[1], point1);
     input->GetPoint(pts[2], point2);
@@ -503,196 +1309,253 @@ void vtkQuadricDecimation::InitializeQuadrics(vtkIdType numPts)
       A[3][3] = 0;
 
       // should handle poorly condition matrix better
-      if (vtkMath::LUFactorLinearSystem(A, index, 4))
+      if (!vtkMath::LUFactorLinearSystem(A, index, 4))
       {
-        for (i = 0; i < this->NumberOfComponents; i++)
+        std::fill(QEM + 11, QEM + size, 0.0);
+        return false;
+      }
+      for (i = 0; i < this->NumberOfComponents; i++)
+      {
+        x[3] = 0;
+        if (i < this->AttributeComponents[0])
         {
-          x[3] = 0;
-          if (i < this->AttributeComponents[0])
-          {
-            x[0] = input->GetPointData()->GetScalars()->GetComponent(pts[0], i) *  this->AttributeScale[0];
-            x[1] = input->GetPointData()->GetScalars()->GetComponent(pts[1], i) *  this->AttributeScale[0];
-            x[2] = input->GetPointData()->GetScalars()->GetComponent(pts[2], i) *  this->AttributeScale[0];
-          }
-          else if (i < this->AttributeComponents[1])
-          {
-            x[0] = input->GetPointData()->GetVectors()->GetComponent(pts[0], i - this->AttributeComponents[0]) *  this->AttributeScale[1];
-            x[1] = input->GetPointData()->GetVectors()->GetComponent(pts[1], i - this->AttributeComponents[0]) *  this->AttributeScale[1];
-            x[2] = input->GetPointData()->GetVectors()->GetComponent(pts[2], i - this->AttributeComponents[0]) *  this->AttributeScale[1];
-          }
-          else if (i < this->AttributeComponents[2])
-          {
-            x[0] = input->GetPointData()->GetNormals()->GetComponent(pts[0], i - this->AttributeComponents[1]) *  this->AttributeScale[2];
-            x[1] = input->GetPointData()->GetNormals()->GetComponent(pts[1], i - this->AttributeComponents[1]) *  this->AttributeScale[2];
-            x[2] = input->GetPointData()->GetNormals()->GetComponent(pts[2], i - this->AttributeComponents[1]) *  this->AttributeScale[2];
-          }
-          else if (i < this->AttributeComponents[3])
-          {
-            x[0] = input->GetPointData()->GetTCoords()->GetComponent(pts[0], i - this->AttributeComponents[2]) *  this->AttributeScale[3];
-            x[1] = input->GetPointData()->GetTCoords()->GetComponent(pts[1], i - this->AttributeComponents[2])*  this->AttributeScale[3];
-            x[2] = input->GetPointData()->GetTCoords()->GetComponent(pts[2], i - this->AttributeComponents[2])*  this->AttributeScale[3];
-          }
-          else if (i < this->AttributeComponents[4])
-          {
-            x[0] = input->GetPointData()->GetTensors()->GetComponent(pts[0], i - this->AttributeComponents[3])*  this->AttributeScale[4];
-            x[1] = input->GetPointData()->GetTensors()->GetComponent(pts[1], i - this->AttributeComponents[3])*  this->AttributeScale[4];
-            x[2] = input->GetPointData()->GetTensors()->GetComponent(pts[2], i - this->AttributeComponents[3])*  this->AttributeScale[4];
-          }
-          vtkMath::LUSolveLinearSystem(A, index, x, 4);
+          x[0] = input->GetPointData()->GetScalars()->GetComponent(pts[0], i) *  this->AttributeScale[0];
+          x[1] = input->GetPointData()->GetScalars()->GetComponent(pts[1], i) *  this->AttributeScale[0];
+          x[2] = input->GetPointData()->GetScalars()->GetComponent(pts[2], i) *  this->AttributeScale[0];
+        }
+        else if (i < this->AttributeComponents[1])
+        {
+          x[0] = input->GetPointData()->GetVectors()->GetComponent(pts[0], i - this->AttributeComponents[0]) *  this->AttributeScale[1];
+          x[1] = input->GetPointData()->GetVectors()->GetComponent(pts[1], i - this->AttributeComponents[0]) *  this->AttributeScale[1];
+          x[2] = input->GetPointData()->GetVectors()->GetComponent(pts[2], i - this->AttributeComponents[0]) *  this->AttributeScale[1];
+        }
+        else if (i < this->AttributeComponents[2])
+        {
+          x[0] = input->GetPointData()->GetNormals()->GetComponent(pts[0], i - this->AttributeComponents[1]) *  this->AttributeScale[2];
+          x[1] = input->GetPointData()->GetNormals()->GetComponent(pts[1], i - this->AttributeComponents[1]) *  this->AttributeScale[2];
+          x[2] = input->GetPointData()->GetNormals()->GetComponent(pts[2], i - this->AttributeComponents[1]) *  this->AttributeScale[2];
+        }
+        else if (i < this->AttributeComponents[3])
+        {
+          x[0] = input->GetPointData()->GetTCoords()->GetComponent(pts[0], i - this->AttributeComponents[2]) *  this->AttributeScale[3];
+          x[1] = input->GetPointData()->GetTCoords()->GetComponent(pts[1], i - this->AttributeComponents[2])*  this->AttributeScale[3];
+          x[2] = input->GetPointData()->GetTCoords()->GetComponent(pts[2], i - this->AttributeComponents[2])*  this->AttributeScale[3];
+        }
+        else if (i < this->AttributeComponents[4])
+        {
+          x[0] = input->GetPointData()->GetTensors()->GetComponent(pts[0], i - this->AttributeComponents[3])*  this->AttributeScale[4];
+          x[1] = input->GetPointData()->GetTensors()->GetComponent(pts[1], i - this->AttributeComponents[3])*  this->AttributeScale[4];
+          x[2] = input->GetPointData()->GetTensors()->GetComponent(pts[2], i - this->AttributeComponents[3])*  this->AttributeScale[4];
+        }
+        vtkMath::LUSolveLinearSystem(A, index, x, 4);
 
-          // add in the contribution of this element into the QEM
-          QEM[0] += x[0] * x[0];
-          QEM[1] += x[0] * x[1];
-          QEM[2] += x[0] * x[2];
-          QEM[3] += x[3] * x[0];
+        // add in the contribution of this element into the QEM
+        QEM[0] += x[0] * x[0];
+        QEM[1] += x[0] * x[1];
+        QEM[2] += x[0] * x[2];
+        QEM[3] += x[3] * x[0];
 
-          QEM[4] += x[1] * x[1];
-          QEM[5] += x[1] * x[2];
-          QEM[6] += x[3] * x[1];
+        QEM[4] += x[1] * x[1];
+        QEM[5] += x[1] * x[2];
+        QEM[6] += x[3] * x[1];
 
-          QEM[7] += x[2] * x[2];
-          QEM[8] += x[3] * x[2];
+        QEM[7] += x[2] * x[2];
+        QEM[8] += x[3] * x[2];
 
-          QEM[9] += x[3] * x[3];
+        QEM[9] += x[3] * x[3];
 
-          QEM[11+i*4] = -x[0];
-          QEM[12+i*4] = -x[1];
-          QEM[13+i*4] = -x[2];
-          QEM[14+i*4] = -x[3];
-        }
-      }
-      else
-      {
-        vtkErrorMacro(<<"Unable to factor attribute matrix!");
+        QEM[11+i*4] = -x[0];
+        QEM[12+i*4] = -x[1];
+        QEM[13+i*4] = -x[2];
+        QEM[14+i*4] = -x[3];
       }
     }
-
-    // add the QEM to all points of the face
-    for (i = 0; i < 3; i++)
+    return true;
+  };
+
+  // Each point adds the QEM of the faces using it, in the order of the faces,
+  // so that the sums do not depend on the number of threads.
+  vtkSMPThreadLocal<vtkIdType> numFailures(0);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    std::vector<double> QEM(size);
+    double n[3], d = 0.0, triArea2 = 0.0;
+    vtkIdType &failures = numFailures.Local();
+    vtkIdType i, ncells;
+    int j;
+    for ( ; ptId < endPtId; ptId++)
     {
-      for (j = 0; j < 11 + 4 * this->NumberOfComponents; j++)
+      const vtkIdType *cells = impl->GetPointCells(ptId, ncells);
+      double *quadric = impl->Quadrics.data() + ptId * size;
+      for (i = 0; i < ncells; i++)
       {
-        this->ErrorQuadrics[pts[i]].Quadric[j] += QEM[j] * triArea2;
-      }
+        // a face using the point twice is added twice
+        const vtkIdType *pts = impl->GetCellPoints(cells[i]);
+        if (i == 0 || cells[i] != cells[i-1])
+        {
+          if (!computeQEM(pts, QEM.data(), n, d, triArea2) && pts[0] == ptId)
+          {
+            failures++;
+          }
+        }
 
-      // Set volume constraint values g_vol and d_vol
-      if (this->VolumePreservation)
-      {
-        // Vector g_vol
-        for (j = 0; j < 3; j++)
+        for (j = 0; j < size; j++)
+        {
+          quadric[j] += QEM[j] * triArea2;
+        }
+
+        // Set volume constraint values g_vol and d_vol
+        if (this->VolumePreservation)
         {
-          this->VolumeConstraints[pts[i] * 4 + j] += n[j] * triArea2 * 2.0; // triangle normal with length triArea * 2
+          double *constraint = impl->VolumeConstraints.data() + ptId * 4;
+          // Vector g_vol
+          for (j = 0; j < 3; j++)
+          {
+            constraint[j] += n[j] * triArea2 * 2.0; // triangle normal with length triArea * 2
+          }
+          // Scalar d_vol
+          constraint[3] += -d * triArea2 * 2.0; // (triangle normal with length triArea * 2) * (pts[0] position)
         }
-        // Scalar d_vol
-        this->VolumeConstraints[pts[i] * 4 + 3] += -d * triArea2 * 2.0; // (triangle normal with length triArea * 2) * (pts[0] position)
       }
     }
-  }//for all triangles
+  });
 
-  delete [] QEM;
+  vtkIdType totalFailures = 0;
+  for (vtkIdType failures : numFailures)
+  {
+    totalFailures += failures;
+  }
+  if (totalFailures > 0)
+  {
+    vtkErrorMacro(<<"Unable to factor attribute matrix of " << totalFailures
+                  << " triangles!");
+  }
 }
 
 
 void vtkQuadricDecimation::AddBoundaryConstraints()
 {
+  Internals *impl = this->Implementation;
   vtkPolyData *input = this->Mesh;
-  double *QEM;
-  vtkIdType  cellId;
-  int i, j;
-  vtkIdType npts, *pts;
-  double t0[3], t1[3], t2[3];
-  double e0[3], e1[3], n[3], c, d, w;
-  vtkIdList *cellIds = vtkIdList::New();
-
-  // allocate local QEM space matrix
-  QEM = new double[11 + 4 * this->NumberOfComponents];
-
-  for (cellId = 0; cellId < input->GetNumberOfCells(); cellId++)
-  {
-    input->GetCellPoints(cellId, npts, pts);
-
-    for (i = 0; i < 3; i++)
+  const int size = impl->QuadricSize;
+
+  // Each point adds the constraints of the boundary edges using it, in the
+  // order of the faces, as for the quadrics.
+  vtkSMPTools::For(0, input->GetNumberOfPoints(),
+                   [&](vtkIdType ptId, vtkIdType endPtId) {
+    double QEM[11];
+    int i, j;
+    vtkIdType k, ncells;
+    double t0[3], t1[3], t2[3];
+    double e0[3], e1[3], n[3], c, d, w;
+
+    for ( ; ptId < endPtId; ptId++)
     {
-      input->GetCellEdgeNeighbors(cellId, pts[i], pts[(i+1)%3], cellIds);
-      if (cellIds->GetNumberOfIds() == 0)
+      const vtkIdType *cells = impl->GetPointCells(ptId, ncells);
+      double *quadric = impl->Quadrics.data() + ptId * size;
+      for (k = 0; k < ncells; k++)
       {
-        // this is a boundary
-        input->GetPoint(pts[(i+2)%3], t0);
-        input->GetPoint(pts[i], t1);
-        input->GetPoint(pts[(i+1)%3], t2);
-
-        // computing a plane which is orthogonal to line t1, t2 and incident
-        // with it
-        for (j = 0; j < 3; j++)
-        {
-          e0[j] = t2[j] - t1[j];
-        }
-        for (j = 0; j < 3; j++)
+        vtkIdType cellId = cells[k];
+        if (k > 0 && cellId == cells[k-1])
         {
-          e1[j] = t0[j] - t1[j];
+          continue;
         }
+        const vtkIdType *pts = impl->GetCellPoints(cellId);
 
-        // compute n so that it is orthogonal to e0 and parallel to the
-        // triangle
-        c = vtkMath::Dot(e0,e1)/(e0[0]*e0[0]+e0[1]*e0[1]+e0[2]*e0[2]);
-        for (j = 0; j < 3; j++)
+        for (i = 0; i < 3; i++)
         {
-          n[j] = e1[j] - c*e0[j];
-        }
-        vtkMath::Normalize(n);
-        d = -vtkMath::Dot(n, t1);
-        w = vtkMath::Norm(e0);
+          if ((pts[i] != ptId && pts[(i+1)%3] != ptId) ||
+              !impl->IsBoundaryEdge(cellId, pts[i], pts[(i+1)%3]))
+          {
+            continue;
+          }
+
+          // this is a boundary
+          input->GetPoint(pts[(i+2)%3], t0);
+          input->GetPoint(pts[i], t1);
+          input->GetPoint(pts[(i+1)%3], t2);
 
-        //w *= w;
-        // area issue ??
-        // could possible add in angle weights??
-        QEM[0] = n[0] * n[0];
-        QEM[1] = n[0] * n[1];
-        QEM[2] = n[0] * n[2];
-        QEM[3] = d * n[0];
+          // computing a plane which is orthogonal to line t1, t2 and incident
+          // with it
+          for (j = 0; j < 3; j++)
+          {
+            e0[j] = t2[j] - t1[j];
+          }
+          for (j = 0; j < 3; j++)
+          {
+            e1[j] = t0[j] - t1[j];
+          }
 
-        QEM[4] = n[1] * n[1];
-        QEM[5] = n[1] * n[2];
-        QEM[6] = d * n[1];
+          // compute n so that it is orthogonal to e0 and parallel to the
+          // triangle
+          c = vtkMath::Dot(e0,e1)/(e0[0]*e0[0]+e0[1]*e0[1]+e0[2]*e0[2]);
+          for (j = 0; j < 3; j++)
+          {
+            n[j] = e1[j] - c*e0[j];
+          }
+          vtkMath::Normalize(n);
+          d = -vtkMath::Dot(n, t1);
+          w = vtkMath::Norm(e0);
 
-        QEM[7] = n[2] * n[2];
-        QEM[8] = d * n[2];
+          //w *= w;
+          // area issue ??
+          // could possible add in angle weights??
+          QEM[0] = n[0] * n[0];
+          QEM[1] = n[0] * n[1];
+          QEM[2] = n[0] * n[2];
+          QEM[3] = d * n[0];
 
-        QEM[9] = d * d;
+          QEM[4] = n[1] * n[1];
+          QEM[5] = n[1] * n[2];
+          QEM[6] = d * n[1];
 
-        QEM[10] = 1;
+          QEM[7] = n[2] * n[2];
+          QEM[8] = d * n[2];
 
-        // need to add orthogonal plane with the other Attributes, but this
-        // is not clear??
-        // check to interaction with attribute data
-        for (j = 0; j < 11; j++)
-        {
-          this->ErrorQuadrics[pts[i]].Quadric[j] += QEM[j]*w;
-          this->ErrorQuadrics[pts[(i+1)%3]].Quadric[j] += QEM[j]*w;
+          QEM[9] = d * d;
+
+          QEM[10] = 1;
+
+          // need to add orthogonal plane with the other Attributes, but this
+          // is not clear??
+          // check to interaction with attribute data
+          if (pts[i] == ptId)
+          {
+            for (j = 0; j < 11; j++)
+            {
+              quadric[j] += QEM[j]*w;
+            }
+          }
+          if (pts[(i+1)%3] == ptId)
+          {
+            for (j = 0; j < 11; j++)
+            {
+              quadric[j] += QEM[j]*w;
+            }
+          }
         }
       }
     }
-  }
-  cellIds->Delete();
-  delete [] QEM;
+  });
 }
 
 //----------------------------------------------------------------------------
 void vtkQuadricDecimation::AddQuadric(vtkIdType oldPtId, vtkIdType newPtId)
 {
+  Internals *impl = this->Implementation;
   int i;
+  double *newQuadric = impl->Quadrics.data() + newPtId * impl->QuadricSize;
+  const double *oldQuadric = impl->Quadrics.data() + oldPtId * impl->QuadricSize;
 
-  for (i = 0; i < 11 + 4*this->NumberOfComponents; i++)
+  for (i = 0; i < impl->QuadricSize; i++)
   {
-    this->ErrorQuadrics[newPtId].Quadric[i] +=
-      this->ErrorQuadrics[oldPtId].Quadric[i];
+    newQuadric[i] += oldQuadric[i];
   }
 
   if (this->VolumePreservation)
   {
     for (i = 0; i < 4; i++)
     {
-      this->VolumeConstraints[newPtId * 4 + i] += this->VolumeConstraints[oldPtId * 4 + i];
+      impl->VolumeConstraints[newPtId * 4 + i] += impl->VolumeConstraints[oldPtId * 4 + i];
     }
   }
 }
@@ -701,19 +1564,21 @@ void vtkQuadricDecimation::AddQuadric(vtkIdType oldPtId, vtkIdType newPtId)
 void vtkQuadricDecimation::FindAffectedEdges(vtkIdType p1Id, vtkIdType p2Id,
                                               vtkIdList *edges)
 {
+  Internals *impl = this->Implementation;
   vtkIdType ncells;
-  vtkIdType *cells, npts, *pts, edgeId;
+  const vtkIdType *cells;
+  vtkIdType edgeId;
   vtkIdType i, j;
 
   edges->Reset();
-  this->Mesh->GetPointCells(p2Id, ncells, cells);
+  cells = impl->GetPointCells(p2Id, ncells);
   for (i = 0; i < ncells; i++)
   {
-    this->Mesh->GetCellPoints(cells[i], npts, pts);
+    const vtkIdType *pts = impl->GetCellPoints(cells[i]);
     for (j = 0; j < 3; j++)
     {
       if (pts[j] != p1Id && pts[j] != p2Id &&
-          (edgeId = this->Edges->IsEdge(pts[j], p2Id)) >= 0 &&
+          (edgeId = impl->IsEdge(pts[j], p2Id)) >= 0 &&
           edges->IsId(edgeId) == -1)
       {
         edges->InsertNextId(edgeId);
@@ -721,14 +1586,14 @@ void vtkQuadricDecimation::FindAffectedEdges(vtkIdType p1Id, vtkIdType p2Id,
     }
   }
 
-  this->Mesh->GetPointCells(p1Id, ncells, cells);
+  cells = impl->GetPointCells(p1Id, ncells);
   for (i = 0; i < ncells; i++)
   {
-    this->Mesh->GetCellPoints(cells[i], npts, pts);
+    const vtkIdType *pts = impl->GetCellPoints(cells[i]);
     for (j = 0; j < 3; j++)
     {
       if (pts[j] != p1Id && pts[j] != p2Id &&
-          (edgeId = this->Edges->IsEdge(pts[j], p1Id)) >= 0 &&
+          (edgeId = impl->IsEdge(pts[j], p1Id)) >= 0 &&
           edges->IsId(edgeId) == -1)
       {
         edges->InsertNextId(edgeId);
@@ -737,12 +1602,11 @@ void vtkQuadricDecimation::FindAffectedEdges(vtkIdType p1Id, vtkIdType p2Id,
   }
 }
 
-// FIXME: memory allocation clean up
 void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
 {
-  vtkIdList *changedEdges = vtkIdList::New();
+  Internals *impl = this->Implementation;
+  vtkIdList *changedEdges = impl->ChangedEdges;
   vtkIdType i, edgeId, edge[2];
-  double cost;
 
   // Find all edges with exactly either of these 2 endpoints.
   this->FindAffectedEdges(pt0Id, pt1Id, changedEdges);
@@ -753,77 +1617,58 @@ void vtkQuadricDecimation::UpdateEdgeData(vtkIdType pt0Id, vtkIdType pt1Id)
   // Remove the changed edges from the priority queue.
   for (i = 0; i < changedEdges->GetNumberOfIds(); i++)
   {
-    edge[0] = this->EndPoint1List->GetId(changedEdges->GetId(i));
-    edge[1] = this->EndPoint2List->GetId(changedEdges->GetId(i));
+    edge[0] = impl->EndPoints[2*changedEdges->GetId(i)];
+    edge[1] = impl->EndPoints[2*changedEdges->GetId(i)+1];
 
     // Remove all affected edges from the priority queue.
     // This does not include collapsed edge.
-    this->EdgeCosts->DeleteId(changedEdges->GetId(i));
+    impl->DeleteId(changedEdges->GetId(i));
 
     // Determine the new set of edges
+    edgeId = -1;
     if (edge[0] == pt1Id)
     {
-      if (this->Edges->IsEdge(edge[1], pt0Id) == -1)
+      if (impl->IsEdge(edge[1], pt0Id) == -1)
       { // The edge will be completely new, add it.
-        edgeId = this->Edges->GetNumberOfEdges();
-        this->Edges->InsertEdge(edge[1], pt0Id, edgeId);
-        this->EndPoint1List->InsertId(edgeId, edge[1]);
-        this->EndPoint2List->InsertId(edgeId, pt0Id);
-        // Compute cost (target point/data) and add to priority cue.
-        if (this->AttributeErrorMetric)
-        {
-          cost = this->ComputeCost2(edgeId, this->TempX);
-        }
-        else
-        {
-          cost = this->ComputeCost(edgeId, this->TempX);
-        }
-        this->EdgeCosts->Insert(cost, edgeId);
-        this->TargetPoints->InsertTuple(edgeId, this->TempX);
+        edgeId = impl->InsertEdge(edge[1], pt0Id);
       }
     }
     else if (edge[1] == pt1Id)
     { // The edge will be completely new, add it.
-      if (this->Edges->IsEdge(edge[0], pt0Id) == -1)
+      if (impl->IsEdge(edge[0], pt0Id) == -1)
       {
-        edgeId = this->Edges->GetNumberOfEdges();
-        this->Edges->InsertEdge(edge[0], pt0Id, edgeId);
-        this->EndPoint1List->InsertId(edgeId, edge[0]);
-        this->EndPoint2List->InsertId(edgeId, pt0Id);
-        // Compute cost (target point/data) and add to priority cue.
-        if (this->AttributeErrorMetric)
-        {
-          cost = this->ComputeCost2(edgeId, this->TempX);
-        }
-        else
-        {
-          cost = this->ComputeCost(edgeId, this->TempX);
-        }
-        this->EdgeCosts->Insert(cost, edgeId);
-        this->TargetPoints->InsertTuple(edgeId, this->TempX);
+        edgeId = impl->InsertEdge(edge[0], pt0Id);
       }
     }
     else
     { // This edge already has one point as the merged point.
+      edgeId = changedEdges->GetId(i);
+    }
+
+    // Compute cost (target point/data) and add to priority cue.
+    if (edgeId >= 0 && !impl->IsLocked(edgeId))
+    {
+      double cost;
+      double *target = impl->TargetPoints.data() + edgeId * impl->TargetSize;
       if (this->AttributeErrorMetric)
       {
-        cost = this->ComputeCost2(changedEdges->GetId(i), this->TempX);
+        cost = this->ComputeCost2(edgeId, target, this->TempQuad,
+                                  this->TempA, this->TempB);
       }
       else
       {
-        cost = this->ComputeCost(changedEdges->GetId(i), this->TempX);
+        cost = this->ComputeCost(edgeId, target, this->TempQuad);
       }
-      this->EdgeCosts->Insert(cost, changedEdges->GetId(i));
-      this->TargetPoints->InsertTuple(changedEdges->GetId(i), this->TempX);
+      impl->Insert(cost, edgeId);
     }
   }
-
-  changedEdges->Delete();
 }
 
 //----------------------------------------------------------------------------
-double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double *x)
+double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double *x,
+                                         double *quad)
 {
+  Internals *impl = this->Implementation;
   static const double errorNumber = 1e-10;
   double temp[3], A[3][3], b[3];
   vtkIdType pointIds[2];
@@ -834,25 +1679,26 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double *x)
   double v[3],  c, norm, normTemp,  temp2[3];
   double pt1[3], pt2[3];
 
-  pointIds[0] = this->EndPoint1List->GetId(edgeId);
-  pointIds[1] = this->EndPoint2List->GetId(edgeId);
+  pointIds[0] = impl->EndPoints[2*edgeId];
+  pointIds[1] = impl->EndPoints[2*edgeId+1];
 
+  const double *quadric0 = impl->Quadrics.data() + pointIds[0] * impl->QuadricSize;
+  const double *quadric1 = impl->Quadrics.data() + pointIds[1] * impl->QuadricSize;
   for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
   {
-    this->TempQuad[i] = this->ErrorQuadrics[pointIds[0]].Quadric[i] +
-      this->ErrorQuadrics[pointIds[1]].Quadric[i];
+    quad[i] = quadric0[i] + quadric1[i];
   }
 
-  A[0][0] = this->TempQuad[0];
-  A[0][1] = A[1][0] = this->TempQuad[1];
-  A[0][2] = A[2][0] = this->TempQuad[2];
-  A[1][1] = this->TempQuad[4];
-  A[1][2] = A[2][1] = this->TempQuad[5];
-  A[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
-  b[0] = -this->TempQuad[3];
-  b[1] = -this->TempQuad[6];
-  b[2] = -this->TempQuad[8];
+  b[0] = -quad[3];
+  b[1] = -quad[6];
+  b[2] = -quad[8];
 
   norm = vtkMath::Norm(A[0]);
   normTemp = vtkMath::Norm(A[1]);
@@ -906,7 +1752,7 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double *x)
 
   // Compute the cost
   // x'*quad*x
-  index = this->TempQuad;
+  index = quad;
   for (i = 0; i < 4; i++)
   {
     cost += (*index++)*newPoint[i]*newPoint[i];
@@ -921,8 +1767,10 @@ double vtkQuadricDecimation::ComputeCost(vtkIdType edgeId, double *x)
 
 
 //----------------------------------------------------------------------------
-double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
+double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x,
+                                          double *quad, double **A, double *b)
 {
+  Internals *impl = this->Implementation;
   // this function is so ugly because the functionality of converting an QEM
   // into a dense matrix was not extracted into a separate function and
   // neither was multiplication and some other matrix and vector primitives
@@ -932,34 +1780,35 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
   int i, j;
   int solveOk;
 
-  pointIds[0] = this->EndPoint1List->GetId(edgeId);
-  pointIds[1] = this->EndPoint2List->GetId(edgeId);
+  pointIds[0] = impl->EndPoints[2*edgeId];
+  pointIds[1] = impl->EndPoints[2*edgeId+1];
 
+  const double *quadric0 = impl->Quadrics.data() + pointIds[0] * impl->QuadricSize;
+  const double *quadric1 = impl->Quadrics.data() + pointIds[1] * impl->QuadricSize;
   for (i = 0; i < 11 + 4 * this->NumberOfComponents; i++)
   {
-    this->TempQuad[i] = this->ErrorQuadrics[pointIds[0]].Quadric[i] +
-      this->ErrorQuadrics[pointIds[1]].Quadric[i];
+    quad[i] = quadric0[i] + quadric1[i];
   }
 
-  // copy the temp quad into TempA
+  // copy the temp quad into A
   // converting from the sparse matrix format into a dense
-  this->TempA[0][0] = this->TempQuad[0];
-  this->TempA[0][1] = this->TempA[1][0] = this->TempQuad[1];
-  this->TempA[0][2] = this->TempA[2][0] = this->TempQuad[2];
-  this->TempA[1][1] = this->TempQuad[4];
-  this->TempA[1][2] = this->TempA[2][1] = this->TempQuad[5];
-  this->TempA[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
-  this->TempB[0] = -this->TempQuad[3];
-  this->TempB[1] = -this->TempQuad[6];
-  this->TempB[2] = -this->TempQuad[8];
+  b[0] = -quad[3];
+  b[1] = -quad[6];
+  b[2] = -quad[8];
 
   for (i = 3; i < 3 +  this->NumberOfComponents; i++)
   {
-    this->TempA[0][i] = this->TempA[i][0] = this->TempQuad[11+4*(i-3)];
-    this->TempA[1][i] = this->TempA[i][1] = this->TempQuad[11+4*(i-3)+1];
-    this->TempA[2][i] = this->TempA[i][2] = this->TempQuad[11+4*(i-3)+2];
-    this->TempB[i] = -this->TempQuad[11+4*(i-3)+3];
+    A[0][i] = A[i][0] = quad[11+4*(i-3)];
+    A[1][i] = A[i][1] = quad[11+4*(i-3)+1];
+    A[2][i] = A[i][2] = quad[11+4*(i-3)+2];
+    b[i] = -quad[11+4*(i-3)+3];
   }
 
 
@@ -970,11 +1819,11 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
     {
       if (i == j)
       {
-        this->TempA[i][j] = this->TempQuad[10];
+        A[i][j] = quad[10];
       }
       else
       {
-        this->TempA[i][j] = 0;
+        A[i][j] = 0;
       }
     }
   }
@@ -985,45 +1834,45 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
     {
       if (i >= 3)
       {
-        this->TempA[i][3 + this->NumberOfComponents] = 0;
-        this->TempA[3 + this->NumberOfComponents][i] = 0;
+        A[i][3 + this->NumberOfComponents] = 0;
+        A[3 + this->NumberOfComponents][i] = 0;
       }
       else
       {
-        this->TempA[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[i][3 + this->NumberOfComponents] += this->VolumeConstraints[pointIds[1] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] += this->VolumeConstraints[pointIds[1] * 4 + i];
+        A[i][3 + this->NumberOfComponents] = impl->VolumeConstraints[pointIds[0] * 4 + i];
+        A[3 + this->NumberOfComponents][i] = impl->VolumeConstraints[pointIds[0] * 4 + i];
+        A[i][3 + this->NumberOfComponents] += impl->VolumeConstraints[pointIds[1] * 4 + i];
+        A[3 + this->NumberOfComponents][i] += impl->VolumeConstraints[pointIds[1] * 4 + i];
       }
     }
     // Add constraint to b
-    this->TempB[3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + 3];
-    this->TempB[3 + this->NumberOfComponents] += this->VolumeConstraints[pointIds[1] * 4 + 3];
+    b[3 + this->NumberOfComponents] = impl->VolumeConstraints[pointIds[0] * 4 + 3];
+    b[3 + this->NumberOfComponents] += impl->VolumeConstraints[pointIds[1] * 4 + 3];
   }
 
   for (i = 0; i < 3 + this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    x[i] = this->TempB[i];
+    x[i] = b[i];
   }
 
   // solve A*x = b
   // this clobers A
   // need to develop a quality of the solution test??
-  solveOk = vtkMath::SolveLinearSystem(this->TempA, x, 3 + this->NumberOfComponents + this->VolumePreservation);
+  solveOk = vtkMath::SolveLinearSystem(A, x, 3 + this->NumberOfComponents + this->VolumePreservation);
 
   // need to copy back into A
-  this->TempA[0][0] = this->TempQuad[0];
-  this->TempA[0][1] = this->TempA[1][0] = this->TempQuad[1];
-  this->TempA[0][2] = this->TempA[2][0] = this->TempQuad[2];
-  this->TempA[1][1] = this->TempQuad[4];
-  this->TempA[1][2] = this->TempA[2][1] = this->TempQuad[5];
-  this->TempA[2][2] = this->TempQuad[7];
+  A[0][0] = quad[0];
+  A[0][1] = A[1][0] = quad[1];
+  A[0][2] = A[2][0] = quad[2];
+  A[1][1] = quad[4];
+  A[1][2] = A[2][1] = quad[5];
+  A[2][2] = quad[7];
 
   for (i = 3; i < 3 +  this->NumberOfComponents; i++)
   {
-    this->TempA[0][i] = this->TempA[i][0] = this->TempQuad[11+4*(i-3)];
-    this->TempA[1][i] = this->TempA[i][1] = this->TempQuad[11+4*(i-3)+1];
-    this->TempA[2][i] = this->TempA[i][2] = this->TempQuad[11+4*(i-3)+2];
+    A[0][i] = A[i][0] = quad[11+4*(i-3)];
+    A[1][i] = A[i][1] = quad[11+4*(i-3)+1];
+    A[2][i] = A[i][2] = quad[11+4*(i-3)+2];
   }
 
   for (i = 3; i < 3 +  this->NumberOfComponents; i++)
@@ -1032,11 +1881,11 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
     {
       if (i == j)
       {
-        this->TempA[i][j] = this->TempQuad[10];
+        A[i][j] = quad[10];
       }
       else
       {
-        this->TempA[i][j] = 0;
+        A[i][j] = 0;
       }
     }
   }
@@ -1047,15 +1896,15 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
     {
       if (i >= 3)
       {
-        this->TempA[i][3 + this->NumberOfComponents] = 0;
-        this->TempA[3 + this->NumberOfComponents][i] = 0;
+        A[i][3 + this->NumberOfComponents] = 0;
+        A[3 + this->NumberOfComponents][i] = 0;
       }
       else
       {
-        this->TempA[i][3 + this->NumberOfComponents] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] = this->VolumeConstraints[pointIds[0] * 4 + i];
-        this->TempA[i][3 + this->NumberOfComponents] += this->VolumeConstraints[pointIds[1] * 4 + i];
-        this->TempA[3 + this->NumberOfComponents][i] += this->VolumeConstraints[pointIds[1] * 4 + i];
+        A[i][3 + this->NumberOfComponents] = impl->VolumeConstraints[pointIds[0] * 4 + i];
+        A[3 + this->NumberOfComponents][i] = impl->VolumeConstraints[pointIds[0] * 4 + i];
+        A[i][3 + this->NumberOfComponents] += impl->VolumeConstraints[pointIds[1] * 4 + i];
+        A[3 + this->NumberOfComponents][i] += impl->VolumeConstraints[pointIds[1] * 4 + i];
       }
     }
   }
@@ -1088,7 +1937,7 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
       temp2[i] = 0;
       for (j = 0; j < 3 + this->NumberOfComponents; ++j)
       {
-        temp2[i] += this->TempA[i][j]*v[j];
+        temp2[i] += A[i][j]*v[j];
       }
     }
 
@@ -1106,13 +1955,13 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
         temp[i] = 0;
         for (j = 0; j < 3 + this->NumberOfComponents; ++j)
         {
-          temp[i] += this->TempA[i][j]*pt1[j];
+          temp[i] += A[i][j]*pt1[j];
         }
       }
 
       for (i = 0; i < 3 + this->NumberOfComponents; i++)
       {
-        temp[i] = this->TempB[i] - temp[i];
+        temp[i] = b[i] - temp[i];
       }
 
       for (i = 0; i < 3 + this->NumberOfComponents; i++)
@@ -1146,18 +1995,18 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
   // x'*A*x - 2*b*x + d
   for (i = 0; i < 3+this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    cost += this->TempA[i][i]*x[i]*x[i];
+    cost += A[i][i]*x[i]*x[i];
     for (j = i+1; j < 3+this->NumberOfComponents + this->VolumePreservation; j++)
     {
-      cost += 2.0*this->TempA[i][j]*x[i]*x[j];
+      cost += 2.0*A[i][j]*x[i]*x[j];
     }
   }
   for (i = 0; i < 3+this->NumberOfComponents + this->VolumePreservation; i++)
   {
-    cost -=  2.0 * this->TempB[i]*x[i];
+    cost -=  2.0 * b[i]*x[i];
   }
 
-  cost += this->TempQuad[9];
+  cost += quad[9];
 
   return cost;
 }
@@ -1165,48 +2014,57 @@ double vtkQuadricDecimation::ComputeCost2(vtkIdType edgeId, double *x)
 
 int vtkQuadricDecimation::CollapseEdge(vtkIdType pt0Id, vtkIdType pt1Id)
 {
+  Internals *impl = this->Implementation;
+  vtkIdList *cellIds = impl->CollapseCellIds;
   int j, numDeleted=0;
-  vtkIdType i, npts, *pts, cellId;
+  vtkIdType i, cellId;
 
-  this->Mesh->GetPointCells(pt0Id, this->CollapseCellIds);
-  for (i = 0; i < this->CollapseCellIds->GetNumberOfIds(); i++)
+  impl->GetPointCells(pt0Id, cellIds);
+  for (i = 0; i < cellIds->GetNumberOfIds(); i++)
   {
-    cellId = this->CollapseCellIds->GetId(i);
-    this->Mesh->GetCellPoints(cellId, npts, pts);
+    cellId = cellIds->GetId(i);
+    const vtkIdType *pts = impl->GetCellPoints(cellId);
     for (j = 0; j < 3; j++)
     {
       if (pts[j] == pt1Id)
       {
-        this->Mesh->RemoveCellReference(cellId);
-        this->Mesh->DeleteCell(cellId);
+        if (!impl->Deleted[cellId])
+        {
+          impl->RemoveCellReference(cellId);
+          impl->Deleted[cellId] = 1;
+        }
         numDeleted++;
       }
     }
   }
 
-  this->Mesh->GetPointCells(pt1Id, this->CollapseCellIds);
-  this->Mesh->ResizeCellList(pt0Id, this->CollapseCellIds->GetNumberOfIds());
-  for (i=0; i < this->CollapseCellIds->GetNumberOfIds(); i++)
+  impl->GetPointCells(pt1Id, cellIds);
+  impl->ResizeCellList(pt0Id, cellIds->GetNumberOfIds());
+  for (i=0; i < cellIds->GetNumberOfIds(); i++)
   {
-    cellId = this->CollapseCellIds->GetId(i);
-    this->Mesh->GetCellPoints(cellId, npts, pts);
+    cellId = cellIds->GetId(i);
+    vtkIdType *pts = impl->Triangles.data() + 3 * cellId;
     // making sure we don't already have the triangle we're about to
     // change this one to
-    if ((pts[0] == pt1Id && this->Mesh->IsTriangle(pt0Id, pts[1], pts[2])) ||
-        (pts[1] == pt1Id && this->Mesh->IsTriangle(pts[0], pt0Id, pts[2])) ||
-        (pts[2] == pt1Id && this->Mesh->IsTriangle(pts[0], pts[1], pt0Id)))
+    if ((pts[0] == pt1Id && impl->IsTriangle(pt0Id, pts[1], pts[2])) ||
+        (pts[1] == pt1Id && impl->IsTriangle(pts[0], pt0Id, pts[2])) ||
+        (pts[2] == pt1Id && impl->IsTriangle(pts[0], pts[1], pt0Id)))
     {
-      this->Mesh->RemoveCellReference(cellId);
-      this->Mesh->DeleteCell(cellId);
+      impl->RemoveCellReference(cellId);
+      impl->Deleted[cellId] = 1;
       numDeleted++;
     }
     else
     {
-      this->Mesh->AddReferenceToCell(pt0Id, cellId);
-      this->Mesh->ReplaceCellPoint(cellId, pt1Id, pt0Id);
+      impl->AddCellReference(cellId, pt0Id);
+      vtkIdType *pt = std::find(pts, pts + 3, pt1Id);
+      if (pt != pts + 3)
+      {
+        *pt = pt0Id;
+      }
     }
   }
-  this->Mesh->DeletePoint(pt1Id);
+  impl->DeletePoint(pt1Id);
 
   return numDeleted;
 }
@@ -1259,13 +2117,15 @@ int vtkQuadricDecimation::TrianglePlaneCheck(const double t0[3],
 int vtkQuadricDecimation::IsGoodPlacement(vtkIdType pt0Id, vtkIdType pt1Id,
 const double *x)
 {
+  Internals *impl = this->Implementation;
   vtkIdType ncells, i;
-  vtkIdType npts, *pts,  ptId, *cells;
+  vtkIdType ptId;
+  const vtkIdType *cells;
   double pt1[3], pt2[3], pt3[3];
 
-  this->Mesh->GetPointCells(pt0Id, ncells, cells);
+  cells = impl->GetPointCells(pt0Id, ncells);
   for (i = 0; i < ncells; i++) {
-  this->Mesh->GetCellPoints(cells[i], npts, pts);
+  const vtkIdType *pts = impl->GetCellPoints(cells[i]);
   // assume triangle
   if (pts[0] != pt1Id && pts[1] != pt1Id && pts[2] != pt1Id)
   {
@@ -1285,10 +2145,10 @@ const double *x)
   }
   }
 
-  this->Mesh->GetPointCells(pt1Id, ncells, cells);
+  cells = impl->GetPointCells(pt1Id, ncells);
   for (i = 0; i < ncells; i++)
   {
-    this->Mesh->GetCellPoints(cells[i], npts, pts);
+    const vtkIdType *pts = impl->GetCellPoints(cells[i]);
     // assume triangle
     if (pts[0] != pt0Id && pts[1] != pt0Id && pts[2] != pt0Id)
     {
@@ -1454,4 +2314,5 @@ void vtkQuadricDecimation::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Normals Weight: " << this->NormalsWeight << "\n";
   os << indent << "TCoords Weight: " << this->TCoordsWeight << "\n";
   os << indent << "Tensors Weight: " << this->TensorsWeight << "\n";
+  os << indent << "Number Of Partitions: " << this->NumberOfPartitions << "\n";
 }
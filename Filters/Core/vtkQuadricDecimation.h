@@ -40,6 +40,12 @@
  * taking into account variation in attributes (i.e., scalars, vectors, and
  * so on).
  *
+ * The error quadrics and the initial edge costs are computed in parallel
+ * using vtkSMPTools, while the edges are collapsed sequentially. For large
+ * meshes the collapses may also be performed in parallel by splitting the
+ * mesh into partitions (see NumberOfPartitions), at the price of keeping
+ * the points shared by partitions in place.
+ *
  * This paper is based on the work of Garland and Heckbert who first
  * presented the quadric error measure at Siggraph '97 "Surface
  * Simplification Using Quadric Error Metrics". For details of the algorithm
@@ -59,11 +65,8 @@
 #include "vtkFiltersCoreModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
-class vtkEdgeTable;
 class vtkIdList;
 class vtkPointData;
-class vtkPriorityQueue;
-class vtkDoubleArray;
 
 class VTKFILTERSCORE_EXPORT vtkQuadricDecimation : public vtkPolyDataAlgorithm
 {
@@ -148,6 +151,21 @@ public:
   vtkGetMacro(TensorsWeight, double);
   //@}
 
+  //@{
+  /**
+   * Set/Get the number of partitions the mesh is split into to collapse
+   * edges in parallel. The triangles are split into compact groups of
+   * nearly equal size, which are decimated independently, each by the
+   * TargetReduction: the points used by triangles of several partitions do
+   * not move, and the edges using them are not collapsed. The result
+   * depends on the number of partitions but not on the number of threads.
+   * By default (1) the edges of the whole mesh are collapsed sequentially,
+   * in the order of increasing cost.
+   */
+  vtkSetClampMacro(NumberOfPartitions, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPartitions, int);
+  //@}
+
   //@{
   /**
    * Get the actual reduction. This value is only valid after the
@@ -162,6 +180,18 @@ protected:
 
   int RequestData(vtkInformation *, vtkInformationVector **, vtkInformationVector *) override;
 
+  /**
+   * Collapse the edges of the working mesh (numTris triangles) until the
+   * target reduction is reached; return the number of triangles deleted.
+   */
+  vtkIdType DecimateMesh(vtkIdType numTris);
+
+  /**
+   * Split the working mesh into NumberOfPartitions partitions, and
+   * decimate them in parallel; return the number of triangles deleted.
+   */
+  vtkIdType DecimatePartitions(vtkIdType numTris);
+
   /**
    * Do the dirty work of eliminating the edge; return the number of
    * triangles deleted.
@@ -192,10 +222,13 @@ protected:
   //@{
   /**
    * Compute cost for contracting this edge and the point that gives us this
-   * cost.
+   * cost. The work arrays (quad of 11 + 4 * NumberOfComponents values, A and
+   * b of 3 + NumberOfComponents + VolumePreservation rows) are given by the
+   * caller so that the costs of several edges may be computed concurrently.
    */
-  double ComputeCost(vtkIdType edgeId, double *x);
-  double ComputeCost2(vtkIdType edgeId, double *x);
+  double ComputeCost(vtkIdType edgeId, double *x, double *quad);
+  double ComputeCost2(vtkIdType edgeId, double *x, double *quad, double **A,
+                      double *b);
   //@}
 
   /**
@@ -247,32 +280,21 @@ protected:
   double TCoordsWeight;
   double TensorsWeight;
 
+  int NumberOfPartitions;
+
   int               NumberOfEdgeCollapses;
-  vtkEdgeTable     *Edges;
-  vtkIdList        *EndPoint1List;
-  vtkIdList        *EndPoint2List;
-  vtkPriorityQueue *EdgeCosts;
-  vtkDoubleArray   *TargetPoints;
   int               NumberOfComponents;
   vtkPolyData      *Mesh;
 
-  struct ErrorQuadric
-  {
-    double *Quadric;
-  };
-
-
-  // One ErrorQuadric per point
-  ErrorQuadric *ErrorQuadrics;
-
-  // Contains 4 doubles per point. Length = nPoints * 4
-  double *VolumeConstraints;
   int AttributeComponents[6];
   double        AttributeScale[6];
 
+  // The triangles, cell links, edges, edge costs and error quadrics of the
+  // working mesh.
+  class Internals;
+  Internals *Implementation;
+
   // Temporary variables for performance
-  vtkIdList *CollapseCellIds;
-  double *TempX;
   double *TempQuad;
   double *TempB;
   double **TempA;
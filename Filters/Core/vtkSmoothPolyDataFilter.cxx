@@ -18,6 +18,7 @@
 #include "vtkCellData.h"
 #include "vtkCellLocator.h"
 #include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
 #include "vtkMath.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -25,10 +26,17 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticCellLinks.h"
+#include "vtkStaticCellLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleFilter.h"
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 vtkStandardNewMacro(vtkSmoothPolyDataFilter);
 
@@ -119,6 +127,7 @@ vtkSmoothPolyDataFilter::vtkSmoothPolyDataFilter()
   this->NumberOfIterations = 20;
 
   this->RelaxationFactor = .01;
+  this->JacobiSmoothing = 0;
 
   this->FeatureAngle = 45.0;
   this->EdgeAngle = 15.0;
@@ -156,19 +165,257 @@ vtkPolyData *vtkSmoothPolyDataFilter::GetSource()
 #define VTK_FEATURE_EDGE_VERTEX 2
 #define VTK_BOUNDARY_EDGE_VERTEX 3
 
+// Marks a polygon edge that is processed from its neighbor polygon instead.
+#define VTK_VISITED_EDGE -1
+
 namespace {
 
-// Special structure for marking vertices
-typedef struct _vtkMeshVertex
+// The cells using a point are visited in ascending order, as with
+// vtkCellLinks, so that the analysis does not depend on how the links were
+// built.
+struct SortLinks
 {
-  char      type;
-  vtkIdList *edges; // connected edges (list of connected point ids)
-  _vtkMeshVertex()
+  vtkStaticCellLinks *Links;
+
+  SortLinks(vtkStaticCellLinks *links) : Links(links) {}
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      vtkIdType *cells = this->Links->GetCells(ptId);
+      std::sort(cells, cells + this->Links->GetNcells(ptId));
+    }
+  }
+};
+
+// The cells other than cellId using the edge (p1,p2), in the order of the
+// cells using p1 (see vtkPolyData::GetCellEdgeNeighbors()).
+void GetCellEdgeNeighbors(vtkStaticCellLinks *links, vtkIdType cellId,
+                          vtkIdType p1, vtkIdType p2, vtkIdList *cellIds)
+{
+  cellIds->Reset();
+
+  const vtkIdType *cells1 = links->GetCells(p1);
+  const vtkIdType *cells1End = cells1 + links->GetNcells(p1);
+  const vtkIdType *cells2 = links->GetCells(p2);
+  const vtkIdType *cells2End = cells2 + links->GetNcells(p2);
+
+  for ( ; cells1 != cells1End; ++cells1)
+  {
+    if (*cells1 != cellId && std::find(cells2, cells2End, *cells1) != cells2End)
+    {
+      cellIds->InsertNextId(*cells1);
+    }
+  }
+}
+
+// Classify the edges of the polygons: the i-th edge of a polygon, joining
+// its points i and i+1, is a boundary, feature (non-manifold or, with
+// feature edge smoothing, sharp) or simple edge, unless it is visited from
+// a neighbor polygon with a lower id. The type of the i-th edge is stored
+// at the position of the i-th point in the connectivity array.
+struct ClassifyEdges
+{
+  vtkPoints *Points;
+  vtkCellArray *Polys;
+  vtkStaticCellLinks *Links;
+  bool FeatureEdgeSmoothing;
+  double CosFeatureAngle;
+  signed char *EdgeTypes;
+  vtkSMPThreadLocalObject<vtkIdList> Neighbors;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+  vtkSMPThreadLocalObject<vtkIdList> NeighborPoints;
+
+  ClassifyEdges(vtkPoints *points, vtkCellArray *polys,
+                vtkStaticCellLinks *links, bool featureEdgeSmoothing,
+                double cosFeatureAngle, signed char *edgeTypes) :
+    Points(points), Polys(polys), Links(links),
+    FeatureEdgeSmoothing(featureEdgeSmoothing),
+    CosFeatureAngle(cosFeatureAngle), EdgeTypes(edgeTypes)
+  {
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdList *neighbors = this->Neighbors.Local();
+    vtkIdList *cellPoints = this->CellPoints.Local();
+    vtkIdList *neighborPoints = this->NeighborPoints.Local();
+    vtkIdType npts, numNeiPts;
+    const vtkIdType *pts, *neiPts;
+    double normal[3], neiNormal[3];
+
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      this->Polys->GetCellAtId(cellId, npts, pts, cellPoints);
+      signed char *edgeTypes = this->EdgeTypes + this->Polys->GetOffset(cellId);
+      for (vtkIdType i = 0; i < npts; i++)
+      {
+        GetCellEdgeNeighbors(this->Links, cellId, pts[i], pts[(i+1)%npts],
+                             neighbors);
+        vtkIdType numNei = neighbors->GetNumberOfIds();
+        vtkIdType nei;
+
+        signed char edge = VTK_SIMPLE_VERTEX;
+        if ( numNei == 0 )
+        {
+          edge = VTK_BOUNDARY_EDGE_VERTEX;
+        }
+        else if ( numNei >= 2 )
+        {
+          // check to make sure that this edge hasn't been marked already
+          vtkIdType j;
+          for (j=0; j < numNei; j++)
+          {
+            if ( neighbors->GetId(j) < cellId )
+            {
+              break;
+            }
+          }
+          if ( j >= numNei )
+          {
+            edge = VTK_FEATURE_EDGE_VERTEX;
+          }
+        }
+        else if ( (nei=neighbors->GetId(0)) > cellId )
+        {
+          if (this->FeatureEdgeSmoothing)
+          {
+            vtkPolygon::ComputeNormal(this->Points, npts,
+                                      const_cast<vtkIdType*>(pts), normal);
+            this->Polys->GetCellAtId(nei, numNeiPts, neiPts, neighborPoints);
+            vtkPolygon::ComputeNormal(this->Points, numNeiPts,
+                                      const_cast<vtkIdType*>(neiPts),
+                                      neiNormal);
+
+            if ( vtkMath::Dot(normal,neiNormal) <= this->CosFeatureAngle )
+            {
+              edge = VTK_FEATURE_EDGE_VERTEX;
+            }
+          }
+        }
+        else // a visited edge
+        {
+          edge = VTK_VISITED_EDGE;
+        }
+        edgeTypes[i] = edge;
+      }
+    }
+  }
+};
+
+// Gather the points connected to each point, the edges used to smooth it,
+// and set its type. The classified edges are replayed around each point in
+// the order in which the polygons list them, so that the outcome is the
+// same as processing the polygons one after the other. The first pass only
+// counts the edges of the points, the second one (when Edges is set) fills
+// them in.
+struct GatherEdges
+{
+  vtkCellArray *Polys;
+  vtkStaticCellLinks *Links;
+  const signed char *EdgeTypes;
+  const char *LineTypes;
+  const vtkIdType *LineEdges;
+  char *Types;
+  vtkIdType *Offsets;
+  vtkIdType *Edges;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> PointEdges;
+
+  GatherEdges(vtkCellArray *polys, vtkStaticCellLinks *links,
+              const signed char *edgeTypes, const char *lineTypes,
+              const vtkIdType *lineEdges, char *types, vtkIdType *offsets,
+              vtkIdType *edges) :
+    Polys(polys), Links(links), EdgeTypes(edgeTypes), LineTypes(lineTypes),
+    LineEdges(lineEdges), Types(types), Offsets(offsets), Edges(edges)
+  {
+  }
+
+  static void AddEdge(signed char edge, vtkIdType ptId, char& type,
+                      std::vector<vtkIdType>& pointEdges)
   {
-    type = VTK_SIMPLE_VERTEX; //can smooth
-    edges = nullptr;
+    if ( edge && type == VTK_SIMPLE_VERTEX )
+    {
+      pointEdges.clear();
+      pointEdges.push_back(ptId);
+      type = edge;
+    }
+    else if ( (edge && type == VTK_BOUNDARY_EDGE_VERTEX) ||
+              (edge && type == VTK_FEATURE_EDGE_VERTEX) ||
+              (!edge && type == VTK_SIMPLE_VERTEX ) )
+    {
+      pointEdges.push_back(ptId);
+      if ( type && edge == VTK_BOUNDARY_EDGE_VERTEX )
+      {
+        type = VTK_BOUNDARY_EDGE_VERTEX;
+      }
+    }
   }
-} vtkMeshVertex, *vtkMeshVertexPtr;
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    vtkIdList *cellPoints = this->CellPoints.Local();
+    std::vector<vtkIdType>& pointEdges = this->PointEdges.Local();
+    vtkIdType npts;
+    const vtkIdType *pts;
+
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      // the edges of a vertex in the middle of a line
+      char type = this->LineTypes[ptId];
+      pointEdges.clear();
+      if ( type == VTK_FEATURE_EDGE_VERTEX )
+      {
+        pointEdges.push_back(this->LineEdges[2*ptId]);
+        pointEdges.push_back(this->LineEdges[2*ptId+1]);
+      }
+
+      const vtkIdType ncells = this->Links ? this->Links->GetNcells(ptId) : 0;
+      const vtkIdType *cells = ncells ? this->Links->GetCells(ptId) : nullptr;
+      for (vtkIdType k = 0; k < ncells; k++)
+      {
+        // a polygon using the point several times is visited once
+        if ( k > 0 && cells[k] == cells[k-1] )
+        {
+          continue;
+        }
+        this->Polys->GetCellAtId(cells[k], npts, pts, cellPoints);
+        const signed char *edgeTypes =
+          this->EdgeTypes + this->Polys->GetOffset(cells[k]);
+        for (vtkIdType i = 0; i < npts; i++)
+        {
+          const signed char edge = edgeTypes[i];
+          if ( edge == VTK_VISITED_EDGE )
+          {
+            continue;
+          }
+          const vtkIdType p1 = pts[i];
+          const vtkIdType p2 = pts[(i+1)%npts];
+          if ( p1 == ptId )
+          {
+            AddEdge(edge, p2, type, pointEdges);
+          }
+          if ( p2 == ptId )
+          {
+            AddEdge(edge, p1, type, pointEdges);
+          }
+        }
+      }
+
+      if ( this->Edges )
+      {
+        std::copy(pointEdges.begin(), pointEdges.end(),
+                  this->Edges + this->Offsets[ptId]);
+      }
+      else
+      {
+        this->Types[ptId] = type;
+        this->Offsets[ptId] = static_cast<vtkIdType>(pointEdges.size());
+      }
+    }
+  }
+};
 
 template<typename T> struct vtkSPDF_InternalParams
 {
@@ -178,11 +425,13 @@ template<typename T> struct vtkSPDF_InternalParams
   T factor;
   T conv;
   vtkIdType numPts;
-  vtkMeshVertexPtr vertexPtr;
+  const char *types;
+  const vtkIdType *offsets;
+  const vtkIdType *edges;
   vtkPolyData *source;
   vtkSmoothPoints *SmoothPoints;
   double *w;
-  vtkCellLocator *cellLocator;
+  vtkAbstractCellLocator *cellLocator;
 };
 
 template<typename T> void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
@@ -204,20 +453,22 @@ template<typename T> void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
     maxDist = 0.0;
     T* newPtsCoords = static_cast<T*>(params.newPts->GetVoidPointer(0));
     T* start = newPtsCoords;
-    vtkMeshVertexPtr vertsPtr = params.vertexPtr;
-    vtkIdType npts, *edgeIdPtr;
+    vtkIdType npts;
+    const vtkIdType *edgeIdPtr;
     T dist, deltaX[3];
     double dist2, xNew[3], closestPt[3];
 
     // For each non-fixed vertex of the mesh, move the point toward the mean
-    // position of its connected neighbors using the relaxation factor.
+    // position of its connected neighbors using the relaxation factor. The
+    // points are moved in place, one after the other (Gauss-Seidel), so
+    // this loop is sequential.
     for (vtkIdType i = 0; i < params.numPts; ++i)
     {
-      if (vertsPtr->type != VTK_FIXED_VERTEX && vertsPtr->edges != nullptr &&
-         (npts = vertsPtr->edges->GetNumberOfIds()) > 0)
+      if (params.types[i] != VTK_FIXED_VERTEX &&
+         (npts = params.offsets[i+1] - params.offsets[i]) > 0)
       {
         deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
-        edgeIdPtr = vertsPtr->edges->GetPointer(0);
+        edgeIdPtr = params.edges + params.offsets[i];
         // Compute the mean (cumulated) direction vector
         for (vtkIdType j = 0; j < npts; ++j)
         {
@@ -272,13 +523,126 @@ template<typename T> void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
       {
         newPtsCoords += 3;
       }
-      ++vertsPtr;
     }//for all points
   }//for not converged or within iteration count
 
   vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
 }
 
+// Same iterations as vtkSPDF_MovePoints, but with a Jacobi update: each pass
+// reads the coordinates of the previous pass and writes the new ones to a
+// second buffer, so the points are moved in parallel. The cell locator must
+// support thread-safe queries.
+template<typename T> void vtkSPDF_MovePointsJacobi(vtkSPDF_InternalParams<T>& params)
+{
+  T* coords = static_cast<T*>(params.newPts->GetVoidPointer(0));
+  std::vector<T> buffer(coords, coords + 3 * params.numPts);
+  T* prevCoords = coords;
+  T* nextCoords = buffer.data();
+
+  vtkSMPThreadLocalObject<vtkGenericCell> cells;
+  vtkSMPThreadLocal<std::vector<double> > weights;
+  int maxCellSize = params.source ? params.source->GetMaxCellSize() : 0;
+
+  int iterationNumber = 0;
+  for (T maxDist = std::numeric_limits<T>::max();
+       maxDist > params.conv && iterationNumber < params.numberOfIterations;
+       ++iterationNumber)
+  {
+    if (iterationNumber && !(iterationNumber % 5))
+    {
+      params.spdf->UpdateProgress(0.5 + 0.5*iterationNumber / params.numberOfIterations);
+      if (params.spdf->GetAbortExecute())
+      {
+        break;
+      }
+    }
+
+    // Fixed points are never written, so both buffers keep their
+    // coordinates.
+    vtkSMPThreadLocal<T> localMaxDist(0.0);
+    vtkSMPTools::For(0, params.numPts, [&](vtkIdType ptId, vtkIdType endPtId)
+    {
+      T& threadMaxDist = localMaxDist.Local();
+      vtkGenericCell *cell = cells.Local();
+      std::vector<double>& w = weights.Local();
+      w.resize(maxCellSize);
+      double dist2, xNew[3], closestPt[3];
+
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        vtkIdType npts = params.offsets[ptId+1] - params.offsets[ptId];
+        if (params.types[ptId] == VTK_FIXED_VERTEX || npts <= 0)
+        {
+          continue;
+        }
+
+        // Compute the mean (cumulated) direction vector
+        T deltaX[3] = { 0.0, 0.0, 0.0 };
+        const vtkIdType *edgeIdPtr = params.edges + params.offsets[ptId];
+        for (vtkIdType j = 0; j < npts; ++j, ++edgeIdPtr)
+        {
+          for (unsigned short k = 0; k < 3; ++k)
+          {
+            deltaX[k] += prevCoords[3 * (*edgeIdPtr) + k];
+          }
+        }
+
+        // Move the point
+        const T *x = prevCoords + 3 * ptId;
+        T *xNext = nextCoords + 3 * ptId;
+        for (unsigned short k = 0; k < 3; ++k)
+        {
+          xNext[k] = x[k] + params.factor * (deltaX[k] / npts - x[k]);
+          xNew[k] = xNext[k];
+        }
+
+        // Constrain point to surface
+        if (params.source)
+        {
+          vtkSmoothPoint *sPtr = params.SmoothPoints->GetSmoothPoint(ptId);
+          if (sPtr->cellId >= 0)
+          {
+            params.source->GetCell(sPtr->cellId, cell);
+          }
+          if (sPtr->cellId < 0 || cell->EvaluatePosition(xNew, closestPt,
+              sPtr->subId, sPtr->p, dist2, w.data()) == 0)
+          { // not in cell anymore
+            params.cellLocator->FindClosestPoint(xNew, closestPt, cell,
+                                                 sPtr->cellId, sPtr->subId, dist2);
+          }
+          for (unsigned short k = 0; k < 3; ++k)
+          {
+            xNext[k] = static_cast<T>(closestPt[k]);
+          }
+        }
+
+        T dist = vtkMath::Norm(deltaX);
+        if (dist > threadMaxDist)
+        {
+          threadMaxDist = dist;
+        }
+      }
+    });
+
+    maxDist = 0.0;
+    for (typename vtkSMPThreadLocal<T>::iterator it = localMaxDist.begin();
+         it != localMaxDist.end(); ++it)
+    {
+      maxDist = std::max(maxDist, *it);
+    }
+    std::swap(prevCoords, nextCoords);
+  }//for not converged or within iteration count
+
+  // The last pass may have written to the second buffer
+  if (prevCoords != coords)
+  {
+    std::copy(prevCoords, prevCoords + 3 * params.numPts, coords);
+  }
+
+  vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
+}
+
 }// namespace
 
 int vtkSmoothPolyDataFilter::RequestData(
@@ -307,7 +671,6 @@ int vtkSmoothPolyDataFilter::RequestData(
   int j, k;
   vtkIdType npts = 0;
   vtkIdType *pts = nullptr;
-  vtkIdType p1, p2;
   double conv;
   double x1[3], x2[3], x3[3], l1[3], l2[3];
   double CosFeatureAngle; //Cosine of angle between adjacent polys
@@ -319,8 +682,7 @@ int vtkSmoothPolyDataFilter::RequestData(
   vtkTriangleFilter *toTris=nullptr;
   vtkCellArray *inVerts, *inLines, *inPolys, *inStrips;
   vtkPoints *newPts;
-  vtkMeshVertexPtr Verts;
-  vtkCellLocator *cellLocator=nullptr;
+  vtkAbstractCellLocator *cellLocator=nullptr;
 
   // Check input
   //
@@ -362,7 +724,7 @@ int vtkSmoothPolyDataFilter::RequestData(
   // using a subset of the attached vertices.
   //
   vtkDebugMacro(<<"Analyzing topology...");
-  Verts = new vtkMeshVertex[numPts];
+  std::vector<char> lineTypes(numPts, VTK_SIMPLE_VERTEX); //can smooth
 
   inPts = input->GetPoints();
   conv = this->Convergence * input->GetLength();
@@ -373,44 +735,42 @@ int vtkSmoothPolyDataFilter::RequestData(
   {
     for (j=0; j<npts; j++)
     {
-      Verts[pts[j]].type = VTK_FIXED_VERTEX;
+      lineTypes[pts[j]] = VTK_FIXED_VERTEX;
     }
   }
   this->UpdateProgress(0.10);
 
   // now check lines. Only manifold lines can be smoothed------------
-  for (inLines=input->GetLines(), inLines->InitTraversal();
-  inLines->GetNextCell(npts,pts); )
+  // The two points connected to a feature edge vertex of a line are stored
+  // in lineEdges.
+  inLines = input->GetLines();
+  std::vector<vtkIdType> lineEdges(
+    inLines->GetNumberOfCells() > 0 ? 2*numPts : 0);
+  for (inLines->InitTraversal(); inLines->GetNextCell(npts,pts); )
   {
     for (j=0; j<npts; j++)
     {
-      if ( Verts[pts[j]].type == VTK_SIMPLE_VERTEX )
+      if ( lineTypes[pts[j]] == VTK_SIMPLE_VERTEX )
       {
         if ( j == (npts-1) ) //end-of-line marked FIXED
         {
-          Verts[pts[j]].type = VTK_FIXED_VERTEX;
+          lineTypes[pts[j]] = VTK_FIXED_VERTEX;
         }
         else if ( j == 0 ) //beginning-of-line marked FIXED
         {
-          Verts[pts[0]].type = VTK_FIXED_VERTEX;
-          inPts->GetPoint(pts[0],x2);
-          inPts->GetPoint(pts[1],x3);
+          lineTypes[pts[0]] = VTK_FIXED_VERTEX;
         }
         else //is edge vertex (unless already edge vertex!)
         {
-          Verts[pts[j]].type = VTK_FEATURE_EDGE_VERTEX;
-          Verts[pts[j]].edges = vtkIdList::New();
-          Verts[pts[j]].edges->SetNumberOfIds(2);
-          Verts[pts[j]].edges->SetId(0,pts[j-1]);
-          Verts[pts[j]].edges->SetId(1,pts[j+1]);
+          lineTypes[pts[j]] = VTK_FEATURE_EDGE_VERTEX;
+          lineEdges[2*pts[j]] = pts[j-1];
+          lineEdges[2*pts[j]+1] = pts[j+1];
         }
       } //if simple vertex
 
-      else if ( Verts[pts[j]].type == VTK_FEATURE_EDGE_VERTEX )
+      else if ( lineTypes[pts[j]] == VTK_FEATURE_EDGE_VERTEX )
       { //multiply connected, becomes fixed!
-        Verts[pts[j]].type = VTK_FIXED_VERTEX;
-        Verts[pts[j]].edges->Delete();
-        Verts[pts[j]].edges = nullptr;
+        lineTypes[pts[j]] = VTK_FIXED_VERTEX;
       }
 
     } //for all points in this line
@@ -418,24 +778,24 @@ int vtkSmoothPolyDataFilter::RequestData(
   this->UpdateProgress(0.25);
 
   // now polygons and triangle strips-------------------------------
+  // The edges of the polygons are classified in parallel, then each point
+  // gathers the edges it uses in parallel. The connected vertices of the
+  // points are stored contiguously: those of point i are edges[offsets[i]]
+  // to edges[offsets[i+1]-1].
   inPolys=input->GetPolys();
   numPolys = inPolys->GetNumberOfCells();
   inStrips=input->GetStrips();
   numStrips = inStrips->GetNumberOfCells();
 
+  std::vector<char> types(numPts);
+  std::vector<vtkIdType> offsets(numPts+1);
+  std::vector<vtkIdType> edges;
+  vtkCellArray *polys = nullptr;
+  vtkStaticCellLinks *links = nullptr;
+  std::vector<signed char> edgeTypes;
+
   if ( numPolys > 0 || numStrips > 0 )
   { //build cell structure
-    vtkCellArray *polys;
-    vtkIdType cellId;
-    int numNei, nei, edge;
-    vtkIdType numNeiPts;
-    vtkIdType *neiPts;
-    double normal[3], neiNormal[3];
-    vtkIdList *neighbors;
-
-    neighbors = vtkIdList::New();
-    neighbors->Allocate(VTK_CELL_SIZE);
-
     inMesh = vtkPolyData::New();
     inMesh->SetPoints(inPts);
     inMesh->SetPolys(inPolys);
@@ -450,152 +810,82 @@ int vtkSmoothPolyDataFilter::RequestData(
       Mesh = toTris->GetOutput();
     }
 
-    Mesh->BuildLinks(); //to do neighborhood searching
     polys = Mesh->GetPolys();
+    links = vtkStaticCellLinks::New(); //to do neighborhood searching
+    links->BuildLinks(Mesh);
+    SortLinks sortLinks(links);
+    vtkSMPTools::For(0, numPts, sortLinks);
     this->UpdateProgress(0.375);
 
-    for (cellId=0, polys->InitTraversal(); polys->GetNextCell(npts,pts);
-    cellId++)
-    {
-      for (i=0; i < npts; i++)
-      {
-        p1 = pts[i];
-        p2 = pts[(i+1)%npts];
-
-        if ( Verts[p1].edges == nullptr )
-        {
-          Verts[p1].edges = vtkIdList::New();
-          Verts[p1].edges->Allocate(16,6);
-        }
-        if ( Verts[p2].edges == nullptr )
-        {
-          Verts[p2].edges = vtkIdList::New();
-          Verts[p2].edges->Allocate(16,6);
-        }
-
-        Mesh->GetCellEdgeNeighbors(cellId,p1,p2,neighbors);
-        numNei = neighbors->GetNumberOfIds();
-
-        edge = VTK_SIMPLE_VERTEX;
-        if ( numNei == 0 )
-        {
-          edge = VTK_BOUNDARY_EDGE_VERTEX;
-        }
-
-        else if ( numNei >= 2 )
-        {
-          // check to make sure that this edge hasn't been marked already
-          for (j=0; j < numNei; j++)
-          {
-            if ( neighbors->GetId(j) < cellId )
-            {
-              break;
-            }
-          }
-          if ( j >= numNei )
-          {
-            edge = VTK_FEATURE_EDGE_VERTEX;
-          }
-        }
-
-        else if ( numNei == 1 && (nei=neighbors->GetId(0)) > cellId )
-        {
-          if (this->FeatureEdgeSmoothing)
-          {
-            vtkPolygon::ComputeNormal(inPts,npts,pts,normal);
-            Mesh->GetCellPoints(nei,numNeiPts,neiPts);
-            vtkPolygon::ComputeNormal(inPts,numNeiPts,neiPts,neiNormal);
-
-            if (vtkMath::Dot(normal,neiNormal) <= CosFeatureAngle)
-            {
-              edge = VTK_FEATURE_EDGE_VERTEX;
-            }
-          }
-        }
-        else // a visited edge; skip rest of analysis
-        {
-          continue;
-        }
-
-        if ( edge && Verts[p1].type == VTK_SIMPLE_VERTEX )
-        {
-          Verts[p1].edges->Reset();
-          Verts[p1].edges->InsertNextId(p2);
-          Verts[p1].type = edge;
-        }
-        else if ( (edge && Verts[p1].type == VTK_BOUNDARY_EDGE_VERTEX) ||
-        (edge && Verts[p1].type == VTK_FEATURE_EDGE_VERTEX) ||
-        (!edge && Verts[p1].type == VTK_SIMPLE_VERTEX ) )
-        {
-          Verts[p1].edges->InsertNextId(p2);
-          if ( Verts[p1].type && edge == VTK_BOUNDARY_EDGE_VERTEX )
-          {
-            Verts[p1].type = VTK_BOUNDARY_EDGE_VERTEX;
-          }
-        }
-
-        if ( edge && Verts[p2].type == VTK_SIMPLE_VERTEX )
-        {
-          Verts[p2].edges->Reset();
-          Verts[p2].edges->InsertNextId(p1);
-          Verts[p2].type = edge;
-        }
-        else if ( (edge && Verts[p2].type == VTK_BOUNDARY_EDGE_VERTEX ) ||
-        (edge && Verts[p2].type == VTK_FEATURE_EDGE_VERTEX) ||
-        (!edge && Verts[p2].type == VTK_SIMPLE_VERTEX ) )
-        {
-          Verts[p2].edges->InsertNextId(p1);
-          if ( Verts[p2].type && edge == VTK_BOUNDARY_EDGE_VERTEX )
-          {
-            Verts[p2].type = VTK_BOUNDARY_EDGE_VERTEX;
-          }
-        }
-      }
-    }
+    edgeTypes.resize(polys->GetNumberOfConnectivityIds());
+    ClassifyEdges classify(inPts, polys, links,
+                           this->FeatureEdgeSmoothing != 0, CosFeatureAngle,
+                           edgeTypes.data());
+    vtkSMPTools::For(0, polys->GetNumberOfCells(), classify);
+  }//if strips or polys
 
+  GatherEdges countEdges(polys, links, edgeTypes.data(), lineTypes.data(),
+                         lineEdges.data(), types.data(), offsets.data(),
+                         nullptr);
+  vtkSMPTools::For(0, numPts, countEdges);
+  vtkIdType numEdges = 0;
+  for (i=0; i<numPts; i++)
+  {
+    vtkIdType count = offsets[i];
+    offsets[i] = numEdges;
+    numEdges += count;
+  }
+  offsets[numPts] = numEdges;
+  edges.resize(numEdges);
+  GatherEdges fillEdges(polys, links, edgeTypes.data(), lineTypes.data(),
+                        lineEdges.data(), types.data(), offsets.data(),
+                        edges.data());
+  vtkSMPTools::For(0, numPts, fillEdges);
+
+  if (links)
+  {
+    links->Delete();
     inMesh->Delete();
-    if (toTris) {toTris->Delete();}
-
-    neighbors->Delete();
-  }//if strips or polys
+  }
+  if (toTris) {toTris->Delete();}
 
   this->UpdateProgress(0.50);
 
   //post-process edge vertices to make sure we can smooth them
   for (i=0; i<numPts; i++)
   {
-    if ( Verts[i].type == VTK_SIMPLE_VERTEX )
+    if ( types[i] == VTK_SIMPLE_VERTEX )
     {
       numSimple++;
     }
 
-    else if ( Verts[i].type == VTK_FIXED_VERTEX )
+    else if ( types[i] == VTK_FIXED_VERTEX )
     {
       numFixed++;
     }
 
-    else if ( Verts[i].type == VTK_FEATURE_EDGE_VERTEX ||
-    Verts[i].type == VTK_BOUNDARY_EDGE_VERTEX )
+    else if ( types[i] == VTK_FEATURE_EDGE_VERTEX ||
+    types[i] == VTK_BOUNDARY_EDGE_VERTEX )
     { //see how many edges; if two, what the angle is
 
       if ( !this->BoundarySmoothing &&
-      Verts[i].type == VTK_BOUNDARY_EDGE_VERTEX )
+      types[i] == VTK_BOUNDARY_EDGE_VERTEX )
       {
-        Verts[i].type = VTK_FIXED_VERTEX;
+        types[i] = VTK_FIXED_VERTEX;
         numBEdges++;
       }
 
-      else if ( (npts = Verts[i].edges->GetNumberOfIds()) != 2 )
+      else if ( (npts = offsets[i+1] - offsets[i]) != 2 )
       {
-        Verts[i].type = VTK_FIXED_VERTEX;
+        types[i] = VTK_FIXED_VERTEX;
         numFixed++;
       }
 
       else //check angle between edges
       {
-        inPts->GetPoint(Verts[i].edges->GetId(0),x1);
+        inPts->GetPoint(edges[offsets[i]],x1);
         inPts->GetPoint(i,x2);
-        inPts->GetPoint(Verts[i].edges->GetId(1),x3);
+        inPts->GetPoint(edges[offsets[i]+1],x3);
 
         for (k=0; k<3; k++)
         {
@@ -607,11 +897,11 @@ int vtkSmoothPolyDataFilter::RequestData(
              vtkMath::Dot(l1,l2) < CosEdgeAngle)
         {
           numFixed++;
-          Verts[i].type = VTK_FIXED_VERTEX;
+          types[i] = VTK_FIXED_VERTEX;
         }
         else
         {
-          if ( Verts[i].type == VTK_FEATURE_EDGE_VERTEX )
+          if ( types[i] == VTK_FEATURE_EDGE_VERTEX )
           {
             numFEdges++;
           }
@@ -657,7 +947,15 @@ int vtkSmoothPolyDataFilter::RequestData(
   {
     this->SmoothPoints = new vtkSmoothPoints;
     vtkSmoothPoint *sPtr;
-    cellLocator = vtkCellLocator::New();
+    // The Jacobi iterations query the locator from several threads.
+    if ( this->JacobiSmoothing )
+    {
+      cellLocator = vtkStaticCellLocator::New();
+    }
+    else
+    {
+      cellLocator = vtkCellLocator::New();
+    }
     w = new double[source->GetMaxCellSize()];
 
     cellLocator->SetDataSet(source);
@@ -673,29 +971,51 @@ int vtkSmoothPolyDataFilter::RequestData(
   }
   else //smooth normally
   {
-    for (i=0; i<numPts; i++) //initialize to old coordinates
+    //initialize to old coordinates
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      newPts->SetPoint(i,inPts->GetPoint(i));
-    }
+      double x[3];
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        inPts->GetPoint(ptId, x);
+        newPts->SetPoint(ptId, x);
+      }
+    });
   }
 
   if (newPts->GetDataType() == VTK_DOUBLE)
   {
     vtkSPDF_InternalParams<double> params = { this, this->NumberOfIterations, newPts,
                                               this->RelaxationFactor, conv, numPts,
-                                              Verts, source, this->SmoothPoints,
+                                              types.data(), offsets.data(),
+                                              edges.data(), source, this->SmoothPoints,
                                               w, cellLocator };
 
-    vtkSPDF_MovePoints(params);
+    if ( this->JacobiSmoothing )
+    {
+      vtkSPDF_MovePointsJacobi(params);
+    }
+    else
+    {
+      vtkSPDF_MovePoints(params);
+    }
   }
   else
   {
     vtkSPDF_InternalParams<float> params = { this, this->NumberOfIterations, newPts,
                                              static_cast<float>(this->RelaxationFactor),
-                                             static_cast<float>(conv), numPts, Verts,
-                                             source, this->SmoothPoints, w, cellLocator };
+                                             static_cast<float>(conv), numPts,
+                                             types.data(), offsets.data(),
+                                             edges.data(), source, this->SmoothPoints, w, cellLocator };
 
-    vtkSPDF_MovePoints(params);
+    if ( this->JacobiSmoothing )
+    {
+      vtkSPDF_MovePointsJacobi(params);
+    }
+    else
+    {
+      vtkSPDF_MovePoints(params);
+    }
   }
 
   if ( source )
@@ -714,13 +1034,18 @@ int vtkSmoothPolyDataFilter::RequestData(
   {
     vtkFloatArray *newScalars = vtkFloatArray::New();
     newScalars->SetNumberOfTuples(numPts);
-    for (i=0; i<numPts; i++)
+    float *errors = newScalars->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      inPts->GetPoint(i,x1);
-      newPts->GetPoint(i,x2);
-      newScalars->SetComponent(i,0,
-                               sqrt(vtkMath::Distance2BetweenPoints(x1,x2)));
-    }
+      double p1[3], p2[3];
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        inPts->GetPoint(ptId,p1);
+        newPts->GetPoint(ptId,p2);
+        errors[ptId] = static_cast<float>(
+          sqrt(vtkMath::Distance2BetweenPoints(p1,p2)));
+      }
+    });
     int idx = output->GetPointData()->AddArray(newScalars);
     output->GetPointData()->SetActiveAttribute(idx, vtkDataSetAttributes::SCALARS);
     newScalars->Delete();
@@ -731,16 +1056,20 @@ int vtkSmoothPolyDataFilter::RequestData(
     vtkFloatArray *newVectors = vtkFloatArray::New();
     newVectors->SetNumberOfComponents(3);
     newVectors->SetNumberOfTuples(numPts);
-    for (i=0; i<numPts; i++)
+    float *errors = newVectors->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      inPts->GetPoint(i,x1);
-      newPts->GetPoint(i,x2);
-      for (j=0; j<3; j++)
+      double p1[3], p2[3];
+      for ( ; ptId < endPtId; ++ptId)
       {
-        x3[j] = x2[j] - x1[j];
+        inPts->GetPoint(ptId,p1);
+        newPts->GetPoint(ptId,p2);
+        for (int comp=0; comp<3; comp++)
+        {
+          errors[3*ptId+comp] = static_cast<float>(p2[comp] - p1[comp]);
+        }
       }
-      newVectors->SetTuple(i,x3);
-    }
+    });
     output->GetPointData()->SetVectors(newVectors);
     newVectors->Delete();
   }
@@ -753,17 +1082,6 @@ int vtkSmoothPolyDataFilter::RequestData(
   output->SetPolys(input->GetPolys());
   output->SetStrips(input->GetStrips());
 
-  //free up connectivity storage
-  for (i=0; i<numPts; i++)
-  {
-    if ( Verts[i].edges != nullptr )
-    {
-      Verts[i].edges->Delete();
-      Verts[i].edges = nullptr;
-    }
-  }
-  delete [] Verts;
-
   return 1;
 }
 
@@ -789,6 +1107,7 @@ void vtkSmoothPolyDataFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Convergence: " << this->Convergence << "\n";
   os << indent << "Number of Iterations: " << this->NumberOfIterations << "\n";
   os << indent << "Relaxation Factor: " << this->RelaxationFactor << "\n";
+  os << indent << "Jacobi Smoothing: " << (this->JacobiSmoothing ? "On\n" : "Off\n");
   os << indent << "Feature Edge Smoothing: " << (this->FeatureEdgeSmoothing ? "On\n" : "Off\n");
   os << indent << "Feature Angle: " << this->FeatureAngle << "\n";
   os << indent << "Edge Angle: " << this->EdgeAngle << "\n";
@@ -77,6 +77,12 @@
  * second input: the Source. If defined, the input mesh is constrained to
  * lie on the surface defined by the Source ivar.
  *
+ * The topological analysis is performed in parallel using vtkSMPTools. By
+ * default the smoothing iterations are sequential, since each point is moved
+ * using the already moved positions of the points before it (Gauss-Seidel
+ * update). When JacobiSmoothing is on, each iteration instead computes all
+ * the new positions from the positions of the previous iteration, so the
+ * iterations run in parallel.
  *
  * @warning
  * The Laplacian operation reduces high frequency information in the geometry
@@ -142,6 +148,21 @@ public:
   vtkGetMacro(RelaxationFactor,double);
   //@}
 
+  //@{
+  /**
+   * Turn on/off the Jacobi update of the points. When on, each iteration
+   * moves every point using the positions of its neighbors at the end of the
+   * previous iteration (the coordinates are double buffered), and the points
+   * are processed in parallel. The results then do not depend on the number
+   * of threads, but differ slightly from the default in-place (Gauss-Seidel)
+   * update, which usually converges in fewer iterations. A source surface is
+   * searched with a vtkStaticCellLocator in this mode. Off by default.
+   */
+  vtkSetMacro(JacobiSmoothing,vtkTypeBool);
+  vtkGetMacro(JacobiSmoothing,vtkTypeBool);
+  vtkBooleanMacro(JacobiSmoothing,vtkTypeBool);
+  //@}
+
   //@{
   /**
    * Turn on/off smoothing along sharp interior edges.
@@ -225,6 +246,7 @@ protected:
   double Convergence;
   int NumberOfIterations;
   double RelaxationFactor;
+  vtkTypeBool JacobiSmoothing;
   vtkTypeBool FeatureEdgeSmoothing;
   double FeatureAngle;
   double EdgeAngle;
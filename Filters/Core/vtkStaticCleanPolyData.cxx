@@ -16,18 +16,25 @@
 
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkMergePoints.h"
+#include "vtkNew.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStaticPointLocator.h"
 #include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 
 #include <algorithm>
+#include <vector>
 
 vtkStandardNewMacro(vtkStaticCleanPolyData);
 
@@ -102,6 +109,216 @@ struct CopyPoints
 
 };
 
+//----------------------------------------------------------------------------
+// The input cell arrays, in the order of the cell ids; degenerate cells may
+// move to a lower one.
+enum { VERTS=0, LINES=1, POLYS=2, STRIPS=3 };
+
+// Number of consecutive input cells processed together when cleaning cells.
+const vtkIdType CellChunkSize = 4096;
+
+// Fast, threaded way to remap the cells to the merged points. The input cells
+// (verts, lines, polys then strips, as numbered by the cell ids) are
+// processed in chunks. A first pass counts the cells and connectivity entries
+// each chunk generates in each output cell array; prefix sums over the chunks
+// give where each chunk writes; a second pass writes the cells. Hence the
+// output cells are ordered as if the input cells were processed one by one.
+struct CleanCells
+{
+  vtkCellArray *InCells[4];
+  vtkIdType InOffsets[5]; //first cell id of each input cell array
+  const vtkIdType *PointMap;
+  vtkTypeBool ConvertLinesToPoints;
+  vtkTypeBool ConvertPolysToLines;
+  vtkTypeBool ConvertStripsToPolys;
+  vtkTypeBool RemoveDuplicates;
+  vtkIdType MaxCellSize;
+
+  // Number of cells and connectivity entries of each chunk in each output
+  // cell array; after the prefix sums, where each chunk starts writing.
+  std::vector<vtkIdType> ChunkCells;
+  std::vector<vtkIdType> ChunkConn;
+
+  // The output (second pass only)
+  bool Fill;
+  vtkIdType *OutOffsets[4];
+  vtkIdType *OutConn[4];
+  vtkIdType OutCellIds[4]; //first output cell id of each output cell array
+  vtkIdType *CellMap; //output cell id -> input cell id
+
+  vtkSMPThreadLocalObject<vtkIdList> CellPts;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> NewPts;
+
+  CleanCells(vtkPolyData *input, const vtkIdType *pointMap,
+             vtkTypeBool convertLinesToPoints,
+             vtkTypeBool convertPolysToLines,
+             vtkTypeBool convertStripsToPolys,
+             vtkTypeBool removeDuplicates) :
+    PointMap(pointMap), ConvertLinesToPoints(convertLinesToPoints),
+    ConvertPolysToLines(convertPolysToLines),
+    ConvertStripsToPolys(convertStripsToPolys),
+    RemoveDuplicates(removeDuplicates), Fill(false), CellMap(nullptr)
+  {
+    this->InCells[VERTS] = input->GetVerts();
+    this->InCells[LINES] = input->GetLines();
+    this->InCells[POLYS] = input->GetPolys();
+    this->InCells[STRIPS] = input->GetStrips();
+    this->InOffsets[0] = 0;
+    for (int type=0; type < 4; ++type)
+    {
+      // Accessing the cell arrays here also readies them for the concurrent
+      // random access of the threads.
+      this->InCells[type]->GetNumberOfConnectivityIds();
+      this->InOffsets[type+1] = this->InOffsets[type] +
+        this->InCells[type]->GetNumberOfCells();
+      this->OutOffsets[type] = nullptr;
+      this->OutConn[type] = nullptr;
+      this->OutCellIds[type] = 0;
+    }
+    this->MaxCellSize = input->GetMaxCellSize();
+    vtkIdType numChunks = this->GetNumberOfChunks();
+    this->ChunkCells.resize(4*numChunks, 0);
+    this->ChunkConn.resize(4*numChunks, 0);
+  }
+
+  vtkIdType GetNumberOfChunks() const
+  {
+    return (this->InOffsets[4] + CellChunkSize - 1) / CellChunkSize;
+  }
+
+  // Map the points of a cell to the merged points, removing the consecutive
+  // duplicates left by the merging if requested (never in vertices), and
+  // return the output cell array the cleaned cell goes to (-1 if it is
+  // deleted).
+  int CleanCell(int type, vtkIdType npts, const vtkIdType *pts,
+                vtkIdType *newPts, vtkIdType &numNewPts) const
+  {
+    numNewPts = 0;
+    for (vtkIdType i=0; i < npts; ++i)
+    {
+      vtkIdType ptId = this->PointMap[pts[i]];
+      if ( !this->RemoveDuplicates || type == VERTS || numNewPts == 0 ||
+           ptId != newPts[numNewPts-1] )
+      {
+        newPts[numNewPts++] = ptId;
+      }
+    }
+    if ( type == POLYS && numNewPts > 2 && newPts[0] == newPts[numNewPts-1] )
+    {
+      numNewPts--;
+    }
+
+    switch (type)
+    {
+      case VERTS:
+        return ( numNewPts > 0 ? VERTS : -1 );
+
+      case STRIPS:
+        if ( numNewPts > 3 || !this->ConvertStripsToPolys )
+        {
+          return STRIPS;
+        }
+        VTK_FALLTHROUGH;
+      case POLYS:
+        if ( numNewPts > 2 || !this->ConvertPolysToLines )
+        {
+          return POLYS;
+        }
+        VTK_FALLTHROUGH;
+      default: //LINES
+        if ( numNewPts > 1 || !this->ConvertLinesToPoints )
+        {
+          return LINES;
+        }
+        return ( numNewPts == 1 ? VERTS : -1 );
+    }
+  }
+
+  void Initialize()
+  {
+    this->NewPts.Local().resize(this->MaxCellSize > 0 ? this->MaxCellSize : 1);
+  }
+
+  void operator() (vtkIdType chunk, vtkIdType endChunk)
+  {
+    vtkIdList *&cellPts = this->CellPts.Local();
+    vtkIdType *newPts = this->NewPts.Local().data();
+    vtkIdType npts, numNewPts;
+    const vtkIdType *pts;
+
+    for ( ; chunk < endChunk; ++chunk )
+    {
+      vtkIdType *numCells = this->ChunkCells.data() + 4*chunk;
+      vtkIdType *connSize = this->ChunkConn.data() + 4*chunk;
+      vtkIdType cellId = chunk * CellChunkSize;
+      vtkIdType endCellId = std::min(cellId + CellChunkSize, this->InOffsets[4]);
+      int type = 0;
+      for ( ; cellId < endCellId; ++cellId )
+      {
+        while ( cellId >= this->InOffsets[type+1] )
+        {
+          ++type;
+        }
+        this->InCells[type]->GetCellAtId(cellId - this->InOffsets[type],
+                                         npts, pts, cellPts);
+        int outType = this->CleanCell(type, npts, pts, newPts, numNewPts);
+        if ( outType < 0 )
+        {
+          continue;
+        }
+        if ( this->Fill )
+        {
+          vtkIdType outCellId = numCells[outType];
+          this->OutOffsets[outType][outCellId] = connSize[outType];
+          std::copy(newPts, newPts + numNewPts,
+                    this->OutConn[outType] + connSize[outType]);
+          this->CellMap[this->OutCellIds[outType] + outCellId] = cellId;
+        }
+        numCells[outType]++;
+        connSize[outType] += numNewPts;
+      }
+    }
+  }
+
+  void Reduce()
+  {}
+
+  // Turn the counts into the chunk starting positions, and return the number
+  // of cells and connectivity entries of each output cell array.
+  void PrefixSum(vtkIdType totalCells[4], vtkIdType totalConn[4])
+  {
+    vtkIdType numChunks = this->GetNumberOfChunks();
+    for (int type=0; type < 4; ++type)
+    {
+      totalCells[type] = totalConn[type] = 0;
+      for (vtkIdType chunk=0; chunk < numChunks; ++chunk)
+      {
+        vtkIdType numCells = this->ChunkCells[4*chunk+type];
+        vtkIdType connSize = this->ChunkConn[4*chunk+type];
+        this->ChunkCells[4*chunk+type] = totalCells[type];
+        this->ChunkConn[4*chunk+type] = totalConn[type];
+        totalCells[type] += numCells;
+        totalConn[type] += connSize;
+      }
+    }
+  }
+};
+
+// Copy the cell data of the input cells cellMap[i] to the output cells i.
+struct CopyCellData
+{
+  ArrayList *Arrays;
+  const vtkIdType *CellMap;
+
+  void operator() (vtkIdType cellId, vtkIdType endCellId)
+  {
+    for ( ; cellId < endCellId; ++cellId )
+    {
+      this->Arrays->Copy(this->CellMap[cellId], cellId);
+    }
+  }
+};
+
 } //anonymous namespace
 
 
@@ -116,6 +333,7 @@ vtkStaticCleanPolyData::vtkStaticCleanPolyData()
   this->ConvertPolysToLines  = 1;
   this->ConvertLinesToPoints = 1;
   this->ConvertStripsToPolys = 1;
+  this->RemoveDuplicateCellPoints = 0;
   this->Locator = vtkStaticPointLocator::New();
   this->PieceInvariant = 1;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
@@ -194,19 +412,6 @@ int vtkStaticCleanPolyData::RequestData(
     vtkDebugMacro(<<"No data to Operate On!");
     return 1;
   }
-  vtkIdType *updatedPts = new vtkIdType[input->GetMaxCellSize()];
-
-  // we'll be needing these
-  vtkIdType inCellID, newId;
-  vtkIdType i;
-  vtkIdType ptId;
-  vtkIdType npts = 0;
-  vtkIdType *pts = nullptr;
-
-  vtkCellArray *inVerts  = input->GetVerts(),  *newVerts  = nullptr;
-  vtkCellArray *inLines  = input->GetLines(),  *newLines  = nullptr;
-  vtkCellArray *inPolys  = input->GetPolys(),  *newPolys  = nullptr;
-  vtkCellArray *inStrips = input->GetStrips(), *newStrips = nullptr;
 
   vtkPointData *inPD = input->GetPointData();
   vtkCellData  *inCD = input->GetCellData();
@@ -222,7 +427,6 @@ int vtkStaticCleanPolyData::RequestData(
   vtkPointData *outPD = output->GetPointData();
   vtkCellData  *outCD = output->GetCellData();
   outPD->CopyAllocate(inPD);
-  outCD->CopyAllocate(inCD);
 
   // Prefix sum: count the number of new points; allocate memory. Populate the
   // point map (old points to new).
@@ -236,7 +440,7 @@ int vtkStaticCleanPolyData::RequestData(
       pointMap[id] = numNewPts++;
     }
   }
-  // Now map old merged points to new points
+  // Now map old merged points to new points.
   for ( id=0; id < numPts; ++id )
   {
     if ( mergeMap[id] != id )
@@ -244,7 +448,18 @@ int vtkStaticCleanPolyData::RequestData(
       pointMap[id] = pointMap[mergeMap[id]];
     }
   }
-  delete [] mergeMap;
+  // Copying all the points in id order, each new point ends up with the
+  // last point merged into it. The merge map is reused to copy only these
+  // points, so that the output does not depend on the thread scheduling.
+  std::vector<vtkIdType> lastPt(numNewPts);
+  for ( id=0; id < numPts; ++id )
+  {
+    lastPt[pointMap[id]] = id;
+  }
+  for ( id=0; id < numPts; ++id )
+  {
+    mergeMap[id] = ( lastPt[pointMap[id]] == id ? pointMap[id] : -1 );
+  }
 
   vtkPoints *newPts = inPts->NewInstance();
   if(this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
@@ -269,320 +484,102 @@ int vtkStaticCleanPolyData::RequestData(
 
   switch (vtkTemplate2PackMacro(inPtsType, outPtsType))
   {
-    vtkTemplate2MacroCP((CopyPoints<VTK_T1,VTK_T2>::Execute(numPts, pointMap,
+    vtkTemplate2MacroCP((CopyPoints<VTK_T1,VTK_T2>::Execute(numPts, mergeMap,
                         (VTK_T1*)inPtr, inPD, numNewPts, (VTK_T2*)outPtr, outPD)));
     default:
       vtkErrorMacro(<<"Type not supported");
+      delete [] mergeMap;
+      delete [] pointMap;
+      newPts->Delete();
       return 0;
   }
-
-  // Finally, remap the topology to use new point ids. Celldata needs to be
-  // copied correctly. If a poly is converted to a line, or a line to a
-  // point, then using a CellCounter will not do, as the cells should be
-  // ordered verts, lines, polys, strips. We need to maintain separate cell
-  // data lists so we can copy them all correctly. Tedious but easy to
-  // implement. We can use outCD for vertex cell data, then add the rest
-  // at the end.
-  vtkCellData  *outLineData = nullptr;
-  vtkCellData  *outPolyData = nullptr;
-  vtkCellData  *outStrpData = nullptr;
-  vtkIdType vertIDcounter = 0, lineIDcounter = 0;
-  vtkIdType polyIDcounter = 0, strpIDcounter = 0;
-
-  // Begin to adjust topology.
-  //
-  // Vertices are renumbered and we remove duplicates
-  vtkIdType numCellPts;
-  inCellID = 0;
-  if ( !this->GetAbortExecute() && inVerts->GetNumberOfCells() > 0 )
+  delete [] mergeMap;
+  this->UpdateProgress(0.5);
+
+  // Finally, remap the topology to use new point ids (in parallel). If
+  // requested, the merged points are removed from the cells. Cells reduced
+  // below their minimum number of points are converted to the appropriate
+  // lower cell type (if enabled) or deleted. The output cells are ordered verts, lines, polys,
+  // strips; within each of these in the order of their input cells.
+  CleanCells clean(input, pointMap, this->ConvertLinesToPoints,
+                   this->ConvertPolysToLines, this->ConvertStripsToPolys,
+                   this->RemoveDuplicateCellPoints);
+  vtkIdType numChunks = clean.GetNumberOfChunks();
+  vtkSMPTools::For(0, numChunks, clean);
+
+  vtkIdType numCells[4], connSize[4];
+  clean.PrefixSum(numCells, connSize);
+  vtkIdType numNewCells = 0;
+  vtkSmartPointer<vtkIdTypeArray> offsets[4], conn[4];
+  for (int type=0; type < 4; ++type)
   {
-    newVerts = vtkCellArray::New();
-    newVerts->Allocate(inVerts->GetSize());
-
-    vtkDebugMacro(<<"Starting Verts "<<inCellID);
-    for (inVerts->InitTraversal(); inVerts->GetNextCell(npts,pts);
-         inCellID++)
+    clean.OutCellIds[type] = numNewCells;
+    numNewCells += numCells[type];
+    if ( numCells[type] > 0 )
     {
-      for ( numCellPts=0, i=0; i < npts; i++ )
-      {
-        ptId = pointMap[pts[i]];
-        updatedPts[numCellPts++] = ptId;
-      }//for all points of vertex cell
-
-      if ( numCellPts > 0 )
-      {
-        newId = newVerts->InsertNextCell(numCellPts,updatedPts);
-        outCD->CopyData(inCD, inCellID, newId);
-        if ( vertIDcounter != newId)
-        {
-          vtkErrorMacro(<<"Vertex ID fault in vertex test");
-        }
-        vertIDcounter++;
-      }
+      offsets[type] = vtkSmartPointer<vtkIdTypeArray>::New();
+      offsets[type]->SetNumberOfValues(numCells[type]+1);
+      offsets[type]->SetValue(numCells[type], connSize[type]);
+      conn[type] = vtkSmartPointer<vtkIdTypeArray>::New();
+      conn[type]->SetNumberOfValues(connSize[type]);
+      clean.OutOffsets[type] = offsets[type]->GetPointer(0);
+      clean.OutConn[type] = conn[type]->GetPointer(0);
     }
   }
-  this->UpdateProgress(0.25);
-
-  // lines reduced to one point are eliminated or made into verts
-  if ( !this->GetAbortExecute() && inLines->GetNumberOfCells() > 0 )
-  {
-    newLines = vtkCellArray::New();
-    newLines->Allocate(inLines->GetSize());
-    outLineData = vtkCellData::New();
-    outLineData->CopyAllocate(inCD);
-    //
-    vtkDebugMacro(<<"Starting Lines "<<inCellID);
-    for (inLines->InitTraversal(); inLines->GetNextCell(npts,pts); inCellID++)
-    {
-      for ( numCellPts=0, i=0; i<npts; i++ )
-      {
-        ptId = pointMap[pts[i]];
-        updatedPts[numCellPts++] = ptId;
-      }//for all cell points
-
-      if ( (numCellPts>1) || !this->ConvertLinesToPoints )
-      {
-        newId = newLines->InsertNextCell(numCellPts,updatedPts);
-        outLineData->CopyData(inCD, inCellID, newId);
-        if ( lineIDcounter != newId)
-        {
-          vtkErrorMacro(<<"Line ID fault in line test");
-        }
-        lineIDcounter++;
-      }
-      else if ( numCellPts==1 )
-      {
-        if (!newVerts)
-        {
-          newVerts = vtkCellArray::New();
-          newVerts->Allocate(5);
-        }
-        newId = newVerts->InsertNextCell(numCellPts,updatedPts);
-        outCD->CopyData(inCD, inCellID, newId);
-        if (vertIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Vertex ID fault in line test");
-        }
-        vertIDcounter++;
-      }
-    }
-    vtkDebugMacro(<<"Removed "
-                  << inLines->GetNumberOfCells() - newLines->GetNumberOfCells()
-                  << " lines");
+  std::vector<vtkIdType> cellMap(numNewCells);
+  clean.CellMap = cellMap.data();
+  clean.Fill = true;
+  vtkSMPTools::For(0, numChunks, clean);
+  delete [] pointMap;
 
-  }
-  this->UpdateProgress(0.50);
+  vtkDebugMacro(<<"Removed "
+                << input->GetNumberOfCells() - numNewCells << " cells");
+  this->UpdateProgress(0.75);
 
-  // polygons reduced to two points or less are either eliminated
-  // or converted to lines or points if enabled
-  if ( !this->GetAbortExecute() && inPolys->GetNumberOfCells() > 0 )
+  // Copy the cell data (in parallel if all arrays can be).
+  outCD->CopyAllocate(inCD, numNewCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numNewCells, inCD, outCD, 0.0, false);
+  if ( cellArrays.GetNumberOfArrays() == outCD->GetNumberOfArrays() )
   {
-    newPolys = vtkCellArray::New();
-    newPolys->Allocate(inPolys->GetSize());
-    outPolyData = vtkCellData::New();
-    outPolyData->CopyAllocate(inCD);
-
-    vtkDebugMacro(<<"Starting Polys "<<inCellID);
-    for (inPolys->InitTraversal(); inPolys->GetNextCell(npts,pts); inCellID++)
-    {
-      for ( numCellPts=0, i=0; i<npts; i++ )
-      {
-        ptId = pointMap[pts[i]];
-        updatedPts[numCellPts++] = ptId;
-      } //for points in cell
-
-      if ( numCellPts>2 && updatedPts[0] == updatedPts[numCellPts-1] )
-      {
-        numCellPts--;
-      }
-      if ( (numCellPts > 2) || !this->ConvertPolysToLines )
-      {
-        newId = newPolys->InsertNextCell(numCellPts,updatedPts);
-        outPolyData->CopyData(inCD, inCellID, newId);
-        if (polyIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Poly ID fault in poly test");
-        }
-        polyIDcounter++;
-      }
-      else if ( (numCellPts==2) || !this->ConvertLinesToPoints )
-      {
-        if (!newLines)
-        {
-          newLines = vtkCellArray::New();
-          newLines->Allocate(5);
-          outLineData = vtkCellData::New();
-          outLineData->CopyAllocate(inCD);
-        }
-        newId = newLines->InsertNextCell(numCellPts,updatedPts);
-        outLineData->CopyData(inCD, inCellID, newId);
-        if (lineIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Line ID fault in poly test");
-        }
-        lineIDcounter++;
-      }
-      else if ( numCellPts==1 )
-      {
-        if (!newVerts)
-        {
-          newVerts = vtkCellArray::New();
-          newVerts->Allocate(5);
-        }
-        newId = newVerts->InsertNextCell(numCellPts,updatedPts);
-        outCD->CopyData(inCD, inCellID, newId);
-        if (vertIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Vertex ID fault in poly test");
-        }
-        vertIDcounter++;
-      }
-    }
-    vtkDebugMacro(<<"Removed "
-           << inPolys->GetNumberOfCells() - newPolys->GetNumberOfCells()
-           << " polys");
+    CopyCellData copyCD{ &cellArrays, cellMap.data() };
+    vtkSMPTools::For(0, numNewCells, copyCD);
   }
-  this->UpdateProgress(0.75);
-
-  // triangle strips can reduced to polys/lines/points etc
-  if ( !this->GetAbortExecute() && inStrips->GetNumberOfCells() > 0 )
+  else
   {
-    newStrips = vtkCellArray::New();
-    newStrips->Allocate(inStrips->GetSize());
-    outStrpData = vtkCellData::New();
-    outStrpData->CopyAllocate(inCD);
-
-    for (inStrips->InitTraversal(); inStrips->GetNextCell(npts,pts);
-         inCellID++)
+    for (vtkIdType cellId=0; cellId < numNewCells; ++cellId)
     {
-      for ( numCellPts=0, i=0; i < npts; i++ )
-      {
-        ptId = pointMap[pts[i]];
-        updatedPts[numCellPts++] = ptId;
-      }
-      if ( (numCellPts > 3) || !this->ConvertStripsToPolys )
-      {
-        newId = newStrips->InsertNextCell(numCellPts,updatedPts);
-        outStrpData->CopyData(inCD, inCellID, newId);
-        if (strpIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Strip ID fault in strip test");
-        }
-        strpIDcounter++;
-      }
-      else if ( (numCellPts==3) || !this->ConvertPolysToLines )
-      {
-        if (!newPolys)
-        {
-          newPolys = vtkCellArray::New();
-          newPolys->Allocate(5);
-          outPolyData = vtkCellData::New();
-          outPolyData->CopyAllocate(inCD);
-        }
-        newId = newPolys->InsertNextCell(numCellPts,updatedPts);
-        outPolyData->CopyData(inCD, inCellID, newId);
-        if (polyIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Poly ID fault in strip test");
-        }
-        polyIDcounter++;
-      }
-      else if ( (numCellPts==2) || !this->ConvertLinesToPoints )
-      {
-        if (!newLines)
-        {
-          newLines = vtkCellArray::New();
-          newLines->Allocate(5);
-          outLineData = vtkCellData::New();
-          outLineData->CopyAllocate(inCD);
-        }
-        newId = newLines->InsertNextCell(numCellPts,updatedPts);
-        outLineData->CopyData(inCD, inCellID, newId);
-        if (lineIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Line ID fault in strip test");
-        }
-        lineIDcounter++;
-      }
-      else if ( numCellPts==1 )
-      {
-        if (!newVerts)
-        {
-          newVerts = vtkCellArray::New();
-          newVerts->Allocate(5);
-        }
-        newId = newVerts->InsertNextCell(numCellPts,updatedPts);
-        outCD->CopyData(inCD, inCellID, newId);
-        if (vertIDcounter!=newId)
-        {
-          vtkErrorMacro(<<"Vertex ID fault in strip test");
-        }
-        vertIDcounter++;
-      }
+      outCD->CopyData(inCD, cellMap[cellId], cellId);
     }
-    vtkDebugMacro(<<"Removed "
-              << inStrips->GetNumberOfCells() - newStrips->GetNumberOfCells()
-              << " strips");
   }
 
-  vtkDebugMacro(<<"Removed "
-                << numNewPts - newPts->GetNumberOfPoints() << " points");
-
   // Update ourselves and release memory
   //
   this->Locator->Initialize(); //release memory.
-  delete [] updatedPts;
-  delete [] pointMap;
-
-  // Now transfer all CellData from Lines/Polys/Strips into final
-  // Cell data output
-  vtkIdType combinedCellID = vertIDcounter;
-  if (newLines)
-  {
-    for (i=0; i<lineIDcounter; ++i, ++combinedCellID)
-    {
-      outCD->CopyData(outLineData, i, combinedCellID);
-    }
-    outLineData->Delete();
-  }
-  if (newPolys)
-  {
-    for (i=0; i<polyIDcounter; ++i, ++combinedCellID)
-    {
-      outCD->CopyData(outPolyData, i, combinedCellID);
-    }
-    outPolyData->Delete();
-  }
-  if (newStrips)
-  {
-    for (i=0; i<strpIDcounter;++ i, ++combinedCellID)
-    {
-      outCD->CopyData(outStrpData, i, combinedCellID);
-    }
-    outStrpData->Delete();
-  }
 
   output->SetPoints(newPts);
   newPts->Delete();
-  if (newVerts)
-  {
-    output->SetVerts(newVerts);
-    newVerts->Delete();
-  }
-  if (newLines)
+  for (int type=0; type < 4; ++type)
   {
-    output->SetLines(newLines);
-    newLines->Delete();
-  }
-  if (newPolys)
-  {
-    output->SetPolys(newPolys);
-    newPolys->Delete();
-  }
-  if (newStrips)
-  {
-    output->SetStrips(newStrips);
-    newStrips->Delete();
+    if ( numCells[type] > 0 )
+    {
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(offsets[type], conn[type]);
+      switch (type)
+      {
+        case VERTS:
+          output->SetVerts(cells);
+          break;
+        case LINES:
+          output->SetLines(cells);
+          break;
+        case POLYS:
+          output->SetPolys(cells);
+          break;
+        default:
+          output->SetStrips(cells);
+      }
+    }
   }
 
   return 1;
@@ -613,6 +610,8 @@ void vtkStaticCleanPolyData::PrintSelf(ostream& os, vtkIndent indent)
      << (this->ConvertLinesToPoints ? "On\n" : "Off\n");
   os << indent << "ConvertStripsToPolys: "
      << (this->ConvertStripsToPolys ? "On\n" : "Off\n");
+  os << indent << "RemoveDuplicateCellPoints: "
+     << (this->RemoveDuplicateCellPoints ? "On\n" : "Off\n");
   if ( this->Locator )
   {
     os << indent << "Locator: " << this->Locator << "\n";
@@ -36,8 +36,13 @@
  *
  * Internally this class uses vtkStaticPointLocator, which is a threaded, and
  * much faster locator than the incremental locators that vtkCleanPolyData
- * uses. Note because of these and other differences, the output of this
- * filter may be different than vtkCleanPolyData.
+ * uses. The points and cells are also copied in parallel, into the output a
+ * sequential execution gives: each output point has the coordinates and
+ * point data of the last (highest id) input point merged into it. By
+ * default the cells keep all their merged point ids (only the closing point
+ * of polygons is removed); see RemoveDuplicateCellPoints. Note because of
+ * these and other differences, the output of this filter may be different
+ * than vtkCleanPolyData.
  *
  * Note that if you want to remove points that aren't used by any cells
  * (i.e., disable point merging), then use vtkCleanPolyData.
@@ -50,8 +55,10 @@
  * @warning
  * Merging close points with tolerance >0.0 is inherently an unstable problem
  * because the results are order dependent (e.g., the order in which points
- * are processed). When parallel computing, the order of processing points is
- * unpredictable, hence the results may vary between runs.
+ * are processed). Points are merged as if they were processed in the order
+ * of their ids (each point is merged to the lowest id point within the
+ * tolerance that is kept), so that the results do not vary between runs or
+ * with the number of threads.
  *
  * @warning
  * If you wish to operate on a set of coordinates that has no cells, you must
@@ -142,6 +149,19 @@ public:
   vtkGetMacro(ConvertStripsToPolys,vtkTypeBool);
   //@}
 
+  //@{
+  /**
+   * Turn on/off the removal of the consecutive duplicate point ids that
+   * merging leaves in lines, polygons and strips, before the conversions of
+   * degenerate cells. For example, a triangle with two merged points then
+   * becomes a line (if ConvertPolysToLines). Vertices are left unchanged.
+   * Default is Off, so that the cells are output as in earlier versions.
+   */
+  vtkSetMacro(RemoveDuplicateCellPoints,vtkTypeBool);
+  vtkBooleanMacro(RemoveDuplicateCellPoints,vtkTypeBool);
+  vtkGetMacro(RemoveDuplicateCellPoints,vtkTypeBool);
+  //@}
+
   // This filter is difficult to stream.
   // To get invariant results, the whole input must be processed at once.
   // This flag allows the user to select whether strict piece invariance
@@ -189,6 +209,7 @@ protected:
   vtkTypeBool ConvertLinesToPoints;
   vtkTypeBool ConvertPolysToLines;
   vtkTypeBool ConvertStripsToPolys;
+  vtkTypeBool RemoveDuplicateCellPoints;
   vtkTypeBool ToleranceIsAbsolute;
   vtkStaticPointLocator *Locator;
 
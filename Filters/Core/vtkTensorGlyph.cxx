@@ -16,21 +16,419 @@
 
 
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCell.h"
 #include "vtkCellArray.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
 #include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTransform.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkTensorGlyph);
 
+//----------------------------------------------------------------------------
+namespace
+{
+// When the cells of the source are all of the same kind, the glyphs are
+// generated in parallel. Each input point has numDirs glyphs, so every
+// glyph goes to a location known in advance and the points, cells and
+// attributes are written directly into preallocated arrays. Each thread
+// composes the glyph transformations with its own vtkTransform, with the
+// same operations as the serial path, so the output is the same.
+
+// The source of the glyphs, converted once for all the glyphs.
+struct TensorGlyphSource
+{
+  vtkIdType NumberOfPoints;
+  std::vector<double> Points;
+  std::vector<double> Normals; // empty if the source has no normals
+  bool NormalizeInDouble;
+  // The cells, which are all of the same kind: verts (0), lines (1),
+  // polys (2) or strips (3).
+  int CellCategory;
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> Connectivity;
+};
+
+// The type vtkPolyData::BuildCells() gives to a cell of a category.
+int GetBuiltCellType(int category, vtkIdType npts)
+{
+  switch (category)
+  {
+    case 0:
+      return npts > 1 ? VTK_POLY_VERTEX : VTK_VERTEX;
+    case 1:
+      return npts > 2 ? VTK_POLY_LINE : VTK_LINE;
+    case 2:
+      return npts == 3 ? VTK_TRIANGLE : (npts == 4 ? VTK_QUAD : VTK_POLYGON);
+    default:
+      return VTK_TRIANGLE_STRIP;
+  }
+}
+
+// Convert the source for parallel glyphing. Return false if the source
+// cannot be glyphed in parallel: its cells are not all of the same kind, or
+// their types are not the types vtkPolyData::BuildCells() would give them,
+// or its normals do not match its points.
+bool BuildTensorGlyphSource(vtkPolyData *source, TensorGlyphSource &glyphSource)
+{
+  vtkCellArray *categories[4] = { source->GetVerts(), source->GetLines(),
+                                  source->GetPolys(), source->GetStrips() };
+  glyphSource.CellCategory = -1;
+  for (int i = 0; i < 4; ++i)
+  {
+    if (categories[i]->GetNumberOfCells() > 0)
+    {
+      if (glyphSource.CellCategory >= 0)
+      {
+        return false;
+      }
+      glyphSource.CellCategory = i;
+    }
+  }
+
+  const vtkIdType numPts = source->GetNumberOfPoints();
+  vtkDataArray *normals = source->GetPointData()->GetNormals();
+  if (normals && normals->GetNumberOfTuples() != numPts)
+  {
+    return false;
+  }
+
+  // The cells, in the order vtkPolyData::GetCellPoints() gives them.
+  const vtkIdType numCells = source->GetNumberOfCells();
+  vtkNew<vtkIdList> cellPts;
+  glyphSource.Offsets.resize(numCells + 1);
+  glyphSource.Connectivity.clear();
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    source->GetCellPoints(cellId, cellPts);
+    vtkIdType npts = cellPts->GetNumberOfIds();
+    if (source->GetCellType(cellId) !=
+        GetBuiltCellType(glyphSource.CellCategory, npts))
+    {
+      return false;
+    }
+    glyphSource.Offsets[cellId] = glyphSource.Connectivity.size();
+    glyphSource.Connectivity.insert(glyphSource.Connectivity.end(),
+      cellPts->GetPointer(0), cellPts->GetPointer(0) + npts);
+  }
+  glyphSource.Offsets[numCells] = glyphSource.Connectivity.size();
+
+  glyphSource.NumberOfPoints = numPts;
+  glyphSource.Points.resize(3 * numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    source->GetPoint(i, glyphSource.Points.data() + 3 * i);
+  }
+
+  glyphSource.Normals.clear();
+  glyphSource.NormalizeInDouble = false;
+  if (normals)
+  {
+    glyphSource.Normals.resize(3 * numPts);
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      normals->GetTuple(i, glyphSource.Normals.data() + 3 * i);
+    }
+    glyphSource.NormalizeInDouble = normals->GetDataType() != VTK_FLOAT &&
+      normals->GetDataType() != VTK_DOUBLE;
+  }
+  return true;
+}
+
+// Generate the glyphs of a range of input points.
+struct TensorGlyphGenerator
+{
+  // The input and the filter parameters
+  vtkDataSet *Input;
+  vtkDataArray *Tensors;
+  vtkDataArray *Scalars; // when colored by scalars
+  int NumberOfDirections;
+  bool ThreeGlyphs;
+  bool ExtractEigenvalues;
+  bool ClampScaling;
+  bool ColorByEigenvalues;
+  double ScaleFactor;
+  double MaxScaleFactor;
+  double Length;
+  const TensorGlyphSource *Source;
+
+  // The output
+  float *NewPoints;
+  float *NewNormals;
+  float *NewScalars;
+  vtkIdType *Offsets;
+  vtkIdType *Connectivity;
+  ArrayList *PointData; // null if the point data are not copied in parallel
+
+  vtkSMPThreadLocalObject<vtkTransform> Transform;
+
+  void operator()(vtkIdType inPtId, vtkIdType endPtId)
+  {
+    const TensorGlyphSource &source = *this->Source;
+    const vtkIdType numSourcePts = source.NumberOfPoints;
+    const vtkIdType numSourceCells =
+      static_cast<vtkIdType>(source.Offsets.size()) - 1;
+    const vtkIdType connSize = source.Connectivity.size();
+    const int numDirs = this->NumberOfDirections;
+    vtkTransform *trans = this->Transform.Local();
+    trans->PreMultiply();
+
+    double tensor[9], x[3], elements[16], matrix[16], normalMatrix[16];
+    double *m[3], w[3], *v[3];
+    double m0[3], m1[3], m2[3];
+    double v0[3], v1[3], v2[3];
+    double xv[3], yv[3], zv[3];
+    double maxScale;
+    m[0] = m0; m[1] = m1; m[2] = m2;
+    v[0] = v0; v[1] = v1; v[2] = v2;
+    vtkMatrix4x4::Identity(elements);
+
+    for ( ; inPtId < endPtId; ++inPtId)
+    {
+      // Copy all topology (transformation independent)
+      for (vtkIdType cellId = 0; cellId < numSourceCells; ++cellId)
+      {
+        const vtkIdType *cellPts =
+          source.Connectivity.data() + source.Offsets[cellId];
+        const vtkIdType npts =
+          source.Offsets[cellId + 1] - source.Offsets[cellId];
+        vtkIdType outCellId = (inPtId * numSourceCells + cellId) * numDirs;
+        vtkIdType offset = numDirs * (inPtId * connSize + source.Offsets[cellId]);
+        for (int dir = 0; dir < numDirs; ++dir, ++outCellId, offset += npts)
+        {
+          const vtkIdType subIncr = (numDirs * inPtId + dir) * numSourcePts;
+          this->Offsets[outCellId] = offset;
+          for (vtkIdType i = 0; i < npts; ++i)
+          {
+            this->Connectivity[offset + i] = cellPts[i] + subIncr;
+          }
+        }
+      }
+
+      // Symmetric tensor support
+      this->Tensors->GetTuple(inPtId, tensor);
+      if (this->Tensors->GetNumberOfComponents() == 6)
+      {
+        vtkMath::TensorFromSymmetricTensor(tensor);
+      }
+
+      // compute orientation vectors and scale factors from tensor
+      if (this->ExtractEigenvalues) // extract appropriate eigenfunctions
+      {
+        for (int j = 0; j < 3; j++)
+        {
+          for (int i = 0; i < 3; i++)
+          {
+            m[i][j] = 0.5 * (tensor[i + 3 * j] + tensor[j + 3 * i]);
+          }
+        }
+        vtkMath::Jacobi(m, w, v);
+
+        //copy eigenvectors
+        xv[0] = v[0][0]; xv[1] = v[1][0]; xv[2] = v[2][0];
+        yv[0] = v[0][1]; yv[1] = v[1][1]; yv[2] = v[2][1];
+        zv[0] = v[0][2]; zv[1] = v[1][2]; zv[2] = v[2][2];
+      }
+      else //use tensor columns as eigenvectors
+      {
+        for (int i = 0; i < 3; i++)
+        {
+          xv[i] = tensor[i];
+          yv[i] = tensor[i + 3];
+          zv[i] = tensor[i + 6];
+        }
+        w[0] = vtkMath::Normalize(xv);
+        w[1] = vtkMath::Normalize(yv);
+        w[2] = vtkMath::Normalize(zv);
+      }
+
+      // compute scale factors
+      w[0] *= this->ScaleFactor;
+      w[1] *= this->ScaleFactor;
+      w[2] *= this->ScaleFactor;
+
+      if (this->ClampScaling)
+      {
+        maxScale = 0.0;
+        for (int i = 0; i < 3; i++)
+        {
+          if (maxScale < fabs(w[i]))
+          {
+            maxScale = fabs(w[i]);
+          }
+        }
+        if (maxScale > this->MaxScaleFactor)
+        {
+          maxScale = this->MaxScaleFactor / maxScale;
+          for (int i = 0; i < 3; i++)
+          {
+            w[i] *= maxScale; //preserve overall shape of glyph
+          }
+        }
+      }
+
+      // make sure scale is okay (non-zero) and scale data
+      maxScale = 0.0;
+      for (int i = 0; i < 3; i++)
+      {
+        if (w[i] > maxScale)
+        {
+          maxScale = w[i];
+        }
+      }
+      if (maxScale == 0.0)
+      {
+        maxScale = 1.0;
+      }
+      for (int i = 0; i < 3; i++)
+      {
+        if (w[i] == 0.0)
+        {
+          w[i] = maxScale * 1.0e-06;
+        }
+      }
+
+      // normalized eigenvectors rotate object for eigen direction 0
+      elements[0] = xv[0];
+      elements[1] = yv[0];
+      elements[2] = zv[0];
+      elements[4] = xv[1];
+      elements[5] = yv[1];
+      elements[6] = zv[1];
+      elements[8] = xv[2];
+      elements[9] = yv[2];
+      elements[10] = zv[2];
+      this->Input->GetPoint(inPtId, x);
+
+      // Now do the real work for each "direction"
+      for (int dir = 0; dir < numDirs; dir++)
+      {
+        int eigen_dir = dir % (this->ThreeGlyphs ? 3 : 1);
+        int symmetric_dir = dir / (this->ThreeGlyphs ? 3 : 1);
+        const vtkIdType ptIncr = (numDirs * inPtId + dir) * numSourcePts;
+
+        trans->Identity();
+        trans->Translate(x[0], x[1], x[2]);
+        trans->Concatenate(elements);
+        if (eigen_dir == 1)
+        {
+          trans->RotateZ(90.0);
+        }
+        if (eigen_dir == 2)
+        {
+          trans->RotateY(-90.0);
+        }
+        if (this->ThreeGlyphs)
+        {
+          trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+        }
+        else
+        {
+          trans->Scale(w[0], w[1], w[2]);
+        }
+        // Mirror second set to the symmetric position
+        if (symmetric_dir == 1)
+        {
+          trans->Scale(-1., 1., 1.);
+        }
+        // if the eigenvalue is negative, shift to reverse direction.
+        if (w[eigen_dir] < 0 && numDirs > 1)
+        {
+          trans->Translate(-this->Length, 0., 0.);
+        }
+
+        // multiply points (and normals if available) by resulting matrix
+        vtkMatrix4x4::DeepCopy(matrix, trans->GetMatrix());
+        const double *in = source.Points.data();
+        float *out = this->NewPoints + 3 * ptIncr;
+        for (vtkIdType i = 0; i < numSourcePts; ++i, in += 3, out += 3)
+        {
+          out[0] = static_cast<float>(matrix[0] * in[0] + matrix[1] * in[1] +
+                                      matrix[2] * in[2] + matrix[3]);
+          out[1] = static_cast<float>(matrix[4] * in[0] + matrix[5] * in[1] +
+                                      matrix[6] * in[2] + matrix[7]);
+          out[2] = static_cast<float>(matrix[8] * in[0] + matrix[9] * in[1] +
+                                      matrix[10] * in[2] + matrix[11]);
+        }
+
+        if (this->NewNormals)
+        {
+          // a negative determinant means the transform turns the glyph
+          // surface inside out: flip the normals to point outward.
+          if (vtkMatrix4x4::Determinant(matrix) < 0)
+          {
+            trans->Scale(-1.0, -1.0, -1.0);
+            vtkMatrix4x4::DeepCopy(matrix, trans->GetMatrix());
+          }
+          // normals are transformed by the transposed inverse matrix
+          vtkMatrix4x4::DeepCopy(normalMatrix, matrix);
+          vtkMatrix4x4::Invert(normalMatrix, normalMatrix);
+          vtkMatrix4x4::Transpose(normalMatrix, normalMatrix);
+          const double *n = normalMatrix;
+          in = source.Normals.data();
+          out = this->NewNormals + 3 * ptIncr;
+          for (vtkIdType i = 0; i < numSourcePts; ++i, in += 3, out += 3)
+          {
+            if (source.NormalizeInDouble)
+            {
+              double normal[3] = {
+                n[0] * in[0] + n[1] * in[1] + n[2] * in[2],
+                n[4] * in[0] + n[5] * in[1] + n[6] * in[2],
+                n[8] * in[0] + n[9] * in[1] + n[10] * in[2] };
+              vtkMath::Normalize(normal);
+              out[0] = static_cast<float>(normal[0]);
+              out[1] = static_cast<float>(normal[1]);
+              out[2] = static_cast<float>(normal[2]);
+            }
+            else
+            {
+              out[0] = static_cast<float>(n[0] * in[0] + n[1] * in[1] +
+                                          n[2] * in[2]);
+              out[1] = static_cast<float>(n[4] * in[0] + n[5] * in[1] +
+                                          n[6] * in[2]);
+              out[2] = static_cast<float>(n[8] * in[0] + n[9] * in[1] +
+                                          n[10] * in[2]);
+              vtkMath::Normalize(out);
+            }
+          }
+        }
+
+        // Copy point data from source
+        if (this->NewScalars)
+        {
+          float s = static_cast<float>(this->ColorByEigenvalues ?
+            w[eigen_dir] : this->Scalars->GetComponent(inPtId, 0));
+          std::fill_n(this->NewScalars + ptIncr, numSourcePts, s);
+        }
+        else if (this->PointData)
+        {
+          for (vtkIdType i = 0; i < numSourcePts; ++i)
+          {
+            this->PointData->Copy(i, ptIncr + i);
+          }
+        }
+      }
+    }
+  }
+};
+
+}
+
 // Construct object with scaling on and scale factor 1.0. Eigenvalues are
 // extracted, glyphs are colored with input scalar data, and logarithmic
 // scaling is turned off.
@@ -233,233 +631,329 @@ int vtkTensorGlyph::RequestData(
     newNormals->SetName("Normals");
     newNormals->Allocate(numDirs*3*numPts*numSourcePts);
   }
-  //
-  // First copy all topology (transformation independent)
-  //
-  for (inPtId=0; inPtId < numPts; inPtId++)
+  // With a source whose cells are all of the same kind, the glyphs are
+  // generated in parallel, directly into the preallocated output.
+  TensorGlyphSource glyphSource;
+  if ( BuildTensorGlyphSource(source, glyphSource) )
   {
-    ptIncr = numDirs * inPtId * numSourcePts;
-    for (cellId=0; cellId < numSourceCells; cellId++)
+    const vtkIdType numOutPts = numDirs * numPts * numSourcePts;
+    const vtkIdType numOutCells = numDirs * numPts * numSourceCells;
+    const vtkIdType connSize = glyphSource.Connectivity.size();
+    newPts->SetNumberOfPoints(numOutPts);
+    if ( newScalars )
     {
-      cell = this->GetSource()->GetCell(cellId);
-      cellPts = cell->GetPointIds();
-      npts = cellPts->GetNumberOfIds();
-      for (dir=0; dir < numDirs; dir++)
-      {
-        // This variable may be removed, but that
-        // will not improve readability
-        subIncr = ptIncr + dir*numSourcePts;
-        for (i=0; i < npts; i++)
-        {
-          pts[i] = cellPts->GetId(i) + subIncr;
-        }
-        output->InsertNextCell(cell->GetCellType(),npts,pts);
-      }
+      newScalars->SetNumberOfTuples(numOutPts);
     }
-  }
-  //
-  // Traverse all Input points, transforming glyph at Source points
-  //
-  trans->PreMultiply();
-
-  for (inPtId=0; inPtId < numPts; inPtId++)
-  {
-    ptIncr = numDirs * inPtId * numSourcePts;
-
-    // Translation is postponed
-    // Symmetric tensor support
-    inTensors->GetTuple(inPtId, tensor);
-    if (inTensors->GetNumberOfComponents() == 6)
+    if ( newNormals )
     {
-      vtkMath::TensorFromSymmetricTensor(tensor);
+      newNormals->SetNumberOfTuples(numOutPts);
     }
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfValues(numOutCells + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(numDirs * numPts * connSize);
 
-    // compute orientation vectors and scale factors from tensor
-    if ( this->ExtractEigenvalues ) // extract appropriate eigenfunctions
-    {
-      // We are interested in the symmetrical part of the tensor only, since
-      // eigenvalues are real if and only if the matrice of reals is symmetrical
-      for (j=0; j<3; j++)
-      {
-        for (i=0; i<3; i++)
-        {
-          m[i][j] = 0.5 * (tensor[i + 3 * j] + tensor[j + 3 * i]);
-        }
-      }
-      vtkMath::Jacobi(m, w, v);
-
-      //copy eigenvectors
-      xv[0] = v[0][0]; xv[1] = v[1][0]; xv[2] = v[2][0];
-      yv[0] = v[0][1]; yv[1] = v[1][1]; yv[2] = v[2][1];
-      zv[0] = v[0][2]; zv[1] = v[1][2]; zv[2] = v[2][2];
-    }
-    else //use tensor columns as eigenvectors
+    // The source scalars are copied in parallel unless they cannot be (for
+    // example a bit array).
+    ArrayList pointArrays;
+    bool copyPointData = false;
+    if ( !newScalars )
     {
-      for (i=0; i<3; i++)
-      {
-        xv[i] = tensor[i];
-        yv[i] = tensor[i+3];
-        zv[i] = tensor[i+6];
-      }
-      w[0] = vtkMath::Normalize(xv);
-      w[1] = vtkMath::Normalize(yv);
-      w[2] = vtkMath::Normalize(zv);
+      pointArrays.AddArrays(numOutPts, pd, outPD, 0.0, false);
+      copyPointData =
+        (pointArrays.GetNumberOfArrays() == outPD->GetNumberOfArrays());
     }
 
-    // compute scale factors
-    w[0] *= this->ScaleFactor;
-    w[1] *= this->ScaleFactor;
-    w[2] *= this->ScaleFactor;
+    TensorGlyphGenerator generator;
+    generator.Input = input;
+    generator.Tensors = inTensors;
+    generator.Scalars = inScalars;
+    generator.NumberOfDirections = numDirs;
+    generator.ThreeGlyphs = this->ThreeGlyphs != 0;
+    generator.ExtractEigenvalues = this->ExtractEigenvalues != 0;
+    generator.ClampScaling = this->ClampScaling != 0;
+    generator.ColorByEigenvalues =
+      (this->ColorMode == COLOR_BY_EIGENVALUES);
+    generator.ScaleFactor = this->ScaleFactor;
+    generator.MaxScaleFactor = this->MaxScaleFactor;
+    generator.Length = this->Length;
+    generator.Source = &glyphSource;
+    generator.NewPoints = static_cast<float *>(newPts->GetVoidPointer(0));
+    generator.NewNormals = (newNormals ? newNormals->GetPointer(0) : nullptr);
+    generator.NewScalars = (newScalars ? newScalars->GetPointer(0) : nullptr);
+    generator.Offsets = offsets->GetPointer(0);
+    generator.Connectivity = connectivity->GetPointer(0);
+    generator.PointData = (copyPointData ? &pointArrays : nullptr);
 
-    if ( this->ClampScaling )
+    // Some datasets build their structures on the first call to GetPoint().
+    input->GetPoint(0, x);
+    vtkSMPTools::For(0, numPts, generator);
+    offsets->SetValue(numOutCells, numDirs * numPts * connSize);
+
+    // Copy the source scalars if they could not be copied in parallel.
+    if ( !newScalars && !copyPointData )
     {
-      for (maxScale=0.0, i=0; i<3; i++)
-      {
-        if ( maxScale < fabs(w[i]) )
-        {
-          maxScale = fabs(w[i]);
-        }
-      }
-      if ( maxScale > this->MaxScaleFactor )
+      for (ptIncr=0; ptIncr < numOutPts; ptIncr += numSourcePts)
       {
-        maxScale = this->MaxScaleFactor / maxScale;
-        for (i=0; i<3; i++)
+        for (i=0; i < numSourcePts; i++)
         {
-          w[i] *= maxScale; //preserve overall shape of glyph
+          outPD->CopyData(pd,i,ptIncr+i);
         }
       }
     }
 
-    // normalization is postponed
-
-    // make sure scale is okay (non-zero) and scale data
-    for (maxScale=0.0, i=0; i<3; i++)
+    if ( numSourceCells > 0 )
     {
-      if ( w[i] > maxScale )
+      cells = vtkCellArray::New();
+      cells->SetData(offsets, connectivity);
+      switch ( glyphSource.CellCategory )
       {
-        maxScale = w[i];
+        case 0:
+          output->SetVerts(cells);
+          break;
+        case 1:
+          output->SetLines(cells);
+          break;
+        case 2:
+          output->SetPolys(cells);
+          break;
+        default:
+          output->SetStrips(cells);
       }
+      cells->Delete();
+      output->BuildCells();
     }
-    if ( maxScale == 0.0 )
-    {
-      maxScale = 1.0;
-    }
-    for (i=0; i<3; i++)
+  }
+  else
+  {
+    //
+    // First copy all topology (transformation independent)
+    //
+    for (inPtId=0; inPtId < numPts; inPtId++)
     {
-      if ( w[i] == 0.0 )
+      ptIncr = numDirs * inPtId * numSourcePts;
+      for (cellId=0; cellId < numSourceCells; cellId++)
       {
-        w[i] = maxScale * 1.0e-06;
+        cell = this->GetSource()->GetCell(cellId);
+        cellPts = cell->GetPointIds();
+        npts = cellPts->GetNumberOfIds();
+        for (dir=0; dir < numDirs; dir++)
+        {
+          // This variable may be removed, but that
+          // will not improve readability
+          subIncr = ptIncr + dir*numSourcePts;
+          for (i=0; i < npts; i++)
+          {
+            pts[i] = cellPts->GetId(i) + subIncr;
+          }
+          output->InsertNextCell(cell->GetCellType(),npts,pts);
+        }
       }
     }
+    //
+    // Traverse all Input points, transforming glyph at Source points
+    //
+    trans->PreMultiply();
 
-    // Now do the real work for each "direction"
-
-    for (dir=0; dir < numDirs; dir++)
+    for (inPtId=0; inPtId < numPts; inPtId++)
     {
-      eigen_dir = dir%(this->ThreeGlyphs?3:1);
-      symmetric_dir = dir/(this->ThreeGlyphs?3:1);
-
-      // Remove previous scales ...
-      trans->Identity();
-
-      // translate Source to Input point
-      input->GetPoint(inPtId, x);
-      trans->Translate(x[0], x[1], x[2]);
+      ptIncr = numDirs * inPtId * numSourcePts;
 
-      // normalized eigenvectors rotate object for eigen direction 0
-      matrix->Element[0][0] = xv[0];
-      matrix->Element[0][1] = yv[0];
-      matrix->Element[0][2] = zv[0];
-      matrix->Element[1][0] = xv[1];
-      matrix->Element[1][1] = yv[1];
-      matrix->Element[1][2] = zv[1];
-      matrix->Element[2][0] = xv[2];
-      matrix->Element[2][1] = yv[2];
-      matrix->Element[2][2] = zv[2];
-      trans->Concatenate(matrix);
-
-      if (eigen_dir == 1)
+      // Translation is postponed
+      // Symmetric tensor support
+      inTensors->GetTuple(inPtId, tensor);
+      if (inTensors->GetNumberOfComponents() == 6)
       {
-        trans->RotateZ(90.0);
+        vtkMath::TensorFromSymmetricTensor(tensor);
       }
 
-      if (eigen_dir == 2)
+      // compute orientation vectors and scale factors from tensor
+      if ( this->ExtractEigenvalues ) // extract appropriate eigenfunctions
       {
-        trans->RotateY(-90.0);
-      }
+        // We are interested in the symmetrical part of the tensor only, since
+        // eigenvalues are real if and only if the matrice of reals is symmetrical
+        for (j=0; j<3; j++)
+        {
+          for (i=0; i<3; i++)
+          {
+            m[i][j] = 0.5 * (tensor[i + 3 * j] + tensor[j + 3 * i]);
+          }
+        }
+        vtkMath::Jacobi(m, w, v);
 
-      if (this->ThreeGlyphs)
-      {
-        trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+        //copy eigenvectors
+        xv[0] = v[0][0]; xv[1] = v[1][0]; xv[2] = v[2][0];
+        yv[0] = v[0][1]; yv[1] = v[1][1]; yv[2] = v[2][1];
+        zv[0] = v[0][2]; zv[1] = v[1][2]; zv[2] = v[2][2];
       }
-      else
+      else //use tensor columns as eigenvectors
       {
-        trans->Scale(w[0], w[1], w[2]);
+        for (i=0; i<3; i++)
+        {
+          xv[i] = tensor[i];
+          yv[i] = tensor[i+3];
+          zv[i] = tensor[i+6];
+        }
+        w[0] = vtkMath::Normalize(xv);
+        w[1] = vtkMath::Normalize(yv);
+        w[2] = vtkMath::Normalize(zv);
       }
 
-      // Mirror second set to the symmetric position
-      if (symmetric_dir == 1)
-      {
-        trans->Scale(-1.,1.,1.);
-      }
+      // compute scale factors
+      w[0] *= this->ScaleFactor;
+      w[1] *= this->ScaleFactor;
+      w[2] *= this->ScaleFactor;
 
-      // if the eigenvalue is negative, shift to reverse direction.
-      // The && is there to ensure that we do not change the
-      // old behaviour of vtkTensorGlyphs (which only used one dir),
-      // in case there is an oriented glyph, e.g. an arrow.
-      if (w[eigen_dir] < 0 && numDirs > 1)
+      if ( this->ClampScaling )
       {
-        trans->Translate(-this->Length, 0., 0.);
+        for (maxScale=0.0, i=0; i<3; i++)
+        {
+          if ( maxScale < fabs(w[i]) )
+          {
+            maxScale = fabs(w[i]);
+          }
+        }
+        if ( maxScale > this->MaxScaleFactor )
+        {
+          maxScale = this->MaxScaleFactor / maxScale;
+          for (i=0; i<3; i++)
+          {
+            w[i] *= maxScale; //preserve overall shape of glyph
+          }
+        }
       }
 
-      // multiply points (and normals if available) by resulting
-      // matrix
-      trans->TransformPoints(sourcePts,newPts);
+      // normalization is postponed
 
-      // Apply the transformation to a series of points,
-      // and append the results to outPts.
-      if ( newNormals )
+      // make sure scale is okay (non-zero) and scale data
+      for (maxScale=0.0, i=0; i<3; i++)
       {
-        // a negative determinant means the transform turns the
-        // glyph surface inside out, and its surface normals all
-        // point inward. The following scale corrects the surface
-        // normals to point outward.
-        if (trans->GetMatrix()->Determinant() < 0)
+        if ( w[i] > maxScale )
         {
-          trans->Scale(-1.0,-1.0,-1.0);
+          maxScale = w[i];
         }
-        trans->TransformNormals(sourceNormals,newNormals);
       }
-
-        // Copy point data from source
-      if ( this->ColorGlyphs && inScalars &&
-           (this->ColorMode == COLOR_BY_SCALARS) )
+      if ( maxScale == 0.0 )
       {
-        s = inScalars->GetComponent(inPtId, 0);
-        for (i=0; i < numSourcePts; i++)
-        {
-          newScalars->InsertTuple(ptIncr+i, &s);
-        }
+        maxScale = 1.0;
       }
-      else if (this->ColorGlyphs &&
-               (this->ColorMode == COLOR_BY_EIGENVALUES) )
+      for (i=0; i<3; i++)
       {
-        // If ThreeGlyphs is false we use the first (largest)
-        // eigenvalue as scalar.
-        s = w[eigen_dir];
-        for (i=0; i < numSourcePts; i++)
+        if ( w[i] == 0.0 )
         {
-          newScalars->InsertTuple(ptIncr+i, &s);
+          w[i] = maxScale * 1.0e-06;
         }
       }
-      else
+
+      // Now do the real work for each "direction"
+
+      for (dir=0; dir < numDirs; dir++)
       {
-        for (i=0; i < numSourcePts; i++)
+        eigen_dir = dir%(this->ThreeGlyphs?3:1);
+        symmetric_dir = dir/(this->ThreeGlyphs?3:1);
+
+        // Remove previous scales ...
+        trans->Identity();
+
+        // translate Source to Input point
+        input->GetPoint(inPtId, x);
+        trans->Translate(x[0], x[1], x[2]);
+
+        // normalized eigenvectors rotate object for eigen direction 0
+        matrix->Element[0][0] = xv[0];
+        matrix->Element[0][1] = yv[0];
+        matrix->Element[0][2] = zv[0];
+        matrix->Element[1][0] = xv[1];
+        matrix->Element[1][1] = yv[1];
+        matrix->Element[1][2] = zv[1];
+        matrix->Element[2][0] = xv[2];
+        matrix->Element[2][1] = yv[2];
+        matrix->Element[2][2] = zv[2];
+        trans->Concatenate(matrix);
+
+        if (eigen_dir == 1)
         {
-          outPD->CopyData(pd,i,ptIncr+i);
+          trans->RotateZ(90.0);
+        }
+
+        if (eigen_dir == 2)
+        {
+          trans->RotateY(-90.0);
+        }
+
+        if (this->ThreeGlyphs)
+        {
+          trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+        }
+        else
+        {
+          trans->Scale(w[0], w[1], w[2]);
+        }
+
+        // Mirror second set to the symmetric position
+        if (symmetric_dir == 1)
+        {
+          trans->Scale(-1.,1.,1.);
+        }
+
+        // if the eigenvalue is negative, shift to reverse direction.
+        // The && is there to ensure that we do not change the
+        // old behaviour of vtkTensorGlyphs (which only used one dir),
+        // in case there is an oriented glyph, e.g. an arrow.
+        if (w[eigen_dir] < 0 && numDirs > 1)
+        {
+          trans->Translate(-this->Length, 0., 0.);
+        }
+
+        // multiply points (and normals if available) by resulting
+        // matrix
+        trans->TransformPoints(sourcePts,newPts);
+
+        // Apply the transformation to a series of points,
+        // and append the results to outPts.
+        if ( newNormals )
+        {
+          // a negative determinant means the transform turns the
+          // glyph surface inside out, and its surface normals all
+          // point inward. The following scale corrects the surface
+          // normals to point outward.
+          if (trans->GetMatrix()->Determinant() < 0)
+          {
+            trans->Scale(-1.0,-1.0,-1.0);
+          }
+          trans->TransformNormals(sourceNormals,newNormals);
+        }
+
+          // Copy point data from source
+        if ( this->ColorGlyphs && inScalars &&
+             (this->ColorMode == COLOR_BY_SCALARS) )
+        {
+          s = inScalars->GetComponent(inPtId, 0);
+          for (i=0; i < numSourcePts; i++)
+          {
+            newScalars->InsertTuple(ptIncr+i, &s);
+          }
+        }
+        else if (this->ColorGlyphs &&
+                 (this->ColorMode == COLOR_BY_EIGENVALUES) )
+        {
+          // If ThreeGlyphs is false we use the first (largest)
+          // eigenvalue as scalar.
+          s = w[eigen_dir];
+          for (i=0; i < numSourcePts; i++)
+          {
+            newScalars->InsertTuple(ptIncr+i, &s);
+          }
+        }
+        else
+        {
+          for (i=0; i < numSourcePts; i++)
+          {
+            outPD->CopyData(pd,i,ptIncr+i);
+          }
         }
+        ptIncr += numSourcePts;
       }
-      ptIncr += numSourcePts;
     }
   }
   vtkDebugMacro(<<"Generated " << numPts <<" tensor glyphs");
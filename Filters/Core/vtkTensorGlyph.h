@@ -73,6 +73,10 @@
  * additional capability over the vtkGlyph3D object. That is, the
  * glyph can be oriented in three directions instead of one.
  *
+ * When the cells of the source are all of the same kind, the glyphs are
+ * generated in parallel with vtkSMPTools, with the same output as the
+ * serial algorithm.
+ *
  * @par Thanks:
  * Thanks to Jose Paulo Moitinho de Almeida for enhancements.
  *
@@ -14,21 +14,664 @@
 =========================================================================*/
 #include "vtkThreshold.h"
 
+#include "vtkArrayDispatch.h"
+#include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkCell.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkDataArrayAccessor.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStructuredData.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkMath.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <memory>
+#include <vector>
 
 vtkStandardNewMacro(vtkThreshold);
 
+namespace
+{
+// The threaded extraction is done in a few passes over the cells. The
+// classification of the cells gives the size of the output cells, whose
+// prefix sums give the location of each output cell. The output points are
+// numbered in the order of their first use by the output cells (as in the
+// serial algorithm): the position of the first use of each point in the
+// output connectivity is found with an atomic minimum, and the first uses
+// are then numbered with another prefix sum.
+
+// The points of the input cells, in the order of vtkDataSet::GetCell(). The
+// points of the cells of structured datasets are computed directly; other
+// datasets must support concurrent GetCellPoints() calls.
+struct InputCells
+{
+  vtkDataSet *Input;
+  bool Structured;
+  bool HexahedronOrder;
+  int Dimensions[3];
+  int DataDescription;
+
+  explicit InputCells(vtkDataSet *input) :
+    Input(input), Structured(false), HexahedronOrder(false),
+    DataDescription(VTK_EMPTY)
+  {
+    if (vtkImageData *image = vtkImageData::SafeDownCast(input))
+    {
+      this->Structured = true;
+      image->GetDimensions(this->Dimensions);
+    }
+    else if (vtkRectilinearGrid *rGrid = vtkRectilinearGrid::SafeDownCast(input))
+    {
+      this->Structured = true;
+      rGrid->GetDimensions(this->Dimensions);
+    }
+    else if (vtkStructuredGrid *sGrid = vtkStructuredGrid::SafeDownCast(input))
+    {
+      this->Structured = true;
+      this->HexahedronOrder = true;
+      sGrid->GetDimensions(this->Dimensions);
+    }
+    if (this->Structured)
+    {
+      this->DataDescription =
+        vtkStructuredData::GetDataDescription(this->Dimensions);
+    }
+  }
+
+  void GetCellPoints(vtkIdType cellId, vtkIdList *cellPts)
+  {
+    if (!this->Structured)
+    {
+      this->Input->GetCellPoints(cellId, cellPts);
+      return;
+    }
+    vtkStructuredData::GetCellPoints(cellId, cellPts,
+      this->DataDescription, this->Dimensions);
+    if (this->HexahedronOrder && cellPts->GetNumberOfIds() >= 4)
+    {
+      vtkIdType *ids = cellPts->GetPointer(0);
+      std::swap(ids[2], ids[3]);
+      if (cellPts->GetNumberOfIds() == 8)
+      {
+        std::swap(ids[6], ids[7]);
+      }
+    }
+  }
+};
+
+// The criteria of vtkThreshold::Lower(), Upper() and Between().
+struct LowerCriterion
+{
+  double Lower;
+  double Upper;
+  bool operator()(double s) const { return s <= this->Lower; }
+};
+
+struct UpperCriterion
+{
+  double Lower;
+  double Upper;
+  bool operator()(double s) const { return s >= this->Upper; }
+};
+
+struct BetweenCriterion
+{
+  double Lower;
+  double Upper;
+  bool operator()(double s) const
+  {
+    return s >= this->Lower && s <= this->Upper;
+  }
+};
+
+// The settings of the filter used to classify the cells.
+struct ThresholdSettings
+{
+  bool UsePointScalars;
+  bool AllScalars;
+  bool UseContinuousCellRange;
+  bool Invert;
+  int ComponentMode;
+  int SelectedComponent;
+};
+
+// Set the size of the output cells: the number of points of the cells that
+// satisfy the criterion, zero for the other cells (and the empty cells).
+template <typename ArrayT, typename CriterionT>
+struct ClassifyCells
+{
+  InputCells *Input;
+  vtkDataArrayAccessor<ArrayT> Scalars;
+  CriterionT Criterion;
+  ThresholdSettings Settings;
+  int NumComp;
+  vtkIdType *CellSizes;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+
+  ClassifyCells(InputCells *input, ArrayT *scalars, CriterionT criterion,
+                const ThresholdSettings& settings, vtkIdType *cellSizes) :
+    Input(input), Scalars(scalars), Criterion(criterion), Settings(settings),
+    NumComp(scalars->GetNumberOfComponents()), CellSizes(cellSizes)
+  {
+  }
+
+  // Same as vtkThreshold::EvaluateComponents().
+  bool EvaluateComponents(vtkIdType id) const
+  {
+    switch (this->Settings.ComponentMode)
+    {
+      case VTK_COMPONENT_MODE_USE_SELECTED:
+      {
+        int c = this->Settings.SelectedComponent < this->NumComp ?
+          this->Settings.SelectedComponent : 0;
+        return this->Criterion(static_cast<double>(this->Scalars.Get(id, c)));
+      }
+      case VTK_COMPONENT_MODE_USE_ANY:
+        for (int c = 0; c < this->NumComp; ++c)
+        {
+          if (this->Criterion(static_cast<double>(this->Scalars.Get(id, c))))
+          {
+            return true;
+          }
+        }
+        return false;
+      case VTK_COMPONENT_MODE_USE_ALL:
+        for (int c = 0; c < this->NumComp; ++c)
+        {
+          if (!this->Criterion(static_cast<double>(this->Scalars.Get(id, c))))
+          {
+            return false;
+          }
+        }
+        return true;
+    }
+    return false;
+  }
+
+  // Same as vtkThreshold::EvaluateCell() for the component c.
+  bool EvaluateRange(const vtkIdType *pts, vtkIdType npts, int c) const
+  {
+    double minScalar = DBL_MAX, maxScalar = DBL_MIN;
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      double s = static_cast<double>(this->Scalars.Get(pts[i], c));
+      minScalar = std::min(s, minScalar);
+      maxScalar = std::max(s, maxScalar);
+    }
+    return !(this->Criterion.Lower > maxScalar ||
+             this->Criterion.Upper < minScalar);
+  }
+
+  // Same as vtkThreshold::EvaluateCell().
+  bool EvaluateRange(const vtkIdType *pts, vtkIdType npts) const
+  {
+    switch (this->Settings.ComponentMode)
+    {
+      case VTK_COMPONENT_MODE_USE_SELECTED:
+        return this->EvaluateRange(pts, npts,
+          this->Settings.SelectedComponent < this->NumComp ?
+          this->Settings.SelectedComponent : 0);
+      case VTK_COMPONENT_MODE_USE_ANY:
+        for (int c = 0; c < this->NumComp; ++c)
+        {
+          if (this->EvaluateRange(pts, npts, c))
+          {
+            return true;
+          }
+        }
+        return false;
+      case VTK_COMPONENT_MODE_USE_ALL:
+        for (int c = 0; c < this->NumComp; ++c)
+        {
+          if (!this->EvaluateRange(pts, npts, c))
+          {
+            return false;
+          }
+        }
+        return true;
+    }
+    return false;
+  }
+
+  void Initialize()
+  {
+    this->CellPoints.Local()->Allocate(VTK_CELL_SIZE);
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdList *cellPts = this->CellPoints.Local();
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      this->CellSizes[cellId] = 0;
+      if (this->Input->Input->GetCellType(cellId) == VTK_EMPTY_CELL)
+      {
+        continue;
+      }
+      this->Input->GetCellPoints(cellId, cellPts);
+      const vtkIdType npts = cellPts->GetNumberOfIds();
+      const vtkIdType *pts = cellPts->GetPointer(0);
+
+      bool keepCell;
+      if (!this->Settings.UsePointScalars)
+      {
+        keepCell = this->EvaluateComponents(cellId);
+      }
+      else if (this->Settings.AllScalars)
+      {
+        keepCell = true;
+        for (vtkIdType i = 0; keepCell && i < npts; ++i)
+        {
+          keepCell = this->EvaluateComponents(pts[i]);
+        }
+      }
+      else if (!this->Settings.UseContinuousCellRange)
+      {
+        keepCell = false;
+        for (vtkIdType i = 0; !keepCell && i < npts; ++i)
+        {
+          keepCell = this->EvaluateComponents(pts[i]);
+        }
+      }
+      else
+      {
+        keepCell = this->EvaluateRange(pts, npts);
+      }
+
+      if (keepCell != this->Settings.Invert)
+      {
+        this->CellSizes[cellId] = npts;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+  }
+};
+
+template <typename CriterionT>
+struct ClassifyWorker
+{
+  InputCells *Input;
+  CriterionT Criterion;
+  ThresholdSettings Settings;
+  vtkIdType *CellSizes;
+
+  template <typename ArrayT>
+  void operator()(ArrayT *scalars)
+  {
+    ClassifyCells<ArrayT, CriterionT> classify(this->Input, scalars,
+      this->Criterion, this->Settings, this->CellSizes);
+    vtkSMPTools::For(0, this->Input->Input->GetNumberOfCells(), classify);
+  }
+};
+
+template <typename CriterionT>
+void Classify(InputCells *input, vtkDataArray *scalars, CriterionT criterion,
+              const ThresholdSettings& settings, vtkIdType *cellSizes)
+{
+  ClassifyWorker<CriterionT> worker{ input, criterion, settings, cellSizes };
+  if (!vtkArrayDispatch::Dispatch::Execute(scalars, worker))
+  {
+    worker(scalars);
+  }
+}
+
+// Copy the points of the kept cells into the output connectivity (still
+// with the input point ids), set the output offsets, types and locations,
+// and find the first use of each point.
+struct FillCells
+{
+  InputCells *Input;
+  const vtkIdType *ConnOffsets;
+  const vtkIdType *NewCellIds;
+  vtkIdType *Connectivity;
+  vtkIdType *Offsets;
+  unsigned char *Types;
+  vtkIdType *Locations;
+  vtkIdType *CellMap;
+  std::atomic<vtkIdType> *FirstUse;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+
+  void Initialize()
+  {
+    this->CellPoints.Local()->Allocate(VTK_CELL_SIZE);
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdList *cellPts = this->CellPoints.Local();
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      const vtkIdType offset = this->ConnOffsets[cellId];
+      if (this->ConnOffsets[cellId + 1] == offset)
+      {
+        continue;
+      }
+      this->Input->GetCellPoints(cellId, cellPts);
+      const vtkIdType npts = cellPts->GetNumberOfIds();
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        const vtkIdType ptId = cellPts->GetId(i);
+        this->Connectivity[offset + i] = ptId;
+        vtkIdType first = this->FirstUse[ptId].load(std::memory_order_relaxed);
+        while (offset + i < first &&
+          !this->FirstUse[ptId].compare_exchange_weak(first, offset + i,
+            std::memory_order_relaxed))
+        {
+        }
+      }
+      const vtkIdType newCellId = this->NewCellIds[cellId];
+      this->Offsets[newCellId] = offset;
+      this->Types[newCellId] =
+        static_cast<unsigned char>(this->Input->Input->GetCellType(cellId));
+      this->Locations[newCellId] = offset + newCellId;
+      this->CellMap[newCellId] = cellId;
+    }
+  }
+
+  void Reduce()
+  {
+  }
+};
+
+// Count the points used for the first time by each output cell.
+struct CountNewPoints
+{
+  const vtkIdType *Offsets;
+  const vtkIdType *Connectivity;
+  const std::atomic<vtkIdType> *FirstUse;
+  vtkIdType *Counts;
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      vtkIdType count = 0;
+      for (vtkIdType i = this->Offsets[cellId]; i < this->Offsets[cellId + 1]; ++i)
+      {
+        if (this->FirstUse[this->Connectivity[i]].load(std::memory_order_relaxed) == i)
+        {
+          ++count;
+        }
+      }
+      this->Counts[cellId] = count;
+    }
+  }
+};
+
+// Number the points in the order of their first use.
+struct NumberNewPoints
+{
+  const vtkIdType *Offsets;
+  const vtkIdType *Connectivity;
+  const std::atomic<vtkIdType> *FirstUse;
+  const vtkIdType *FirstNewPointIds;
+  vtkIdType *PointMap;
+  vtkIdType *NewPointMap;
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      vtkIdType newPtId = this->FirstNewPointIds[cellId];
+      for (vtkIdType i = this->Offsets[cellId]; i < this->Offsets[cellId + 1]; ++i)
+      {
+        const vtkIdType ptId = this->Connectivity[i];
+        if (this->FirstUse[ptId].load(std::memory_order_relaxed) == i)
+        {
+          this->PointMap[ptId] = newPtId;
+          this->NewPointMap[newPtId++] = ptId;
+        }
+      }
+    }
+  }
+};
+
+// Replace the input point ids of the output connectivity.
+struct RenumberConnectivity
+{
+  const vtkIdType *PointMap;
+  vtkIdType *Connectivity;
+
+  void operator()(vtkIdType i, vtkIdType end)
+  {
+    for ( ; i < end; ++i)
+    {
+      this->Connectivity[i] = this->PointMap[this->Connectivity[i]];
+    }
+  }
+};
+
+// Copy the used points of a vtkPointSet.
+struct CopyPointsWorker
+{
+  const vtkIdType *NewPointMap;
+
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT *inPts, OutArrayT *outPts)
+  {
+    vtkDataArrayAccessor<InArrayT> in(inPts);
+    vtkDataArrayAccessor<OutArrayT> out(outPts);
+    const vtkIdType *newPointMap = this->NewPointMap;
+    auto copy = [&](vtkIdType ptId, vtkIdType endPtId)
+    {
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        for (int c = 0; c < 3; ++c)
+        {
+          out.Set(ptId, c, in.Get(newPointMap[ptId], c));
+        }
+      }
+    };
+    vtkSMPTools::For(0, outPts->GetNumberOfTuples(), copy);
+  }
+};
+
+// Copy the used points of other datasets.
+struct CopyPoints
+{
+  vtkDataSet *Input;
+  const vtkIdType *NewPointMap;
+  vtkPoints *Points;
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    double x[3];
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      this->Input->GetPoint(this->NewPointMap[ptId], x);
+      this->Points->SetPoint(ptId, x);
+    }
+  }
+};
+
+// Copy the tuples of the attribute arrays.
+struct CopyAttributes
+{
+  ArrayList *Arrays;
+  const vtkIdType *Map;
+
+  void operator()(vtkIdType outId, vtkIdType endOutId)
+  {
+    for ( ; outId < endOutId; ++outId)
+    {
+      this->Arrays->Copy(this->Map[outId], outId);
+    }
+  }
+};
+
+// Copy the tuples of map[i] of inAttr into the tuples i of outAttr, in
+// parallel when all the arrays are (named) data arrays.
+void CopyAttributeData(vtkDataSetAttributes *inAttr,
+                       vtkDataSetAttributes *outAttr, const vtkIdType *map,
+                       vtkIdType numOutIds)
+{
+  ArrayList arrays;
+  arrays.AddArrays(numOutIds, inAttr, outAttr, 0.0, false);
+  if (arrays.GetNumberOfArrays() == outAttr->GetNumberOfArrays())
+  {
+    CopyAttributes copy{ &arrays, map };
+    vtkSMPTools::For(0, numOutIds, copy);
+    return;
+  }
+
+  vtkNew<vtkIdList> fromIds;
+  vtkNew<vtkIdList> toIds;
+  fromIds->SetNumberOfIds(numOutIds);
+  toIds->SetNumberOfIds(numOutIds);
+  for (vtkIdType i = 0; i < numOutIds; ++i)
+  {
+    fromIds->SetId(i, map[i]);
+    toIds->SetId(i, i);
+  }
+  outAttr->CopyData(inAttr, fromIds, toIds);
+}
+
+// The threaded extraction. The output points are already allocated.
+void ExtractCells(vtkDataSet *input, vtkDataArray *scalars,
+                  double lower, double upper, int function,
+                  const ThresholdSettings& settings, vtkPoints *newPoints,
+                  vtkUnstructuredGrid *output)
+{
+  const vtkIdType numCells = input->GetNumberOfCells();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+
+  // Make sure the input is ready for concurrent access (e.g., build the
+  // cells of polydata).
+  if (numCells > 0)
+  {
+    vtkNew<vtkIdList> cellPts;
+    input->GetCellType(0);
+    input->GetCellPoints(0, cellPts);
+  }
+  if (numPts > 0)
+  {
+    double x[3];
+    input->GetPoint(0, x);
+  }
+
+  // Classify the cells, and compute the location of the output cells.
+  InputCells inputCells(input);
+  std::vector<vtkIdType> connOffsets(numCells + 1, 0);
+  switch (function)
+  {
+    case 0:
+      Classify(&inputCells, scalars, LowerCriterion{ lower, upper }, settings,
+               connOffsets.data());
+      break;
+    case 1:
+      Classify(&inputCells, scalars, UpperCriterion{ lower, upper }, settings,
+               connOffsets.data());
+      break;
+    default:
+      Classify(&inputCells, scalars, BetweenCriterion{ lower, upper }, settings,
+               connOffsets.data());
+  }
+  std::vector<vtkIdType> newCellIds(numCells + 1, 0);
+  vtkSMPTools::Transform(connOffsets.begin(), connOffsets.end() - 1,
+    newCellIds.begin(), [](vtkIdType size) { return size > 0 ? 1 : 0; });
+  vtkSMPTools::ExclusiveScan(connOffsets.begin(), connOffsets.end(),
+                             connOffsets.begin(), vtkIdType(0));
+  vtkSMPTools::ExclusiveScan(newCellIds.begin(), newCellIds.end(),
+                             newCellIds.begin(), vtkIdType(0));
+  const vtkIdType connSize = connOffsets[numCells];
+  const vtkIdType numNewCells = newCellIds[numCells];
+
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(connSize);
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numNewCells + 1);
+  offsets->SetValue(numNewCells, connSize);
+  vtkNew<vtkUnsignedCharArray> types;
+  types->SetNumberOfValues(numNewCells);
+  vtkNew<vtkIdTypeArray> locations;
+  locations->SetNumberOfValues(numNewCells);
+  std::vector<vtkIdType> cellMap(numNewCells);
+
+  std::unique_ptr<std::atomic<vtkIdType>[]> firstUse(
+    new std::atomic<vtkIdType>[numPts]);
+  vtkSMPTools::Fill(firstUse.get(), firstUse.get() + numPts, connSize);
+
+  FillCells fill{ &inputCells, connOffsets.data(), newCellIds.data(),
+                  connectivity->GetPointer(0), offsets->GetPointer(0),
+                  types->GetPointer(0), locations->GetPointer(0),
+                  cellMap.data(), firstUse.get(), {} };
+  vtkSMPTools::For(0, numCells, fill);
+
+  // Number the output points.
+  std::vector<vtkIdType> firstNewPointIds(numNewCells + 1, 0);
+  CountNewPoints count{ offsets->GetPointer(0), connectivity->GetPointer(0),
+                        firstUse.get(), firstNewPointIds.data() };
+  vtkSMPTools::For(0, numNewCells, count);
+  vtkSMPTools::ExclusiveScan(firstNewPointIds.begin(), firstNewPointIds.end(),
+                             firstNewPointIds.begin(), vtkIdType(0));
+  const vtkIdType numNewPts = firstNewPointIds[numNewCells];
+
+  std::vector<vtkIdType> pointMap(numPts);
+  std::vector<vtkIdType> newPointMap(numNewPts);
+  NumberNewPoints number{ offsets->GetPointer(0), connectivity->GetPointer(0),
+                          firstUse.get(), firstNewPointIds.data(),
+                          pointMap.data(), newPointMap.data() };
+  vtkSMPTools::For(0, numNewCells, number);
+  firstUse.reset();
+
+  RenumberConnectivity renumber{ pointMap.data(),
+                                 connectivity->GetPointer(0) };
+  vtkSMPTools::For(0, connSize, renumber);
+
+  // Copy the points and the attributes.
+  newPoints->SetNumberOfPoints(numNewPts);
+  vtkPointSet *inputPointSet = vtkPointSet::SafeDownCast(input);
+  if (inputPointSet && inputPointSet->GetPoints())
+  {
+    CopyPointsWorker worker{ newPointMap.data() };
+    vtkDataArray *inPts = inputPointSet->GetPoints()->GetData();
+    if (!vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals,
+          vtkArrayDispatch::Reals>::Execute(inPts, newPoints->GetData(), worker))
+    {
+      worker(inPts, newPoints->GetData());
+    }
+  }
+  else
+  {
+    CopyPoints copy{ input, newPointMap.data(), newPoints };
+    vtkSMPTools::For(0, numNewPts, copy);
+  }
+
+  vtkPointData *outPD = output->GetPointData();
+  outPD->CopyAllocate(input->GetPointData(), numNewPts);
+  CopyAttributeData(input->GetPointData(), outPD, newPointMap.data(),
+                    numNewPts);
+  vtkCellData *outCD = output->GetCellData();
+  outCD->CopyAllocate(input->GetCellData(), numNewCells);
+  CopyAttributeData(input->GetCellData(), outCD, cellMap.data(),
+                    numNewCells);
+
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(offsets, connectivity);
+  output->SetPoints(newPoints);
+  output->SetCells(types, locations, cells, nullptr, nullptr);
+}
+}
+
 // Construct with lower threshold=0, upper threshold=1, and threshold
 // function=upper AllScalars=1.
 vtkThreshold::vtkThreshold()
@@ -152,12 +795,9 @@ int vtkThreshold::RequestData(
   }
 
   outPD->CopyGlobalIdsOn();
-  outPD->CopyAllocate(pd);
   outCD->CopyGlobalIdsOn();
-  outCD->CopyAllocate(cd);
 
   numPts = input->GetNumberOfPoints();
-  output->Allocate(input->GetNumberOfCells());
 
   newPoints = vtkPoints::New();
 
@@ -183,6 +823,46 @@ int vtkThreshold::RequestData(
     newPoints->SetDataType(VTK_DOUBLE);
   }
 
+  // are we using pointScalars?
+  int fieldAssociation = this->GetInputArrayAssociation(0, inputVector);
+  bool usePointScalars = fieldAssociation == vtkDataObject::FIELD_ASSOCIATION_POINTS;
+
+  // Datasets whose cells can be traversed concurrently are processed in
+  // parallel (except polyhedra, whose face streams must be renumbered).
+  vtkUnstructuredGrid *inputGrid = vtkUnstructuredGrid::SafeDownCast(input);
+  if ((inputGrid && !inputGrid->GetFaces()) ||
+      vtkPolyData::SafeDownCast(input) || vtkImageData::SafeDownCast(input) ||
+      vtkRectilinearGrid::SafeDownCast(input) ||
+      vtkStructuredGrid::SafeDownCast(input))
+  {
+    ThresholdSettings settings;
+    settings.UsePointScalars = usePointScalars;
+    settings.AllScalars = this->AllScalars != 0;
+    settings.UseContinuousCellRange = this->UseContinuousCellRange != 0;
+    settings.Invert = this->Invert;
+    settings.ComponentMode = this->ComponentMode;
+    settings.SelectedComponent = this->SelectedComponent;
+    int function = 2;
+    if (this->ThresholdFunction == &vtkThreshold::Lower)
+    {
+      function = 0;
+    }
+    else if (this->ThresholdFunction == &vtkThreshold::Upper)
+    {
+      function = 1;
+    }
+    ExtractCells(input, inScalars, this->LowerThreshold, this->UpperThreshold,
+                 function, settings, newPoints, output);
+
+    vtkDebugMacro(<< "Extracted " << output->GetNumberOfCells()
+                  << " number of cells.");
+    newPoints->Delete();
+    return 1;
+  }
+
+  outPD->CopyAllocate(pd);
+  outCD->CopyAllocate(cd);
+  output->Allocate(input->GetNumberOfCells());
   newPoints->Allocate(numPts);
 
   pointMap = vtkIdList::New(); //maps old point ids into new
@@ -194,10 +874,6 @@ int vtkThreshold::RequestData(
 
   newCellPts = vtkIdList::New();
 
-  // are we using pointScalars?
-  int fieldAssociation = this->GetInputArrayAssociation(0, inputVector);
-  bool usePointScalars = fieldAssociation == vtkDataObject::FIELD_ASSOCIATION_POINTS;
-
   // Check that the scalars of each cell satisfy the threshold criterion
   for (cellId=0; cellId < input->GetNumberOfCells(); cellId++)
   {
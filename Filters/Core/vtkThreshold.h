@@ -30,6 +30,11 @@
  * By default only the first scalar value is used in the decision. Use the ComponentMode
  * and SelectedComponent ivars to control this behavior.
  *
+ * The cells of unstructured grids (without polyhedra), polydata and
+ * structured datasets are classified and copied in parallel with
+ * vtkSMPTools. The output is the same as the one of the serial algorithm,
+ * which processes the other datasets.
+ *
  * @sa
  * vtkThresholdPoints vtkThresholdTextureCoords
 */
@@ -164,11 +164,11 @@ int vtkUnstructuredGridToExplicitStructuredGrid::RequestData(vtkInformation*,
       ids[5] = pts[5];
       ids[6] = pts[7];
       ids[7] = pts[6];
-      cells->ReplaceCell(cellId * 9, 8, ids);
+      cells->ReplaceCellAtId(cellId, 8, ids);
     }
     else
     {
-      cells->ReplaceCell(cellId * 9, 8, pts);
+      cells->ReplaceCellAtId(cellId, 8, pts);
     }
     output->GetCellData()->CopyData(input->GetCellData(), i, cellId);
     if (expectedCells != nbCells)
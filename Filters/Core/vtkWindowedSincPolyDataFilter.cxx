@@ -24,9 +24,16 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticCellLinks.h"
 #include "vtkTriangle.h"
 #include "vtkTriangleFilter.h"
 
+#include <algorithm>
+#include <vector>
+
 vtkStandardNewMacro(vtkWindowedSincPolyDataFilter);
 
 //-----------------------------------------------------------------------------
@@ -57,12 +64,415 @@ vtkWindowedSincPolyDataFilter::vtkWindowedSincPolyDataFilter()
 #define VTK_FEATURE_EDGE_VERTEX 2
 #define VTK_BOUNDARY_EDGE_VERTEX 3
 
-// Special structure for marking vertices
-typedef struct _vtkMeshVertex
+// Marks a polygon edge that is processed from its neighbor polygon instead.
+#define VTK_VISITED_EDGE -1
+
+namespace
+{
+
+// The cells using a point are visited in ascending order, as with
+// vtkCellLinks, so that the analysis does not depend on how the links were
+// built.
+struct SortLinks
+{
+  vtkStaticCellLinks *Links;
+
+  SortLinks(vtkStaticCellLinks *links) : Links(links) {}
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      vtkIdType *cells = this->Links->GetCells(ptId);
+      std::sort(cells, cells + this->Links->GetNcells(ptId));
+    }
+  }
+};
+
+// The cells other than cellId using the edge (p1,p2), in the order of the
+// cells using p1 (see vtkPolyData::GetCellEdgeNeighbors()).
+void GetCellEdgeNeighbors(vtkStaticCellLinks *links, vtkIdType cellId,
+                          vtkIdType p1, vtkIdType p2, vtkIdList *cellIds)
+{
+  cellIds->Reset();
+
+  const vtkIdType *cells1 = links->GetCells(p1);
+  const vtkIdType *cells1End = cells1 + links->GetNcells(p1);
+  const vtkIdType *cells2 = links->GetCells(p2);
+  const vtkIdType *cells2End = cells2 + links->GetNcells(p2);
+
+  for ( ; cells1 != cells1End; ++cells1)
+  {
+    if (*cells1 != cellId && std::find(cells2, cells2End, *cells1) != cells2End)
+    {
+      cellIds->InsertNextId(*cells1);
+    }
+  }
+}
+
+// Classify the edges of the polygons: the i-th edge of a polygon, joining
+// its points i and i+1, is a boundary, feature (non-manifold or, with
+// feature edge smoothing, sharp) or simple edge, unless it is visited from
+// a neighbor polygon with a lower id. The type of the i-th edge is stored
+// at the position of the i-th point in the connectivity array.
+struct ClassifyEdges
+{
+  vtkPoints *Points;
+  vtkCellArray *Polys;
+  vtkStaticCellLinks *Links;
+  bool NonManifoldSmoothing;
+  bool FeatureEdgeSmoothing;
+  double CosFeatureAngle;
+  signed char *EdgeTypes;
+  vtkSMPThreadLocalObject<vtkIdList> Neighbors;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+  vtkSMPThreadLocalObject<vtkIdList> NeighborPoints;
+
+  ClassifyEdges(vtkPoints *points, vtkCellArray *polys,
+                vtkStaticCellLinks *links, bool nonManifoldSmoothing,
+                bool featureEdgeSmoothing, double cosFeatureAngle,
+                signed char *edgeTypes) :
+    Points(points), Polys(polys), Links(links),
+    NonManifoldSmoothing(nonManifoldSmoothing),
+    FeatureEdgeSmoothing(featureEdgeSmoothing),
+    CosFeatureAngle(cosFeatureAngle), EdgeTypes(edgeTypes)
+  {
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkIdList *neighbors = this->Neighbors.Local();
+    vtkIdList *cellPoints = this->CellPoints.Local();
+    vtkIdList *neighborPoints = this->NeighborPoints.Local();
+    vtkIdType npts, numNeiPts;
+    const vtkIdType *pts, *neiPts;
+    double normal[3], neiNormal[3];
+
+    for ( ; cellId < endCellId; ++cellId)
+    {
+      this->Polys->GetCellAtId(cellId, npts, pts, cellPoints);
+      signed char *edgeTypes = this->EdgeTypes + this->Polys->GetOffset(cellId);
+      for (vtkIdType i = 0; i < npts; i++)
+      {
+        GetCellEdgeNeighbors(this->Links, cellId, pts[i], pts[(i+1)%npts],
+                             neighbors);
+        vtkIdType numNei = neighbors->GetNumberOfIds();
+        vtkIdType nei;
+
+        signed char edge = VTK_SIMPLE_VERTEX;
+        if ( numNei == 0 )
+        {
+          edge = VTK_BOUNDARY_EDGE_VERTEX;
+        }
+        else if ( numNei >= 2 )
+        {
+          // non-manifold case, check nonmanifold smoothing state
+          if (!this->NonManifoldSmoothing)
+          {
+            // check to make sure that this edge hasn't been marked already
+            vtkIdType j;
+            for (j=0; j < numNei; j++)
+            {
+              if ( neighbors->GetId(j) < cellId )
+              {
+                break;
+              }
+            }
+            if ( j >= numNei )
+            {
+              edge = VTK_FEATURE_EDGE_VERTEX;
+            }
+          }
+        }
+        else if ( (nei=neighbors->GetId(0)) > cellId )
+        {
+          if (this->FeatureEdgeSmoothing)
+          {
+            vtkPolygon::ComputeNormal(this->Points, npts,
+                                      const_cast<vtkIdType*>(pts), normal);
+            this->Polys->GetCellAtId(nei, numNeiPts, neiPts, neighborPoints);
+            vtkPolygon::ComputeNormal(this->Points, numNeiPts,
+                                      const_cast<vtkIdType*>(neiPts),
+                                      neiNormal);
+
+            if ( vtkMath::Dot(normal,neiNormal) <= this->CosFeatureAngle )
+            {
+              edge = VTK_FEATURE_EDGE_VERTEX;
+            }
+          }
+        }
+        else // a visited edge
+        {
+          edge = VTK_VISITED_EDGE;
+        }
+        edgeTypes[i] = edge;
+      }
+    }
+  }
+};
+
+// Gather the points connected to each point, the edges used to smooth it,
+// and set its type. The classified edges are replayed around each point in
+// the order in which the polygons list them, so that the outcome is the
+// same as processing the polygons one after the other. The first pass only
+// counts the edges of the points, the second one (when Edges is set) fills
+// them in.
+struct GatherEdges
+{
+  vtkCellArray *Polys;
+  vtkStaticCellLinks *Links;
+  const signed char *EdgeTypes;
+  const char *LineTypes;
+  const vtkIdType *LineEdges;
+  char *Types;
+  vtkIdType *Offsets;
+  vtkIdType *Edges;
+  vtkSMPThreadLocalObject<vtkIdList> CellPoints;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> PointEdges;
+
+  GatherEdges(vtkCellArray *polys, vtkStaticCellLinks *links,
+              const signed char *edgeTypes, const char *lineTypes,
+              const vtkIdType *lineEdges, char *types, vtkIdType *offsets,
+              vtkIdType *edges) :
+    Polys(polys), Links(links), EdgeTypes(edgeTypes), LineTypes(lineTypes),
+    LineEdges(lineEdges), Types(types), Offsets(offsets), Edges(edges)
+  {
+  }
+
+  static void AddEdge(signed char edge, vtkIdType ptId, char& type,
+                      std::vector<vtkIdType>& pointEdges)
+  {
+    if ( edge && type == VTK_SIMPLE_VERTEX )
+    {
+      pointEdges.clear();
+      pointEdges.push_back(ptId);
+      type = edge;
+    }
+    else if ( (edge && type == VTK_BOUNDARY_EDGE_VERTEX) ||
+              (edge && type == VTK_FEATURE_EDGE_VERTEX) ||
+              (!edge && type == VTK_SIMPLE_VERTEX ) )
+    {
+      pointEdges.push_back(ptId);
+      if ( type && edge == VTK_BOUNDARY_EDGE_VERTEX )
+      {
+        type = VTK_BOUNDARY_EDGE_VERTEX;
+      }
+    }
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    vtkIdList *cellPoints = this->CellPoints.Local();
+    std::vector<vtkIdType>& pointEdges = this->PointEdges.Local();
+    vtkIdType npts;
+    const vtkIdType *pts;
+
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      // the edges of a vertex in the middle of a line
+      char type = this->LineTypes[ptId];
+      pointEdges.clear();
+      if ( type == VTK_FEATURE_EDGE_VERTEX )
+      {
+        pointEdges.push_back(this->LineEdges[2*ptId]);
+        pointEdges.push_back(this->LineEdges[2*ptId+1]);
+      }
+
+      const vtkIdType ncells = this->Links ? this->Links->GetNcells(ptId) : 0;
+      const vtkIdType *cells = ncells ? this->Links->GetCells(ptId) : nullptr;
+      for (vtkIdType k = 0; k < ncells; k++)
+      {
+        // a polygon using the point several times is visited once
+        if ( k > 0 && cells[k] == cells[k-1] )
+        {
+          continue;
+        }
+        this->Polys->GetCellAtId(cells[k], npts, pts, cellPoints);
+        const signed char *edgeTypes =
+          this->EdgeTypes + this->Polys->GetOffset(cells[k]);
+        for (vtkIdType i = 0; i < npts; i++)
+        {
+          const signed char edge = edgeTypes[i];
+          if ( edge == VTK_VISITED_EDGE )
+          {
+            continue;
+          }
+          const vtkIdType p1 = pts[i];
+          const vtkIdType p2 = pts[(i+1)%npts];
+          if ( p1 == ptId )
+          {
+            AddEdge(edge, p2, type, pointEdges);
+          }
+          if ( p2 == ptId )
+          {
+            AddEdge(edge, p1, type, pointEdges);
+          }
+        }
+      }
+
+      if ( this->Edges )
+      {
+        std::copy(pointEdges.begin(), pointEdges.end(),
+                  this->Edges + this->Offsets[ptId]);
+      }
+      else
+      {
+        this->Types[ptId] = type;
+        this->Offsets[ptId] = static_cast<vtkIdType>(pointEdges.size());
+      }
+    }
+  }
+};
+
+// The first smoothing iteration: newPts[one] = newPts[zero] - 0.5 laplacian
+// and newPts[three] = c0 newPts[zero] + c1 newPts[one]. Points that cannot
+// move get a zero Laplacian.
+struct FirstIteration
 {
-  char      type;
-  vtkIdList *edges; // connected edges (list of connected point ids)
-} vtkMeshVertex, *vtkMeshVertexPtr;
+  const vtkIdType *Offsets;
+  const vtkIdType *Edges;
+  const char *Types;
+  const double *C;
+  const float *X0;
+  float *X1;
+  float *X3;
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    double x[3], y[3], deltaX[3];
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType npts = this->Offsets[ptId+1] - this->Offsets[ptId];
+      const float *x0 = this->X0 + 3*ptId;
+      float *x1 = this->X1 + 3*ptId;
+      float *x3 = this->X3 + 3*ptId;
+      if ( npts > 0 )
+      {
+        // point is allowed to move
+        const vtkIdType *edges = this->Edges + this->Offsets[ptId];
+        x[0] = x0[0];
+        x[1] = x0[1];
+        x[2] = x0[2];
+        deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
+
+        // calculate the negative of the laplacian
+        for (vtkIdType j=0; j<npts; j++) //for all connected points
+        {
+          const float *yj = this->X0 + 3*edges[j];
+          for (int k=0; k<3; k++)
+          {
+            y[k] = yj[k];
+            deltaX[k] += (x[k] - y[k]) / npts;
+          }
+        }
+        for (int k=0; k<3; k++)
+        {
+          deltaX[k] = x[k] - 0.5*deltaX[k];
+          x1[k] = static_cast<float>(deltaX[k]);
+        }
+
+        for (int k=0; k < 3; k++)
+        {
+          deltaX[k] = this->C[0]*x[k] + this->C[1]*deltaX[k];
+        }
+        if (this->Types[ptId] == VTK_FIXED_VERTEX)
+        {
+          std::copy(x0, x0 + 3, x3);
+        }
+        else
+        {
+          for (int k=0; k < 3; k++)
+          {
+            x3[k] = static_cast<float>(deltaX[k]);
+          }
+        }
+      }
+      else
+      {
+        // point is not allowed to move, just use the old point...
+        // (zero out the Laplacian)
+        std::fill(x1, x1 + 3, 0.0f);
+        std::copy(x0, x0 + 3, x3);
+      }
+    }
+  }
+};
+
+// The following iterations: newPts[two] = (x1 - x0) + (x1 - laplacian(x1))
+// and newPts[three] += c newPts[two]. Only the point itself is written, so
+// that the points are updated independently from each other. The Laplacian
+// of the points that cannot move stays zero: it is zeroed in newPts[two]
+// only, newPts[one] being last iteration's newPts[two].
+struct NextIteration
+{
+  const vtkIdType *Offsets;
+  const vtkIdType *Edges;
+  const char *Types;
+  double C;
+  const float *X0;
+  const float *X1;
+  float *X2;
+  float *X3;
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    double p_x0[3], p_x1[3], p_x3[3], y[3], deltaX[3], xNew[3];
+    for ( ; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType npts = this->Offsets[ptId+1] - this->Offsets[ptId];
+      float *x2 = this->X2 + 3*ptId;
+      if ( npts > 0 )
+      {
+        // point is allowed to move
+        const vtkIdType *edges = this->Edges + this->Offsets[ptId];
+        const float *x0 = this->X0 + 3*ptId;
+        const float *x1 = this->X1 + 3*ptId;
+        float *x3 = this->X3 + 3*ptId;
+        for (int k=0; k<3; k++)
+        {
+          p_x0[k] = x0[k];
+          p_x1[k] = x1[k];
+        }
+        deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
+
+        // calculate the negative laplacian of x1
+        for (vtkIdType j=0; j<npts; j++)
+        {
+          const float *yj = this->X1 + 3*edges[j];
+          for (int k=0; k<3; k++)
+          {
+            y[k] = yj[k];
+            deltaX[k] += (p_x1[k] - y[k]) / npts;
+          }
+        }
+
+        // Taubin:  x2 = (x1 - x0) + (x1 - x2)
+        for (int k=0; k<3; k++)
+        {
+          deltaX[k] = p_x1[k] - p_x0[k] + p_x1[k] - deltaX[k];
+          x2[k] = static_cast<float>(deltaX[k]);
+        }
+
+        // smooth the vertex (x3 = x3 + cj x2)
+        if (this->Types[ptId] != VTK_FIXED_VERTEX)
+        {
+          for (int k=0;k<3;k++)
+          {
+            p_x3[k] = x3[k];
+            xNew[k] = p_x3[k] + this->C * deltaX[k];
+            x3[k] = static_cast<float>(xNew[k]);
+          }
+        }
+      }
+      else
+      {
+        std::fill(x2, x2 + 3, 0.0f);
+      }
+    }
+  }
+};
+
+} // anonymous namespace
 
 //-----------------------------------------------------------------------------
 int vtkWindowedSincPolyDataFilter::RequestData(
@@ -84,8 +494,6 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   int j, k;
   vtkIdType npts = 0;
   vtkIdType *pts = nullptr;
-  vtkIdType p1, p2;
-  double x[3], y[3], deltaX[3], xNew[3];
   double x1[3], x2[3], x3[3], l1[3], l2[3];
   double CosFeatureAngle; //Cosine of angle between adjacent polys
   double CosEdgeAngle; // Cosine of angle between adjacent edges
@@ -96,10 +504,9 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   vtkTriangleFilter *toTris=nullptr;
   vtkCellArray *inVerts, *inLines, *inPolys, *inStrips;
   vtkPoints *newPts[4];
-  vtkMeshVertexPtr Verts;
 
   // variables specific to windowed sinc interpolation
-  double theta_pb, k_pb, sigma, p_x0[3], p_x1[3], p_x3[3];
+  double theta_pb, k_pb, sigma;
   double *w, *c, *cprime;
   int zero, one, two, three;
 
@@ -146,14 +553,11 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   // classifications for a vertex: VTK_SIMPLE_VERTEX, VTK_FIXED_VERTEX. or
   // VTK_EDGE_VERTEX. Simple vertices are smoothed using all connected
   // vertices. FIXED vertices are never smoothed. Edge vertices are smoothed
-  // using a subset of the attached vertices.
+  // using a subset of the attached vertices. The connected vertices of the
+  // points are stored contiguously: those of point i are
+  // edges[offsets[i]] to edges[offsets[i+1]-1].
   vtkDebugMacro(<<"Analyzing topology...");
-  Verts = new vtkMeshVertex[numPts];
-  for (i=0; i<numPts; i++)
-  {
-    Verts[i].type = VTK_SIMPLE_VERTEX; //can smooth
-    Verts[i].edges = nullptr;
-  }
+  std::vector<char> lineTypes(numPts, VTK_SIMPLE_VERTEX); //can smooth
 
   inPts = input->GetPoints();
 
@@ -163,15 +567,19 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   {
     for (j=0; j<npts; j++)
     {
-      Verts[pts[j]].type = VTK_FIXED_VERTEX;
+      lineTypes[pts[j]] = VTK_FIXED_VERTEX;
     }
   }
 
   this->UpdateProgress(0.10);
 
   // now check lines. Only manifold lines can be smoothed------------
-  for (inLines=input->GetLines(), inLines->InitTraversal();
-  inLines->GetNextCell(npts,pts); )
+  // The two points connected to a feature edge vertex of a line are stored
+  // in lineEdges.
+  inLines = input->GetLines();
+  std::vector<vtkIdType> lineEdges(
+    inLines->GetNumberOfCells() > 0 ? 2*numPts : 0);
+  for (inLines->InitTraversal(); inLines->GetNextCell(npts,pts); )
   {
     // Check for closed loop which are treated specially. Basically the
     // last point is ignored (set to fixed).
@@ -179,48 +587,42 @@ int vtkWindowedSincPolyDataFilter::RequestData(
 
     for (j=0; j<npts; j++)
     {
-      if ( Verts[pts[j]].type == VTK_SIMPLE_VERTEX )
+      if ( lineTypes[pts[j]] == VTK_SIMPLE_VERTEX )
       {
         // First point
         if ( j == 0 )
         {
           if ( !closedLoop )
           {
-            Verts[pts[0]].type = VTK_FIXED_VERTEX;
+            lineTypes[pts[0]] = VTK_FIXED_VERTEX;
           }
           else
           {
-            Verts[pts[0]].type = VTK_FEATURE_EDGE_VERTEX;
-            Verts[pts[0]].edges = vtkIdList::New();
-            Verts[pts[0]].edges->SetNumberOfIds(2);
-            Verts[pts[0]].edges->SetId(0,pts[npts-2]);
-            Verts[pts[0]].edges->SetId(1,pts[1]);
+            lineTypes[pts[0]] = VTK_FEATURE_EDGE_VERTEX;
+            lineEdges[2*pts[0]] = pts[npts-2];
+            lineEdges[2*pts[0]+1] = pts[1];
           }
         }
         // Last point
         else if ( j == (npts-1) && !closedLoop )
         {
-          Verts[pts[j]].type = VTK_FIXED_VERTEX;
+          lineTypes[pts[j]] = VTK_FIXED_VERTEX;
         }
         // In between point
         else //is edge vertex (unless already edge vertex!)
         {
-          Verts[pts[j]].type = VTK_FEATURE_EDGE_VERTEX;
-          Verts[pts[j]].edges = vtkIdList::New();
-          Verts[pts[j]].edges->SetNumberOfIds(2);
-          Verts[pts[j]].edges->SetId(0,pts[j-1]);
-          Verts[pts[j]].edges->SetId(1,pts[(closedLoop && j==(npts-2) ? 0 : (j+1))]);
+          lineTypes[pts[j]] = VTK_FEATURE_EDGE_VERTEX;
+          lineEdges[2*pts[j]] = pts[j-1];
+          lineEdges[2*pts[j]+1] = pts[(closedLoop && j==(npts-2) ? 0 : (j+1))];
         }
       } //if simple vertex
 
       // Vertex has been visited before, need to fix it. Special case
       // when working on closed loop.
-      else if ( Verts[pts[j]].type == VTK_FEATURE_EDGE_VERTEX &&
+      else if ( lineTypes[pts[j]] == VTK_FEATURE_EDGE_VERTEX &&
                 ! (closedLoop && j == (npts-1)) )
       {
-        Verts[pts[j]].type = VTK_FIXED_VERTEX;
-        Verts[pts[j]].edges->Delete();
-        Verts[pts[j]].edges = nullptr;
+        lineTypes[pts[j]] = VTK_FIXED_VERTEX;
       }
     } //for all points in this line
   } //for all lines
@@ -228,27 +630,26 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   this->UpdateProgress(0.25);
 
   // now polygons and triangle strips-------------------------------
+  // The edges of the polygons are classified in parallel, then each point
+  // gathers the edges it uses in parallel.
   inPolys=input->GetPolys();
   numPolys = inPolys->GetNumberOfCells();
   inStrips=input->GetStrips();
   numStrips = inStrips->GetNumberOfCells();
 
+  std::vector<char> types(numPts);
+  std::vector<vtkIdType> offsets(numPts+1);
+  std::vector<vtkIdType> edges;
+  vtkCellArray *polys = nullptr;
+  vtkStaticCellLinks *links = nullptr;
+  std::vector<signed char> edgeTypes;
+
   if ( numPolys > 0 || numStrips > 0 )
   { //build cell structure
-    vtkCellArray *polys;
-    vtkIdType cellId;
-    int numNei, nei, edge;
-    vtkIdType numNeiPts;
-    vtkIdType *neiPts;
-    double normal[3], neiNormal[3];
-    vtkIdList *neighbors;
-
     inMesh = vtkPolyData::New();
     inMesh->SetPoints(inPts);
     inMesh->SetPolys(inPolys);
     Mesh = inMesh;
-    neighbors = vtkIdList::New();
-    neighbors->Allocate(VTK_CELL_SIZE);
 
     if ( (numStrips = inStrips->GetNumberOfCells()) > 0 )
     { // convert data to triangles
@@ -259,160 +660,86 @@ int vtkWindowedSincPolyDataFilter::RequestData(
       Mesh = toTris->GetOutput();
     }
 
-    Mesh->BuildLinks(); //to do neighborhood searching
     polys = Mesh->GetPolys();
-
-    for (cellId=0, polys->InitTraversal(); polys->GetNextCell(npts,pts);
-         cellId++)
-    {
-      for (i=0; i < npts; i++)
-      {
-        p1 = pts[i];
-        p2 = pts[(i+1)%npts];
-
-        if ( Verts[p1].edges == nullptr )
-        {
-          Verts[p1].edges = vtkIdList::New();
-          Verts[p1].edges->Allocate(16,6);
-          // Verts[p1].edges = new vtkIdList(6,6);
-        }
-        if ( Verts[p2].edges == nullptr )
-        {
-          Verts[p2].edges = vtkIdList::New();
-          Verts[p2].edges->Allocate(16,6);
-          // Verts[p2].edges = new vtkIdList(6,6);
-        }
-
-        Mesh->GetCellEdgeNeighbors(cellId,p1,p2,neighbors);
-        numNei = neighbors->GetNumberOfIds();
-
-        edge = VTK_SIMPLE_VERTEX;
-        if ( numNei == 0 )
-        {
-          edge = VTK_BOUNDARY_EDGE_VERTEX;
-        }
-
-        else if ( numNei >= 2 )
-        {
-          // non-manifold case, check nonmanifold smoothing state
-          if (!this->NonManifoldSmoothing)
-          {
-            // check to make sure that this edge hasn't been marked already
-            for (j=0; j < numNei; j++)
-            {
-              if ( neighbors->GetId(j) < cellId )
-              {
-                break;
-              }
-            }
-            if ( j >= numNei )
-            {
-              edge = VTK_FEATURE_EDGE_VERTEX;
-            }
-          }
-        }
-
-        else if ( numNei == 1 && (nei=neighbors->GetId(0)) > cellId )
-        {
-          if (this->FeatureEdgeSmoothing)
-          {
-            vtkPolygon::ComputeNormal(inPts,npts,pts,normal);
-            Mesh->GetCellPoints(nei,numNeiPts,neiPts);
-            vtkPolygon::ComputeNormal(inPts,numNeiPts,neiPts,neiNormal);
-
-            if ( vtkMath::Dot(normal,neiNormal) <= CosFeatureAngle )
-            {
-              edge = VTK_FEATURE_EDGE_VERTEX;
-            }
-          }
-        }
-        else // a visited edge; skip rest of analysis
-        {
-          continue;
-        }
-
-        if ( edge && Verts[p1].type == VTK_SIMPLE_VERTEX )
-        {
-          Verts[p1].edges->Reset();
-          Verts[p1].edges->InsertNextId(p2);
-          Verts[p1].type = edge;
-        }
-        else if ( (edge && Verts[p1].type == VTK_BOUNDARY_EDGE_VERTEX) ||
-        (edge && Verts[p1].type == VTK_FEATURE_EDGE_VERTEX) ||
-        (!edge && Verts[p1].type == VTK_SIMPLE_VERTEX ) )
-        {
-          Verts[p1].edges->InsertNextId(p2);
-          if ( Verts[p1].type && edge == VTK_BOUNDARY_EDGE_VERTEX )
-          {
-            Verts[p1].type = VTK_BOUNDARY_EDGE_VERTEX;
-          }
-        }
-
-        if ( edge && Verts[p2].type == VTK_SIMPLE_VERTEX )
-        {
-          Verts[p2].edges->Reset();
-          Verts[p2].edges->InsertNextId(p1);
-          Verts[p2].type = edge;
-        }
-        else if ( (edge && Verts[p2].type == VTK_BOUNDARY_EDGE_VERTEX ) ||
-        (edge && Verts[p2].type == VTK_FEATURE_EDGE_VERTEX) ||
-        (!edge && Verts[p2].type == VTK_SIMPLE_VERTEX ) )
-        {
-          Verts[p2].edges->InsertNextId(p1);
-          if ( Verts[p2].type && edge == VTK_BOUNDARY_EDGE_VERTEX )
-          {
-            Verts[p2].type = VTK_BOUNDARY_EDGE_VERTEX;
-          }
-        }
-      }
-    }
-
-    //    delete inMesh; // delete this later, windowed sinc smoothing needs it
-    if (toTris)
-    {
-      toTris->Delete();
-    }
-    neighbors->Delete();
+    links = vtkStaticCellLinks::New(); //to do neighborhood searching
+    links->BuildLinks(Mesh);
+    SortLinks sortLinks(links);
+    vtkSMPTools::For(0, numPts, sortLinks);
+
+    edgeTypes.resize(polys->GetNumberOfConnectivityIds());
+    ClassifyEdges classify(inPts, polys, links,
+                           this->NonManifoldSmoothing != 0,
+                           this->FeatureEdgeSmoothing != 0, CosFeatureAngle,
+                           edgeTypes.data());
+    vtkSMPTools::For(0, polys->GetNumberOfCells(), classify);
   }//if strips or polys
 
+  GatherEdges countEdges(polys, links, edgeTypes.data(), lineTypes.data(),
+                         lineEdges.data(), types.data(), offsets.data(),
+                         nullptr);
+  vtkSMPTools::For(0, numPts, countEdges);
+  vtkIdType numEdges = 0;
+  for (i=0; i<numPts; i++)
+  {
+    vtkIdType count = offsets[i];
+    offsets[i] = numEdges;
+    numEdges += count;
+  }
+  offsets[numPts] = numEdges;
+  edges.resize(numEdges);
+  GatherEdges fillEdges(polys, links, edgeTypes.data(), lineTypes.data(),
+                        lineEdges.data(), types.data(), offsets.data(),
+                        edges.data());
+  vtkSMPTools::For(0, numPts, fillEdges);
+
+  //    delete inMesh; // delete this later, windowed sinc smoothing needs it
+  if (toTris)
+  {
+    toTris->Delete();
+  }
+  if (links)
+  {
+    links->Delete();
+  }
+
   this->UpdateProgress(0.50);
 
   //post-process edge vertices to make sure we can smooth them
   for (i=0; i<numPts; i++)
   {
-    if ( Verts[i].type == VTK_SIMPLE_VERTEX )
+    if ( types[i] == VTK_SIMPLE_VERTEX )
     {
       numSimple++;
     }
 
-    else if ( Verts[i].type == VTK_FIXED_VERTEX )
+    else if ( types[i] == VTK_FIXED_VERTEX )
     {
       numFixed++;
     }
 
-    else if ( Verts[i].type == VTK_FEATURE_EDGE_VERTEX ||
-              Verts[i].type == VTK_BOUNDARY_EDGE_VERTEX )
+    else if ( types[i] == VTK_FEATURE_EDGE_VERTEX ||
+              types[i] == VTK_BOUNDARY_EDGE_VERTEX )
     { //see how many edges; if two, what the angle is
 
       if ( !this->BoundarySmoothing &&
-      Verts[i].type == VTK_BOUNDARY_EDGE_VERTEX )
+      types[i] == VTK_BOUNDARY_EDGE_VERTEX )
       {
-        Verts[i].type = VTK_FIXED_VERTEX;
+        types[i] = VTK_FIXED_VERTEX;
         numBEdges++;
       }
 
-      else if ( (npts = Verts[i].edges->GetNumberOfIds()) != 2 )
+      else if ( (npts = offsets[i+1] - offsets[i]) != 2 )
       {
         // can only smooth edges on 2-manifold surfaces
-        Verts[i].type = VTK_FIXED_VERTEX;
+        types[i] = VTK_FIXED_VERTEX;
         numFixed++;
       }
 
       else //check angle between edges
       {
-        inPts->GetPoint(Verts[i].edges->GetId(0),x1);
+        inPts->GetPoint(edges[offsets[i]],x1);
         inPts->GetPoint(i,x2);
-        inPts->GetPoint(Verts[i].edges->GetId(1),x3);
+        inPts->GetPoint(edges[offsets[i]+1],x3);
 
         for (k=0; k<3; k++)
         {
@@ -423,11 +750,11 @@ int vtkWindowedSincPolyDataFilter::RequestData(
             && (vtkMath::Dot(l1,l2) < CosEdgeAngle))
         {
           numFixed++;
-          Verts[i].type = VTK_FIXED_VERTEX;
+          types[i] = VTK_FIXED_VERTEX;
         }
         else
         {
-          if ( Verts[i].type == VTK_FEATURE_EDGE_VERTEX )
+          if ( types[i] == VTK_FEATURE_EDGE_VERTEX )
           {
             numFEdges++;
           }
@@ -439,7 +766,6 @@ int vtkWindowedSincPolyDataFilter::RequestData(
       }//if along edge
     }//if edge vertex
   }//for all points
-
   vtkDebugMacro(<<"Found\n\t" << numSimple << " simple vertices\n\t"
                 << numFEdges << " feature edge vertices\n\t"
                 << numBEdges << " boundary edge vertices\n\t"
@@ -461,30 +787,49 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   newPts[3] = vtkPoints::New();
   newPts[3]->SetNumberOfPoints(numPts);
 
+  float *x[4];
+  for (i=0; i<4; i++)
+  {
+    x[i] = static_cast<float*>(newPts[i]->GetVoidPointer(0));
+  }
+
   // Get the center and length of the input dataset
   double *inCenter = input->GetCenter();
   double inLength = input->GetLength();
 
   if (!this->NormalizeCoordinates)
   {
-    for (i=0; i<numPts; i++) //initialize to old coordinates
+    //initialize to old coordinates
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      newPts[zero]->SetPoint(i,inPts->GetPoint(i));
-    }
+      double point[3];
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        inPts->GetPoint(ptId, point);
+        for (int comp=0; comp<3; ++comp)
+        {
+          x[zero][3*ptId+comp] = static_cast<float>(point[comp]);
+        }
+      }
+    });
   }
   else
   {
     // center the data and scale to be within unit cube [-1, 1]
-    double normalizedPoint[3];
-    for (i=0; i<numPts; i++) //initialize to old coordinates
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      inPts->GetPoint(i, normalizedPoint);
-      for (j=0; j<3; ++j)
+      double normalizedPoint[3];
+      for ( ; ptId < endPtId; ++ptId)
       {
-        normalizedPoint[j] = (normalizedPoint[j] - inCenter[j]) / inLength;
+        inPts->GetPoint(ptId, normalizedPoint);
+        for (int comp=0; comp<3; ++comp)
+        {
+          normalizedPoint[comp] =
+            (normalizedPoint[comp] - inCenter[comp]) / inLength;
+          x[zero][3*ptId+comp] = static_cast<float>(normalizedPoint[comp]);
+        }
       }
-      newPts[zero]->SetPoint(i,normalizedPoint);
-    }
+    });
   }
 
   // Smooth with a low pass filter defined as a windowed sinc function.
@@ -506,9 +851,6 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   c = new double[this->NumberOfIterations+1];
   cprime = new double[this->NumberOfIterations+1];
 
-  double zerovector[3];
-  zerovector[0] = zerovector[1] = zerovector[2] = 0.0;
-
   // Calculate the weights and the Chebychev coefficients c.
   //
 
@@ -594,55 +936,13 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   }
 
   // first iteration
-  for (i=0; i<numPts; i++)
-  {
-    if ( Verts[i].edges != nullptr &&
-         (npts = Verts[i].edges->GetNumberOfIds()) > 0 )
-    {
-      // point is allowed to move
-      newPts[zero]->GetPoint(i, x); //use current points
-      deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
-
-      // calculate the negative of the laplacian
-      for (j=0; j<npts; j++) //for all connected points
-      {
-        newPts[zero]->GetPoint(Verts[i].edges->GetId(j), y);
-        for (k=0; k<3; k++)
-        {
-          deltaX[k] += (x[k] - y[k]) / npts;
-        }
-      }
-      // newPts[one] = newPts[zero] - 0.5 newPts[one]
-      for (k=0; k<3; k++)
-      {
-        deltaX[k] = x[k] - 0.5*deltaX[k];
-      }
-      newPts[one]->SetPoint(i, deltaX);
+  FirstIteration first = { offsets.data(), edges.data(), types.data(), c,
+                           x[zero], x[one], x[three] };
+  vtkSMPTools::For(0, numPts, first);
 
-      // calculate newPts[three] = c0 newPts[zero] + c1 newPts[one]
-      for (k=0; k < 3; k++)
-      {
-        deltaX[k] = c[0]*x[k] + c[1]*deltaX[k];
-      }
-      if (Verts[i].type == VTK_FIXED_VERTEX)
-      {
-        newPts[three]->SetPoint(i, newPts[zero]->GetPoint(i));
-      }
-      else
-      {
-        newPts[three]->SetPoint(i, deltaX);
-      }
-    }//if can move point
-    else
-    {
-      // point is not allowed to move, just use the old point...
-      // (zero out the Laplacian)
-      newPts[one]->SetPoint(i, zerovector);
-      newPts[three]->SetPoint(i, newPts[zero]->GetPoint(i));
-    }
-  }//for all points
-
-  // for the rest of the iterations
+  // for the rest of the iterations. The points are smoothed in parallel:
+  // each iteration only reads newPts[zero] and newPts[one], and writes the
+  // point itself in newPts[two] and newPts[three].
   for ( iterationNumber=2;
         iterationNumber <= this->NumberOfIterations;
         iterationNumber++ )
@@ -656,53 +956,10 @@ int vtkWindowedSincPolyDataFilter::RequestData(
       }
     }
 
-    for (i=0; i<numPts; i++)
-    {
-      if ( Verts[i].edges != nullptr &&
-           (npts = Verts[i].edges->GetNumberOfIds()) > 0 )
-      {
-        // point is allowed to move
-        newPts[zero]->GetPoint(i, p_x0); //use current points
-        newPts[one]->GetPoint(i, p_x1);
-
-        deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
-
-        // calculate the negative laplacian of x1
-        for (j=0; j<npts; j++)
-        {
-          newPts[one]->GetPoint(Verts[i].edges->GetId(j), y);
-          for (k=0; k<3; k++)
-          {
-            deltaX[k] += (p_x1[k] - y[k]) / npts;
-          }
-        }//for all connected points
-
-        // Taubin:  x2 = (x1 - x0) + (x1 - x2)
-        for (k=0; k<3; k++)
-        {
-          deltaX[k] = p_x1[k] - p_x0[k] + p_x1[k] - deltaX[k];
-        }
-        newPts[two]->SetPoint(i, deltaX);
-
-        // smooth the vertex (x3 = x3 + cj x2)
-        newPts[three]->GetPoint(i, p_x3);
-        for (k=0;k<3;k++)
-        {
-          xNew[k] = p_x3[k] + c[iterationNumber] * deltaX[k];
-        }
-        if (Verts[i].type != VTK_FIXED_VERTEX)
-        {
-          newPts[three]->SetPoint(i,xNew);
-        }
-      }//if can move point
-      else
-      {
-        // point is not allowed to move, just use the old point...
-        // (zero out the Laplacian)
-        newPts[one]->SetPoint(i, zerovector);
-        newPts[two]->SetPoint(i, zerovector);
-      }
-    }//for all points
+    NextIteration next = { offsets.data(), edges.data(), types.data(),
+                           c[iterationNumber], x[zero], x[one], x[two],
+                           x[three] };
+    vtkSMPTools::For(0, numPts, next);
 
     // update the pointers. three is always three. all other pointers
     // shift by one and wrap.
@@ -727,19 +984,22 @@ int vtkWindowedSincPolyDataFilter::RequestData(
 
   // if we scaled the data down to the unit cube, then scale data back
   // up to the original space
+  float *newX = x[zero];
   if (this->NormalizeCoordinates)
   {
     // Re-position the coordinated
-    double repositionedPoint[3];
-    for (i=0; i<numPts; i++)
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      newPts[zero]->GetPoint(i, repositionedPoint);
-      for (j=0; j<3; ++j)
+      for ( ; ptId < endPtId; ++ptId)
       {
-        repositionedPoint[j] = repositionedPoint[j] * inLength + inCenter[j];
+        for (int comp=0; comp<3; ++comp)
+        {
+          double repositioned = newX[3*ptId+comp];
+          repositioned = repositioned * inLength + inCenter[comp];
+          newX[3*ptId+comp] = static_cast<float>(repositioned);
+        }
       }
-      newPts[zero]->SetPoint(i,repositionedPoint);
-    }
+    });
   }
 
   // Update output. Only point coordinates have changed.
@@ -751,13 +1011,21 @@ int vtkWindowedSincPolyDataFilter::RequestData(
   {
     vtkFloatArray *newScalars = vtkFloatArray::New();
     newScalars->SetNumberOfTuples(numPts);
-    for (i=0; i<numPts; i++)
+    float *errors = newScalars->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      inPts->GetPoint(i,x1);
-      newPts[zero]->GetPoint(i,x2);
-      newScalars->SetComponent(i,0,
-                               sqrt(vtkMath::Distance2BetweenPoints(x1,x2)));
-    }
+      double p1[3], p2[3];
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        inPts->GetPoint(ptId,p1);
+        for (int comp=0; comp<3; ++comp)
+        {
+          p2[comp] = newX[3*ptId+comp];
+        }
+        errors[ptId] = static_cast<float>(
+          sqrt(vtkMath::Distance2BetweenPoints(p1,p2)));
+      }
+    });
     int idx = output->GetPointData()->AddArray(newScalars);
     output->GetPointData()->SetActiveAttribute(idx, vtkDataSetAttributes::SCALARS);
     newScalars->Delete();
@@ -768,16 +1036,20 @@ int vtkWindowedSincPolyDataFilter::RequestData(
     vtkFloatArray *newVectors = vtkFloatArray::New();
     newVectors->SetNumberOfComponents(3);
     newVectors->SetNumberOfTuples(numPts);
-    for (i=0; i<numPts; i++)
+    float *errors = newVectors->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId)
     {
-      inPts->GetPoint(i,x1);
-      newPts[zero]->GetPoint(i,x2);
-      for (j=0; j<3; j++)
+      double p1[3];
+      for ( ; ptId < endPtId; ++ptId)
       {
-        x3[j] = x2[j] - x1[j];
+        inPts->GetPoint(ptId,p1);
+        for (int comp=0; comp<3; ++comp)
+        {
+          double p2 = newX[3*ptId+comp];
+          errors[3*ptId+comp] = static_cast<float>(p2 - p1[comp]);
+        }
       }
-      newVectors->SetTuple(i,x3);
-    }
+    });
     output->GetPointData()->SetVectors(newVectors);
     newVectors->Delete();
   }
@@ -799,16 +1071,6 @@ int vtkWindowedSincPolyDataFilter::RequestData(
     inMesh->Delete();
   }
 
-  //free up connectivity storage
-  for (i=0; i<numPts; i++)
-  {
-    if ( Verts[i].edges != nullptr )
-    {
-      Verts[i].edges->Delete();
-    }
-  }
-  delete [] Verts;
-
   return 1;
 }
 
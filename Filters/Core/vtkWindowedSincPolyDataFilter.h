@@ -125,6 +125,10 @@
  * ivar GenerateErrorVectors is on, then a vector representing change in
  * position is computed.
  *
+ * The topological analysis and the smoothing iterations are performed in
+ * parallel using vtkSMPTools. The result does not depend on the number of
+ * threads.
+ *
  * @warning
  * The smoothing operation reduces high frequency information in the
  * geometry of the mesh. With excessive smoothing important details may be
@@ -0,0 +1,375 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestStreamTracerThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkStreamTracer produces the same streamlines when the seeds
+// are integrated in parallel as when they are integrated one after the
+// other (which a custom termination callback forces), with the different
+// integrators and directions, in image data, unstructured grids and on
+// surfaces, with point and cell vectors. On the surface, where the flow
+// turns around (1, 1), the streamlines must be circles.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamTracer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+
+namespace
+{
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SamePolyData(vtkPolyData* a, vtkPolyData* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+      a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType i = 0; i < a->GetNumberOfCells(); ++i)
+  {
+    a->GetCellPoints(i, ptsA);
+    b->GetCellPoints(i, ptsB);
+    if (ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < ptsA->GetNumberOfIds(); ++j)
+    {
+      if (ptsA->GetId(j) != ptsB->GetId(j))
+      {
+        return false;
+      }
+    }
+  }
+  return SameArrays(a->GetPointData(), b->GetPointData()) &&
+    SameArrays(a->GetCellData(), b->GetCellData());
+}
+
+// A swirling flow with some pressure, at the points and at the cell centers.
+void AddFlow(vtkDataSet* dataSet, bool surface)
+{
+  vtkNew<vtkDoubleArray> velocity;
+  velocity->SetName("Velocity");
+  velocity->SetNumberOfComponents(3);
+  vtkNew<vtkDoubleArray> pressure;
+  pressure->SetName("Pressure");
+  for (vtkIdType i = 0; i < dataSet->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    dataSet->GetPoint(i, x);
+    double v[3] = { -(x[1] - 1.0) + 0.2 * sin(3.0 * x[2]), x[0] - 1.0,
+                    surface ? 0.0 : 0.3 + 0.2 * cos(2.0 * x[0]) };
+    velocity->InsertNextTuple(v);
+    pressure->InsertNextValue(x[0] * x[1] + x[2]);
+  }
+  dataSet->GetPointData()->SetVectors(velocity);
+  dataSet->GetPointData()->AddArray(pressure);
+
+  vtkNew<vtkDoubleArray> cellVelocity;
+  cellVelocity->SetName("CellVelocity");
+  cellVelocity->SetNumberOfComponents(3);
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType i = 0; i < dataSet->GetNumberOfCells(); ++i)
+  {
+    dataSet->GetCellPoints(i, ptIds);
+    double v[3] = { 0.0, 0.0, 0.0 };
+    for (vtkIdType j = 0; j < ptIds->GetNumberOfIds(); ++j)
+    {
+      double* vj = velocity->GetTuple3(ptIds->GetId(j));
+      v[0] += vj[0] / ptIds->GetNumberOfIds();
+      v[1] += vj[1] / ptIds->GetNumberOfIds();
+      v[2] += vj[2] / ptIds->GetNumberOfIds();
+    }
+    cellVelocity->InsertNextTuple(v);
+  }
+  dataSet->GetCellData()->AddArray(cellVelocity);
+}
+
+vtkSmartPointer<vtkImageData> MakeImage()
+{
+  vtkSmartPointer<vtkImageData> image = vtkSmartPointer<vtkImageData>::New();
+  image->SetDimensions(21, 21, 21);
+  image->SetSpacing(0.1, 0.1, 0.1);
+  AddFlow(image, false);
+  return image;
+}
+
+// Jittered hexahedra.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  const int res = 12;
+  const double h = 2.0 / res;
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= res; ++k)
+  {
+    for (int j = 0; j <= res; ++j)
+    {
+      for (int i = 0; i <= res; ++i)
+      {
+        double jitter = (i > 0 && i < res && j > 0 && j < res && k > 0 && k < res)
+          ? 0.15 * h : 0.0;
+        points->InsertNextPoint(i * h + jitter * sin(7.0 * (i + j + k)),
+                                j * h + jitter * cos(5.0 * (i - j)),
+                                k * h + jitter * sin(3.0 * (i * j + k)));
+      }
+    }
+  }
+  vtkSmartPointer<vtkUnstructuredGrid> grid =
+    vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  const vtkIdType dj = res + 1;
+  const vtkIdType dk = (res + 1) * (res + 1);
+  for (int k = 0; k < res; ++k)
+  {
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        vtkIdType p0 = i + dj * j + dk * k;
+        vtkIdType hex[8] = { p0, p0 + 1, p0 + 1 + dj, p0 + dj, p0 + dk,
+          p0 + 1 + dk, p0 + 1 + dj + dk, p0 + dj + dk };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+      }
+    }
+  }
+  AddFlow(grid, false);
+  return grid;
+}
+
+// Triangles of a plane.
+vtkSmartPointer<vtkPolyData> MakeSurface()
+{
+  const int res = 30;
+  const double h = 2.0 / res;
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j <= res; ++j)
+  {
+    for (int i = 0; i <= res; ++i)
+    {
+      points->InsertNextPoint(i * h, j * h, 0.0);
+    }
+  }
+  vtkNew<vtkCellArray> polys;
+  for (int j = 0; j < res; ++j)
+  {
+    for (int i = 0; i < res; ++i)
+    {
+      vtkIdType p0 = i + (res + 1) * j;
+      vtkIdType tri[3] = { p0, p0 + 1, p0 + res + 2 };
+      polys->InsertNextCell(3, tri);
+      tri[1] = p0 + res + 2;
+      tri[2] = p0 + res + 1;
+      polys->InsertNextCell(3, tri);
+    }
+  }
+  vtkSmartPointer<vtkPolyData> surface = vtkSmartPointer<vtkPolyData>::New();
+  surface->SetPoints(points);
+  surface->SetPolys(polys);
+  AddFlow(surface, true);
+  return surface;
+}
+
+// Seeds on a grid, some of them out of the domain.
+vtkSmartPointer<vtkPolyData> MakeSeeds(bool surface)
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < (surface ? 1 : 5); ++k)
+  {
+    for (int j = 0; j < 12; ++j)
+    {
+      for (int i = 0; i < 12; ++i)
+      {
+        points->InsertNextPoint(-0.1 + 0.19 * i, -0.1 + 0.19 * j,
+                                surface ? 0.0 : 0.1 + 0.4 * k);
+      }
+    }
+  }
+  vtkSmartPointer<vtkPolyData> seeds = vtkSmartPointer<vtkPolyData>::New();
+  seeds->SetPoints(points);
+  return seeds;
+}
+
+bool NeverTerminate(void*, vtkPoints*, vtkDataArray*, int)
+{
+  return false;
+}
+
+vtkSmartPointer<vtkPolyData> Trace(vtkDataSet* input, vtkPolyData* seeds,
+                                   int option, bool cellVectors, bool sequential)
+{
+  vtkNew<vtkStreamTracer> tracer;
+  tracer->SetInputData(input);
+  tracer->SetSourceData(seeds);
+  if (cellVectors)
+  {
+    tracer->SetInputArrayToProcess(0, 0, 0,
+      vtkDataObject::FIELD_ASSOCIATION_CELLS, "CellVelocity");
+  }
+  tracer->SetIntegratorType(option % 3);
+  tracer->SetIntegrationDirection((option / 3) % 3);
+  tracer->SetComputeVorticity((option / 9) % 2 == 0);
+  tracer->SetIntegrationStepUnit((option / 9) % 2 ?
+    vtkStreamTracer::LENGTH_UNIT : vtkStreamTracer::CELL_LENGTH_UNIT);
+  tracer->SetInitialIntegrationStep((option / 9) % 2 ? 0.05 : 0.3);
+  tracer->SetMaximumPropagation(option % 2 ? 3.0 : 10.0);
+  tracer->SetMaximumNumberOfSteps(option % 4 ? 2000 : 60);
+  if (sequential)
+  {
+    tracer->AddCustomTerminationCallback(NeverTerminate, nullptr, 100);
+  }
+  tracer->Update();
+  return tracer->GetOutput();
+}
+
+// The point velocity on the surface, (1 - y, x - 1, 0), is interpolated
+// exactly by the triangles, and its streamlines are circles centered at
+// (1, 1): the points of each line must stay at the distance of its first
+// point.
+bool TestCircles(vtkPolyData* surface, vtkPolyData* seeds)
+{
+  vtkSmartPointer<vtkPolyData> lines;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+    vtkNew<vtkStreamTracer> tracer;
+    tracer->SetInputData(surface);
+    tracer->SetSourceData(seeds);
+    tracer->SetIntegratorTypeToRungeKutta4();
+    tracer->SetIntegrationDirectionToBoth();
+    tracer->SetIntegrationStepUnit(vtkStreamTracer::LENGTH_UNIT);
+    tracer->SetInitialIntegrationStep(0.01);
+    tracer->SetMaximumPropagation(5.0);
+    tracer->SetMaximumNumberOfSteps(2000);
+    tracer->Update();
+    lines = tracer->GetOutput();
+  });
+
+  if (lines->GetNumberOfCells() < seeds->GetNumberOfPoints() / 4)
+  {
+    cerr << "Too few circles: " << lines->GetNumberOfCells() << endl;
+    return false;
+  }
+  vtkNew<vtkIdList> pts;
+  for (vtkIdType i = 0; i < lines->GetNumberOfCells(); ++i)
+  {
+    lines->GetCellPoints(i, pts);
+    double x[3];
+    lines->GetPoint(pts->GetId(0), x);
+    double radius = sqrt((x[0] - 1.0) * (x[0] - 1.0) +
+                         (x[1] - 1.0) * (x[1] - 1.0));
+    for (vtkIdType j = 1; j < pts->GetNumberOfIds(); ++j)
+    {
+      lines->GetPoint(pts->GetId(j), x);
+      double r = sqrt((x[0] - 1.0) * (x[0] - 1.0) +
+                      (x[1] - 1.0) * (x[1] - 1.0));
+      if (fabs(r - radius) > 1e-4 || x[2] != 0.0)
+      {
+        cerr << "Streamline " << i << " is not a circle: " << r
+             << " instead of " << radius << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TestInput(vtkDataSet* input, vtkPolyData* seeds, const char* label)
+{
+  for (int option = 0; option < 18; ++option)
+  {
+    for (int cellVectors = 0; cellVectors < 2; ++cellVectors)
+    {
+      vtkSmartPointer<vtkPolyData> sequential = Trace(input, seeds, option,
+                                                      cellVectors != 0, true);
+      vtkSmartPointer<vtkPolyData> threaded;
+      vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+        threaded = Trace(input, seeds, option, cellVectors != 0, false);
+      });
+      if (sequential->GetNumberOfCells() < seeds->GetNumberOfPoints() / 4 ||
+          !SamePolyData(sequential, threaded))
+      {
+        cerr << "Wrong streamlines for " << label << " (option " << option
+             << (cellVectors ? ", cell vectors" : "") << "): "
+             << threaded->GetNumberOfPoints() << " points in "
+             << threaded->GetNumberOfCells() << " lines instead of "
+             << sequential->GetNumberOfPoints() << " points in "
+             << sequential->GetNumberOfCells() << " lines" << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestStreamTracerThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> seeds = MakeSeeds(false);
+  vtkSmartPointer<vtkPolyData> surfaceSeeds = MakeSeeds(true);
+  if (!TestInput(MakeImage(), seeds, "image data") ||
+      !TestInput(MakeGrid(), seeds, "an unstructured grid") ||
+      !TestInput(MakeSurface(), surfaceSeeds, "a surface") ||
+      !TestCircles(MakeSurface(), surfaceSeeds))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -44,8 +44,11 @@ PURPOSE.  See the above copyright notice for more information.
 #include "vtkRungeKutta2.h"
 #include "vtkRungeKutta4.h"
 #include "vtkRungeKutta45.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
 #include <vector>
 
 vtkObjectFactoryNewMacro(vtkStreamTracer)
@@ -669,6 +672,203 @@ int vtkStreamTracer::CheckInputs(vtkAbstractInterpolatedVelocityField*& func,
   return VTK_OK;
 }
 
+//---------------------------------------------------------------------------
+struct vtkStreamTracer::IntegrationState
+{
+  vtkSmartPointer<vtkAbstractInterpolatedVelocityField> Func;
+  vtkInterpolatedVelocityField* SurfaceFunc;
+  vtkSmartPointer<vtkInitialValueProblemSolver> Integrator;
+  vtkSmartPointer<vtkGenericCell> Cell;
+  std::vector<double> Weights;
+  vtkSmartPointer<vtkDoubleArray> CellVectors;
+  int VectorsType;
+  const char* VectorsName;
+
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkDataSetAttributes> PointData;
+  vtkSmartPointer<vtkDoubleArray> Time;
+  vtkSmartPointer<vtkDoubleArray> VelocityVectors;
+  vtkSmartPointer<vtkDoubleArray> Vorticity;
+  vtkSmartPointer<vtkDoubleArray> Rotation;
+  vtkSmartPointer<vtkDoubleArray> AngularVelocity;
+
+  IntegrationState() : SurfaceFunc(nullptr), VectorsType(0), VectorsName(nullptr)
+  {
+  }
+
+  // Create the integrator, scratch objects and arrays. pointData is
+  // allocated to interpolate the attributes of inputData.
+  void Initialize(vtkAbstractInterpolatedVelocityField* func,
+                  vtkInitialValueProblemSolver* integrator,
+                  int maxCellSize, int vecType, const char* vecName,
+                  bool computeVorticity, vtkDataSetAttributes* pointData,
+                  vtkPointData* inputData, vtkIdType allocationSize)
+  {
+    this->Func = func;
+    // Create a new integrator, the type is the same as Integrator
+    this->Integrator.TakeReference(integrator->NewInstance());
+    this->Integrator->SetFunctionSet(func);
+    this->Cell = vtkSmartPointer<vtkGenericCell>::New();
+    this->Weights.resize(maxCellSize);
+    this->VectorsType = vecType;
+    this->VectorsName = vecName;
+
+    // Since we do not know what the total number of points
+    // will be, we do not allocate any. This is important for
+    // cases where a lot of streamers are used at once. If we
+    // were to allocate any points here, potentially, we can
+    // waste a lot of memory if a lot of streamers are used.
+    this->Points = vtkSmartPointer<vtkPoints>::New();
+
+    // We will keep track of integration time in this array
+    this->Time = vtkSmartPointer<vtkDoubleArray>::New();
+    this->Time->SetName("IntegrationTime");
+
+    if (vecType != vtkDataObject::POINT)
+    {
+      this->VelocityVectors = vtkSmartPointer<vtkDoubleArray>::New();
+      this->VelocityVectors->SetName(vecName);
+      this->VelocityVectors->SetNumberOfComponents(3);
+    }
+    if (computeVorticity)
+    {
+      this->CellVectors = vtkSmartPointer<vtkDoubleArray>::New();
+      this->CellVectors->SetNumberOfComponents(3);
+      this->CellVectors->Allocate(3*VTK_CELL_SIZE);
+
+      this->Vorticity = vtkSmartPointer<vtkDoubleArray>::New();
+      this->Vorticity->SetName("Vorticity");
+      this->Vorticity->SetNumberOfComponents(3);
+
+      this->Rotation = vtkSmartPointer<vtkDoubleArray>::New();
+      this->Rotation->SetName("Rotation");
+
+      this->AngularVelocity = vtkSmartPointer<vtkDoubleArray>::New();
+      this->AngularVelocity->SetName("AngularVelocity");
+    }
+
+    // We will interpolate all point attributes of the input on each point of
+    // the output (unless they are turned off). Note that we are using only
+    // the first input, if there are more than one, the attributes have to match.
+    //
+    // Note: We have to use a specific value (safe to employ the maximum number
+    //       of steps) as the size of the initial memory allocation here. The
+    //       use of the default argument might incur a crash problem (due to
+    //       "insufficient memory") in the parallel mode. This is the case when
+    //       a streamline intensely shuttles between two processes in an exactly
+    //       interleaving fashion --- only one point is produced on each process
+    //       (and actually two points, after point duplication, are saved to a
+    //       vtkPolyData in vtkDistributedStreamTracer::NoBlockProcessTask) and
+    //       as a consequence a large number of such small vtkPolyData objects
+    //       are needed to represent a streamline, consuming up the memory before
+    //       the intermediate memory is timely released.
+    this->PointData = pointData;
+    this->PointData->InterpolateAllocate(inputData, allocationSize);
+  }
+};
+
+//---------------------------------------------------------------------------
+struct vtkStreamTracer::StreamlineInfo
+{
+  vtkIdType NumberOfPoints;
+  int ReasonForTermination;
+  double Propagation;
+  vtkIdType NumberOfSteps;
+  double IntegrationTime;
+  bool HasLastPoint;
+  double LastPoint[3];
+  bool HasLastUsedStepSize;
+  double LastUsedStepSize;
+  // Where the points are, when integrating in parallel
+  vtkIdType FirstPoint;
+  IntegrationState* State;
+};
+
+//---------------------------------------------------------------------------
+// Each thread integrates its seeds with its own copy of the velocity field
+// and integrator, into its own arrays. The streamlines are gathered in seed
+// order afterwards.
+struct vtkStreamTracer::IntegrateFunctor
+{
+  vtkStreamTracer* Tracer;
+  vtkDataArray* SeedSource;
+  vtkIdList* SeedIds;
+  vtkIntArray* IntegrationDirections;
+  vtkInterpolatedVelocityField* Func;
+  vtkDataSet* DataSet;
+  vtkPointData* InputData;
+  int MaxCellSize;
+  int VectorsType;
+  const char* VectorsName;
+  std::vector<StreamlineInfo>& Infos;
+  vtkSMPThreadLocal<IntegrationState> LocalState;
+
+  IntegrateFunctor(vtkStreamTracer* tracer, vtkDataArray* seedSource,
+                   vtkIdList* seedIds, vtkIntArray* integrationDirections,
+                   vtkInterpolatedVelocityField* func, vtkDataSet* dataSet,
+                   vtkPointData* inputData, int maxCellSize, int vecType,
+                   const char* vecName, std::vector<StreamlineInfo>& infos)
+    : Tracer(tracer)
+    , SeedSource(seedSource)
+    , SeedIds(seedIds)
+    , IntegrationDirections(integrationDirections)
+    , Func(func)
+    , DataSet(dataSet)
+    , InputData(inputData)
+    , MaxCellSize(maxCellSize)
+    , VectorsType(vecType)
+    , VectorsName(vecName)
+    , Infos(infos)
+  {
+  }
+
+  void Initialize()
+  {
+    // The states are kept from one batch of seeds to the next, the
+    // streamlines are gathered at the end.
+    IntegrationState& state = this->LocalState.Local();
+    if (state.Func)
+    {
+      return;
+    }
+    vtkInterpolatedVelocityField* func = this->Func->NewInstance();
+    func->CopyParameters(this->Func);
+    func->SelectVectors(this->VectorsType, this->VectorsName);
+    func->AddDataSet(this->DataSet);
+    state.Initialize(func, this->Tracer->GetIntegrator(),
+      this->MaxCellSize, this->VectorsType, this->VectorsName,
+      this->Tracer->ComputeVorticity, vtkSmartPointer<vtkPointData>::New(),
+      this->InputData, this->Tracer->MaximumNumberOfSteps);
+    func->Delete();
+  }
+
+  void operator()(vtkIdType beginLine, vtkIdType endLine)
+  {
+    IntegrationState& state = this->LocalState.Local();
+    for (vtkIdType line = beginLine; line < endLine; ++line)
+    {
+      double seed[3];
+      this->SeedSource->GetTuple(this->SeedIds->GetId(line), seed);
+      int direction =
+        this->IntegrationDirections->GetValue(line) == BACKWARD ? -1 : 1;
+
+      StreamlineInfo& info = this->Infos[line];
+      info.Propagation = 0;
+      info.NumberOfSteps = 0;
+      info.IntegrationTime = 0;
+      info.FirstPoint = state.Points->GetNumberOfPoints();
+      info.State = &state;
+      int shouldAbort = 0;
+      this->Tracer->IntegrateStreamline(state, seed, direction, info,
+                                        line, 0, shouldAbort);
+    }
+  }
+
+  void Reduce()
+  {
+  }
+};
+
 //---------------------------------------------------------------------------
 void vtkStreamTracer::Integrate(vtkPointData *input0Data,
                                 vtkPolyData* output,
@@ -692,11 +892,6 @@ void vtkStreamTracer::Integrate(vtkPointData *input0Data,
   // Useful pointers
   vtkDataSetAttributes* outputPD = output->GetPointData();
   vtkDataSetAttributes* outputCD = output->GetCellData();
-  vtkPointData* inputPD;
-  vtkDataSet* input;
-  vtkDataArray* inVectors;
-
-  int direction=1;
 
   if (this->GetIntegrator() == nullptr)
   {
@@ -704,26 +899,16 @@ void vtkStreamTracer::Integrate(vtkPointData *input0Data,
     return;
   }
 
-  double* weights = nullptr;
-  if ( maxCellSize > 0 )
-  {
-    weights = new double[maxCellSize];
-  }
-
-  // Used in GetCell()
-  vtkGenericCell* cell = vtkGenericCell::New();
-
-  // Create a new integrator, the type is the same as Integrator
-  vtkInitialValueProblemSolver* integrator =
-    this->GetIntegrator()->NewInstance();
-  integrator->SetFunctionSet(func);
+  IntegrationState state;
+  state.Initialize(func, this->GetIntegrator(), maxCellSize, vecType, vecName,
+                   this->ComputeVorticity, outputPD, input0Data,
+                   this->MaximumNumberOfSteps);
 
   // Check Surface option
-  vtkInterpolatedVelocityField* surfaceFunc = nullptr;
   if (this->SurfaceStreamlines == true)
   {
-    surfaceFunc = vtkInterpolatedVelocityField::SafeDownCast(func);
-    if (surfaceFunc == nullptr)
+    state.SurfaceFunc = vtkInterpolatedVelocityField::SafeDownCast(func);
+    if (state.SurfaceFunc == nullptr)
     {
         vtkWarningMacro(<< "Surface Streamlines works only with Point Locator "
                            "Interpolated Velocity Field, setting it off");
@@ -731,24 +916,13 @@ void vtkStreamTracer::Integrate(vtkPointData *input0Data,
     }
     else
     {
-      surfaceFunc->SetForceSurfaceTangentVector(true);
-      surfaceFunc->SetSurfaceDataset(true);
+      state.SurfaceFunc->SetForceSurfaceTangentVector(true);
+      state.SurfaceFunc->SetSurfaceDataset(true);
     }
   }
 
-  // Since we do not know what the total number of points
-  // will be, we do not allocate any. This is important for
-  // cases where a lot of streamers are used at once. If we
-  // were to allocate any points here, potentially, we can
-  // waste a lot of memory if a lot of streamers are used.
-  // Always insert the first point
-  vtkPoints* outputPoints = vtkPoints::New();
   vtkCellArray* outputLines = vtkCellArray::New();
 
-  // We will keep track of integration time in this array
-  vtkDoubleArray* time = vtkDoubleArray::New();
-  time->SetName("IntegrationTime");
-
   // This array explains why the integration stopped
   vtkIntArray* retVals = vtkIntArray::New();
   retVals->SetName("ReasonForTermination");
@@ -756,481 +930,593 @@ void vtkStreamTracer::Integrate(vtkPointData *input0Data,
   vtkIntArray* sids = vtkIntArray::New();
   sids->SetName("SeedIds");
 
-  vtkSmartPointer<vtkDoubleArray> velocityVectors;
-  if(vecType != vtkDataObject::POINT)
-  {
-    velocityVectors = vtkSmartPointer<vtkDoubleArray>::New();
-    velocityVectors->SetName(vecName);
-    velocityVectors->SetNumberOfComponents(3);
-  }
-  vtkDoubleArray* cellVectors = nullptr;
-  vtkDoubleArray* vorticity = nullptr;
-  vtkDoubleArray* rotation = nullptr;
-  vtkDoubleArray* angularVel = nullptr;
-  if (this->ComputeVorticity)
+  // The streamlines are independent of each other when the velocity field
+  // only searches a single dataset (it starts from the last one otherwise),
+  // and each one starts from a null propagation.
+  vtkInterpolatedVelocityField* parallelFunc = nullptr;
+  vtkDataSet* dataSet = nullptr;
+  if (numLines > 1 && this->CustomTerminationCallback.empty() &&
+      !this->SurfaceStreamlines && this->HasMatchingPointAttributes &&
+      propagation == 0.0 && numSteps == 0 && integrationTime == 0.0 &&
+      this->InputData)
   {
-    cellVectors = vtkDoubleArray::New();
-    cellVectors->SetNumberOfComponents(3);
-    cellVectors->Allocate(3*VTK_CELL_SIZE);
-
-    vorticity = vtkDoubleArray::New();
-    vorticity->SetName("Vorticity");
-    vorticity->SetNumberOfComponents(3);
-
-    rotation = vtkDoubleArray::New();
-    rotation->SetName("Rotation");
-
-    angularVel = vtkDoubleArray::New();
-    angularVel->SetName("AngularVelocity");
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(this->InputData->NewIterator());
+    int numDataSets = 0;
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      if (vtkDataSet* ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()))
+      {
+        dataSet = ds;
+        numDataSets++;
+      }
+    }
+    if (numDataSets == 1 && dataSet->GetNumberOfCells() > 0 &&
+        dataSet->GetPointData() == input0Data)
+    {
+      parallelFunc = vtkInterpolatedVelocityField::SafeDownCast(func);
+    }
   }
 
-  // We will interpolate all point attributes of the input on each point of
-  // the output (unless they are turned off). Note that we are using only
-  // the first input, if there are more than one, the attributes have to match.
-  //
-  // Note: We have to use a specific value (safe to employ the maximum number
-  //       of steps) as the size of the initial memory allocation here. The
-  //       use of the default argument might incur a crash problem (due to
-  //       "insufficient memory") in the parallel mode. This is the case when
-  //       a streamline intensely shuttles between two processes in an exactly
-  //       interleaving fashion --- only one point is produced on each process
-  //       (and actually two points, after point duplication, are saved to a
-  //       vtkPolyData in vtkDistributedStreamTracer::NoBlockProcessTask) and
-  //       as a consequence a large number of such small vtkPolyData objects
-  //       are needed to represent a streamline, consuming up the memory before
-  //       the intermediate memory is timely released.
-  outputPD->InterpolateAllocate( input0Data,
-                                 this->MaximumNumberOfSteps );
-
   vtkIdType numPtsTotal=0;
-  double velocity[3];
 
   int shouldAbort = 0;
 
-  for(int currentLine = 0; currentLine < numLines; currentLine++)
+  if (parallelFunc)
   {
-    double progress = static_cast<double>(currentLine)/numLines;
-    this->UpdateProgress(progress);
-
-    switch (integrationDirections->GetValue(currentLine))
+    // Build the cells, links, locators and bounds of the dataset that the
+    // velocity field uses, before they are used from several threads.
+    double x[3];
+    seedSource->GetTuple(seedIds->GetId(0), x);
+    double velocity[3];
+    parallelFunc->FunctionValues(x, velocity);
+    dataSet->GetCell(0, state.Cell);
+    if (vtkPointSet::SafeDownCast(dataSet))
     {
-      case FORWARD:
-        direction = 1;
-        break;
-      case BACKWARD:
-        direction = -1;
-        break;
+      vtkNew<vtkIdList> cellIds;
+      dataSet->GetPointCells(0, cellIds);
     }
+    dataSet->GetLength();
 
-    // temporary variables used in the integration
-    double point1[3], point2[3], pcoords[3], vort[3], omega;
-    vtkIdType index, numPts=0;
+    std::vector<StreamlineInfo> infos(numLines);
+    IntegrateFunctor functor(this, seedSource, seedIds, integrationDirections,
+                             parallelFunc, dataSet, input0Data, maxCellSize,
+                             vecType, vecName, infos);
 
-    // Clear the last cell to avoid starting a search from
-    // the last point in the streamline
-    func->ClearLastCellId();
-
-    // Initial point
-    seedSource->GetTuple(seedIds->GetId(currentLine), point1);
-    memcpy(point2, point1, 3*sizeof(double));
-    if (!func->FunctionValues(point1, velocity))
+    // The progress is reported and the abort checked between batches.
+    vtkIdType batchSize = std::max<vtkIdType>(numLines / 10, 1000);
+    for (vtkIdType batch = 0; batch < numLines && !shouldAbort;
+         batch += batchSize)
     {
-      continue;
+      this->UpdateProgress(static_cast<double>(batch)/numLines);
+      vtkSMPTools::For(batch, std::min(batch + batchSize, numLines), functor);
+      shouldAbort = this->GetAbortExecute();
     }
 
-    if ( propagation >= this->MaximumPropagation ||
-         numSteps    >  this->MaximumNumberOfSteps)
+    for(vtkIdType currentLine = 0; currentLine < numLines && !shouldAbort;
+        currentLine++)
     {
-      continue;
-    }
-
-    numPts++;
-    numPtsTotal++;
-    vtkIdType nextPoint = outputPoints->InsertNextPoint(point1);
-    double lastInsertedPoint[3];
-    outputPoints->GetPoint(nextPoint, lastInsertedPoint);
-    time->InsertNextValue(integrationTime);
-
-    // We will always pass an arc-length step size to the integrator.
-    // If the user specifies a step size in cell length unit, we will
-    // have to convert it to arc length.
-    IntervalInformation stepSize;  // either positive or negative
-    stepSize.Unit  = LENGTH_UNIT;
-    stepSize.Interval = 0;
-    IntervalInformation aStep; // always positive
-    aStep.Unit = LENGTH_UNIT;
-    double step, minStep=0, maxStep=0;
-    double stepTaken;
-    double speed;
-    double cellLength;
-    int retVal=OUT_OF_LENGTH, tmp;
-
-    // Make sure we use the dataset found by the vtkAbstractInterpolatedVelocityField
-    input = func->GetLastDataSet();
-    inputPD = input->GetPointData();
-    inVectors = input->GetAttributesAsFieldData(vecType)->GetArray(vecName);
-    // Convert intervals to arc-length unit
-    input->GetCell(func->GetLastCellId(), cell);
-    cellLength = sqrt(static_cast<double>(cell->GetLength2()));
-    speed = vtkMath::Norm(velocity);
-    // Never call conversion methods if speed == 0
-    if ( speed != 0.0 )
-    {
-      this->ConvertIntervals( stepSize.Interval, minStep, maxStep,
-                              direction, cellLength );
-    }
-
-    // Interpolate all point attributes on first point
-    func->GetLastWeights(weights);
-    InterpolatePoint(outputPD, inputPD, nextPoint, cell->PointIds, weights, this->HasMatchingPointAttributes);
-    // handle both point and cell velocity attributes.
-    vtkDataArray* outputVelocityVectors = outputPD->GetArray(vecName);
-    if(vecType != vtkDataObject::POINT)
-    {
-      velocityVectors->InsertNextTuple(velocity);
-      outputVelocityVectors = velocityVectors;
-    }
-
-    // Compute vorticity if required
-    // This can be used later for streamribbon generation.
-    if (this->ComputeVorticity)
-    {
-      if(vecType == vtkDataObject::POINT)
+      StreamlineInfo& info = infos[currentLine];
+      if (info.HasLastPoint)
       {
-        inVectors->GetTuples(cell->PointIds, cellVectors);
-        func->GetLastLocalCoordinates(pcoords);
-        vtkStreamTracer::CalculateVorticity(cell, pcoords, cellVectors, vort);
+        memcpy(lastPoint, info.LastPoint, 3*sizeof(double));
       }
-      else
+      if (info.HasLastUsedStepSize)
       {
-        vort[0] = 0;
-        vort[1] = 0;
-        vort[2] = 0;
-      }
-      vorticity->InsertNextTuple(vort);
-      // rotation
-      // local rotation = vorticity . unit tangent ( i.e. velocity/speed )
-      if (speed != 0.0)
-      {
-        omega = vtkMath::Dot(vort, velocity);
-        omega /= speed;
-        omega *= this->RotationScale;
+        this->LastUsedStepSize = info.LastUsedStepSize;
       }
-      else
+      vtkIdType numPts = info.NumberOfPoints;
+      if (numPts == 0)
       {
-        omega = 0.0;
+        continue;
       }
-      angularVel->InsertNextValue(omega);
-      rotation->InsertNextValue(0.0);
-    }
-
-    double error = 0;
 
-    // Integrate until the maximum propagation length is reached,
-    // maximum number of steps is reached or until a boundary is encountered.
-    // Begin Integration
-    while ( propagation < this->MaximumPropagation )
-    {
-
-      if (numSteps > this->MaximumNumberOfSteps)
+      IntegrationState* local = info.State;
+      state.Points->InsertPoints(numPtsTotal, numPts, info.FirstPoint,
+                                 local->Points);
+      for (int i = 0; i < state.PointData->GetNumberOfArrays(); ++i)
       {
-        retVal = OUT_OF_STEPS;
-        break;
+        state.PointData->GetAbstractArray(i)->InsertTuples(numPtsTotal,
+          numPts, info.FirstPoint, local->PointData->GetAbstractArray(i));
       }
-
-      bool endIntegration = false;
-      for (std::size_t i = 0; i < this->CustomTerminationCallback.size(); ++i)
+      vtkDoubleArray* arrays[] = { state.Time, state.VelocityVectors,
+        state.Vorticity, state.Rotation, state.AngularVelocity };
+      vtkDoubleArray* localArrays[] = { local->Time, local->VelocityVectors,
+        local->Vorticity, local->Rotation, local->AngularVelocity };
+      for (int i = 0; i < 5; ++i)
       {
-        if(this->CustomTerminationCallback[i](this->CustomTerminationClientData[i],
-                                              outputPoints, outputVelocityVectors, direction))
+        if (arrays[i])
         {
-          retVal = this->CustomReasonForTermination[i];
-          endIntegration = true;
-          break;
+          arrays[i]->InsertTuples(numPtsTotal, numPts, info.FirstPoint,
+                                  localArrays[i]);
         }
       }
-      if (endIntegration)
-      {
-        break;
-      }
+      numPtsTotal += numPts;
 
-      if ( numSteps++ % 1000 == 1 )
+      if (numPts > 1)
       {
-        progress =
-          ( currentLine + propagation / this->MaximumPropagation ) / numLines;
-        this->UpdateProgress(progress);
-
-        if (this->GetAbortExecute())
+        outputLines->InsertNextCell(numPts);
+        for (vtkIdType i=numPtsTotal-numPts; i<numPtsTotal; i++)
         {
-          shouldAbort = 1;
-          break;
+          outputLines->InsertCellPoint(i);
         }
+        retVals->InsertNextValue(info.ReasonForTermination);
+        sids->InsertNextValue(seedIds->GetId(currentLine));
       }
 
-      // Never call conversion methods if speed == 0
-      if ( (speed == 0) || (speed <= this->TerminalSpeed) )
+      inPropagation = info.Propagation;
+      inNumSteps = info.NumberOfSteps;
+      inIntegrationTime = info.IntegrationTime;
+    }
+  }
+  else
+  {
+    StreamlineInfo info;
+    for(int currentLine = 0; currentLine < numLines; currentLine++)
+    {
+      double progress = static_cast<double>(currentLine)/numLines;
+      this->UpdateProgress(progress);
+
+      double seed[3];
+      seedSource->GetTuple(seedIds->GetId(currentLine), seed);
+      int direction =
+        integrationDirections->GetValue(currentLine) == BACKWARD ? -1 : 1;
+
+      info.Propagation = propagation;
+      info.NumberOfSteps = numSteps;
+      info.IntegrationTime = integrationTime;
+      this->IntegrateStreamline(state, seed, direction, info, currentLine,
+                                numLines, shouldAbort);
+      if (info.HasLastPoint)
       {
-        retVal = STAGNATION;
-        break;
+        memcpy(lastPoint, info.LastPoint, 3*sizeof(double));
       }
-
-      // If, with the next step, propagation will be larger than
-      // max, reduce it so that it is (approximately) equal to max.
-      aStep.Interval = fabs( stepSize.Interval );
-
-      if ( ( propagation + aStep.Interval ) > this->MaximumPropagation )
+      if (info.HasLastUsedStepSize)
       {
-        aStep.Interval = this->MaximumPropagation - propagation;
-        if ( stepSize.Interval >= 0 )
-        {
-          stepSize.Interval = this->ConvertToLength( aStep, cellLength );
-        }
-        else
-        {
-          stepSize.Interval = this->ConvertToLength( aStep, cellLength ) * ( -1.0 );
-        }
-        maxStep = stepSize.Interval;
+        this->LastUsedStepSize = info.LastUsedStepSize;
       }
-      this->LastUsedStepSize = stepSize.Interval;
-
-      // Calculate the next step using the integrator provided
-      // Break if the next point is out of bounds.
-      func->SetNormalizeVector( true );
-      tmp = integrator->ComputeNextStep( point1, point2, 0, stepSize.Interval,
-                                         stepTaken, minStep, maxStep,
-                                         this->MaximumError, error );
-      func->SetNormalizeVector( false );
-      if ( tmp != 0 )
+      vtkIdType numPts = info.NumberOfPoints;
+      if (numPts == 0)
       {
-        retVal = tmp;
-        memcpy(lastPoint, point2, 3*sizeof(double));
-        break;
+        continue;
       }
+      numPtsTotal += numPts;
 
-      // This is the next starting point
-      if (this->SurfaceStreamlines && surfaceFunc != nullptr)
+      if (shouldAbort)
       {
-        if (surfaceFunc->SnapPointOnCell(point2, point1) != 1)
-        {
-          retVal = OUT_OF_DOMAIN;
-          memcpy(lastPoint, point2, 3 * sizeof(double));
-          break;
-        }
+        break;
       }
-      else
+
+      if (numPts > 1)
       {
-        for (int i = 0; i < 3; i++)
+        outputLines->InsertNextCell(numPts);
+        for (vtkIdType i=numPtsTotal-numPts; i<numPtsTotal; i++)
         {
-          point1[i] = point2[i];
+          outputLines->InsertCellPoint(i);
         }
+        retVals->InsertNextValue(info.ReasonForTermination);
+        sids->InsertNextValue(seedIds->GetId(currentLine));
       }
 
-      // Interpolate the velocity at the next point
-      if ( !func->FunctionValues(point2, velocity) )
-      {
-        retVal = OUT_OF_DOMAIN;
-        memcpy(lastPoint, point2, 3*sizeof(double));
-        break;
-      }
+      // Initialize these to 0 before starting the next line.
+      // The values passed in the function call are only used
+      // for the first line.
+      inPropagation = info.Propagation;
+      inNumSteps = info.NumberOfSteps;
+      inIntegrationTime = info.IntegrationTime;
 
-      // It is not enough to use the starting point for stagnation calculation
-      // Use average speed to check if it is below stagnation threshold
-      double speed2 = vtkMath::Norm(velocity);
-      if ( (speed+speed2)/2 <= this->TerminalSpeed )
+      propagation = 0;
+      numSteps = 0;
+      integrationTime = 0;
+    }
+  }
+
+  if (!shouldAbort)
+  {
+    // Create the output polyline
+    output->SetPoints(state.Points);
+    outputPD->AddArray(state.Time);
+    if(vecType != vtkDataObject::POINT)
+    {
+      outputPD->AddArray(state.VelocityVectors);
+    }
+    if (state.Vorticity)
+    {
+      outputPD->AddArray(state.Vorticity);
+      outputPD->AddArray(state.Rotation);
+      outputPD->AddArray(state.AngularVelocity);
+    }
+
+    vtkIdType numPts = state.Points->GetNumberOfPoints();
+    if ( numPts > 1 )
+    {
+      // Assign geometry and attributes
+      output->SetLines(outputLines);
+      if (this->GenerateNormalsInIntegrate)
       {
-        retVal = STAGNATION;
-        break;
+        this->GenerateNormals(output, nullptr, vecName);
       }
 
-      integrationTime += stepTaken / speed;
-      // Calculate propagation (using the same units as MaximumPropagation
-      propagation += fabs( stepSize.Interval );
+      outputCD->AddArray(retVals);
+      outputCD->AddArray(sids);
+    }
+  }
 
-      // Make sure we use the dataset found by the vtkAbstractInterpolatedVelocityField
-      input = func->GetLastDataSet();
-      inputPD = input->GetPointData();
-      inVectors = input->GetAttributesAsFieldData(vecType)->GetArray(vecName);
+  retVals->Delete();
+  sids->Delete();
 
-      // Calculate cell length and speed to be used in unit conversions
-      input->GetCell(func->GetLastCellId(), cell);
-      cellLength = sqrt(static_cast<double>(cell->GetLength2()));
-      speed = speed2;
+  outputLines->Delete();
 
-      // Check if conversion to float will produce a point in same place
-      float convertedPoint[3];
-      for (int i = 0; i < 3; i++)
-      {
-        convertedPoint[i] = point1[i];
-      }
-      if (lastInsertedPoint[0] != convertedPoint[0] ||
-          lastInsertedPoint[1] != convertedPoint[1] ||
-          lastInsertedPoint[2] != convertedPoint[2])
+  output->Squeeze();
+}
+
+//---------------------------------------------------------------------------
+void vtkStreamTracer::IntegrateStreamline(IntegrationState& state,
+                                          double seed[3],
+                                          int direction,
+                                          StreamlineInfo& info,
+                                          vtkIdType currentLine,
+                                          vtkIdType numLines,
+                                          int& shouldAbort)
+{
+  vtkAbstractInterpolatedVelocityField* func = state.Func;
+  vtkInitialValueProblemSolver* integrator = state.Integrator;
+  vtkInterpolatedVelocityField* surfaceFunc = state.SurfaceFunc;
+  vtkGenericCell* cell = state.Cell;
+  double* weights = state.Weights.empty() ? nullptr : &state.Weights[0];
+  vtkDoubleArray* cellVectors = state.CellVectors;
+  int vecType = state.VectorsType;
+  const char* vecName = state.VectorsName;
+
+  vtkPoints* outputPoints = state.Points;
+  vtkDataSetAttributes* outputPD = state.PointData;
+  vtkDoubleArray* time = state.Time;
+  vtkDoubleArray* velocityVectors = state.VelocityVectors;
+  vtkDoubleArray* vorticity = state.Vorticity;
+  vtkDoubleArray* rotation = state.Rotation;
+  vtkDoubleArray* angularVel = state.AngularVelocity;
+
+  double& propagation = info.Propagation;
+  vtkIdType& numSteps = info.NumberOfSteps;
+  double& integrationTime = info.IntegrationTime;
+  info.NumberOfPoints = 0;
+  info.HasLastPoint = false;
+  info.HasLastUsedStepSize = false;
+
+  vtkPointData* inputPD;
+  vtkDataSet* input;
+  vtkDataArray* inVectors;
+  double velocity[3];
+  double progress;
+
+  // temporary variables used in the integration
+  double point1[3], point2[3], pcoords[3], vort[3], omega;
+  vtkIdType index, numPts=0;
+
+  // Clear the last cell to avoid starting a search from
+  // the last point in the streamline
+  func->ClearLastCellId();
+
+  // Initial point
+  memcpy(point1, seed, 3*sizeof(double));
+  memcpy(point2, point1, 3*sizeof(double));
+  if (!func->FunctionValues(point1, velocity))
+  {
+    return;
+  }
+
+  if ( propagation >= this->MaximumPropagation ||
+       numSteps    >  this->MaximumNumberOfSteps)
+  {
+    return;
+  }
+
+  numPts++;
+  vtkIdType nextPoint = outputPoints->InsertNextPoint(point1);
+  double lastInsertedPoint[3];
+  outputPoints->GetPoint(nextPoint, lastInsertedPoint);
+  time->InsertNextValue(integrationTime);
+
+  // We will always pass an arc-length step size to the integrator.
+  // If the user specifies a step size in cell length unit, we will
+  // have to convert it to arc length.
+  IntervalInformation stepSize;  // either positive or negative
+  stepSize.Unit  = LENGTH_UNIT;
+  stepSize.Interval = 0;
+  IntervalInformation aStep; // always positive
+  aStep.Unit = LENGTH_UNIT;
+  double step, minStep=0, maxStep=0;
+  double stepTaken;
+  double speed;
+  double cellLength;
+  int retVal=OUT_OF_LENGTH, tmp;
+
+  // Make sure we use the dataset found by the vtkAbstractInterpolatedVelocityField
+  input = func->GetLastDataSet();
+  inputPD = input->GetPointData();
+  inVectors = input->GetAttributesAsFieldData(vecType)->GetArray(vecName);
+  // Convert intervals to arc-length unit
+  input->GetCell(func->GetLastCellId(), cell);
+  cellLength = sqrt(static_cast<double>(cell->GetLength2()));
+  speed = vtkMath::Norm(velocity);
+  // Never call conversion methods if speed == 0
+  if ( speed != 0.0 )
+  {
+    this->ConvertIntervals( stepSize.Interval, minStep, maxStep,
+                            direction, cellLength );
+  }
+
+  // Interpolate all point attributes on first point
+  func->GetLastWeights(weights);
+  InterpolatePoint(outputPD, inputPD, nextPoint, cell->PointIds, weights, this->HasMatchingPointAttributes);
+  // handle both point and cell velocity attributes.
+  vtkDataArray* outputVelocityVectors = outputPD->GetArray(vecName);
+  if(vecType != vtkDataObject::POINT)
+  {
+    velocityVectors->InsertNextTuple(velocity);
+    outputVelocityVectors = velocityVectors;
+  }
+
+  // Compute vorticity if required
+  // This can be used later for streamribbon generation.
+  if (this->ComputeVorticity)
+  {
+    if(vecType == vtkDataObject::POINT)
+    {
+      inVectors->GetTuples(cell->PointIds, cellVectors);
+      func->GetLastLocalCoordinates(pcoords);
+      vtkStreamTracer::CalculateVorticity(cell, pcoords, cellVectors, vort);
+    }
+    else
+    {
+      vort[0] = 0;
+      vort[1] = 0;
+      vort[2] = 0;
+    }
+    vorticity->InsertNextTuple(vort);
+    // rotation
+    // local rotation = vorticity . unit tangent ( i.e. velocity/speed )
+    if (speed != 0.0)
+    {
+      omega = vtkMath::Dot(vort, velocity);
+      omega /= speed;
+      omega *= this->RotationScale;
+    }
+    else
+    {
+      omega = 0.0;
+    }
+    angularVel->InsertNextValue(omega);
+    rotation->InsertNextValue(0.0);
+  }
+
+  double error = 0;
+
+  // Integrate until the maximum propagation length is reached,
+  // maximum number of steps is reached or until a boundary is encountered.
+  // Begin Integration
+  while ( propagation < this->MaximumPropagation )
+  {
+
+    if (numSteps > this->MaximumNumberOfSteps)
+    {
+      retVal = OUT_OF_STEPS;
+      break;
+    }
+
+    bool endIntegration = false;
+    for (std::size_t i = 0; i < this->CustomTerminationCallback.size(); ++i)
+    {
+      if(this->CustomTerminationCallback[i](this->CustomTerminationClientData[i],
+                                            outputPoints, outputVelocityVectors, direction))
       {
-        // Point is valid. Insert it.
-        numPts++;
-        numPtsTotal++;
-        nextPoint = outputPoints->InsertNextPoint(point1);
-        outputPoints->GetPoint(nextPoint, lastInsertedPoint);
-        time->InsertNextValue(integrationTime);
-
-        // Interpolate all point attributes on current point
-        func->GetLastWeights(weights);
-        InterpolatePoint(outputPD, inputPD, nextPoint, cell->PointIds, weights, this->HasMatchingPointAttributes);
-
-        if(vecType != vtkDataObject::POINT)
-        {
-          velocityVectors->InsertNextTuple(velocity);
-        }
-        // Compute vorticity if required
-        // This can be used later for streamribbon generation.
-        if (this->ComputeVorticity)
-        {
-          if(vecType == vtkDataObject::POINT)
-          {
-            inVectors->GetTuples(cell->PointIds, cellVectors);
-            func->GetLastLocalCoordinates(pcoords);
-            vtkStreamTracer::CalculateVorticity(cell, pcoords, cellVectors, vort);
-          }
-          else
-          {
-            vort[0] = 0;
-            vort[1] = 0;
-            vort[2] = 0;
-          }
-          vorticity->InsertNextTuple(vort);
-          // rotation
-          // angular velocity = vorticity . unit tangent ( i.e. velocity/speed )
-          // rotation = sum ( angular velocity * stepSize )
-          omega = vtkMath::Dot(vort, velocity);
-          omega /= speed;
-          omega *= this->RotationScale;
-          index = angularVel->InsertNextValue(omega);
-          rotation->InsertNextValue(rotation->GetValue(index-1) +
-                                    (angularVel->GetValue(index-1) + omega)/2 *
-                                    (integrationTime - time->GetValue(index-1)));
-        }
+        retVal = this->CustomReasonForTermination[i];
+        endIntegration = true;
+        break;
       }
+    }
+    if (endIntegration)
+    {
+      break;
+    }
 
-      // Never call conversion methods if speed == 0
-      if ( (speed == 0) || (speed <= this->TerminalSpeed) )
+    if ( numSteps++ % 1000 == 1 && numLines > 0 )
+    {
+      progress =
+        ( currentLine + propagation / this->MaximumPropagation ) / numLines;
+      this->UpdateProgress(progress);
+
+      if (this->GetAbortExecute())
       {
-        retVal = STAGNATION;
+        shouldAbort = 1;
         break;
       }
+    }
 
-      // Convert all intervals to arc length
-      this->ConvertIntervals( step, minStep, maxStep, direction, cellLength );
+    // Never call conversion methods if speed == 0
+    if ( (speed == 0) || (speed <= this->TerminalSpeed) )
+    {
+      retVal = STAGNATION;
+      break;
+    }
 
+    // If, with the next step, propagation will be larger than
+    // max, reduce it so that it is (approximately) equal to max.
+    aStep.Interval = fabs( stepSize.Interval );
 
-      // If the solver is adaptive and the next step size (stepSize.Interval)
-      // that the solver wants to use is smaller than minStep or larger
-      // than maxStep, re-adjust it. This has to be done every step
-      // because minStep and maxStep can change depending on the cell
-      // size (unless it is specified in arc-length unit)
-      if (integrator->IsAdaptive())
+    if ( ( propagation + aStep.Interval ) > this->MaximumPropagation )
+    {
+      aStep.Interval = this->MaximumPropagation - propagation;
+      if ( stepSize.Interval >= 0 )
       {
-        if (fabs(stepSize.Interval) < fabs(minStep))
-        {
-          stepSize.Interval = fabs( minStep ) *
-                                stepSize.Interval / fabs( stepSize.Interval );
-        }
-        else if (fabs(stepSize.Interval) > fabs(maxStep))
-        {
-          stepSize.Interval = fabs( maxStep ) *
-                                stepSize.Interval / fabs( stepSize.Interval );
-        }
+        stepSize.Interval = this->ConvertToLength( aStep, cellLength );
       }
       else
       {
-        stepSize.Interval = step;
+        stepSize.Interval = this->ConvertToLength( aStep, cellLength ) * ( -1.0 );
       }
+      maxStep = stepSize.Interval;
     }
+    info.LastUsedStepSize = stepSize.Interval;
+    info.HasLastUsedStepSize = true;
 
-    if (shouldAbort)
+    // Calculate the next step using the integrator provided
+    // Break if the next point is out of bounds.
+    func->SetNormalizeVector( true );
+    tmp = integrator->ComputeNextStep( point1, point2, 0, stepSize.Interval,
+                                       stepTaken, minStep, maxStep,
+                                       this->MaximumError, error );
+    func->SetNormalizeVector( false );
+    if ( tmp != 0 )
     {
+      retVal = tmp;
+      memcpy(info.LastPoint, point2, 3*sizeof(double));
+      info.HasLastPoint = true;
       break;
     }
 
-    if (numPts > 1)
+    // This is the next starting point
+    if (this->SurfaceStreamlines && surfaceFunc != nullptr)
     {
-      outputLines->InsertNextCell(numPts);
-      for (int i=numPtsTotal-numPts; i<numPtsTotal; i++)
+      if (surfaceFunc->SnapPointOnCell(point2, point1) != 1)
       {
-        outputLines->InsertCellPoint(i);
+        retVal = OUT_OF_DOMAIN;
+        memcpy(info.LastPoint, point2, 3*sizeof(double));
+        info.HasLastPoint = true;
+        break;
       }
-      retVals->InsertNextValue(retVal);
-      sids->InsertNextValue(seedIds->GetId(currentLine));
     }
-
-    // Initialize these to 0 before starting the next line.
-    // The values passed in the function call are only used
-    // for the first line.
-    inPropagation = propagation;
-    inNumSteps = numSteps;
-    inIntegrationTime = integrationTime;
-
-    propagation = 0;
-    numSteps = 0;
-    integrationTime = 0;
-  }
-
-  if (!shouldAbort)
-  {
-    // Create the output polyline
-    output->SetPoints(outputPoints);
-    outputPD->AddArray(time);
-    if(vecType != vtkDataObject::POINT)
+    else
     {
-      outputPD->AddArray(velocityVectors);
+      for (int i = 0; i < 3; i++)
+      {
+        point1[i] = point2[i];
+      }
     }
-    if (vorticity)
+
+    // Interpolate the velocity at the next point
+    if ( !func->FunctionValues(point2, velocity) )
     {
-      outputPD->AddArray(vorticity);
-      outputPD->AddArray(rotation);
-      outputPD->AddArray(angularVel);
+      retVal = OUT_OF_DOMAIN;
+      memcpy(info.LastPoint, point2, 3*sizeof(double));
+      info.HasLastPoint = true;
+      break;
     }
 
-    vtkIdType numPts = outputPoints->GetNumberOfPoints();
-    if ( numPts > 1 )
+    // It is not enough to use the starting point for stagnation calculation
+    // Use average speed to check if it is below stagnation threshold
+    double speed2 = vtkMath::Norm(velocity);
+    if ( (speed+speed2)/2 <= this->TerminalSpeed )
     {
-      // Assign geometry and attributes
-      output->SetLines(outputLines);
-      if (this->GenerateNormalsInIntegrate)
-      {
-        this->GenerateNormals(output, nullptr, vecName);
-      }
-
-      outputCD->AddArray(retVals);
-      outputCD->AddArray(sids);
+      retVal = STAGNATION;
+      break;
     }
-  }
 
-  if (vorticity)
-  {
-    vorticity->Delete();
-    rotation->Delete();
-    angularVel->Delete();
-  }
+    integrationTime += stepTaken / speed;
+    // Calculate propagation (using the same units as MaximumPropagation
+    propagation += fabs( stepSize.Interval );
 
-  if (cellVectors)
-  {
-    cellVectors->Delete();
-  }
-  retVals->Delete();
-  sids->Delete();
+    // Make sure we use the dataset found by the vtkAbstractInterpolatedVelocityField
+    input = func->GetLastDataSet();
+    inputPD = input->GetPointData();
+    inVectors = input->GetAttributesAsFieldData(vecType)->GetArray(vecName);
 
-  outputPoints->Delete();
-  outputLines->Delete();
+    // Calculate cell length and speed to be used in unit conversions
+    input->GetCell(func->GetLastCellId(), cell);
+    cellLength = sqrt(static_cast<double>(cell->GetLength2()));
+    speed = speed2;
 
-  time->Delete();
+    // Check if conversion to float will produce a point in same place
+    float convertedPoint[3];
+    for (int i = 0; i < 3; i++)
+    {
+      convertedPoint[i] = point1[i];
+    }
+    if (lastInsertedPoint[0] != convertedPoint[0] ||
+        lastInsertedPoint[1] != convertedPoint[1] ||
+        lastInsertedPoint[2] != convertedPoint[2])
+    {
+      // Point is valid. Insert it.
+      numPts++;
+      nextPoint = outputPoints->InsertNextPoint(point1);
+      outputPoints->GetPoint(nextPoint, lastInsertedPoint);
+      time->InsertNextValue(integrationTime);
 
+      // Interpolate all point attributes on current point
+      func->GetLastWeights(weights);
+      InterpolatePoint(outputPD, inputPD, nextPoint, cell->PointIds, weights, this->HasMatchingPointAttributes);
 
-  integrator->Delete();
-  cell->Delete();
+      if(vecType != vtkDataObject::POINT)
+      {
+        velocityVectors->InsertNextTuple(velocity);
+      }
+      // Compute vorticity if required
+      // This can be used later for streamribbon generation.
+      if (this->ComputeVorticity)
+      {
+        if(vecType == vtkDataObject::POINT)
+        {
+          inVectors->GetTuples(cell->PointIds, cellVectors);
+          func->GetLastLocalCoordinates(pcoords);
+          vtkStreamTracer::CalculateVorticity(cell, pcoords, cellVectors, vort);
+        }
+        else
+        {
+          vort[0] = 0;
+          vort[1] = 0;
+          vort[2] = 0;
+        }
+        vorticity->InsertNextTuple(vort);
+        // rotation
+        // angular velocity = vorticity . unit tangent ( i.e. velocity/speed )
+        // rotation = sum ( angular velocity * stepSize )
+        omega = vtkMath::Dot(vort, velocity);
+        omega /= speed;
+        omega *= this->RotationScale;
+        index = angularVel->InsertNextValue(omega);
+        rotation->InsertNextValue(rotation->GetValue(index-1) +
+                                  (angularVel->GetValue(index-1) + omega)/2 *
+                                  (integrationTime - time->GetValue(index-1)));
+      }
+    }
 
-  delete[] weights;
+    // Never call conversion methods if speed == 0
+    if ( (speed == 0) || (speed <= this->TerminalSpeed) )
+    {
+      retVal = STAGNATION;
+      break;
+    }
 
-  output->Squeeze();
+    // Convert all intervals to arc length
+    this->ConvertIntervals( step, minStep, maxStep, direction, cellLength );
+
+
+    // If the solver is adaptive and the next step size (stepSize.Interval)
+    // that the solver wants to use is smaller than minStep or larger
+    // than maxStep, re-adjust it. This has to be done every step
+    // because minStep and maxStep can change depending on the cell
+    // size (unless it is specified in arc-length unit)
+    if (integrator->IsAdaptive())
+    {
+      if (fabs(stepSize.Interval) < fabs(minStep))
+      {
+        stepSize.Interval = fabs( minStep ) *
+                              stepSize.Interval / fabs( stepSize.Interval );
+      }
+      else if (fabs(stepSize.Interval) > fabs(maxStep))
+      {
+        stepSize.Interval = fabs( maxStep ) *
+                              stepSize.Interval / fabs( stepSize.Interval );
+      }
+    }
+    else
+    {
+      stepSize.Interval = step;
+    }
+  }
+
+  info.NumberOfPoints = numPts;
+  info.ReasonForTermination = retVal;
 }
 
 //---------------------------------------------------------------------------
@@ -69,6 +69,15 @@
  * a source object, traces will be generated from each point in the source
  * that is inside the dataset.
  *
+ * When there are several seeds, the input is a single dataset and the
+ * interpolator is a vtkInterpolatedVelocityField (the default), the
+ * streamlines are integrated in parallel using vtkSMPTools, each thread
+ * with its own copy of the interpolator and integrator. They are then
+ * gathered in seed order, so the output is the same as when they are
+ * integrated one after the other. With custom termination callbacks,
+ * surface streamlines or composite inputs, the seeds are integrated
+ * sequentially.
+ *
  * @sa
  * vtkRibbonFilter vtkRuledSurfaceFilter vtkInitialValueProblemSolver
  * vtkRungeKutta2 vtkRungeKutta4 vtkRungeKutta45 vtkParticleTracerBase
@@ -413,6 +422,39 @@ protected:
                  double& propagation,
                  vtkIdType& numSteps,
                  double& integrationTime);
+
+  /**
+   * The objects used to integrate streamlines and the arrays the points and
+   * their attributes are appended to. Integrate() uses the output arrays
+   * directly when integrating the seeds sequentially, and one state per
+   * thread in parallel.
+   */
+  struct IntegrationState;
+
+  /**
+   * What integrating a streamline produced, besides its points. The
+   * propagation, number of steps and integration time are also the values
+   * the integration starts from.
+   */
+  struct StreamlineInfo;
+
+  /**
+   * Integrates the seeds in parallel for Integrate().
+   */
+  struct IntegrateFunctor;
+
+  /**
+   * Integrate the streamline starting at seed in the given direction (1 or
+   * -1), appending its points to the arrays of state. info.NumberOfPoints is
+   * 0 if the seed is out of the domain or the limits are already reached.
+   * The progress is reported and the abort checked only if numLines is
+   * positive, shouldAbort is then set if the execution is aborted.
+   */
+  void IntegrateStreamline(IntegrationState& state, double seed[3],
+                           int direction, StreamlineInfo& info,
+                           vtkIdType currentLine, vtkIdType numLines,
+                           int& shouldAbort);
+
   double SimpleIntegrate(double seed[3],
                          double lastPoint[3],
                          double stepSize,
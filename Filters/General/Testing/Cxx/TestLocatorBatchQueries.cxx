@@ -0,0 +1,247 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestLocatorBatchQueries.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the batched queries of the point and cell locators, processed
+// in parallel by the locators whose queries are thread safe, return the
+// same results as the queries of the positions one after the other. The
+// cell locators are run on grids with 64-bit, 32-bit and legacy cell
+// storage, since their parallel queries rely on vtkDataSet::GetCell() being
+// thread safe for each of them.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkCellArray.h"
+#include "vtkCellLocator.h"
+#include "vtkCellTreeLocator.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkKdTreePointLocator.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointLocator.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkStaticPointLocator.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vector>
+
+namespace
+{
+
+// Jittered hexahedra in the unit cube.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  const int res = 15;
+  const double h = 1.0 / res;
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= res; ++k)
+  {
+    for (int j = 0; j <= res; ++j)
+    {
+      for (int i = 0; i <= res; ++i)
+      {
+        double jitter = (i > 0 && i < res && j > 0 && j < res && k > 0 && k < res)
+          ? 0.15 * h : 0.0;
+        points->InsertNextPoint(i * h + jitter * sin(7.0 * (i + j + k)),
+                                j * h + jitter * cos(5.0 * (i - j)),
+                                k * h + jitter * sin(3.0 * (i * j + k)));
+      }
+    }
+  }
+  vtkSmartPointer<vtkUnstructuredGrid> grid =
+    vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  const vtkIdType dj = res + 1;
+  const vtkIdType dk = (res + 1) * (res + 1);
+  for (int k = 0; k < res; ++k)
+  {
+    for (int j = 0; j < res; ++j)
+    {
+      for (int i = 0; i < res; ++i)
+      {
+        vtkIdType p0 = i + dj * j + dk * k;
+        vtkIdType hex[8] = { p0, p0 + 1, p0 + 1 + dj, p0 + dj, p0 + dk,
+          p0 + 1 + dk, p0 + 1 + dj + dk, p0 + dj + dk };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+      }
+    }
+  }
+  return grid;
+}
+
+bool TestPointLocator(vtkAbstractPointLocator* locator,
+                      const std::vector<double>& x)
+{
+  const vtkIdType numPts = static_cast<vtkIdType>(x.size() / 3);
+  const double radius = 0.1;
+  std::vector<vtkIdType> ptIds(numPts);
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> ids;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+    locator->FindClosestPoints(numPts, x.data(), ptIds.data());
+    locator->FindPointsWithinRadius(radius, numPts, x.data(), offsets, ids);
+  });
+
+  if (offsets->GetNumberOfValues() != numPts + 1 || offsets->GetValue(0) != 0 ||
+      ids->GetNumberOfValues() != offsets->GetValue(numPts))
+  {
+    cerr << locator->GetClassName() << ": wrong number of points within radius"
+         << endl;
+    return false;
+  }
+  vtkNew<vtkIdList> result;
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    if (ptIds[i] != locator->FindClosestPoint(x.data() + 3 * i))
+    {
+      cerr << locator->GetClassName() << ": wrong closest point " << ptIds[i]
+           << " for position " << i << endl;
+      return false;
+    }
+    locator->FindPointsWithinRadius(radius, x.data() + 3 * i, result);
+    vtkIdType numIds = offsets->GetValue(i + 1) - offsets->GetValue(i);
+    bool same = numIds == result->GetNumberOfIds();
+    for (vtkIdType j = 0; same && j < numIds; ++j)
+    {
+      same = ids->GetValue(offsets->GetValue(i) + j) == result->GetId(j);
+    }
+    if (!same)
+    {
+      cerr << locator->GetClassName() << ": wrong points within radius for "
+           << "position " << i << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestCellLocator(vtkAbstractCellLocator* locator,
+                     const std::vector<double>& x, int maxCellSize)
+{
+  const vtkIdType numPts = static_cast<vtkIdType>(x.size() / 3);
+  std::vector<vtkIdType> cellIds(numPts);
+  std::vector<double> pcoords(3 * numPts);
+  std::vector<double> weights(maxCellSize * numPts);
+  std::vector<vtkIdType> cellIdsOnly(numPts);
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+    locator->FindCells(numPts, x.data(), 0.0, cellIds.data(), pcoords.data(),
+                       weights.data());
+    locator->FindCells(numPts, x.data(), 0.0, cellIdsOnly.data());
+  });
+
+  vtkNew<vtkGenericCell> cell;
+  std::vector<double> w(maxCellSize);
+  vtkIdType numFound = 0;
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double p[3] = { x[3 * i], x[3 * i + 1], x[3 * i + 2] };
+    double pc[3];
+    vtkIdType cellId = locator->FindCell(p, 0.0, cell, pc, w.data());
+    bool same = cellId == cellIds[i] && cellId == cellIdsOnly[i];
+    if (same && cellId >= 0)
+    {
+      ++numFound;
+      same = pc[0] == pcoords[3 * i] && pc[1] == pcoords[3 * i + 1] &&
+        pc[2] == pcoords[3 * i + 2];
+      for (int j = 0; same && j < cell->GetNumberOfPoints(); ++j)
+      {
+        same = w[j] == weights[maxCellSize * i + j];
+      }
+    }
+    if (!same)
+    {
+      cerr << locator->GetClassName() << ": wrong cell " << cellIds[i]
+           << " for point " << i << " instead of " << cellId << endl;
+      return false;
+    }
+  }
+  if (numFound < numPts / 2)
+  {
+    cerr << locator->GetClassName() << ": only " << numFound << " of "
+         << numPts << " points found in the cells" << endl;
+    return false;
+  }
+  return true;
+}
+
+}
+
+int TestLocatorBatchQueries(int, char*[])
+{
+  vtkSmartPointer<vtkUnstructuredGrid> grid = MakeGrid();
+
+  // Positions in and around the grid.
+  vtkMath::RandomSeed(4321);
+  std::vector<double> x(3 * 5000);
+  for (size_t i = 0; i < x.size(); ++i)
+  {
+    x[i] = vtkMath::Random(-0.1, 1.1);
+  }
+
+  vtkNew<vtkStaticPointLocator> staticPointLocator;
+  vtkNew<vtkKdTreePointLocator> kdTreePointLocator;
+  vtkNew<vtkPointLocator> pointLocator;
+  vtkAbstractPointLocator* pointLocators[3] = { staticPointLocator,
+    kdTreePointLocator, pointLocator };
+  for (vtkAbstractPointLocator* locator : pointLocators)
+  {
+    locator->SetDataSet(grid);
+    if (!TestPointLocator(locator, x))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  const int maxCellSize = grid->GetMaxCellSize();
+  for (int storage = 0; storage < 3; ++storage)
+  {
+    vtkCellArray* cells = grid->GetCells();
+    if (storage == 0)
+    {
+      cells->ConvertTo64BitStorage();
+    }
+    else if (!cells->ConvertTo32BitStorage())
+    {
+      cerr << "Cannot convert the cells to 32-bit storage" << endl;
+      return EXIT_FAILURE;
+    }
+    if (storage == 2)
+    {
+      // Leave the cells pending in the legacy layout.
+      cells->GetData();
+    }
+
+    vtkNew<vtkStaticCellLocator> staticCellLocator;
+    vtkNew<vtkCellTreeLocator> cellTreeLocator;
+    vtkNew<vtkBVHCellLocator> bvhCellLocator;
+    vtkNew<vtkCellLocator> cellLocator;
+    vtkAbstractCellLocator* cellLocators[4] = { staticCellLocator,
+      cellTreeLocator, bvhCellLocator, cellLocator };
+    for (vtkAbstractCellLocator* locator : cellLocators)
+    {
+      locator->SetDataSet(grid);
+      locator->BuildLocator();
+      if (!TestCellLocator(locator, x, maxCellSize))
+      {
+        cerr << "with cell storage " << storage << endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
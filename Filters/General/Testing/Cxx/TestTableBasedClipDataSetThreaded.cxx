@@ -0,0 +1,396 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestTableBasedClipDataSetThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkTableBasedClipDataSet clips unstructured grids the same way
+// in parallel as sequentially (same points, same point numbering, same
+// cells and same data), by scalars and by an implicit function, on all the
+// cell types clipped with the case tables and on cells clipped by
+// vtkClipDataSet. Also check that clipping a cube of tetrahedra by a plane
+// through its center splits it into two halves of the same volume.
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTableBasedClipDataSet.h"
+#include "vtkTetra.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <iomanip>
+
+namespace
+{
+
+void AddArrays(vtkDataSetAttributes* attributes, vtkIdType numTuples)
+{
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    vectors->InsertNextTuple3(sin(0.37 * i), cos(0.11 * i), 0.001 * i);
+    ints->InsertNextValue(static_cast<int>((i * 7919) % 1001) - 500);
+  }
+  attributes->AddArray(vectors);
+  attributes->AddArray(ints);
+}
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SameGrids(vtkUnstructuredGrid* a, vtkUnstructuredGrid* b)
+{
+  if (a->GetNumberOfPoints() != b->GetNumberOfPoints() ||
+      a->GetNumberOfCells() != b->GetNumberOfCells())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    a->GetPoint(i, x);
+    b->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ptsA;
+  vtkNew<vtkIdList> ptsB;
+  for (vtkIdType i = 0; i < a->GetNumberOfCells(); ++i)
+  {
+    a->GetCellPoints(i, ptsA);
+    b->GetCellPoints(i, ptsB);
+    if (a->GetCellType(i) != b->GetCellType(i) ||
+        ptsA->GetNumberOfIds() != ptsB->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < ptsA->GetNumberOfIds(); ++j)
+    {
+      if (ptsA->GetId(j) != ptsB->GetId(j))
+      {
+        return false;
+      }
+    }
+  }
+  return SameArrays(a->GetPointData(), b->GetPointData()) &&
+    SameArrays(a->GetCellData(), b->GetCellData());
+}
+
+// A grid of 2D and 3D cells of all the types clipped with the case tables,
+// and of a few polygons, which are clipped by vtkClipDataSet.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid(bool withPolygons)
+{
+  const int dims[3] = { 14, 11, 9 };
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < dims[2]; ++k)
+  {
+    for (int j = 0; j < dims[1]; ++j)
+    {
+      for (int i = 0; i < dims[0]; ++i)
+      {
+        points->InsertNextPoint(i + 0.05 * j, j, k + 0.1 * sin(0.5 * i));
+      }
+    }
+  }
+
+  vtkSmartPointer<vtkUnstructuredGrid> grid =
+    vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  vtkIdType cellCount = 0;
+  for (int k = 0; k < dims[2] - 1; ++k)
+  {
+    for (int j = 0; j < dims[1] - 1; ++j)
+    {
+      for (int i = 0; i < dims[0] - 1; ++i)
+      {
+        vtkIdType p0 = i + dims[0] * (j + dims[1] * k);
+        vtkIdType dj = dims[0];
+        vtkIdType dk = dims[0] * dims[1];
+        vtkIdType hex[8] = { p0, p0 + 1, p0 + 1 + dj, p0 + dj, p0 + dk,
+          p0 + 1 + dk, p0 + 1 + dj + dk, p0 + dj + dk };
+        vtkIdType voxel[8] = { hex[0], hex[1], hex[3], hex[2], hex[4], hex[5],
+          hex[7], hex[6] };
+        vtkIdType wedge[6] = { hex[0], hex[1], hex[2], hex[4], hex[5], hex[6] };
+        vtkIdType quad[4] = { hex[0], hex[1], hex[2], hex[3] };
+        vtkIdType pixel[4] = { hex[0], hex[1], hex[3], hex[2] };
+        switch (cellCount++ % 13)
+        {
+          case 0:
+            grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+            break;
+          case 1:
+            grid->InsertNextCell(VTK_VOXEL, 8, voxel);
+            break;
+          case 2:
+            grid->InsertNextCell(VTK_WEDGE, 6, wedge);
+            break;
+          case 3:
+            grid->InsertNextCell(VTK_PYRAMID, 5, hex);
+            grid->InsertNextCell(VTK_TETRA, 4, hex + 4);
+            break;
+          case 4:
+            grid->InsertNextCell(VTK_TETRA, 4, hex);
+            break;
+          case 5:
+            grid->InsertNextCell(VTK_QUAD, 4, quad);
+            break;
+          case 6:
+            grid->InsertNextCell(VTK_PIXEL, 4, pixel);
+            break;
+          case 7:
+            grid->InsertNextCell(VTK_TRIANGLE, 3, quad);
+            break;
+          case 8:
+            grid->InsertNextCell(VTK_LINE, 2, hex + 5);
+            break;
+          case 9:
+            grid->InsertNextCell(VTK_VERTEX, 1, hex + 6);
+            break;
+          case 10:
+            grid->InsertNextCell(withPolygons ? VTK_POLYGON : VTK_QUAD, 4, quad);
+            break;
+          default:
+            grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+        }
+      }
+    }
+  }
+
+  AddArrays(grid->GetPointData(), grid->GetNumberOfPoints());
+  AddArrays(grid->GetCellData(), grid->GetNumberOfCells());
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (vtkIdType i = 0; i < grid->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    grid->GetPoint(i, x);
+    scalars->InsertNextValue(sin(0.6 * x[0]) + cos(0.4 * x[1]) + 0.2 * x[2]);
+  }
+  grid->GetPointData()->SetScalars(scalars);
+  return grid;
+}
+
+void Clip(vtkUnstructuredGrid* input, int option,
+  vtkSmartPointer<vtkUnstructuredGrid>& output,
+  vtkSmartPointer<vtkUnstructuredGrid>& clipped)
+{
+  vtkNew<vtkTableBasedClipDataSet> clipper;
+  clipper->SetInputData(input);
+  vtkNew<vtkPlane> plane;
+  if (option & 1)
+  {
+    plane->SetOrigin(6.2, 4.7, 3.9);
+    plane->SetNormal(0.7, -0.3, 0.45);
+    clipper->SetClipFunction(plane);
+    clipper->SetGenerateClipScalars((option & 4) != 0);
+  }
+  else
+  {
+    clipper->SetValue((option & 4) ? 0.5 : -0.3);
+  }
+  clipper->SetInsideOut((option & 2) != 0);
+  clipper->GenerateClippedOutputOn();
+  clipper->Update();
+  output = clipper->GetOutput();
+  clipped = clipper->GetClippedOutput();
+}
+
+// A cube of side Size split into tetrahedra (five per voxel).
+const int Size = 6;
+
+vtkSmartPointer<vtkUnstructuredGrid> MakeTetraCube()
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= Size; ++k)
+  {
+    for (int j = 0; j <= Size; ++j)
+    {
+      for (int i = 0; i <= Size; ++i)
+      {
+        points->InsertNextPoint(i, j, k);
+      }
+    }
+  }
+  vtkSmartPointer<vtkUnstructuredGrid> grid =
+    vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  const vtkIdType dj = Size + 1;
+  const vtkIdType dk = dj * dj;
+  for (int k = 0; k < Size; ++k)
+  {
+    for (int j = 0; j < Size; ++j)
+    {
+      for (int i = 0; i < Size; ++i)
+      {
+        vtkIdType p0 = i + dj * j + dk * k;
+        vtkIdType c[8] = { p0, p0 + 1, p0 + 1 + dj, p0 + dj, p0 + dk,
+          p0 + 1 + dk, p0 + 1 + dj + dk, p0 + dj + dk };
+        vtkIdType tetras[5][4] = { { c[0], c[1], c[3], c[4] },
+                                   { c[1], c[2], c[3], c[6] },
+                                   { c[1], c[4], c[5], c[6] },
+                                   { c[3], c[4], c[6], c[7] },
+                                   { c[1], c[3], c[4], c[6] } };
+        for (int t = 0; t < 5; ++t)
+        {
+          grid->InsertNextCell(VTK_TETRA, 4, tetras[t]);
+        }
+      }
+    }
+  }
+  AddArrays(grid->GetPointData(), grid->GetNumberOfPoints());
+  return grid;
+}
+
+// The volume of the 3D cells, summed over their tetrahedralization.
+double Volume(vtkUnstructuredGrid* grid)
+{
+  double volume = 0.0;
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkIdList> ptIds;
+  vtkNew<vtkPoints> pts;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    grid->GetCell(cellId, cell);
+    if (cell->GetCellDimension() != 3)
+    {
+      continue;
+    }
+    cell->Triangulate(0, ptIds, pts);
+    for (vtkIdType t = 0; t + 3 < pts->GetNumberOfPoints(); t += 4)
+    {
+      double x[4][3];
+      for (int i = 0; i < 4; ++i)
+      {
+        pts->GetPoint(t + i, x[i]);
+      }
+      volume += std::abs(vtkTetra::ComputeVolume(x[0], x[1], x[2], x[3]));
+    }
+  }
+  return volume;
+}
+
+// Any plane through the center of the cube cuts it into two halves of the
+// same volume (the cube is symmetric about its center), up to the rounding
+// of the intersection points to float.
+bool TestHalves()
+{
+  vtkSmartPointer<vtkUnstructuredGrid> cube = MakeTetraCube();
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(0.5 * Size, 0.5 * Size, 0.5 * Size);
+  plane->SetNormal(0.7, -0.3, 0.45);
+  const double half = 0.5 * Size * Size * Size;
+  const vtkSMPTools::Config configs[2] = { vtkSMPTools::Config("Sequential"),
+    vtkSMPTools::Config(4) };
+  for (int threaded = 0; threaded < 2; ++threaded)
+  {
+    vtkNew<vtkTableBasedClipDataSet> clipper;
+    clipper->SetInputData(cube);
+    clipper->SetClipFunction(plane);
+    clipper->GenerateClippedOutputOn();
+    vtkSMPTools::LocalScope(configs[threaded], [&]() { clipper->Update(); });
+    double volumes[2] = { Volume(clipper->GetOutput()),
+      Volume(clipper->GetClippedOutput()) };
+    for (int i = 0; i < 2; ++i)
+    {
+      if (std::abs(volumes[i] - half) > 1e-6 * half)
+      {
+        cerr << "Wrong " << (i ? "clipped output" : "output") << " volume ("
+             << (threaded ? "threaded" : "sequential") << "): " << std::setprecision(17) << volumes[i]
+             << " instead of " << half << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TestGrid(vtkUnstructuredGrid* input, const char* label)
+{
+  for (int option = 0; option < 8; ++option)
+  {
+    vtkSmartPointer<vtkUnstructuredGrid> serial[2];
+    vtkSmartPointer<vtkUnstructuredGrid> threaded[2];
+    vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"),
+                            [&]() { Clip(input, option, serial[0], serial[1]); });
+    vtkSMPTools::LocalScope(vtkSMPTools::Config(4),
+                            [&]() { Clip(input, option, threaded[0], threaded[1]); });
+    for (int i = 0; i < 2; ++i)
+    {
+      if (!SameGrids(serial[i], threaded[i]))
+      {
+        cerr << "Wrong " << (i ? "clipped output" : "output") << " for " << label
+             << " (option " << option << "): " << threaded[i]->GetNumberOfCells()
+             << " cells instead of " << serial[i]->GetNumberOfCells() << endl;
+        return false;
+      }
+      if (serial[i]->GetNumberOfCells() == 0)
+      {
+        cerr << "Empty " << (i ? "clipped output" : "output") << " for " << label
+             << " (option " << option << ")" << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestTableBasedClipDataSetThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkUnstructuredGrid> grid = MakeGrid(false);
+  vtkSmartPointer<vtkUnstructuredGrid> mixedGrid = MakeGrid(true);
+  if (!TestHalves() || !TestGrid(grid, "unstructured grid") ||
+      !TestGrid(mixedGrid, "unstructured grid with polygons"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
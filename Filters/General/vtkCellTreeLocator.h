@@ -137,6 +137,14 @@ class VTKFILTERSGENERAL_EXPORT vtkCellTreeLocator : public vtkAbstractCellLocato
     void BuildLocator() override;
     //@}
 
+    /**
+     * FindCell() is thread safe once the locator is built, as is
+     * vtkDataSet::GetCell(cellId, vtkGenericCell*) for the standard data
+     * sets (vtkUnstructuredGrid included, whatever its cell storage), so the
+     * batched FindCells() processes the points in parallel.
+     */
+    bool HasThreadSafeQueries() override { return true; }
+
     //@{
     /**
      * Internal classes made public to allow subclasses to create
@@ -60,6 +60,23 @@
 
 #include "vtkTableBasedClipCases.h"
 
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayAccessor.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkMath.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
 vtkStandardNewMacro( vtkTableBasedClipDataSet );
 vtkCxxSetObjectMacro( vtkTableBasedClipDataSet, ClipFunction, vtkImplicitFunction );
 
@@ -1758,7 +1775,6 @@ int vtkTableBasedClipDataSet::RequestData( vtkInformation * vtkNotUsed( request
   vtkDebugMacro( << "Clipping dataset" << endl );
 
 
-  int  i;
   vtkIdType  numbPnts = cpyInput->GetNumberOfPoints();
 
   // handling exceptions
@@ -1794,10 +1810,13 @@ int vtkTableBasedClipDataSet::RequestData( vtkInformation * vtkNotUsed( request
       cpyInput->GetPointData()->SetScalars( pScalars );
     }
 
-    for ( i = 0; i < numbPnts; i ++ )
+    // The clip function is evaluated serially: implicit functions are not
+    // reentrant in general (e.g., vtkImplicitDataSet uses a shared cell).
+    double * scalars = pScalars->GetPointer( 0 );
+    for ( vtkIdType ptId = 0; ptId < numbPnts; ptId ++ )
     {
-      double s = this->ClipFunction->FunctionValue(  cpyInput->GetPoint( i )  );
-      pScalars->SetTuple1( i, s );
+      scalars[ ptId ] =
+        this->ClipFunction->FunctionValue( cpyInput->GetPoint( ptId ) );
     }
 
     clipAray = pScalars;
@@ -2988,159 +3007,265 @@ void vtkTableBasedClipDataSet::ClipStructuredGridData( vtkDataSet * inputGrd,
   strcGrid = nullptr;
 }
 
-//-----------------------------------------------------------------------------
-void vtkTableBasedClipDataSet::ClipUnstructuredGridData( vtkDataSet * inputGrd,
-     vtkDataArray * clipAray, double isoValue, vtkUnstructuredGrid * outputUG )
+// ============================================================================
+// ============== Threaded clipping of unstructured grids (begin) =============
+// ============================================================================
+
+namespace
 {
-  vtkUnstructuredGrid * unstruct = vtkUnstructuredGrid::SafeDownCast( inputGrd );
+// The linear cells of unstructured grids are clipped in parallel, in two
+// passes over the cells that walk the clip cases. The first pass counts the
+// output shapes (of each type), edge points and centroid points of each
+// cell; the prefix sums of the counts give the location of the shapes and
+// points of each cell, which are then filled by the second pass. The edge
+// points are merged with vtkStaticEdgeLocatorTemplate. The output is the
+// same as the one of vtkTableBasedClipperVolumeFromVolume: the shapes are
+// grouped by type, the used input points and the edge points are numbered
+// in the order of their first use, and so are the centroid points.
+
+typedef const int TableBasedClipperEdgeVertices[2];
+
+// The output shape types, in the order of the output cells.
+const int TableBasedClipperNumberOfShapeTypes = 8;
+const int TableBasedClipperShapeSizes[ TableBasedClipperNumberOfShapeTypes ] =
+  { 4, 5, 6, 8, 4, 3, 2, 1 };
+const unsigned char TableBasedClipperShapeCellTypes
+  [ TableBasedClipperNumberOfShapeTypes ] =
+  { VTK_TETRA, VTK_PYRAMID, VTK_WEDGE, VTK_HEXAHEDRON,
+    VTK_QUAD, VTK_TRIANGLE, VTK_LINE, VTK_VERTEX };
+
+int GetShapeTypeIndex( unsigned char theShape )
+{
+  switch ( theShape )
+  {
+    case ST_TET: return 0;
+    case ST_PYR: return 1;
+    case ST_WDG: return 2;
+    case ST_HEX: return 3;
+    case ST_QUA: return 4;
+    case ST_TRI: return 5;
+    case ST_LIN: return 6;
+    case ST_VTX: return 7;
+  }
+  return -1;
+}
 
-  vtkIdType   i, j;
-  vtkIdType   numbPnts = 0;
-  int         numCants = 0; // number of cells not clipped by this filter
-  vtkIdType   numCells = unstruct->GetNumberOfCells();
+// Return true if the cells of the given type are clipped with the case
+// tables.
+bool CanClipCellType( int cellType )
+{
+  switch ( cellType )
+  {
+    case VTK_TETRA:
+    case VTK_PYRAMID:
+    case VTK_WEDGE:
+    case VTK_HEXAHEDRON:
+    case VTK_VOXEL:
+    case VTK_TRIANGLE:
+    case VTK_QUAD:
+    case VTK_PIXEL:
+    case VTK_LINE:
+    case VTK_VERTEX:
+      return true;
+  }
+  return false;
+}
 
-  // volume from volume
-  vtkTableBasedClipperVolumeFromVolume   * visItVFV = new
-  vtkTableBasedClipperVolumeFromVolume(
-      this->OutputPointsPrecision, unstruct->GetNumberOfPoints(),
-      int(   pow(  double( numCells ), double( 0.6667f )  )   ) * 5 + 100    );
+// Get the output shapes and the edges of a cell of the given type for the
+// given case.
+void GetClipCase( int cellType, int caseIndx, const unsigned char *& thisCase,
+                  int & nOutputs, TableBasedClipperEdgeVertices *& edgeVtxs )
+{
+  int startIdx = 0;
+  thisCase = nullptr;
+  nOutputs = 0;
+  edgeVtxs = nullptr;
+  switch ( cellType )
+  {
+    case VTK_TETRA:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesTet[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesTet[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesTet[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::TetVerticesFromEdges;
+      break;
 
-  // the stuffs that can not be clipped by this filter
-  vtkUnstructuredGrid * specials = vtkUnstructuredGrid::New();
-  specials->SetPoints( unstruct->GetPoints() );
-  specials->GetPointData()->ShallowCopy( unstruct->GetPointData() );
-  specials->Allocate( numCells );
+    case VTK_PYRAMID:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesPyr[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesPyr[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesPyr[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::PyramidVerticesFromEdges;
+      break;
 
-  for ( i = 0; i < numCells; i ++ )
-  {
-    int         cellType = unstruct->GetCellType( i );
-    vtkIdType * pntIndxs = nullptr;
-    unstruct->GetCellPoints( i, numbPnts, pntIndxs );
+    case VTK_WEDGE:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesWdg[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesWdg[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesWdg[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::WedgeVerticesFromEdges;
+      break;
 
-    bool     bCanClip = false;
-    switch ( cellType )
-    {
-      case VTK_TETRA:
-      case VTK_PYRAMID:
-      case VTK_WEDGE:
-      case VTK_HEXAHEDRON:
-      case VTK_VOXEL:
-      case VTK_TRIANGLE:
-      case VTK_QUAD:
-      case VTK_PIXEL:
-      case VTK_LINE:
-      case VTK_VERTEX:
-           bCanClip = true;
-           break;
+    case VTK_HEXAHEDRON:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesHex[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesHex[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesHex[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::HexVerticesFromEdges;
+      break;
 
-      default:
-           bCanClip = false;
-           break;
-    }
+    case VTK_VOXEL:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesVox[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesVox[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesVox[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::VoxVerticesFromEdges;
+      break;
 
-    if ( bCanClip )
-    {
-      int    caseIndx = 0;
-      double grdDiffs[8];
+    case VTK_TRIANGLE:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesTri[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesTri[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesTri[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::TriVerticesFromEdges;
+      break;
 
-      for ( j = numbPnts-1; j >= 0; j -- )
-      {
-        grdDiffs[j] = clipAray->GetComponent( pntIndxs[j], 0 ) - isoValue;
-        caseIndx   += (  ( grdDiffs[j] >= 0.0 ) ? 1 : 0  );
-        caseIndx  <<= (  1 - ( !j )  );
-      }
+    case VTK_QUAD:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesQua[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesQua[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesQua[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::QuadVerticesFromEdges;
+      break;
 
-      int               startIdx = 0;
-      int               nOutputs = 0;
-      typedef const int EDGEIDXS[2];
-      EDGEIDXS        * edgeVtxs = nullptr;
-      unsigned char   * thisCase = nullptr;
+    case VTK_PIXEL:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesPix[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesPix[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesPix[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::PixelVerticesFromEdges;
+      break;
 
-      // start index, split case, number of output, and vertices from edges
-      switch ( cellType )
-      {
-        case VTK_TETRA:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesTet[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesTet[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesTet[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::TetVerticesFromEdges;
-          break;
+    case VTK_LINE:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesLin[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesLin[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesLin[ caseIndx ];
+      edgeVtxs = vtkTableBasedClipperTriangulationTables::LineVerticesFromEdges;
+      break;
 
-        case VTK_PYRAMID:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesPyr[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesPyr[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesPyr[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::PyramidVerticesFromEdges;
-          break;
+    case VTK_VERTEX:
+      startIdx = vtkTableBasedClipperClipTables::StartClipShapesVtx[ caseIndx ];
+      thisCase =&vtkTableBasedClipperClipTables::ClipShapesVtx[ startIdx ];
+      nOutputs = vtkTableBasedClipperClipTables::NumClipShapesVtx[ caseIndx ];
+      break;
+  }
+}
 
-        case VTK_WEDGE:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesWdg[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesWdg[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesWdg[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::WedgeVerticesFromEdges;
-          break;
+// An edge point, with the weight of its first (smallest) point. The edge
+// id is the index of the AddPoint() call of the serial algorithm.
+typedef vtkStaticEdgeLocatorTemplate< vtkIdType, double > TableBasedClipperEdgeLocator;
+typedef TableBasedClipperEdgeLocator::MergeTupleType TableBasedClipperEdgeTuple;
 
-        case VTK_HEXAHEDRON:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesHex[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesHex[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesHex[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::HexVerticesFromEdges;
-          break;
+// A centroid point, whose point ids are encoded as the ones of the output
+// shapes (see ClipCells).
+struct TableBasedClipperCentroid
+{
+  int       nPts;
+  vtkIdType ptIds[8];
+};
 
-        case VTK_VOXEL:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesVox[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesVox[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesVox[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::VoxVerticesFromEdges;
-          break;
+// The counts (first pass) and the locations (second pass, after the prefix
+// sums) of the output of each cell.
+struct TableBasedClipperCellOutputs
+{
+  std::vector< vtkIdType > Shapes[ TableBasedClipperNumberOfShapeTypes ];
+  std::vector< vtkIdType > Edges;
+  std::vector< vtkIdType > Centroids;
 
-        case VTK_TRIANGLE:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesTri[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesTri[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesTri[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::TriVerticesFromEdges;
-          break;
+  explicit TableBasedClipperCellOutputs( vtkIdType numCells )
+  {
+    for ( int t = 0; t < TableBasedClipperNumberOfShapeTypes; t ++ )
+    {
+      this->Shapes[t].assign( numCells + 1, 0 );
+    }
+    this->Edges.assign( numCells + 1, 0 );
+    this->Centroids.assign( numCells + 1, 0 );
+  }
 
-        case VTK_QUAD:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesQua[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesQua[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesQua[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::QuadVerticesFromEdges;
-          break;
+  // Turn the counts into offsets; the totals are at the end of the arrays.
+  void ComputeOffsets()
+  {
+    for ( int t = 0; t < TableBasedClipperNumberOfShapeTypes; t ++ )
+    {
+      vtkSMPTools::ExclusiveScan( this->Shapes[t].begin(),
+        this->Shapes[t].end(), this->Shapes[t].begin(), vtkIdType( 0 ) );
+    }
+    vtkSMPTools::ExclusiveScan( this->Edges.begin(), this->Edges.end(),
+                                this->Edges.begin(), vtkIdType( 0 ) );
+    vtkSMPTools::ExclusiveScan( this->Centroids.begin(),
+      this->Centroids.end(), this->Centroids.begin(), vtkIdType( 0 ) );
+  }
+};
 
-        case VTK_PIXEL:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesPix[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesPix[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesPix[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::PixelVerticesFromEdges;
-          break;
+// Walk the clip cases of the cells. The first pass (Fill false) counts the
+// outputs of each cell, and the second one fills them. The point ids of the
+// output shapes are encoded as in the serial algorithm: input points are
+// kept, edge points are offset by the number of input points (with the edge
+// id instead of the merged point id), and centroid points are -1 - id.
+struct TableBasedClipperClipCells
+{
+  vtkUnstructuredGrid *                 Input;
+  vtkDataArray *                        Scalars;
+  double                                IsoValue;
+  bool                                  InsideOut;
+  bool                                  Fill;
+  TableBasedClipperCellOutputs *        Outputs;
+  const vtkIdType *                     ShapeStarts;
+  vtkIdType *                           ShapeCells;
+  vtkIdType *                           ShapePoints;
+  TableBasedClipperEdgeTuple *          Edges;
+  TableBasedClipperCentroid *           Centroids;
+  vtkSMPThreadLocalObject< vtkIdList >  CellPoints;
+
+  void Initialize()
+  {
+    this->CellPoints.Local()->Allocate( VTK_CELL_SIZE );
+  }
 
-        case VTK_LINE:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesLin[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesLin[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesLin[ caseIndx ];
-          edgeVtxs = ( EDGEIDXS * )
-                     vtkTableBasedClipperTriangulationTables::LineVerticesFromEdges;
-          break;
+  void operator()( vtkIdType cellId, vtkIdType endCellId )
+  {
+    const vtkIdType numPts   = this->Input->GetNumberOfPoints();
+    vtkIdList *     cellPts  = this->CellPoints.Local();
+    vtkIdType       counts[ TableBasedClipperNumberOfShapeTypes ];
 
-        case VTK_VERTEX:
-          startIdx = vtkTableBasedClipperClipTables::StartClipShapesVtx[ caseIndx ];
-          thisCase =&vtkTableBasedClipperClipTables::ClipShapesVtx[ startIdx ];
-          nOutputs = vtkTableBasedClipperClipTables::NumClipShapesVtx[ caseIndx ];
-          edgeVtxs = nullptr;
-          break;
+    for ( ; cellId < endCellId; cellId ++ )
+    {
+      int cellType = this->Input->GetCellType( cellId );
+      if ( !CanClipCellType( cellType ) )
+      {
+        continue;
       }
 
-      int   intrpIds[4];
-      for ( j = 0; j < nOutputs; j ++ )
+      this->Input->GetCellPoints( cellId, cellPts );
+      vtkIdType   numbPnts = cellPts->GetNumberOfIds();
+      vtkIdType * pntIndxs = cellPts->GetPointer( 0 );
+
+      int    caseIndx = 0;
+      double grdDiffs[8];
+      for ( vtkIdType j = numbPnts - 1; j >= 0; j -- )
+      {
+        grdDiffs[j] = this->Scalars->GetComponent( pntIndxs[j], 0 )
+                      - this->IsoValue;
+        caseIndx   += (  ( grdDiffs[j] >= 0.0 ) ? 1 : 0  );
+        caseIndx  <<= (  1 - ( !j )  );
+      }
+
+      const unsigned char *           thisCase = nullptr;
+      int                             nOutputs = 0;
+      TableBasedClipperEdgeVertices * edgeVtxs = nullptr;
+      GetClipCase( cellType, caseIndx, thisCase, nOutputs, edgeVtxs );
+
+      for ( int t = 0; t < TableBasedClipperNumberOfShapeTypes; t ++ )
+      {
+        counts[t] = 0;
+      }
+      vtkIdType numEdges     = 0;
+      vtkIdType numCentroids = 0;
+      vtkIdType intrpIds[4];
+
+      for ( int j = 0; j < nOutputs; j ++ )
       {
         int      nCellPts = 0;
         int      theColor = -1;
@@ -3151,42 +3276,14 @@ void vtkTableBasedClipDataSet::ClipUnstructuredGridData( vtkDataSet * inputGrd,
         switch ( theShape )
         {
           case ST_HEX:
-            nCellPts = 8;
-            theColor = *thisCase ++;
-            break;
-
           case ST_WDG:
-            nCellPts = 6;
-            theColor = *thisCase ++;
-            break;
-
           case ST_PYR:
-            nCellPts = 5;
-            theColor = *thisCase ++;
-            break;
-
           case ST_TET:
-            nCellPts = 4;
-            theColor = *thisCase ++;
-            break;
-
           case ST_QUA:
-            nCellPts = 4;
-            theColor = *thisCase ++;
-            break;
-
           case ST_TRI:
-            nCellPts = 3;
-            theColor = *thisCase ++;
-            break;
-
           case ST_LIN:
-            nCellPts = 2;
-            theColor = *thisCase ++;
-            break;
-
           case ST_VTX:
-            nCellPts = 1;
+            nCellPts = TableBasedClipperShapeSizes[ GetShapeTypeIndex( theShape ) ];
             theColor = *thisCase ++;
             break;
 
@@ -3195,14 +3292,10 @@ void vtkTableBasedClipDataSet::ClipUnstructuredGridData( vtkDataSet * inputGrd,
             theColor = *thisCase ++;
             nCellPts = *thisCase ++;
             break;
-
-          default:
-            vtkErrorMacro( << "An invalid output shape was found "
-                           << "in the ClipCases." << endl );
         }
 
-        if ( (!this->InsideOut && theColor == COLOR0 ) ||
-             ( this->InsideOut && theColor == COLOR1 )
+        if ( ( !this->InsideOut && theColor == COLOR0 ) ||
+             (  this->InsideOut && theColor == COLOR1 )
            )
         {
           // We don't want this one; it's the wrong side.
@@ -3210,149 +3303,840 @@ void vtkTableBasedClipDataSet::ClipUnstructuredGridData( vtkDataSet * inputGrd,
           continue;
         }
 
-        vtkIdType   shapeIds[8];
+        vtkIdType shapeIds[8];
         for ( int p = 0; p < nCellPts; p ++ )
         {
           unsigned char pntIndex = *thisCase ++;
 
           if ( pntIndex <= P7 )
           {
-            // We know pt P0 must be >P0 since we already
-            // assume P0 == 0.  This is why we do not
-            // bother subtracting P0 from pt here.
             shapeIds[p] = pntIndxs[ pntIndex ];
           }
           else
           if ( pntIndex >= EA && pntIndex <= EL )
           {
+            vtkIdType edgeId = numEdges ++;
+            if ( !this->Fill )
+            {
+              continue;
+            }
+            edgeId += this->Outputs->Edges[ cellId ];
+
             int  pt1Index = edgeVtxs[ pntIndex-EA ][0];
             int  pt2Index = edgeVtxs[ pntIndex-EA ][1];
             if ( pt2Index < pt1Index )
             {
-              int temp = pt2Index;
-              pt2Index = pt1Index;
-              pt1Index = temp;
+              std::swap( pt1Index, pt2Index );
             }
             double pt1ToPt2 = grdDiffs[ pt2Index ] - grdDiffs[ pt1Index ];
             double pt1ToIso = 0.0 - grdDiffs[ pt1Index ];
             double p1Weight = 1.0 - pt1ToIso / pt1ToPt2;
 
-            vtkIdType    pntIndx1 = pntIndxs[ pt1Index ];
-            vtkIdType    pntIndx2 = pntIndxs[ pt2Index ];
+            // The edge tuple keeps the weight of its first point.
+            vtkIdType pntIndx1 = pntIndxs[ pt1Index ];
+            vtkIdType pntIndx2 = pntIndxs[ pt2Index ];
+            TableBasedClipperEdgeTuple & edge = this->Edges[ edgeId ];
+            edge.EId = edgeId;
+            if ( pntIndx2 < pntIndx1 )
+            {
+              edge.V0 = pntIndx2;
+              edge.V1 = pntIndx1;
+              edge.T  = 1.0 - p1Weight;
+            }
+            else
+            {
+              edge.V0 = pntIndx1;
+              edge.V1 = pntIndx2;
+              edge.T  = p1Weight;
+            }
 
-            shapeIds[p] = visItVFV->AddPoint( pntIndx1, pntIndx2, p1Weight );
+            shapeIds[p] = numPts + edgeId;
           }
           else
           if ( pntIndex >= N0 && pntIndex <= N3 )
           {
             shapeIds[p] = intrpIds[ pntIndex - N0 ];
           }
-          else
+        }
+
+        if ( theShape == ST_PNT )
+        {
+          vtkIdType centroidId = numCentroids ++;
+          if ( this->Fill )
           {
-            vtkErrorMacro( << "An invalid output point value was found "
-                           << "in the ClipCases." << endl );
+            centroidId += this->Outputs->Centroids[ cellId ];
+            TableBasedClipperCentroid & centroid = this->Centroids[ centroidId ];
+            centroid.nPts = nCellPts;
+            std::copy( shapeIds, shapeIds + nCellPts, centroid.ptIds );
+            intrpIds[ intrpIdx ] = -1 - centroidId;
           }
+          continue;
         }
 
-        switch ( theShape )
+        int t = GetShapeTypeIndex( theShape );
+        if ( t < 0 )
         {
-          case ST_HEX:
-            visItVFV->AddHex( i, shapeIds[0], shapeIds[1],
-                                 shapeIds[2], shapeIds[3], shapeIds[4],
-                                 shapeIds[5], shapeIds[6], shapeIds[7] );
-            break;
-
-          case ST_WDG:
-            visItVFV->AddWedge( i, shapeIds[0], shapeIds[1], shapeIds[2],
-                                   shapeIds[3], shapeIds[4], shapeIds[5] );
-            break;
-
-          case ST_PYR:
-            visItVFV->AddPyramid( i, shapeIds[0], shapeIds[1],
-                                     shapeIds[2], shapeIds[3], shapeIds[4] );
-            break;
-
-          case ST_TET:
-            visItVFV->AddTet( i, shapeIds[0], shapeIds[1],
-                                 shapeIds[2], shapeIds[3] );
-            break;
-
-          case ST_QUA:
-            visItVFV->AddQuad( i, shapeIds[0], shapeIds[1],
-                                  shapeIds[2], shapeIds[3] );
-            break;
-
-          case ST_TRI:
-            visItVFV->AddTri( i, shapeIds[0], shapeIds[1], shapeIds[2] );
-            break;
-
-          case ST_LIN:
-            visItVFV->AddLine( i, shapeIds[0], shapeIds[1] );
-            break;
-
-          case ST_VTX:
-            visItVFV->AddVertex( i, shapeIds[0] );
-            break;
-
-          case ST_PNT:
-            intrpIds[ intrpIdx ] = visItVFV->AddCentroidPoint
-                                             ( nCellPts, shapeIds );
-            break;
+          continue;
+        }
+        vtkIdType shapeId = counts[t] ++;
+        if ( this->Fill )
+        {
+          shapeId += this->ShapeStarts[t] + this->Outputs->Shapes[t][ cellId ];
+          this->ShapeCells[ shapeId ] = cellId;
+          std::copy( shapeIds, shapeIds + nCellPts,
+            this->ShapePoints + this->ShapeStarts[ TableBasedClipperNumberOfShapeTypes + 1 + t ]
+            + ( shapeId - this->ShapeStarts[t] ) * nCellPts );
         }
       }
 
-      edgeVtxs = nullptr;
-      thisCase = nullptr;
-    }
-    else if (cellType == VTK_POLYHEDRON)
-    {
-      if ( numCants == 0 )
+      if ( !this->Fill )
       {
-          specials->GetCellData()
-                  ->CopyAllocate( unstruct->GetCellData(), numCells );
+        for ( int t = 0; t < TableBasedClipperNumberOfShapeTypes; t ++ )
+        {
+          this->Outputs->Shapes[t][ cellId ] = counts[t];
+        }
+        this->Outputs->Edges[ cellId ]     = numEdges;
+        this->Outputs->Centroids[ cellId ] = numCentroids;
       }
-      vtkIdType nfaces, *facePtIds;
-      unstruct->GetFaceStream(i, nfaces, facePtIds);
-      specials->InsertNextCell(cellType, nfaces, facePtIds);
-      specials->GetCellData()
-              ->CopyData( unstruct->GetCellData(), i, numCants );
-      numCants ++;
     }
-    else
+  }
+
+  void Reduce()
+  {
+  }
+};
+
+// Number the merged edge points in the order of their first use (the
+// smallest edge id of each group of coincident edges).
+struct TableBasedClipperFindFirstEdges
+{
+  const TableBasedClipperEdgeTuple * Edges;
+  const vtkIdType *                  Groups;
+  vtkIdType *                        FirstEdges;
+
+  void operator()( vtkIdType group, vtkIdType endGroup )
+  {
+    for ( ; group < endGroup; group ++ )
     {
-      if ( numCants == 0 )
+      vtkIdType first = this->Edges[ this->Groups[ group ] ].EId;
+      for ( vtkIdType i = this->Groups[ group ] + 1;
+            i < this->Groups[ group + 1 ]; i ++ )
       {
-          specials->GetCellData()
-                  ->CopyAllocate( unstruct->GetCellData(), numCells );
+        first = std::min( first, this->Edges[i].EId );
       }
-      specials->InsertNextCell( cellType, numbPnts, pntIndxs );
-      specials->GetCellData()
-              ->CopyData( unstruct->GetCellData(), i, numCants );
-      numCants ++;
+      this->FirstEdges[ first ] = 1;
     }
+  }
+};
 
-    pntIndxs = nullptr;
+struct TableBasedClipperNumberEdges
+{
+  const TableBasedClipperEdgeTuple * Edges;
+  const vtkIdType *                  Groups;
+  const vtkIdType *                  FirstEdges;
+  vtkIdType *                        EdgePointIds;
+  const TableBasedClipperEdgeTuple ** EdgePoints;
+
+  void operator()( vtkIdType group, vtkIdType endGroup )
+  {
+    for ( ; group < endGroup; group ++ )
+    {
+      const TableBasedClipperEdgeTuple * first = this->Edges + this->Groups[ group ];
+      for ( vtkIdType i = this->Groups[ group ] + 1;
+            i < this->Groups[ group + 1 ]; i ++ )
+      {
+        if ( this->Edges[i].EId < first->EId )
+        {
+          first = this->Edges + i;
+        }
+      }
+      vtkIdType ptId = this->FirstEdges[ first->EId ];
+      this->EdgePoints[ ptId ] = first;
+      for ( vtkIdType i = this->Groups[ group ];
+            i < this->Groups[ group + 1 ]; i ++ )
+      {
+        this->EdgePointIds[ this->Edges[i].EId ] = ptId;
+      }
+    }
   }
+};
 
-  int         toDelete = 0;
-  double    * theCords = nullptr;
-  vtkPoints * inputPts = unstruct->GetPoints();
-  if ( inputPts->GetDataType() == VTK_DOUBLE )
+// Find the first use of each input point in the output shapes.
+struct TableBasedClipperFindFirstUses
+{
+  const vtkIdType *         ShapePoints;
+  vtkIdType                 NumberOfInputPoints;
+  std::atomic< vtkIdType > * FirstUses;
+
+  void operator()( vtkIdType i, vtkIdType end )
   {
-    theCords = static_cast < double * > (  inputPts->GetVoidPointer( 0 )  );
+    for ( ; i < end; i ++ )
+    {
+      vtkIdType ptId = this->ShapePoints[i];
+      if ( ptId < 0 || ptId >= this->NumberOfInputPoints )
+      {
+        continue;
+      }
+      vtkIdType first = this->FirstUses[ ptId ].load( std::memory_order_relaxed );
+      while ( i < first &&
+        !this->FirstUses[ ptId ].compare_exchange_weak( first, i,
+          std::memory_order_relaxed ) )
+      {
+      }
+    }
+  }
+};
+
+// Count (then number) the input points used for the first time by each
+// output shape.
+struct TableBasedClipperNumberInputPoints
+{
+  const vtkIdType *               ShapeStarts;
+  const vtkIdType *               ShapePoints;
+  vtkIdType                       NumberOfInputPoints;
+  const std::atomic< vtkIdType > * FirstUses;
+  vtkIdType *                     FirstPointIds;
+  vtkIdType *                     PointMap;
+
+  void operator()( vtkIdType shapeId, vtkIdType endShapeId )
+  {
+    int t = 0;
+    for ( ; shapeId < endShapeId; shapeId ++ )
+    {
+      while ( this->ShapeStarts[ t + 1 ] <= shapeId )
+      {
+        t ++;
+      }
+      const int       size = TableBasedClipperShapeSizes[t];
+      const vtkIdType loc  = this->ShapeStarts[ TableBasedClipperNumberOfShapeTypes + 1 + t ]
+                             + ( shapeId - this->ShapeStarts[t] ) * size;
+      vtkIdType numNew = 0;
+      for ( vtkIdType i = loc; i < loc + size; i ++ )
+      {
+        vtkIdType ptId = this->ShapePoints[i];
+        if ( ptId >= 0 && ptId < this->NumberOfInputPoints &&
+             this->FirstUses[ ptId ].load( std::memory_order_relaxed ) == i )
+        {
+          if ( this->PointMap )
+          {
+            this->PointMap[ ptId ] = this->FirstPointIds[ shapeId ] + numNew;
+          }
+          numNew ++;
+        }
+      }
+      if ( !this->PointMap )
+      {
+        this->FirstPointIds[ shapeId ] = numNew;
+      }
+    }
+  }
+};
+
+// Type-erased access to a pair of matching input and output attribute
+// arrays, so that the output points and cells are processed in parallel.
+// The values are the ones of vtkDataSetAttributes::CopyData(),
+// InterpolateEdge() and InterpolatePoint().
+struct TableBasedClipperBaseArrayPair
+{
+  virtual ~TableBasedClipperBaseArrayPair() = default;
+  virtual void Copy( vtkIdType inId, vtkIdType outId ) = 0;
+  virtual void InterpolateEdge( vtkIdType v0, vtkIdType v1, double t,
+                                vtkIdType outId ) = 0;
+  // Average output tuples (the centroid points are computed from the
+  // output points).
+  virtual void AverageOutput( int numIds, const vtkIdType * ids,
+                              vtkIdType outId ) = 0;
+};
+
+template < typename InArrayT, typename OutArrayT >
+struct TableBasedClipperArrayPair : public TableBasedClipperBaseArrayPair
+{
+  using ValueType = typename vtkDataArrayAccessor< OutArrayT >::APIType;
+
+  vtkDataArrayAccessor< InArrayT >  Input;
+  vtkDataArrayAccessor< OutArrayT > Output;
+  int                               NumComp;
+
+  TableBasedClipperArrayPair( InArrayT * in, OutArrayT * out )
+    : Input( in ), Output( out ), NumComp( out->GetNumberOfComponents() )
+  {
+  }
+
+  void Copy( vtkIdType inId, vtkIdType outId ) override
+  {
+    for ( int c = 0; c < this->NumComp; c ++ )
+    {
+      this->Output.Set( outId, c, this->Input.Get( inId, c ) );
+    }
+  }
+
+  void InterpolateEdge( vtkIdType v0, vtkIdType v1, double t,
+                        vtkIdType outId ) override
+  {
+    const double oneMinusT = 1.0 - t;
+    for ( int c = 0; c < this->NumComp; c ++ )
+    {
+      double val = this->Input.Get( v0, c ) * oneMinusT +
+                   this->Input.Get( v1, c ) * t;
+      ValueType valT;
+      vtkMath::RoundDoubleToIntegralIfNecessary( val, &valT );
+      this->Output.Set( outId, c, valT );
+    }
+  }
+
+  void AverageOutput( int numIds, const vtkIdType * ids,
+                      vtkIdType outId ) override
+  {
+    const double weight = 1.0 / numIds;
+    for ( int c = 0; c < this->NumComp; c ++ )
+    {
+      double val = 0.0;
+      for ( int i = 0; i < numIds; i ++ )
+      {
+        val += weight * static_cast< double >( this->Output.Get( ids[i], c ) );
+      }
+      ValueType valT;
+      vtkMath::RoundDoubleToIntegralIfNecessary( val, &valT );
+      this->Output.Set( outId, c, valT );
+    }
+  }
+};
+
+struct TableBasedClipperArrayPairFactory
+{
+  TableBasedClipperBaseArrayPair * Pair = nullptr;
+
+  template < typename InArrayT, typename OutArrayT >
+  void operator()( InArrayT * in, OutArrayT * out )
+  {
+    this->Pair = new TableBasedClipperArrayPair< InArrayT, OutArrayT >( in, out );
+  }
+};
+
+struct TableBasedClipperArrayPairList
+{
+  std::vector< std::unique_ptr< TableBasedClipperBaseArrayPair > > Pairs;
+
+  // Pair the arrays allocated by CopyAllocate() with the input arrays, and
+  // resize them to numTuples. Returns false if an array cannot be processed
+  // in parallel (e.g., bit arrays, or attributes interpolated with the
+  // nearest point), or if not all the input arrays are copied, in which case
+  // vtkDataSetAttributes must be used.
+  bool Build( vtkDataSetAttributes * inAttr, vtkDataSetAttributes * outAttr,
+              vtkIdType numTuples )
+  {
+    if ( inAttr->GetNumberOfArrays() != outAttr->GetNumberOfArrays() )
+    {
+      return false;
+    }
+    for ( int i = 0; i < outAttr->GetNumberOfArrays(); i ++ )
+    {
+      vtkDataArray * out = outAttr->GetArray( i );
+      vtkDataArray * in  = inAttr->GetArray( i );
+      int attributeIndex = outAttr->IsArrayAnAttribute( i );
+      TableBasedClipperArrayPairFactory factory;
+      if ( !in || !out || !in->GetName() || !out->GetName() ||
+           strcmp( in->GetName(), out->GetName() ) != 0 ||
+           in->GetNumberOfComponents() != out->GetNumberOfComponents() ||
+           ( attributeIndex != -1 && outAttr->GetCopyAttribute(
+               attributeIndex, vtkDataSetAttributes::INTERPOLATE ) == 2 ) ||
+           !vtkArrayDispatch::Dispatch2SameValueType::Execute( in, out, factory ) )
+      {
+        this->Pairs.clear();
+        return false;
+      }
+      this->Pairs.emplace_back( factory.Pair );
+    }
+    for ( int i = 0; i < outAttr->GetNumberOfArrays(); i ++ )
+    {
+      outAttr->GetArray( i )->SetNumberOfTuples( numTuples );
+    }
+    return true;
+  }
+
+  void Copy( vtkIdType inId, vtkIdType outId )
+  {
+    for ( auto & pair : this->Pairs )
+    {
+      pair->Copy( inId, outId );
+    }
+  }
+
+  void InterpolateEdge( vtkIdType v0, vtkIdType v1, double t, vtkIdType outId )
+  {
+    for ( auto & pair : this->Pairs )
+    {
+      pair->InterpolateEdge( v0, v1, t, outId );
+    }
+  }
+
+  void AverageOutput( int numIds, const vtkIdType * ids, vtkIdType outId )
+  {
+    for ( auto & pair : this->Pairs )
+    {
+      pair->AverageOutput( numIds, ids, outId );
+    }
+  }
+};
+
+// Copy the used input points and their data.
+struct TableBasedClipperCopyInputPoints
+{
+  vtkPoints *                      InputPoints;
+  vtkPoints *                      OutputPoints;
+  const vtkIdType *                PointMap;
+  TableBasedClipperArrayPairList * PointData;
+
+  void operator()( vtkIdType ptId, vtkIdType endPtId )
+  {
+    double x[3];
+    for ( ; ptId < endPtId; ptId ++ )
+    {
+      vtkIdType newPtId = this->PointMap[ ptId ];
+      if ( newPtId < 0 )
+      {
+        continue;
+      }
+      this->InputPoints->GetPoint( ptId, x );
+      this->OutputPoints->SetPoint( newPtId, x );
+      if ( this->PointData )
+      {
+        this->PointData->Copy( ptId, newPtId );
+      }
+    }
+  }
+};
+
+// Compute the merged edge points and their data.
+struct TableBasedClipperComputeEdgePoints
+{
+  vtkPoints *                          InputPoints;
+  vtkPoints *                          OutputPoints;
+  const TableBasedClipperEdgeTuple * const * EdgePoints;
+  vtkIdType                            FirstPointId;
+  TableBasedClipperArrayPairList *     PointData;
+
+  void operator()( vtkIdType edgeId, vtkIdType endEdgeId )
+  {
+    double pt1[3], pt2[3], pt[3];
+    for ( ; edgeId < endEdgeId; edgeId ++ )
+    {
+      const TableBasedClipperEdgeTuple & pe = *this->EdgePoints[ edgeId ];
+      this->InputPoints->GetPoint( pe.V0, pt1 );
+      this->InputPoints->GetPoint( pe.V1, pt2 );
+      double p  = pe.T;
+      double bp = 1.0 - p;
+      pt[0] = pt1[0] * p + pt2[0] * bp;
+      pt[1] = pt1[1] * p + pt2[1] * bp;
+      pt[2] = pt1[2] * p + pt2[2] * bp;
+      this->OutputPoints->SetPoint( this->FirstPointId + edgeId, pt );
+      if ( this->PointData )
+      {
+        this->PointData->InterpolateEdge( pe.V0, pe.V1, bp,
+                                          this->FirstPointId + edgeId );
+      }
+    }
+  }
+};
+
+// Compute the centroid points and their data, in order for each cell since
+// a centroid point may use the previous ones.
+struct TableBasedClipperComputeCentroids
+{
+  const TableBasedClipperCentroid * Centroids;
+  const vtkIdType *                 CellCentroids;
+  const vtkIdType *                 PointIds;
+  vtkPoints *                       OutputPoints;
+  TableBasedClipperArrayPairList *  PointData;
+
+  void operator()( vtkIdType cellId, vtkIdType endCellId )
+  {
+    vtkIdType ids[8];
+    double    pts[8][3];
+    for ( ; cellId < endCellId; cellId ++ )
+    {
+      for ( vtkIdType c = this->CellCentroids[ cellId ];
+            c < this->CellCentroids[ cellId + 1 ]; c ++ )
+      {
+        const TableBasedClipperCentroid & ce = this->Centroids[c];
+        double pt[3] = { 0.0, 0.0, 0.0 };
+        double weight_factor = 1.0 / ce.nPts;
+        for ( int k = 0; k < ce.nPts; k ++ )
+        {
+          ids[k] = this->PointIds[ ce.ptIds[k] ];
+          this->OutputPoints->GetPoint( ids[k], pts[k] );
+          pt[0] += pts[k][0];
+          pt[1] += pts[k][1];
+          pt[2] += pts[k][2];
+        }
+        pt[0] *= weight_factor;
+        pt[1] *= weight_factor;
+        pt[2] *= weight_factor;
+
+        vtkIdType ptIdx = this->PointIds[ -1 - c ];
+        this->OutputPoints->SetPoint( ptIdx, pt );
+        if ( this->PointData )
+        {
+          this->PointData->AverageOutput( ce.nPts, ids, ptIdx );
+        }
+      }
+    }
+  }
+};
+
+// Copy the data of the output cells.
+struct TableBasedClipperCopyCellData
+{
+  const vtkIdType *                CellMap;
+  TableBasedClipperArrayPairList * CellData;
+
+  void operator()( vtkIdType cellId, vtkIdType endCellId )
+  {
+    for ( ; cellId < endCellId; cellId ++ )
+    {
+      this->CellData->Copy( this->CellMap[ cellId ], cellId );
+    }
+  }
+};
+
+// Clip the cells of an unstructured grid that can be clipped with the case
+// tables, in parallel. The other cells are ignored.
+void ClipUnstructuredGridCells( vtkUnstructuredGrid * input,
+  vtkDataArray * clipAray, double isoValue, bool insideOut,
+  int outputPointsPrecision, vtkUnstructuredGrid * output )
+{
+  const vtkIdType numPts   = input->GetNumberOfPoints();
+  const vtkIdType numCells = input->GetNumberOfCells();
+  const int       numTypes = TableBasedClipperNumberOfShapeTypes;
+
+  // Make sure that the cells are ready for concurrent access.
+  if ( numCells > 0 )
+  {
+    vtkNew< vtkIdList > cellPts;
+    input->GetCellPoints( 0, cellPts );
+  }
+
+  // Count the outputs of each cell, and compute their locations. The shapes
+  // of each type are contiguous, in the order of the cells.
+  TableBasedClipperCellOutputs cellOutputs( numCells );
+  TableBasedClipperClipCells clipCells{ input, clipAray, isoValue, insideOut,
+    false, &cellOutputs, nullptr, nullptr, nullptr, nullptr, nullptr, {} };
+  vtkSMPTools::For( 0, numCells, clipCells );
+  cellOutputs.ComputeOffsets();
+
+  // The first shape of each type, then the location of its first point (in
+  // the connectivity); the functors index the latter from numTypes + 1 on.
+  vtkIdType shapeStarts[ 2 * numTypes + 2 ];
+  shapeStarts[0]              = 0;
+  shapeStarts[ numTypes + 1 ] = 0;
+  for ( int t = 0; t < numTypes; t ++ )
+  {
+    vtkIdType numTypeShapes = cellOutputs.Shapes[t][ numCells ];
+    shapeStarts[ t + 1 ] = shapeStarts[t] + numTypeShapes;
+    shapeStarts[ numTypes + t + 2 ] = shapeStarts[ numTypes + t + 1 ] +
+      numTypeShapes * TableBasedClipperShapeSizes[t];
+  }
+  const vtkIdType numShapes    = shapeStarts[ numTypes ];
+  const vtkIdType connSize     = shapeStarts[ 2 * numTypes + 1 ];
+  const vtkIdType numEdges     = cellOutputs.Edges[ numCells ];
+  const vtkIdType numCentroids = cellOutputs.Centroids[ numCells ];
+
+  std::vector< vtkIdType > shapeCells( numShapes );
+  std::vector< vtkIdType > shapePoints( connSize );
+  std::vector< TableBasedClipperEdgeTuple > edges( numEdges );
+  std::vector< TableBasedClipperCentroid > centroids( numCentroids );
+  clipCells.Fill        = true;
+  clipCells.ShapeStarts = shapeStarts;
+  clipCells.ShapeCells  = shapeCells.data();
+  clipCells.ShapePoints = shapePoints.data();
+  clipCells.Edges       = edges.data();
+  clipCells.Centroids   = centroids.data();
+  vtkSMPTools::For( 0, numCells, clipCells );
+
+  // Merge the edge points.
+  std::vector< vtkIdType > edgePointIds( numEdges + 1, 0 );
+  std::vector< const TableBasedClipperEdgeTuple * > edgePoints;
+  if ( numEdges > 0 )
+  {
+    TableBasedClipperEdgeLocator locator;
+    vtkIdType numUniqueEdges = 0;
+    const vtkIdType * groups =
+      locator.MergeEdges( numEdges, edges.data(), numUniqueEdges );
+
+    std::vector< vtkIdType > firstEdges( numEdges + 1, 0 );
+    TableBasedClipperFindFirstEdges findFirst{ edges.data(), groups,
+                                               firstEdges.data() };
+    vtkSMPTools::For( 0, numUniqueEdges, findFirst );
+    vtkSMPTools::ExclusiveScan( firstEdges.begin(), firstEdges.end(),
+                                firstEdges.begin(), vtkIdType( 0 ) );
+
+    edgePoints.resize( numUniqueEdges );
+    TableBasedClipperNumberEdges numberEdges{ edges.data(), groups,
+      firstEdges.data(), edgePointIds.data(), edgePoints.data() };
+    vtkSMPTools::For( 0, numUniqueEdges, numberEdges );
+  }
+
+  // Number the used input points in the order of their first use.
+  std::unique_ptr< std::atomic< vtkIdType >[] > firstUses(
+    new std::atomic< vtkIdType >[ numPts ] );
+  vtkSMPTools::Fill( firstUses.get(), firstUses.get() + numPts, connSize );
+  TableBasedClipperFindFirstUses findFirstUses{ shapePoints.data(), numPts,
+                                                firstUses.get() };
+  vtkSMPTools::For( 0, connSize, findFirstUses );
+
+  std::vector< vtkIdType > firstPointIds( numShapes + 1, 0 );
+  TableBasedClipperNumberInputPoints numberPoints{ shapeStarts,
+    shapePoints.data(), numPts, firstUses.get(), firstPointIds.data(),
+    nullptr };
+  vtkSMPTools::For( 0, numShapes, numberPoints );
+  vtkSMPTools::ExclusiveScan( firstPointIds.begin(), firstPointIds.end(),
+                              firstPointIds.begin(), vtkIdType( 0 ) );
+  const vtkIdType numUsed = firstPointIds[ numShapes ];
+
+  // The output point ids, indexed by the encoded point ids (offset by the
+  // number of centroids).
+  const vtkIdType centroidStart = numUsed + static_cast< vtkIdType >( edgePoints.size() );
+  const vtkIdType nOutPts       = centroidStart + numCentroids;
+  std::vector< vtkIdType > pointIds( numCentroids + numPts + numEdges, -1 );
+  vtkIdType * ptLookup = pointIds.data() + numCentroids;
+  numberPoints.PointMap = ptLookup;
+  vtkSMPTools::For( 0, numShapes, numberPoints );
+  firstUses.reset();
+
+  vtkSMPTools::For( 0, numCentroids + numEdges,
+    [&]( vtkIdType i, vtkIdType end )
+    {
+      for ( ; i < end; i ++ )
+      {
+        if ( i < numCentroids )
+        {
+          pointIds[i] = centroidStart + numCentroids - 1 - i;
+        }
+        else
+        {
+          pointIds[ numPts + i ] = numUsed + edgePointIds[ i - numCentroids ];
+        }
+      }
+    } );
+
+  // Set up the output points and their data.
+  vtkPoints * inputPts = input->GetPoints();
+  vtkNew< vtkPoints > outPts;
+  if ( outputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION )
+  {
+    outPts->SetDataType( inputPts->GetDataType() );
+  }
+  else if ( outputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION )
+  {
+    outPts->SetDataType( VTK_FLOAT );
+  }
+  else if ( outputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION )
+  {
+    outPts->SetDataType( VTK_DOUBLE );
+  }
+  outPts->SetNumberOfPoints( nOutPts );
+
+  vtkPointData * inPD  = input->GetPointData();
+  vtkPointData * outPD = output->GetPointData();
+  outPD->CopyAllocate( inPD, nOutPts );
+  TableBasedClipperArrayPairList pointData;
+  bool threadedPointData = pointData.Build( inPD, outPD, nOutPts );
+  TableBasedClipperArrayPairList * pd = threadedPointData ? &pointData : nullptr;
+
+  TableBasedClipperCopyInputPoints copyPoints{ inputPts, outPts, ptLookup, pd };
+  vtkSMPTools::For( 0, numPts, copyPoints );
+  TableBasedClipperComputeEdgePoints computeEdgePoints{ inputPts, outPts,
+    edgePoints.data(), numUsed, pd };
+  vtkSMPTools::For( 0, static_cast< vtkIdType >( edgePoints.size() ),
+                    computeEdgePoints );
+
+  if ( !threadedPointData )
+  {
+    for ( vtkIdType i = 0; i < numPts; i ++ )
+    {
+      if ( ptLookup[i] >= 0 )
+      {
+        outPD->CopyData( inPD, i, ptLookup[i] );
+      }
+    }
+    for ( size_t i = 0; i < edgePoints.size(); i ++ )
+    {
+      const TableBasedClipperEdgeTuple & pe = *edgePoints[i];
+      outPD->InterpolateEdge( inPD, numUsed + i, pe.V0, pe.V1, 1.0 - pe.T );
+    }
+  }
+
+  TableBasedClipperComputeCentroids computeCentroids{ centroids.data(),
+    cellOutputs.Centroids.data(), pointIds.data() + numCentroids, outPts, pd };
+  if ( threadedPointData )
+  {
+    vtkSMPTools::For( 0, numCells, computeCentroids );
   }
   else
   {
-    toDelete = 1;
-    numbPnts = inputPts->GetNumberOfPoints();
-    theCords = new double [ numbPnts * 3 ];
-    for ( i = 0; i < numbPnts; i ++ )
+    computeCentroids( 0, numCells );
+    vtkNew< vtkIdList > idList;
+    double weights[8];
+    for ( vtkIdType c = 0; c < numCentroids; c ++ )
     {
-      inputPts->GetPoint( i, theCords + ( i << 1 ) + i );
+      const TableBasedClipperCentroid & ce = centroids[c];
+      idList->SetNumberOfIds( ce.nPts );
+      for ( int k = 0; k < ce.nPts; k ++ )
+      {
+        weights[k] = 1.0 / ce.nPts;
+        idList->SetId( k, ptLookup[ ce.ptIds[k] ] );
+      }
+      outPD->InterpolatePoint( outPD, centroidStart + c, idList, weights );
     }
   }
-  inputPts = nullptr;
 
+  // The VisIt original node numbers of the points.
+  vtkIntArray * origNodes = vtkArrayDownCast< vtkIntArray >
+                            (  inPD->GetArray( "avtOriginalNodeNumbers" )  );
+  if ( origNodes )
+  {
+    vtkNew< vtkIntArray > newOrigNodes;
+    newOrigNodes->SetNumberOfComponents( origNodes->GetNumberOfComponents() );
+    newOrigNodes->SetNumberOfTuples( nOutPts );
+    newOrigNodes->SetName( origNodes->GetName() );
+    for ( vtkIdType i = 0; i < numPts; i ++ )
+    {
+      if ( ptLookup[i] >= 0 )
+      {
+        newOrigNodes->SetTuple( ptLookup[i], i, origNodes );
+      }
+    }
+    for ( size_t i = 0; i < edgePoints.size(); i ++ )
+    {
+      const TableBasedClipperEdgeTuple & pe = *edgePoints[i];
+      newOrigNodes->SetTuple( numUsed + i,
+        ( 1.0 - pe.T <= 0.5 ? pe.V0 : pe.V1 ), origNodes );
+    }
+    for ( vtkIdType i = centroidStart; i < nOutPts; i ++ )
+    {
+      for ( int z = 0; z < newOrigNodes->GetNumberOfComponents(); z ++ )
+      {
+        newOrigNodes->SetComponent( i, z, -1 );
+      }
+    }
+    outPD->AddArray( newOrigNodes );
+  }
+
+  output->SetPoints( outPts );
+
+  // Set up the output cells and their data.
+  vtkNew< vtkIdTypeArray > offsets;
+  offsets->SetNumberOfValues( numShapes + 1 );
+  vtkNew< vtkIdTypeArray > connectivity;
+  connectivity->SetNumberOfValues( connSize );
+  vtkNew< vtkUnsignedCharArray > cellTypes;
+  cellTypes->SetNumberOfValues( numShapes );
+  vtkNew< vtkIdTypeArray > cellLocations;
+  cellLocations->SetNumberOfValues( numShapes );
+  vtkIdType * offsetsPtr   = offsets->GetPointer( 0 );
+  vtkIdType * connPtr      = connectivity->GetPointer( 0 );
+  unsigned char * typesPtr = cellTypes->GetPointer( 0 );
+  vtkIdType * locationsPtr = cellLocations->GetPointer( 0 );
+  const vtkIdType * encodedIds = shapePoints.data();
+  const vtkIdType * outIds     = pointIds.data() + numCentroids;
+  offsetsPtr[ numShapes ] = connSize;
+
+  vtkSMPTools::For( 0, numShapes, [&]( vtkIdType shapeId, vtkIdType end )
+    {
+      int t = 0;
+      for ( ; shapeId < end; shapeId ++ )
+      {
+        while ( shapeStarts[ t + 1 ] <= shapeId )
+        {
+          t ++;
+        }
+        const int       size = TableBasedClipperShapeSizes[t];
+        const vtkIdType loc  = shapeStarts[ numTypes + 1 + t ] +
+                               ( shapeId - shapeStarts[t] ) * size;
+        offsetsPtr[ shapeId ]   = loc;
+        locationsPtr[ shapeId ] = loc + shapeId;
+        typesPtr[ shapeId ]     = TableBasedClipperShapeCellTypes[t];
+        for ( vtkIdType i = loc; i < loc + size; i ++ )
+        {
+          connPtr[i] = outIds[ encodedIds[i] ];
+        }
+      }
+    } );
+
+  vtkCellData * inCD  = input->GetCellData();
+  vtkCellData * outCD = output->GetCellData();
+  outCD->CopyAllocate( inCD, numShapes );
+  TableBasedClipperArrayPairList cellData;
+  if ( cellData.Build( inCD, outCD, numShapes ) )
+  {
+    TableBasedClipperCopyCellData copyCellData{ shapeCells.data(), &cellData };
+    vtkSMPTools::For( 0, numShapes, copyCellData );
+  }
+  else
+  {
+    for ( vtkIdType i = 0; i < numShapes; i ++ )
+    {
+      outCD->CopyData( inCD, shapeCells[i], i );
+    }
+  }
+
+  vtkNew< vtkCellArray > cells;
+  cells->SetData( offsets, connectivity );
+  output->SetCells( cellTypes, cellLocations, cells );
+}
+}
+
+// ============================================================================
+// ============== Threaded clipping of unstructured grids ( end ) =============
+// ============================================================================
+
+//-----------------------------------------------------------------------------
+void vtkTableBasedClipDataSet::ClipUnstructuredGridData( vtkDataSet * inputGrd,
+     vtkDataArray * clipAray, double isoValue, vtkUnstructuredGrid * outputUG )
+{
+  vtkUnstructuredGrid * unstruct = vtkUnstructuredGrid::SafeDownCast( inputGrd );
+
+  vtkIdType   i;
+  vtkIdType   numbPnts = 0;
+  int         numCants = 0; // number of cells not clipped by this filter
+  vtkIdType   numCells = unstruct->GetNumberOfCells();
+
+  // the stuffs that can not be clipped by this filter
+  vtkUnstructuredGrid * specials = vtkUnstructuredGrid::New();
+  specials->SetPoints( unstruct->GetPoints() );
+  specials->GetPointData()->ShallowCopy( unstruct->GetPointData() );
+  specials->Allocate( numCells );
+
+  for ( i = 0; i < numCells; i ++ )
+  {
+    int cellType = unstruct->GetCellType( i );
+    if ( CanClipCellType( cellType ) )
+    {
+      // clipped in parallel below
+      continue;
+    }
+
+    if ( numCants == 0 )
+    {
+        specials->GetCellData()
+                ->CopyAllocate( unstruct->GetCellData(), numCells );
+    }
+    if ( cellType == VTK_POLYHEDRON )
+    {
+      vtkIdType nfaces, *facePtIds;
+      unstruct->GetFaceStream(i, nfaces, facePtIds);
+      specials->InsertNextCell(cellType, nfaces, facePtIds);
+    }
+    else
+    {
+      vtkIdType * pntIndxs = nullptr;
+      unstruct->GetCellPoints( i, numbPnts, pntIndxs );
+      specials->InsertNextCell( cellType, numbPnts, pntIndxs );
+    }
+    specials->GetCellData()
+            ->CopyData( unstruct->GetCellData(), i, numCants );
+    numCants ++;
+  }
 
   // the stuff that can not be clipped
   if ( numCants > 0 )
@@ -3361,7 +4145,8 @@ void vtkTableBasedClipDataSet::ClipUnstructuredGridData( vtkDataSet * inputGrd,
     this->ClipDataSet( specials, clipAray, vtkUGrid );
 
     vtkUnstructuredGrid * visItGrd = vtkUnstructuredGrid::New();
-    visItVFV->ConstructDataSet( unstruct, visItGrd, theCords );
+    ClipUnstructuredGridCells( unstruct, clipAray, isoValue,
+      this->InsideOut != 0, this->OutputPointsPrecision, visItGrd );
 
     vtkAppendFilter * appender = vtkAppendFilter::New();
     appender->AddInputData( vtkUGrid );
@@ -3379,18 +4164,12 @@ void vtkTableBasedClipDataSet::ClipUnstructuredGridData( vtkDataSet * inputGrd,
   }
   else
   {
-    visItVFV->ConstructDataSet( unstruct, outputUG, theCords );
+    ClipUnstructuredGridCells( unstruct, clipAray, isoValue,
+      this->InsideOut != 0, this->OutputPointsPrecision, outputUG );
   }
 
   specials->Delete();
-  delete visItVFV;
-  if ( toDelete )
-  {
-    delete [] theCords;
-  }
   specials = nullptr;
-  visItVFV = nullptr;
-  theCords = nullptr;
   unstruct = nullptr;
 }
 
@@ -70,6 +70,13 @@
  *  advantages are gained by adopting the unique clipping and triangulation tables
  *  proposed by VisIt.
  *
+ *  The cells of vtkUnstructuredGrid inputs are clipped in parallel with
+ *  vtkSMPTools, and the edge points are merged with
+ *  vtkStaticEdgeLocatorTemplate. The clip function, if any, is evaluated
+ *  serially since implicit functions are not thread safe in general. The
+ *  output (including the point and cell numbering) does not depend on the
+ *  number of threads.
+ *
  * @warning
  *  vtkTableBasedClipDataSet makes use of a hash table (that is provided by class
  *  maintained by internal class vtkTableBasedClipperDataSetFromVolume) to achieve
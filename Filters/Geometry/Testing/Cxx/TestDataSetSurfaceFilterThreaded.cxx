@@ -0,0 +1,359 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestDataSetSurfaceFilterThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the external faces of a grid of linear 3D cells extracted in
+// parallel are the ones of the serial hash, in the same order, and that they
+// are the faces used by a single cell.
+
+#include "vtkCell.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkDataSetSurfaceFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+const int Resolution = 16;
+
+vtkIdType PointId(int i, int j, int k)
+{
+  return i + Resolution * (j + Resolution * k);
+}
+
+// A lattice of cubes split into cells of the different types, with a hole,
+// cells used three times, and two stacks of prisms.
+vtkSmartPointer<vtkUnstructuredGrid> CreateGrid()
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < Resolution; ++k)
+  {
+    for (int j = 0; j < Resolution; ++j)
+    {
+      for (int i = 0; i < Resolution; ++i)
+      {
+        points->InsertNextPoint(i + 0.01 * ((i * j + k) % 7), j, k);
+      }
+    }
+  }
+
+  vtkSmartPointer<vtkUnstructuredGrid> grid =
+    vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->Allocate(5 * Resolution * Resolution * Resolution);
+  for (int k = 0; k < Resolution - 1; ++k)
+  {
+    for (int j = 0; j < Resolution - 1; ++j)
+    {
+      for (int i = 0; i < Resolution - 1; ++i)
+      {
+        if (i > 10 && j > 10)
+        {
+          continue;
+        }
+        vtkIdType c[8] = { PointId(i, j, k), PointId(i + 1, j, k),
+                           PointId(i + 1, j + 1, k), PointId(i, j + 1, k),
+                           PointId(i, j, k + 1), PointId(i + 1, j, k + 1),
+                           PointId(i + 1, j + 1, k + 1),
+                           PointId(i, j + 1, k + 1) };
+        switch ((i + 2 * j + 3 * k) % 5)
+        {
+          case 0:
+            grid->InsertNextCell(VTK_HEXAHEDRON, 8, c);
+            break;
+          case 1:
+          {
+            vtkIdType voxel[8] = { c[0], c[1], c[3], c[2],
+                                   c[4], c[5], c[7], c[6] };
+            grid->InsertNextCell(VTK_VOXEL, 8, voxel);
+            break;
+          }
+          case 2:
+          {
+            vtkIdType wedge1[6] = { c[0], c[1], c[2], c[4], c[5], c[6] };
+            vtkIdType wedge2[6] = { c[0], c[2], c[3], c[4], c[6], c[7] };
+            grid->InsertNextCell(VTK_WEDGE, 6, wedge1);
+            grid->InsertNextCell(VTK_WEDGE, 6, wedge2);
+            break;
+          }
+          case 3:
+          {
+            vtkIdType tetras[5][4] = { { c[0], c[1], c[3], c[4] },
+                                       { c[1], c[2], c[3], c[6] },
+                                       { c[1], c[4], c[5], c[6] },
+                                       { c[3], c[4], c[6], c[7] },
+                                       { c[1], c[3], c[4], c[6] } };
+            for (int t = 0; t < 5; ++t)
+            {
+              grid->InsertNextCell(VTK_TETRA, 4, tetras[t]);
+            }
+            break;
+          }
+          default:
+          {
+            vtkIdType pyramid[5] = { c[0], c[1], c[2], c[3], c[4] };
+            for (int t = 0; t < 3; ++t)
+            {
+              grid->InsertNextCell(VTK_PYRAMID, 5, pyramid);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (int sides = 5; sides <= 6; ++sides)
+  {
+    vtkIdType first = points->GetNumberOfPoints();
+    for (int level = 0; level < 3; ++level)
+    {
+      for (int s = 0; s < sides; ++s)
+      {
+        points->InsertNextPoint(10 * sides + cos(s), sin(s), level);
+      }
+    }
+    for (int level = 0; level < 2; ++level)
+    {
+      vtkIdType prism[12];
+      for (int s = 0; s < sides; ++s)
+      {
+        prism[s] = first + sides * level + s;
+        prism[s + sides] = first + sides * (level + 1) + s;
+      }
+      grid->InsertNextCell(
+        sides == 5 ? VTK_PENTAGONAL_PRISM : VTK_HEXAGONAL_PRISM, 2 * sides,
+        prism);
+    }
+  }
+
+  vtkNew<vtkDoubleArray> pointValues;
+  pointValues->SetName("PointValues");
+  vtkNew<vtkUnsignedCharArray> ghosts;
+  ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    pointValues->InsertNextValue(0.5 * i);
+    ghosts->InsertNextValue(
+      i % 97 == 0 ? vtkDataSetAttributes::HIDDENPOINT : 0);
+  }
+  grid->GetPointData()->AddArray(pointValues);
+  grid->GetPointData()->AddArray(ghosts);
+  vtkNew<vtkDoubleArray> cellValues;
+  cellValues->SetName("CellValues");
+  for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+  {
+    cellValues->InsertNextValue(-1.0 * i);
+  }
+  grid->GetCellData()->AddArray(cellValues);
+  return grid;
+}
+
+vtkSmartPointer<vtkPolyData> ExtractSurface(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkDataSetSurfaceFilter> surface;
+  surface->SetInputData(grid);
+  surface->PassThroughCellIdsOn();
+  surface->PassThroughPointIdsOn();
+  surface->Update();
+  return surface->GetOutput();
+}
+
+bool SameArrays(vtkDataSetAttributes* a, vtkDataSetAttributes* b)
+{
+  if (a->GetNumberOfArrays() != b->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < a->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* arrayA = a->GetArray(i);
+    vtkDataArray* arrayB = b->GetArray(arrayA->GetName());
+    if (!arrayB || arrayA->GetNumberOfValues() != arrayB->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType j = 0; j < arrayA->GetNumberOfValues(); ++j)
+    {
+      if (arrayA->GetVariantValue(j) != arrayB->GetVariantValue(j))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// The faces of the cells (as sorted point ids) with the number of cells
+// using them and the last of these cells.
+typedef std::map<std::vector<vtkIdType>, std::pair<int, vtkIdType> > FaceMap;
+
+FaceMap CountFaces(vtkUnstructuredGrid* grid)
+{
+  FaceMap faces;
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    grid->GetCell(cellId, cell);
+    for (int f = 0; f < cell->GetNumberOfFaces(); ++f)
+    {
+      vtkIdList* ids = cell->GetFace(f)->GetPointIds();
+      std::vector<vtkIdType> face(ids->GetPointer(0),
+                                  ids->GetPointer(0) + ids->GetNumberOfIds());
+      std::sort(face.begin(), face.end());
+      std::pair<int, vtkIdType>& use = faces[face];
+      use.first++;
+      use.second = cellId;
+    }
+  }
+  return faces;
+}
+
+// The surface must consist of the faces used by a single cell and without
+// hidden point, each once, with the data of its cell and points.
+bool ExternalFaces(vtkUnstructuredGrid* grid, vtkPolyData* surface)
+{
+  FaceMap faces = CountFaces(grid);
+  vtkUnsignedCharArray* ghosts = grid->GetPointGhostArray();
+  vtkIdType numExternal = 0;
+  for (const auto& face : faces)
+  {
+    bool hidden = false;
+    for (vtkIdType ptId : face.first)
+    {
+      hidden = hidden ||
+        (ghosts->GetValue(ptId) & vtkDataSetAttributes::HIDDENPOINT) != 0;
+    }
+    numExternal += (face.second.first == 1 && !hidden) ? 1 : 0;
+  }
+  if (surface->GetNumberOfPolys() != numExternal)
+  {
+    return false;
+  }
+
+  vtkIdTypeArray* pointIds = vtkArrayDownCast<vtkIdTypeArray>(
+    surface->GetPointData()->GetArray("vtkOriginalPointIds"));
+  vtkIdTypeArray* cellIds = vtkArrayDownCast<vtkIdTypeArray>(
+    surface->GetCellData()->GetArray("vtkOriginalCellIds"));
+  vtkDataArray* pointValues = surface->GetPointData()->GetArray("PointValues");
+  vtkDataArray* cellValues = surface->GetCellData()->GetArray("CellValues");
+  for (vtkIdType i = 0; i < surface->GetNumberOfPoints(); ++i)
+  {
+    if (pointValues->GetTuple1(i) != 0.5 * pointIds->GetValue(i))
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> pts;
+  for (vtkIdType i = 0; i < surface->GetNumberOfCells(); ++i)
+  {
+    surface->GetCellPoints(i, pts);
+    std::vector<vtkIdType> face;
+    for (vtkIdType j = 0; j < pts->GetNumberOfIds(); ++j)
+    {
+      face.push_back(pointIds->GetValue(pts->GetId(j)));
+    }
+    std::sort(face.begin(), face.end());
+    auto found = faces.find(face);
+    if (found == faces.end() || found->second.first != 1 ||
+        found->second.second != cellIds->GetValue(i) ||
+        cellValues->GetTuple1(i) != -1.0 * cellIds->GetValue(i))
+    {
+      return false;
+    }
+    // Each face is output once.
+    found->second.first = 0;
+  }
+  return true;
+}
+
+}
+
+int TestDataSetSurfaceFilterThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkUnstructuredGrid> grid = CreateGrid();
+
+  vtkSmartPointer<vtkPolyData> serial;
+  vtkSmartPointer<vtkPolyData> threaded;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"),
+                          [&]() { serial = ExtractSurface(grid); });
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4),
+                          [&]() { threaded = ExtractSurface(grid); });
+
+  if (serial->GetNumberOfPolys() == 0 || !ExternalFaces(grid, serial))
+  {
+    cerr << "Wrong external faces" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (serial->GetNumberOfPoints() != threaded->GetNumberOfPoints() ||
+      serial->GetNumberOfPolys() != threaded->GetNumberOfPolys())
+  {
+    cerr << "Wrong number of points or polygons: "
+         << threaded->GetNumberOfPoints() << " and "
+         << threaded->GetNumberOfPolys() << " instead of "
+         << serial->GetNumberOfPoints() << " and "
+         << serial->GetNumberOfPolys() << endl;
+    return EXIT_FAILURE;
+  }
+
+  for (vtkIdType i = 0; i < serial->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    double y[3];
+    serial->GetPoint(i, x);
+    threaded->GetPoint(i, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      cerr << "Wrong point " << i << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkIdTypeArray* polys = serial->GetPolys()->GetData();
+  vtkIdTypeArray* threadedPolys = threaded->GetPolys()->GetData();
+  if (polys->GetNumberOfValues() != threadedPolys->GetNumberOfValues() ||
+      !std::equal(polys->GetPointer(0),
+                  polys->GetPointer(0) + polys->GetNumberOfValues(),
+                  threadedPolys->GetPointer(0)))
+  {
+    cerr << "Wrong polygons" << endl;
+    return EXIT_FAILURE;
+  }
+
+  if (!SameArrays(serial->GetPointData(), threaded->GetPointData()) ||
+      !SameArrays(serial->GetCellData(), threaded->GetCellData()))
+  {
+    cerr << "Wrong point or cell data" << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -21,6 +21,7 @@
 #include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkHexahedron.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -32,6 +33,7 @@
 #include "vtkPyramid.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridGeometryFilter.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGridGeometryFilter.h"
@@ -51,6 +53,7 @@
 #include <algorithm>
 #include <cassert>
 #include <unordered_map>
+#include <vector>
 
 static inline int sizeofFastQuad(int numPts)
 {
@@ -1479,6 +1482,383 @@ void vtkDataSetSurfaceFilter::PrintSelf(ostream& os, vtkIndent indent)
 
 
 
+//----------------------------------------------------------------------------
+namespace
+{
+
+// The faces of the linear 3D cells, in the order UnstructuredGridExecute()
+// inserts them in the hash. Each face is its number of points followed by
+// its point indices.
+struct vtkSurfaceCellFaces
+{
+  int NumberOfFaces;
+  int Faces[8][7];
+};
+
+const vtkSurfaceCellFaces vtkTetraFaces = { 4,
+  { { 3, 0, 1, 3 }, { 3, 0, 2, 1 }, { 3, 0, 3, 2 }, { 3, 1, 2, 3 } } };
+const vtkSurfaceCellFaces vtkHexahedronFaces = { 6,
+  { { 4, 0, 1, 5, 4 }, { 4, 0, 3, 2, 1 }, { 4, 0, 4, 7, 3 },
+    { 4, 1, 2, 6, 5 }, { 4, 2, 3, 7, 6 }, { 4, 4, 5, 6, 7 } } };
+const vtkSurfaceCellFaces vtkVoxelFaces = { 6,
+  { { 4, 0, 1, 5, 4 }, { 4, 0, 2, 3, 1 }, { 4, 0, 4, 6, 2 },
+    { 4, 1, 3, 7, 5 }, { 4, 2, 6, 7, 3 }, { 4, 4, 5, 7, 6 } } };
+const vtkSurfaceCellFaces vtkWedgeFaces = { 5,
+  { { 4, 0, 2, 5, 3 }, { 4, 1, 0, 3, 4 }, { 4, 2, 1, 4, 5 },
+    { 3, 0, 1, 2 }, { 3, 3, 5, 4 } } };
+const vtkSurfaceCellFaces vtkPyramidFaces = { 5,
+  { { 4, 3, 2, 1, 0 }, { 3, 0, 1, 4 }, { 3, 1, 2, 4 }, { 3, 2, 3, 4 },
+    { 3, 3, 0, 4 } } };
+const vtkSurfaceCellFaces vtkPentagonalPrismFaces = { 7,
+  { { 4, 0, 1, 6, 5 }, { 4, 1, 2, 7, 6 }, { 4, 2, 3, 8, 7 },
+    { 4, 3, 4, 9, 8 }, { 4, 4, 0, 5, 9 }, { 5, 0, 1, 2, 3, 4 },
+    { 5, 5, 6, 7, 8, 9 } } };
+const vtkSurfaceCellFaces vtkHexagonalPrismFaces = { 8,
+  { { 4, 0, 1, 7, 6 }, { 4, 1, 2, 8, 7 }, { 4, 2, 3, 9, 8 },
+    { 4, 3, 4, 10, 9 }, { 4, 4, 5, 11, 10 }, { 4, 5, 0, 6, 11 },
+    { 6, 0, 1, 2, 3, 4, 5 }, { 6, 6, 7, 8, 9, 10, 11 } } };
+
+const vtkSurfaceCellFaces* vtkGetSurfaceCellFaces(int cellType)
+{
+  switch (cellType)
+  {
+    case VTK_TETRA:
+      return &vtkTetraFaces;
+    case VTK_HEXAHEDRON:
+      return &vtkHexahedronFaces;
+    case VTK_VOXEL:
+      return &vtkVoxelFaces;
+    case VTK_WEDGE:
+      return &vtkWedgeFaces;
+    case VTK_PYRAMID:
+      return &vtkPyramidFaces;
+    case VTK_PENTAGONAL_PRISM:
+      return &vtkPentagonalPrismFaces;
+    case VTK_HEXAGONAL_PRISM:
+      return &vtkHexagonalPrismFaces;
+    default:
+      return nullptr;
+  }
+}
+
+// Reorder the points of a face to get the smallest id first, as
+// InsertTriInHash(), InsertQuadInHash() and InsertPolygonInHash() do.
+void vtkOrderFace(vtkIdType* f, int numPts)
+{
+  vtkIdType tmp;
+  if (numPts == 3)
+  {
+    if (f[1] < f[0] && f[1] < f[2])
+    {
+      tmp = f[0]; f[0] = f[1]; f[1] = f[2]; f[2] = tmp;
+    }
+    else if (f[2] < f[0] && f[2] < f[1])
+    {
+      tmp = f[0]; f[0] = f[2]; f[2] = f[1]; f[1] = tmp;
+    }
+  }
+  else if (numPts == 4)
+  {
+    if (f[1] < f[0] && f[1] < f[2] && f[1] < f[3])
+    {
+      tmp = f[0]; f[0] = f[1]; f[1] = f[2]; f[2] = f[3]; f[3] = tmp;
+    }
+    else if (f[2] < f[0] && f[2] < f[1] && f[2] < f[3])
+    {
+      std::swap(f[0], f[2]);
+      std::swap(f[1], f[3]);
+    }
+    else if (f[3] < f[0] && f[3] < f[1] && f[3] < f[2])
+    {
+      tmp = f[0]; f[0] = f[3]; f[3] = f[2]; f[2] = f[1]; f[1] = tmp;
+    }
+  }
+  else
+  {
+    int offset = 0;
+    for (int i = 0; i < numPts; i++)
+    {
+      if (f[i] < f[offset])
+      {
+        offset = i;
+      }
+    }
+    std::rotate(f, f + offset, f + numPts);
+  }
+}
+
+// Whether face f matches the face e already in the hash bin, with the tests
+// of InsertTriInHash(), InsertQuadInHash() and InsertPolygonInHash().
+bool vtkSameFace(const vtkIdType* f, int numPts, const vtkIdType* e,
+                 int eNumPts)
+{
+  if (numPts != eNumPts)
+  {
+    return false;
+  }
+  if (numPts == 3)
+  {
+    return (f[1] == e[1] && f[2] == e[2]) || (f[1] == e[2] && f[2] == e[1]);
+  }
+  if (numPts == 4)
+  {
+    return f[2] == e[2] &&
+      ((f[1] == e[1] && f[3] == e[3]) || (f[1] == e[3] && f[3] == e[1]));
+  }
+  if (f[0] != e[0])
+  {
+    return false;
+  }
+  if (f[1] == e[1])
+  {
+    for (int i = 2; i < numPts; ++i)
+    {
+      if (f[i] != e[i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  for (int i = 1; i < numPts; ++i)
+  {
+    if (f[numPts - i] != e[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Extract the faces of an unstructured grid of linear 3D cells that are used
+// by a single cell, the external faces, in parallel.
+//
+// The cells are split into ranges, and the faces of each range are sorted
+// into partitions of the point ids by their smallest point id. Each
+// partition then hashes its faces in the order of their cells, which is
+// the order of the serial hash, so that matched pairs cancel and the
+// remaining faces come out exactly as GetNextVisibleQuadFromHash() returns
+// them.
+class vtkExternalFaces
+{
+public:
+  explicit vtkExternalFaces(vtkUnstructuredGrid* grid)
+    : Grid(grid), Types(grid->GetCellTypesArray()->GetPointer(0))
+  {
+    vtkIdType numCells = grid->GetNumberOfCells();
+    this->NumberOfPoints = grid->GetNumberOfPoints();
+    vtkIdType numTasks =
+      4 * static_cast<vtkIdType>(vtkSMPTools::GetEstimatedNumberOfThreads());
+    this->NumberOfRanges = std::max<vtkIdType>(
+      1, std::min(numTasks, numCells / 1024));
+    this->NumberOfPartitions = std::max<vtkIdType>(
+      1, std::min(numTasks, this->NumberOfPoints / 1024));
+    this->PartitionSize = (this->NumberOfPoints +
+      this->NumberOfPartitions - 1) / this->NumberOfPartitions;
+    this->Faces.resize(this->NumberOfRanges * this->NumberOfPartitions);
+    this->ExternalFaces.resize(this->NumberOfPartitions);
+  }
+
+  // Whether all the cells of the grid are linear 3D cells of known faces
+  // and there are threads to share the work. With a single thread the
+  // serial hash is faster.
+  static bool CanExtract(vtkUnstructuredGrid* grid)
+  {
+    vtkUnsignedCharArray* types = grid->GetCellTypesArray();
+    if (!types || grid->GetNumberOfCells() < 1 ||
+        vtkSMPTools::GetEstimatedNumberOfThreads() < 2)
+    {
+      return false;
+    }
+    const unsigned char* type = types->GetPointer(0);
+    const unsigned char* end = type + grid->GetNumberOfCells();
+    for (; type != end; ++type)
+    {
+      if (!vtkGetSurfaceCellFaces(*type))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Get the ordered points of a face, identified by its cell id times 8
+  // plus its index in the cell. Returns the number of points. cellPts is
+  // the scratch list of the calling thread.
+  int GetFace(vtkIdType cellFace, vtkIdType* f, vtkIdList* cellPts) const
+  {
+    vtkIdType cellId = cellFace >> 3;
+    const int* face =
+      vtkGetSurfaceCellFaces(this->Types[cellId])->Faces[cellFace & 7];
+    vtkIdType npts;
+    const vtkIdType* pts;
+    this->Grid->GetCellPoints(cellId, npts, pts, cellPts);
+    for (int j = 0; j < face[0]; ++j)
+    {
+      f[j] = pts[face[j + 1]];
+    }
+    vtkOrderFace(f, face[0]);
+    return face[0];
+  }
+
+  // Sort the faces of ranges of cells into the point partitions.
+  struct SortFaces
+  {
+    vtkExternalFaces* Self;
+
+    void operator()(vtkIdType begin, vtkIdType end)
+    {
+      vtkExternalFaces* self = this->Self;
+      vtkIdType numCells = self->Grid->GetNumberOfCells();
+      vtkNew<vtkIdList> cellPts;
+      for (vtkIdType range = begin; range < end; ++range)
+      {
+        std::vector<vtkIdType>* faces =
+          &self->Faces[range * self->NumberOfPartitions];
+        vtkIdType cellId = range * numCells / self->NumberOfRanges;
+        vtkIdType lastCellId = (range + 1) * numCells / self->NumberOfRanges;
+        for (; cellId < lastCellId; ++cellId)
+        {
+          const vtkSurfaceCellFaces* cellFaces =
+            vtkGetSurfaceCellFaces(self->Types[cellId]);
+          vtkIdType npts;
+          const vtkIdType* pts;
+          self->Grid->GetCellPoints(cellId, npts, pts, cellPts);
+          for (int i = 0; i < cellFaces->NumberOfFaces; ++i)
+          {
+            const int* face = cellFaces->Faces[i];
+            vtkIdType smallest = pts[face[1]];
+            for (int j = 2; j <= face[0]; ++j)
+            {
+              smallest = std::min(smallest, pts[face[j]]);
+            }
+            faces[smallest / self->PartitionSize].push_back(8 * cellId + i);
+          }
+        }
+      }
+    }
+  };
+
+  // Hash the faces of each partition of points, in the order of their cells.
+  struct HashFaces
+  {
+    vtkExternalFaces* Self;
+
+    struct Entry
+    {
+      vtkIdType CellFace;
+      vtkIdType Next;
+      vtkIdType Points[6];
+      int NumberOfPoints;
+      bool Hidden;
+    };
+
+    void operator()(vtkIdType begin, vtkIdType end)
+    {
+      vtkExternalFaces* self = this->Self;
+      vtkNew<vtkIdList> cellPts;
+      for (vtkIdType partition = begin; partition < end; ++partition)
+      {
+        vtkIdType firstPoint = partition * self->PartitionSize;
+        vtkIdType numBins = std::min(self->PartitionSize,
+          self->NumberOfPoints - firstPoint);
+        if (numBins <= 0)
+        {
+          continue;
+        }
+        std::vector<vtkIdType> bins(numBins, -1);
+        // Most faces are shared by two cells.
+        size_t numFaces = 0;
+        for (vtkIdType range = 0; range < self->NumberOfRanges; ++range)
+        {
+          numFaces +=
+            self->Faces[range * self->NumberOfPartitions + partition].size();
+        }
+        std::vector<Entry> entries;
+        entries.reserve(numFaces / 2 + numFaces / 8);
+        Entry entry;
+        for (vtkIdType range = 0; range < self->NumberOfRanges; ++range)
+        {
+          for (vtkIdType cellFace :
+               self->Faces[range * self->NumberOfPartitions + partition])
+          {
+            entry.NumberOfPoints =
+              self->GetFace(cellFace, entry.Points, cellPts);
+            vtkIdType* link = &bins[entry.Points[0] - firstPoint];
+            bool matched = false;
+            while (*link >= 0)
+            {
+              Entry& other = entries[*link];
+              if (vtkSameFace(entry.Points, entry.NumberOfPoints,
+                              other.Points, other.NumberOfPoints))
+              {
+                // Hide any face shared by two or more cells.
+                other.Hidden = true;
+                matched = true;
+                break;
+              }
+              link = &other.Next;
+            }
+            if (!matched)
+            {
+              *link = static_cast<vtkIdType>(entries.size());
+              entry.CellFace = cellFace;
+              entry.Next = -1;
+              entry.Hidden = false;
+              entries.push_back(entry);
+            }
+          }
+        }
+
+        // Keep the cell id, the number of points and the points of the
+        // faces that remain.
+        std::vector<vtkIdType>& external = self->ExternalFaces[partition];
+        for (vtkIdType bin = 0; bin < numBins; ++bin)
+        {
+          for (vtkIdType e = bins[bin]; e >= 0; e = entries[e].Next)
+          {
+            const Entry& face = entries[e];
+            if (!face.Hidden)
+            {
+              external.push_back(face.CellFace >> 3);
+              external.push_back(face.NumberOfPoints);
+              external.insert(external.end(), face.Points,
+                              face.Points + face.NumberOfPoints);
+            }
+          }
+        }
+      }
+    }
+  };
+
+  void Extract()
+  {
+    SortFaces sortFaces = { this };
+    vtkSMPTools::For(0, this->NumberOfRanges, 1, sortFaces);
+    HashFaces hashFaces = { this };
+    vtkSMPTools::For(0, this->NumberOfPartitions, 1, hashFaces);
+  }
+
+  // The external faces of each partition, in the order of the serial hash,
+  // each stored as its cell id, its number of points and its points.
+  const std::vector<std::vector<vtkIdType> >& GetExternalFaces() const
+  {
+    return this->ExternalFaces;
+  }
+
+private:
+  vtkUnstructuredGrid* Grid;
+  const unsigned char* Types;
+  vtkIdType NumberOfPoints;
+  vtkIdType NumberOfRanges;
+  vtkIdType NumberOfPartitions;
+  vtkIdType PartitionSize;
+  std::vector<std::vector<vtkIdType> > Faces;
+  std::vector<std::vector<vtkIdType> > ExternalFaces;
+};
+
+}
+
 //----------------------------------------------------------------------------
 int vtkDataSetSurfaceFilter::UnstructuredGridExecute(vtkDataSet *dataSetInput,
                                                      vtkPolyData *output)
@@ -1544,6 +1924,10 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecute(vtkDataSet *dataSetInput,
     cellIter = vtkSmartPointer<vtkCellIterator>::Take(input->NewCellIterator());
   }
 
+  // The faces of grids made only of linear 3D cells are hashed in parallel.
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input);
+  const bool threaded = grid && vtkExternalFaces::CanExtract(grid);
+
   vtkUnsignedCharArray* ghosts = input->GetPointGhostArray();
   vtkCellArray *newVerts;
   vtkCellArray *newLines;
@@ -1635,7 +2019,7 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecute(vtkDataSet *dataSetInput,
   }
 
   // First insert all points.  Points have to come first in poly data.
-  for (cellIter->InitTraversal(); !cellIter->IsDoneWithTraversal();
+  for (cellIter->InitTraversal(); !threaded && !cellIter->IsDoneWithTraversal();
        cellIter->GoToNextCell())
   {
     cellType = cellIter->GetCellType();
@@ -1668,7 +2052,8 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecute(vtkDataSet *dataSetInput,
 
   // First insert all points lines in output and 3D geometry in hash.
   // Save 2D geometry for second pass.
-  for(cellIter->InitTraversal(); !cellIter->IsDoneWithTraversal() && !abort;
+  for(cellIter->InitTraversal();
+      !threaded && !cellIter->IsDoneWithTraversal() && !abort;
       cellIter->GoToNextCell())
   {
     vtkIdType cellId = cellIter->GetCellId();
@@ -2140,6 +2525,45 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecute(vtkDataSet *dataSetInput,
   } // for all cells.
 
 
+  // Without vertices, lines or 2D cells, the faces used by a single cell are
+  // all of the output. They come in the order of the hash below.
+  if (threaded)
+  {
+    vtkExternalFaces externalFaces(grid);
+    externalFaces.Extract();
+    this->UpdateProgress(0.8);
+    vtkIdType ptIds[6];
+    for (const std::vector<vtkIdType>& faces : externalFaces.GetExternalFaces())
+    {
+      for (size_t pos = 0; pos < faces.size(); pos += 2 + faces[pos + 1])
+      {
+        const vtkIdType* facePts = &faces[pos];
+        vtkIdType cellId = facePts[0];
+        numFacePts = static_cast<int>(facePts[1]);
+        bool oneHidden = false;
+        for (i = 0; i < numFacePts; i++)
+        {
+          if (ghosts)
+          {
+            unsigned char val = ghosts->GetValue(facePts[2 + i]);
+            if (val & vtkDataSetAttributes::HIDDENPOINT)
+            {
+              oneHidden = true;
+            }
+          }
+          ptIds[i] = this->GetOutputPointId(facePts[2 + i], input, newPts, outputPD);
+        }
+        if (oneHidden)
+        {
+          continue;
+        }
+        newPolys->InsertNextCell(numFacePts, ptIds);
+        this->RecordOrigCellId(this->NumberOfNewCells, cellId);
+        outputCD->CopyData(inputCD, cellId, this->NumberOfNewCells++);
+      }
+    }
+  }
+
   // Now transfer geometry from hash to output (only triangles and quads).
   this->InitQuadHashTraversal();
   while ( (q = this->GetNextVisibleQuadFromHash()) )
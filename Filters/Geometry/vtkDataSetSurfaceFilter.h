@@ -21,6 +21,10 @@
  * vtkGeometryFilter.  It only has one option: whether to use triangle strips
  * when the input type is structured.
  *
+ * The external faces of unstructured grids made only of linear 3D cells are
+ * hashed in parallel with vtkSMPTools; the output is the same as the one of
+ * the serial hash.
+ *
  * @sa
  * vtkGeometryFilter vtkStructuredGridGeometryFilter.
 */
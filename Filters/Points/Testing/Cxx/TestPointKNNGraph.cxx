@@ -0,0 +1,301 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestPointKNNGraph.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check the neighborhood graph of vtkPointKNNGraph against the locator
+// queries, and that the point cloud filters give the same results with the
+// graph as with their locator.
+
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkFloatArray.h"
+#include "vtkGaussianKernel.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPCANormalEstimation.h"
+#include "vtkPointData.h"
+#include "vtkPointInterpolator.h"
+#include "vtkPointKNNGraph.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRadiusOutlierRemoval.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
+#include "vtkStringArray.h"
+#include "vtkStatisticalOutlierRemoval.h"
+
+#include <cmath>
+
+namespace
+{
+
+// A locator counting how many times it is built.
+class CountingLocator : public vtkStaticPointLocator
+{
+public:
+  static CountingLocator* New();
+  vtkTypeMacro(CountingLocator, vtkStaticPointLocator);
+
+  void BuildLocator() override
+  {
+    ++this->NumberOfBuilds;
+    this->Superclass::BuildLocator();
+  }
+
+  int NumberOfBuilds = 0;
+};
+vtkStandardNewMacro(CountingLocator);
+
+// Noisy points on the unit sphere, with some outliers, and a scalar field.
+vtkSmartPointer<vtkPolyData> MakeCloud(vtkIdType numPts)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  points->SetNumberOfPoints(numPts);
+  scalars->SetNumberOfTuples(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double x[3] = { vtkMath::Gaussian(), vtkMath::Gaussian(),
+                    vtkMath::Gaussian() };
+    double r = (i % 50 == 0 ? vtkMath::Random(0.5, 1.5)
+                            : vtkMath::Random(0.99, 1.01)) / vtkMath::Norm(x);
+    points->SetPoint(i, r * x[0], r * x[1], r * x[2]);
+    scalars->SetValue(i, static_cast<float>(sin(3.0 * x[0] * r) + x[2] * r));
+  }
+  vtkSmartPointer<vtkPolyData> cloud = vtkSmartPointer<vtkPolyData>::New();
+  cloud->SetPoints(points);
+  cloud->GetPointData()->SetScalars(scalars);
+  vtkNew<vtkStringArray> label;
+  label->SetName("Label");
+  label->InsertNextValue("cloud");
+  cloud->GetFieldData()->AddArray(label);
+  return cloud;
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b, double tol)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfValues(); ++i)
+  {
+    if (std::abs(a->GetVariantValue(i).ToDouble() -
+                 b->GetVariantValue(i).ToDouble()) > tol)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The graph computed with threads is the one found by the locator queries.
+bool TestGraph(vtkPolyData* cloud, int numNei, double radius)
+{
+  vtkNew<vtkPointKNNGraph> graph;
+  graph->SetInputData(cloud);
+  graph->SetNumberOfNeighbors(numNei);
+  graph->SetRadius(radius);
+  if (numNei == 0)
+  {
+    graph->SetNeighborhoodToRadius();
+  }
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() { graph->Update(); });
+
+  vtkPointSet* output = graph->GetOutput();
+  if (!output->GetFieldData()->GetAbstractArray("Label"))
+  {
+    cerr << "The field data of the input is not passed" << endl;
+    return false;
+  }
+  const vtkIdType *offsets, *neighbors;
+  if (!vtkPointKNNGraph::GetGraph(output, numNei, radius, offsets, neighbors) ||
+      vtkPointKNNGraph::GetGraph(output, numNei + 1, 2.0 * radius, offsets,
+                                 neighbors))
+  {
+    cerr << "The graph does not answer the right queries" << endl;
+    return false;
+  }
+
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(cloud);
+  locator->BuildLocator();
+  vtkNew<vtkIdList> ids;
+  for (vtkIdType ptId = 0; ptId < cloud->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    cloud->GetPoint(ptId, x);
+    if (numNei > 0)
+    {
+      locator->FindClosestNPoints(numNei, x, ids);
+    }
+    else
+    {
+      locator->FindPointsWithinRadius(radius, x, ids);
+    }
+    bool same = offsets[ptId + 1] - offsets[ptId] == ids->GetNumberOfIds();
+    for (vtkIdType i = 0; same && i < ids->GetNumberOfIds(); ++i)
+    {
+      same = neighbors[offsets[ptId] + i] == ids->GetId(i);
+    }
+    if (!same)
+    {
+      cerr << "Wrong neighbors of point " << ptId << endl;
+      return false;
+    }
+  }
+
+  // The graph is stale once the points are modified
+  vtkNew<vtkPolyData> copy;
+  copy->ShallowCopy(output);
+  copy->GetPoints()->Modified();
+  if (vtkPointKNNGraph::GetGraph(copy, numNei, radius, offsets, neighbors))
+  {
+    cerr << "The graph of modified points is used" << endl;
+    return false;
+  }
+  return true;
+}
+
+// The results of the filters which use the neighborhoods of the points.
+struct FilterResults
+{
+  vtkSmartPointer<vtkDataArray> Arrays[4];
+  vtkIdType Removed[2];
+  double Mean;
+  int InterpolatorBuilds;
+};
+
+void RunFilters(vtkPolyData* input, vtkPolyData* radiusInput,
+                FilterResults& results)
+{
+  vtkNew<vtkPCANormalEstimation> normals;
+  normals->SetInputData(input);
+  normals->SetSampleSize(20);
+  normals->SetNormalOrientationToGraphTraversal();
+  normals->Update();
+  results.Arrays[0] = normals->GetOutput()->GetPointData()->GetNormals();
+
+  vtkNew<vtkStatisticalOutlierRemoval> statistical;
+  statistical->SetInputData(input);
+  statistical->SetSampleSize(20);
+  statistical->Update();
+  results.Arrays[1] = statistical->GetOutput()->GetPointData()->GetScalars();
+  results.Removed[0] = statistical->GetNumberOfPointsRemoved();
+  results.Mean = statistical->GetComputedMean();
+
+  vtkNew<CountingLocator> closestLocator;
+  vtkNew<vtkPointInterpolator> closestInterpolator;
+  closestInterpolator->SetLocator(closestLocator);
+  vtkNew<vtkGaussianKernel> closestKernel;
+  closestKernel->SetKernelFootprintToNClosest();
+  closestKernel->SetNumberOfPoints(10);
+  closestKernel->SetSharpness(4.0);
+  closestInterpolator->SetKernel(closestKernel);
+  closestInterpolator->SetInputData(input);
+  closestInterpolator->SetSourceData(input);
+  closestInterpolator->Update();
+  results.Arrays[2] =
+    closestInterpolator->GetOutput()->GetPointData()->GetScalars();
+
+  vtkNew<vtkRadiusOutlierRemoval> radius;
+  radius->SetInputData(radiusInput);
+  radius->SetRadius(0.1);
+  radius->SetNumberOfNeighbors(10);
+  radius->Update();
+  results.Removed[1] = radius->GetNumberOfPointsRemoved();
+
+  vtkNew<CountingLocator> radiusLocator;
+  vtkNew<vtkPointInterpolator> radiusInterpolator;
+  radiusInterpolator->SetLocator(radiusLocator);
+  vtkNew<vtkGaussianKernel> radiusKernel;
+  radiusKernel->SetRadius(0.1);
+  radiusKernel->SetSharpness(4.0);
+  radiusInterpolator->SetKernel(radiusKernel);
+  radiusInterpolator->SetInputData(radiusInput);
+  radiusInterpolator->SetSourceData(radiusInput);
+  radiusInterpolator->Update();
+  results.Arrays[3] =
+    radiusInterpolator->GetOutput()->GetPointData()->GetScalars();
+  results.InterpolatorBuilds =
+    closestLocator->NumberOfBuilds + radiusLocator->NumberOfBuilds;
+}
+
+// The filters give the same results on the graph as with their locator.
+bool TestFilters(vtkPolyData* cloud)
+{
+  vtkNew<vtkPointKNNGraph> closest;
+  closest->SetInputData(cloud);
+  closest->SetNumberOfNeighbors(25);
+  closest->Update();
+  vtkNew<vtkPointKNNGraph> within;
+  within->SetInputData(cloud);
+  within->SetNeighborhoodToRadius();
+  within->SetRadius(0.15);
+  within->Update();
+
+  FilterResults expected, results;
+  RunFilters(cloud, cloud, expected);
+  RunFilters(closest->GetPolyDataOutput(), within->GetPolyDataOutput(),
+             results);
+  if (expected.Removed[0] == 0 || expected.Removed[1] == 0)
+  {
+    cerr << "No outlier removed" << endl;
+    return false;
+  }
+  if (expected.InterpolatorBuilds == 0 || results.InterpolatorBuilds != 0)
+  {
+    cerr << "The interpolators build their locator with the graph" << endl;
+    return false;
+  }
+
+  const char* names[4] = { "normals", "statistical outlier removal",
+                           "N closest interpolation", "radius interpolation" };
+  for (int i = 0; i < 4; ++i)
+  {
+    if (!SameArrays(expected.Arrays[i], results.Arrays[i], 1.0e-6))
+    {
+      cerr << "Different " << names[i] << " with the graph" << endl;
+      return false;
+    }
+  }
+  if (expected.Removed[0] != results.Removed[0] ||
+      expected.Removed[1] != results.Removed[1] ||
+      std::abs(expected.Mean - results.Mean) > 1.0e-9)
+  {
+    cerr << "Different outliers removed with the graph" << endl;
+    return false;
+  }
+  return true;
+}
+
+}
+
+int TestPointKNNGraph(int, char*[])
+{
+  vtkMath::RandomSeed(8765);
+  vtkSmartPointer<vtkPolyData> cloud = MakeCloud(20000);
+
+  if (!TestGraph(cloud, 25, 0.0) || !TestGraph(cloud, 0, 0.1) ||
+      !TestFilters(cloud))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -17,6 +17,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkAbstractPointLocator.h"
 #include "vtkStaticPointLocator.h"
+#include "vtkPointKNNGraph.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkPointData.h"
@@ -41,6 +42,8 @@ struct GenerateNormals
 {
   const T *Points;
   vtkAbstractPointLocator *Locator;
+  const vtkIdType *Offsets; //neighborhood graph, if any
+  const vtkIdType *Neighbors;
   int SampleSize;
   float *Normals;
   int Orient;
@@ -51,10 +54,12 @@ struct GenerateNormals
   // storage lots of new/delete.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
 
-  GenerateNormals(T *points, vtkAbstractPointLocator *loc, int sample, float *normals,
-                  int orient, double opoint[3], bool flip) :
-    Points(points), Locator(loc), SampleSize(sample), Normals(normals),
-    Orient(orient), Flip(flip)
+  GenerateNormals(T *points, vtkAbstractPointLocator *loc,
+                  const vtkIdType *offsets, const vtkIdType *neighbors,
+                  int sample, float *normals, int orient, double opoint[3],
+                  bool flip) :
+    Points(points), Locator(loc), Offsets(offsets), Neighbors(neighbors),
+    SampleSize(sample), Normals(normals), Orient(orient), Flip(flip)
   {
       this->OPoint[0] = opoint[0];
       this->OPoint[1] = opoint[1];
@@ -75,6 +80,7 @@ struct GenerateNormals
       float *n = this->Normals + 3*ptId;
       double x[3], mean[3], o[3];
       vtkIdList*& pIds = this->PIds.Local();
+      const vtkIdType *ids;
       vtkIdType numPts, nei;
       int sample, i;
       double *a[3], a0[3], a1[3], a2[3], xp[3];
@@ -90,15 +96,26 @@ struct GenerateNormals
         x[1] = static_cast<double>(*px++);
         x[2] = static_cast<double>(*px++);
 
-        // Retrieve the local neighborhood
-        this->Locator->FindClosestNPoints(this->SampleSize, x, pIds);
-        numPts = pIds->GetNumberOfIds();
+        // Retrieve the local neighborhood: the closest points are the
+        // first neighbors in the graph.
+        if ( this->Offsets )
+        {
+          ids = this->Neighbors + this->Offsets[ptId];
+          numPts = this->Offsets[ptId+1] - this->Offsets[ptId];
+          numPts = ( numPts > this->SampleSize ? this->SampleSize : numPts );
+        }
+        else
+        {
+          this->Locator->FindClosestNPoints(this->SampleSize, x, pIds);
+          ids = pIds->GetPointer(0);
+          numPts = pIds->GetNumberOfIds();
+        }
 
         // First step: compute the mean position of the neighborhood.
         mean[0] = mean[1] = mean[2] = 0.0;
         for (sample=0; sample<numPts; ++sample)
         {
-          nei = pIds->GetId(sample);
+          nei = ids[sample];
           py = this->Points + 3*nei;
           mean[0] += static_cast<double>(*py++);
           mean[1] += static_cast<double>(*py++);
@@ -114,7 +131,7 @@ struct GenerateNormals
         a0[2] = a1[2] = a2[2] = 0.0;
         for (sample=0; sample < numPts; ++sample )
         {
-          nei = pIds->GetId(sample);
+          nei = ids[sample];
           py = this->Points + 3*nei;
           xp[0] = static_cast<double>(*py++) - mean[0];
           xp[1] = static_cast<double>(*py++) - mean[1];
@@ -166,10 +183,11 @@ struct GenerateNormals
   }
 
   static void Execute(vtkPCANormalEstimation *self, vtkIdType numPts, T *points,
+                      const vtkIdType *offsets, const vtkIdType *neighbors,
                       float *normals, int orient, double opoint[3], bool flip)
   {
-      GenerateNormals gen(points, self->GetLocator(), self->GetSampleSize(),
-                          normals, orient, opoint, flip);
+      GenerateNormals gen(points, self->GetLocator(), offsets, neighbors,
+                          self->GetSampleSize(), normals, orient, opoint, flip);
       vtkSMPTools::For(0, numPts, gen);
   }
 }; //GenerateNormals
@@ -225,14 +243,20 @@ int vtkPCANormalEstimation::RequestData(
     return 1;
   }
 
-  // Start by building the locator.
-  if ( !this->Locator )
+  // Use the neighborhood graph of the input if it holds the closest points;
+  // otherwise start by building the locator.
+  const vtkIdType *offsets = nullptr, *neighbors = nullptr;
+  if ( !vtkPointKNNGraph::GetGraph(input, this->SampleSize, 0.0,
+                                   offsets, neighbors) )
   {
-    vtkErrorMacro(<<"Point locator required\n");
-    return 0;
+    if ( !this->Locator )
+    {
+      vtkErrorMacro(<<"Point locator required\n");
+      return 0;
+    }
+    this->Locator->SetDataSet(input);
+    this->Locator->BuildLocator();
   }
-  this->Locator->SetDataSet(input);
-  this->Locator->BuildLocator();
 
   // Generate the point normals.
   vtkFloatArray *normals = vtkFloatArray::New();
@@ -244,8 +268,9 @@ int vtkPCANormalEstimation::RequestData(
   void *inPtr = input->GetPoints()->GetVoidPointer(0);
   switch (input->GetPoints()->GetDataType())
   {
-    vtkTemplateMacro(GenerateNormals<VTK_TT>::Execute(this, numPts, (VTK_TT *)inPtr, n,
-       this->NormalOrientation, this->OrientationPoint, this->FlipNormals));
+    vtkTemplateMacro(GenerateNormals<VTK_TT>::Execute(this, numPts, (VTK_TT *)inPtr,
+       offsets, neighbors, n, this->NormalOrientation, this->OrientationPoint,
+       this->FlipNormals));
   }
 
   // Orient the normals in a consistent fashion (if requested). This requires a traversal
@@ -266,7 +291,8 @@ int vtkPCANormalEstimation::RequestData(
       {
         wave->InsertNextId(ptId); //begin next connected wave
         pointMap[ptId] = 1;
-        this->TraverseAndFlip (input->GetPoints(), n, pointMap, wave, wave2);
+        this->TraverseAndFlip (input->GetPoints(), n, pointMap, wave, wave2,
+                               offsets, neighbors);
         wave->Reset();
         wave2->Reset();
       }
@@ -291,12 +317,14 @@ int vtkPCANormalEstimation::RequestData(
 //
 void vtkPCANormalEstimation::
 TraverseAndFlip (vtkPoints *inPts, float *normals, char *pointMap,
-                 vtkIdList *wave, vtkIdList *wave2)
+                 vtkIdList *wave, vtkIdList *wave2, const vtkIdType *offsets,
+                 const vtkIdType *neighbors)
 {
   vtkIdType i, j, numPts, numIds, ptId;
   vtkIdList *tmpWave;
   double x[3];
   float *n, *n2;
+  const vtkIdType *ids;
   vtkIdList *neighborPointIds = vtkIdList::New();
 
   while ( (numIds=wave->GetNumberOfIds()) > 0 )
@@ -304,14 +332,24 @@ TraverseAndFlip (vtkPoints *inPts, float *normals, char *pointMap,
     for ( i=0; i < numIds; i++ ) //for all points in this wave
     {
       ptId = wave->GetId(i);
-      inPts->GetPoint(ptId,x);
       n = normals + 3*ptId;
-      this->Locator->FindClosestNPoints(this->SampleSize,x,neighborPointIds);
+      if ( offsets )
+      {
+        ids = neighbors + offsets[ptId];
+        numPts = offsets[ptId+1] - offsets[ptId];
+        numPts = ( numPts > this->SampleSize ? this->SampleSize : numPts );
+      }
+      else
+      {
+        inPts->GetPoint(ptId,x);
+        this->Locator->FindClosestNPoints(this->SampleSize,x,neighborPointIds);
+        ids = neighborPointIds->GetPointer(0);
+        numPts = neighborPointIds->GetNumberOfIds();
+      }
 
-      numPts = neighborPointIds->GetNumberOfIds();
       for (j=0; j < numPts; ++j)
       {
-        ptId = neighborPointIds->GetId(j);
+        ptId = ids[j];
         if ( pointMap[ptId] == 0 )
         {
           pointMap[ptId] = 1;
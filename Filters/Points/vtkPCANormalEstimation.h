@@ -36,6 +36,11 @@
  * 3) perform a traversal of the point cloud and flip neighboring normals so
  * that they are mutually consistent.
  *
+ * If the input carries the neighborhood graph of at least the SampleSize
+ * closest points of each point (as computed by vtkPointKNNGraph), the
+ * neighborhoods are taken from the graph instead of being searched with
+ * the locator.
+ *
  * The output of this filter is the same as the input except that a normal
  * per point is produced. (Note that these are unit normals.) While any
  * vtkPointSet type can be provided as input, the output is represented by an
@@ -49,7 +54,7 @@
  * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
  *
  * @sa
- * vtkPCACurvatureEstimation
+ * vtkPCACurvatureEstimation vtkPointKNNGraph
 */
 
 #ifndef vtkPCANormalEstimation_h
@@ -160,9 +165,12 @@ protected:
   double OrientationPoint[3];
   bool FlipNormals;
 
-  // Methods used to produce consistent normal orientations
+  // Methods used to produce consistent normal orientations. The neighbors
+  // are taken from the neighborhood graph (offsets, neighbors) if provided.
   void TraverseAndFlip (vtkPoints *inPts, float *normals, char *pointMap,
-                        vtkIdList *wave, vtkIdList *wave2);
+                        vtkIdList *wave, vtkIdList *wave2,
+                        const vtkIdType *offsets=nullptr,
+                        const vtkIdType *neighbors=nullptr);
 
   // Pipeline management
   int RequestData(vtkInformation *, vtkInformationVector **,
@@ -16,6 +16,9 @@
 
 #include "vtkObjectFactory.h"
 #include "vtkLinearKernel.h"
+#include "vtkGeneralizedKernel.h"
+#include "vtkPointKNNGraph.h"
+#include "vtkPointSet.h"
 #include "vtkAbstractPointLocator.h"
 #include "vtkArrayListTemplate.h"
 #include "vtkStaticPointLocator.h"
@@ -36,6 +39,7 @@
 #include "vtkSMPTools.h"
 #include "vtkSMPThreadLocalObject.h"
 
+#include <algorithm>
 #include <vector>
 
 vtkStandardNewMacro(vtkPointInterpolator);
@@ -59,6 +63,13 @@ struct ProbePoints
   int Strategy;
   bool Promote;
 
+  // The neighborhood graph of the input points, if any, with the number of
+  // closest points (or the squared radius) of the kernel footprint
+  const vtkIdType *Offsets;
+  const vtkIdType *Neighbors;
+  int NumNeighbors;
+  double Radius2;
+
   // Don't want to allocate these working arrays on every thread invocation,
   // so make them thread local.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
@@ -66,7 +77,8 @@ struct ProbePoints
 
   ProbePoints(vtkPointInterpolator *ptInt, vtkDataSet *input, vtkPointData *inPD,
               vtkPointData *outPD, char *valid) :
-    PointInterpolator(ptInt), Input(input), InPD(inPD), OutPD(outPD), Valid(valid)
+    PointInterpolator(ptInt), Input(input), InPD(inPD), OutPD(outPD), Valid(valid),
+    Offsets(nullptr), Neighbors(nullptr), NumNeighbors(0), Radius2(0.0)
   {
       // Gather information from the interpolator
       this->Kernel = ptInt->GetKernel();
@@ -98,6 +110,40 @@ struct ProbePoints
     weights->Allocate(128);
   }
 
+  // Find the points close to the input point ptId: with the kernel, or in
+  // the neighborhood graph (keeping the N closest points, or those within
+  // the radius).
+  vtkIdType ComputeBasis(double x[3], vtkIdList *pIds, vtkIdType ptId)
+  {
+      if ( !this->Offsets )
+      {
+        return this->Kernel->ComputeBasis(x, pIds);
+      }
+
+      const vtkIdType *nei = this->Neighbors + this->Offsets[ptId];
+      vtkIdType numIds = this->Offsets[ptId+1] - this->Offsets[ptId];
+      if ( this->NumNeighbors > 0 )
+      {
+        numIds = ( numIds > this->NumNeighbors ? this->NumNeighbors : numIds );
+        pIds->SetNumberOfIds(numIds);
+        std::copy(nei, nei+numIds, pIds->GetPointer(0));
+      }
+      else
+      {
+        double y[3];
+        pIds->Reset();
+        for ( vtkIdType i=0; i < numIds; ++i )
+        {
+          this->Input->GetPoint(nei[i], y);
+          if ( vtkMath::Distance2BetweenPoints(x,y) <= this->Radius2 )
+          {
+            pIds->InsertNextId(nei[i]);
+          }
+        }
+      }
+      return pIds->GetNumberOfIds();
+  }
+
   // When null point is encountered
   void AssignNullPoint(const double x[3], vtkIdList *pIds,
                        vtkDoubleArray *weights, vtkIdType ptId)
@@ -113,8 +159,11 @@ struct ProbePoints
       }
       else //vtkPointInterpolator::CLOSEST_POINT:
       {
+        // With the neighborhood graph, the input points are the source
+        // points (and the locator is not built).
         pIds->SetNumberOfIds(1);
-        vtkIdType pId = this->Locator->FindClosestPoint(x);
+        vtkIdType pId = ( this->Offsets ? ptId :
+                          this->Locator->FindClosestPoint(x) );
         pIds->SetId(0,pId);
         weights->SetNumberOfTuples(1);
         weights->SetValue(0,1.0);
@@ -135,7 +184,7 @@ struct ProbePoints
       {
         this->Input->GetPoint(ptId,x);
 
-        if ( this->Kernel->ComputeBasis(x, pIds) > 0 )
+        if ( this->ComputeBasis(x, pIds, ptId) > 0 )
         {
           numWeights = this->Kernel->ComputeWeights(x, pIds, weights);
           this->Arrays.Interpolate(numWeights, pIds->GetPointer(0),
@@ -295,14 +344,42 @@ Probe(vtkDataSet *input, vtkDataSet *source, vtkDataSet *output)
     return;
   }
 
-  // Start by building the locator
-  if ( !this->Locator )
+  // When the input points are the source points, the neighborhood graph of
+  // the source, if any, gives the footprint of the generalized kernels.
+  vtkImageData *imgInput = vtkImageData::SafeDownCast(input);
+  const vtkIdType *offsets = nullptr, *neighbors = nullptr;
+  int numNeighbors = 0;
+  double radius2 = 0.0;
+  vtkGeneralizedKernel *kernel =
+    vtkGeneralizedKernel::SafeDownCast(this->Kernel);
+  vtkPointSet *psInput = vtkPointSet::SafeDownCast(input);
+  vtkPointSet *psSource = vtkPointSet::SafeDownCast(source);
+  if ( !imgInput && kernel && psInput && psSource &&
+       psInput->GetPoints() == psSource->GetPoints() )
   {
-    vtkErrorMacro(<<"Point locator required\n");
-    return;
+    numNeighbors =
+      ( kernel->GetKernelFootprint() == vtkGeneralizedKernel::N_CLOSEST ?
+        kernel->GetNumberOfPoints() : 0 );
+    radius2 = kernel->GetRadius() * kernel->GetRadius();
+    if ( !vtkPointKNNGraph::GetGraph(psSource, numNeighbors,
+                                     kernel->GetRadius(), offsets,
+                                     neighbors) )
+    {
+      offsets = neighbors = nullptr;
+    }
+  }
+
+  // Otherwise start by building the locator
+  if ( !offsets )
+  {
+    if ( !this->Locator )
+    {
+      vtkErrorMacro(<<"Point locator required\n");
+      return;
+    }
+    this->Locator->SetDataSet(source);
+    this->Locator->BuildLocator();
   }
-  this->Locator->SetDataSet(source);
-  this->Locator->BuildLocator();
 
   // Set up the interpolation process
   vtkIdType numPts = input->GetNumberOfPoints();
@@ -327,7 +404,6 @@ Probe(vtkDataSet *input, vtkDataSet *source, vtkDataSet *output)
   }
 
   // If the input is image data then there is a faster path
-  vtkImageData *imgInput = vtkImageData::SafeDownCast(input);
   if ( imgInput )
   {
     int dims[3];
@@ -340,6 +416,10 @@ Probe(vtkDataSet *input, vtkDataSet *source, vtkDataSet *output)
   else
   {
     ProbePoints probe(this, input, inPD, outPD, mask);
+    probe.Offsets = offsets;
+    probe.Neighbors = neighbors;
+    probe.NumNeighbors = numNeighbors;
+    probe.Radius2 = radius2;
     vtkSMPTools::For(0, numPts, probe);
   }
 
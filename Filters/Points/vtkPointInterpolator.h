@@ -41,7 +41,11 @@
  * the algorithm. (By default, a vtkStaticPointLocator is used because
  * generally it is much faster to build, delete, and search with. However,
  * with highly non-uniform point distributions, octree- or kd-tree based
- * locators may perform better.)
+ * locators may perform better.) When the input and the source share the
+ * same points, the kernel is a vtkGeneralizedKernel, and the source carries
+ * the neighborhood graph computed by vtkPointKNNGraph for a footprint at
+ * least as large as the kernel's, the close points are taken from the graph
+ * instead of being searched.
  *
  * @warning
  * This class has been threaded with vtkSMPTools. Using TBB or other
@@ -59,7 +63,7 @@
  * @sa
  * vtkPointInterpolator2D vtkProbeFilter vtkGaussianSplatter
  * vtkCheckerboardSplatter vtkShepardMethod vtkVoronoiKernel vtkShepardKernel
- * vtkGaussianKernel vtkSPHKernel
+ * vtkGaussianKernel vtkSPHKernel vtkPointKNNGraph
 */
 
 #ifndef vtkPointInterpolator_h
@@ -0,0 +1,362 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPointKNNGraph.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See LICENSE file for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPointKNNGraph.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkAbstractPointLocator.h"
+#include "vtkStaticPointLocator.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPointData.h"
+#include "vtkCellData.h"
+#include "vtkFieldData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationDoubleKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationObjectBaseKey.h"
+#include "vtkInformationVector.h"
+#include "vtkMath.h"
+#include "vtkSMPTools.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+vtkStandardNewMacro(vtkPointKNNGraph);
+vtkCxxSetObjectMacro(vtkPointKNNGraph,Locator,vtkAbstractPointLocator);
+
+vtkInformationKeyMacro(vtkPointKNNGraph,NUMBER_OF_NEIGHBORS,Integer);
+vtkInformationKeyMacro(vtkPointKNNGraph,RADIUS_OF_NEIGHBORHOOD,Double);
+vtkInformationKeyMacro(vtkPointKNNGraph,POINTS,ObjectBase);
+
+//----------------------------------------------------------------------------
+// Helper classes to support efficient computing, and threaded execution.
+namespace {
+
+const char *OffsetsArrayName = "vtkPointKNNGraphOffsets";
+const char *NeighborsArrayName = "vtkPointKNNGraphNeighbors";
+
+//----------------------------------------------------------------------------
+// Find the neighbors of a range of points. The neighbors found by each
+// thread are appended to a thread local buffer, and the buffer and the
+// location in it of the neighbors of each point are recorded so that they
+// can be gathered in order afterwards. The N closest points are sorted by
+// distance (the locators usually return them sorted already).
+template <typename T>
+struct FindNeighbors
+{
+  const T *Points;
+  vtkAbstractPointLocator *Locator;
+  int NumNeighbors;
+  double Radius;
+  vtkIdType *Counts;
+  const std::vector<vtkIdType> **Buffers;
+  vtkIdType *Starts;
+
+  // Don't want to allocate working arrays on every thread invocation. Thread local
+  // storage lots of new/delete.
+  vtkSMPThreadLocalObject<vtkIdList> PIds;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> Buffer;
+  vtkSMPThreadLocal<std::vector<std::pair<double,vtkIdType>>> Sorted;
+
+  FindNeighbors(const T *points, vtkAbstractPointLocator *loc, int numNei,
+                double radius, vtkIdType *counts,
+                const std::vector<vtkIdType> **buffers, vtkIdType *starts) :
+    Points(points), Locator(loc), NumNeighbors(numNei), Radius(radius),
+    Counts(counts), Buffers(buffers), Starts(starts)
+  {
+  }
+
+  // Just allocate a little bit of memory to get started.
+  void Initialize()
+  {
+    vtkIdList*& pIds = this->PIds.Local();
+    pIds->Allocate(128); //allocate some memory
+  }
+
+  void operator() (vtkIdType ptId, vtkIdType endPtId)
+  {
+      const T *px = this->Points + 3*ptId;
+      const T *py;
+      double x[3], y[3];
+      vtkIdList*& pIds = this->PIds.Local();
+      std::vector<vtkIdType> &buffer = this->Buffer.Local();
+      std::vector<std::pair<double,vtkIdType>> &sorted = this->Sorted.Local();
+
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        x[0] = static_cast<double>(*px++);
+        x[1] = static_cast<double>(*px++);
+        x[2] = static_cast<double>(*px++);
+
+        this->Buffers[ptId] = &buffer;
+        this->Starts[ptId] = static_cast<vtkIdType>(buffer.size());
+        if ( this->NumNeighbors > 0 )
+        {
+          this->Locator->FindClosestNPoints(this->NumNeighbors, x, pIds);
+          vtkIdType numIds = pIds->GetNumberOfIds();
+          sorted.resize(numIds);
+          for ( vtkIdType i=0; i < numIds; ++i )
+          {
+            py = this->Points + 3*pIds->GetId(i);
+            y[0] = static_cast<double>(py[0]);
+            y[1] = static_cast<double>(py[1]);
+            y[2] = static_cast<double>(py[2]);
+            sorted[i].first = vtkMath::Distance2BetweenPoints(x,y);
+            sorted[i].second = pIds->GetId(i);
+          }
+          std::stable_sort(sorted.begin(), sorted.end(),
+            [](const std::pair<double,vtkIdType> &a,
+               const std::pair<double,vtkIdType> &b)
+              { return a.first < b.first; });
+          for ( vtkIdType i=0; i < numIds; ++i )
+          {
+            buffer.push_back(sorted[i].second);
+          }
+          this->Counts[ptId] = numIds;
+        }
+        else
+        {
+          this->Locator->FindPointsWithinRadius(this->Radius, x, pIds);
+          vtkIdType numIds = pIds->GetNumberOfIds();
+          buffer.insert(buffer.end(), pIds->GetPointer(0),
+                        pIds->GetPointer(0) + numIds);
+          this->Counts[ptId] = numIds;
+        }
+      }
+  }
+
+  void Reduce()
+  {
+  }
+
+  // The neighbors found by the threads live in the thread local buffers of
+  // the functor, so they are gathered before it goes out of scope.
+  static vtkIdTypeArray* Execute(vtkPointKNNGraph *self, vtkIdType numPts,
+                                 T *points, int numNei, vtkIdType *offsets);
+}; //FindNeighbors
+
+//----------------------------------------------------------------------------
+// Copy the gathered neighbors of a range of points to their final place.
+struct GatherNeighbors
+{
+  const vtkIdType *Offsets;
+  const std::vector<vtkIdType> **Buffers;
+  const vtkIdType *Starts;
+  vtkIdType *Neighbors;
+
+  void operator() (vtkIdType ptId, vtkIdType endPtId)
+  {
+      for ( ; ptId < endPtId; ++ptId)
+      {
+        const vtkIdType *src = this->Buffers[ptId]->data() + this->Starts[ptId];
+        std::copy(src, src + (this->Offsets[ptId+1] - this->Offsets[ptId]),
+                  this->Neighbors + this->Offsets[ptId]);
+      }
+  }
+}; //GatherNeighbors
+
+//----------------------------------------------------------------------------
+template <typename T>
+vtkIdTypeArray* FindNeighbors<T>::Execute(vtkPointKNNGraph *self,
+                                          vtkIdType numPts, T *points,
+                                          int numNei, vtkIdType *offsets)
+{
+  std::vector<const std::vector<vtkIdType>*> buffers(numPts);
+  std::vector<vtkIdType> starts(numPts);
+  FindNeighbors find(points, self->GetLocator(), numNei,
+                     self->GetRadius(), offsets+1, buffers.data(),
+                     starts.data());
+  if ( self->GetLocator()->HasThreadSafeQueries() )
+  {
+    vtkSMPTools::For(0, numPts, find);
+  }
+  else
+  {
+    find.Initialize();
+    find(0, numPts);
+  }
+
+  offsets[0] = 0;
+  for ( vtkIdType ptId=0; ptId < numPts; ++ptId )
+  {
+    offsets[ptId+1] += offsets[ptId];
+  }
+  vtkIdTypeArray *neighbors = vtkIdTypeArray::New();
+  neighbors->SetNumberOfTuples(offsets[numPts]);
+  GatherNeighbors gather = { offsets, buffers.data(), starts.data(),
+                             neighbors->GetPointer(0) };
+  vtkSMPTools::For(0, numPts, gather);
+  return neighbors;
+}
+
+} //anonymous namespace
+
+//================= Begin class proper =======================================
+//----------------------------------------------------------------------------
+vtkPointKNNGraph::vtkPointKNNGraph()
+{
+  this->Neighborhood = vtkPointKNNGraph::N_CLOSEST;
+  this->NumberOfNeighbors = 25;
+  this->Radius = 1.0;
+  this->Locator = vtkStaticPointLocator::New();
+}
+
+//----------------------------------------------------------------------------
+vtkPointKNNGraph::~vtkPointKNNGraph()
+{
+  this->SetLocator(nullptr);
+}
+
+//----------------------------------------------------------------------------
+bool vtkPointKNNGraph::GetGraph(vtkPointSet *ps, int N, double radius,
+                                const vtkIdType *&offsets,
+                                const vtkIdType *&neighbors)
+{
+  if ( !ps || !ps->GetPoints() || !ps->GetFieldData() )
+  {
+    return false;
+  }
+  vtkIdTypeArray *offArray = vtkIdTypeArray::SafeDownCast(
+    ps->GetFieldData()->GetAbstractArray(OffsetsArrayName));
+  vtkIdTypeArray *neiArray = vtkIdTypeArray::SafeDownCast(
+    ps->GetFieldData()->GetAbstractArray(NeighborsArrayName));
+  if ( !offArray || !neiArray || !offArray->HasInformation() ||
+       offArray->GetNumberOfValues() != ps->GetNumberOfPoints()+1 )
+  {
+    return false;
+  }
+
+  // The graph must have been computed from these points, not modified since
+  vtkInformation *info = offArray->GetInformation();
+  if ( info->Get(vtkPointKNNGraph::POINTS()) != ps->GetPoints() ||
+       ps->GetPoints()->GetMTime() > offArray->GetMTime() )
+  {
+    return false;
+  }
+
+  // And answer the query
+  if ( N > 0 ? !info->Has(vtkPointKNNGraph::NUMBER_OF_NEIGHBORS()) ||
+               info->Get(vtkPointKNNGraph::NUMBER_OF_NEIGHBORS()) < N :
+               !info->Has(vtkPointKNNGraph::RADIUS_OF_NEIGHBORHOOD()) ||
+               info->Get(vtkPointKNNGraph::RADIUS_OF_NEIGHBORHOOD()) < radius )
+  {
+    return false;
+  }
+
+  offsets = offArray->GetPointer(0);
+  neighbors = neiArray->GetPointer(0);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Find the neighbors of all the points, and store them in the field data of
+// the output.
+int vtkPointKNNGraph::RequestData(
+  vtkInformation *vtkNotUsed(request),
+  vtkInformationVector **inputVector,
+  vtkInformationVector *outputVector)
+{
+  // get the info objects
+  vtkInformation *inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation *outInfo = outputVector->GetInformationObject(0);
+
+  // get the input and output
+  vtkPointSet *input = vtkPointSet::SafeDownCast(
+    inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkPointSet *output = vtkPointSet::SafeDownCast(
+    outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  // Check the input
+  if ( !input || !output )
+  {
+    return 1;
+  }
+  output->CopyStructure(input);
+  output->GetPointData()->PassData(input->GetPointData());
+  output->GetCellData()->PassData(input->GetCellData());
+  output->GetFieldData()->PassData(input->GetFieldData());
+  vtkIdType numPts = input->GetNumberOfPoints();
+  if ( numPts < 1 )
+  {
+    return 1;
+  }
+
+  // Start by building the locator.
+  if ( !this->Locator )
+  {
+    vtkErrorMacro(<<"Point locator required\n");
+    return 0;
+  }
+  this->Locator->SetDataSet(input);
+  this->Locator->BuildLocator();
+
+  // Find the neighbors of each point in parallel, then compute the offsets
+  // and gather the neighbors in point order.
+  int numNei = ( this->Neighborhood == vtkPointKNNGraph::N_CLOSEST ?
+                 this->NumberOfNeighbors : 0 );
+  vtkIdTypeArray *offsets = vtkIdTypeArray::New();
+  offsets->SetName(OffsetsArrayName);
+  offsets->SetNumberOfTuples(numPts+1);
+  vtkIdTypeArray *neighbors = nullptr;
+
+  void *inPtr = input->GetPoints()->GetVoidPointer(0);
+  switch (input->GetPoints()->GetDataType())
+  {
+    vtkTemplateMacro(neighbors = FindNeighbors<VTK_TT>::Execute(this, numPts,
+      (VTK_TT *)inPtr, numNei, offsets->GetPointer(0)));
+  }
+  if ( !neighbors )
+  {
+    offsets->Delete();
+    return 1;
+  }
+  neighbors->SetName(NeighborsArrayName);
+
+  // Record how, and from which points, the graph was computed
+  vtkInformation *info = offsets->GetInformation();
+  if ( numNei > 0 )
+  {
+    info->Set(vtkPointKNNGraph::NUMBER_OF_NEIGHBORS(), numNei);
+  }
+  else
+  {
+    info->Set(vtkPointKNNGraph::RADIUS_OF_NEIGHBORHOOD(), this->Radius);
+  }
+  info->Set(vtkPointKNNGraph::POINTS(), input->GetPoints());
+  offsets->Modified();
+
+  output->GetFieldData()->AddArray(offsets);
+  output->GetFieldData()->AddArray(neighbors);
+  offsets->Delete();
+  neighbors->Delete();
+
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkPointKNNGraph::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os,indent);
+
+  os << indent << "Neighborhood: " << this->Neighborhood << "\n";
+  os << indent << "Number Of Neighbors: " << this->NumberOfNeighbors << "\n";
+  os << indent << "Radius: " << this->Radius << "\n";
+  os << indent << "Locator: " << this->Locator << "\n";
+}
@@ -0,0 +1,171 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkPointKNNGraph.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See LICENSE file for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPointKNNGraph
+ * @brief   compute the neighborhood graph of a point cloud once
+ *
+ *
+ * vtkPointKNNGraph finds the neighbors of each point of a point cloud: the
+ * N closest points (which include the point itself), or the points within a
+ * radius. The neighborhoods are stored in compressed sparse row form in the
+ * field data of the output, which otherwise is the same as the input: a
+ * vtkIdTypeArray "vtkPointKNNGraphOffsets" of NumberOfPoints+1 offsets, and
+ * a vtkIdTypeArray "vtkPointKNNGraphNeighbors" where the neighbors of point
+ * i are the values offsets[i] to offsets[i+1]-1. The N closest points are
+ * sorted by increasing distance to the point.
+ *
+ * Downstream filters which search the neighbors of each point of their
+ * input (vtkPCANormalEstimation, vtkStatisticalOutlierRemoval,
+ * vtkRadiusOutlierRemoval, and vtkPointInterpolator when its input and
+ * source share the same points) use the stored graph instead of their point
+ * locator when it answers their query, so that a pipeline of point cloud
+ * filters searches the neighborhoods only once. The graph is used as long
+ * as the points of the dataset are the ones it was computed from, and were
+ * not modified since; see GetGraph().
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. The neighborhoods are
+ * searched in parallel when the locator supports thread safe queries (as
+ * the default vtkStaticPointLocator does). Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkStaticPointLocator vtkPCANormalEstimation vtkStatisticalOutlierRemoval
+ * vtkRadiusOutlierRemoval vtkPointInterpolator
+*/
+
+#ifndef vtkPointKNNGraph_h
+#define vtkPointKNNGraph_h
+
+#include "vtkFiltersPointsModule.h" // For export macro
+#include "vtkPointSetAlgorithm.h"
+
+class vtkAbstractPointLocator;
+class vtkInformationDoubleKey;
+class vtkInformationIntegerKey;
+class vtkInformationObjectBaseKey;
+class vtkPointSet;
+
+
+class VTKFILTERSPOINTS_EXPORT vtkPointKNNGraph : public vtkPointSetAlgorithm
+{
+public:
+  //@{
+  /**
+   * Standard methods for instantiating, obtaining type information, and
+   * printing information.
+   */
+  static vtkPointKNNGraph *New();
+  vtkTypeMacro(vtkPointKNNGraph,vtkPointSetAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  //@}
+
+  /**
+   * Enum used to select the neighborhood of the points.
+   */
+  enum NeighborhoodStyle
+  {
+    N_CLOSEST=0,
+    RADIUS=1
+  };
+
+  //@{
+  /**
+   * Specify whether the neighborhood of each point is made of the
+   * NumberOfNeighbors closest points (the default), or of the points within
+   * Radius.
+   */
+  vtkSetClampMacro(Neighborhood,int,N_CLOSEST,RADIUS);
+  vtkGetMacro(Neighborhood,int);
+  void SetNeighborhoodToNClosest()
+    { this->SetNeighborhood(N_CLOSEST); }
+  void SetNeighborhoodToRadius()
+    { this->SetNeighborhood(RADIUS); }
+  //@}
+
+  //@{
+  /**
+   * Specify the number of closest points in the neighborhood of each point,
+   * the point itself included. By default 25 points are used (the default
+   * sample size of the point cloud filters).
+   */
+  vtkSetClampMacro(NumberOfNeighbors,int,1,VTK_INT_MAX);
+  vtkGetMacro(NumberOfNeighbors,int);
+  //@}
+
+  //@{
+  /**
+   * Specify the radius of the neighborhood of each point. By default it is
+   * 1.0.
+   */
+  vtkSetClampMacro(Radius,double,0.0,VTK_FLOAT_MAX);
+  vtkGetMacro(Radius,double);
+  //@}
+
+  //@{
+  /**
+   * Specify a point locator. By default a vtkStaticPointLocator is used.
+   * The locator performs efficient searches to locate the neighbors of
+   * the points.
+   */
+  void SetLocator(vtkAbstractPointLocator *locator);
+  vtkGetObjectMacro(Locator,vtkAbstractPointLocator);
+  //@}
+
+  /**
+   * Return the graph stored in the field data of the point set by this
+   * filter, if it was computed from the points of the point set, which were
+   * not modified since, and if it holds the N closest points of each point
+   * (for N > 0, the graph of the N' >= N closest points), or the points
+   * within the radius (for N <= 0, the graph of the points within a radius
+   * R' >= radius). Otherwise return false. The neighbors of point i are
+   * neighbors[offsets[i]] to neighbors[offsets[i+1]-1]: for N > 0 the N
+   * closest points are the first N neighbors; otherwise the neighbors
+   * farther than the radius must be skipped.
+   */
+  static bool GetGraph(vtkPointSet *ps, int N, double radius,
+                       const vtkIdType *&offsets, const vtkIdType *&neighbors);
+
+  //@{
+  /**
+   * Keys of the information of the offsets array, which record the number
+   * of neighbors or the radius of the neighborhoods, and the points the
+   * graph was computed from.
+   */
+  static vtkInformationIntegerKey* NUMBER_OF_NEIGHBORS();
+  static vtkInformationDoubleKey* RADIUS_OF_NEIGHBORHOOD();
+  static vtkInformationObjectBaseKey* POINTS();
+  //@}
+
+protected:
+  vtkPointKNNGraph();
+  ~vtkPointKNNGraph() override;
+
+  int Neighborhood;
+  int NumberOfNeighbors;
+  double Radius;
+  vtkAbstractPointLocator *Locator;
+
+  int RequestData(vtkInformation *, vtkInformationVector **,
+    vtkInformationVector *) override;
+
+private:
+  vtkPointKNNGraph(const vtkPointKNNGraph&) = delete;
+  void operator=(const vtkPointKNNGraph&) = delete;
+
+};
+
+#endif
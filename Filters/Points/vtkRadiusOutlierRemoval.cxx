@@ -17,9 +17,11 @@
 #include "vtkObjectFactory.h"
 #include "vtkAbstractPointLocator.h"
 #include "vtkStaticPointLocator.h"
+#include "vtkPointKNNGraph.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkIdList.h"
+#include "vtkMath.h"
 #include "vtkSMPTools.h"
 #include "vtkSMPThreadLocalObject.h"
 
@@ -38,6 +40,8 @@ struct RemoveOutliers
 {
   const T *Points;
   vtkAbstractPointLocator *Locator;
+  const vtkIdType *Offsets; //neighborhood graph, if any
+  const vtkIdType *Neighbors;
   double Radius;
   int NumNeighbors;
   vtkIdType *PointMap;
@@ -46,9 +50,11 @@ struct RemoveOutliers
   // storage lots of new/delete.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
 
-  RemoveOutliers(T *points, vtkAbstractPointLocator *loc, double radius, int numNei,
-                 vtkIdType *map) : Points(points), Locator(loc), Radius(radius),
-                                   NumNeighbors(numNei), PointMap(map)
+  RemoveOutliers(T *points, vtkAbstractPointLocator *loc,
+                 const vtkIdType *offsets, const vtkIdType *neighbors,
+                 double radius, int numNei, vtkIdType *map) :
+    Points(points), Locator(loc), Offsets(offsets), Neighbors(neighbors),
+    Radius(radius), NumNeighbors(numNei), PointMap(map)
   {
   }
 
@@ -62,8 +68,10 @@ struct RemoveOutliers
   void operator() (vtkIdType ptId, vtkIdType endPtId)
   {
       const T *p = this->Points + 3*ptId;
+      const T *py;
       vtkIdType *map = this->PointMap + ptId;
-      double x[3];
+      double x[3], y[3];
+      double radius2 = this->Radius * this->Radius;
       vtkIdList*& pIds = this->PIds.Local();
 
       for ( ; ptId < endPtId; ++ptId)
@@ -72,8 +80,24 @@ struct RemoveOutliers
         x[1] = static_cast<double>(*p++);
         x[2] = static_cast<double>(*p++);
 
-        this->Locator->FindPointsWithinRadius(this->Radius, x, pIds);
-        vtkIdType numPts = pIds->GetNumberOfIds();
+        // The graph may have been computed with a larger radius
+        vtkIdType numPts = 0;
+        if ( this->Offsets )
+        {
+          for ( vtkIdType i=this->Offsets[ptId]; i < this->Offsets[ptId+1]; ++i )
+          {
+            py = this->Points + 3*this->Neighbors[i];
+            y[0] = static_cast<double>(py[0]);
+            y[1] = static_cast<double>(py[1]);
+            y[2] = static_cast<double>(py[2]);
+            numPts += ( vtkMath::Distance2BetweenPoints(x,y) <= radius2 );
+          }
+        }
+        else
+        {
+          this->Locator->FindPointsWithinRadius(this->Radius, x, pIds);
+          numPts = pIds->GetNumberOfIds();
+        }
 
         // Keep in mind that The FindPoints method will always return at
         // least one point (itself).
@@ -86,10 +110,12 @@ struct RemoveOutliers
   }
 
   static void Execute(vtkRadiusOutlierRemoval *self, vtkIdType numPts,
-                      T *points, vtkIdType *map)
+                      T *points, const vtkIdType *offsets,
+                      const vtkIdType *neighbors, vtkIdType *map)
   {
-      RemoveOutliers remove(points, self->GetLocator(), self->GetRadius(),
-                            self->GetNumberOfNeighbors(), map);
+      RemoveOutliers remove(points, self->GetLocator(), offsets, neighbors,
+                            self->GetRadius(), self->GetNumberOfNeighbors(),
+                            map);
       vtkSMPTools::For(0, numPts, remove);
   }
 
@@ -118,15 +144,20 @@ vtkRadiusOutlierRemoval::~vtkRadiusOutlierRemoval()
 // are to be copied to the output.
 int vtkRadiusOutlierRemoval::FilterPoints(vtkPointSet *input)
 {
-  // Perform the point removal
-  // Start by building the locator
-  if ( !this->Locator )
+  // Perform the point removal. Use the neighborhood graph of the input if
+  // it holds the points within the radius; otherwise start by building the
+  // locator.
+  const vtkIdType *offsets = nullptr, *neighbors = nullptr;
+  if ( !vtkPointKNNGraph::GetGraph(input, 0, this->Radius, offsets, neighbors) )
   {
-    vtkErrorMacro(<<"Point locator required\n");
-    return 0;
+    if ( !this->Locator )
+    {
+      vtkErrorMacro(<<"Point locator required\n");
+      return 0;
+    }
+    this->Locator->SetDataSet(input);
+    this->Locator->BuildLocator();
   }
-  this->Locator->SetDataSet(input);
-  this->Locator->BuildLocator();
 
   // Determine which points, if any, should be removed. We create a map
   // to keep track. The bulk of the algorithmic work is done in this pass.
@@ -135,7 +166,8 @@ int vtkRadiusOutlierRemoval::FilterPoints(vtkPointSet *input)
   switch (input->GetPoints()->GetDataType())
   {
     vtkTemplateMacro(RemoveOutliers<VTK_TT>::
-                     Execute(this, numPts, (VTK_TT *)inPtr, this->PointMap));
+                     Execute(this, numPts, (VTK_TT *)inPtr, offsets,
+                             neighbors, this->PointMap));
   }
 
   return 1;
@@ -23,7 +23,10 @@
  * (i.e., number of neighboring points required for the point to be
  * considered isolated). Optionally, users can specify a point locator to
  * accelerate local neighborhood search operations. (By default a
- * vtkStaticPointLocator will be created.)
+ * vtkStaticPointLocator will be created.) If the input carries the
+ * neighborhood graph of the points within a radius at least as large (as
+ * computed by vtkPointKNNGraph), the neighbors are counted in the graph
+ * instead of being searched with the locator.
  *
  * Note that while any vtkPointSet type can be provided as input, the output
  * is represented by an explicit representation of points via a
@@ -43,7 +46,7 @@
  *
  * @sa
  * vtkPointCloudFilter vtkStatisticalOutlierRemoval vtkExtractPoints
- * vtkThresholdPoints vtkImplicitFunction
+ * vtkThresholdPoints vtkImplicitFunction vtkPointKNNGraph
 */
 
 #ifndef vtkRadiusOutlierRemoval_h
@@ -17,6 +17,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkAbstractPointLocator.h"
 #include "vtkStaticPointLocator.h"
+#include "vtkPointKNNGraph.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkIdList.h"
@@ -38,6 +39,8 @@ struct ComputeMeanDistance
 {
   const T *Points;
   vtkAbstractPointLocator *Locator;
+  const vtkIdType *Offsets; //neighborhood graph, if any
+  const vtkIdType *Neighbors;
   int SampleSize;
   float *Distance;
   double Mean;
@@ -48,8 +51,11 @@ struct ComputeMeanDistance
   vtkSMPThreadLocal<double> ThreadMean;
   vtkSMPThreadLocal<vtkIdType> ThreadCount;
 
-  ComputeMeanDistance(T *points, vtkAbstractPointLocator *loc, int size, float *d) :
-    Points(points), Locator(loc), SampleSize(size), Distance(d), Mean(0.0)
+  ComputeMeanDistance(T *points, vtkAbstractPointLocator *loc,
+                      const vtkIdType *offsets, const vtkIdType *neighbors,
+                      int size, float *d) :
+    Points(points), Locator(loc), Offsets(offsets), Neighbors(neighbors),
+    SampleSize(size), Distance(d), Mean(0.0)
   {
   }
 
@@ -84,15 +90,28 @@ struct ComputeMeanDistance
         x[2] = static_cast<double>(*px++);
 
         // The method FindClosestNPoints will include the current point, so
-        // we increase the sample size by one.
-        this->Locator->FindClosestNPoints(this->SampleSize+1, x, pIds);
-        vtkIdType numPts = pIds->GetNumberOfIds();
+        // we increase the sample size by one. The closest points may also
+        // be the first ones of the neighbors in the graph.
+        const vtkIdType *ids;
+        vtkIdType numPts;
+        if ( this->Offsets )
+        {
+          ids = this->Neighbors + this->Offsets[ptId];
+          numPts = this->Offsets[ptId+1] - this->Offsets[ptId];
+          numPts = ( numPts > this->SampleSize+1 ? this->SampleSize+1 : numPts );
+        }
+        else
+        {
+          this->Locator->FindClosestNPoints(this->SampleSize+1, x, pIds);
+          ids = pIds->GetPointer(0);
+          numPts = pIds->GetNumberOfIds();
+        }
 
         double sum = 0.0;
         vtkIdType nei;
         for (int sample=0; sample < numPts; ++sample)
         {
-          nei = pIds->GetId(sample);
+          nei = ids[sample];
           if ( nei != ptId ) //exclude ourselves
           {
             py = this->Points + 3*nei;
@@ -142,10 +161,12 @@ struct ComputeMeanDistance
   }
 
   static void Execute(vtkStatisticalOutlierRemoval *self, vtkIdType numPts,
-                      T *points, float *distances, double& mean)
+                      T *points, const vtkIdType *offsets,
+                      const vtkIdType *neighbors, float *distances,
+                      double& mean)
   {
-      ComputeMeanDistance compute(points, self->GetLocator(),
-                                  self->GetSampleSize(), distances);
+      ComputeMeanDistance compute(points, self->GetLocator(), offsets,
+                                  neighbors, self->GetSampleSize(), distances);
       vtkSMPTools::For(0, numPts, compute);
       mean = compute.Mean;
   }
@@ -292,15 +313,20 @@ vtkStatisticalOutlierRemoval::~vtkStatisticalOutlierRemoval()
 // within a specified deviation from the mean.
 int vtkStatisticalOutlierRemoval::FilterPoints(vtkPointSet *input)
 {
-  // Perform the point removal
-  // Start by building the locator
-  if ( !this->Locator )
+  // Perform the point removal. Use the neighborhood graph of the input if
+  // it holds the closest points; otherwise start by building the locator.
+  const vtkIdType *offsets = nullptr, *neighbors = nullptr;
+  if ( !vtkPointKNNGraph::GetGraph(input, this->SampleSize+1, 0.0,
+                                   offsets, neighbors) )
   {
-    vtkErrorMacro(<<"Point locator required\n");
-    return 0;
+    if ( !this->Locator )
+    {
+      vtkErrorMacro(<<"Point locator required\n");
+      return 0;
+    }
+    this->Locator->SetDataSet(input);
+    this->Locator->BuildLocator();
   }
-  this->Locator->SetDataSet(input);
-  this->Locator->BuildLocator();
 
   // Compute statistics across the point cloud. Start my computing
   // mean distance to N closest neighbors.
@@ -311,7 +337,8 @@ int vtkStatisticalOutlierRemoval::FilterPoints(vtkPointSet *input)
   switch (input->GetPoints()->GetDataType())
   {
     vtkTemplateMacro(ComputeMeanDistance<VTK_TT>::
-                     Execute(this, numPts, (VTK_TT *)inPtr, dist, mean));
+                     Execute(this, numPts, (VTK_TT *)inPtr, offsets,
+                             neighbors, dist, mean));
   }
 
   // At this point the mean distance for each point, and across the point
@@ -26,6 +26,11 @@
  * average separation is greater than the user-specified variation in
  * a multiple of standard deviation are removed.
  *
+ * If the input carries the neighborhood graph of at least the SampleSize+1
+ * closest points of each point (the point itself included, as computed by
+ * vtkPointKNNGraph), the samples are taken from the graph instead of being
+ * searched with the locator.
+ *
  * Note that while any vtkPointSet type can be provided as input, the output is
  * represented by an explicit representation of points via a
  * vtkPolyData. This output polydata will populate its instance of vtkPoints,
@@ -44,7 +49,7 @@
  *
  * @sa
  * vtkPointCloudFilter vtkRadiusOutlierRemoval vtkExtractPoints
- * vtkThresholdPoints
+ * vtkThresholdPoints vtkPointKNNGraph
 */
 
 #ifndef vtkStatisticalOutlierRemoval_h
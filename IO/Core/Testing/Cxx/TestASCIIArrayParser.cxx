@@ -0,0 +1,255 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestASCIIArrayParser.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that vtkASCIIArrayParser gives the values of istream::operator>>,
+// for texts small enough to be parsed serially and large ones parsed in
+// parallel, and that reading leaves the stream right after the last value.
+
+#include "vtkASCIIArrayParser.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkTypeTraits.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// A stream buffer over a text with CRLF line endings that returns LF line
+// endings, and whose positions are offsets in the text, like the file
+// streams opened in text mode on Windows.
+class TextModeBuffer : public std::streambuf
+{
+public:
+  explicit TextModeBuffer(const std::string& text) : Text(text), Pos(0) {}
+
+protected:
+  bool AtCRLF() const
+  {
+    return this->Text[this->Pos] == '\r' &&
+      this->Pos + 1 < this->Text.size() && this->Text[this->Pos + 1] == '\n';
+  }
+
+  int_type underflow() override
+  {
+    if (this->Pos >= this->Text.size())
+    {
+      return traits_type::eof();
+    }
+    return traits_type::to_int_type(
+      this->AtCRLF() ? '\n' : this->Text[this->Pos]);
+  }
+
+  int_type uflow() override
+  {
+    int_type c = this->underflow();
+    if (c != traits_type::eof())
+    {
+      this->Pos += this->AtCRLF() ? 2 : 1;
+    }
+    return c;
+  }
+
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                   std::ios_base::openmode which) override
+  {
+    if (dir == std::ios_base::beg)
+    {
+      return this->seekpos(pos_type(off), which);
+    }
+    if (dir == std::ios_base::cur && off == 0)
+    {
+      return pos_type(static_cast<off_type>(this->Pos));
+    }
+    return pos_type(off_type(-1));
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode) override
+  {
+    off_type off = static_cast<off_type>(pos);
+    if (off < 0 || off > static_cast<off_type>(this->Text.size()))
+    {
+      return pos_type(off_type(-1));
+    }
+    this->Pos = static_cast<size_t>(off);
+    return pos;
+  }
+
+private:
+  std::string Text;
+  size_t Pos;
+};
+
+template <typename T>
+int TestParse(const std::vector<T>& values)
+{
+  std::ostringstream os;
+  os.precision(std::numeric_limits<T>::max_digits10);
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    os << values[i] << ((i % 9 == 8) ? "\n" : " ");
+  }
+  os << "END";
+  std::string text = os.str();
+
+  std::istringstream is(text);
+  std::vector<T> expected(values.size());
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    is >> expected[i];
+  }
+
+  // Parsing stops at the token that is not a number.
+  std::vector<T> parsed(values.size() + 1);
+  vtkIdType n = vtkASCIIArrayParser::Parse(text.data(),
+    text.data() + text.size(), vtkTypeTraits<T>::VTK_TYPE_ID, parsed.data(),
+    static_cast<vtkIdType>(parsed.size()));
+  if (n != static_cast<vtkIdType>(values.size()) ||
+      memcmp(parsed.data(), expected.data(), values.size() * sizeof(T)) != 0)
+  {
+    cerr << "Wrong values parsed for " << vtkTypeTraits<T>::Name() << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Reading from a stream stops right after the last value.
+  std::istringstream ris(text);
+  std::vector<T> read(values.size());
+  n = vtkASCIIArrayParser::Read(ris, vtkTypeTraits<T>::VTK_TYPE_ID,
+    read.data(), static_cast<vtkIdType>(read.size()));
+  std::string next;
+  ris >> next;
+  if (n != static_cast<vtkIdType>(values.size()) || read != expected ||
+      next != "END")
+  {
+    cerr << "Wrong values read for " << vtkTypeTraits<T>::Name() << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
+
+template <typename T>
+int TestType(vtkMinimalStandardRandomSequence* random, size_t numValues,
+             double minimum, double maximum)
+{
+  std::vector<T> values(numValues);
+  for (size_t i = 0; i < numValues; ++i)
+  {
+    random->Next();
+    values[i] = static_cast<T>(random->GetRangeValue(minimum, maximum));
+  }
+  return TestParse(values);
+}
+
+template <typename T>
+int TestSizes(vtkMinimalStandardRandomSequence* random,
+              double minimum, double maximum)
+{
+  if (TestType<T>(random, 100, minimum, maximum) != EXIT_SUCCESS ||
+      TestType<T>(random, 500000, minimum, maximum) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+}
+
+int TestASCIIArrayParser(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+
+  if (TestSizes<double>(random, -1.0e10, 1.0e10) != EXIT_SUCCESS ||
+      TestSizes<double>(random, -1.0e-10, 1.0e-10) != EXIT_SUCCESS ||
+      TestSizes<float>(random, -1.0e5, 1.0e5) != EXIT_SUCCESS ||
+      TestSizes<int>(random, -2.0e9, 2.0e9) != EXIT_SUCCESS ||
+      TestSizes<vtkIdType>(random, -1.0e15, 1.0e15) != EXIT_SUCCESS ||
+      TestSizes<unsigned short>(random, 0, 65535) != EXIT_SUCCESS)
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The limits of the integer types, signs, chars and special values.
+  const char* text = "-128 +127 255 -32768 32767 65536 -9223372036854775808 "
+                     "18446744073709551615 1.5 inf -INF NaN 1e-320";
+  const char* end = text + strlen(text);
+  signed char c[3];
+  short s[3];
+  vtkTypeInt64 l[1];
+  vtkTypeUInt64 ul[1];
+  double d[5];
+  int i[1];
+  const char* p = text;
+  if (vtkASCIIArrayParser::Parse(p, end, VTK_SIGNED_CHAR, c, 3) != 3 ||
+      c[0] != -128 || c[1] != 127 || c[2] != -1 ||
+      vtkASCIIArrayParser::Parse(p = strstr(text, "-32768"), end, VTK_SHORT,
+                                 s, 3) != 2 ||
+      s[0] != -32768 || s[1] != 32767 ||
+      vtkASCIIArrayParser::Parse(p = strstr(text, "-9223"), end,
+                                 VTK_TYPE_INT64, l, 1) != 1 ||
+      l[0] != std::numeric_limits<vtkTypeInt64>::min() ||
+      vtkASCIIArrayParser::Parse(p = strstr(text, "1844"), end,
+                                 VTK_TYPE_UINT64, ul, 1) != 1 ||
+      ul[0] != std::numeric_limits<vtkTypeUInt64>::max() ||
+      vtkASCIIArrayParser::Parse(p = strstr(text, "1.5"), end, VTK_DOUBLE,
+                                 d, 5) != 5 ||
+      d[0] != 1.5 || d[1] != std::numeric_limits<double>::infinity() ||
+      d[2] != -std::numeric_limits<double>::infinity() ||
+      !std::isnan(d[3]) || d[4] != 1e-320 ||
+      vtkASCIIArrayParser::Parse(p = strstr(text, "1.5"), end, VTK_INT,
+                                 i, 1) != 0 ||
+      vtkASCIIArrayParser::CountTokens(text, end) != 13)
+  {
+    cerr << "Wrong special values" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Line endings translated by the stream do not shift the position the
+  // stream is left at: the values span several blocks of text.
+  const int numInts = 200000;
+  std::string crlf;
+  for (int k = 0; k < numInts; ++k)
+  {
+    crlf += std::to_string(k) + ((k % 9 == 8) ? "\r\n" : " ");
+  }
+  crlf += "\r\nEND\r\n";
+  TextModeBuffer buffer(crlf);
+  std::istream tis(&buffer);
+  std::vector<int> ints(numInts);
+  std::string next;
+  if (vtkASCIIArrayParser::Read(tis, VTK_INT, ints.data(), numInts) !=
+      numInts || ints[numInts - 1] != numInts - 1 || !(tis >> next) ||
+      next != "END")
+  {
+    cerr << "Wrong position after reading a text mode stream" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // A short read sets the fail bit.
+  std::istringstream is("1 2 3");
+  if (vtkASCIIArrayParser::Read(is, VTK_DOUBLE, d, 4) != 3 || !is.fail())
+  {
+    cerr << "Reading past the end did not fail" << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestCompressZstd.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// .NAME Test of vtkZstdDataCompressor
+// .SECTION Description
+//
+
+#include "vtkNew.h"
+#include "vtkZstdDataCompressor.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+// Compress and uncompress the buffer, returns the compressed size or 0 on
+// failure.
+size_t RoundTrip(vtkZstdDataCompressor* compressor,
+                 const std::vector<unsigned char>& buffer)
+{
+  std::vector<unsigned char> cbuffer(
+    compressor->GetMaximumCompressionSpace(buffer.size()));
+  size_t clen = compressor->Compress(buffer.data(), buffer.size(),
+                                     cbuffer.data(), cbuffer.size());
+  if (clen == 0)
+  {
+    return 0;
+  }
+  std::vector<unsigned char> ucbuffer(buffer.size());
+  size_t rlen = compressor->Uncompress(cbuffer.data(), clen,
+                                       ucbuffer.data(), ucbuffer.size());
+  if (rlen != buffer.size() ||
+      memcmp(ucbuffer.data(), buffer.data(), buffer.size()) != 0)
+  {
+    return 0;
+  }
+  return clen;
+}
+
+// A small record sharing its layout with all the other ones.
+void FillRecord(std::vector<unsigned char>& record, int i)
+{
+  record.clear();
+  const char* header = "<Record type=\"Float32\" format=\"binary\" id=\"";
+  record.insert(record.end(), header, header + strlen(header));
+  for (int j = 0; j < 64; ++j)
+  {
+    record.push_back(static_cast<unsigned char>('a' + (i * 7 + j * j) % 26));
+  }
+}
+
+}
+
+int TestCompressZstd(int, char*[])
+{
+  vtkNew<vtkZstdDataCompressor> compressor;
+  std::vector<unsigned char> buffer(100024);
+  for (size_t cc = 0; cc < buffer.size(); ++cc)
+  {
+    buffer[cc] = static_cast<unsigned char>((cc * cc) % 251);
+  }
+
+  // All the levels must round trip, and the higher ones must not compress
+  // worse than the fastest one.
+  compressor->SetCompressionLevel(1);
+  size_t fastSize = RoundTrip(compressor, buffer);
+  compressor->SetCompressionLevel(9);
+  size_t bestSize = RoundTrip(compressor, buffer);
+  if (fastSize == 0 || bestSize == 0 || bestSize > fastSize)
+  {
+    cerr << "Level round trip failed: " << fastSize << " " << bestSize << endl;
+    return 1;
+  }
+  if (compressor->GetCompressionLevel() != 9)
+  {
+    cerr << "Wrong compression level " << compressor->GetCompressionLevel()
+         << endl;
+    return 1;
+  }
+  compressor->SetZstdLevel(-5);
+  if (RoundTrip(compressor, buffer) == 0)
+  {
+    cerr << "Fast level round trip failed" << endl;
+    return 1;
+  }
+
+  // Train a dictionary from small records and check it helps.
+  std::vector<unsigned char> samples;
+  std::vector<size_t> sampleSizes;
+  std::vector<unsigned char> record;
+  for (int i = 0; i < 1000; ++i)
+  {
+    FillRecord(record, i);
+    samples.insert(samples.end(), record.begin(), record.end());
+    sampleSizes.push_back(record.size());
+  }
+  FillRecord(record, 1001);
+  compressor->SetCompressionLevel(5);
+  size_t plainSize = RoundTrip(compressor, record);
+  if (!compressor->TrainDictionary(samples.data(), sampleSizes.data(),
+        static_cast<unsigned int>(sampleSizes.size()), 4096) ||
+      compressor->GetDictionarySize() == 0)
+  {
+    cerr << "Dictionary training failed" << endl;
+    return 1;
+  }
+  size_t dictionarySize = RoundTrip(compressor, record);
+  if (plainSize == 0 || dictionarySize == 0 || dictionarySize >= plainSize)
+  {
+    cerr << "Dictionary round trip failed: " << plainSize << " "
+         << dictionarySize << endl;
+    return 1;
+  }
+
+  // The dictionary is needed to uncompress the data.
+  std::vector<unsigned char> cbuffer(
+    compressor->GetMaximumCompressionSpace(record.size()));
+  size_t clen = compressor->Compress(record.data(), record.size(),
+                                     cbuffer.data(), cbuffer.size());
+  vtkNew<vtkZstdDataCompressor> reader;
+  reader->SetDictionary(compressor->GetDictionary(),
+                        compressor->GetDictionarySize());
+  std::vector<unsigned char> ucbuffer(record.size());
+  if (reader->Uncompress(cbuffer.data(), clen, ucbuffer.data(),
+                         ucbuffer.size()) != record.size() ||
+      ucbuffer != record)
+  {
+    cerr << "Uncompressing with a copied dictionary failed" << endl;
+    return 1;
+  }
+
+  return 0;
+}
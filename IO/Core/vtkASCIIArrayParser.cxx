@@ -0,0 +1,494 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkASCIIArrayParser.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkASCIIArrayParser.h"
+
+#include "vtkSMPTools.h"
+#include "vtkSetGet.h"
+
+#include "vtk_doubleconversion.h"
+#include VTK_DOUBLECONVERSION_HEADER(double-conversion.h)
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+// Texts larger than this are split in chunks of about this size, parsed in
+// parallel.
+const size_t vtkASCIIChunkSize = 1 << 20;
+
+// Streams are read in blocks growing up to this size, so that small arrays
+// do not need large buffers.
+const size_t vtkASCIIMinimumBlockSize = 1 << 16;
+const size_t vtkASCIIMaximumBlockSize = 1 << 26;
+
+//----------------------------------------------------------------------------
+inline bool vtkASCIIIsSpace(char c)
+{
+  return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+//----------------------------------------------------------------------------
+inline const char* vtkASCIISkipSpaces(const char* p, const char* end)
+{
+  while (p != end && vtkASCIIIsSpace(*p))
+  {
+    ++p;
+  }
+  return p;
+}
+
+//----------------------------------------------------------------------------
+inline const char* vtkASCIISkipToken(const char* p, const char* end)
+{
+  while (p != end && !vtkASCIIIsSpace(*p))
+  {
+    ++p;
+  }
+  return p;
+}
+
+//----------------------------------------------------------------------------
+// Returns the end of the n-th token of the text, or the end of the text when
+// it has fewer tokens, and the number of tokens skipped.
+const char* vtkASCIISkipTokens(const char* p, const char* end, vtkIdType n,
+                               vtkIdType& skipped)
+{
+  skipped = 0;
+  while (skipped < n)
+  {
+    p = vtkASCIISkipSpaces(p, end);
+    if (p == end)
+    {
+      break;
+    }
+    p = vtkASCIISkipToken(p, end);
+    ++skipped;
+  }
+  return p;
+}
+
+//----------------------------------------------------------------------------
+const double_conversion::StringToDoubleConverter& vtkASCIIGetConverter()
+{
+  static const double_conversion::StringToDoubleConverter converter(
+    double_conversion::StringToDoubleConverter::ALLOW_CASE_INSENSIBILITY,
+    0.0, std::numeric_limits<double>::quiet_NaN(), "inf", "nan");
+  return converter;
+}
+
+//----------------------------------------------------------------------------
+// Convert the digits of an integer token, with an optional sign.
+bool vtkASCIIParseMagnitude(const char* p, const char* end, bool& negative,
+                            vtkTypeUInt64& magnitude)
+{
+  negative = (*p == '-');
+  if (*p == '-' || *p == '+')
+  {
+    ++p;
+  }
+  if (p == end)
+  {
+    return false;
+  }
+  const vtkTypeUInt64 maximum = std::numeric_limits<vtkTypeUInt64>::max();
+  magnitude = 0;
+  for (; p != end; ++p)
+  {
+    unsigned int digit = static_cast<unsigned char>(*p) - '0';
+    if (digit > 9 || magnitude > (maximum - digit) / 10)
+    {
+      return false;
+    }
+    magnitude = magnitude * 10 + digit;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+template <typename T>
+bool vtkASCIIConvertInteger(const char* p, const char* end, T& value,
+                            std::true_type /* signed */)
+{
+  bool negative;
+  vtkTypeUInt64 magnitude;
+  if (!vtkASCIIParseMagnitude(p, end, negative, magnitude))
+  {
+    return false;
+  }
+  const vtkTypeUInt64 maximum =
+    static_cast<vtkTypeUInt64>(std::numeric_limits<T>::max());
+  if (!negative)
+  {
+    if (magnitude > maximum)
+    {
+      return false;
+    }
+    value = static_cast<T>(magnitude);
+  }
+  else
+  {
+    if (magnitude > maximum + 1)
+    {
+      return false;
+    }
+    value = (magnitude == 0 ? 0 :
+      static_cast<T>(-static_cast<T>(magnitude - 1) - 1));
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Like istream::operator>>, negative values wrap around.
+template <typename T>
+bool vtkASCIIConvertInteger(const char* p, const char* end, T& value,
+                            std::false_type /* signed */)
+{
+  bool negative;
+  vtkTypeUInt64 magnitude;
+  if (!vtkASCIIParseMagnitude(p, end, negative, magnitude) ||
+      magnitude > static_cast<vtkTypeUInt64>(std::numeric_limits<T>::max()))
+  {
+    return false;
+  }
+  value = static_cast<T>(magnitude);
+  if (negative)
+  {
+    value = static_cast<T>(0 - value);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+template <typename T>
+bool vtkASCIIConvert(const char* p, const char* end, T& value)
+{
+  return vtkASCIIConvertInteger(p, end, value,
+    std::integral_constant<bool, std::numeric_limits<T>::is_signed>());
+}
+
+//----------------------------------------------------------------------------
+// The char types are read as integers and truncated, like the readers did.
+template <typename T>
+bool vtkASCIIConvertChar(const char* p, const char* end, T& value)
+{
+  int intValue;
+  if (!vtkASCIIConvert(p, end, intValue))
+  {
+    return false;
+  }
+  value = static_cast<T>(intValue);
+  return true;
+}
+
+bool vtkASCIIConvert(const char* p, const char* end, char& value)
+{
+  return vtkASCIIConvertChar(p, end, value);
+}
+
+bool vtkASCIIConvert(const char* p, const char* end, signed char& value)
+{
+  return vtkASCIIConvertChar(p, end, value);
+}
+
+bool vtkASCIIConvert(const char* p, const char* end, unsigned char& value)
+{
+  return vtkASCIIConvertChar(p, end, value);
+}
+
+//----------------------------------------------------------------------------
+bool vtkASCIIConvert(const char* p, const char* end, double& value)
+{
+  int length = static_cast<int>(end - p);
+  int processed;
+  value = vtkASCIIGetConverter().StringToDouble(p, length, &processed);
+  return processed == length;
+}
+
+bool vtkASCIIConvert(const char* p, const char* end, float& value)
+{
+  int length = static_cast<int>(end - p);
+  int processed;
+  value = vtkASCIIGetConverter().StringToFloat(p, length, &processed);
+  return processed == length;
+}
+
+//----------------------------------------------------------------------------
+// Serial conversion of at most numValues values.
+template <typename T>
+vtkIdType vtkASCIIParseRange(const char* p, const char* end, T* data,
+                             vtkIdType numValues)
+{
+  vtkIdType n = 0;
+  while (n < numValues)
+  {
+    p = vtkASCIISkipSpaces(p, end);
+    if (p == end)
+    {
+      break;
+    }
+    const char* tokenEnd = vtkASCIISkipToken(p, end);
+    if (!vtkASCIIConvert(p, tokenEnd, data[n]))
+    {
+      break;
+    }
+    ++n;
+    p = tokenEnd;
+  }
+  return n;
+}
+
+//----------------------------------------------------------------------------
+struct vtkASCIICountChunks
+{
+  const std::vector<const char*>& Bounds;
+  std::vector<vtkIdType>& Counts;
+
+  vtkASCIICountChunks(const std::vector<const char*>& bounds,
+                      std::vector<vtkIdType>& counts)
+    : Bounds(bounds), Counts(counts)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType c = begin; c < end; ++c)
+    {
+      this->Counts[c] =
+        vtkASCIIArrayParser::CountTokens(this->Bounds[c], this->Bounds[c + 1]);
+    }
+  }
+};
+
+//----------------------------------------------------------------------------
+template <typename T>
+struct vtkASCIIParseChunks
+{
+  const std::vector<const char*>& Bounds;
+  const std::vector<vtkIdType>& Offsets;
+  const std::vector<vtkIdType>& Counts;
+  std::vector<vtkIdType>& Parsed;
+  T* Data;
+
+  vtkASCIIParseChunks(const std::vector<const char*>& bounds,
+                      const std::vector<vtkIdType>& offsets,
+                      const std::vector<vtkIdType>& counts,
+                      std::vector<vtkIdType>& parsed, T* data)
+    : Bounds(bounds), Offsets(offsets), Counts(counts), Parsed(parsed),
+      Data(data)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType c = begin; c < end; ++c)
+    {
+      this->Parsed[c] = vtkASCIIParseRange(this->Bounds[c],
+        this->Bounds[c + 1], this->Data + this->Offsets[c], this->Counts[c]);
+    }
+  }
+};
+
+//----------------------------------------------------------------------------
+template <typename T>
+vtkIdType vtkASCIIParse(const char* begin, const char* end, T* data,
+                        vtkIdType numValues)
+{
+  size_t size = static_cast<size_t>(end - begin);
+  if (size <= 2 * vtkASCIIChunkSize)
+  {
+    return vtkASCIIParseRange(begin, end, data, numValues);
+  }
+
+  // Split the text in chunks ending at whitespace.
+  vtkIdType numChunks = static_cast<vtkIdType>(size / vtkASCIIChunkSize);
+  std::vector<const char*> bounds(numChunks + 1);
+  bounds[0] = begin;
+  for (vtkIdType c = 1; c < numChunks; ++c)
+  {
+    const char* p = std::max(begin + c * vtkASCIIChunkSize, bounds[c - 1]);
+    bounds[c] = vtkASCIISkipToken(p, end);
+  }
+  bounds[numChunks] = end;
+
+  // Locate the values of each chunk, then convert them.
+  std::vector<vtkIdType> counts(numChunks);
+  vtkASCIICountChunks countChunks(bounds, counts);
+  vtkSMPTools::For(0, numChunks, 1, countChunks);
+  std::vector<vtkIdType> offsets(numChunks);
+  vtkSMPTools::ExclusiveScan(counts.begin(), counts.end(), offsets.begin(),
+                             static_cast<vtkIdType>(0));
+  for (vtkIdType c = 0; c < numChunks; ++c)
+  {
+    counts[c] = std::max(std::min(counts[c], numValues - offsets[c]),
+                         static_cast<vtkIdType>(0));
+  }
+  std::vector<vtkIdType> parsed(numChunks);
+  vtkASCIIParseChunks<T> parseChunks(bounds, offsets, counts, parsed, data);
+  vtkSMPTools::For(0, numChunks, 1, parseChunks);
+
+  // The values end at the first invalid token.
+  vtkIdType numParsed = 0;
+  for (vtkIdType c = 0; c < numChunks; ++c)
+  {
+    numParsed += parsed[c];
+    if (parsed[c] < counts[c])
+    {
+      break;
+    }
+  }
+  return numParsed;
+}
+
+//----------------------------------------------------------------------------
+template <typename T>
+vtkIdType vtkASCIIReadTokens(std::istream& is, T* data, vtkIdType numValues)
+{
+  std::string token;
+  vtkIdType n = 0;
+  while (n < numValues && is >> token)
+  {
+    if (!vtkASCIIConvert(token.data(), token.data() + token.size(), data[n]))
+    {
+      is.setstate(std::ios::failbit);
+      break;
+    }
+    ++n;
+  }
+  return n;
+}
+
+//----------------------------------------------------------------------------
+template <typename T>
+vtkIdType vtkASCIIRead(std::istream& is, T* data, vtkIdType numValues)
+{
+  std::streampos start = is.tellg();
+  if (start == std::streampos(-1))
+  {
+    return vtkASCIIReadTokens(is, data, numValues);
+  }
+
+  // Read blocks of text, the incomplete token at the end of a block is kept
+  // for the next one. The stream position of each block is remembered with
+  // tellg(), along with the number of characters read before it: with
+  // streams opened in text mode, line endings may be translated, so that
+  // stream offsets cannot be computed from numbers of characters.
+  std::vector<char> text;
+  std::vector<std::pair<std::streampos, std::streamoff> > blocks;
+  size_t blockSize = vtkASCIIMinimumBlockSize;
+  std::streamoff numRead = 0;
+  std::streamoff consumed = 0;
+  vtkIdType n = 0;
+  bool done = false;
+  while (!done && n < numValues)
+  {
+    blocks.push_back(std::make_pair(is.tellg(), numRead));
+    size_t kept = text.size();
+    text.resize(kept + blockSize);
+    is.read(text.data() + kept, blockSize);
+    size_t count = static_cast<size_t>(is.gcount());
+    numRead += static_cast<std::streamoff>(count);
+    text.resize(kept + count);
+    bool last = (count < blockSize);
+    blockSize = std::min(2 * blockSize, vtkASCIIMaximumBlockSize);
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    if (!last)
+    {
+      while (end != begin && !vtkASCIIIsSpace(end[-1]))
+      {
+        --end;
+      }
+    }
+
+    vtkIdType numTokens;
+    const char* stop = vtkASCIISkipTokens(begin, end, numValues - n,
+                                          numTokens);
+    vtkIdType numParsed = vtkASCIIParse(begin, stop, data + n, numTokens);
+    n += numParsed;
+    consumed += static_cast<std::streamoff>(stop - begin);
+    text.erase(text.begin(), text.begin() + (stop - begin));
+    done = last || numParsed < numTokens;
+  }
+
+  // Leave the stream right after the last value: go back to the block in
+  // which it ends and skip the characters consumed in that block.
+  is.clear();
+  size_t b = blocks.size();
+  while (b > 1 && blocks[b - 1].second > consumed)
+  {
+    --b;
+  }
+  if (b == 0)
+  {
+    is.seekg(start);
+  }
+  else
+  {
+    is.seekg(blocks[b - 1].first);
+    is.ignore(static_cast<std::streamsize>(consumed - blocks[b - 1].second));
+  }
+  if (n < numValues)
+  {
+    is.setstate(std::ios::failbit);
+  }
+  return n;
+}
+
+} // end anon namespace
+
+//----------------------------------------------------------------------------
+vtkIdType vtkASCIIArrayParser::Parse(const char* begin, const char* end,
+                                     int dataType, void* data,
+                                     vtkIdType numValues)
+{
+  switch (dataType)
+  {
+    vtkTemplateMacro(return vtkASCIIParse(begin, end,
+      static_cast<VTK_TT*>(data), numValues));
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkASCIIArrayParser::CountTokens(const char* begin, const char* end)
+{
+  vtkIdType count = 0;
+  bool inToken = false;
+  for (const char* p = begin; p != end; ++p)
+  {
+    bool isSpace = vtkASCIIIsSpace(*p);
+    count += (!isSpace && !inToken);
+    inToken = !isSpace;
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkASCIIArrayParser::Read(std::istream& is, int dataType,
+                                    void* data, vtkIdType numValues)
+{
+  switch (dataType)
+  {
+    vtkTemplateMacro(return vtkASCIIRead(is, static_cast<VTK_TT*>(data),
+                                         numValues));
+  }
+  return 0;
+}
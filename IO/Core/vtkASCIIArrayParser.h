@@ -0,0 +1,81 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkASCIIArrayParser.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class vtkASCIIArrayParser
+ * @brief Parse whitespace separated numbers into arrays
+ *
+ * vtkASCIIArrayParser converts the text of ASCII encoded arrays, such as the
+ * ones of the legacy VTK files and of the XML files in ascii format, to
+ * values of a VTK scalar type. It is meant to replace reading the values
+ * one at a time with istream::operator>>.
+ *
+ * Integers are converted directly and floating point numbers with the
+ * double-conversion library, so that the conversion is exact and does not
+ * depend on the current locale. "inf", "-inf" and "nan" are accepted in any
+ * case for the floating point types. Values of the char types are read as
+ * integers.
+ *
+ * Large texts are split at whitespace into chunks that are parsed in
+ * parallel with vtkSMPTools. Streams are read in large blocks.
+ *
+ * Typical use:
+ *
+ * @code{cpp}
+ *  #include "vtkASCIIArrayParser.h"
+ *  float* values = array->WritePointer(0, numValues);
+ *  if (vtkASCIIArrayParser::Read(is, VTK_FLOAT, values, numValues) < numValues)
+ *  {
+ *    // report the error
+ *  }
+ * @endcode
+ */
+#ifndef vtkASCIIArrayParser_h
+#define vtkASCIIArrayParser_h
+
+#include "vtkIOCoreModule.h" // For export macro
+#include "vtkType.h" // For vtkIdType
+
+#include <istream> // For istream
+
+class VTKIOCORE_EXPORT vtkASCIIArrayParser
+{
+public:
+  /**
+   * Convert at most numValues whitespace separated values from the text
+   * [begin, end) to values of the dataType VTK scalar type stored in data.
+   * The conversion stops at the first token that is not a valid value.
+   * Returns the number of values converted.
+   */
+  static vtkIdType Parse(const char* begin, const char* end, int dataType,
+                         void* data, vtkIdType numValues);
+
+  /**
+   * Returns the number of whitespace separated tokens of the text
+   * [begin, end).
+   */
+  static vtkIdType CountTokens(const char* begin, const char* end);
+
+  /**
+   * Read numValues values of the dataType VTK scalar type from the stream
+   * into data. On success, the stream is left right after the last value.
+   * Returns the number of values read, which is less than numValues on
+   * error. Streams that do not support seeking are read one token at a time.
+   */
+  static vtkIdType Read(std::istream& is, int dataType, void* data,
+                        vtkIdType numValues);
+};
+
+#endif
+// VTK-HeaderTest-Exclude: vtkASCIIArrayParser.h
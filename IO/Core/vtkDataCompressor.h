@@ -28,6 +28,12 @@
  * should be implemented with this in mind to provide a predictable
  * compressor interface for vtkDataCompressor users.
  *
+ * The four-argument Compress and Uncompress methods and
+ * GetMaximumCompressionSpace may be called concurrently from several threads
+ * on the same compressor, which vtkXMLWriter and vtkXMLDataParser rely on to
+ * process blocks in parallel. Subclasses must not modify their state in
+ * CompressBuffer and UncompressBuffer.
+ *
  * @pat Thanks:
  * Homogeneous CompressionLevel behavior contributed by Quincy Wofford
  * (qwofford@lanl.gov) and John Patchett (patchett@lanl.gov)
@@ -0,0 +1,280 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkZstdDataCompressor.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkZstdDataCompressor.h"
+#include "vtkObjectFactory.h"
+#include "vtk_zstd.h"
+
+#include <vector>
+
+vtkStandardNewMacro(vtkZstdDataCompressor);
+
+namespace
+{
+
+// zstd levels used for the vtkDataCompressor levels 1 to 9.
+const int vtkZstdLevels[9] = { 1, 2, 3, 5, 7, 9, 12, 16, 19 };
+
+// The compression and decompression contexts hold large work buffers, they
+// are reused by all the calls made from the same thread.
+struct vtkZstdContexts
+{
+  ZSTD_CCtx* Compression = nullptr;
+  ZSTD_DCtx* Decompression = nullptr;
+
+  ~vtkZstdContexts()
+  {
+    ZSTD_freeCCtx(this->Compression);
+    ZSTD_freeDCtx(this->Decompression);
+  }
+};
+
+vtkZstdContexts& vtkZstdGetContexts()
+{
+  static thread_local vtkZstdContexts contexts;
+  return contexts;
+}
+
+} // end anon namespace
+
+class vtkZstdDataCompressor::vtkInternals
+{
+public:
+  std::vector<unsigned char> Dictionary;
+  ZSTD_CDict* CompressionDictionary = nullptr;
+  ZSTD_DDict* DecompressionDictionary = nullptr;
+
+  void FreeDictionaries()
+  {
+    ZSTD_freeCDict(this->CompressionDictionary);
+    this->CompressionDictionary = nullptr;
+    ZSTD_freeDDict(this->DecompressionDictionary);
+    this->DecompressionDictionary = nullptr;
+  }
+};
+
+//----------------------------------------------------------------------------
+vtkZstdDataCompressor::vtkZstdDataCompressor()
+{
+  this->ZstdLevel = ZSTD_CLEVEL_DEFAULT;
+  this->Internals = new vtkInternals;
+}
+
+//----------------------------------------------------------------------------
+vtkZstdDataCompressor::~vtkZstdDataCompressor()
+{
+  this->Internals->FreeDictionaries();
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+void vtkZstdDataCompressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os,indent);
+
+  os << indent << "ZstdLevel: " << this->ZstdLevel << endl;
+  os << indent << "DictionarySize: " << this->Internals->Dictionary.size()
+     << endl;
+}
+
+//----------------------------------------------------------------------------
+size_t
+vtkZstdDataCompressor::CompressBuffer(unsigned char const* uncompressedData,
+                                      size_t uncompressedSize,
+                                      unsigned char* compressedData,
+                                      size_t compressionSpace)
+{
+  vtkZstdContexts& contexts = vtkZstdGetContexts();
+  if (!contexts.Compression)
+  {
+    contexts.Compression = ZSTD_createCCtx();
+  }
+
+  size_t cs;
+  if (this->Internals->CompressionDictionary)
+  {
+    cs = ZSTD_compress_usingCDict(contexts.Compression, compressedData,
+      compressionSpace, uncompressedData, uncompressedSize,
+      this->Internals->CompressionDictionary);
+  }
+  else
+  {
+    cs = ZSTD_compressCCtx(contexts.Compression, compressedData,
+      compressionSpace, uncompressedData, uncompressedSize, this->ZstdLevel);
+  }
+  if (ZSTD_isError(cs))
+  {
+    vtkErrorMacro("Zstd error while compressing data: "
+                  << ZSTD_getErrorName(cs));
+    return 0;
+  }
+  return cs;
+}
+
+//----------------------------------------------------------------------------
+size_t
+vtkZstdDataCompressor::UncompressBuffer(unsigned char const* compressedData,
+                                        size_t compressedSize,
+                                        unsigned char* uncompressedData,
+                                        size_t uncompressedSize)
+{
+  vtkZstdContexts& contexts = vtkZstdGetContexts();
+  if (!contexts.Decompression)
+  {
+    contexts.Decompression = ZSTD_createDCtx();
+  }
+
+  size_t us;
+  if (this->Internals->DecompressionDictionary)
+  {
+    us = ZSTD_decompress_usingDDict(contexts.Decompression, uncompressedData,
+      uncompressedSize, compressedData, compressedSize,
+      this->Internals->DecompressionDictionary);
+  }
+  else
+  {
+    us = ZSTD_decompressDCtx(contexts.Decompression, uncompressedData,
+      uncompressedSize, compressedData, compressedSize);
+  }
+  if (ZSTD_isError(us))
+  {
+    vtkErrorMacro("Zstd error while uncompressing data: "
+                  << ZSTD_getErrorName(us));
+    return 0;
+  }
+  // Make sure the output size matched that expected.
+  if (us != uncompressedSize)
+  {
+    vtkErrorMacro("Decompression produced incorrect size.\n"
+                  "Expected " << uncompressedSize << " and got " << us);
+    return 0;
+  }
+  return us;
+}
+
+//----------------------------------------------------------------------------
+int vtkZstdDataCompressor::GetCompressionLevel()
+{
+  int level = 1;
+  while (level < 9 && vtkZstdLevels[level - 1] < this->ZstdLevel)
+  {
+    ++level;
+  }
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): returning CompressionLevel " << level );
+  return level;
+}
+
+//----------------------------------------------------------------------------
+void vtkZstdDataCompressor::SetCompressionLevel(int compressionLevel)
+{
+  int min=1;
+  int max=9;
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): setting CompressionLevel to " << compressionLevel );
+  // In order to make an intuitive interface for vtkDataCompressor objects
+  // we accept compressionLevel values 1..9. 1 is fastest, 9 is slowest
+  // 1 is worst compression, 9 is best compression.
+  // Note: the whole zstd range is available through SetZstdLevel.
+  this->SetZstdLevel(vtkZstdLevels[
+    (compressionLevel<min?min:(compressionLevel>max?max:compressionLevel)) - 1]);
+}
+
+//----------------------------------------------------------------------------
+void vtkZstdDataCompressor::SetZstdLevel(int level)
+{
+  int min = ZSTD_minCLevel();
+  int max = ZSTD_maxCLevel();
+  level = (level<min?min:(level>max?max:level));
+  if (this->ZstdLevel != level)
+  {
+    this->ZstdLevel = level;
+    this->UpdateDictionaries();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkZstdDataCompressor::SetDictionary(const unsigned char* dictionary,
+                                          size_t size)
+{
+  if (dictionary && size > 0)
+  {
+    this->Internals->Dictionary.assign(dictionary, dictionary + size);
+  }
+  else
+  {
+    this->Internals->Dictionary.clear();
+  }
+  this->UpdateDictionaries();
+  this->Modified();
+}
+
+//----------------------------------------------------------------------------
+const unsigned char* vtkZstdDataCompressor::GetDictionary()
+{
+  return this->Internals->Dictionary.empty() ?
+    nullptr : this->Internals->Dictionary.data();
+}
+
+//----------------------------------------------------------------------------
+size_t vtkZstdDataCompressor::GetDictionarySize()
+{
+  return this->Internals->Dictionary.size();
+}
+
+//----------------------------------------------------------------------------
+int vtkZstdDataCompressor::TrainDictionary(const unsigned char* samples,
+                                           const size_t* sampleSizes,
+                                           unsigned int numberOfSamples,
+                                           size_t dictionaryCapacity)
+{
+  std::vector<unsigned char> dictionary(dictionaryCapacity);
+  size_t size = ZDICT_trainFromBuffer(dictionary.data(), dictionaryCapacity,
+    samples, sampleSizes, numberOfSamples);
+  if (ZDICT_isError(size))
+  {
+    vtkErrorMacro("Zstd error while training a dictionary: "
+                  << ZDICT_getErrorName(size));
+    return 0;
+  }
+  this->SetDictionary(dictionary.data(), size);
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkZstdDataCompressor::UpdateDictionaries()
+{
+  vtkInternals* internals = this->Internals;
+  internals->FreeDictionaries();
+  if (internals->Dictionary.empty())
+  {
+    return;
+  }
+  internals->CompressionDictionary = ZSTD_createCDict(
+    internals->Dictionary.data(), internals->Dictionary.size(),
+    this->ZstdLevel);
+  internals->DecompressionDictionary = ZSTD_createDDict(
+    internals->Dictionary.data(), internals->Dictionary.size());
+  if (!internals->CompressionDictionary || !internals->DecompressionDictionary)
+  {
+    vtkErrorMacro("Zstd error while loading the dictionary.");
+    internals->FreeDictionaries();
+  }
+}
+
+//----------------------------------------------------------------------------
+size_t
+vtkZstdDataCompressor::GetMaximumCompressionSpace(size_t size)
+{
+  return ZSTD_compressBound(size);
+}
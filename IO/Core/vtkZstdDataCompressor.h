@@ -0,0 +1,119 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkZstdDataCompressor.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkZstdDataCompressor
+ * @brief   Data compression using Zstandard.
+ *
+ * vtkZstdDataCompressor provides a concrete vtkDataCompressor class
+ * using Zstandard (zstd) for compressing and uncompressing data.
+ *
+ * The vtkDataCompressor compression levels 1 to 9 are mapped to zstd levels
+ * ranging from 1 to 19. The zstd level can also be set directly with
+ * SetZstdLevel(), which accepts the whole zstd range including the negative
+ * "fast" levels.
+ *
+ * A dictionary may be given with SetDictionary(), or trained from samples
+ * with TrainDictionary(). It greatly improves the compression of small
+ * blocks that share a common structure. Data compressed with a dictionary
+ * can only be uncompressed by a compressor using the same dictionary.
+*/
+
+#ifndef vtkZstdDataCompressor_h
+#define vtkZstdDataCompressor_h
+
+#include "vtkIOCoreModule.h" // For export macro
+#include "vtkDataCompressor.h"
+
+class VTKIOCORE_EXPORT vtkZstdDataCompressor : public vtkDataCompressor
+{
+public:
+  vtkTypeMacro(vtkZstdDataCompressor,vtkDataCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  static vtkZstdDataCompressor* New();
+
+  /**
+   *  Get the maximum space that may be needed to store data of the
+   *  given uncompressed size after compression.  This is the minimum
+   *  size of the output buffer that can be passed to the four-argument
+   *  Compress method.
+   */
+  size_t GetMaximumCompressionSpace(size_t size) override;
+  /**
+   *  Get/Set the compression level.
+   */
+  // Compression level getter required by vtkDataCompressor.
+  int GetCompressionLevel() override;
+
+  // Compression level setter required by vtkDataCompresor.
+  void SetCompressionLevel(int compressionLevel) override;
+
+  //@{
+  /**
+   * Direct setting of the zstd compression level, from the fastest
+   * negative levels up to the maximum zstd level (22).
+   */
+  void SetZstdLevel(int level);
+  vtkGetMacro(ZstdLevel, int);
+  //@}
+
+  //@{
+  /**
+   * Set the dictionary used to compress and uncompress the data. The
+   * dictionary is copied. Passing a null pointer or a zero size removes the
+   * dictionary.
+   */
+  void SetDictionary(const unsigned char* dictionary, size_t size);
+  const unsigned char* GetDictionary();
+  size_t GetDictionarySize();
+  //@}
+
+  /**
+   * Train a dictionary of at most dictionaryCapacity bytes from
+   * numberOfSamples samples stored one after the other in samples, and use
+   * it. Returns 1 on success, 0 otherwise.
+   */
+  int TrainDictionary(const unsigned char* samples, const size_t* sampleSizes,
+                      unsigned int numberOfSamples, size_t dictionaryCapacity);
+
+protected:
+  vtkZstdDataCompressor();
+  ~vtkZstdDataCompressor() override;
+
+  int ZstdLevel;
+
+  // Compression method required by vtkDataCompressor.
+  size_t CompressBuffer(unsigned char const* uncompressedData,
+                        size_t uncompressedSize,
+                        unsigned char* compressedData,
+                        size_t compressionSpace) override;
+  // Decompression method required by vtkDataCompressor.
+  size_t UncompressBuffer(unsigned char const* compressedData,
+                          size_t compressedSize,
+                          unsigned char* uncompressedData,
+                          size_t uncompressedSize) override;
+
+  // Digest the dictionary for the current level. The digested dictionaries
+  // are shared by all the threads compressing with this object.
+  void UpdateDictionaries();
+
+private:
+  vtkZstdDataCompressor(const vtkZstdDataCompressor&) = delete;
+  void operator=(const vtkZstdDataCompressor&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+#endif
@@ -14,6 +14,7 @@
 =========================================================================*/
 #include "vtkDataReader.h"
 
+#include "vtkASCIIArrayParser.h"
 #include "vtkBitArray.h"
 #include "vtkByteSwap.h"
 #include "vtkCellData.h"
@@ -48,6 +49,7 @@
 #include "vtkStringArray.h"
 #include "vtkTable.h"
 #include "vtkTypeInt64Array.h"
+#include "vtkTypeTraits.h"
 #include "vtkTypeUInt64Array.h"
 #include "vtkUnicodeStringArray.h"
 #include "vtkUnsignedCharArray.h"
@@ -1494,21 +1496,15 @@ int vtkReadBinaryData(istream *IS, T *data, vtkIdType numTuples, vtkIdType numCo
 
 // General templated function to read data of various types.
 template <class T>
-int vtkReadASCIIData(vtkDataReader *self, T *data, vtkIdType numTuples, vtkIdType numComp)
+int vtkReadASCIIData(istream *IS, T *data, vtkIdType numTuples, vtkIdType numComp)
 {
-  vtkIdType i, j;
-
-  for (i=0; i<numTuples; i++)
+  vtkIdType numValues = numTuples*numComp;
+  if (vtkASCIIArrayParser::Read(*IS, vtkTypeTraits<T>::VTK_TYPE_ID, data,
+                                numValues) < numValues)
   {
-    for (j=0; j<numComp; j++)
-    {
-      if ( !self->Read(data++) )
-      {
-        vtkGenericWarningMacro(<<"Error reading ascii data. Possible mismatch of "
-          "datasize with declaration.");
-        return 0;
-      }
-    }
+    vtkGenericWarningMacro(<<"Error reading ascii data. Possible mismatch of "
+      "datasize with declaration.");
+    return 0;
   }
   return 1;
 }
@@ -1580,7 +1576,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1595,7 +1591,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1611,7 +1607,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1627,7 +1623,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1644,7 +1640,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
     vtkIdType *ptr2 = ((vtkIdTypeArray *)array)->WritePointer(
       0,numTuples*numComp);
@@ -1667,7 +1663,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1683,7 +1679,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1707,7 +1703,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
 
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1727,7 +1723,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1744,7 +1740,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
 
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1761,7 +1757,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
 
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1777,7 +1773,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -1793,7 +1789,7 @@ vtkAbstractArray *vtkDataReader::ReadArray(const char *dataType, vtkIdType numTu
     }
     else
     {
-      vtkReadASCIIData(this, ptr, numTuples, numComp);
+      vtkReadASCIIData(this->IS, ptr, numTuples, numComp);
     }
   }
 
@@ -3154,7 +3150,6 @@ int vtkDataReader::ReadLutData(vtkDataSetAttributes *a)
 int vtkDataReader::ReadCells(vtkIdType size, int *data)
 {
   char line[256];
-  int i;
 
   if ( this->FileType == VTK_BINARY)
   {
@@ -3172,15 +3167,12 @@ int vtkDataReader::ReadCells(vtkIdType size, int *data)
   }
   else // ascii
   {
-    for (i=0; i<size; i++)
+    if (vtkASCIIArrayParser::Read(*this->IS, VTK_INT, data, size) < size)
     {
-      if (!this->Read(data+i))
-      {
-        const char* fname = this->CurrentFileName.c_str();
-        vtkErrorMacro(<<"Error reading ascii cell data!" << " for file: "
-                      << (fname?fname:"(Null FileName)"));
-        return 0;
-      }
+      const char* fname = this->CurrentFileName.c_str();
+      vtkErrorMacro(<<"Error reading ascii cell data!" << " for file: "
+                    << (fname?fname:"(Null FileName)"));
+      return 0;
     }
   }
 
@@ -3250,6 +3242,16 @@ int vtkDataReader::ReadCells(vtkIdType size, int *data,
     // delete the temporary array
     delete [] tmp;
   }
+  else if (skip1 == 0 && skip3 == 0) // ascii, all the cells
+  {
+    if (vtkASCIIArrayParser::Read(*this->IS, VTK_INT, data, size) < size)
+    {
+      const char* fname = this->CurrentFileName.c_str();
+      vtkErrorMacro(<<"Error reading ascii cell data!" << " for file: "
+                    << (fname?fname:"(Null FileName)"));
+      return 0;
+    }
+  }
   else // ascii
   {
     // skip cells before the piece
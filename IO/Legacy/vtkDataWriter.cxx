@@ -26,6 +26,7 @@
 #include "vtkFieldData.h"
 #include "vtkFloatArray.h"
 #include "vtkGraph.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationDoubleKey.h"
 #include "vtkInformationDoubleVectorKey.h"
@@ -64,8 +65,10 @@
 #include "vtkUnsignedShortArray.h"
 #include "vtkVariantArray.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <sstream>
+#include <vector>
 
 vtkStandardNewMacro(vtkDataWriter);
 
@@ -76,6 +79,94 @@ vtkStandardNewMacro(vtkDataWriter);
 #undef write
 #endif
 
+namespace
+{
+// Stream used when writing to the output string. The data is stored in
+// chunks of fixed size instead of a contiguous buffer, so that growing the
+// output does not reallocate and copy it.
+const size_t vtkDataWriterStringChunkSize = 1 << 20;
+
+class vtkDataWriterStringBuffer : public std::streambuf
+{
+public:
+  size_t GetSize() const
+  {
+    return this->Chunks.empty() ? 0 :
+      (this->Chunks.size() - 1) * vtkDataWriterStringChunkSize +
+      static_cast<size_t>(this->pptr() - this->pbase());
+  }
+
+  // Move the data to output, which must hold GetSize() characters. Each
+  // chunk is released once it is copied.
+  void MoveTo(char* output)
+  {
+    size_t size = this->GetSize();
+    for (size_t i = 0; i < this->Chunks.size(); ++i)
+    {
+      size_t count = std::min(size, vtkDataWriterStringChunkSize);
+      memcpy(output, this->Chunks[i].data(), count);
+      output += count;
+      size -= count;
+      std::vector<char>().swap(this->Chunks[i]);
+    }
+    this->Chunks.clear();
+    this->setp(nullptr, nullptr);
+  }
+
+protected:
+  int_type overflow(int_type c) override
+  {
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+    {
+      return traits_type::not_eof(c);
+    }
+    this->AddChunk();
+    *this->pptr() = traits_type::to_char_type(c);
+    this->pbump(1);
+    return c;
+  }
+
+  std::streamsize xsputn(const char* s, std::streamsize n) override
+  {
+    std::streamsize written = 0;
+    while (written < n)
+    {
+      if (this->pptr() == this->epptr())
+      {
+        this->AddChunk();
+      }
+      std::streamsize count = std::min(
+        n - written, static_cast<std::streamsize>(this->epptr() - this->pptr()));
+      memcpy(this->pptr(), s + written, static_cast<size_t>(count));
+      this->pbump(static_cast<int>(count));
+      written += count;
+    }
+    return written;
+  }
+
+private:
+  void AddChunk()
+  {
+    this->Chunks.emplace_back(vtkDataWriterStringChunkSize);
+    char* chunk = this->Chunks.back().data();
+    this->setp(chunk, chunk + vtkDataWriterStringChunkSize);
+  }
+
+  std::vector<std::vector<char> > Chunks;
+};
+
+class vtkDataWriterStringStream : public std::ostream
+{
+public:
+  vtkDataWriterStringStream() : std::ostream(nullptr)
+  {
+    this->rdbuf(&this->Buffer);
+  }
+
+  vtkDataWriterStringBuffer Buffer;
+};
+}
+
 // Created object with default header, ASCII format, and default names for
 // scalars, vectors, tensors, normals, and texture coordinates.
 vtkDataWriter::vtkDataWriter()
@@ -164,7 +255,7 @@ ostream *vtkDataWriter::OpenVTKFile()
     ///   static_cast<int> (500+ 1024 * input->GetActualMemorySize());
     /// this->OutputString = new char[this->OutputStringAllocatedLength];
 
-    fptr = new std::ostringstream;
+    fptr = new vtkDataWriterStringStream;
   }
   else
   {
@@ -968,25 +1059,97 @@ int vtkDataWriter::WriteRowData(ostream *fp, vtkTable *t)
 
 namespace
 {
-// Template to handle writing data in ascii or binary
-// We could change the format into C++ io standard ...
-template <class T>
-void vtkWriteDataArray(ostream *fp, T *data, int fileType,
-                       const char *format, vtkIdType num, vtkIdType numComp)
+// Values are converted and written in chunks of this many values, so that
+// the memory needed to write an array does not depend on its size.
+const vtkIdType vtkDataWriterChunkSize = 65536;
+
+// Copy the values [begin, end) of the array to buffer, converted to TOut.
+// aos is the array pointer when it has the standard memory layout.
+template <class T, class TOut>
+bool vtkCopyValues(vtkAbstractArray* array, const T* aos, vtkIdType begin,
+                   vtkIdType end, TOut* buffer)
 {
-  vtkIdType i, j, idx, sizeT;
-  char str[1024];
+  if (aos)
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      *buffer++ = static_cast<TOut>(aos[i]);
+    }
+    return true;
+  }
+  if (vtkSOADataArrayTemplate<T>* typedArray =
+      vtkSOADataArrayTemplate<T>::SafeDownCast(array))
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      *buffer++ = static_cast<TOut>(typedArray->GetValue(i));
+    }
+    return true;
+  }
+#ifdef VTK_USE_SCALED_SOA_ARRAYS
+  if (vtkScaledSOADataArrayTemplate<T>* typedScaleArray =
+      vtkScaledSOADataArrayTemplate<T>::SafeDownCast(array))
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      *buffer++ = static_cast<TOut>(typedScaleArray->GetValue(i));
+    }
+    return true;
+  }
+#endif
+  vtkGenericWarningMacro("Do not know how to handle array type " << array->GetClassName()
+                         << " in vtkDataWriter");
+  return false;
+}
+
+// Write numValues values of the array in binary, big endian, as TOut. The
+// values are swapped chunk by chunk in a buffer of fixed size.
+template <class T, class TOut>
+void vtkWriteBinaryValues(ostream *fp, vtkAbstractArray* array, const T* aos,
+                          vtkIdType numValues)
+{
+  std::vector<TOut> buffer(std::min(numValues, vtkDataWriterChunkSize));
+  for (vtkIdType begin = 0; begin < numValues; begin += vtkDataWriterChunkSize)
+  {
+    vtkIdType end = std::min(begin + vtkDataWriterChunkSize, numValues);
+    if (!vtkCopyValues(array, aos, begin, end, buffer.data()))
+    {
+      return;
+    }
+    size_t count = static_cast<size_t>(end - begin);
+    vtkByteSwap::SwapBERange(buffer.data(), count);
+    fp->write(reinterpret_cast<const char*>(buffer.data()),
+              count * sizeof(TOut));
+  }
+}
 
-  sizeT = sizeof(T);
+// Template to handle writing data in ascii or binary, the values of T are
+// written as TOut.
+// We could change the format into C++ io standard ...
+template <class T, class TOut = T>
+void vtkWriteDataArray(ostream *fp, vtkAbstractArray* array, bool isAOSArray,
+                       int fileType, const char *format, vtkIdType num,
+                       vtkIdType numComp)
+{
+  const T* aos = isAOSArray ?
+    static_cast<const T*>(array->GetVoidPointer(0)) : nullptr;
+  vtkIdType numValues = num*numComp;
 
   if ( fileType == VTK_ASCII )
   {
-    for (j=0; j<num; j++)
+    char str[1024];
+    std::vector<TOut> buffer(std::min(numValues, vtkDataWriterChunkSize));
+    for (vtkIdType begin = 0; begin < numValues;
+         begin += vtkDataWriterChunkSize)
     {
-      for (i=0; i<numComp; i++)
+      vtkIdType end = std::min(begin + vtkDataWriterChunkSize, numValues);
+      if (!vtkCopyValues(array, aos, begin, end, buffer.data()))
       {
-        idx = i + j*numComp;
-        snprintf (str, sizeof(str), format, *data++); *fp << str;
+        break;
+      }
+      for (vtkIdType idx = begin; idx < end; idx++)
+      {
+        snprintf (str, sizeof(str), format, buffer[idx - begin]); *fp << str;
         if ( !((idx+1)%9) )
         {
           *fp << "\n";
@@ -996,62 +1159,62 @@ void vtkWriteDataArray(ostream *fp, T *data, int fileType,
   }
   else
   {
-    if (num*numComp > 0)
-    {
-      // need to byteswap ??
-      switch (sizeT)
-      {
-        case 2:
-          // no typecast needed here; method call takes void* data
-          vtkByteSwap::SwapWrite2BERange(data, num*numComp, fp);
-          break;
-        case 4:
-          // no typecast needed here; method call takes void* data
-          vtkByteSwap::SwapWrite4BERange(data, num*numComp, fp);
-          break;
-        case 8:
-          // no typecast needed here; method call takes void* data
-          vtkByteSwap::SwapWrite8BERange(data, num*numComp, fp);
-          break;
-        default:
-          fp->write(reinterpret_cast<char*>(data), sizeof(T) * (num*numComp));
-          break;
-      }
-    }
+    vtkWriteBinaryValues<T, TOut>(fp, array, aos, numValues);
   }
   *fp << "\n";
 }
 
-// Returns a pointer to the data ordered in original VTK style ordering
-// of the data. If this is an SOA array it has to allocate the memory
-// for that in which case the calling function must delete it.
-template <class T>
-T* GetArrayRawPointer(vtkAbstractArray* array, T* ptr, int isAOSArray)
+// Write the cells in the legacy layout (npts, id0, id1, ...), with the ids
+// written as int, straight from the typed offsets and connectivity of the
+// cell array. Binary values are swapped and written chunk by chunk through
+// a buffer of fixed size, so that no legacy copy of the cells is made.
+struct vtkWriteCellsImpl
 {
-  if (isAOSArray)
+  template <typename CellStateT>
+  void operator()(CellStateT& state, ostream *fp, int fileType)
   {
-    return ptr;
-  }
-  if (vtkSOADataArrayTemplate<T>* typedArray =
-      vtkSOADataArrayTemplate<T>::SafeDownCast(array))
-  {
-    T* data = new T[array->GetNumberOfComponents()*array->GetNumberOfTuples()];
-    typedArray->ExportToVoidPointer(data);
-    return data;
-  }
-#ifdef VTK_USE_SCALED_SOA_ARRAYS
-  else if (vtkScaledSOADataArrayTemplate<T>* typedScaleArray =
-           vtkScaledSOADataArrayTemplate<T>::SafeDownCast(array))
-  {
-    T* data = new T[array->GetNumberOfComponents()*array->GetNumberOfTuples()];
-    typedScaleArray->ExportToVoidPointer(data);
-    return data;
+    const vtkIdType numCells = state.GetNumberOfCells();
+    if (fileType == VTK_ASCII)
+    {
+      for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+      {
+        const vtkIdType npts = state.GetCellSize(cellId);
+        const typename CellStateT::ValueType *pts =
+          state.GetCellPoints(cellId);
+        // currently writing vtkIdType as int
+        *fp << static_cast<int>(npts) << " ";
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          *fp << static_cast<int>(pts[j]) << " ";
+        }
+        *fp << "\n";
+      }
+      return;
+    }
+
+    std::vector<int> buffer(static_cast<size_t>(vtkDataWriterChunkSize));
+    size_t count = 0;
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      const vtkIdType npts = state.GetCellSize(cellId);
+      const typename CellStateT::ValueType *pts = state.GetCellPoints(cellId);
+      for (vtkIdType j = -1; j < npts; ++j)
+      {
+        buffer[count++] = static_cast<int>(j < 0 ? npts : pts[j]);
+        if (count == buffer.size())
+        {
+          vtkByteSwap::SwapBERange(buffer.data(), count);
+          fp->write(reinterpret_cast<const char*>(buffer.data()),
+                    count * sizeof(int));
+          count = 0;
+        }
+      }
+    }
+    vtkByteSwap::SwapBERange(buffer.data(), count);
+    fp->write(reinterpret_cast<const char*>(buffer.data()),
+              count * sizeof(int));
   }
-#endif
-  vtkGenericWarningMacro("Do not know how to handle array type " << array->GetClassName()
-                         << " in vtkDataWriter");
-  return nullptr;
-}
+};
 
 } // end anonymous namespace
 
@@ -1106,209 +1269,122 @@ int vtkDataWriter::WriteArray(ostream *fp, int dataType, vtkAbstractArray *data,
     case VTK_CHAR:
     {
       snprintf (str, sizeof(str), format, "char"); *fp << str;
-      char *s=GetArrayRawPointer(
-        data, static_cast<vtkCharArray *>(data)->GetPointer(0), isAOSArray);
 #if VTK_TYPE_CHAR_IS_SIGNED
-      vtkWriteDataArray(fp, s, this->FileType, "%hhd ", num, numComp);
+      vtkWriteDataArray<char>(fp, data, isAOSArray, this->FileType,
+        "%hhd ", num, numComp);
 #else
-      vtkWriteDataArray(fp, s, this->FileType, "%hhu ", num, numComp);
+      vtkWriteDataArray<char>(fp, data, isAOSArray, this->FileType,
+        "%hhu ", num, numComp);
 #endif
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
     }
     break;
 
     case VTK_SIGNED_CHAR:
     {
       snprintf (str, sizeof(str), format, "signed_char"); *fp << str;
-      signed char *s=GetArrayRawPointer(
-        data, static_cast<vtkSignedCharArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%hhd ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<signed char>(fp, data, isAOSArray, this->FileType,
+        "%hhd ", num, numComp);
     }
     break;
 
     case VTK_UNSIGNED_CHAR:
     {
       snprintf (str, sizeof(str), format, "unsigned_char"); *fp << str;
-      unsigned char *s=GetArrayRawPointer(
-        data, static_cast<vtkUnsignedCharArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%hhu ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<unsigned char>(fp, data, isAOSArray, this->FileType,
+        "%hhu ", num, numComp);
     }
     break;
 
     case VTK_SHORT:
     {
       snprintf (str, sizeof(str), format, "short"); *fp << str;
-      short *s=GetArrayRawPointer(
-        data, static_cast<vtkShortArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%hd ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<short>(fp, data, isAOSArray, this->FileType,
+        "%hd ", num, numComp);
     }
     break;
 
     case VTK_UNSIGNED_SHORT:
     {
       snprintf (str, sizeof(str), format, "unsigned_short"); *fp << str;
-      unsigned short *s=GetArrayRawPointer(
-        data, static_cast<vtkUnsignedShortArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%hu ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<unsigned short>(fp, data, isAOSArray, this->FileType,
+        "%hu ", num, numComp);
     }
     break;
 
     case VTK_INT:
     {
       snprintf (str, sizeof(str), format, "int"); *fp << str;
-      int *s=GetArrayRawPointer(
-        data, static_cast<vtkIntArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%d ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<int>(fp, data, isAOSArray, this->FileType,
+        "%d ", num, numComp);
     }
     break;
 
     case VTK_UNSIGNED_INT:
     {
       snprintf (str, sizeof(str), format, "unsigned_int"); *fp << str;
-      unsigned int *s=GetArrayRawPointer(
-        data, static_cast<vtkUnsignedIntArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%u ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<unsigned int>(fp, data, isAOSArray, this->FileType,
+        "%u ", num, numComp);
     }
     break;
 
     case VTK_LONG:
     {
       snprintf (str, sizeof(str), format, "long"); *fp << str;
-      long *s=GetArrayRawPointer(
-        data, static_cast<vtkLongArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%ld ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<long>(fp, data, isAOSArray, this->FileType,
+        "%ld ", num, numComp);
     }
     break;
 
     case VTK_UNSIGNED_LONG:
     {
       snprintf (str, sizeof(str), format, "unsigned_long"); *fp << str;
-      unsigned long *s=GetArrayRawPointer(
-        data, static_cast<vtkUnsignedLongArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%lu ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<unsigned long>(fp, data, isAOSArray, this->FileType,
+        "%lu ", num, numComp);
     }
     break;
 
     case VTK_LONG_LONG:
     {
       snprintf (str, sizeof(str), format, "vtktypeint64"); *fp << str;
-      long long *s=GetArrayRawPointer(
-        data, static_cast<vtkTypeInt64Array *>(data)->GetPointer(0), isAOSArray);
       strcpy(outputFormat, vtkTypeTraits<long long>::ParseFormat());
       strcat(outputFormat, " ");
-      vtkWriteDataArray(fp, s, this->FileType, outputFormat, num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<long long>(fp, data, isAOSArray, this->FileType,
+        outputFormat, num, numComp);
     }
     break;
 
     case VTK_UNSIGNED_LONG_LONG:
     {
       snprintf (str, sizeof(str), format, "vtktypeuint64"); *fp << str;
-      unsigned long long *s=GetArrayRawPointer(
-        data, static_cast<vtkTypeUInt64Array *>(data)->GetPointer(0), isAOSArray);
       strcpy(outputFormat, vtkTypeTraits<unsigned long long>::ParseFormat());
       strcat(outputFormat, " ");
-      vtkWriteDataArray(fp, s, this->FileType, outputFormat, num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<unsigned long long>(fp, data, isAOSArray, this->FileType,
+        outputFormat, num, numComp);
     }
     break;
 
     case VTK_FLOAT:
     {
       snprintf (str, sizeof(str), format, "float"); *fp << str;
-      float *s=GetArrayRawPointer(
-        data, static_cast<vtkFloatArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%g ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<float>(fp, data, isAOSArray, this->FileType,
+        "%g ", num, numComp);
     }
     break;
 
     case VTK_DOUBLE:
     {
       snprintf (str, sizeof(str), format, "double"); *fp << str;
-      double *s=GetArrayRawPointer(
-        data, static_cast<vtkDoubleArray *>(data)->GetPointer(0), isAOSArray);
-      vtkWriteDataArray(fp, s, this->FileType, "%.11lg ", num, numComp);
-      if (!isAOSArray)
-      {
-        delete [] s;
-      }
+      vtkWriteDataArray<double>(fp, data, isAOSArray, this->FileType,
+        "%.11lg ", num, numComp);
     }
     break;
 
     case VTK_ID_TYPE:
     {
       // currently writing vtkIdType as int.
-      vtkIdType size = data->GetNumberOfTuples();
-      std::vector<int> intArray(size*numComp);
       snprintf (str, sizeof(str), format, "vtkIdType"); *fp << str;
-      if (isAOSArray)
-      {
-        vtkIdType *s=static_cast<vtkIdTypeArray *>(data)->GetPointer(0);
-        for (vtkIdType jj = 0; jj < size*numComp; jj++)
-        {
-          intArray[jj] = s[jj];
-        }
-      }
-      else
-      {
-        vtkSOADataArrayTemplate<vtkIdType>* data2=
-          static_cast<vtkSOADataArrayTemplate<vtkIdType> *>(data);
-        std::vector<vtkIdType> vals(numComp);
-        for (vtkIdType jj = 0; jj < size; jj++)
-        {
-          data2->GetTypedTuple(jj, &vals[0]);
-          for (i = 0; i < numComp; i++)
-          {
-            intArray[jj*numComp+i] = vals[i];
-          }
-        }
-      }
-      vtkWriteDataArray(fp, &intArray[0], this->FileType, "%d ", num, numComp);
+      vtkWriteDataArray<vtkIdType, int>(fp, data, isAOSArray, this->FileType,
+        "%d ", num, numComp);
     }
     break;
 
@@ -2193,39 +2269,35 @@ int vtkDataWriter::WriteCells(ostream *fp, vtkCellArray *cells, const char *labe
 
   *fp << label << " " << ncells << " " << size << "\n";
 
-  if ( this->FileType == VTK_ASCII )
+  if ( cells->IsLegacyDataPending() )
   {
-    vtkIdType j;
-    vtkIdType *pts = nullptr;
-    vtkIdType npts = 0;
-    for (cells->InitTraversal(); cells->GetNextCell(npts,pts); )
+    // The cells are only available in the legacy layout (see
+    // vtkCellArray::GetData()): write them from there rather than importing
+    // them, so that the input is left untouched.
+    vtkIdTypeArray *data = cells->GetData();
+    if ( this->FileType == VTK_ASCII )
     {
-      // currently writing vtkIdType as int
-      *fp << static_cast<int>(npts) << " ";
-      for (j=0; j<npts; j++)
+      const vtkIdType *legacy = data->GetPointer(0);
+      for (vtkIdType loc = 0; loc < size; loc += legacy[loc] + 1)
       {
         // currently writing vtkIdType as int
-        *fp << static_cast<int>(pts[j]) << " ";
+        for (vtkIdType j = 0; j <= legacy[loc]; ++j)
+        {
+          *fp << static_cast<int>(legacy[loc + j]) << " ";
+        }
+        *fp << "\n";
       }
-      *fp << "\n";
+    }
+    else
+    {
+      // currently writing vtkIdType as int
+      vtkWriteBinaryValues<vtkIdType, int>(fp, data, data->GetPointer(0),
+                                           size);
     }
   }
   else
   {
-    // swap the bytes if necessary
-    // currently writing vtkIdType as int
-    vtkIdType *tempArray = cells->GetPointer();
-    int arraySize = cells->GetNumberOfConnectivityEntries();
-    int *intArray = new int[arraySize];
-    int i;
-
-    for (i = 0; i < arraySize; i++)
-    {
-      intArray[i] = tempArray[i];
-    }
-
-    vtkByteSwap::SwapWrite4BERange(intArray,size,fp);
-    delete [] intArray;
+    cells->Visit(vtkWriteCellsImpl{}, fp, this->FileType);
   }
 
   *fp << "\n";
@@ -2257,10 +2329,10 @@ void vtkDataWriter::CloseVTKFile(ostream *fp)
   {
     if (this->WriteToOutputString)
     {
-      std::ostringstream *ostr =
-        static_cast<std::ostringstream*>(fp);
+      vtkDataWriterStringBuffer& buffer =
+        static_cast<vtkDataWriterStringStream*>(fp)->Buffer;
       delete [] this->OutputString;
-      const size_t strlength = ostr->str().size();
+      const size_t strlength = buffer.GetSize();
       if (strlength > static_cast<size_t>(vtkTypeTraits<vtkIdType>::Max()))
       {
         this->OutputString = nullptr;
@@ -2274,8 +2346,9 @@ void vtkDataWriter::CloseVTKFile(ostream *fp)
       {
         this->OutputStringLength = static_cast<vtkIdType>(strlength);
         this->OutputString = new char[strlength + 1];
+        buffer.MoveTo(this->OutputString);
+        this->OutputString[strlength] = '\0';
       }
-      memcpy(this->OutputString, ostr->str().c_str(), this->OutputStringLength + 1);
     }
     delete fp;
   }
@@ -78,6 +78,8 @@ public:
    * When WriteToOutputString in on, then a string is allocated, written to,
    * and can be retrieved with these methods.  The string is deleted during
    * the next call to write ...
+   * The output is accumulated in chunks of fixed size and moved to the
+   * string when writing ends, so that the string is never reallocated.
    */
   vtkGetMacro(OutputStringLength, vtkIdType);
   vtkGetStringMacro(OutputString);
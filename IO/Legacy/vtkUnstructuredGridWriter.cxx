@@ -40,7 +40,7 @@ void vtkUnstructuredGridWriter::WriteData()
   ostream *fp;
   vtkUnstructuredGrid *input= vtkUnstructuredGrid::SafeDownCast(
     this->GetInput());
-  int *types, ncells, cellId;
+  vtkIdType ncells, cellId;
 
   vtkDebugMacro(<<"Writing vtk unstructured grid data...");
 
@@ -107,27 +107,33 @@ void vtkUnstructuredGridWriter::WriteData()
   if ( input->GetCells() )
   {
     ncells = input->GetCells()->GetNumberOfCells();
-    types = new int[ncells];
-    for (cellId=0; cellId < ncells; cellId++)
-    {
-      types[cellId] = input->GetCellType(cellId);
-    }
 
     *fp << "CELL_TYPES " << ncells << "\n";
     if ( this->FileType == VTK_ASCII )
     {
       for (cellId=0; cellId<ncells; cellId++)
       {
-        *fp << types[cellId] << "\n";
+        *fp << input->GetCellType(cellId) << "\n";
       }
     }
     else
     {
-      // swap the bytes if necessary
-      vtkByteSwap::SwapWrite4BERange(types,ncells,fp);
+      // swap the bytes if necessary, a chunk of types at a time
+      const vtkIdType chunkSize = 65536;
+      std::vector<int> types(std::min(ncells, chunkSize));
+      for (vtkIdType begin = 0; begin < ncells; begin += chunkSize)
+      {
+        vtkIdType end = std::min(begin + chunkSize, ncells);
+        for (cellId = begin; cellId < end; cellId++)
+        {
+          types[cellId - begin] = input->GetCellType(cellId);
+        }
+        vtkByteSwap::SwapBERange(types.data(), end - begin);
+        fp->write(reinterpret_cast<const char*>(types.data()),
+                  (end - begin) * sizeof(int));
+      }
     }
     *fp << "\n";
-    delete [] types;
   }
 
   if (!this->WriteCellData(fp, input))
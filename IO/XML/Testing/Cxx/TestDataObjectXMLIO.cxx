@@ -475,7 +475,8 @@ public:
                           &vtkXMLDataObjectWriter::SetCompressorType,
                           "NONE", vtkXMLWriter::NONE,
                           "ZLIB", vtkXMLWriter::ZLIB,
-                          "LZ4", vtkXMLWriter::LZ4);
+                          "LZ4", vtkXMLWriter::LZ4,
+                          "ZSTD", vtkXMLWriter::ZSTD);
     this->AddOptionValues("DataMode", &vtkXMLDataObjectWriter::SetDataMode,
                           "Ascii", vtkXMLWriter::Ascii,
                           "Binary", vtkXMLWriter::Binary,
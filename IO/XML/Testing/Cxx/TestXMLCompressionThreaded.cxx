@@ -0,0 +1,178 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLCompressionThreaded.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the XML writer compresses its blocks in parallel into exactly
+// the bytes of the sequential writer, and that the reader uncompresses them
+// in parallel into the data that was written. Small blocks are used so that
+// each array spans many batches of blocks, the last one being partial. All
+// the files, also the uncompressed one, must read back the input, and the
+// compressed files must be smaller than the uncompressed one.
+
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkXMLPolyDataReader.h"
+#include "vtkXMLPolyDataWriter.h"
+
+#include <cmath>
+#include <string>
+
+namespace
+{
+
+std::string Write(vtkPolyData* input, int compressorType, int dataMode)
+{
+  vtkNew<vtkXMLPolyDataWriter> writer;
+  writer->SetInputData(input);
+  writer->SetCompressorType(compressorType);
+  writer->SetBlockSize(1024);
+  writer->SetDataMode(dataMode);
+  writer->SetEncodeAppendedData(0);
+  writer->WriteToOutputStringOn();
+  writer->Write();
+  return writer->GetOutputString();
+}
+
+vtkSmartPointer<vtkPolyData> Read(const std::string& input)
+{
+  vtkNew<vtkXMLPolyDataReader> reader;
+  reader->ReadFromInputStringOn();
+  reader->SetInputString(input);
+  reader->Update();
+  return reader->GetOutput();
+}
+
+bool SameValues(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues() ||
+      a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// The points and the point arrays of the input, and its polygons.
+bool SameData(vtkPolyData* output, vtkPolyData* input)
+{
+  vtkPointData* outPD = output->GetPointData();
+  vtkPointData* inPD = input->GetPointData();
+  vtkIdTypeArray* outPolys = output->GetPolys()->GetData();
+  vtkIdTypeArray* inPolys = input->GetPolys()->GetData();
+  return output->GetNumberOfPoints() == input->GetNumberOfPoints() &&
+    SameValues(output->GetPoints()->GetData(), input->GetPoints()->GetData()) &&
+    SameValues(outPD->GetNormals(), inPD->GetNormals()) &&
+    SameValues(outPD->GetArray("Values"), inPD->GetArray("Values")) &&
+    SameValues(outPD->GetArray("Ids"), inPD->GetArray("Ids")) &&
+    SameValues(outPolys, inPolys);
+}
+
+}
+
+int TestXMLCompressionThreaded(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(100);
+  sphere->SetPhiResolution(100);
+  sphere->Update();
+  vtkNew<vtkPolyData> input;
+  input->DeepCopy(sphere->GetOutput());
+
+  // Arrays compressing more or less well, so that the blocks have different
+  // compressed sizes.
+  vtkIdType numPts = input->GetNumberOfPoints();
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  values->SetNumberOfTuples(numPts);
+  vtkNew<vtkIntArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfTuples(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    values->SetValue(i, sin(0.37 * i) * cos(0.011 * i));
+    ids->SetValue(i, static_cast<int>(i / 7));
+  }
+  input->GetPointData()->AddArray(values);
+  input->GetPointData()->AddArray(ids);
+
+  const int compressorTypes[3] = { vtkXMLWriter::LZ4, vtkXMLWriter::ZLIB,
+    vtkXMLWriter::LZMA };
+  const int dataModes[2] = { vtkXMLWriter::Binary, vtkXMLWriter::Appended };
+  for (int dataMode : dataModes)
+  {
+    std::string uncompressed = Write(input, vtkXMLWriter::NONE, dataMode);
+    if (!SameData(Read(uncompressed), input))
+    {
+      cerr << "Wrong data read without compression in data mode " << dataMode
+           << endl;
+      return EXIT_FAILURE;
+    }
+    for (int compressorType : compressorTypes)
+    {
+      std::string file;
+      std::string threadedFile;
+      vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"), [&]() {
+        file = Write(input, compressorType, dataMode);
+      });
+      vtkSMPTools::LocalScope(vtkSMPTools::Config(4), [&]() {
+        threadedFile = Write(input, compressorType, dataMode);
+      });
+      if (file != threadedFile)
+      {
+        cerr << "Different files written with compressor " << compressorType
+             << " in data mode " << dataMode << endl;
+        return EXIT_FAILURE;
+      }
+      if (file.size() >= uncompressed.size())
+      {
+        cerr << "File not compressed with compressor " << compressorType
+             << " in data mode " << dataMode << endl;
+        return EXIT_FAILURE;
+      }
+
+      vtkSmartPointer<vtkPolyData> output;
+      vtkSmartPointer<vtkPolyData> threadedOutput;
+      vtkSMPTools::LocalScope(vtkSMPTools::Config("Sequential"),
+                              [&]() { output = Read(file); });
+      vtkSMPTools::LocalScope(vtkSMPTools::Config(4),
+                              [&]() { threadedOutput = Read(file); });
+      if (!SameData(output, input) || !SameData(threadedOutput, input))
+      {
+        cerr << "Wrong data read with compressor " << compressorType
+             << " in data mode " << dataMode << endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
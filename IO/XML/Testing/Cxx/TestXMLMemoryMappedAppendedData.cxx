@@ -0,0 +1,160 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLMemoryMappedAppendedData.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that the arrays of raw appended data are read from a memory mapped
+// file, and that they have the values of the file, outlive the reader and do
+// not write to the file.
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkXMLImageDataReader.h"
+#include "vtkXMLImageDataWriter.h"
+
+#include <string>
+
+namespace
+{
+
+vtkSmartPointer<vtkImageData> ReadImage(const std::string& fileName,
+                                        bool memoryMap, vtkIdType& numMapped)
+{
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->SetMemoryMapAppendedData(memoryMap);
+  reader->Update();
+  numMapped = reader->GetNumberOfMappedArrays();
+  return reader->GetOutput();
+}
+
+bool SameValues(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues() ||
+      a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestXMLMemoryMappedAppendedData(int argc, char* argv[])
+{
+  char* tempDir = vtkTestUtilities::GetArgOrEnvOrDefault(
+    "-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory." << endl;
+    return EXIT_FAILURE;
+  }
+  std::string fileName = tempDir;
+  delete [] tempDir;
+  fileName += "/TestXMLMemoryMappedAppendedData.vti";
+
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(23, 17, 11);
+  vtkIdType numPoints = image->GetNumberOfPoints();
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(numPoints);
+  vtkNew<vtkFloatArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(numPoints);
+  vtkNew<vtkIntArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfTuples(numPoints);
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    scalars->SetValue(i, 0.5 * i);
+    vectors->SetTuple3(i, i, -i, 2 * i);
+    ids->SetValue(i, static_cast<int>(numPoints - i));
+  }
+  image->GetPointData()->AddArray(scalars);
+  image->GetPointData()->AddArray(vectors);
+  image->GetPointData()->AddArray(ids);
+
+  vtkNew<vtkXMLImageDataWriter> writer;
+  writer->SetInputData(image);
+  writer->SetFileName(fileName.c_str());
+  writer->SetDataModeToAppended();
+  writer->EncodeAppendedDataOff();
+  writer->SetCompressorTypeToNone();
+  if (!writer->Write())
+  {
+    cerr << "Could not write " << fileName << endl;
+    return EXIT_FAILURE;
+  }
+
+  // All the arrays are mapped, and remain valid once the reader is gone.
+  vtkIdType numMapped = 0;
+  vtkSmartPointer<vtkImageData> mapped = ReadImage(fileName, true, numMapped);
+  if (numMapped != 3)
+  {
+    cerr << numMapped << " arrays mapped instead of 3." << endl;
+    return EXIT_FAILURE;
+  }
+  const char* names[3] = { "Scalars", "Vectors", "Ids" };
+  for (int i = 0; i < 3; ++i)
+  {
+    if (!SameValues(mapped->GetPointData()->GetArray(names[i]),
+                    image->GetPointData()->GetArray(names[i])))
+    {
+      cerr << "Wrong values for the mapped " << names[i] << " array." << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Changes to the mapped arrays are private.
+  vtkDataArray* mappedScalars = mapped->GetPointData()->GetArray("Scalars");
+  mappedScalars->SetComponent(0, 0, -1.0);
+  vtkSmartPointer<vtkImageData> read = ReadImage(fileName, false, numMapped);
+  if (numMapped != 0)
+  {
+    cerr << "Arrays mapped although memory mapping is off." << endl;
+    return EXIT_FAILURE;
+  }
+  if (!SameValues(read->GetPointData()->GetArray("Scalars"), scalars) ||
+      mappedScalars->GetComponent(0, 0) != -1.0)
+  {
+    cerr << "Writing to a mapped array changed the file." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Resizing copies the values out of the mapping.
+  mappedScalars->Resize(2 * numPoints);
+  if (mappedScalars->GetComponent(numPoints - 1, 0) != 0.5 * (numPoints - 1))
+  {
+    cerr << "Wrong values after resizing a mapped array." << endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
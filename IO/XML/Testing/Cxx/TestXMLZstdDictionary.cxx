@@ -0,0 +1,132 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    TestXMLZstdDictionary.cxx
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Check that data compressed by the XML writer with a zstd dictionary are
+// read back: the dictionary is stored in the file and used by the reader.
+
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkXMLPolyDataReader.h"
+#include "vtkXMLPolyDataWriter.h"
+#include "vtkZstdDataCompressor.h"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::string Write(vtkPolyData* input, const std::vector<unsigned char>& dict,
+                  int dataMode)
+{
+  vtkNew<vtkZstdDataCompressor> compressor;
+  compressor->SetDictionary(dict.data(), dict.size());
+  vtkNew<vtkXMLPolyDataWriter> writer;
+  writer->SetInputData(input);
+  writer->SetCompressor(compressor);
+  writer->SetBlockSize(1024);
+  writer->SetDataMode(dataMode);
+  writer->WriteToOutputStringOn();
+  writer->Write();
+  return writer->GetOutputString();
+}
+
+bool SameValues(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetNumberOfValues() != b->GetNumberOfValues() ||
+      a->GetNumberOfComponents() != b->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < a->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < a->GetNumberOfComponents(); ++c)
+    {
+      if (a->GetComponent(i, c) != b->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}
+
+int TestXMLZstdDictionary(int, char*[])
+{
+  const vtkIdType numPts = 5000;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  vtkNew<vtkIntArray> ids;
+  ids->SetName("Ids");
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    points->InsertNextPoint(cos(0.01 * i), sin(0.01 * i), 0.001 * i);
+    verts->InsertNextCell(1, &i);
+    values->InsertNextValue(sin(0.37 * i) * cos(0.011 * i));
+    ids->InsertNextValue(static_cast<int>(i / 7));
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->SetVerts(verts);
+  input->GetPointData()->AddArray(values);
+  input->GetPointData()->AddArray(ids);
+
+  // A raw content dictionary: the first values of the arrays.
+  std::vector<unsigned char> dict;
+  const unsigned char* bytes =
+    static_cast<const unsigned char*>(values->GetVoidPointer(0));
+  dict.insert(dict.end(), bytes, bytes + 1024);
+  bytes = static_cast<const unsigned char*>(ids->GetVoidPointer(0));
+  dict.insert(dict.end(), bytes, bytes + 1024);
+
+  const int dataModes[2] = { vtkXMLWriter::Binary, vtkXMLWriter::Appended };
+  for (int dataMode : dataModes)
+  {
+    std::string file = Write(input, dict, dataMode);
+    if (file.find("compressor_dictionary=\"") == std::string::npos ||
+        file == Write(input, std::vector<unsigned char>(), dataMode))
+    {
+      cerr << "Dictionary not used in data mode " << dataMode << endl;
+      return EXIT_FAILURE;
+    }
+
+    vtkNew<vtkXMLPolyDataReader> reader;
+    reader->ReadFromInputStringOn();
+    reader->SetInputString(file);
+    reader->Update();
+    vtkPolyData* output = reader->GetOutput();
+    if (output->GetNumberOfPoints() != numPts ||
+        !SameValues(output->GetPoints()->GetData(), points->GetData()) ||
+        !SameValues(output->GetPointData()->GetArray("Values"), values) ||
+        !SameValues(output->GetPointData()->GetArray("Ids"), ids))
+    {
+      cerr << "Wrong data read in data mode " << dataMode << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -15,6 +15,7 @@
 #include "vtkXMLReader.h"
 
 #include "vtkArrayIteratorIncludes.h"
+#include "vtkBase64Utilities.h"
 #include "vtkCallbackCommand.h"
 #include "vtkDataArray.h"
 #include "vtkDataArraySelection.h"
@@ -43,20 +44,155 @@
 #include "vtkXMLFileReadTester.h"
 #include "vtkXMLReaderVersion.h"
 #include "vtkZLibDataCompressor.h"
+#include "vtkZstdDataCompressor.h"
 
+#include <vtksys/Encoding.hxx>
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
 #include <cassert>
 #include <functional>
 #include <locale> // C++ locale
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <vector>
 #include <cctype>
 
+#if defined(_WIN32) && !defined(__CYGWIN__)
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
 vtkCxxSetObjectMacro(vtkXMLReader,ReaderErrorObserver,vtkCommand);
 vtkCxxSetObjectMacro(vtkXMLReader,ParserErrorObserver,vtkCommand);
 
+namespace
+{
+//----------------------------------------------------------------------------
+// A private, copy-on-write mapping of a whole file.
+class vtkXMLMappedFile
+{
+public:
+  static std::shared_ptr<vtkXMLMappedFile> Map(const char* fileName)
+  {
+    std::shared_ptr<vtkXMLMappedFile> file(new vtkXMLMappedFile);
+#if defined(_WIN32) && !defined(__CYGWIN__)
+    HANDLE handle = CreateFileW(
+      vtksys::Encoding::ToWindowsExtendedPath(fileName).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+      return nullptr;
+    }
+    LARGE_INTEGER length;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(handle, &length) && length.QuadPart > 0)
+    {
+      mapping = CreateFileMappingW(handle, nullptr, PAGE_WRITECOPY, 0, 0,
+                                   nullptr);
+    }
+    CloseHandle(handle);
+    if (!mapping)
+    {
+      return nullptr;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+    {
+      return nullptr;
+    }
+    file->Length = static_cast<size_t>(length.QuadPart);
+#else
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+    {
+      return nullptr;
+    }
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+      data = mmap(nullptr, static_cast<size_t>(st.st_size),
+                  PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      return nullptr;
+    }
+    file->Length = static_cast<size_t>(st.st_size);
+#endif
+    file->Data = static_cast<unsigned char*>(data);
+    return file;
+  }
+
+  ~vtkXMLMappedFile()
+  {
+#if defined(_WIN32) && !defined(__CYGWIN__)
+    UnmapViewOfFile(this->Data);
+#else
+    munmap(this->Data, this->Length);
+#endif
+  }
+
+  unsigned char* Data = nullptr;
+  size_t Length = 0;
+
+private:
+  vtkXMLMappedFile() = default;
+  vtkXMLMappedFile(const vtkXMLMappedFile&) = delete;
+  void operator=(const vtkXMLMappedFile&) = delete;
+};
+
+//----------------------------------------------------------------------------
+// The mapped files referenced by arrays, indexed by the array values.  The
+// free function of an array only receives its values.  This is never
+// destroyed, since arrays may be released during static destruction.
+struct vtkXMLMappedArrays
+{
+  std::mutex Mutex;
+  std::multimap<void*, std::shared_ptr<vtkXMLMappedFile> > Files;
+};
+
+vtkXMLMappedArrays& vtkXMLGetMappedArrays()
+{
+  static vtkXMLMappedArrays* arrays = new vtkXMLMappedArrays;
+  return *arrays;
+}
+
+void vtkXMLReleaseMappedArray(void* data)
+{
+  vtkXMLMappedArrays& arrays = vtkXMLGetMappedArrays();
+  std::shared_ptr<vtkXMLMappedFile> file;
+  {
+    std::lock_guard<std::mutex> lock(arrays.Mutex);
+    auto iter = arrays.Files.find(data);
+    if (iter != arrays.Files.end())
+    {
+      // Unmap outside of the lock.
+      file = std::move(iter->second);
+      arrays.Files.erase(iter);
+    }
+  }
+}
+
+} // end anon namespace
+
+class vtkXMLReaderMappedFile
+{
+public:
+  std::shared_ptr<vtkXMLMappedFile> File;
+  // Whether mapping the file failed, in which case the arrays are read.
+  bool Failed = false;
+};
+
 //-----------------------------------------------------------------------------
 #define CaseIdTypeMacro(type, size) \
 case type: \
@@ -135,6 +271,9 @@ vtkXMLReader::vtkXMLReader()
   this->StringStream = nullptr;
   this->ReadFromInputString = 0;
   this->InputString = "";
+  this->MemoryMapAppendedData = 0;
+  this->NumberOfMappedArrays = 0;
+  this->MappedFile = new vtkXMLReaderMappedFile;
   this->XMLParser = nullptr;
   this->ReaderErrorObserver = nullptr;
   this->ParserErrorObserver = nullptr;
@@ -208,6 +347,7 @@ vtkXMLReader::~vtkXMLReader()
     this->ParserErrorObserver->Delete();
   }
   delete[] this->TimeSteps;
+  delete this->MappedFile;
 }
 
 //----------------------------------------------------------------------------
@@ -230,6 +370,10 @@ void vtkXMLReader::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Stream: (none)\n";
   }
+  os << indent << "MemoryMapAppendedData: " << this->MemoryMapAppendedData
+     << "\n";
+  os << indent << "NumberOfMappedArrays: " << this->NumberOfMappedArrays
+     << "\n";
   os << indent << "TimeStep:" << this->TimeStep << "\n";
   os << indent << "NumberOfTimeSteps:" << this->NumberOfTimeSteps << "\n";
   os << indent << "TimeStepRange:(" << this->TimeStepRange[0] << ","
@@ -360,6 +504,9 @@ int vtkXMLReader::OpenVTKString()
 //----------------------------------------------------------------------------
 void vtkXMLReader::CloseStream()
 {
+  // The arrays referencing the mapped file keep it alive.
+  this->MappedFile->File.reset();
+  this->MappedFile->Failed = false;
   if (this->Stream)
   {
     if (this->ReadFromInputString)
@@ -431,7 +578,7 @@ void vtkXMLReader::DestroyXMLParser()
 }
 
 //----------------------------------------------------------------------------
-void vtkXMLReader::SetupCompressor(const char* type)
+void vtkXMLReader::SetupCompressor(const char* type, const char* dictionary)
 {
   // Instantiate a compressor of the given type.
   if (!type)
@@ -456,6 +603,21 @@ void vtkXMLReader::SetupCompressor(const char* type)
     {
       compressor = vtkLZMADataCompressor::New();
     }
+    else if (strcmp(type, "vtkZstdDataCompressor") == 0)
+    {
+      vtkZstdDataCompressor* zstd = vtkZstdDataCompressor::New();
+      // The dictionary the data were compressed with (base64 encoded).
+      if (dictionary && *dictionary)
+      {
+        size_t length = strlen(dictionary);
+        std::vector<unsigned char> decoded(length / 4 * 3 + 3);
+        size_t size = vtkBase64Utilities::DecodeSafely(
+          reinterpret_cast<const unsigned char*>(dictionary), length,
+          decoded.data(), decoded.size());
+        zstd->SetDictionary(decoded.data(), size);
+      }
+      compressor = zstd;
+    }
   }
 
   if (!compressor)
@@ -608,6 +770,7 @@ int vtkXMLReader::RequestData(vtkInformation *vtkNotUsed(request),
                               vtkInformationVector *outputVector)
 {
   this->CurrentTimeStep = this->TimeStep;
+  this->NumberOfMappedArrays = 0;
 
   // Get the output pipeline information and data object.
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
@@ -869,19 +1032,22 @@ int vtkXMLReader::ReadArrayValues(
     return 0;
   }
   this->InReadData = 1;
-  int result;
-  vtkArrayIterator* iter = array->NewIterator();
-  switch (array->GetDataType())
-  {
-    vtkArrayIteratorTemplateMacro(
-      result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
-        arrayIndex, static_cast<VTK_TT*>(iter), startIndex, numValues));
-  default:
-    result = 0;
-  }
-  if (iter)
+  int result = 1;
+  if (!this->MapArrayValues(da, arrayIndex, array, startIndex, numValues))
   {
-    iter->Delete();
+    vtkArrayIterator* iter = array->NewIterator();
+    switch (array->GetDataType())
+    {
+      vtkArrayIteratorTemplateMacro(
+        result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
+          arrayIndex, static_cast<VTK_TT*>(iter), startIndex, numValues));
+    default:
+      result = 0;
+    }
+    if (iter)
+    {
+      iter->Delete();
+    }
   }
 
   this->ConvertGhostLevelsToGhostType(fieldType, array, startIndex, numValues);
@@ -897,6 +1063,65 @@ int vtkXMLReader::ReadArrayValues(
   return result;
 }
 
+//----------------------------------------------------------------------------
+int vtkXMLReader::MapArrayValues(
+  vtkXMLDataElement* da, vtkIdType arrayIndex,
+  vtkAbstractArray* array, vtkIdType startIndex,
+  vtkIdType numValues)
+{
+  // Only whole arrays with a contiguous buffer can reference the file.
+  vtkDataArray* dataArray = vtkArrayDownCast<vtkDataArray>(array);
+  if (!this->MemoryMapAppendedData || this->ReadFromInputString ||
+      !this->FileName || this->MappedFile->Failed || !dataArray ||
+      !dataArray->HasStandardMemoryLayout() ||
+      dataArray->GetDataType() == VTK_BIT || arrayIndex != 0 ||
+      startIndex != 0 || numValues <= 0 ||
+      numValues != dataArray->GetNumberOfValues() ||
+      !da->GetAttribute("offset"))
+  {
+    return 0;
+  }
+
+  vtkTypeInt64 offset = 0;
+  da->GetScalarAttribute("offset", offset);
+  vtkTypeInt64 position = this->XMLParser->GetAppendedDataRawPosition(
+    offset, static_cast<size_t>(numValues), dataArray->GetDataType());
+  const int wordSize = dataArray->GetDataTypeSize();
+  if (position < 0 || position % wordSize != 0)
+  {
+    return 0;
+  }
+
+  if (!this->MappedFile->File)
+  {
+    this->MappedFile->File = vtkXMLMappedFile::Map(this->FileName);
+    if (!this->MappedFile->File)
+    {
+      vtkWarningMacro("Cannot map " << this->FileName
+                      << " in memory, reading the arrays instead.");
+      this->MappedFile->Failed = true;
+      return 0;
+    }
+  }
+  const std::shared_ptr<vtkXMLMappedFile>& file = this->MappedFile->File;
+  if (static_cast<vtkTypeUInt64>(position) +
+      static_cast<vtkTypeUInt64>(numValues) * wordSize > file->Length)
+  {
+    return 0;
+  }
+
+  void* values = file->Data + position;
+  {
+    vtkXMLMappedArrays& arrays = vtkXMLGetMappedArrays();
+    std::lock_guard<std::mutex> lock(arrays.Mutex);
+    arrays.Files.insert(std::make_pair(values, file));
+  }
+  dataArray->SetVoidArray(values, numValues, 1);
+  dataArray->SetArrayFreeFunction(vtkXMLReleaseMappedArray);
+  this->NumberOfMappedArrays++;
+  return 1;
+}
+
 //----------------------------------------------------------------------------
 void vtkXMLReader::ReadXMLData()
 {
@@ -925,7 +1150,8 @@ int vtkXMLReader::ReadVTKFile(vtkXMLDataElement* eVTKFile)
   const char* compressor = eVTKFile->GetAttribute("compressor");
   if (compressor)
   {
-    this->SetupCompressor(compressor);
+    this->SetupCompressor(compressor,
+      eVTKFile->GetAttribute("compressor_dictionary"));
   }
 
   // Get the primary element.
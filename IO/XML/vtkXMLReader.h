@@ -36,6 +36,7 @@ class vtkDataSet;
 class vtkDataSetAttributes;
 class vtkXMLDataElement;
 class vtkXMLDataParser;
+class vtkXMLReaderMappedFile;
 class vtkInformationVector;
 class vtkInformation;
 class vtkCommand;
@@ -72,6 +73,26 @@ public:
   void SetInputString(const std::string& s) { this->InputString = s; }
   //@}
 
+  //@{
+  /**
+   * Enable memory mapping of the input file. Arrays stored in the appended
+   * data section as raw, uncompressed values in the byte order of this
+   * machine then reference the mapped file instead of being copied, and the
+   * mapping is kept until the last of them is released. Writes to these
+   * arrays are private. The file must not be truncated or rewritten while
+   * they are in use. Default is off.
+   */
+  vtkSetMacro(MemoryMapAppendedData, vtkTypeBool);
+  vtkGetMacro(MemoryMapAppendedData, vtkTypeBool);
+  vtkBooleanMacro(MemoryMapAppendedData, vtkTypeBool);
+  //@}
+
+  /**
+   * Get the number of arrays of the last output that reference the memory
+   * mapped input file instead of holding a copy of their values.
+   */
+  vtkGetMacro(NumberOfMappedArrays, vtkIdType);
+
   /**
    * Test whether the file (type) with the given name can be read by this
    * reader. If the file has a newer version than the reader, we still say
@@ -245,7 +266,7 @@ protected:
   virtual void CloseVTKString();
   virtual void CreateXMLParser();
   virtual void DestroyXMLParser();
-  void SetupCompressor(const char* type);
+  void SetupCompressor(const char* type, const char* dictionary = nullptr);
   int CanReadFileVersionString(const char* version);
 
   /**
@@ -284,6 +305,13 @@ protected:
     vtkXMLDataElement* da, vtkIdType arrayIndex, vtkAbstractArray* array,
     vtkIdType startIndex, vtkIdType numValues, FieldType type = OTHER);
 
+  // Make the array reference its values in the memory mapped input file
+  // when MemoryMapAppendedData is on and the whole array is read from raw
+  // appended data.  Returns 0 if the values must be read instead.
+  int MapArrayValues(
+    vtkXMLDataElement* da, vtkIdType arrayIndex, vtkAbstractArray* array,
+    vtkIdType startIndex, vtkIdType numValues);
+
   // Setup the data array selections for the input's set of arrays.
   void SetDataArraySelections(vtkXMLDataElement* eDSA,
                               vtkDataArraySelection* sel);
@@ -322,6 +350,10 @@ protected:
   // The input string.
   std::string InputString;
 
+  // Whether arrays reference the memory mapped input file.
+  vtkTypeBool MemoryMapAppendedData;
+  vtkIdType NumberOfMappedArrays;
+
   // The array selections.
   vtkDataArraySelection* PointDataArraySelection;
   vtkDataArraySelection* CellDataArraySelection;
@@ -400,6 +432,8 @@ private:
   ifstream* FileStream;
   // The stream used to read the input if it is in a string.
   std::istringstream* StringStream;
+  // The mapping of the input file, while it is being read.
+  vtkXMLReaderMappedFile* MappedFile;
   int TimeStepWasReadOnce;
 
   int FileMajorVersion;
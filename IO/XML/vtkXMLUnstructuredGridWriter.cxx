@@ -261,8 +261,7 @@ void vtkXMLUnstructuredGridWriter::CalculateSuperclassFraction(float* fractions)
     }
     else
     {
-      connectSize = (grid->GetCells()->GetData()->GetNumberOfTuples() -
-                     grid->GetNumberOfCells());
+      connectSize = grid->GetCells()->GetNumberOfConnectivityIds();
     }
   }
   else
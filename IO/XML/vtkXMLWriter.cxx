@@ -18,6 +18,7 @@
 #include "vtkArrayDispatch.h"
 #include "vtkArrayIteratorIncludes.h"
 #include "vtkBase64OutputStream.h"
+#include "vtkBase64Utilities.h"
 #include "vtkBitArray.h"
 #include "vtkByteSwap.h"
 #include "vtkCellData.h"
@@ -44,10 +45,12 @@
 #include "vtkOutputStream.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZLibDataCompressor.h"
+#include "vtkZstdDataCompressor.h"
 #define vtkXMLOffsetsManager_DoNotInclude
 #include "vtkXMLOffsetsManager.h"
 #undef  vtkXMLOffsetsManager_DoNotInclude
@@ -65,6 +68,7 @@
 #include <cassert>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #if !defined(_WIN32) || defined(__CYGWIN__)
 # include <unistd.h> /* unlink */
@@ -445,6 +449,52 @@ static int vtkXMLWriterWriteBinaryDataBlocks(
 //*****************************************************************************
 
 vtkCxxSetObjectMacro(vtkXMLWriter, Compressor, vtkDataCompressor);
+//----------------------------------------------------------------------------
+// Uncompressed blocks accumulated by WriteCompressionBlock(). Each block is
+// compressed independently, so compressing a batch of blocks in parallel and
+// writing them in order produces the same output as the serial loop.
+class vtkXMLWriter::CompressionBlocks
+{
+public:
+  std::vector<std::vector<unsigned char> > Uncompressed;
+  std::vector<std::vector<unsigned char> > Compressed;
+  std::vector<size_t> CompressedSizes;
+  size_t NumberOfBlocks = 0;
+};
+
+namespace
+{
+
+struct CompressBlocksWorker
+{
+  vtkDataCompressor* Compressor;
+  std::vector<std::vector<unsigned char> >& Uncompressed;
+  std::vector<std::vector<unsigned char> >& Compressed;
+  std::vector<size_t>& CompressedSizes;
+
+  CompressBlocksWorker(vtkDataCompressor* compressor,
+                       std::vector<std::vector<unsigned char> >& uncompressed,
+                       std::vector<std::vector<unsigned char> >& compressed,
+                       std::vector<size_t>& compressedSizes)
+    : Compressor(compressor), Uncompressed(uncompressed),
+      Compressed(compressed), CompressedSizes(compressedSizes)
+  {}
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const std::vector<unsigned char>& in = this->Uncompressed[i];
+      std::vector<unsigned char>& out = this->Compressed[i];
+      out.resize(this->Compressor->GetMaximumCompressionSpace(in.size()));
+      this->CompressedSizes[i] = this->Compressor->Compress(
+        in.data(), in.size(), out.data(), out.size());
+    }
+  }
+};
+
+} // end anon namespace
+
 //----------------------------------------------------------------------------
 vtkXMLWriter::vtkXMLWriter()
 {
@@ -474,6 +524,7 @@ vtkXMLWriter::vtkXMLWriter()
   this->BlockSize = 32768; //2^15
   this->Compressor = vtkZLibDataCompressor::New();
   this->CompressionHeader = nullptr;
+  this->PendingCompressionBlocks = new CompressionBlocks;
   this->Int32IdTypeBuffer = nullptr;
   this->ByteSwapBuffer = nullptr;
 
@@ -510,6 +561,7 @@ vtkXMLWriter::~vtkXMLWriter()
   this->OutStringStream = nullptr;
   delete this->FieldDataOM;
   delete[] this->NumberOfTimeValues;
+  delete this->PendingCompressionBlocks;
 }
 
 //----------------------------------------------------------------------------
@@ -554,6 +606,16 @@ void vtkXMLWriter::SetCompressorType(int compressorType)
     this->Compressor->SetCompressionLevel(this->CompressionLevel);
     this->Modified();
   }
+  else if (compressorType == ZSTD)
+  {
+    if (this->Compressor &&
+        !this->Compressor->IsTypeOf("vtkZstdDataCompressor")) {
+      this->Compressor->Delete();
+    }
+    this->Compressor = vtkZstdDataCompressor::New();
+    this->Compressor->SetCompressionLevel(this->CompressionLevel);
+    this->Modified();
+  }
   else
   {
     vtkWarningMacro("Invalid compressorType:" << compressorType);
@@ -1107,6 +1169,22 @@ void vtkXMLWriter::WriteFileAttributes()
   if (this->Compressor)
   {
     os << " compressor=\"" << this->Compressor->GetClassName() << "\"";
+
+    // The data can only be uncompressed with the zstd dictionary used to
+    // compress them, so store it (base64 encoded).
+    vtkZstdDataCompressor* zstd =
+      vtkZstdDataCompressor::SafeDownCast(this->Compressor);
+    if (zstd && zstd->GetDictionarySize() > 0)
+    {
+      unsigned long size =
+        static_cast<unsigned long>(zstd->GetDictionarySize());
+      std::vector<unsigned char> encoded((size + 2) / 3 * 4);
+      unsigned long length = vtkBase64Utilities::Encode(
+        zstd->GetDictionary(), size, encoded.data());
+      os << " compressor_dictionary=\"";
+      os.write(reinterpret_cast<const char*>(encoded.data()), length);
+      os << "\"";
+    }
   }
 }
 
@@ -1330,6 +1408,13 @@ int vtkXMLWriter::WriteBinaryData(vtkAbstractArray* a)
       result = 0;
     }
 
+    // Compress and write the blocks still pending.
+    if (result && !this->FlushCompressionBlocks())
+    {
+      result = 0;
+    }
+    this->PendingCompressionBlocks->NumberOfBlocks = 0;
+
     // Finish writing the data.
     if (result && !this->DataStream->EndWriting())
     {
@@ -1691,25 +1776,64 @@ int vtkXMLWriter::CreateCompressionHeader(size_t size)
 //----------------------------------------------------------------------------
 int vtkXMLWriter::WriteCompressionBlock(unsigned char* data, size_t size)
 {
-  // Compress the data.
-  vtkUnsignedCharArray* outputArray = this->Compressor->Compress(data, size);
+  // The data buffer is reused by the caller: keep a copy of the block. The
+  // blocks are compressed when enough of them are pending to keep all the
+  // threads busy, which bounds the memory used to a few blocks per thread.
+  CompressionBlocks* blocks = this->PendingCompressionBlocks;
+  size_t batchSize =
+    4 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  if (blocks->Uncompressed.size() < batchSize)
+  {
+    blocks->Uncompressed.resize(batchSize);
+    blocks->Compressed.resize(batchSize);
+    blocks->CompressedSizes.resize(batchSize);
+  }
+  blocks->Uncompressed[blocks->NumberOfBlocks++].assign(data, data + size);
 
-  // Find the compressed size.
-  size_t outputSize = outputArray->GetNumberOfTuples();
-  unsigned char* outputPointer = outputArray->GetPointer(0);
+  if (blocks->NumberOfBlocks < batchSize)
+  {
+    return 1;
+  }
+  return this->FlushCompressionBlocks();
+}
 
-  // Write the compressed data.
-  int result = this->DataStream->Write(outputPointer, outputSize);
-  this->Stream->flush();
-  if (this->Stream->fail())
+//----------------------------------------------------------------------------
+int vtkXMLWriter::FlushCompressionBlocks()
+{
+  CompressionBlocks* blocks = this->PendingCompressionBlocks;
+  size_t numBlocks = blocks->NumberOfBlocks;
+  blocks->NumberOfBlocks = 0;
+  if (numBlocks == 0)
   {
-    this->SetErrorCode(vtkErrorCode::GetLastSystemError());
+    return 1;
   }
 
-  // Store the resulting compressed size in the compression header.
-  this->CompressionHeader->Set(3+this->CompressionBlockNumber++, outputSize);
+  // Compress the data.
+  CompressBlocksWorker worker(this->Compressor, blocks->Uncompressed,
+                              blocks->Compressed, blocks->CompressedSizes);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numBlocks), 1, worker);
+
+  // Write the compressed data, in order.
+  int result = 1;
+  for (size_t i = 0; i < numBlocks && result; ++i)
+  {
+    size_t outputSize = blocks->CompressedSizes[i];
+    if (outputSize == 0)
+    {
+      vtkErrorMacro("Failed to compress block " << this->CompressionBlockNumber);
+      return 0;
+    }
+
+    result = this->DataStream->Write(blocks->Compressed[i].data(), outputSize);
+    this->Stream->flush();
+    if (this->Stream->fail())
+    {
+      this->SetErrorCode(vtkErrorCode::GetLastSystemError());
+    }
 
-  outputArray->Delete();
+    // Store the resulting compressed size in the compression header.
+    this->CompressionHeader->Set(3+this->CompressionBlockNumber++, outputSize);
+  }
 
   return result;
 }
@@ -2317,6 +2441,20 @@ void vtkXMLWriter::WriteArrayAppendedData(vtkAbstractArray* a,
                                           vtkTypeInt64 pos,
                                           vtkTypeInt64& lastoffset)
 {
+  // Pad the raw uncompressed data so that the values following the header
+  // are aligned on the size of their type.
+  const vtkTypeInt64 wordSize = a->GetDataTypeSize();
+  if (!this->EncodeAppendedData && !this->Compressor && wordSize > 1)
+  {
+    ostream& os = *(this->Stream);
+    vtkTypeInt64 valuesPosition =
+      static_cast<vtkTypeInt64>(os.tellp()) + this->HeaderType / 8;
+    for (vtkTypeInt64 i = valuesPosition % wordSize; i > 0 && i < wordSize;
+         ++i)
+    {
+      os.put('\0');
+    }
+  }
   this->WriteAppendedDataOffset(pos, lastoffset, "offset");
   this->WriteBinaryData(a);
 }
@@ -144,6 +144,8 @@ public:
   /**
    * Get/Set the compressor used to compress binary and appended data
    * before writing to the file.  Default is a vtkZLibDataCompressor.
+   * The dictionary of a vtkZstdDataCompressor is stored in the file so that
+   * the readers can uncompress the data.
    */
   virtual void SetCompressor(vtkDataCompressor*);
   vtkGetObjectMacro(Compressor, vtkDataCompressor);
@@ -154,7 +156,8 @@ public:
     NONE,
     ZLIB,
     LZ4,
-    LZMA
+    LZMA,
+    ZSTD
   };
 
   //@{
@@ -178,6 +181,10 @@ public:
   {
     this->SetCompressorType(LZMA);
   }
+  void SetCompressorTypeToZstd()
+  {
+    this->SetCompressorType(ZSTD);
+  }
 
   void SetCompressionLevel(int compressorLevel);
   vtkGetMacro(CompressionLevel, int);
@@ -213,7 +220,10 @@ public:
    * encoded, reading and writing will be slower, but the file will be
    * fully valid XML and text-only.  If not encoded, the XML
    * specification will be violated, but reading and writing will be
-   * fast.  The default is to do the encoding.
+   * fast.  The default is to do the encoding.  When the appended data
+   * is neither encoded nor compressed, the values of each array are
+   * aligned in the file on the size of their type so that readers can
+   * memory map them.
    */
   vtkSetMacro(EncodeAppendedData, vtkTypeBool);
   vtkGetMacro(EncodeAppendedData, vtkTypeBool);
@@ -337,6 +347,9 @@ protected:
   size_t CompressionBlockNumber;
   vtkXMLDataHeader* CompressionHeader;
   vtkTypeInt64 CompressionHeaderPosition;
+  // Blocks waiting to be compressed in parallel.
+  class CompressionBlocks;
+  CompressionBlocks* PendingCompressionBlocks;
   // Compression Level for vtkDataCompressor objects
   // 1 (worst compression, fastest) ... 9 (best compression, slowest)
   int CompressionLevel = 5;
@@ -475,6 +488,7 @@ protected:
   void PerformByteSwap(void* data, size_t numWords, size_t wordSize);
   int CreateCompressionHeader(size_t size);
   int WriteCompressionBlock(unsigned char* data, size_t size);
+  int FlushCompressionBlocks();
   int WriteCompressionHeader();
   size_t GetWordTypeSize(int dataType);
   const char* GetWordTypeName(int dataType);
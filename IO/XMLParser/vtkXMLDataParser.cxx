@@ -14,18 +14,22 @@
 =========================================================================*/
 #include "vtkXMLDataParser.h"
 
+#include "vtkASCIIArrayParser.h"
 #include "vtkBase64InputStream.h"
 #include "vtkByteSwap.h"
 #include "vtkCommand.h"
 #include "vtkDataCompressor.h"
 #include "vtkInputStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkTypeTraits.h"
 #include "vtkXMLDataElement.h"
 #define vtkXMLDataHeaderPrivate_DoNotInclude
 #include "vtkXMLDataHeaderPrivate.h"
 #undef vtkXMLDataHeaderPrivate_DoNotInclude
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cctype>
 #include <memory>
@@ -591,6 +595,61 @@ unsigned char* vtkXMLDataParser::ReadBlock(vtkTypeUInt64 block)
   return decompressBuffer;
 }
 
+//----------------------------------------------------------------------------
+int vtkXMLDataParser::ReadBlocks(vtkTypeUInt64 firstBlock,
+                                 vtkTypeUInt64 endBlock,
+                                 unsigned char* buffer, size_t wordSize)
+{
+  // The compressed blocks are stored one after the other: read them all at
+  // once, then uncompress and byte swap them in parallel.
+  const vtkTypeUInt64 numBlocks = endBlock - firstBlock;
+  std::vector<size_t> compressedOffsets(numBlocks + 1, 0);
+  std::vector<size_t> uncompressedOffsets(numBlocks + 1, 0);
+  for (vtkTypeUInt64 i = 0; i < numBlocks; ++i)
+  {
+    compressedOffsets[i + 1] =
+      compressedOffsets[i] + this->BlockCompressedSizes[firstBlock + i];
+    uncompressedOffsets[i + 1] =
+      uncompressedOffsets[i] + this->FindBlockSize(firstBlock + i);
+  }
+
+  if (!this->DataStream->Seek(this->BlockStartOffsets[firstBlock]))
+  {
+    return 0;
+  }
+  std::vector<unsigned char> readBuffer(compressedOffsets[numBlocks]);
+  if (this->DataStream->Read(readBuffer.data(), readBuffer.size()) <
+      readBuffer.size())
+  {
+    return 0;
+  }
+
+  std::atomic<bool> success(true);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numBlocks), 1,
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        unsigned char* output = buffer + uncompressedOffsets[i];
+        size_t uncompressedSize =
+          uncompressedOffsets[i + 1] - uncompressedOffsets[i];
+        if (this->Compressor->Uncompress(
+              readBuffer.data() + compressedOffsets[i],
+              compressedOffsets[i + 1] - compressedOffsets[i],
+              output, uncompressedSize) == 0)
+        {
+          success = false;
+          return;
+        }
+
+        // Note that the block size will always be an integer multiple of the
+        // word size.
+        this->PerformByteSwap(output, uncompressedSize / wordSize, wordSize);
+      }
+    });
+  return success ? 1 : 0;
+}
+
 //----------------------------------------------------------------------------
 size_t vtkXMLDataParser::ReadUncompressedData(unsigned char* data,
                                               vtkTypeUInt64 startWord,
@@ -766,18 +825,24 @@ size_t vtkXMLDataParser::ReadCompressedData(unsigned char* data,
     // Report progress.
     this->UpdateProgress(float(outputPointer-data)/length);
 
-    unsigned int currentBlock = firstBlock+1;
-    for(;currentBlock != lastBlock && !this->Abort; ++currentBlock)
+    // Read the complete blocks in batches, large enough to keep all the
+    // threads busy while bounding the size of the read buffer.
+    const vtkTypeUInt64 batchSize =
+      4 * static_cast<vtkTypeUInt64>(vtkSMPTools::GetEstimatedNumberOfThreads());
+    vtkTypeUInt64 currentBlock = firstBlock+1;
+    while(currentBlock < lastBlock && !this->Abort)
     {
-      // Read this block.
-      if(!this->ReadBlock(currentBlock, outputPointer)) { return 0; }
-
-      // Byte swap this block.  Note that blockSize will always be an
-      // integer multiple of the word size.
-      this->PerformByteSwap(outputPointer, blockSize / wordSize, wordSize);
+      vtkTypeUInt64 endBlock = std::min(currentBlock + batchSize, lastBlock);
+      if(!this->ReadBlocks(currentBlock, endBlock, outputPointer, wordSize))
+      {
+        return 0;
+      }
 
       // Advance the pointer to the beginning of the next block.
-      outputPointer += this->FindBlockSize(currentBlock);
+      for(; currentBlock != endBlock; ++currentBlock)
+      {
+        outputPointer += this->FindBlockSize(currentBlock);
+      }
 
       // Report progress.
       this->UpdateProgress(float(outputPointer-data)/length);
@@ -930,247 +995,93 @@ size_t vtkXMLDataParser::ReadAppendedData(vtkTypeInt64 offset,
 }
 
 //----------------------------------------------------------------------------
-//----------------------------------------------------------------------------
-// Define a parsing function template.  The extra "long" argument is used
-// to help broken compilers select the non-templates below for char and
-// unsigned char, and float/double by making them a better conversion than
-// the template.
-template <class T>
-T* vtkXMLParseAsciiData(istream& is, int* length, T*, long)
+vtkTypeInt64 vtkXMLDataParser::GetAppendedDataRawPosition(vtkTypeInt64 offset,
+                                                          size_t numWords,
+                                                          int wordType)
 {
-  int dataLength = 0;
-  int dataBufferSize = 64;
-
-  T* dataBuffer = new T[dataBufferSize];
-  T element;
-
-  while(is >> element)
+#ifdef VTK_WORDS_BIGENDIAN
+  const int byteOrder = vtkXMLDataParser::BigEndian;
+#else
+  const int byteOrder = vtkXMLDataParser::LittleEndian;
+#endif
+  if(!this->AppendedDataPosition || this->Compressor ||
+     this->ByteOrder != byteOrder ||
+     this->AppendedDataStream->IsA("vtkBase64InputStream"))
   {
-    if(dataLength == dataBufferSize)
-    {
-      int newSize = dataBufferSize*2;
-      T* newBuffer = new T[newSize];
-      memcpy(newBuffer, dataBuffer, dataLength*sizeof(T));
-      delete [] dataBuffer;
-      dataBuffer = newBuffer;
-      dataBufferSize = newSize;
-    }
-    dataBuffer[dataLength++] = element;
+    return -1;
   }
 
-  if(length)
+  // Read the length of the data.
+  this->DataStream = this->AppendedDataStream;
+  this->DataStream->SetStream(this->Stream);
+  this->SeekG(this->AppendedDataPosition+offset);
+  std::unique_ptr<vtkXMLDataHeader>
+    uh(vtkXMLDataHeader::New(this->HeaderType, 1));
+  size_t const headerSize = uh->DataSize();
+  this->DataStream->StartReading();
+  size_t r = this->DataStream->Read(uh->Data(), headerSize);
+  this->DataStream->EndReading();
+  if(r < headerSize ||
+     uh->Get(0) < numWords*this->GetWordTypeSize(wordType))
   {
-    *length = dataLength;
+    return -1;
   }
-
-  return dataBuffer;
+  return this->AppendedDataPosition+offset+static_cast<vtkTypeInt64>(headerSize);
 }
 
 //----------------------------------------------------------------------------
-static float* vtkXMLParseAsciiData(istream& is, int* length, float*, int)
-{
-  int dataLength = 0;
-  int dataBufferSize = 64;
-
-  float* dataBuffer = new float[dataBufferSize];
-  std::string stringBuffer;
-  float element;
-
-  while (1)
-  {
-    is >> element;
-    if (!is.good())
-    {
-      is.clear(is.rdstate() & ~ios::failbit);
-      is >> stringBuffer;
-      if (!is.good())
-      {
-        break;
-      }
-      else
-      {
-        std::for_each(
-          stringBuffer.begin(), stringBuffer.end(), [](char& c) { c = std::tolower(c); });
-        if (stringBuffer == "inf" || stringBuffer == "nan" || stringBuffer == "-inf")
-        {
-          element = strtof(stringBuffer.c_str(), nullptr);
-        }
-        else
-        {
-          break;
-        }
-      }
-    }
-    if (dataLength == dataBufferSize)
-    {
-      int newSize = dataBufferSize * 2;
-      float* newBuffer = new float[newSize];
-      memcpy(newBuffer, dataBuffer, dataLength * sizeof(float));
-      delete[] dataBuffer;
-      dataBuffer = newBuffer;
-      dataBufferSize = newSize;
-    }
-    dataBuffer[dataLength++] = element;
-  }
-
-  if (length)
-  {
-    *length = dataLength;
-  }
-
-  return dataBuffer;
-}
-
 //----------------------------------------------------------------------------
-static double* vtkXMLParseAsciiData(istream& is, int* length, double*, int)
+// Parse the values up to the start of the next tag. The text is read in
+// blocks ending at whitespace, each one converted in parallel.
+template <class T>
+T* vtkXMLParseAsciiData(istream& is, int* length, T*)
 {
+  const size_t maximumBlockSize = 1 << 24;
+  size_t blockSize = 1 << 16;
+  std::vector<char> text;
+
   int dataLength = 0;
   int dataBufferSize = 64;
+  T* dataBuffer = new T[dataBufferSize];
 
-  double* dataBuffer = new double[dataBufferSize];
-  std::string stringBuffer;
-  double element;
-
-  while (1)
-  {
-    is >> element;
-    if (!is.good())
+  bool done = false;
+  while(!done)
+  {
+    size_t kept = text.size();
+    text.resize(kept + blockSize + 1);
+    is.get(text.data() + kept, static_cast<std::streamsize>(blockSize + 1),
+           '<');
+    size_t count = static_cast<size_t>(is.gcount());
+    text.resize(kept + count);
+    bool last = (count < blockSize);
+    blockSize = std::min(2 * blockSize, maximumBlockSize);
+
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    if(!last)
     {
-      is.clear(is.rdstate() & ~ios::failbit);
-      is >> stringBuffer;
-      if (!is.good())
+      while(end != begin && !isspace(static_cast<unsigned char>(end[-1])))
       {
-        break;
+        --end;
       }
-      else
-      {
-        std::for_each(
-          stringBuffer.begin(), stringBuffer.end(), [](char& c) { c = std::tolower(c); });
-        if (stringBuffer == "inf" || stringBuffer == "nan" || stringBuffer == "-inf")
-        {
-          element = strtod(stringBuffer.c_str(), nullptr);
-        }
-        else
-        {
-          break;
-        }
-      }
-    }
-    if (dataLength == dataBufferSize)
-    {
-      int newSize = dataBufferSize * 2;
-      double* newBuffer = new double[newSize];
-      memcpy(newBuffer, dataBuffer, dataLength * sizeof(double));
-      delete[] dataBuffer;
-      dataBuffer = newBuffer;
-      dataBufferSize = newSize;
     }
-    dataBuffer[dataLength++] = element;
-  }
 
-  if (length)
-  {
-    *length = dataLength;
-  }
-
-  return dataBuffer;
-}
-
-//----------------------------------------------------------------------------
-static char* vtkXMLParseAsciiData(istream& is, int* length, char*, int)
-{
-  int dataLength = 0;
-  int dataBufferSize = 64;
-
-  char* dataBuffer = new char[dataBufferSize];
-  char element;
-  short inElement;
-
-  while(is >> inElement)
-  {
-    element = inElement;
-    if(dataLength == dataBufferSize)
+    vtkIdType numTokens = vtkASCIIArrayParser::CountTokens(begin, end);
+    if(dataLength + numTokens > dataBufferSize)
     {
-      int newSize = dataBufferSize*2;
-      char* newBuffer = new char[newSize];
-      memcpy(newBuffer, dataBuffer, dataLength*sizeof(char));
-      delete [] dataBuffer;
-      dataBuffer = newBuffer;
-      dataBufferSize = newSize;
-    }
-    dataBuffer[dataLength++] = element;
-  }
-
-  if(length)
-  {
-    *length = dataLength;
-  }
-
-  return dataBuffer;
-}
-
-//----------------------------------------------------------------------------
-static unsigned char* vtkXMLParseAsciiData(istream& is,
-                                           int* length,
-                                           unsigned char*,
-                                           int)
-{
-  int dataLength = 0;
-  int dataBufferSize = 64;
-
-  unsigned char* dataBuffer = new unsigned char[dataBufferSize];
-  unsigned char element;
-  short inElement;
-
-  while(is >> inElement)
-  {
-    element = inElement;
-    if(dataLength == dataBufferSize)
-    {
-      int newSize = dataBufferSize*2;
-      unsigned char* newBuffer = new unsigned char[newSize];
-      memcpy(newBuffer, dataBuffer, dataLength*sizeof(unsigned char));
-      delete [] dataBuffer;
-      dataBuffer = newBuffer;
-      dataBufferSize = newSize;
-    }
-    dataBuffer[dataLength++] = element;
-  }
-
-  if(length)
-  {
-    *length = dataLength;
-  }
-
-  return dataBuffer;
-}
-
-//----------------------------------------------------------------------------
-static signed char* vtkXMLParseAsciiData(istream& is,
-                                         int* length,
-                                         signed char*,
-                                         int)
-{
-  int dataLength = 0;
-  int dataBufferSize = 64;
-
-  signed char* dataBuffer = new signed char[dataBufferSize];
-  signed char element;
-  short inElement;
-
-  while(is >> inElement)
-  {
-    element = inElement;
-    if(dataLength == dataBufferSize)
-    {
-      int newSize = dataBufferSize*2;
-      signed char* newBuffer = new signed char[newSize];
-      memcpy(newBuffer, dataBuffer, dataLength*sizeof(signed char));
+      int newSize = std::max(dataBufferSize*2,
+                             static_cast<int>(dataLength + numTokens));
+      T* newBuffer = new T[newSize];
+      memcpy(newBuffer, dataBuffer, dataLength*sizeof(T));
       delete [] dataBuffer;
       dataBuffer = newBuffer;
       dataBufferSize = newSize;
     }
-    dataBuffer[dataLength++] = element;
+    vtkIdType numParsed = vtkASCIIArrayParser::Parse(begin, end,
+      vtkTypeTraits<T>::VTK_TYPE_ID, dataBuffer + dataLength, numTokens);
+    dataLength += static_cast<int>(numParsed);
+    text.erase(text.begin(), text.begin() + (end - begin));
+    done = last || numParsed < numTokens;
   }
 
   if(length)
@@ -1257,7 +1168,7 @@ int vtkXMLDataParser::ParseAsciiData(int wordType)
   switch (wordType)
   {
     vtkTemplateMacro(
-      buffer = vtkXMLParseAsciiData(is, &length, static_cast<VTK_TT*>(nullptr), 1)
+      buffer = vtkXMLParseAsciiData(is, &length, static_cast<VTK_TT*>(nullptr))
       );
 
     case VTK_BIT:
@@ -79,6 +79,16 @@ public:
   { return this->ReadAppendedData(offset, buffer, startWord, numWords,
                                     VTK_CHAR); }
 
+  /**
+   * Get the position in the stream of the values of the appended data at
+   * the given offset, when they are stored exactly as they would be in
+   * memory: raw encoding, no compression and the byte order of this
+   * machine.  Returns -1 if this is not the case or if there are less than
+   * numWords words of the given type.
+   */
+  vtkTypeInt64 GetAppendedDataRawPosition(vtkTypeInt64 offset,
+                                          size_t numWords, int wordType);
+
   /**
    * Read from an ascii data section starting at the current position in
    * the stream.  Returns the number of words read.
@@ -189,6 +199,8 @@ protected:
   size_t FindBlockSize(vtkTypeUInt64 block);
   int ReadBlock(vtkTypeUInt64 block, unsigned char* buffer);
   unsigned char* ReadBlock(vtkTypeUInt64 block);
+  int ReadBlocks(vtkTypeUInt64 firstBlock, vtkTypeUInt64 endBlock,
+                 unsigned char* buffer, size_t wordSize);
   size_t ReadUncompressedData(unsigned char* data,
                               vtkTypeUInt64 startWord,
                               size_t numWords,
@@ -0,0 +1,56 @@
+#!/usr/bin/env bash
+
+set -e
+set -x
+shopt -s dotglob
+
+readonly name="zstd"
+readonly ownership="zstd Upstream <kwrobot@kitware.com>"
+readonly subtree="ThirdParty/$name/vtk$name"
+readonly repo="https://github.com/facebook/zstd.git"
+readonly tag="v1.5.7"
+readonly paths="
+lib/common/*.c
+lib/common/*.h
+lib/compress/*.c
+lib/compress/*.h
+lib/decompress/*.c
+lib/decompress/*.h
+lib/dictBuilder/*.c
+lib/dictBuilder/*.h
+lib/zdict.h
+lib/zstd.h
+lib/zstd_errors.h
+
+COPYING
+LICENSE
+"
+
+# Upstream zstd is imported directly; the files VTK adds (build, attributes,
+# documentation and symbol mangling) are kept from the current import.
+readonly vtk_files="
+.gitattributes
+CMakeLists.txt
+README.kitware.md
+lib/vtk_zstd_mangle.h
+"
+
+extract_source () {
+    git_archive
+    pushd "$extractdir/$name-reduced"
+    for file in $vtk_files; do
+        cp -v "$toplevel_dir/$subtree/$file" "$file"
+    done
+    # Mangle the public symbols.
+    for header in lib/zdict.h lib/zstd.h lib/zstd_errors.h; do
+        sed -i '0,/^#define .*/s//&\n\n#include "vtk_zstd_mangle.h"/' "$header"
+    done
+    # ZSTD_isError is both a public (mangled) function and an internal macro.
+    sed -i 's|^#define ZSTD_isError ERR_isError|#undef ZSTD_isError /* VTK: mangled by vtk_zstd_mangle.h */\n&|' \
+        lib/common/zstd_internal.h
+    sed -i 's|^#undef ZSTD_isError   /\* defined within zstd_internal.h \*/|&\n#define ZSTD_isError vtkzstd_ZSTD_isError /* VTK: restore the mangled name */|' \
+        lib/common/zstd_common.c
+    popd
+}
+
+. "${BASH_SOURCE%/*}/../update-common.sh"
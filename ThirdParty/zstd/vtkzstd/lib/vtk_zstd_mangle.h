@@ -0,0 +1,190 @@
+#ifndef vtk_zstd_mangle_h
+#define vtk_zstd_mangle_h
+
+#define ZDICT_addEntropyTablesFromBuffer vtkzstd_ZDICT_addEntropyTablesFromBuffer
+#define ZDICT_finalizeDictionary vtkzstd_ZDICT_finalizeDictionary
+#define ZDICT_getDictHeaderSize vtkzstd_ZDICT_getDictHeaderSize
+#define ZDICT_getDictID vtkzstd_ZDICT_getDictID
+#define ZDICT_getErrorName vtkzstd_ZDICT_getErrorName
+#define ZDICT_isError vtkzstd_ZDICT_isError
+#define ZDICT_optimizeTrainFromBuffer_cover vtkzstd_ZDICT_optimizeTrainFromBuffer_cover
+#define ZDICT_optimizeTrainFromBuffer_fastCover vtkzstd_ZDICT_optimizeTrainFromBuffer_fastCover
+#define ZDICT_trainFromBuffer vtkzstd_ZDICT_trainFromBuffer
+#define ZDICT_trainFromBuffer_cover vtkzstd_ZDICT_trainFromBuffer_cover
+#define ZDICT_trainFromBuffer_fastCover vtkzstd_ZDICT_trainFromBuffer_fastCover
+#define ZDICT_trainFromBuffer_legacy vtkzstd_ZDICT_trainFromBuffer_legacy
+#define ZSTD_CCtxParams_getParameter vtkzstd_ZSTD_CCtxParams_getParameter
+#define ZSTD_CCtxParams_init vtkzstd_ZSTD_CCtxParams_init
+#define ZSTD_CCtxParams_init_advanced vtkzstd_ZSTD_CCtxParams_init_advanced
+#define ZSTD_CCtxParams_registerSequenceProducer vtkzstd_ZSTD_CCtxParams_registerSequenceProducer
+#define ZSTD_CCtxParams_reset vtkzstd_ZSTD_CCtxParams_reset
+#define ZSTD_CCtxParams_setParameter vtkzstd_ZSTD_CCtxParams_setParameter
+#define ZSTD_CCtx_getParameter vtkzstd_ZSTD_CCtx_getParameter
+#define ZSTD_CCtx_loadDictionary vtkzstd_ZSTD_CCtx_loadDictionary
+#define ZSTD_CCtx_loadDictionary_advanced vtkzstd_ZSTD_CCtx_loadDictionary_advanced
+#define ZSTD_CCtx_loadDictionary_byReference vtkzstd_ZSTD_CCtx_loadDictionary_byReference
+#define ZSTD_CCtx_refCDict vtkzstd_ZSTD_CCtx_refCDict
+#define ZSTD_CCtx_refPrefix vtkzstd_ZSTD_CCtx_refPrefix
+#define ZSTD_CCtx_refPrefix_advanced vtkzstd_ZSTD_CCtx_refPrefix_advanced
+#define ZSTD_CCtx_refThreadPool vtkzstd_ZSTD_CCtx_refThreadPool
+#define ZSTD_CCtx_reset vtkzstd_ZSTD_CCtx_reset
+#define ZSTD_CCtx_setCParams vtkzstd_ZSTD_CCtx_setCParams
+#define ZSTD_CCtx_setFParams vtkzstd_ZSTD_CCtx_setFParams
+#define ZSTD_CCtx_setParameter vtkzstd_ZSTD_CCtx_setParameter
+#define ZSTD_CCtx_setParametersUsingCCtxParams vtkzstd_ZSTD_CCtx_setParametersUsingCCtxParams
+#define ZSTD_CCtx_setParams vtkzstd_ZSTD_CCtx_setParams
+#define ZSTD_CCtx_setPledgedSrcSize vtkzstd_ZSTD_CCtx_setPledgedSrcSize
+#define ZSTD_CStreamInSize vtkzstd_ZSTD_CStreamInSize
+#define ZSTD_CStreamOutSize vtkzstd_ZSTD_CStreamOutSize
+#define ZSTD_DCtx_getParameter vtkzstd_ZSTD_DCtx_getParameter
+#define ZSTD_DCtx_loadDictionary vtkzstd_ZSTD_DCtx_loadDictionary
+#define ZSTD_DCtx_loadDictionary_advanced vtkzstd_ZSTD_DCtx_loadDictionary_advanced
+#define ZSTD_DCtx_loadDictionary_byReference vtkzstd_ZSTD_DCtx_loadDictionary_byReference
+#define ZSTD_DCtx_refDDict vtkzstd_ZSTD_DCtx_refDDict
+#define ZSTD_DCtx_refPrefix vtkzstd_ZSTD_DCtx_refPrefix
+#define ZSTD_DCtx_refPrefix_advanced vtkzstd_ZSTD_DCtx_refPrefix_advanced
+#define ZSTD_DCtx_reset vtkzstd_ZSTD_DCtx_reset
+#define ZSTD_DCtx_setFormat vtkzstd_ZSTD_DCtx_setFormat
+#define ZSTD_DCtx_setMaxWindowSize vtkzstd_ZSTD_DCtx_setMaxWindowSize
+#define ZSTD_DCtx_setParameter vtkzstd_ZSTD_DCtx_setParameter
+#define ZSTD_DStreamInSize vtkzstd_ZSTD_DStreamInSize
+#define ZSTD_DStreamOutSize vtkzstd_ZSTD_DStreamOutSize
+#define ZSTD_adjustCParams vtkzstd_ZSTD_adjustCParams
+#define ZSTD_cParam_getBounds vtkzstd_ZSTD_cParam_getBounds
+#define ZSTD_checkCParams vtkzstd_ZSTD_checkCParams
+#define ZSTD_compress vtkzstd_ZSTD_compress
+#define ZSTD_compress2 vtkzstd_ZSTD_compress2
+#define ZSTD_compressBegin vtkzstd_ZSTD_compressBegin
+#define ZSTD_compressBegin_advanced vtkzstd_ZSTD_compressBegin_advanced
+#define ZSTD_compressBegin_usingCDict vtkzstd_ZSTD_compressBegin_usingCDict
+#define ZSTD_compressBegin_usingCDict_advanced vtkzstd_ZSTD_compressBegin_usingCDict_advanced
+#define ZSTD_compressBegin_usingDict vtkzstd_ZSTD_compressBegin_usingDict
+#define ZSTD_compressBlock vtkzstd_ZSTD_compressBlock
+#define ZSTD_compressBound vtkzstd_ZSTD_compressBound
+#define ZSTD_compressCCtx vtkzstd_ZSTD_compressCCtx
+#define ZSTD_compressContinue vtkzstd_ZSTD_compressContinue
+#define ZSTD_compressEnd vtkzstd_ZSTD_compressEnd
+#define ZSTD_compressSequences vtkzstd_ZSTD_compressSequences
+#define ZSTD_compressSequencesAndLiterals vtkzstd_ZSTD_compressSequencesAndLiterals
+#define ZSTD_compressStream vtkzstd_ZSTD_compressStream
+#define ZSTD_compressStream2 vtkzstd_ZSTD_compressStream2
+#define ZSTD_compressStream2_simpleArgs vtkzstd_ZSTD_compressStream2_simpleArgs
+#define ZSTD_compress_advanced vtkzstd_ZSTD_compress_advanced
+#define ZSTD_compress_usingCDict vtkzstd_ZSTD_compress_usingCDict
+#define ZSTD_compress_usingCDict_advanced vtkzstd_ZSTD_compress_usingCDict_advanced
+#define ZSTD_compress_usingDict vtkzstd_ZSTD_compress_usingDict
+#define ZSTD_copyCCtx vtkzstd_ZSTD_copyCCtx
+#define ZSTD_copyDCtx vtkzstd_ZSTD_copyDCtx
+#define ZSTD_createCCtx vtkzstd_ZSTD_createCCtx
+#define ZSTD_createCCtxParams vtkzstd_ZSTD_createCCtxParams
+#define ZSTD_createCCtx_advanced vtkzstd_ZSTD_createCCtx_advanced
+#define ZSTD_createCDict vtkzstd_ZSTD_createCDict
+#define ZSTD_createCDict_advanced vtkzstd_ZSTD_createCDict_advanced
+#define ZSTD_createCDict_advanced2 vtkzstd_ZSTD_createCDict_advanced2
+#define ZSTD_createCDict_byReference vtkzstd_ZSTD_createCDict_byReference
+#define ZSTD_createCStream vtkzstd_ZSTD_createCStream
+#define ZSTD_createCStream_advanced vtkzstd_ZSTD_createCStream_advanced
+#define ZSTD_createDCtx vtkzstd_ZSTD_createDCtx
+#define ZSTD_createDCtx_advanced vtkzstd_ZSTD_createDCtx_advanced
+#define ZSTD_createDDict vtkzstd_ZSTD_createDDict
+#define ZSTD_createDDict_advanced vtkzstd_ZSTD_createDDict_advanced
+#define ZSTD_createDDict_byReference vtkzstd_ZSTD_createDDict_byReference
+#define ZSTD_createDStream vtkzstd_ZSTD_createDStream
+#define ZSTD_createDStream_advanced vtkzstd_ZSTD_createDStream_advanced
+#define ZSTD_dParam_getBounds vtkzstd_ZSTD_dParam_getBounds
+#define ZSTD_decodingBufferSize_min vtkzstd_ZSTD_decodingBufferSize_min
+#define ZSTD_decompress vtkzstd_ZSTD_decompress
+#define ZSTD_decompressBegin vtkzstd_ZSTD_decompressBegin
+#define ZSTD_decompressBegin_usingDDict vtkzstd_ZSTD_decompressBegin_usingDDict
+#define ZSTD_decompressBegin_usingDict vtkzstd_ZSTD_decompressBegin_usingDict
+#define ZSTD_decompressBlock vtkzstd_ZSTD_decompressBlock
+#define ZSTD_decompressBound vtkzstd_ZSTD_decompressBound
+#define ZSTD_decompressContinue vtkzstd_ZSTD_decompressContinue
+#define ZSTD_decompressDCtx vtkzstd_ZSTD_decompressDCtx
+#define ZSTD_decompressStream vtkzstd_ZSTD_decompressStream
+#define ZSTD_decompressStream_simpleArgs vtkzstd_ZSTD_decompressStream_simpleArgs
+#define ZSTD_decompress_usingDDict vtkzstd_ZSTD_decompress_usingDDict
+#define ZSTD_decompress_usingDict vtkzstd_ZSTD_decompress_usingDict
+#define ZSTD_decompressionMargin vtkzstd_ZSTD_decompressionMargin
+#define ZSTD_defaultCLevel vtkzstd_ZSTD_defaultCLevel
+#define ZSTD_endStream vtkzstd_ZSTD_endStream
+#define ZSTD_estimateCCtxSize vtkzstd_ZSTD_estimateCCtxSize
+#define ZSTD_estimateCCtxSize_usingCCtxParams vtkzstd_ZSTD_estimateCCtxSize_usingCCtxParams
+#define ZSTD_estimateCCtxSize_usingCParams vtkzstd_ZSTD_estimateCCtxSize_usingCParams
+#define ZSTD_estimateCDictSize vtkzstd_ZSTD_estimateCDictSize
+#define ZSTD_estimateCDictSize_advanced vtkzstd_ZSTD_estimateCDictSize_advanced
+#define ZSTD_estimateCStreamSize vtkzstd_ZSTD_estimateCStreamSize
+#define ZSTD_estimateCStreamSize_usingCCtxParams vtkzstd_ZSTD_estimateCStreamSize_usingCCtxParams
+#define ZSTD_estimateCStreamSize_usingCParams vtkzstd_ZSTD_estimateCStreamSize_usingCParams
+#define ZSTD_estimateDCtxSize vtkzstd_ZSTD_estimateDCtxSize
+#define ZSTD_estimateDDictSize vtkzstd_ZSTD_estimateDDictSize
+#define ZSTD_estimateDStreamSize vtkzstd_ZSTD_estimateDStreamSize
+#define ZSTD_estimateDStreamSize_fromFrame vtkzstd_ZSTD_estimateDStreamSize_fromFrame
+#define ZSTD_findDecompressedSize vtkzstd_ZSTD_findDecompressedSize
+#define ZSTD_findFrameCompressedSize vtkzstd_ZSTD_findFrameCompressedSize
+#define ZSTD_flushStream vtkzstd_ZSTD_flushStream
+#define ZSTD_frameHeaderSize vtkzstd_ZSTD_frameHeaderSize
+#define ZSTD_freeCCtx vtkzstd_ZSTD_freeCCtx
+#define ZSTD_freeCCtxParams vtkzstd_ZSTD_freeCCtxParams
+#define ZSTD_freeCDict vtkzstd_ZSTD_freeCDict
+#define ZSTD_freeCStream vtkzstd_ZSTD_freeCStream
+#define ZSTD_freeDCtx vtkzstd_ZSTD_freeDCtx
+#define ZSTD_freeDDict vtkzstd_ZSTD_freeDDict
+#define ZSTD_freeDStream vtkzstd_ZSTD_freeDStream
+#define ZSTD_generateSequences vtkzstd_ZSTD_generateSequences
+#define ZSTD_getBlockSize vtkzstd_ZSTD_getBlockSize
+#define ZSTD_getCParams vtkzstd_ZSTD_getCParams
+#define ZSTD_getDecompressedSize vtkzstd_ZSTD_getDecompressedSize
+#define ZSTD_getDictID_fromCDict vtkzstd_ZSTD_getDictID_fromCDict
+#define ZSTD_getDictID_fromDDict vtkzstd_ZSTD_getDictID_fromDDict
+#define ZSTD_getDictID_fromDict vtkzstd_ZSTD_getDictID_fromDict
+#define ZSTD_getDictID_fromFrame vtkzstd_ZSTD_getDictID_fromFrame
+#define ZSTD_getErrorCode vtkzstd_ZSTD_getErrorCode
+#define ZSTD_getErrorName vtkzstd_ZSTD_getErrorName
+#define ZSTD_getErrorString vtkzstd_ZSTD_getErrorString
+#define ZSTD_getFrameContentSize vtkzstd_ZSTD_getFrameContentSize
+#define ZSTD_getFrameHeader vtkzstd_ZSTD_getFrameHeader
+#define ZSTD_getFrameHeader_advanced vtkzstd_ZSTD_getFrameHeader_advanced
+#define ZSTD_getFrameProgression vtkzstd_ZSTD_getFrameProgression
+#define ZSTD_getParams vtkzstd_ZSTD_getParams
+#define ZSTD_initCStream vtkzstd_ZSTD_initCStream
+#define ZSTD_initCStream_advanced vtkzstd_ZSTD_initCStream_advanced
+#define ZSTD_initCStream_srcSize vtkzstd_ZSTD_initCStream_srcSize
+#define ZSTD_initCStream_usingCDict vtkzstd_ZSTD_initCStream_usingCDict
+#define ZSTD_initCStream_usingCDict_advanced vtkzstd_ZSTD_initCStream_usingCDict_advanced
+#define ZSTD_initCStream_usingDict vtkzstd_ZSTD_initCStream_usingDict
+#define ZSTD_initDStream vtkzstd_ZSTD_initDStream
+#define ZSTD_initDStream_usingDDict vtkzstd_ZSTD_initDStream_usingDDict
+#define ZSTD_initDStream_usingDict vtkzstd_ZSTD_initDStream_usingDict
+#define ZSTD_initStaticCCtx vtkzstd_ZSTD_initStaticCCtx
+#define ZSTD_initStaticCDict vtkzstd_ZSTD_initStaticCDict
+#define ZSTD_initStaticCStream vtkzstd_ZSTD_initStaticCStream
+#define ZSTD_initStaticDCtx vtkzstd_ZSTD_initStaticDCtx
+#define ZSTD_initStaticDDict vtkzstd_ZSTD_initStaticDDict
+#define ZSTD_initStaticDStream vtkzstd_ZSTD_initStaticDStream
+#define ZSTD_insertBlock vtkzstd_ZSTD_insertBlock
+#define ZSTD_isError vtkzstd_ZSTD_isError
+#define ZSTD_isFrame vtkzstd_ZSTD_isFrame
+#define ZSTD_isSkippableFrame vtkzstd_ZSTD_isSkippableFrame
+#define ZSTD_maxCLevel vtkzstd_ZSTD_maxCLevel
+#define ZSTD_mergeBlockDelimiters vtkzstd_ZSTD_mergeBlockDelimiters
+#define ZSTD_minCLevel vtkzstd_ZSTD_minCLevel
+#define ZSTD_nextInputType vtkzstd_ZSTD_nextInputType
+#define ZSTD_nextSrcSizeToDecompress vtkzstd_ZSTD_nextSrcSizeToDecompress
+#define ZSTD_readSkippableFrame vtkzstd_ZSTD_readSkippableFrame
+#define ZSTD_registerSequenceProducer vtkzstd_ZSTD_registerSequenceProducer
+#define ZSTD_resetCStream vtkzstd_ZSTD_resetCStream
+#define ZSTD_resetDStream vtkzstd_ZSTD_resetDStream
+#define ZSTD_sequenceBound vtkzstd_ZSTD_sequenceBound
+#define ZSTD_sizeof_CCtx vtkzstd_ZSTD_sizeof_CCtx
+#define ZSTD_sizeof_CDict vtkzstd_ZSTD_sizeof_CDict
+#define ZSTD_sizeof_CStream vtkzstd_ZSTD_sizeof_CStream
+#define ZSTD_sizeof_DCtx vtkzstd_ZSTD_sizeof_DCtx
+#define ZSTD_sizeof_DDict vtkzstd_ZSTD_sizeof_DDict
+#define ZSTD_sizeof_DStream vtkzstd_ZSTD_sizeof_DStream
+#define ZSTD_toFlushNow vtkzstd_ZSTD_toFlushNow
+#define ZSTD_versionNumber vtkzstd_ZSTD_versionNumber
+#define ZSTD_versionString vtkzstd_ZSTD_versionString
+#define ZSTD_writeSkippableFrame vtkzstd_ZSTD_writeSkippableFrame
+
+#endif
@@ -0,0 +1,339 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "VTK::WrappingTools" for configuration "Release"
+set_property(TARGET VTK::WrappingTools APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::WrappingTools PROPERTIES
+  IMPORTED_LINK_INTERFACE_LANGUAGES_RELEASE "C"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkWrappingTools-8.90.a"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::WrappingTools )
+list(APPEND _cmake_import_check_files_for_VTK::WrappingTools "${_IMPORT_PREFIX}/lib/libvtkWrappingTools-8.90.a" )
+
+# Import target "VTK::WrapHierarchy" for configuration "Release"
+set_property(TARGET VTK::WrapHierarchy APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::WrapHierarchy PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/vtkWrapHierarchy-8.90"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::WrapHierarchy )
+list(APPEND _cmake_import_check_files_for_VTK::WrapHierarchy "${_IMPORT_PREFIX}/bin/vtkWrapHierarchy-8.90" )
+
+# Import target "VTK::WrapPython" for configuration "Release"
+set_property(TARGET VTK::WrapPython APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::WrapPython PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/vtkWrapPython-8.90"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::WrapPython )
+list(APPEND _cmake_import_check_files_for_VTK::WrapPython "${_IMPORT_PREFIX}/bin/vtkWrapPython-8.90" )
+
+# Import target "VTK::WrapPythonInit" for configuration "Release"
+set_property(TARGET VTK::WrapPythonInit APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::WrapPythonInit PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/vtkWrapPythonInit-8.90"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::WrapPythonInit )
+list(APPEND _cmake_import_check_files_for_VTK::WrapPythonInit "${_IMPORT_PREFIX}/bin/vtkWrapPythonInit-8.90" )
+
+# Import target "VTK::ParseJava" for configuration "Release"
+set_property(TARGET VTK::ParseJava APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::ParseJava PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/vtkParseJava-8.90"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::ParseJava )
+list(APPEND _cmake_import_check_files_for_VTK::ParseJava "${_IMPORT_PREFIX}/bin/vtkParseJava-8.90" )
+
+# Import target "VTK::WrapJava" for configuration "Release"
+set_property(TARGET VTK::WrapJava APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::WrapJava PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/bin/vtkWrapJava-8.90"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::WrapJava )
+list(APPEND _cmake_import_check_files_for_VTK::WrapJava "${_IMPORT_PREFIX}/bin/vtkWrapJava-8.90" )
+
+# Import target "VTK::loguru" for configuration "Release"
+set_property(TARGET VTK::loguru APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::loguru PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkloguru-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkloguru-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::loguru )
+list(APPEND _cmake_import_check_files_for_VTK::loguru "${_IMPORT_PREFIX}/lib/libvtkloguru-8.90.so.8.90.0" )
+
+# Import target "VTK::vtksys" for configuration "Release"
+set_property(TARGET VTK::vtksys APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::vtksys PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtksys-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtksys-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::vtksys )
+list(APPEND _cmake_import_check_files_for_VTK::vtksys "${_IMPORT_PREFIX}/lib/libvtksys-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonCore" for configuration "Release"
+set_property(TARGET VTK::CommonCore APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonCore PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::loguru"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonCore-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonCore-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonCore )
+list(APPEND _cmake_import_check_files_for_VTK::CommonCore "${_IMPORT_PREFIX}/lib/libvtkCommonCore-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonMath" for configuration "Release"
+set_property(TARGET VTK::CommonMath APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonMath PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonMath-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonMath-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonMath )
+list(APPEND _cmake_import_check_files_for_VTK::CommonMath "${_IMPORT_PREFIX}/lib/libvtkCommonMath-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonTransforms" for configuration "Release"
+set_property(TARGET VTK::CommonTransforms APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonTransforms PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonTransforms-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonTransforms-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonTransforms )
+list(APPEND _cmake_import_check_files_for_VTK::CommonTransforms "${_IMPORT_PREFIX}/lib/libvtkCommonTransforms-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonMisc" for configuration "Release"
+set_property(TARGET VTK::CommonMisc APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonMisc PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonMisc-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonMisc-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonMisc )
+list(APPEND _cmake_import_check_files_for_VTK::CommonMisc "${_IMPORT_PREFIX}/lib/libvtkCommonMisc-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonSystem" for configuration "Release"
+set_property(TARGET VTK::CommonSystem APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonSystem PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonSystem-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonSystem-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonSystem )
+list(APPEND _cmake_import_check_files_for_VTK::CommonSystem "${_IMPORT_PREFIX}/lib/libvtkCommonSystem-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonDataModel" for configuration "Release"
+set_property(TARGET VTK::CommonDataModel APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonDataModel PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonMisc;VTK::CommonSystem;VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonDataModel-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonDataModel-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonDataModel )
+list(APPEND _cmake_import_check_files_for_VTK::CommonDataModel "${_IMPORT_PREFIX}/lib/libvtkCommonDataModel-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonExecutionModel" for configuration "Release"
+set_property(TARGET VTK::CommonExecutionModel APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonExecutionModel PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonMisc;VTK::CommonSystem"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonExecutionModel-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonExecutionModel )
+list(APPEND _cmake_import_check_files_for_VTK::CommonExecutionModel "${_IMPORT_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so.8.90.0" )
+
+# Import target "VTK::FiltersCore" for configuration "Release"
+set_property(TARGET VTK::FiltersCore APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::FiltersCore PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonMath;VTK::CommonSystem;VTK::CommonTransforms;VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkFiltersCore-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkFiltersCore-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::FiltersCore )
+list(APPEND _cmake_import_check_files_for_VTK::FiltersCore "${_IMPORT_PREFIX}/lib/libvtkFiltersCore-8.90.so.8.90.0" )
+
+# Import target "VTK::CommonComputationalGeometry" for configuration "Release"
+set_property(TARGET VTK::CommonComputationalGeometry APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::CommonComputationalGeometry PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkCommonComputationalGeometry-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::CommonComputationalGeometry )
+list(APPEND _cmake_import_check_files_for_VTK::CommonComputationalGeometry "${_IMPORT_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0" )
+
+# Import target "VTK::FiltersGeneral" for configuration "Release"
+set_property(TARGET VTK::FiltersGeneral APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::FiltersGeneral PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonComputationalGeometry;VTK::CommonMath;VTK::CommonSystem;VTK::CommonTransforms"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkFiltersGeneral-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkFiltersGeneral-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::FiltersGeneral )
+list(APPEND _cmake_import_check_files_for_VTK::FiltersGeneral "${_IMPORT_PREFIX}/lib/libvtkFiltersGeneral-8.90.so.8.90.0" )
+
+# Import target "VTK::FiltersSources" for configuration "Release"
+set_property(TARGET VTK::FiltersSources APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::FiltersSources PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonComputationalGeometry;VTK::CommonCore;VTK::CommonTransforms;VTK::FiltersCore;VTK::FiltersGeneral"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkFiltersSources-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkFiltersSources-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::FiltersSources )
+list(APPEND _cmake_import_check_files_for_VTK::FiltersSources "${_IMPORT_PREFIX}/lib/libvtkFiltersSources-8.90.so.8.90.0" )
+
+# Import target "VTK::FiltersModeling" for configuration "Release"
+set_property(TARGET VTK::FiltersModeling APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::FiltersModeling PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonCore;VTK::CommonDataModel;VTK::CommonTransforms;VTK::FiltersCore;VTK::FiltersSources"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkFiltersModeling-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkFiltersModeling-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::FiltersModeling )
+list(APPEND _cmake_import_check_files_for_VTK::FiltersModeling "${_IMPORT_PREFIX}/lib/libvtkFiltersModeling-8.90.so.8.90.0" )
+
+# Import target "VTK::FiltersPoints" for configuration "Release"
+set_property(TARGET VTK::FiltersPoints APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::FiltersPoints PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkFiltersPoints-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkFiltersPoints-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::FiltersPoints )
+list(APPEND _cmake_import_check_files_for_VTK::FiltersPoints "${_IMPORT_PREFIX}/lib/libvtkFiltersPoints-8.90.so.8.90.0" )
+
+# Import target "VTK::FiltersGeometry" for configuration "Release"
+set_property(TARGET VTK::FiltersGeometry APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::FiltersGeometry PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::FiltersCore;VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkFiltersGeometry-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkFiltersGeometry-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::FiltersGeometry )
+list(APPEND _cmake_import_check_files_for_VTK::FiltersGeometry "${_IMPORT_PREFIX}/lib/libvtkFiltersGeometry-8.90.so.8.90.0" )
+
+# Import target "VTK::doubleconversion" for configuration "Release"
+set_property(TARGET VTK::doubleconversion APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::doubleconversion PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkdoubleconversion-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkdoubleconversion-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::doubleconversion )
+list(APPEND _cmake_import_check_files_for_VTK::doubleconversion "${_IMPORT_PREFIX}/lib/libvtkdoubleconversion-8.90.so.8.90.0" )
+
+# Import target "VTK::lz4" for configuration "Release"
+set_property(TARGET VTK::lz4 APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::lz4 PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtklz4-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtklz4-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::lz4 )
+list(APPEND _cmake_import_check_files_for_VTK::lz4 "${_IMPORT_PREFIX}/lib/libvtklz4-8.90.so.8.90.0" )
+
+# Import target "VTK::lzma" for configuration "Release"
+set_property(TARGET VTK::lzma APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::lzma PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtklzma-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtklzma-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::lzma )
+list(APPEND _cmake_import_check_files_for_VTK::lzma "${_IMPORT_PREFIX}/lib/libvtklzma-8.90.so.8.90.0" )
+
+# Import target "VTK::zlib" for configuration "Release"
+set_property(TARGET VTK::zlib APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::zlib PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkzlib-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkzlib-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::zlib )
+list(APPEND _cmake_import_check_files_for_VTK::zlib "${_IMPORT_PREFIX}/lib/libvtkzlib-8.90.so.8.90.0" )
+
+# Import target "VTK::zstd" for configuration "Release"
+set_property(TARGET VTK::zstd APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::zstd PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkzstd-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkzstd-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::zstd )
+list(APPEND _cmake_import_check_files_for_VTK::zstd "${_IMPORT_PREFIX}/lib/libvtkzstd-8.90.so.8.90.0" )
+
+# Import target "VTK::IOCore" for configuration "Release"
+set_property(TARGET VTK::IOCore APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::IOCore PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonDataModel;VTK::CommonMisc;VTK::doubleconversion;VTK::lz4;VTK::lzma;VTK::vtksys;VTK::zlib;VTK::zstd"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkIOCore-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkIOCore-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::IOCore )
+list(APPEND _cmake_import_check_files_for_VTK::IOCore "${_IMPORT_PREFIX}/lib/libvtkIOCore-8.90.so.8.90.0" )
+
+# Import target "VTK::FiltersFlowPaths" for configuration "Release"
+set_property(TARGET VTK::FiltersFlowPaths APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::FiltersFlowPaths PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::FiltersCore;VTK::FiltersGeometry;VTK::FiltersSources;VTK::IOCore"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkFiltersFlowPaths-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkFiltersFlowPaths-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::FiltersFlowPaths )
+list(APPEND _cmake_import_check_files_for_VTK::FiltersFlowPaths "${_IMPORT_PREFIX}/lib/libvtkFiltersFlowPaths-8.90.so.8.90.0" )
+
+# Import target "VTK::expat" for configuration "Release"
+set_property(TARGET VTK::expat APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::expat PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkexpat-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkexpat-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::expat )
+list(APPEND _cmake_import_check_files_for_VTK::expat "${_IMPORT_PREFIX}/lib/libvtkexpat-8.90.so.8.90.0" )
+
+# Import target "VTK::IOXMLParser" for configuration "Release"
+set_property(TARGET VTK::IOXMLParser APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::IOXMLParser PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::IOCore;VTK::expat;VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkIOXMLParser-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkIOXMLParser-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::IOXMLParser )
+list(APPEND _cmake_import_check_files_for_VTK::IOXMLParser "${_IMPORT_PREFIX}/lib/libvtkIOXMLParser-8.90.so.8.90.0" )
+
+# Import target "VTK::IOXML" for configuration "Release"
+set_property(TARGET VTK::IOXML APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(VTK::IOXML PROPERTIES
+  IMPORTED_LINK_DEPENDENT_LIBRARIES_RELEASE "VTK::CommonDataModel;VTK::CommonMisc;VTK::CommonSystem;VTK::IOCore;VTK::vtksys"
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libvtkIOXML-8.90.so.8.90.0"
+  IMPORTED_SONAME_RELEASE "libvtkIOXML-8.90.so.1"
+  )
+
+list(APPEND _cmake_import_check_targets VTK::IOXML )
+list(APPEND _cmake_import_check_files_for_VTK::IOXML "${_IMPORT_PREFIX}/lib/libvtkIOXML-8.90.so.8.90.0" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,347 @@
+# Generated by CMake
+
+if("${CMAKE_MAJOR_VERSION}.${CMAKE_MINOR_VERSION}" LESS 2.8)
+   message(FATAL_ERROR "CMake >= 2.8.0 required")
+endif()
+if(CMAKE_VERSION VERSION_LESS "2.8.3")
+   message(FATAL_ERROR "CMake >= 2.8.3 required")
+endif()
+cmake_policy(PUSH)
+cmake_policy(VERSION 2.8.3...3.23)
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Protect against multiple inclusion, which would fail when already imported targets are added once more.
+set(_cmake_targets_defined "")
+set(_cmake_targets_not_defined "")
+set(_cmake_expected_targets "")
+foreach(_cmake_expected_target IN ITEMS VTK::WrappingTools VTK::WrapHierarchy VTK::WrapPython VTK::WrapPythonInit VTK::ParseJava VTK::WrapJava VTK::loguru VTK::kwiml VTK::vtksys VTK::utf8 VTK::CommonCore VTK::CommonMath VTK::CommonTransforms VTK::CommonMisc VTK::CommonSystem VTK::CommonDataModel VTK::CommonExecutionModel VTK::FiltersCore VTK::CommonComputationalGeometry VTK::FiltersGeneral VTK::FiltersSources VTK::FiltersModeling VTK::FiltersPoints VTK::FiltersGeometry VTK::doubleconversion VTK::lz4 VTK::lzma VTK::zlib VTK::zstd VTK::IOCore VTK::FiltersFlowPaths VTK::expat VTK::IOXMLParser VTK::IOXML)
+  list(APPEND _cmake_expected_targets "${_cmake_expected_target}")
+  if(TARGET "${_cmake_expected_target}")
+    list(APPEND _cmake_targets_defined "${_cmake_expected_target}")
+  else()
+    list(APPEND _cmake_targets_not_defined "${_cmake_expected_target}")
+  endif()
+endforeach()
+unset(_cmake_expected_target)
+if(_cmake_targets_defined STREQUAL _cmake_expected_targets)
+  unset(_cmake_targets_defined)
+  unset(_cmake_targets_not_defined)
+  unset(_cmake_expected_targets)
+  unset(CMAKE_IMPORT_FILE_VERSION)
+  cmake_policy(POP)
+  return()
+endif()
+if(NOT _cmake_targets_defined STREQUAL "")
+  string(REPLACE ";" ", " _cmake_targets_defined_text "${_cmake_targets_defined}")
+  string(REPLACE ";" ", " _cmake_targets_not_defined_text "${_cmake_targets_not_defined}")
+  message(FATAL_ERROR "Some (but not all) targets in this export set were already defined.\nTargets Defined: ${_cmake_targets_defined_text}\nTargets not yet defined: ${_cmake_targets_not_defined_text}\n")
+endif()
+unset(_cmake_targets_defined)
+unset(_cmake_targets_not_defined)
+unset(_cmake_expected_targets)
+
+
+# Compute the installation prefix relative to this file.
+get_filename_component(_IMPORT_PREFIX "${CMAKE_CURRENT_LIST_FILE}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+get_filename_component(_IMPORT_PREFIX "${_IMPORT_PREFIX}" PATH)
+if(_IMPORT_PREFIX STREQUAL "/")
+  set(_IMPORT_PREFIX "")
+endif()
+
+# Create imported target VTK::WrappingTools
+add_library(VTK::WrappingTools STATIC IMPORTED)
+
+set_target_properties(VTK::WrappingTools PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+)
+
+# Create imported target VTK::WrapHierarchy
+add_executable(VTK::WrapHierarchy IMPORTED)
+
+# Create imported target VTK::WrapPython
+add_executable(VTK::WrapPython IMPORTED)
+
+# Create imported target VTK::WrapPythonInit
+add_executable(VTK::WrapPythonInit IMPORTED)
+
+# Create imported target VTK::ParseJava
+add_executable(VTK::ParseJava IMPORTED)
+
+# Create imported target VTK::WrapJava
+add_executable(VTK::WrapJava IMPORTED)
+
+# Create imported target VTK::loguru
+add_library(VTK::loguru SHARED IMPORTED)
+
+set_target_properties(VTK::loguru PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::kwiml
+add_library(VTK::kwiml INTERFACE IMPORTED)
+
+set_target_properties(VTK::kwiml PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::vtksys
+add_library(VTK::vtksys SHARED IMPORTED)
+
+set_target_properties(VTK::vtksys PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_LINK_LIBRARIES "dl;dl"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::utf8
+add_library(VTK::utf8 INTERFACE IMPORTED)
+
+set_target_properties(VTK::utf8 PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::CommonCore
+add_library(VTK::CommonCore SHARED IMPORTED)
+
+set_target_properties(VTK::CommonCore PROPERTIES
+  INTERFACE_COMPILE_FEATURES "cxx_std_11"
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::kwiml;VTK::vtksys;Threads::Threads"
+)
+
+# Create imported target VTK::CommonMath
+add_library(VTK::CommonMath SHARED IMPORTED)
+
+set_target_properties(VTK::CommonMath PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore"
+)
+
+# Create imported target VTK::CommonTransforms
+add_library(VTK::CommonTransforms SHARED IMPORTED)
+
+set_target_properties(VTK::CommonTransforms PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonMath"
+)
+
+# Create imported target VTK::CommonMisc
+add_library(VTK::CommonMisc SHARED IMPORTED)
+
+set_target_properties(VTK::CommonMisc PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonMath"
+)
+
+# Create imported target VTK::CommonSystem
+add_library(VTK::CommonSystem SHARED IMPORTED)
+
+set_target_properties(VTK::CommonSystem PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore"
+)
+
+# Create imported target VTK::CommonDataModel
+add_library(VTK::CommonDataModel SHARED IMPORTED)
+
+set_target_properties(VTK::CommonDataModel PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonMath;VTK::CommonTransforms"
+)
+
+# Create imported target VTK::CommonExecutionModel
+add_library(VTK::CommonExecutionModel SHARED IMPORTED)
+
+set_target_properties(VTK::CommonExecutionModel PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonDataModel"
+)
+
+# Create imported target VTK::FiltersCore
+add_library(VTK::FiltersCore SHARED IMPORTED)
+
+set_target_properties(VTK::FiltersCore PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonDataModel;VTK::CommonExecutionModel;VTK::CommonMisc"
+)
+
+# Create imported target VTK::CommonComputationalGeometry
+add_library(VTK::CommonComputationalGeometry SHARED IMPORTED)
+
+set_target_properties(VTK::CommonComputationalGeometry PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonDataModel"
+)
+
+# Create imported target VTK::FiltersGeneral
+add_library(VTK::FiltersGeneral SHARED IMPORTED)
+
+set_target_properties(VTK::FiltersGeneral PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonDataModel;VTK::CommonExecutionModel;VTK::CommonMisc;VTK::FiltersCore"
+)
+
+# Create imported target VTK::FiltersSources
+add_library(VTK::FiltersSources SHARED IMPORTED)
+
+set_target_properties(VTK::FiltersSources PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonDataModel;VTK::CommonExecutionModel"
+)
+
+# Create imported target VTK::FiltersModeling
+add_library(VTK::FiltersModeling SHARED IMPORTED)
+
+set_target_properties(VTK::FiltersModeling PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonExecutionModel;VTK::CommonMisc;VTK::FiltersGeneral"
+)
+
+# Create imported target VTK::FiltersPoints
+add_library(VTK::FiltersPoints SHARED IMPORTED)
+
+set_target_properties(VTK::FiltersPoints PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonExecutionModel;VTK::CommonMisc;VTK::FiltersModeling"
+)
+
+# Create imported target VTK::FiltersGeometry
+add_library(VTK::FiltersGeometry SHARED IMPORTED)
+
+set_target_properties(VTK::FiltersGeometry PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonDataModel;VTK::CommonExecutionModel"
+)
+
+# Create imported target VTK::doubleconversion
+add_library(VTK::doubleconversion SHARED IMPORTED)
+
+set_target_properties(VTK::doubleconversion PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::lz4
+add_library(VTK::lz4 SHARED IMPORTED)
+
+set_target_properties(VTK::lz4 PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::lzma
+add_library(VTK::lzma SHARED IMPORTED)
+
+set_target_properties(VTK::lzma PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::zlib
+add_library(VTK::zlib SHARED IMPORTED)
+
+set_target_properties(VTK::zlib PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::zstd
+add_library(VTK::zstd SHARED IMPORTED)
+
+set_target_properties(VTK::zstd PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::IOCore
+add_library(VTK::IOCore SHARED IMPORTED)
+
+set_target_properties(VTK::IOCore PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonExecutionModel"
+)
+
+# Create imported target VTK::FiltersFlowPaths
+add_library(VTK::FiltersFlowPaths SHARED IMPORTED)
+
+set_target_properties(VTK::FiltersFlowPaths PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonDataModel;VTK::CommonExecutionModel;VTK::CommonMath"
+)
+
+# Create imported target VTK::expat
+add_library(VTK::expat SHARED IMPORTED)
+
+set_target_properties(VTK::expat PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90;${_IMPORT_PREFIX}/include/vtk-8.90/"
+  INTERFACE_SYSTEM_INCLUDE_DIRECTORIES "include/vtk-8.90/"
+)
+
+# Create imported target VTK::IOXMLParser
+add_library(VTK::IOXMLParser SHARED IMPORTED)
+
+set_target_properties(VTK::IOXMLParser PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonDataModel"
+)
+
+# Create imported target VTK::IOXML
+add_library(VTK::IOXML SHARED IMPORTED)
+
+set_target_properties(VTK::IOXML PROPERTIES
+  INTERFACE_INCLUDE_DIRECTORIES "${_IMPORT_PREFIX}/include/vtk-8.90"
+  INTERFACE_LINK_LIBRARIES "VTK::CommonCore;VTK::CommonExecutionModel;VTK::IOXMLParser"
+)
+
+if(CMAKE_VERSION VERSION_LESS 3.0.0)
+  message(FATAL_ERROR "This file relies on consumers using CMake 3.0.0 or greater.")
+endif()
+
+# Load information for each installed configuration.
+file(GLOB _cmake_config_files "${CMAKE_CURRENT_LIST_DIR}/VTK-targets-*.cmake")
+foreach(_cmake_config_file IN LISTS _cmake_config_files)
+  include("${_cmake_config_file}")
+endforeach()
+unset(_cmake_config_file)
+unset(_cmake_config_files)
+
+# Cleanup temporary variables.
+set(_IMPORT_PREFIX)
+
+# Loop over all imported files and verify that they actually exist
+foreach(_cmake_target IN LISTS _cmake_import_check_targets)
+  foreach(_cmake_file IN LISTS "_cmake_import_check_files_for_${_cmake_target}")
+    if(NOT EXISTS "${_cmake_file}")
+      message(FATAL_ERROR "The imported target \"${_cmake_target}\" references the file
+   \"${_cmake_file}\"
+but this file does not exist.  Possible reasons include:
+* The file was deleted, renamed, or moved to another location.
+* An install or uninstall procedure did not complete successfully.
+* The installation package was faulty and contained
+   \"${CMAKE_CURRENT_LIST_FILE}\"
+but not all the files it references.
+")
+    endif()
+  endforeach()
+  unset(_cmake_file)
+  unset("_cmake_import_check_files_for_${_cmake_target}")
+endforeach()
+unset(_cmake_target)
+unset(_cmake_import_check_targets)
+
+# This file does not depend on other imported targets which have
+# been exported from the same project but in a separate export set.
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
+cmake_policy(POP)
@@ -0,0 +1,821 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/Accelerators/Vtkm/vtk.module"
+  "/root/repo/CMake/CTestCustom.cmake.in"
+  "/root/repo/CMake/CheckCXXSourceRuns.cmake"
+  "/root/repo/CMake/FindEXPAT.cmake"
+  "/root/repo/CMake/FindEigen3.cmake"
+  "/root/repo/CMake/FindFFMPEG.cmake"
+  "/root/repo/CMake/FindFontConfig.cmake"
+  "/root/repo/CMake/FindFreetype.cmake"
+  "/root/repo/CMake/FindGL2PS.cmake"
+  "/root/repo/CMake/FindGLEW.cmake"
+  "/root/repo/CMake/FindJsonCpp.cmake"
+  "/root/repo/CMake/FindLZ4.cmake"
+  "/root/repo/CMake/FindLZMA.cmake"
+  "/root/repo/CMake/FindLibHaru.cmake"
+  "/root/repo/CMake/FindLibPROJ.cmake"
+  "/root/repo/CMake/FindLibXml2.cmake"
+  "/root/repo/CMake/FindMySQL.cmake"
+  "/root/repo/CMake/FindNetCDF.cmake"
+  "/root/repo/CMake/FindODBC.cmake"
+  "/root/repo/CMake/FindOGG.cmake"
+  "/root/repo/CMake/FindOSMesa.cmake"
+  "/root/repo/CMake/FindOpenMP.cmake"
+  "/root/repo/CMake/FindOpenSlide.cmake"
+  "/root/repo/CMake/FindOpenVR.cmake"
+  "/root/repo/CMake/FindPostgreSQL.cmake"
+  "/root/repo/CMake/FindTBB.cmake"
+  "/root/repo/CMake/FindTHEORA.cmake"
+  "/root/repo/CMake/FindZSTD.cmake"
+  "/root/repo/CMake/Finddouble-conversion.cmake"
+  "/root/repo/CMake/Findmpi4py.cmake"
+  "/root/repo/CMake/Findutf8cpp.cmake"
+  "/root/repo/CMake/patches/3.13/FindZLIB.cmake"
+  "/root/repo/CMake/patches/3.16/FindMPI.cmake"
+  "/root/repo/CMake/patches/3.16/FindMPI/fortranparam_mpi.f90.in"
+  "/root/repo/CMake/patches/3.16/FindMPI/libver_mpi.c"
+  "/root/repo/CMake/patches/3.16/FindMPI/libver_mpi.f90.in"
+  "/root/repo/CMake/patches/3.16/FindMPI/mpiver.f90.in"
+  "/root/repo/CMake/patches/3.16/FindMPI/test_mpi.c"
+  "/root/repo/CMake/patches/3.16/FindMPI/test_mpi.f90.in"
+  "/root/repo/CMake/patches/99/FindGDAL.cmake"
+  "/root/repo/CMake/patches/99/FindHDF5.cmake"
+  "/root/repo/CMake/patches/99/FindJPEG.cmake"
+  "/root/repo/CMake/patches/99/FindOpenGL.cmake"
+  "/root/repo/CMake/patches/99/FindPython/Support.cmake"
+  "/root/repo/CMake/patches/99/FindPython2.cmake"
+  "/root/repo/CMake/patches/99/FindPython3.cmake"
+  "/root/repo/CMake/patches/99/FindSQLite3.cmake"
+  "/root/repo/CMake/patches/99/FindX11.cmake"
+  "/root/repo/CMake/vtk-config.cmake.in"
+  "/root/repo/CMake/vtkBuildPath.cmake"
+  "/root/repo/CMake/vtkCMakeBackports.cmake"
+  "/root/repo/CMake/vtkCompilerChecks.cmake"
+  "/root/repo/CMake/vtkCompilerDynamicAnalysisFlags.cmake"
+  "/root/repo/CMake/vtkCompilerExtraFlags.cmake"
+  "/root/repo/CMake/vtkCompilerPlatformFlags.cmake"
+  "/root/repo/CMake/vtkCrossCompiling.cmake"
+  "/root/repo/CMake/vtkDetectLibraryType.cmake"
+  "/root/repo/CMake/vtkDirectories.cmake"
+  "/root/repo/CMake/vtkDownload.cmake"
+  "/root/repo/CMake/vtkEncodeString.cmake"
+  "/root/repo/CMake/vtkExternalData.cmake"
+  "/root/repo/CMake/vtkHashSource.cmake"
+  "/root/repo/CMake/vtkInitializeBuildType.cmake"
+  "/root/repo/CMake/vtkInstallCMakePackage.cmake"
+  "/root/repo/CMake/vtkInstallCMakePackageHelpers.cmake"
+  "/root/repo/CMake/vtkMobileDevices.cmake"
+  "/root/repo/CMake/vtkModule.cmake"
+  "/root/repo/CMake/vtkModuleDebugging.cmake"
+  "/root/repo/CMake/vtkModuleGraphviz.cmake"
+  "/root/repo/CMake/vtkModuleJson.cmake"
+  "/root/repo/CMake/vtkModuleRemote.cmake"
+  "/root/repo/CMake/vtkModuleTesting.cmake"
+  "/root/repo/CMake/vtkModuleWrapJava.cmake"
+  "/root/repo/CMake/vtkModuleWrapPython.cmake"
+  "/root/repo/CMake/vtkObjectFactory.cmake"
+  "/root/repo/CMake/vtkObjectFactory.cxx.in"
+  "/root/repo/CMake/vtkObjectFactory.h.in"
+  "/root/repo/CMake/vtkSupportMacros.cmake"
+  "/root/repo/CMake/vtkTesting.cmake"
+  "/root/repo/CMake/vtkTestingDriver.cmake"
+  "/root/repo/CMake/vtkTestingRenderingDriver.cmake"
+  "/root/repo/CMake/vtkTopologicalSort.cmake"
+  "/root/repo/CMake/vtkVersion.cmake"
+  "/root/repo/CMake/vtkWrapSettings.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/Charts/Core/vtk.module"
+  "/root/repo/Common/Color/vtk.module"
+  "/root/repo/Common/ComputationalGeometry/CMakeLists.txt"
+  "/root/repo/Common/ComputationalGeometry/vtk.module"
+  "/root/repo/Common/Core/CMakeLists.txt"
+  "/root/repo/Common/Core/SMP/STDThread/vtkSMPThreadLocal.h.in"
+  "/root/repo/Common/Core/SMP/STDThread/vtkSMPThreadLocalImpl.h.in"
+  "/root/repo/Common/Core/SMP/STDThread/vtkSMPToolsInternal.h.in"
+  "/root/repo/Common/Core/SMP/Sequential/vtkAtomic.h.in"
+  "/root/repo/Common/Core/vtk.kit"
+  "/root/repo/Common/Core/vtk.module"
+  "/root/repo/Common/Core/vtkArrayDispatchArrayList.h.in"
+  "/root/repo/Common/Core/vtkConfigure.h.in"
+  "/root/repo/Common/Core/vtkCreateArrayDispatchArrayList.cmake"
+  "/root/repo/Common/Core/vtkCreateTypeListMacros.cmake"
+  "/root/repo/Common/Core/vtkFloatingPointExceptionsConfigure.h.in"
+  "/root/repo/Common/Core/vtkMathConfigure.h.in"
+  "/root/repo/Common/Core/vtkSMPSelection.cmake"
+  "/root/repo/Common/Core/vtkTestBuiltins.cmake"
+  "/root/repo/Common/Core/vtkToolkits.h.in"
+  "/root/repo/Common/Core/vtkTypeArrays.cmake"
+  "/root/repo/Common/Core/vtkTypeListMacros.h.in"
+  "/root/repo/Common/Core/vtkTypedArray.cxx.in"
+  "/root/repo/Common/Core/vtkTypedArray.h.in"
+  "/root/repo/Common/Core/vtkVTK_USE_SCALED_SOA_ARRAYS.h.in"
+  "/root/repo/Common/Core/vtkVersionMacros.h.in"
+  "/root/repo/Common/DataModel/CMakeLists.txt"
+  "/root/repo/Common/DataModel/vtk.module"
+  "/root/repo/Common/ExecutionModel/CMakeLists.txt"
+  "/root/repo/Common/ExecutionModel/vtk.module"
+  "/root/repo/Common/Math/CMakeLists.txt"
+  "/root/repo/Common/Math/vtk.module"
+  "/root/repo/Common/Misc/CMakeLists.txt"
+  "/root/repo/Common/Misc/vtk.module"
+  "/root/repo/Common/System/CMakeLists.txt"
+  "/root/repo/Common/System/vtk.module"
+  "/root/repo/Common/System/vtkTestSocketFeatures.cmake"
+  "/root/repo/Common/Transforms/CMakeLists.txt"
+  "/root/repo/Common/Transforms/vtk.module"
+  "/root/repo/Domains/Chemistry/vtk.module"
+  "/root/repo/Domains/ChemistryOpenGL2/vtk.module"
+  "/root/repo/Domains/Microscopy/vtk.module"
+  "/root/repo/Domains/ParallelChemistry/vtk.module"
+  "/root/repo/Filters/AMR/vtk.module"
+  "/root/repo/Filters/Core/CMakeLists.txt"
+  "/root/repo/Filters/Core/vtk.kit"
+  "/root/repo/Filters/Core/vtk.module"
+  "/root/repo/Filters/Extraction/vtk.module"
+  "/root/repo/Filters/FlowPaths/CMakeLists.txt"
+  "/root/repo/Filters/FlowPaths/vtk.module"
+  "/root/repo/Filters/General/CMakeLists.txt"
+  "/root/repo/Filters/General/vtk.module"
+  "/root/repo/Filters/Generic/vtk.module"
+  "/root/repo/Filters/Geometry/CMakeLists.txt"
+  "/root/repo/Filters/Geometry/vtk.module"
+  "/root/repo/Filters/Hybrid/vtk.module"
+  "/root/repo/Filters/HyperTree/vtk.module"
+  "/root/repo/Filters/Imaging/vtk.module"
+  "/root/repo/Filters/Modeling/CMakeLists.txt"
+  "/root/repo/Filters/Modeling/vtk.module"
+  "/root/repo/Filters/OpenTURNS/vtk.module"
+  "/root/repo/Filters/Parallel/vtk.module"
+  "/root/repo/Filters/ParallelDIY2/vtk.module"
+  "/root/repo/Filters/ParallelFlowPaths/vtk.module"
+  "/root/repo/Filters/ParallelGeometry/vtk.module"
+  "/root/repo/Filters/ParallelImaging/vtk.module"
+  "/root/repo/Filters/ParallelMPI/vtk.module"
+  "/root/repo/Filters/ParallelStatistics/vtk.module"
+  "/root/repo/Filters/ParallelVerdict/vtk.module"
+  "/root/repo/Filters/Points/CMakeLists.txt"
+  "/root/repo/Filters/Points/vtk.module"
+  "/root/repo/Filters/Programmable/vtk.module"
+  "/root/repo/Filters/Python/vtk.module"
+  "/root/repo/Filters/ReebGraph/vtk.module"
+  "/root/repo/Filters/SMP/vtk.module"
+  "/root/repo/Filters/Selection/vtk.module"
+  "/root/repo/Filters/Sources/CMakeLists.txt"
+  "/root/repo/Filters/Sources/vtk.module"
+  "/root/repo/Filters/Statistics/vtk.module"
+  "/root/repo/Filters/Texture/vtk.module"
+  "/root/repo/Filters/Topology/vtk.module"
+  "/root/repo/Filters/Verdict/vtk.module"
+  "/root/repo/GUISupport/MFC/vtk.module"
+  "/root/repo/GUISupport/Qt/vtk.module"
+  "/root/repo/GUISupport/QtOpenGL/vtk.module"
+  "/root/repo/GUISupport/QtSQL/vtk.module"
+  "/root/repo/Geovis/Core/vtk.module"
+  "/root/repo/Geovis/GDAL/vtk.module"
+  "/root/repo/IO/ADIOS2/vtk.module"
+  "/root/repo/IO/AMR/vtk.module"
+  "/root/repo/IO/Asynchronous/vtk.module"
+  "/root/repo/IO/CityGML/vtk.module"
+  "/root/repo/IO/Core/CMakeLists.txt"
+  "/root/repo/IO/Core/vtk.kit"
+  "/root/repo/IO/Core/vtk.module"
+  "/root/repo/IO/EnSight/vtk.module"
+  "/root/repo/IO/Exodus/vtk.module"
+  "/root/repo/IO/Export/vtk.module"
+  "/root/repo/IO/ExportGL2PS/vtk.module"
+  "/root/repo/IO/ExportPDF/vtk.module"
+  "/root/repo/IO/FFMPEG/vtk.module"
+  "/root/repo/IO/GDAL/vtk.module"
+  "/root/repo/IO/GeoJSON/vtk.module"
+  "/root/repo/IO/Geometry/vtk.module"
+  "/root/repo/IO/H5part/vtk.module"
+  "/root/repo/IO/Image/vtk.module"
+  "/root/repo/IO/Import/vtk.module"
+  "/root/repo/IO/Infovis/vtk.module"
+  "/root/repo/IO/LAS/vtk.module"
+  "/root/repo/IO/LSDyna/vtk.module"
+  "/root/repo/IO/Legacy/vtk.module"
+  "/root/repo/IO/MINC/vtk.module"
+  "/root/repo/IO/MPIImage/vtk.module"
+  "/root/repo/IO/MPIParallel/vtk.module"
+  "/root/repo/IO/MotionFX/vtk.module"
+  "/root/repo/IO/Movie/vtk.module"
+  "/root/repo/IO/MySQL/vtk.module"
+  "/root/repo/IO/NetCDF/vtk.module"
+  "/root/repo/IO/ODBC/vtk.module"
+  "/root/repo/IO/OggTheora/vtk.module"
+  "/root/repo/IO/PDAL/vtk.module"
+  "/root/repo/IO/PLY/vtk.module"
+  "/root/repo/IO/Parallel/vtk.module"
+  "/root/repo/IO/ParallelExodus/vtk.module"
+  "/root/repo/IO/ParallelLSDyna/vtk.module"
+  "/root/repo/IO/ParallelNetCDF/vtk.module"
+  "/root/repo/IO/ParallelXML/vtk.module"
+  "/root/repo/IO/ParallelXdmf3/vtk.module"
+  "/root/repo/IO/PostgreSQL/vtk.module"
+  "/root/repo/IO/SQL/vtk.module"
+  "/root/repo/IO/SegY/vtk.module"
+  "/root/repo/IO/TRUCHAS/vtk.module"
+  "/root/repo/IO/TecplotTable/vtk.module"
+  "/root/repo/IO/VPIC/vtk.module"
+  "/root/repo/IO/VeraOut/vtk.module"
+  "/root/repo/IO/Video/vtk.module"
+  "/root/repo/IO/XML/CMakeLists.txt"
+  "/root/repo/IO/XML/vtk.module"
+  "/root/repo/IO/XMLParser/CMakeLists.txt"
+  "/root/repo/IO/XMLParser/vtk.module"
+  "/root/repo/IO/Xdmf2/vtk.module"
+  "/root/repo/IO/Xdmf3/vtk.module"
+  "/root/repo/Imaging/Color/vtk.module"
+  "/root/repo/Imaging/Core/vtk.kit"
+  "/root/repo/Imaging/Core/vtk.module"
+  "/root/repo/Imaging/Fourier/vtk.module"
+  "/root/repo/Imaging/General/vtk.module"
+  "/root/repo/Imaging/Hybrid/vtk.module"
+  "/root/repo/Imaging/Math/vtk.module"
+  "/root/repo/Imaging/Morphological/vtk.module"
+  "/root/repo/Imaging/OpenGL2/vtk.module"
+  "/root/repo/Imaging/Sources/vtk.module"
+  "/root/repo/Imaging/Statistics/vtk.module"
+  "/root/repo/Imaging/Stencil/vtk.module"
+  "/root/repo/Infovis/Boost/vtk.module"
+  "/root/repo/Infovis/BoostGraphAlgorithms/vtk.module"
+  "/root/repo/Infovis/Core/vtk.module"
+  "/root/repo/Infovis/Layout/vtk.module"
+  "/root/repo/Interaction/Image/vtk.module"
+  "/root/repo/Interaction/Style/vtk.kit"
+  "/root/repo/Interaction/Style/vtk.module"
+  "/root/repo/Interaction/Widgets/vtk.module"
+  "/root/repo/Parallel/Core/vtk.kit"
+  "/root/repo/Parallel/Core/vtk.module"
+  "/root/repo/Parallel/DIY/vtk.module"
+  "/root/repo/Parallel/MPI/vtk.module"
+  "/root/repo/Parallel/MPI4Py/vtk.module"
+  "/root/repo/Remote/CMakeLists.txt"
+  "/root/repo/Remote/MomentInvariants.remote.cmake"
+  "/root/repo/Remote/PoissonReconstruction.remote.cmake"
+  "/root/repo/Remote/Powercrust.remote.cmake"
+  "/root/repo/Remote/SignedTensor.remote.cmake"
+  "/root/repo/Remote/SplineDrivenImageSlicer.remote.cmake"
+  "/root/repo/Remote/vtkDICOM.remote.cmake"
+  "/root/repo/Rendering/Annotation/vtk.module"
+  "/root/repo/Rendering/Context2D/vtk.module"
+  "/root/repo/Rendering/ContextOpenGL2/vtk.module"
+  "/root/repo/Rendering/Core/vtk.kit"
+  "/root/repo/Rendering/Core/vtk.module"
+  "/root/repo/Rendering/External/vtk.module"
+  "/root/repo/Rendering/FreeType/vtk.module"
+  "/root/repo/Rendering/FreeTypeFontConfig/vtk.module"
+  "/root/repo/Rendering/GL2PSOpenGL2/vtk.module"
+  "/root/repo/Rendering/Image/vtk.module"
+  "/root/repo/Rendering/LICOpenGL2/vtk.module"
+  "/root/repo/Rendering/LOD/vtk.module"
+  "/root/repo/Rendering/Label/vtk.module"
+  "/root/repo/Rendering/Matplotlib/vtk.module"
+  "/root/repo/Rendering/OpenGL2/vtk.kit"
+  "/root/repo/Rendering/OpenGL2/vtk.module"
+  "/root/repo/Rendering/OpenVR/vtk.module"
+  "/root/repo/Rendering/Parallel/vtk.module"
+  "/root/repo/Rendering/ParallelLIC/vtk.module"
+  "/root/repo/Rendering/PythonContext2D/vtk.module"
+  "/root/repo/Rendering/Qt/vtk.module"
+  "/root/repo/Rendering/RayTracing/vtk.module"
+  "/root/repo/Rendering/SceneGraph/vtk.module"
+  "/root/repo/Rendering/Tk/vtk.module"
+  "/root/repo/Rendering/Volume/vtk.module"
+  "/root/repo/Rendering/VolumeAMR/vtk.module"
+  "/root/repo/Rendering/VolumeOpenGL2/vtk.module"
+  "/root/repo/Testing/Core/vtk.module"
+  "/root/repo/Testing/GenericBridge/vtk.module"
+  "/root/repo/Testing/IOSQL/vtk.module"
+  "/root/repo/Testing/Rendering/vtk.module"
+  "/root/repo/ThirdParty/diy2/vtk.module"
+  "/root/repo/ThirdParty/doubleconversion/CMakeLists.txt"
+  "/root/repo/ThirdParty/doubleconversion/vtk.module"
+  "/root/repo/ThirdParty/doubleconversion/vtk_doubleconversion.h.in"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/CMakeLists.txt"
+  "/root/repo/ThirdParty/eigen/vtk.module"
+  "/root/repo/ThirdParty/exodusII/vtk.module"
+  "/root/repo/ThirdParty/expat/CMakeLists.txt"
+  "/root/repo/ThirdParty/expat/vtk.module"
+  "/root/repo/ThirdParty/expat/vtk_expat.h.in"
+  "/root/repo/ThirdParty/expat/vtkexpat/CMakeLists.txt"
+  "/root/repo/ThirdParty/expat/vtkexpat/ConfigureChecks.cmake"
+  "/root/repo/ThirdParty/expat/vtkexpat/expat_config.h.cmake"
+  "/root/repo/ThirdParty/freetype/vtk.module"
+  "/root/repo/ThirdParty/gl2ps/vtk.module"
+  "/root/repo/ThirdParty/glew/vtk.module"
+  "/root/repo/ThirdParty/h5part/vtk.module"
+  "/root/repo/ThirdParty/hdf5/vtk.module"
+  "/root/repo/ThirdParty/jpeg/vtk.module"
+  "/root/repo/ThirdParty/jsoncpp/vtk.module"
+  "/root/repo/ThirdParty/kissfft/vtk.module"
+  "/root/repo/ThirdParty/libharu/vtk.module"
+  "/root/repo/ThirdParty/libproj/vtk.module"
+  "/root/repo/ThirdParty/libxml2/vtk.module"
+  "/root/repo/ThirdParty/loguru/CMakeLists.txt"
+  "/root/repo/ThirdParty/loguru/vtk.module"
+  "/root/repo/ThirdParty/loguru/vtk_loguru.h.in"
+  "/root/repo/ThirdParty/loguru/vtkloguru/CMakeLists.txt"
+  "/root/repo/ThirdParty/lz4/CMakeLists.txt"
+  "/root/repo/ThirdParty/lz4/vtk.module"
+  "/root/repo/ThirdParty/lz4/vtk_lz4.h.in"
+  "/root/repo/ThirdParty/lz4/vtklz4/CMakeLists.txt"
+  "/root/repo/ThirdParty/lzma/CMakeLists.txt"
+  "/root/repo/ThirdParty/lzma/vtk.module"
+  "/root/repo/ThirdParty/lzma/vtk_lzma.h.in"
+  "/root/repo/ThirdParty/lzma/vtklzma/CMakeLists.txt"
+  "/root/repo/ThirdParty/lzma/vtklzma/config.h.in"
+  "/root/repo/ThirdParty/mpi4py/vtk.module"
+  "/root/repo/ThirdParty/netcdf/vtk.module"
+  "/root/repo/ThirdParty/ogg/vtk.module"
+  "/root/repo/ThirdParty/pegtl/vtk.module"
+  "/root/repo/ThirdParty/png/vtk.module"
+  "/root/repo/ThirdParty/pugixml/vtk.module"
+  "/root/repo/ThirdParty/sqlite/vtk.module"
+  "/root/repo/ThirdParty/theora/vtk.module"
+  "/root/repo/ThirdParty/tiff/vtk.module"
+  "/root/repo/ThirdParty/utf8/CMakeLists.txt"
+  "/root/repo/ThirdParty/utf8/vtk.module"
+  "/root/repo/ThirdParty/utf8/vtk_utf8.h.in"
+  "/root/repo/ThirdParty/utf8/vtkutf8/CMakeLists.txt"
+  "/root/repo/ThirdParty/verdict/vtk.module"
+  "/root/repo/ThirdParty/vpic/vtk.module"
+  "/root/repo/ThirdParty/vtkm/vtk.module"
+  "/root/repo/ThirdParty/xdmf2/vtk.module"
+  "/root/repo/ThirdParty/xdmf3/vtk.module"
+  "/root/repo/ThirdParty/zfp/vtk.module"
+  "/root/repo/ThirdParty/zlib/CMakeLists.txt"
+  "/root/repo/ThirdParty/zlib/vtk.module"
+  "/root/repo/ThirdParty/zlib/vtk_zlib.h.in"
+  "/root/repo/ThirdParty/zlib/vtkzlib/CMakeLists.txt"
+  "/root/repo/ThirdParty/zlib/vtkzlib/zconf.h.cmakein"
+  "/root/repo/ThirdParty/zstd/CMakeLists.txt"
+  "/root/repo/ThirdParty/zstd/vtk.module"
+  "/root/repo/ThirdParty/zstd/vtk_zstd.h.in"
+  "/root/repo/ThirdParty/zstd/vtkzstd/CMakeLists.txt"
+  "/root/repo/Utilities/Benchmarks/vtk.module"
+  "/root/repo/Utilities/DICOMParser/vtk.module"
+  "/root/repo/Utilities/Java/vtk.module"
+  "/root/repo/Utilities/KWIML/CMakeLists.txt"
+  "/root/repo/Utilities/KWIML/vtk.module"
+  "/root/repo/Utilities/KWIML/vtkkwiml/CMakeLists.txt"
+  "/root/repo/Utilities/KWSys/CMakeLists.txt"
+  "/root/repo/Utilities/KWSys/vtk.module"
+  "/root/repo/Utilities/KWSys/vtksys/Base64.h.in"
+  "/root/repo/Utilities/KWSys/vtksys/CMakeLists.txt"
+  "/root/repo/Utilities/KWSys/vtksys/CommandLineArguments.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/Configure.h.in"
+  "/root/repo/Utilities/KWSys/vtksys/Configure.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/Directory.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/DynamicLoader.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/Encoding.h.in"
+  "/root/repo/Utilities/KWSys/vtksys/Encoding.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/FStream.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/Glob.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/MD5.h.in"
+  "/root/repo/Utilities/KWSys/vtksys/Process.h.in"
+  "/root/repo/Utilities/KWSys/vtksys/RegularExpression.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/SharedForward.h.in"
+  "/root/repo/Utilities/KWSys/vtksys/String.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/System.h.in"
+  "/root/repo/Utilities/KWSys/vtksys/SystemInformation.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/SystemTools.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/hash_fun.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/hash_map.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/hash_set.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/hashtable.hxx.in"
+  "/root/repo/Utilities/KWSys/vtksys/kwsysPlatformTests.cmake"
+  "/root/repo/Utilities/KWSys/vtksys/kwsysPrivate.h"
+  "/root/repo/Utilities/MPI/vtk.module"
+  "/root/repo/Utilities/MetaIO/vtk.module"
+  "/root/repo/Utilities/OpenGL/vtk.module"
+  "/root/repo/Utilities/Python/vtk.module"
+  "/root/repo/Utilities/PythonInterpreter/vtk.module"
+  "/root/repo/Utilities/octree/vtk.module"
+  "/root/repo/Views/Context2D/vtk.module"
+  "/root/repo/Views/Core/vtk.kit"
+  "/root/repo/Views/Core/vtk.module"
+  "/root/repo/Views/Infovis/vtk.module"
+  "/root/repo/Views/Qt/vtk.module"
+  "/root/repo/Web/Core/vtk.module"
+  "/root/repo/Web/Python/vtk.module"
+  "/root/repo/Web/WebGLExporter/vtk.module"
+  "/root/repo/Wrapping/PythonCore/vtk.module"
+  "/root/repo/Wrapping/Tools/CMakeLists.txt"
+  "/root/repo/Wrapping/Tools/vtk.module"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "lib/cmake/vtk-8.90/vtk-config-version.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/ExternalData.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalData_config.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPythonInterp.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Modules/VTKCompatibility.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "VTKData_config.cmake"
+  "lib/cmake/vtk-8.90/vtk-config.cmake"
+  "CMakeFiles/vtk-config.cmake"
+  "lib/cmake/vtk-8.90/vtk-config-version.cmake"
+  "vtk-config-version.cmake"
+  "lib/cmake/vtk-8.90/Finddouble-conversion.cmake"
+  "lib/cmake/vtk-8.90/FindEigen3.cmake"
+  "lib/cmake/vtk-8.90/FindEXPAT.cmake"
+  "lib/cmake/vtk-8.90/FindFFMPEG.cmake"
+  "lib/cmake/vtk-8.90/FindFontConfig.cmake"
+  "lib/cmake/vtk-8.90/FindFreetype.cmake"
+  "lib/cmake/vtk-8.90/FindGL2PS.cmake"
+  "lib/cmake/vtk-8.90/FindGLEW.cmake"
+  "lib/cmake/vtk-8.90/FindJsonCpp.cmake"
+  "lib/cmake/vtk-8.90/FindLibHaru.cmake"
+  "lib/cmake/vtk-8.90/FindLibPROJ.cmake"
+  "lib/cmake/vtk-8.90/FindLibXml2.cmake"
+  "lib/cmake/vtk-8.90/FindLZ4.cmake"
+  "lib/cmake/vtk-8.90/FindLZMA.cmake"
+  "lib/cmake/vtk-8.90/Findmpi4py.cmake"
+  "lib/cmake/vtk-8.90/FindMySQL.cmake"
+  "lib/cmake/vtk-8.90/FindNetCDF.cmake"
+  "lib/cmake/vtk-8.90/FindODBC.cmake"
+  "lib/cmake/vtk-8.90/FindOGG.cmake"
+  "lib/cmake/vtk-8.90/FindOpenMP.cmake"
+  "lib/cmake/vtk-8.90/FindOpenSlide.cmake"
+  "lib/cmake/vtk-8.90/FindOpenVR.cmake"
+  "lib/cmake/vtk-8.90/FindOSMesa.cmake"
+  "lib/cmake/vtk-8.90/FindPostgreSQL.cmake"
+  "lib/cmake/vtk-8.90/FindTBB.cmake"
+  "lib/cmake/vtk-8.90/FindTHEORA.cmake"
+  "lib/cmake/vtk-8.90/Findutf8cpp.cmake"
+  "lib/cmake/vtk-8.90/FindZSTD.cmake"
+  "lib/cmake/vtk-8.90/vtkCMakeBackports.cmake"
+  "lib/cmake/vtk-8.90/vtkDetectLibraryType.cmake"
+  "lib/cmake/vtk-8.90/vtkEncodeString.cmake"
+  "lib/cmake/vtk-8.90/vtkExternalData.cmake"
+  "lib/cmake/vtk-8.90/vtkHashSource.cmake"
+  "lib/cmake/vtk-8.90/vtkModule.cmake"
+  "lib/cmake/vtk-8.90/vtkModuleGraphviz.cmake"
+  "lib/cmake/vtk-8.90/vtkModuleJson.cmake"
+  "lib/cmake/vtk-8.90/vtkModuleTesting.cmake"
+  "lib/cmake/vtk-8.90/vtkModuleWrapJava.cmake"
+  "lib/cmake/vtk-8.90/vtkModuleWrapPython.cmake"
+  "lib/cmake/vtk-8.90/vtkObjectFactory.cmake"
+  "lib/cmake/vtk-8.90/vtkObjectFactory.cxx.in"
+  "lib/cmake/vtk-8.90/vtkObjectFactory.h.in"
+  "lib/cmake/vtk-8.90/vtkTestingDriver.cmake"
+  "lib/cmake/vtk-8.90/vtkTestingRenderingDriver.cmake"
+  "lib/cmake/vtk-8.90/vtkTopologicalSort.cmake"
+  "lib/cmake/vtk-8.90/patches/3.13/FindZLIB.cmake"
+  "lib/cmake/vtk-8.90/patches/3.16/FindMPI/fortranparam_mpi.f90.in"
+  "lib/cmake/vtk-8.90/patches/3.16/FindMPI/libver_mpi.c"
+  "lib/cmake/vtk-8.90/patches/3.16/FindMPI/libver_mpi.f90.in"
+  "lib/cmake/vtk-8.90/patches/3.16/FindMPI/mpiver.f90.in"
+  "lib/cmake/vtk-8.90/patches/3.16/FindMPI/test_mpi.c"
+  "lib/cmake/vtk-8.90/patches/3.16/FindMPI/test_mpi.f90.in"
+  "lib/cmake/vtk-8.90/patches/3.16/FindMPI.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindGDAL.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindHDF5.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindJPEG.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindOpenGL.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindPython/Support.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindPython2.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindPython3.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindSQLite3.cmake"
+  "lib/cmake/vtk-8.90/patches/99/FindX11.cmake"
+  "CTestCustom.cmake"
+  "modules.json"
+  "vtk-config.cmake"
+  "lib/cmake/vtk-8.90/vtk-find-package-helpers.cmake"
+  "unix_path.sh"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Remote/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Wrapping/Tools/vtkWrappingToolsModule.h"
+  "Wrapping/Tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/loguru/vtk_loguru.h"
+  "ThirdParty/loguru/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/loguru/vtkloguru/vtkloguru_export.h"
+  "ThirdParty/loguru/vtkloguru/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/KWIML/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/KWIML/vtkkwiml/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/KWSys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Utilities/KWSys/vtksys/kwsysPrivate.h"
+  "Utilities/KWSys/vtksys/Directory.hxx"
+  "Utilities/KWSys/vtksys/DynamicLoader.hxx"
+  "Utilities/KWSys/vtksys/Encoding.hxx"
+  "Utilities/KWSys/vtksys/Glob.hxx"
+  "Utilities/KWSys/vtksys/RegularExpression.hxx"
+  "Utilities/KWSys/vtksys/SystemTools.hxx"
+  "Utilities/KWSys/vtksys/CommandLineArguments.hxx"
+  "Utilities/KWSys/vtksys/FStream.hxx"
+  "Utilities/KWSys/vtksys/SystemInformation.hxx"
+  "Utilities/KWSys/vtksys/Configure.h"
+  "Utilities/KWSys/vtksys/SharedForward.h"
+  "Utilities/KWSys/vtksys/Process.h"
+  "Utilities/KWSys/vtksys/Base64.h"
+  "Utilities/KWSys/vtksys/Encoding.h"
+  "Utilities/KWSys/vtksys/MD5.h"
+  "Utilities/KWSys/vtksys/System.h"
+  "Utilities/KWSys/vtksys/Configure.hxx"
+  "Utilities/KWSys/vtksys/String.hxx"
+  "Utilities/KWSys/vtksys/hashtable.hxx"
+  "Utilities/KWSys/vtksys/hash_fun.hxx"
+  "Utilities/KWSys/vtksys/hash_map.hxx"
+  "Utilities/KWSys/vtksys/hash_set.hxx"
+  "Utilities/KWSys/vtksys/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/utf8/vtk_utf8.h"
+  "ThirdParty/utf8/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/utf8/vtkutf8/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/Core/vtkAtomic.h"
+  "Common/Core/vtkSMPThreadLocal.h"
+  "Common/Core/vtkSMPThreadLocalImpl.h"
+  "Common/Core/vtkSMPToolsInternal.h"
+  "Common/Core/vtkTypeListMacros.h"
+  "Common/Core/vtkArrayDispatchArrayList.h"
+  "Common/Core/vtkVTK_USE_SCALED_SOA_ARRAYS.h"
+  "Common/Core/vtkVersionMacros.h"
+  "Common/Core/vtkConfigure.h"
+  "Common/Core/vtkToolkits.h"
+  "Common/Core/vtkTypeInt8Array.h"
+  "Common/Core/vtkTypeInt8Array.cxx"
+  "Common/Core/vtkTypeInt16Array.h"
+  "Common/Core/vtkTypeInt16Array.cxx"
+  "Common/Core/vtkTypeInt32Array.h"
+  "Common/Core/vtkTypeInt32Array.cxx"
+  "Common/Core/vtkTypeInt64Array.h"
+  "Common/Core/vtkTypeInt64Array.cxx"
+  "Common/Core/vtkTypeUInt8Array.h"
+  "Common/Core/vtkTypeUInt8Array.cxx"
+  "Common/Core/vtkTypeUInt16Array.h"
+  "Common/Core/vtkTypeUInt16Array.cxx"
+  "Common/Core/vtkTypeUInt32Array.h"
+  "Common/Core/vtkTypeUInt32Array.cxx"
+  "Common/Core/vtkTypeUInt64Array.h"
+  "Common/Core/vtkTypeUInt64Array.cxx"
+  "Common/Core/vtkTypeFloat32Array.h"
+  "Common/Core/vtkTypeFloat32Array.cxx"
+  "Common/Core/vtkTypeFloat64Array.h"
+  "Common/Core/vtkTypeFloat64Array.cxx"
+  "Common/Core/vtkMathConfigure.h"
+  "Common/Core/vtkFloatingPointExceptionsConfigure.h"
+  "Common/Core/vtkCommonCoreModule.h"
+  "Common/Core/CMakeFiles/vtkCommonCore-hierarchy.Release.args"
+  "Common/Core/CMakeFiles/vtkCommonCore-hierarchy.depends.args"
+  "Common/Core/CMakeFiles/vtkCommonCore-hierarchy.data"
+  "Common/Core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/Math/vtkCommonMathModule.h"
+  "Common/Math/CMakeFiles/vtkCommonMath-hierarchy.Release.args"
+  "Common/Math/CMakeFiles/vtkCommonMath-hierarchy.depends.args"
+  "Common/Math/CMakeFiles/vtkCommonMath-hierarchy.data"
+  "Common/Math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/Transforms/vtkCommonTransformsModule.h"
+  "Common/Transforms/CMakeFiles/vtkCommonTransforms-hierarchy.Release.args"
+  "Common/Transforms/CMakeFiles/vtkCommonTransforms-hierarchy.depends.args"
+  "Common/Transforms/CMakeFiles/vtkCommonTransforms-hierarchy.data"
+  "Common/Transforms/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/Misc/vtkCommonMiscModule.h"
+  "Common/Misc/CMakeFiles/vtkCommonMisc-hierarchy.Release.args"
+  "Common/Misc/CMakeFiles/vtkCommonMisc-hierarchy.depends.args"
+  "Common/Misc/CMakeFiles/vtkCommonMisc-hierarchy.data"
+  "Common/Misc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/System/vtkCommonSystemModule.h"
+  "Common/System/CMakeFiles/vtkCommonSystem-hierarchy.Release.args"
+  "Common/System/CMakeFiles/vtkCommonSystem-hierarchy.depends.args"
+  "Common/System/CMakeFiles/vtkCommonSystem-hierarchy.data"
+  "Common/System/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/DataModel/vtkCommonDataModelModule.h"
+  "Common/DataModel/CMakeFiles/vtkCommonDataModel-hierarchy.Release.args"
+  "Common/DataModel/CMakeFiles/vtkCommonDataModel-hierarchy.depends.args"
+  "Common/DataModel/CMakeFiles/vtkCommonDataModel-hierarchy.data"
+  "Common/DataModel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/ExecutionModel/vtkCommonExecutionModelModule.h"
+  "Common/ExecutionModel/CMakeFiles/vtkCommonExecutionModel-hierarchy.Release.args"
+  "Common/ExecutionModel/CMakeFiles/vtkCommonExecutionModel-hierarchy.depends.args"
+  "Common/ExecutionModel/CMakeFiles/vtkCommonExecutionModel-hierarchy.data"
+  "Common/ExecutionModel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Filters/Core/vtkFiltersCoreModule.h"
+  "Filters/Core/CMakeFiles/vtkFiltersCore-hierarchy.Release.args"
+  "Filters/Core/CMakeFiles/vtkFiltersCore-hierarchy.depends.args"
+  "Filters/Core/CMakeFiles/vtkFiltersCore-hierarchy.data"
+  "Filters/Core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Common/ComputationalGeometry/vtkCommonComputationalGeometryModule.h"
+  "Common/ComputationalGeometry/CMakeFiles/vtkCommonComputationalGeometry-hierarchy.Release.args"
+  "Common/ComputationalGeometry/CMakeFiles/vtkCommonComputationalGeometry-hierarchy.depends.args"
+  "Common/ComputationalGeometry/CMakeFiles/vtkCommonComputationalGeometry-hierarchy.data"
+  "Common/ComputationalGeometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Filters/General/vtkFiltersGeneralModule.h"
+  "Filters/General/CMakeFiles/vtkFiltersGeneral-hierarchy.Release.args"
+  "Filters/General/CMakeFiles/vtkFiltersGeneral-hierarchy.depends.args"
+  "Filters/General/CMakeFiles/vtkFiltersGeneral-hierarchy.data"
+  "Filters/General/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Filters/Sources/vtkFiltersSourcesModule.h"
+  "Filters/Sources/CMakeFiles/vtkFiltersSources-hierarchy.Release.args"
+  "Filters/Sources/CMakeFiles/vtkFiltersSources-hierarchy.depends.args"
+  "Filters/Sources/CMakeFiles/vtkFiltersSources-hierarchy.data"
+  "Filters/Sources/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Filters/Modeling/vtkFiltersModelingModule.h"
+  "Filters/Modeling/CMakeFiles/vtkFiltersModeling-hierarchy.Release.args"
+  "Filters/Modeling/CMakeFiles/vtkFiltersModeling-hierarchy.depends.args"
+  "Filters/Modeling/CMakeFiles/vtkFiltersModeling-hierarchy.data"
+  "Filters/Modeling/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Filters/Points/vtkFiltersPointsModule.h"
+  "Filters/Points/CMakeFiles/vtkFiltersPoints-hierarchy.Release.args"
+  "Filters/Points/CMakeFiles/vtkFiltersPoints-hierarchy.depends.args"
+  "Filters/Points/CMakeFiles/vtkFiltersPoints-hierarchy.data"
+  "Filters/Points/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Filters/Geometry/vtkFiltersGeometryModule.h"
+  "Filters/Geometry/CMakeFiles/vtkFiltersGeometry-hierarchy.Release.args"
+  "Filters/Geometry/CMakeFiles/vtkFiltersGeometry-hierarchy.depends.args"
+  "Filters/Geometry/CMakeFiles/vtkFiltersGeometry-hierarchy.data"
+  "Filters/Geometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/doubleconversion/vtk_doubleconversion.h"
+  "ThirdParty/doubleconversion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/doubleconversion/vtkdoubleconversion/vtkdoubleconversion_export.h"
+  "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/lz4/vtk_lz4.h"
+  "ThirdParty/lz4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/lz4/vtklz4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/lzma/vtk_lzma.h"
+  "ThirdParty/lzma/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/lzma/vtklzma/config.h"
+  "ThirdParty/lzma/vtklzma/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/zlib/vtk_zlib.h"
+  "ThirdParty/zlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/zlib/vtkzlib/zconf.h"
+  "ThirdParty/zlib/vtkzlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/zstd/vtk_zstd.h"
+  "ThirdParty/zstd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/zstd/vtkzstd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "IO/Core/vtkIOCoreModule.h"
+  "IO/Core/CMakeFiles/vtkIOCore-hierarchy.Release.args"
+  "IO/Core/CMakeFiles/vtkIOCore-hierarchy.depends.args"
+  "IO/Core/CMakeFiles/vtkIOCore-hierarchy.data"
+  "IO/Core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "Filters/FlowPaths/vtkFiltersFlowPathsModule.h"
+  "Filters/FlowPaths/CMakeFiles/vtkFiltersFlowPaths-hierarchy.Release.args"
+  "Filters/FlowPaths/CMakeFiles/vtkFiltersFlowPaths-hierarchy.depends.args"
+  "Filters/FlowPaths/CMakeFiles/vtkFiltersFlowPaths-hierarchy.data"
+  "Filters/FlowPaths/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/expat/vtk_expat.h"
+  "ThirdParty/expat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ThirdParty/expat/vtkexpat/expat_config.h"
+  "ThirdParty/expat/vtkexpat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "IO/XMLParser/vtkIOXMLParserModule.h"
+  "IO/XMLParser/CMakeFiles/vtkIOXMLParser-hierarchy.Release.args"
+  "IO/XMLParser/CMakeFiles/vtkIOXMLParser-hierarchy.depends.args"
+  "IO/XMLParser/CMakeFiles/vtkIOXMLParser-hierarchy.data"
+  "IO/XMLParser/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "IO/XML/vtkIOXMLModule.h"
+  "IO/XML/CMakeFiles/vtkIOXML-hierarchy.Release.args"
+  "IO/XML/CMakeFiles/vtkIOXML-hierarchy.depends.args"
+  "IO/XML/CMakeFiles/vtkIOXML-hierarchy.data"
+  "IO/XML/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/VTKData.dir/DependInfo.cmake"
+  "Wrapping/Tools/CMakeFiles/WrappingTools.dir/DependInfo.cmake"
+  "Wrapping/Tools/CMakeFiles/WrapHierarchy.dir/DependInfo.cmake"
+  "Wrapping/Tools/CMakeFiles/WrapPython.dir/DependInfo.cmake"
+  "Wrapping/Tools/CMakeFiles/WrapPythonInit.dir/DependInfo.cmake"
+  "Wrapping/Tools/CMakeFiles/ParseJava.dir/DependInfo.cmake"
+  "Wrapping/Tools/CMakeFiles/WrapJava.dir/DependInfo.cmake"
+  "ThirdParty/loguru/vtkloguru/CMakeFiles/loguru.dir/DependInfo.cmake"
+  "Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  "Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "Common/Core/CMakeFiles/CommonCore-hierarchy.dir/DependInfo.cmake"
+  "Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "Common/Math/CMakeFiles/CommonMath-hierarchy.dir/DependInfo.cmake"
+  "Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "Common/Transforms/CMakeFiles/CommonTransforms-hierarchy.dir/DependInfo.cmake"
+  "Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "Common/Misc/CMakeFiles/CommonMisc-hierarchy.dir/DependInfo.cmake"
+  "Common/System/CMakeFiles/CommonSystem.dir/DependInfo.cmake"
+  "Common/System/CMakeFiles/CommonSystem-hierarchy.dir/DependInfo.cmake"
+  "Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "Common/DataModel/CMakeFiles/CommonDataModel-hierarchy.dir/DependInfo.cmake"
+  "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "Common/ExecutionModel/CMakeFiles/CommonExecutionModel-hierarchy.dir/DependInfo.cmake"
+  "Filters/Core/CMakeFiles/FiltersCore.dir/DependInfo.cmake"
+  "Filters/Core/CMakeFiles/FiltersCore-hierarchy.dir/DependInfo.cmake"
+  "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/DependInfo.cmake"
+  "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry-hierarchy.dir/DependInfo.cmake"
+  "Filters/General/CMakeFiles/FiltersGeneral.dir/DependInfo.cmake"
+  "Filters/General/CMakeFiles/FiltersGeneral-hierarchy.dir/DependInfo.cmake"
+  "Filters/Sources/CMakeFiles/FiltersSources.dir/DependInfo.cmake"
+  "Filters/Sources/CMakeFiles/FiltersSources-hierarchy.dir/DependInfo.cmake"
+  "Filters/Modeling/CMakeFiles/FiltersModeling.dir/DependInfo.cmake"
+  "Filters/Modeling/CMakeFiles/FiltersModeling-hierarchy.dir/DependInfo.cmake"
+  "Filters/Points/CMakeFiles/FiltersPoints.dir/DependInfo.cmake"
+  "Filters/Points/CMakeFiles/FiltersPoints-hierarchy.dir/DependInfo.cmake"
+  "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/DependInfo.cmake"
+  "Filters/Geometry/CMakeFiles/FiltersGeometry-hierarchy.dir/DependInfo.cmake"
+  "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/DependInfo.cmake"
+  "ThirdParty/lz4/vtklz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "ThirdParty/lzma/vtklzma/CMakeFiles/lzma.dir/DependInfo.cmake"
+  "ThirdParty/zlib/vtkzlib/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "ThirdParty/zstd/vtkzstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "IO/Core/CMakeFiles/IOCore.dir/DependInfo.cmake"
+  "IO/Core/CMakeFiles/IOCore-hierarchy.dir/DependInfo.cmake"
+  "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/DependInfo.cmake"
+  "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths-hierarchy.dir/DependInfo.cmake"
+  "ThirdParty/expat/vtkexpat/CMakeFiles/expat.dir/DependInfo.cmake"
+  "IO/XMLParser/CMakeFiles/IOXMLParser.dir/DependInfo.cmake"
+  "IO/XMLParser/CMakeFiles/IOXMLParser-hierarchy.dir/DependInfo.cmake"
+  "IO/XML/CMakeFiles/IOXML.dir/DependInfo.cmake"
+  "IO/XML/CMakeFiles/IOXML-hierarchy.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,36 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate_std
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("Remote")
+subdirs("Wrapping/Tools")
+subdirs("ThirdParty/loguru")
+subdirs("Utilities/KWIML")
+subdirs("Utilities/KWSys")
+subdirs("ThirdParty/utf8")
+subdirs("Common/Core")
+subdirs("Common/Math")
+subdirs("Common/Transforms")
+subdirs("Common/Misc")
+subdirs("Common/System")
+subdirs("Common/DataModel")
+subdirs("Common/ExecutionModel")
+subdirs("Filters/Core")
+subdirs("Common/ComputationalGeometry")
+subdirs("Filters/General")
+subdirs("Filters/Sources")
+subdirs("Filters/Modeling")
+subdirs("Filters/Points")
+subdirs("Filters/Geometry")
+subdirs("ThirdParty/doubleconversion")
+subdirs("ThirdParty/lz4")
+subdirs("ThirdParty/lzma")
+subdirs("ThirdParty/zlib")
+subdirs("ThirdParty/zstd")
+subdirs("IO/Core")
+subdirs("Filters/FlowPaths")
+subdirs("ThirdParty/expat")
+subdirs("IO/XMLParser")
+subdirs("IO/XML")
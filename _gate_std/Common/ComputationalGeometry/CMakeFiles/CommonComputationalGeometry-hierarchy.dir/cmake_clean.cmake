@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonComputationalGeometry-hierarchy.txt"
+  "CMakeFiles/CommonComputationalGeometry-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonComputationalGeometry-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
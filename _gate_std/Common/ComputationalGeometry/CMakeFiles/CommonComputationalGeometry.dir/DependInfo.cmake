@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/ComputationalGeometry/vtkCardinalSpline.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkCardinalSpline.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkCardinalSpline.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkKochanekSpline.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkKochanekSpline.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkKochanekSpline.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricBohemianDome.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBohemianDome.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBohemianDome.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricBour.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBour.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBour.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricBoy.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBoy.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBoy.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricCatalanMinimal.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCatalanMinimal.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCatalanMinimal.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricConicSpiral.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricConicSpiral.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricConicSpiral.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricCrossCap.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCrossCap.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCrossCap.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricDini.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricDini.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricDini.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricEllipsoid.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEllipsoid.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEllipsoid.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricEnneper.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEnneper.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEnneper.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricFigure8Klein.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFigure8Klein.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFigure8Klein.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricFunction.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFunction.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFunction.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricHenneberg.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricHenneberg.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricHenneberg.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricKlein.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKlein.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKlein.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricKuen.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKuen.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKuen.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricMobius.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricMobius.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricMobius.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricPluckerConoid.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPluckerConoid.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPluckerConoid.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricPseudosphere.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPseudosphere.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPseudosphere.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricRandomHills.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRandomHills.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRandomHills.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricRoman.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRoman.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRoman.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricSpline.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSpline.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSpline.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricSuperEllipsoid.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperEllipsoid.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperEllipsoid.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricSuperToroid.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperToroid.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperToroid.cxx.o.d"
+  "/root/repo/Common/ComputationalGeometry/vtkParametricTorus.cxx" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricTorus.cxx.o" "gcc" "Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/vtkParametricTorus.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonComputationalGeometry-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonComputationalGeometry-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
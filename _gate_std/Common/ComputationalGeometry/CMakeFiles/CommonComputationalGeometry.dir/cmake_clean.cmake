@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonComputationalGeometry-8.90.pdb"
+  "../../lib/libvtkCommonComputationalGeometry-8.90.so"
+  "../../lib/libvtkCommonComputationalGeometry-8.90.so.1"
+  "../../lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkCardinalSpline.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkCardinalSpline.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkKochanekSpline.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkKochanekSpline.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBohemianDome.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBohemianDome.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBour.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBour.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBoy.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricBoy.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCatalanMinimal.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCatalanMinimal.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricConicSpiral.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricConicSpiral.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCrossCap.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricCrossCap.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricDini.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricDini.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEllipsoid.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEllipsoid.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEnneper.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricEnneper.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFigure8Klein.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFigure8Klein.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFunction.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricFunction.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricHenneberg.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricHenneberg.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKlein.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKlein.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKuen.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricKuen.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricMobius.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricMobius.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPluckerConoid.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPluckerConoid.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPseudosphere.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricPseudosphere.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRandomHills.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRandomHills.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRoman.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricRoman.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSpline.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSpline.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperEllipsoid.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperEllipsoid.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperToroid.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricSuperToroid.cxx.o.d"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricTorus.cxx.o"
+  "CMakeFiles/CommonComputationalGeometry.dir/vtkParametricTorus.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonComputationalGeometry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
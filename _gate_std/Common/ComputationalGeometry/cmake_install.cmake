@@ -0,0 +1,132 @@
+# Install script for directory: /root/repo/Common/ComputationalGeometry
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Common/ComputationalGeometry/vtkCardinalSpline.h"
+    "/root/repo/Common/ComputationalGeometry/vtkKochanekSpline.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricBohemianDome.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricBour.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricBoy.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricCatalanMinimal.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricConicSpiral.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricCrossCap.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricDini.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricEllipsoid.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricEnneper.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricFigure8Klein.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricFunction.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricHenneberg.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricKlein.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricKuen.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricMobius.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricPluckerConoid.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricPseudosphere.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricRandomHills.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricRoman.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricSpline.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricSuperEllipsoid.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricSuperToroid.h"
+    "/root/repo/Common/ComputationalGeometry/vtkParametricTorus.h"
+    "/root/repo/_gate_std/Common/ComputationalGeometry/vtkCommonComputationalGeometryModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkCommonComputationalGeometry-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkCommonComputationalGeometry-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkCommonComputationalGeometry-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkCommonComputationalGeometry-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonComputationalGeometry-8.90.so")
+    endif()
+  endif()
+endif()
+
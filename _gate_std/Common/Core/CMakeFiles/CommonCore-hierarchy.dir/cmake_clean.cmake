@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonCore-hierarchy.txt"
+  "CMakeFiles/CommonCore-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonCore-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,162 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/Core/SMP/STDThread/vtkSMPThreadLocalImpl.cxx" "Common/Core/CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPThreadLocalImpl.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPThreadLocalImpl.cxx.o.d"
+  "/root/repo/Common/Core/SMP/STDThread/vtkSMPTools.cxx" "Common/Core/CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPTools.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPTools.cxx.o.d"
+  "/root/repo/Common/Core/SMP/Sequential/vtkAtomic.cxx" "Common/Core/CMakeFiles/CommonCore.dir/SMP/Sequential/vtkAtomic.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/SMP/Sequential/vtkAtomic.cxx.o.d"
+  "/root/repo/Common/Core/vtkAbstractArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkAbstractArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkAbstractArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkAnimationCue.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkAnimationCue.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkAnimationCue.cxx.o.d"
+  "/root/repo/Common/Core/vtkArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkArrayCoordinates.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayCoordinates.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayCoordinates.cxx.o.d"
+  "/root/repo/Common/Core/vtkArrayExtents.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayExtents.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayExtents.cxx.o.d"
+  "/root/repo/Common/Core/vtkArrayExtentsList.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayExtentsList.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayExtentsList.cxx.o.d"
+  "/root/repo/Common/Core/vtkArrayIterator.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayIterator.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayIterator.cxx.o.d"
+  "/root/repo/Common/Core/vtkArrayIteratorTemplateInstantiate.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayIteratorTemplateInstantiate.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayIteratorTemplateInstantiate.cxx.o.d"
+  "/root/repo/Common/Core/vtkArrayRange.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayRange.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayRange.cxx.o.d"
+  "/root/repo/Common/Core/vtkArraySort.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArraySort.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArraySort.cxx.o.d"
+  "/root/repo/Common/Core/vtkArrayWeights.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayWeights.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkArrayWeights.cxx.o.d"
+  "/root/repo/Common/Core/vtkBitArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkBitArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkBitArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkBitArrayIterator.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkBitArrayIterator.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkBitArrayIterator.cxx.o.d"
+  "/root/repo/Common/Core/vtkBoxMuellerRandomSequence.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkBoxMuellerRandomSequence.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkBoxMuellerRandomSequence.cxx.o.d"
+  "/root/repo/Common/Core/vtkBreakPoint.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkBreakPoint.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkBreakPoint.cxx.o.d"
+  "/root/repo/Common/Core/vtkByteSwap.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkByteSwap.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkByteSwap.cxx.o.d"
+  "/root/repo/Common/Core/vtkCallbackCommand.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkCallbackCommand.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkCallbackCommand.cxx.o.d"
+  "/root/repo/Common/Core/vtkCharArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkCharArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkCharArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkCollection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkCollection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkCollection.cxx.o.d"
+  "/root/repo/Common/Core/vtkCollectionIterator.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkCollectionIterator.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkCollectionIterator.cxx.o.d"
+  "/root/repo/Common/Core/vtkCommand.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkCommand.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkCommand.cxx.o.d"
+  "/root/repo/Common/Core/vtkCommonInformationKeyManager.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkCommonInformationKeyManager.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkCommonInformationKeyManager.cxx.o.d"
+  "/root/repo/Common/Core/vtkConditionVariable.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkConditionVariable.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkConditionVariable.cxx.o.d"
+  "/root/repo/Common/Core/vtkCriticalSection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkCriticalSection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkCriticalSection.cxx.o.d"
+  "/root/repo/Common/Core/vtkDataArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkDataArrayCollection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArrayCollection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArrayCollection.cxx.o.d"
+  "/root/repo/Common/Core/vtkDataArrayCollectionIterator.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArrayCollectionIterator.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArrayCollectionIterator.cxx.o.d"
+  "/root/repo/Common/Core/vtkDataArraySelection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArraySelection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDataArraySelection.cxx.o.d"
+  "/root/repo/Common/Core/vtkDebugLeaks.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDebugLeaks.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDebugLeaks.cxx.o.d"
+  "/root/repo/Common/Core/vtkDebugLeaksManager.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDebugLeaksManager.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDebugLeaksManager.cxx.o.d"
+  "/root/repo/Common/Core/vtkDoubleArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDoubleArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDoubleArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkDynamicLoader.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkDynamicLoader.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkDynamicLoader.cxx.o.d"
+  "/root/repo/Common/Core/vtkEventForwarderCommand.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkEventForwarderCommand.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkEventForwarderCommand.cxx.o.d"
+  "/root/repo/Common/Core/vtkFileOutputWindow.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkFileOutputWindow.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkFileOutputWindow.cxx.o.d"
+  "/root/repo/Common/Core/vtkFloatArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkFloatArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkFloatArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkFloatingPointExceptions.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkFloatingPointExceptions.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkFloatingPointExceptions.cxx.o.d"
+  "/root/repo/Common/Core/vtkGarbageCollector.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkGarbageCollector.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkGarbageCollector.cxx.o.d"
+  "/root/repo/Common/Core/vtkGarbageCollectorManager.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkGarbageCollectorManager.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkGarbageCollectorManager.cxx.o.d"
+  "/root/repo/Common/Core/vtkGaussianRandomSequence.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkGaussianRandomSequence.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkGaussianRandomSequence.cxx.o.d"
+  "/root/repo/Common/Core/vtkGenericDataArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkGenericDataArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkGenericDataArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkIdList.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkIdList.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkIdList.cxx.o.d"
+  "/root/repo/Common/Core/vtkIdListCollection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkIdListCollection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkIdListCollection.cxx.o.d"
+  "/root/repo/Common/Core/vtkIdTypeArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkIdTypeArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkIdTypeArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkIndent.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkIndent.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkIndent.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformation.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformation.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformation.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationDataObjectKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationDataObjectKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationDataObjectKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationDoubleKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationDoubleKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationDoubleKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationDoubleVectorKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationDoubleVectorKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationDoubleVectorKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationIdTypeKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIdTypeKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIdTypeKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationInformationKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationInformationKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationInformationKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationInformationVectorKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationInformationVectorKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationInformationVectorKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationIntegerKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIntegerKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIntegerKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationIntegerPointerKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIntegerPointerKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIntegerPointerKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationIntegerVectorKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIntegerVectorKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIntegerVectorKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationIterator.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIterator.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationIterator.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationKeyLookup.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationKeyLookup.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationKeyLookup.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationKeyVectorKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationKeyVectorKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationKeyVectorKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationObjectBaseKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationObjectBaseKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationObjectBaseKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationObjectBaseVectorKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationObjectBaseVectorKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationObjectBaseVectorKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationRequestKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationRequestKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationRequestKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationStringKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationStringKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationStringKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationStringVectorKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationStringVectorKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationStringVectorKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationUnsignedLongKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationUnsignedLongKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationUnsignedLongKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationVariantKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationVariantKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationVariantKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationVariantVectorKey.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationVariantVectorKey.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationVariantVectorKey.cxx.o.d"
+  "/root/repo/Common/Core/vtkInformationVector.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationVector.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkInformationVector.cxx.o.d"
+  "/root/repo/Common/Core/vtkIntArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkIntArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkIntArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkLargeInteger.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkLargeInteger.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkLargeInteger.cxx.o.d"
+  "/root/repo/Common/Core/vtkLogger.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkLogger.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkLogger.cxx.o.d"
+  "/root/repo/Common/Core/vtkLongArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkLongArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkLongArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkLongLongArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkLongLongArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkLongLongArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkLookupTable.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkLookupTable.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkLookupTable.cxx.o.d"
+  "/root/repo/Common/Core/vtkMath.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkMath.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkMath.cxx.o.d"
+  "/root/repo/Common/Core/vtkMersenneTwister.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkMersenneTwister.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkMersenneTwister.cxx.o.d"
+  "/root/repo/Common/Core/vtkMinimalStandardRandomSequence.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkMinimalStandardRandomSequence.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkMinimalStandardRandomSequence.cxx.o.d"
+  "/root/repo/Common/Core/vtkMultiThreader.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkMultiThreader.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkMultiThreader.cxx.o.d"
+  "/root/repo/Common/Core/vtkMutexLock.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkMutexLock.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkMutexLock.cxx.o.d"
+  "/root/repo/Common/Core/vtkOStrStreamWrapper.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkOStrStreamWrapper.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkOStrStreamWrapper.cxx.o.d"
+  "/root/repo/Common/Core/vtkOStreamWrapper.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkOStreamWrapper.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkOStreamWrapper.cxx.o.d"
+  "/root/repo/Common/Core/vtkObject.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkObject.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkObject.cxx.o.d"
+  "/root/repo/Common/Core/vtkObjectBase.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkObjectBase.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkObjectBase.cxx.o.d"
+  "/root/repo/Common/Core/vtkObjectFactory.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkObjectFactory.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkObjectFactory.cxx.o.d"
+  "/root/repo/Common/Core/vtkObjectFactoryCollection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkObjectFactoryCollection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkObjectFactoryCollection.cxx.o.d"
+  "/root/repo/Common/Core/vtkOldStyleCallbackCommand.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkOldStyleCallbackCommand.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkOldStyleCallbackCommand.cxx.o.d"
+  "/root/repo/Common/Core/vtkOutputWindow.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkOutputWindow.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkOutputWindow.cxx.o.d"
+  "/root/repo/Common/Core/vtkOverrideInformation.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkOverrideInformation.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkOverrideInformation.cxx.o.d"
+  "/root/repo/Common/Core/vtkOverrideInformationCollection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkOverrideInformationCollection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkOverrideInformationCollection.cxx.o.d"
+  "/root/repo/Common/Core/vtkPoints.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkPoints.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkPoints.cxx.o.d"
+  "/root/repo/Common/Core/vtkPoints2D.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkPoints2D.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkPoints2D.cxx.o.d"
+  "/root/repo/Common/Core/vtkPriorityQueue.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkPriorityQueue.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkPriorityQueue.cxx.o.d"
+  "/root/repo/Common/Core/vtkRandomPool.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkRandomPool.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkRandomPool.cxx.o.d"
+  "/root/repo/Common/Core/vtkRandomSequence.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkRandomSequence.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkRandomSequence.cxx.o.d"
+  "/root/repo/Common/Core/vtkReferenceCount.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkReferenceCount.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkReferenceCount.cxx.o.d"
+  "/root/repo/Common/Core/vtkSMPTools.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkSMPTools.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkSMPTools.cxx.o.d"
+  "/root/repo/Common/Core/vtkSOADataArrayTemplateInstantiate.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkSOADataArrayTemplateInstantiate.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkSOADataArrayTemplateInstantiate.cxx.o.d"
+  "/root/repo/Common/Core/vtkScalarsToColors.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkScalarsToColors.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkScalarsToColors.cxx.o.d"
+  "/root/repo/Common/Core/vtkShortArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkShortArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkShortArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkSignedCharArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkSignedCharArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkSignedCharArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkSimpleCriticalSection.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkSimpleCriticalSection.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkSimpleCriticalSection.cxx.o.d"
+  "/root/repo/Common/Core/vtkSmartPointerBase.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkSmartPointerBase.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkSmartPointerBase.cxx.o.d"
+  "/root/repo/Common/Core/vtkSortDataArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkSortDataArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkSortDataArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkStdString.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkStdString.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkStdString.cxx.o.d"
+  "/root/repo/Common/Core/vtkStringArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkStringArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkStringArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkStringOutputWindow.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkStringOutputWindow.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkStringOutputWindow.cxx.o.d"
+  "/root/repo/Common/Core/vtkTimePointUtility.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTimePointUtility.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTimePointUtility.cxx.o.d"
+  "/root/repo/Common/Core/vtkTimeStamp.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTimeStamp.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTimeStamp.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeFloat32Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeFloat32Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeFloat32Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeFloat64Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeFloat64Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeFloat64Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeInt16Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt16Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt16Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeInt32Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt32Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt32Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeInt64Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt64Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt64Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeInt8Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt8Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeInt8Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeUInt16Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt16Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt16Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeUInt32Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt32Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt32Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeUInt64Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt64Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt64Array.cxx.o.d"
+  "/root/repo/_gate_std/Common/Core/vtkTypeUInt8Array.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt8Array.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkTypeUInt8Array.cxx.o.d"
+  "/root/repo/Common/Core/vtkUnicodeString.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnicodeString.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnicodeString.cxx.o.d"
+  "/root/repo/Common/Core/vtkUnicodeStringArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnicodeStringArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnicodeStringArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkUnsignedCharArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedCharArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedCharArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkUnsignedIntArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedIntArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedIntArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkUnsignedLongArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedLongArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedLongArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkUnsignedLongLongArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedLongLongArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedLongLongArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkUnsignedShortArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedShortArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkUnsignedShortArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkVariant.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkVariant.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkVariant.cxx.o.d"
+  "/root/repo/Common/Core/vtkVariantArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkVariantArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkVariantArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkVersion.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkVersion.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkVersion.cxx.o.d"
+  "/root/repo/Common/Core/vtkVoidArray.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkVoidArray.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkVoidArray.cxx.o.d"
+  "/root/repo/Common/Core/vtkWeakPointerBase.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkWeakPointerBase.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkWeakPointerBase.cxx.o.d"
+  "/root/repo/Common/Core/vtkWeakReference.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkWeakReference.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkWeakReference.cxx.o.d"
+  "/root/repo/Common/Core/vtkWindow.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkWindow.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkWindow.cxx.o.d"
+  "/root/repo/Common/Core/vtkXMLFileOutputWindow.cxx" "Common/Core/CMakeFiles/CommonCore.dir/vtkXMLFileOutputWindow.cxx.o" "gcc" "Common/Core/CMakeFiles/CommonCore.dir/vtkXMLFileOutputWindow.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonCore-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonCore-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonCore-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonCore-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/ThirdParty/loguru/vtkloguru/CMakeFiles/loguru.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
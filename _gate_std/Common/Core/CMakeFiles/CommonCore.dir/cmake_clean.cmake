@@ -0,0 +1,282 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonCore-8.90.pdb"
+  "../../lib/libvtkCommonCore-8.90.so"
+  "../../lib/libvtkCommonCore-8.90.so.1"
+  "../../lib/libvtkCommonCore-8.90.so.8.90.0"
+  "CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPThreadLocalImpl.cxx.o"
+  "CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPThreadLocalImpl.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPTools.cxx.o"
+  "CMakeFiles/CommonCore.dir/SMP/STDThread/vtkSMPTools.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/SMP/Sequential/vtkAtomic.cxx.o"
+  "CMakeFiles/CommonCore.dir/SMP/Sequential/vtkAtomic.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkAbstractArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkAbstractArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkAnimationCue.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkAnimationCue.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArrayCoordinates.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArrayCoordinates.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArrayExtents.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArrayExtents.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArrayExtentsList.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArrayExtentsList.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArrayIterator.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArrayIterator.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArrayIteratorTemplateInstantiate.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArrayIteratorTemplateInstantiate.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArrayRange.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArrayRange.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArraySort.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArraySort.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkArrayWeights.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkArrayWeights.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkBitArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkBitArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkBitArrayIterator.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkBitArrayIterator.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkBoxMuellerRandomSequence.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkBoxMuellerRandomSequence.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkBreakPoint.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkBreakPoint.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkByteSwap.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkByteSwap.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkCallbackCommand.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkCallbackCommand.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkCharArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkCharArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkCollection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkCollection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkCollectionIterator.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkCollectionIterator.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkCommand.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkCommand.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkCommonInformationKeyManager.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkCommonInformationKeyManager.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkConditionVariable.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkConditionVariable.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkCriticalSection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkCriticalSection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDataArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDataArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDataArrayCollection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDataArrayCollection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDataArrayCollectionIterator.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDataArrayCollectionIterator.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDataArraySelection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDataArraySelection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDebugLeaks.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDebugLeaks.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDebugLeaksManager.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDebugLeaksManager.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDoubleArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDoubleArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkDynamicLoader.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkDynamicLoader.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkEventForwarderCommand.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkEventForwarderCommand.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkFileOutputWindow.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkFileOutputWindow.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkFloatArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkFloatArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkFloatingPointExceptions.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkFloatingPointExceptions.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkGarbageCollector.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkGarbageCollector.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkGarbageCollectorManager.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkGarbageCollectorManager.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkGaussianRandomSequence.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkGaussianRandomSequence.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkGenericDataArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkGenericDataArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkIdList.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkIdList.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkIdListCollection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkIdListCollection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkIdTypeArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkIdTypeArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkIndent.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkIndent.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformation.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformation.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationDataObjectKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationDataObjectKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationDoubleKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationDoubleKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationDoubleVectorKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationDoubleVectorKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationIdTypeKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationIdTypeKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationInformationKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationInformationKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationInformationVectorKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationInformationVectorKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationIntegerKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationIntegerKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationIntegerPointerKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationIntegerPointerKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationIntegerVectorKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationIntegerVectorKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationIterator.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationIterator.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationKeyLookup.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationKeyLookup.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationKeyVectorKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationKeyVectorKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationObjectBaseKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationObjectBaseKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationObjectBaseVectorKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationObjectBaseVectorKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationRequestKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationRequestKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationStringKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationStringKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationStringVectorKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationStringVectorKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationUnsignedLongKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationUnsignedLongKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationVariantKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationVariantKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationVariantVectorKey.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationVariantVectorKey.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkInformationVector.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkInformationVector.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkIntArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkIntArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkLargeInteger.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkLargeInteger.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkLogger.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkLogger.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkLongArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkLongArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkLongLongArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkLongLongArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkLookupTable.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkLookupTable.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkMath.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkMath.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkMersenneTwister.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkMersenneTwister.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkMinimalStandardRandomSequence.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkMinimalStandardRandomSequence.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkMultiThreader.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkMultiThreader.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkMutexLock.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkMutexLock.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkOStrStreamWrapper.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkOStrStreamWrapper.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkOStreamWrapper.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkOStreamWrapper.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkObject.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkObject.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkObjectBase.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkObjectBase.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkObjectFactory.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkObjectFactory.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkObjectFactoryCollection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkObjectFactoryCollection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkOldStyleCallbackCommand.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkOldStyleCallbackCommand.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkOutputWindow.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkOutputWindow.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkOverrideInformation.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkOverrideInformation.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkOverrideInformationCollection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkOverrideInformationCollection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkPoints.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkPoints.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkPoints2D.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkPoints2D.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkPriorityQueue.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkPriorityQueue.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkRandomPool.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkRandomPool.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkRandomSequence.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkRandomSequence.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkReferenceCount.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkReferenceCount.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkSMPTools.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkSMPTools.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkSOADataArrayTemplateInstantiate.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkSOADataArrayTemplateInstantiate.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkScalarsToColors.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkScalarsToColors.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkShortArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkShortArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkSignedCharArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkSignedCharArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkSimpleCriticalSection.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkSimpleCriticalSection.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkSmartPointerBase.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkSmartPointerBase.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkSortDataArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkSortDataArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkStdString.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkStdString.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkStringArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkStringArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkStringOutputWindow.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkStringOutputWindow.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTimePointUtility.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTimePointUtility.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTimeStamp.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTimeStamp.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeFloat32Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeFloat32Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeFloat64Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeFloat64Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt16Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt16Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt32Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt32Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt64Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt64Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt8Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeInt8Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt16Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt16Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt32Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt32Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt64Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt64Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt8Array.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkTypeUInt8Array.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkUnicodeString.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkUnicodeString.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkUnicodeStringArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkUnicodeStringArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedCharArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedCharArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedIntArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedIntArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedLongArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedLongArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedLongLongArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedLongLongArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedShortArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkUnsignedShortArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkVariant.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkVariant.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkVariantArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkVariantArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkVersion.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkVersion.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkVoidArray.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkVoidArray.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkWeakPointerBase.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkWeakPointerBase.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkWeakReference.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkWeakReference.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkWindow.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkWindow.cxx.o.d"
+  "CMakeFiles/CommonCore.dir/vtkXMLFileOutputWindow.cxx.o"
+  "CMakeFiles/CommonCore.dir/vtkXMLFileOutputWindow.cxx.o.d"
+  "vtkUnicodeCaseFoldData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonCore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
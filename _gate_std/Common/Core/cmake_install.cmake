@@ -0,0 +1,320 @@
+# Install script for directory: /root/repo/Common/Core
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Common/Core/vtkABI.h"
+    "/root/repo/Common/Core/vtkArrayIteratorIncludes.h"
+    "/root/repo/Common/Core/vtkAssume.h"
+    "/root/repo/Common/Core/vtkAtomicTypeConcepts.h"
+    "/root/repo/Common/Core/vtkAtomicTypes.h"
+    "/root/repo/Common/Core/vtkAutoInit.h"
+    "/root/repo/Common/Core/vtkBuffer.h"
+    "/root/repo/Common/Core/vtkCollectionRange.h"
+    "/root/repo/Common/Core/vtkDataArrayAccessor.h"
+    "/root/repo/Common/Core/vtkDataArrayIteratorMacro.h"
+    "/root/repo/Common/Core/vtkDataArrayMeta.h"
+    "/root/repo/Common/Core/vtkDataArrayRange.h"
+    "/root/repo/Common/Core/vtkDataArrayTupleRange_AOS.h"
+    "/root/repo/Common/Core/vtkDataArrayTupleRange_Generic.h"
+    "/root/repo/Common/Core/vtkDataArrayValueRange_AOS.h"
+    "/root/repo/Common/Core/vtkDataArrayValueRange_Generic.h"
+    "/root/repo/Common/Core/vtkDataArrayTemplate.h"
+    "/root/repo/Common/Core/vtkEventData.h"
+    "/root/repo/Common/Core/vtkGenericDataArrayLookupHelper.h"
+    "/root/repo/Common/Core/vtkIOStream.h"
+    "/root/repo/Common/Core/vtkIOStreamFwd.h"
+    "/root/repo/Common/Core/vtkInformationInternals.h"
+    "/root/repo/Common/Core/vtkMappedDataArray.h"
+    "/root/repo/Common/Core/vtkMathUtilities.h"
+    "/root/repo/Common/Core/vtkMersenneTwister.h"
+    "/root/repo/Common/Core/vtkMeta.h"
+    "/root/repo/Common/Core/vtkNew.h"
+    "/root/repo/Common/Core/vtkSetGet.h"
+    "/root/repo/Common/Core/vtkSmartPointer.h"
+    "/root/repo/Common/Core/vtkSystemIncludes.h"
+    "/root/repo/Common/Core/vtkTemplateAliasMacro.h"
+    "/root/repo/Common/Core/vtkTestDataArray.h"
+    "/root/repo/Common/Core/vtkType.h"
+    "/root/repo/Common/Core/vtkTypeTraits.h"
+    "/root/repo/Common/Core/vtkTypedDataArray.h"
+    "/root/repo/Common/Core/vtkTypedDataArrayIterator.h"
+    "/root/repo/Common/Core/vtkVariantCast.h"
+    "/root/repo/Common/Core/vtkVariantCreate.h"
+    "/root/repo/Common/Core/vtkVariantExtract.h"
+    "/root/repo/Common/Core/vtkVariantInlineOperators.h"
+    "/root/repo/Common/Core/vtkWeakPointer.h"
+    "/root/repo/Common/Core/vtkWeakReference.h"
+    "/root/repo/Common/Core/vtkWin32Header.h"
+    "/root/repo/Common/Core/vtkWindows.h"
+    "/root/repo/Common/Core/vtkWrappingHints.h"
+    "/root/repo/_gate_std/Common/Core/vtkAtomic.h"
+    "/root/repo/_gate_std/Common/Core/vtkSMPThreadLocal.h"
+    "/root/repo/_gate_std/Common/Core/vtkSMPThreadLocalImpl.h"
+    "/root/repo/_gate_std/Common/Core/vtkSMPToolsInternal.h"
+    "/root/repo/Common/Core/vtkSMPTools.h"
+    "/root/repo/Common/Core/vtkSMPThreadLocalObject.h"
+    "/root/repo/_gate_std/Common/Core/vtkArrayDispatchArrayList.h"
+    "/root/repo/_gate_std/Common/Core/vtkConfigure.h"
+    "/root/repo/_gate_std/Common/Core/vtkMathConfigure.h"
+    "/root/repo/_gate_std/Common/Core/vtkToolkits.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeListMacros.h"
+    "/root/repo/_gate_std/Common/Core/vtkVersionMacros.h"
+    "/root/repo/_gate_std/Common/Core/vtkVTK_USE_SCALED_SOA_ARRAYS.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeInt8Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeInt16Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeInt32Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeInt64Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeUInt8Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeUInt16Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeUInt32Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeUInt64Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeFloat32Array.h"
+    "/root/repo/_gate_std/Common/Core/vtkTypeFloat64Array.h"
+    "/root/repo/Common/Core/vtkAbstractArray.h"
+    "/root/repo/Common/Core/vtkAnimationCue.h"
+    "/root/repo/Common/Core/vtkArray.h"
+    "/root/repo/Common/Core/vtkArrayCoordinates.h"
+    "/root/repo/Common/Core/vtkArrayExtents.h"
+    "/root/repo/Common/Core/vtkArrayExtentsList.h"
+    "/root/repo/Common/Core/vtkArrayIterator.h"
+    "/root/repo/Common/Core/vtkArrayRange.h"
+    "/root/repo/Common/Core/vtkArraySort.h"
+    "/root/repo/Common/Core/vtkArrayWeights.h"
+    "/root/repo/Common/Core/vtkBitArray.h"
+    "/root/repo/Common/Core/vtkBitArrayIterator.h"
+    "/root/repo/Common/Core/vtkBoxMuellerRandomSequence.h"
+    "/root/repo/Common/Core/vtkBreakPoint.h"
+    "/root/repo/Common/Core/vtkByteSwap.h"
+    "/root/repo/Common/Core/vtkCallbackCommand.h"
+    "/root/repo/Common/Core/vtkCharArray.h"
+    "/root/repo/Common/Core/vtkCollection.h"
+    "/root/repo/Common/Core/vtkCollectionIterator.h"
+    "/root/repo/Common/Core/vtkCommand.h"
+    "/root/repo/Common/Core/vtkCommonInformationKeyManager.h"
+    "/root/repo/Common/Core/vtkConditionVariable.h"
+    "/root/repo/Common/Core/vtkCriticalSection.h"
+    "/root/repo/Common/Core/vtkDataArray.h"
+    "/root/repo/Common/Core/vtkDataArrayCollection.h"
+    "/root/repo/Common/Core/vtkDataArrayCollectionIterator.h"
+    "/root/repo/Common/Core/vtkDataArraySelection.h"
+    "/root/repo/Common/Core/vtkDebugLeaks.h"
+    "/root/repo/Common/Core/vtkDebugLeaksManager.h"
+    "/root/repo/Common/Core/vtkDoubleArray.h"
+    "/root/repo/Common/Core/vtkDynamicLoader.h"
+    "/root/repo/Common/Core/vtkEventForwarderCommand.h"
+    "/root/repo/Common/Core/vtkFileOutputWindow.h"
+    "/root/repo/Common/Core/vtkFloatArray.h"
+    "/root/repo/Common/Core/vtkFloatingPointExceptions.h"
+    "/root/repo/Common/Core/vtkGarbageCollector.h"
+    "/root/repo/Common/Core/vtkGarbageCollectorManager.h"
+    "/root/repo/Common/Core/vtkGaussianRandomSequence.h"
+    "/root/repo/Common/Core/vtkIdList.h"
+    "/root/repo/Common/Core/vtkIdListCollection.h"
+    "/root/repo/Common/Core/vtkIdTypeArray.h"
+    "/root/repo/Common/Core/vtkIndent.h"
+    "/root/repo/Common/Core/vtkInformation.h"
+    "/root/repo/Common/Core/vtkInformationDataObjectKey.h"
+    "/root/repo/Common/Core/vtkInformationDoubleKey.h"
+    "/root/repo/Common/Core/vtkInformationDoubleVectorKey.h"
+    "/root/repo/Common/Core/vtkInformationIdTypeKey.h"
+    "/root/repo/Common/Core/vtkInformationInformationKey.h"
+    "/root/repo/Common/Core/vtkInformationInformationVectorKey.h"
+    "/root/repo/Common/Core/vtkInformationIntegerKey.h"
+    "/root/repo/Common/Core/vtkInformationIntegerPointerKey.h"
+    "/root/repo/Common/Core/vtkInformationIntegerVectorKey.h"
+    "/root/repo/Common/Core/vtkInformationIterator.h"
+    "/root/repo/Common/Core/vtkInformationKey.h"
+    "/root/repo/Common/Core/vtkInformationKeyLookup.h"
+    "/root/repo/Common/Core/vtkInformationKeyVectorKey.h"
+    "/root/repo/Common/Core/vtkInformationObjectBaseKey.h"
+    "/root/repo/Common/Core/vtkInformationObjectBaseVectorKey.h"
+    "/root/repo/Common/Core/vtkInformationRequestKey.h"
+    "/root/repo/Common/Core/vtkInformationStringKey.h"
+    "/root/repo/Common/Core/vtkInformationStringVectorKey.h"
+    "/root/repo/Common/Core/vtkInformationUnsignedLongKey.h"
+    "/root/repo/Common/Core/vtkInformationVariantKey.h"
+    "/root/repo/Common/Core/vtkInformationVariantVectorKey.h"
+    "/root/repo/Common/Core/vtkInformationVector.h"
+    "/root/repo/Common/Core/vtkIntArray.h"
+    "/root/repo/Common/Core/vtkLargeInteger.h"
+    "/root/repo/Common/Core/vtkLogger.h"
+    "/root/repo/Common/Core/vtkLongArray.h"
+    "/root/repo/Common/Core/vtkLongLongArray.h"
+    "/root/repo/Common/Core/vtkLookupTable.h"
+    "/root/repo/Common/Core/vtkMath.h"
+    "/root/repo/Common/Core/vtkMersenneTwister.h"
+    "/root/repo/Common/Core/vtkMinimalStandardRandomSequence.h"
+    "/root/repo/Common/Core/vtkMultiThreader.h"
+    "/root/repo/Common/Core/vtkMutexLock.h"
+    "/root/repo/Common/Core/vtkOStrStreamWrapper.h"
+    "/root/repo/Common/Core/vtkOStreamWrapper.h"
+    "/root/repo/Common/Core/vtkObject.h"
+    "/root/repo/Common/Core/vtkObjectBase.h"
+    "/root/repo/Common/Core/vtkObjectFactory.h"
+    "/root/repo/Common/Core/vtkObjectFactoryCollection.h"
+    "/root/repo/Common/Core/vtkOldStyleCallbackCommand.h"
+    "/root/repo/Common/Core/vtkOutputWindow.h"
+    "/root/repo/Common/Core/vtkOverrideInformation.h"
+    "/root/repo/Common/Core/vtkOverrideInformationCollection.h"
+    "/root/repo/Common/Core/vtkPoints.h"
+    "/root/repo/Common/Core/vtkPoints2D.h"
+    "/root/repo/Common/Core/vtkPriorityQueue.h"
+    "/root/repo/Common/Core/vtkRandomPool.h"
+    "/root/repo/Common/Core/vtkRandomSequence.h"
+    "/root/repo/Common/Core/vtkReferenceCount.h"
+    "/root/repo/Common/Core/vtkScalarsToColors.h"
+    "/root/repo/Common/Core/vtkShortArray.h"
+    "/root/repo/Common/Core/vtkSignedCharArray.h"
+    "/root/repo/Common/Core/vtkSimpleCriticalSection.h"
+    "/root/repo/Common/Core/vtkSmartPointerBase.h"
+    "/root/repo/Common/Core/vtkSortDataArray.h"
+    "/root/repo/Common/Core/vtkStdString.h"
+    "/root/repo/Common/Core/vtkStringArray.h"
+    "/root/repo/Common/Core/vtkStringOutputWindow.h"
+    "/root/repo/Common/Core/vtkTimePointUtility.h"
+    "/root/repo/Common/Core/vtkTimeStamp.h"
+    "/root/repo/Common/Core/vtkUnicodeString.h"
+    "/root/repo/Common/Core/vtkUnicodeStringArray.h"
+    "/root/repo/Common/Core/vtkUnsignedCharArray.h"
+    "/root/repo/Common/Core/vtkUnsignedIntArray.h"
+    "/root/repo/Common/Core/vtkUnsignedLongArray.h"
+    "/root/repo/Common/Core/vtkUnsignedLongLongArray.h"
+    "/root/repo/Common/Core/vtkUnsignedShortArray.h"
+    "/root/repo/Common/Core/vtkVariant.h"
+    "/root/repo/Common/Core/vtkVariantArray.h"
+    "/root/repo/Common/Core/vtkVersion.h"
+    "/root/repo/Common/Core/vtkVoidArray.h"
+    "/root/repo/Common/Core/vtkWeakPointerBase.h"
+    "/root/repo/Common/Core/vtkWeakReference.h"
+    "/root/repo/Common/Core/vtkWindow.h"
+    "/root/repo/Common/Core/vtkXMLFileOutputWindow.h"
+    "/root/repo/Common/Core/vtkAOSDataArrayTemplate.h"
+    "/root/repo/Common/Core/vtkArrayDispatch.h"
+    "/root/repo/Common/Core/vtkArrayInterpolate.h"
+    "/root/repo/Common/Core/vtkArrayIteratorTemplate.h"
+    "/root/repo/Common/Core/vtkArrayPrint.h"
+    "/root/repo/Common/Core/vtkDenseArray.h"
+    "/root/repo/Common/Core/vtkGenericDataArray.h"
+    "/root/repo/Common/Core/vtkMappedDataArray.h"
+    "/root/repo/Common/Core/vtkSOADataArrayTemplate.h"
+    "/root/repo/Common/Core/vtkSparseArray.h"
+    "/root/repo/Common/Core/vtkTypedArray.h"
+    "/root/repo/Common/Core/vtkTypedDataArray.h"
+    "/root/repo/Common/Core/vtkTypeList.h"
+    "/root/repo/_gate_std/Common/Core/vtkCommonCoreModule.h"
+    "/root/repo/Common/Core/vtkArrayIteratorTemplateImplicit.txx"
+    "/root/repo/Common/Core/vtkAOSDataArrayTemplate.txx"
+    "/root/repo/Common/Core/vtkArrayDispatch.txx"
+    "/root/repo/Common/Core/vtkArrayInterpolate.txx"
+    "/root/repo/Common/Core/vtkArrayIteratorTemplate.txx"
+    "/root/repo/Common/Core/vtkArrayPrint.txx"
+    "/root/repo/Common/Core/vtkDenseArray.txx"
+    "/root/repo/Common/Core/vtkGenericDataArray.txx"
+    "/root/repo/Common/Core/vtkMappedDataArray.txx"
+    "/root/repo/Common/Core/vtkSOADataArrayTemplate.txx"
+    "/root/repo/Common/Core/vtkSparseArray.txx"
+    "/root/repo/Common/Core/vtkTypedArray.txx"
+    "/root/repo/Common/Core/vtkTypedDataArray.txx"
+    "/root/repo/Common/Core/vtkTypeList.txx"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkCommonCore-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkCommonCore-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkCommonCore-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkCommonCore-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkCommonCore-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonCore-8.90.so")
+    endif()
+  endif()
+endif()
+
@@ -0,0 +1,23 @@
+/*=========================================================================
+
+  Program:   Visualization Toolkit
+  Module:    vtkVersionMacros.h
+
+  Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+  All rights reserved.
+  See Copyright.txt or http://www.kitware.com/Copyright.htm for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkVersionMacros_h
+#define vtkVersionMacros_h
+
+#define VTK_MAJOR_VERSION 8
+#define VTK_MINOR_VERSION 90
+#define VTK_BUILD_VERSION 0
+#define VTK_VERSION "8.90.0"
+
+#endif
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonDataModel-hierarchy.txt"
+  "CMakeFiles/CommonDataModel-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonDataModel-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
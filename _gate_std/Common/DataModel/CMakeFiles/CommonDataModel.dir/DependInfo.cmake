@@ -0,0 +1,258 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/DataModel/vtkAMRBox.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRBox.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRBox.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAMRDataInternals.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRDataInternals.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRDataInternals.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAMRInformation.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRInformation.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRInformation.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAMRUtilities.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRUtilities.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAMRUtilities.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAbstractCellLinks.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractCellLinks.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractCellLinks.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAbstractCellLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractCellLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractCellLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAbstractElectronicData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractElectronicData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractElectronicData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAbstractPointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractPointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAbstractPointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAdjacentVertexIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAdjacentVertexIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAdjacentVertexIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAnimationScene.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAnimationScene.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAnimationScene.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAnnotation.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAnnotation.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAnnotation.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAnnotationLayers.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAnnotationLayers.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAnnotationLayers.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkArrayData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkArrayData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkArrayData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAtom.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAtom.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAtom.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkAttributesErrorMetric.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAttributesErrorMetric.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkAttributesErrorMetric.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBSPCuts.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBSPCuts.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBSPCuts.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBSPIntersections.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBSPIntersections.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBSPIntersections.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBVHCellLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBVHCellLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBVHCellLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBiQuadraticQuad.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuad.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuad.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBiQuadraticQuadraticHexahedron.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticHexahedron.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticHexahedron.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBiQuadraticQuadraticWedge.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticWedge.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticWedge.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBiQuadraticTriangle.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticTriangle.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBiQuadraticTriangle.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBond.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBond.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBond.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBoundingBox.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBoundingBox.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBoundingBox.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkBox.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBox.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkBox.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCell.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCell.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCell.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCell3D.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCell3D.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCell3D.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellArray.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellArray.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellArray.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellArrayIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellArrayIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellArrayIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellLinks.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellLinks.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellLinks.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellLocatorStrategy.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellLocatorStrategy.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellLocatorStrategy.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCellTypes.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellTypes.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCellTypes.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkClosestNPointsStrategy.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkClosestNPointsStrategy.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkClosestNPointsStrategy.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkClosestPointStrategy.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkClosestPointStrategy.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkClosestPointStrategy.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCompositeDataIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCompositeDataIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCompositeDataIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCompositeDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCompositeDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCompositeDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCone.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCone.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCone.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkConvexPointSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkConvexPointSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkConvexPointSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCubicLine.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCubicLine.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCubicLine.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkCylinder.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCylinder.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkCylinder.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataObject.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObject.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObject.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataObjectCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataObjectTree.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectTree.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectTree.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataObjectTreeIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectTreeIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectTreeIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataObjectTypes.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectTypes.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataObjectTypes.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataSetAttributes.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetAttributes.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetAttributes.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataSetAttributesFieldList.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetAttributesFieldList.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetAttributesFieldList.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataSetCellIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetCellIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetCellIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDataSetCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDataSetCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDirectedAcyclicGraph.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDirectedAcyclicGraph.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDirectedAcyclicGraph.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDirectedGraph.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDirectedGraph.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDirectedGraph.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkDistributedGraphHelper.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDistributedGraphHelper.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkDistributedGraphHelper.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkEdgeListIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkEdgeListIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkEdgeListIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkEdgeTable.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkEdgeTable.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkEdgeTable.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkEmptyCell.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkEmptyCell.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkEmptyCell.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkExplicitStructuredGrid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkExplicitStructuredGrid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkExplicitStructuredGrid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkExtractStructuredGridHelper.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkExtractStructuredGridHelper.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkExtractStructuredGridHelper.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkFieldData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkFieldData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkFieldData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkFindCellStrategy.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkFindCellStrategy.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkFindCellStrategy.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericAdaptorCell.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericAdaptorCell.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericAdaptorCell.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericAttribute.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericAttribute.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericAttribute.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericAttributeCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericAttributeCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericAttributeCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericCell.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericCell.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericCell.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericCellIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericCellIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericCellIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericCellTessellator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericCellTessellator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericCellTessellator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericEdgeTable.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericEdgeTable.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericEdgeTable.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericInterpolatedVelocityField.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericInterpolatedVelocityField.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericPointIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericPointIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericPointIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGenericSubdivisionErrorMetric.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericSubdivisionErrorMetric.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGenericSubdivisionErrorMetric.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGeometricErrorMetric.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGeometricErrorMetric.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGeometricErrorMetric.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGraph.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGraph.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGraph.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGraphEdge.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGraphEdge.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGraphEdge.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkGraphInternals.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGraphInternals.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkGraphInternals.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHexagonalPrism.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHexagonalPrism.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHexagonalPrism.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHexahedron.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHexahedron.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHexahedron.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHierarchicalBoxDataIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHierarchicalBoxDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTree.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTree.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTree.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGrid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGrid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGrid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridEntry.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridEntry.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridEntry.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridGeometryEntry.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryEntry.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryEntry.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridGeometryLevelEntry.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryLevelEntry.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryLevelEntry.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridLevelEntry.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridLevelEntry.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridLevelEntry.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedCursor.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedCursor.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedCursor.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedGeometryCursor.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedGeometryCursor.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedGeometryCursor.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedMooreSuperCursor.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursor.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursor.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedMooreSuperCursorLight.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursorLight.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursorLight.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedSuperCursor.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursor.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursor.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedSuperCursorLight.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursorLight.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursorLight.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedVonNeumannSuperCursorLight.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursorLight.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursorLight.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridOrientedCursor.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedCursor.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedCursor.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkHyperTreeGridOrientedGeometryCursor.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedGeometryCursor.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedGeometryCursor.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImageData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImageData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImageData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImageIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImageIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImageIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImageTransform.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImageTransform.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImageTransform.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitBoolean.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitBoolean.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitBoolean.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitFunction.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitFunction.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitFunction.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitFunctionCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitFunctionCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitFunctionCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitHalo.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitHalo.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitHalo.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitSelectionLoop.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitSelectionLoop.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitSelectionLoop.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitSum.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitSum.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitSum.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitVolume.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitVolume.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitVolume.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkImplicitWindowFunction.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitWindowFunction.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkImplicitWindowFunction.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkInEdgeIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkInEdgeIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkInEdgeIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkIncrementalOctreeNode.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreeNode.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreeNode.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkIncrementalOctreePointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreePointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreePointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkIncrementalPointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIncrementalPointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIncrementalPointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkInformationQuadratureSchemeDefinitionVectorKey.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkInformationQuadratureSchemeDefinitionVectorKey.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkInformationQuadratureSchemeDefinitionVectorKey.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkIterativeClosestPointTransform.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIterativeClosestPointTransform.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkIterativeClosestPointTransform.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkKdNode.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkKdNode.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkKdNode.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkKdTree.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkKdTree.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkKdTree.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkKdTreePointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkKdTreePointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkKdTreePointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLagrangeCurve.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeCurve.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeCurve.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLagrangeHexahedron.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeHexahedron.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeHexahedron.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLagrangeInterpolation.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeInterpolation.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeInterpolation.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLagrangeQuadrilateral.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeQuadrilateral.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeQuadrilateral.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLagrangeTetra.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeTetra.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeTetra.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLagrangeTriangle.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeTriangle.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeTriangle.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLagrangeWedge.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeWedge.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLagrangeWedge.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLine.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLine.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLine.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMarchingCubesTriangleCases.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMarchingCubesTriangleCases.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMarchingCubesTriangleCases.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMarchingSquaresLineCases.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMarchingSquaresLineCases.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMarchingSquaresLineCases.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMeanValueCoordinatesInterpolator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMeanValueCoordinatesInterpolator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMeanValueCoordinatesInterpolator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMergePoints.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMergePoints.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMergePoints.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMolecule.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMolecule.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMolecule.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMultiBlockDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMultiBlockDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMultiBlockDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMultiPieceDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMultiPieceDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMultiPieceDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMutableDirectedGraph.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMutableDirectedGraph.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMutableDirectedGraph.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkMutableUndirectedGraph.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMutableUndirectedGraph.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkMutableUndirectedGraph.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkNonLinearCell.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkNonLinearCell.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkNonLinearCell.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkNonMergingPointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkNonMergingPointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkNonMergingPointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkNonOverlappingAMR.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkNonOverlappingAMR.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkNonOverlappingAMR.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkOctreePointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOctreePointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOctreePointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkOctreePointLocatorNode.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOctreePointLocatorNode.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOctreePointLocatorNode.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkOrderedTriangulator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOrderedTriangulator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOrderedTriangulator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkOutEdgeIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOutEdgeIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOutEdgeIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkOverlappingAMR.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOverlappingAMR.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkOverlappingAMR.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPartitionedDataSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPartitionedDataSetCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSetCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSetCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPath.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPath.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPath.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPentagonalPrism.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPentagonalPrism.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPentagonalPrism.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPerlinNoise.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPerlinNoise.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPerlinNoise.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPiecewiseFunction.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPiecewiseFunction.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPiecewiseFunction.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPixel.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPixel.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPixel.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPixelExtent.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPixelExtent.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPixelExtent.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPixelTransfer.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPixelTransfer.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPixelTransfer.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPlane.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlane.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlane.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPlaneCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlaneCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlaneCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPlanes.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlanes.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlanes.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPlanesIntersection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlanesIntersection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPlanesIntersection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPointData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPointSet.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointSet.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointSet.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPointSetCellIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointSetCellIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointSetCellIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPointsProjectedHull.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointsProjectedHull.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPointsProjectedHull.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPolyData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPolyDataCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyDataCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyDataCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPolyLine.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyLine.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyLine.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPolyPlane.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyPlane.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyPlane.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPolyVertex.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyVertex.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyVertex.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPolygon.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolygon.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolygon.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPolyhedron.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyhedron.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPolyhedron.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkPyramid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPyramid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkPyramid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuad.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuad.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuad.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticEdge.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticEdge.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticEdge.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticHexahedron.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticHexahedron.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticHexahedron.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticLinearQuad.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearQuad.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearQuad.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticLinearWedge.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearWedge.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearWedge.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticPolygon.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticPolygon.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticPolygon.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticPyramid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticPyramid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticPyramid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticQuad.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticQuad.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticQuad.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticTetra.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticTetra.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticTetra.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticTriangle.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticTriangle.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticTriangle.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadraticWedge.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticWedge.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadraticWedge.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadratureSchemeDefinition.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadratureSchemeDefinition.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadratureSchemeDefinition.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkQuadric.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadric.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkQuadric.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkRectilinearGrid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkRectilinearGrid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkRectilinearGrid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkReebGraph.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkReebGraph.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkReebGraph.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkReebGraphSimplificationMetric.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkReebGraphSimplificationMetric.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkReebGraphSimplificationMetric.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSelection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSelection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSelection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSelectionNode.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSelectionNode.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSelectionNode.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSimpleCellTessellator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSimpleCellTessellator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSimpleCellTessellator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSmoothErrorMetric.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSmoothErrorMetric.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSmoothErrorMetric.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSortFieldData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSortFieldData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSortFieldData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSphere.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSphere.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSphere.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSpheres.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSpheres.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSpheres.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSpline.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSpline.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSpline.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStaticCellLinks.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticCellLinks.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticCellLinks.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStaticCellLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticCellLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticCellLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStaticPointLocator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStaticPointLocator2D.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator2D.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator2D.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStructuredData.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredData.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredData.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStructuredExtent.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredExtent.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredExtent.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStructuredGrid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredGrid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredGrid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStructuredPoints.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredPoints.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredPoints.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkStructuredPointsCollection.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredPointsCollection.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkStructuredPointsCollection.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkSuperquadric.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSuperquadric.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkSuperquadric.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTable.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTable.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTable.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTetra.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTetra.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTetra.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTree.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTree.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTree.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTreeBFSIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTreeBFSIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTreeBFSIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTreeDFSIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTreeDFSIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTreeDFSIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTreeIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTreeIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTreeIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTriQuadraticHexahedron.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTriQuadraticHexahedron.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTriQuadraticHexahedron.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTriangle.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTriangle.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTriangle.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkTriangleStrip.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTriangleStrip.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkTriangleStrip.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUndirectedGraph.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUndirectedGraph.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUndirectedGraph.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUniformGrid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformGrid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformGrid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUniformGridAMR.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformGridAMR.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformGridAMR.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUniformGridAMRDataIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformGridAMRDataIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformGridAMRDataIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUniformHyperTreeGrid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformHyperTreeGrid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUniformHyperTreeGrid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUnstructuredGrid.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUnstructuredGrid.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUnstructuredGrid.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUnstructuredGridBase.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridBase.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridBase.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkUnstructuredGridCellIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridCellIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridCellIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkVertex.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkVertex.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkVertex.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkVertexListIterator.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkVertexListIterator.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkVertexListIterator.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkVoxel.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkVoxel.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkVoxel.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkWedge.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkWedge.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkWedge.cxx.o.d"
+  "/root/repo/Common/DataModel/vtkXMLDataElement.cxx" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkXMLDataElement.cxx.o" "gcc" "Common/DataModel/CMakeFiles/CommonDataModel.dir/vtkXMLDataElement.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonDataModel-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonDataModel-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonDataModel-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonDataModel-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/System/CMakeFiles/CommonSystem.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,465 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonDataModel-8.90.pdb"
+  "../../lib/libvtkCommonDataModel-8.90.so"
+  "../../lib/libvtkCommonDataModel-8.90.so.1"
+  "../../lib/libvtkCommonDataModel-8.90.so.8.90.0"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRBox.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRBox.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRDataInternals.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRDataInternals.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRInformation.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRInformation.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRUtilities.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAMRUtilities.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractCellLinks.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractCellLinks.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractCellLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractCellLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractElectronicData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractElectronicData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractPointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAbstractPointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAdjacentVertexIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAdjacentVertexIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAnimationScene.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAnimationScene.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAnnotation.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAnnotation.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAnnotationLayers.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAnnotationLayers.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkArrayData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkArrayData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAtom.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAtom.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkAttributesErrorMetric.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkAttributesErrorMetric.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBSPCuts.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBSPCuts.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBSPIntersections.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBSPIntersections.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBVHCellLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBVHCellLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuad.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuad.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticHexahedron.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticHexahedron.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticWedge.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticQuadraticWedge.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticTriangle.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBiQuadraticTriangle.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBond.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBond.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBoundingBox.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBoundingBox.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkBox.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkBox.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCell.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCell.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCell3D.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCell3D.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellArray.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellArray.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellArrayIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellArrayIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellLinks.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellLinks.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellLocatorStrategy.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellLocatorStrategy.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCellTypes.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCellTypes.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkClosestNPointsStrategy.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkClosestNPointsStrategy.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkClosestPointStrategy.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkClosestPointStrategy.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCompositeDataIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCompositeDataIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCompositeDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCompositeDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCone.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCone.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkConvexPointSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkConvexPointSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCubicLine.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCubicLine.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkCylinder.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkCylinder.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObject.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObject.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectTree.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectTree.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectTreeIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectTreeIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectTypes.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataObjectTypes.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetAttributes.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetAttributes.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetAttributesFieldList.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetAttributesFieldList.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetCellIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetCellIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDataSetCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDirectedAcyclicGraph.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDirectedAcyclicGraph.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDirectedGraph.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDirectedGraph.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkDistributedGraphHelper.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkDistributedGraphHelper.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkEdgeListIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkEdgeListIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkEdgeTable.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkEdgeTable.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkEmptyCell.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkEmptyCell.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkExplicitStructuredGrid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkExplicitStructuredGrid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkExtractStructuredGridHelper.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkExtractStructuredGridHelper.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkFieldData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkFieldData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkFindCellStrategy.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkFindCellStrategy.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericAdaptorCell.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericAdaptorCell.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericAttribute.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericAttribute.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericAttributeCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericAttributeCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericCell.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericCell.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericCellIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericCellIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericCellTessellator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericCellTessellator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericEdgeTable.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericEdgeTable.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericPointIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericPointIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericSubdivisionErrorMetric.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGenericSubdivisionErrorMetric.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGeometricErrorMetric.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGeometricErrorMetric.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGraph.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGraph.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGraphEdge.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGraphEdge.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkGraphInternals.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkGraphInternals.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHexagonalPrism.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHexagonalPrism.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHexahedron.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHexahedron.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHierarchicalBoxDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTree.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTree.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGrid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGrid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridEntry.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridEntry.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryEntry.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryEntry.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryLevelEntry.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridGeometryLevelEntry.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridLevelEntry.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridLevelEntry.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedCursor.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedCursor.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedGeometryCursor.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedGeometryCursor.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursor.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursor.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursorLight.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedMooreSuperCursorLight.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursor.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursor.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursorLight.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedSuperCursorLight.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursorLight.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridNonOrientedVonNeumannSuperCursorLight.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedCursor.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedCursor.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedGeometryCursor.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkHyperTreeGridOrientedGeometryCursor.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImageData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImageData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImageIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImageIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImageTransform.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImageTransform.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitBoolean.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitBoolean.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitFunction.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitFunction.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitFunctionCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitFunctionCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitHalo.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitHalo.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitSelectionLoop.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitSelectionLoop.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitSum.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitSum.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitVolume.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitVolume.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitWindowFunction.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkImplicitWindowFunction.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkInEdgeIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkInEdgeIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreeNode.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreeNode.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreePointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkIncrementalOctreePointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkIncrementalPointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkIncrementalPointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkInformationQuadratureSchemeDefinitionVectorKey.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkInformationQuadratureSchemeDefinitionVectorKey.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkIterativeClosestPointTransform.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkIterativeClosestPointTransform.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkKdNode.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkKdNode.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkKdTree.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkKdTree.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkKdTreePointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkKdTreePointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeCurve.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeCurve.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeHexahedron.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeHexahedron.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeInterpolation.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeInterpolation.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeQuadrilateral.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeQuadrilateral.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeTetra.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeTetra.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeTriangle.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeTriangle.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeWedge.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLagrangeWedge.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLine.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLine.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMarchingCubesTriangleCases.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMarchingCubesTriangleCases.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMarchingSquaresLineCases.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMarchingSquaresLineCases.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMeanValueCoordinatesInterpolator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMeanValueCoordinatesInterpolator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMergePoints.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMergePoints.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMolecule.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMolecule.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMultiBlockDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMultiBlockDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMultiPieceDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMultiPieceDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMutableDirectedGraph.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMutableDirectedGraph.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkMutableUndirectedGraph.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkMutableUndirectedGraph.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkNonLinearCell.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkNonLinearCell.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkNonMergingPointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkNonMergingPointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkNonOverlappingAMR.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkNonOverlappingAMR.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkOctreePointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkOctreePointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkOctreePointLocatorNode.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkOctreePointLocatorNode.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkOrderedTriangulator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkOrderedTriangulator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkOutEdgeIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkOutEdgeIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkOverlappingAMR.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkOverlappingAMR.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSetCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPartitionedDataSetCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPath.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPath.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPentagonalPrism.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPentagonalPrism.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPerlinNoise.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPerlinNoise.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPiecewiseFunction.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPiecewiseFunction.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPixel.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPixel.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPixelExtent.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPixelExtent.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPixelTransfer.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPixelTransfer.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPlane.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPlane.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPlaneCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPlaneCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPlanes.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPlanes.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPlanesIntersection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPlanesIntersection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPointData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPointData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPointSet.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPointSet.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPointSetCellIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPointSetCellIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPointsProjectedHull.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPointsProjectedHull.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyDataCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyDataCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyLine.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyLine.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyPlane.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyPlane.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyVertex.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyVertex.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPolygon.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPolygon.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyhedron.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPolyhedron.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkPyramid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkPyramid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuad.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuad.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticEdge.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticEdge.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticHexahedron.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticHexahedron.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearQuad.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearQuad.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearWedge.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticLinearWedge.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticPolygon.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticPolygon.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticPyramid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticPyramid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticQuad.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticQuad.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticTetra.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticTetra.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticTriangle.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticTriangle.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticWedge.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadraticWedge.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadratureSchemeDefinition.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadratureSchemeDefinition.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadric.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkQuadric.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkRectilinearGrid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkRectilinearGrid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkReebGraph.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkReebGraph.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkReebGraphSimplificationMetric.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkReebGraphSimplificationMetric.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSelection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSelection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSelectionNode.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSelectionNode.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSimpleCellTessellator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSimpleCellTessellator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSmoothErrorMetric.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSmoothErrorMetric.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSortFieldData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSortFieldData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSphere.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSphere.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSpheres.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSpheres.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSpline.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSpline.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticCellLinks.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticCellLinks.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticCellLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticCellLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator2D.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStaticPointLocator2D.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredData.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredData.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredExtent.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredExtent.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredGrid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredGrid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredPoints.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredPoints.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredPointsCollection.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkStructuredPointsCollection.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkSuperquadric.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkSuperquadric.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTable.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTable.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTetra.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTetra.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTree.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTree.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTreeBFSIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTreeBFSIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTreeDFSIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTreeDFSIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTreeIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTreeIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTriQuadraticHexahedron.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTriQuadraticHexahedron.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTriangle.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTriangle.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkTriangleStrip.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkTriangleStrip.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUndirectedGraph.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUndirectedGraph.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformGrid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformGrid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformGridAMR.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformGridAMR.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformGridAMRDataIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformGridAMRDataIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformHyperTreeGrid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUniformHyperTreeGrid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUnstructuredGrid.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUnstructuredGrid.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridBase.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridBase.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridCellIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkUnstructuredGridCellIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkVertex.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkVertex.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkVertexListIterator.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkVertexListIterator.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkVoxel.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkVoxel.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkWedge.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkWedge.cxx.o.d"
+  "CMakeFiles/CommonDataModel.dir/vtkXMLDataElement.cxx.o"
+  "CMakeFiles/CommonDataModel.dir/vtkXMLDataElement.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonDataModel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
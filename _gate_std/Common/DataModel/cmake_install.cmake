@@ -0,0 +1,359 @@
+# Install script for directory: /root/repo/Common/DataModel
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Common/DataModel/vtkCellType.h"
+    "/root/repo/Common/DataModel/vtkColor.h"
+    "/root/repo/Common/DataModel/vtkCompositeDataSetRange.h"
+    "/root/repo/Common/DataModel/vtkDataArrayDispatcher.h"
+    "/root/repo/Common/DataModel/vtkDataObjectTreeRange.h"
+    "/root/repo/Common/DataModel/vtkDispatcher.h"
+    "/root/repo/Common/DataModel/vtkDispatcher_Private.h"
+    "/root/repo/Common/DataModel/vtkDoubleDispatcher.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridTools.h"
+    "/root/repo/Common/DataModel/vtkIntersectionCounter.h"
+    "/root/repo/Common/DataModel/vtkRect.h"
+    "/root/repo/Common/DataModel/vtkVector.h"
+    "/root/repo/Common/DataModel/vtkVectorOperators.h"
+    "/root/repo/Common/DataModel/vtkAMRBox.h"
+    "/root/repo/Common/DataModel/vtkAMRUtilities.h"
+    "/root/repo/Common/DataModel/vtkAbstractCellLinks.h"
+    "/root/repo/Common/DataModel/vtkAbstractCellLocator.h"
+    "/root/repo/Common/DataModel/vtkAbstractElectronicData.h"
+    "/root/repo/Common/DataModel/vtkAbstractPointLocator.h"
+    "/root/repo/Common/DataModel/vtkAdjacentVertexIterator.h"
+    "/root/repo/Common/DataModel/vtkAnimationScene.h"
+    "/root/repo/Common/DataModel/vtkAnnotation.h"
+    "/root/repo/Common/DataModel/vtkAnnotationLayers.h"
+    "/root/repo/Common/DataModel/vtkArrayData.h"
+    "/root/repo/Common/DataModel/vtkAtom.h"
+    "/root/repo/Common/DataModel/vtkAttributesErrorMetric.h"
+    "/root/repo/Common/DataModel/vtkBSPCuts.h"
+    "/root/repo/Common/DataModel/vtkBSPIntersections.h"
+    "/root/repo/Common/DataModel/vtkBVHCellLocator.h"
+    "/root/repo/Common/DataModel/vtkBiQuadraticQuad.h"
+    "/root/repo/Common/DataModel/vtkBiQuadraticQuadraticHexahedron.h"
+    "/root/repo/Common/DataModel/vtkBiQuadraticQuadraticWedge.h"
+    "/root/repo/Common/DataModel/vtkBiQuadraticTriangle.h"
+    "/root/repo/Common/DataModel/vtkBond.h"
+    "/root/repo/Common/DataModel/vtkBoundingBox.h"
+    "/root/repo/Common/DataModel/vtkBox.h"
+    "/root/repo/Common/DataModel/vtkCell.h"
+    "/root/repo/Common/DataModel/vtkCell3D.h"
+    "/root/repo/Common/DataModel/vtkCellArray.h"
+    "/root/repo/Common/DataModel/vtkCellArrayIterator.h"
+    "/root/repo/Common/DataModel/vtkCellData.h"
+    "/root/repo/Common/DataModel/vtkCellIterator.h"
+    "/root/repo/Common/DataModel/vtkCellLinks.h"
+    "/root/repo/Common/DataModel/vtkCellLocator.h"
+    "/root/repo/Common/DataModel/vtkCellLocatorStrategy.h"
+    "/root/repo/Common/DataModel/vtkCellTypes.h"
+    "/root/repo/Common/DataModel/vtkClosestNPointsStrategy.h"
+    "/root/repo/Common/DataModel/vtkClosestPointStrategy.h"
+    "/root/repo/Common/DataModel/vtkCompositeDataIterator.h"
+    "/root/repo/Common/DataModel/vtkCompositeDataSet.h"
+    "/root/repo/Common/DataModel/vtkCone.h"
+    "/root/repo/Common/DataModel/vtkConvexPointSet.h"
+    "/root/repo/Common/DataModel/vtkCubicLine.h"
+    "/root/repo/Common/DataModel/vtkCylinder.h"
+    "/root/repo/Common/DataModel/vtkDataObject.h"
+    "/root/repo/Common/DataModel/vtkDataObjectCollection.h"
+    "/root/repo/Common/DataModel/vtkDataObjectTree.h"
+    "/root/repo/Common/DataModel/vtkDataObjectTreeIterator.h"
+    "/root/repo/Common/DataModel/vtkDataObjectTypes.h"
+    "/root/repo/Common/DataModel/vtkDataSet.h"
+    "/root/repo/Common/DataModel/vtkDataSetAttributes.h"
+    "/root/repo/Common/DataModel/vtkDataSetAttributesFieldList.h"
+    "/root/repo/Common/DataModel/vtkDataSetCellIterator.h"
+    "/root/repo/Common/DataModel/vtkDataSetCollection.h"
+    "/root/repo/Common/DataModel/vtkDirectedAcyclicGraph.h"
+    "/root/repo/Common/DataModel/vtkDirectedGraph.h"
+    "/root/repo/Common/DataModel/vtkDistributedGraphHelper.h"
+    "/root/repo/Common/DataModel/vtkEdgeListIterator.h"
+    "/root/repo/Common/DataModel/vtkEdgeTable.h"
+    "/root/repo/Common/DataModel/vtkEmptyCell.h"
+    "/root/repo/Common/DataModel/vtkExplicitStructuredGrid.h"
+    "/root/repo/Common/DataModel/vtkExtractStructuredGridHelper.h"
+    "/root/repo/Common/DataModel/vtkFieldData.h"
+    "/root/repo/Common/DataModel/vtkFindCellStrategy.h"
+    "/root/repo/Common/DataModel/vtkGenericAdaptorCell.h"
+    "/root/repo/Common/DataModel/vtkGenericAttribute.h"
+    "/root/repo/Common/DataModel/vtkGenericAttributeCollection.h"
+    "/root/repo/Common/DataModel/vtkGenericCell.h"
+    "/root/repo/Common/DataModel/vtkGenericCellIterator.h"
+    "/root/repo/Common/DataModel/vtkGenericCellTessellator.h"
+    "/root/repo/Common/DataModel/vtkGenericDataSet.h"
+    "/root/repo/Common/DataModel/vtkGenericEdgeTable.h"
+    "/root/repo/Common/DataModel/vtkGenericInterpolatedVelocityField.h"
+    "/root/repo/Common/DataModel/vtkGenericPointIterator.h"
+    "/root/repo/Common/DataModel/vtkGenericSubdivisionErrorMetric.h"
+    "/root/repo/Common/DataModel/vtkGeometricErrorMetric.h"
+    "/root/repo/Common/DataModel/vtkGraph.h"
+    "/root/repo/Common/DataModel/vtkGraphEdge.h"
+    "/root/repo/Common/DataModel/vtkGraphInternals.h"
+    "/root/repo/Common/DataModel/vtkHexagonalPrism.h"
+    "/root/repo/Common/DataModel/vtkHexahedron.h"
+    "/root/repo/Common/DataModel/vtkHierarchicalBoxDataIterator.h"
+    "/root/repo/Common/DataModel/vtkHierarchicalBoxDataSet.h"
+    "/root/repo/Common/DataModel/vtkHyperTree.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGrid.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridEntry.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridGeometryEntry.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridGeometryLevelEntry.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridLevelEntry.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedCursor.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedGeometryCursor.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedMooreSuperCursor.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedMooreSuperCursorLight.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedSuperCursor.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedSuperCursorLight.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridNonOrientedVonNeumannSuperCursorLight.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridOrientedCursor.h"
+    "/root/repo/Common/DataModel/vtkHyperTreeGridOrientedGeometryCursor.h"
+    "/root/repo/Common/DataModel/vtkImageData.h"
+    "/root/repo/Common/DataModel/vtkImageIterator.h"
+    "/root/repo/Common/DataModel/vtkImageTransform.h"
+    "/root/repo/Common/DataModel/vtkImplicitBoolean.h"
+    "/root/repo/Common/DataModel/vtkImplicitDataSet.h"
+    "/root/repo/Common/DataModel/vtkImplicitFunction.h"
+    "/root/repo/Common/DataModel/vtkImplicitFunctionCollection.h"
+    "/root/repo/Common/DataModel/vtkImplicitHalo.h"
+    "/root/repo/Common/DataModel/vtkImplicitSelectionLoop.h"
+    "/root/repo/Common/DataModel/vtkImplicitSum.h"
+    "/root/repo/Common/DataModel/vtkImplicitVolume.h"
+    "/root/repo/Common/DataModel/vtkImplicitWindowFunction.h"
+    "/root/repo/Common/DataModel/vtkInEdgeIterator.h"
+    "/root/repo/Common/DataModel/vtkIncrementalOctreeNode.h"
+    "/root/repo/Common/DataModel/vtkIncrementalOctreePointLocator.h"
+    "/root/repo/Common/DataModel/vtkIncrementalPointLocator.h"
+    "/root/repo/Common/DataModel/vtkInformationQuadratureSchemeDefinitionVectorKey.h"
+    "/root/repo/Common/DataModel/vtkIterativeClosestPointTransform.h"
+    "/root/repo/Common/DataModel/vtkKdNode.h"
+    "/root/repo/Common/DataModel/vtkKdTree.h"
+    "/root/repo/Common/DataModel/vtkKdTreePointLocator.h"
+    "/root/repo/Common/DataModel/vtkLagrangeCurve.h"
+    "/root/repo/Common/DataModel/vtkLagrangeHexahedron.h"
+    "/root/repo/Common/DataModel/vtkLagrangeInterpolation.h"
+    "/root/repo/Common/DataModel/vtkLagrangeQuadrilateral.h"
+    "/root/repo/Common/DataModel/vtkLagrangeTetra.h"
+    "/root/repo/Common/DataModel/vtkLagrangeTriangle.h"
+    "/root/repo/Common/DataModel/vtkLagrangeWedge.h"
+    "/root/repo/Common/DataModel/vtkLine.h"
+    "/root/repo/Common/DataModel/vtkLocator.h"
+    "/root/repo/Common/DataModel/vtkMarchingCubesTriangleCases.h"
+    "/root/repo/Common/DataModel/vtkMarchingSquaresLineCases.h"
+    "/root/repo/Common/DataModel/vtkMeanValueCoordinatesInterpolator.h"
+    "/root/repo/Common/DataModel/vtkMergePoints.h"
+    "/root/repo/Common/DataModel/vtkMolecule.h"
+    "/root/repo/Common/DataModel/vtkMultiBlockDataSet.h"
+    "/root/repo/Common/DataModel/vtkMultiPieceDataSet.h"
+    "/root/repo/Common/DataModel/vtkMutableDirectedGraph.h"
+    "/root/repo/Common/DataModel/vtkMutableUndirectedGraph.h"
+    "/root/repo/Common/DataModel/vtkNonLinearCell.h"
+    "/root/repo/Common/DataModel/vtkNonMergingPointLocator.h"
+    "/root/repo/Common/DataModel/vtkOctreePointLocator.h"
+    "/root/repo/Common/DataModel/vtkOctreePointLocatorNode.h"
+    "/root/repo/Common/DataModel/vtkOrderedTriangulator.h"
+    "/root/repo/Common/DataModel/vtkOutEdgeIterator.h"
+    "/root/repo/Common/DataModel/vtkPartitionedDataSet.h"
+    "/root/repo/Common/DataModel/vtkPartitionedDataSetCollection.h"
+    "/root/repo/Common/DataModel/vtkPath.h"
+    "/root/repo/Common/DataModel/vtkPentagonalPrism.h"
+    "/root/repo/Common/DataModel/vtkPerlinNoise.h"
+    "/root/repo/Common/DataModel/vtkPiecewiseFunction.h"
+    "/root/repo/Common/DataModel/vtkPixel.h"
+    "/root/repo/Common/DataModel/vtkPixelExtent.h"
+    "/root/repo/Common/DataModel/vtkPixelTransfer.h"
+    "/root/repo/Common/DataModel/vtkPlane.h"
+    "/root/repo/Common/DataModel/vtkPlaneCollection.h"
+    "/root/repo/Common/DataModel/vtkPlanes.h"
+    "/root/repo/Common/DataModel/vtkPlanesIntersection.h"
+    "/root/repo/Common/DataModel/vtkPointData.h"
+    "/root/repo/Common/DataModel/vtkPointLocator.h"
+    "/root/repo/Common/DataModel/vtkPointSet.h"
+    "/root/repo/Common/DataModel/vtkPointSetCellIterator.h"
+    "/root/repo/Common/DataModel/vtkPointsProjectedHull.h"
+    "/root/repo/Common/DataModel/vtkPolyData.h"
+    "/root/repo/Common/DataModel/vtkPolyDataCollection.h"
+    "/root/repo/Common/DataModel/vtkPolyLine.h"
+    "/root/repo/Common/DataModel/vtkPolyPlane.h"
+    "/root/repo/Common/DataModel/vtkPolyVertex.h"
+    "/root/repo/Common/DataModel/vtkPolygon.h"
+    "/root/repo/Common/DataModel/vtkPolyhedron.h"
+    "/root/repo/Common/DataModel/vtkPyramid.h"
+    "/root/repo/Common/DataModel/vtkQuad.h"
+    "/root/repo/Common/DataModel/vtkQuadraticEdge.h"
+    "/root/repo/Common/DataModel/vtkQuadraticHexahedron.h"
+    "/root/repo/Common/DataModel/vtkQuadraticLinearQuad.h"
+    "/root/repo/Common/DataModel/vtkQuadraticLinearWedge.h"
+    "/root/repo/Common/DataModel/vtkQuadraticPolygon.h"
+    "/root/repo/Common/DataModel/vtkQuadraticPyramid.h"
+    "/root/repo/Common/DataModel/vtkQuadraticQuad.h"
+    "/root/repo/Common/DataModel/vtkQuadraticTetra.h"
+    "/root/repo/Common/DataModel/vtkQuadraticTriangle.h"
+    "/root/repo/Common/DataModel/vtkQuadraticWedge.h"
+    "/root/repo/Common/DataModel/vtkQuadratureSchemeDefinition.h"
+    "/root/repo/Common/DataModel/vtkQuadric.h"
+    "/root/repo/Common/DataModel/vtkRectilinearGrid.h"
+    "/root/repo/Common/DataModel/vtkReebGraph.h"
+    "/root/repo/Common/DataModel/vtkReebGraphSimplificationMetric.h"
+    "/root/repo/Common/DataModel/vtkSelection.h"
+    "/root/repo/Common/DataModel/vtkSelectionNode.h"
+    "/root/repo/Common/DataModel/vtkSimpleCellTessellator.h"
+    "/root/repo/Common/DataModel/vtkSmoothErrorMetric.h"
+    "/root/repo/Common/DataModel/vtkSortFieldData.h"
+    "/root/repo/Common/DataModel/vtkSphere.h"
+    "/root/repo/Common/DataModel/vtkSpheres.h"
+    "/root/repo/Common/DataModel/vtkSpline.h"
+    "/root/repo/Common/DataModel/vtkStaticCellLinks.h"
+    "/root/repo/Common/DataModel/vtkStaticCellLocator.h"
+    "/root/repo/Common/DataModel/vtkStaticPointLocator.h"
+    "/root/repo/Common/DataModel/vtkStaticPointLocator2D.h"
+    "/root/repo/Common/DataModel/vtkStructuredData.h"
+    "/root/repo/Common/DataModel/vtkStructuredExtent.h"
+    "/root/repo/Common/DataModel/vtkStructuredGrid.h"
+    "/root/repo/Common/DataModel/vtkStructuredPoints.h"
+    "/root/repo/Common/DataModel/vtkStructuredPointsCollection.h"
+    "/root/repo/Common/DataModel/vtkSuperquadric.h"
+    "/root/repo/Common/DataModel/vtkTable.h"
+    "/root/repo/Common/DataModel/vtkTetra.h"
+    "/root/repo/Common/DataModel/vtkTree.h"
+    "/root/repo/Common/DataModel/vtkTreeBFSIterator.h"
+    "/root/repo/Common/DataModel/vtkTreeDFSIterator.h"
+    "/root/repo/Common/DataModel/vtkTreeIterator.h"
+    "/root/repo/Common/DataModel/vtkTriQuadraticHexahedron.h"
+    "/root/repo/Common/DataModel/vtkTriangle.h"
+    "/root/repo/Common/DataModel/vtkTriangleStrip.h"
+    "/root/repo/Common/DataModel/vtkUndirectedGraph.h"
+    "/root/repo/Common/DataModel/vtkUniformGrid.h"
+    "/root/repo/Common/DataModel/vtkUniformHyperTreeGrid.h"
+    "/root/repo/Common/DataModel/vtkUnstructuredGrid.h"
+    "/root/repo/Common/DataModel/vtkUnstructuredGridBase.h"
+    "/root/repo/Common/DataModel/vtkUnstructuredGridCellIterator.h"
+    "/root/repo/Common/DataModel/vtkVertex.h"
+    "/root/repo/Common/DataModel/vtkVertexListIterator.h"
+    "/root/repo/Common/DataModel/vtkVoxel.h"
+    "/root/repo/Common/DataModel/vtkWedge.h"
+    "/root/repo/Common/DataModel/vtkXMLDataElement.h"
+    "/root/repo/Common/DataModel/vtkAMRDataInternals.h"
+    "/root/repo/Common/DataModel/vtkAMRInformation.h"
+    "/root/repo/Common/DataModel/vtkNonOverlappingAMR.h"
+    "/root/repo/Common/DataModel/vtkOverlappingAMR.h"
+    "/root/repo/Common/DataModel/vtkUniformGridAMR.h"
+    "/root/repo/Common/DataModel/vtkUniformGridAMRDataIterator.h"
+    "/root/repo/Common/DataModel/vtkAngularPeriodicDataArray.h"
+    "/root/repo/Common/DataModel/vtkArrayListTemplate.h"
+    "/root/repo/Common/DataModel/vtkMappedUnstructuredGrid.h"
+    "/root/repo/Common/DataModel/vtkMappedUnstructuredGridCellIterator.h"
+    "/root/repo/Common/DataModel/vtkPeriodicDataArray.h"
+    "/root/repo/Common/DataModel/vtkStaticCellLinksTemplate.h"
+    "/root/repo/_gate_std/Common/DataModel/vtkCommonDataModelModule.h"
+    "/root/repo/Common/DataModel/vtkAngularPeriodicDataArray.txx"
+    "/root/repo/Common/DataModel/vtkArrayListTemplate.txx"
+    "/root/repo/Common/DataModel/vtkMappedUnstructuredGrid.txx"
+    "/root/repo/Common/DataModel/vtkMappedUnstructuredGridCellIterator.txx"
+    "/root/repo/Common/DataModel/vtkPeriodicDataArray.txx"
+    "/root/repo/Common/DataModel/vtkStaticCellLinksTemplate.txx"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkCommonDataModel-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkCommonDataModel-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkCommonDataModel-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkCommonDataModel-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkCommonDataModel-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonDataModel-8.90.so")
+    endif()
+  endif()
+endif()
+
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonExecutionModel-hierarchy.txt"
+  "CMakeFiles/CommonExecutionModel-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonExecutionModel-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,99 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/ExecutionModel/vtkAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkAlgorithmOutput.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkAlgorithmOutput.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkAlgorithmOutput.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkAnnotationLayersAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkAnnotationLayersAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkAnnotationLayersAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkArrayDataAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkArrayDataAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkArrayDataAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkCachedStreamingDemandDrivenPipeline.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCachedStreamingDemandDrivenPipeline.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCachedStreamingDemandDrivenPipeline.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkCastToConcrete.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCastToConcrete.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCastToConcrete.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkCompositeDataPipeline.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataPipeline.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataPipeline.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkCompositeDataSetAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataSetAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataSetAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkDataObjectAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDataObjectAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDataObjectAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkDataSetAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDataSetAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDataSetAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkDemandDrivenPipeline.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDemandDrivenPipeline.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDemandDrivenPipeline.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkDirectedGraphAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDirectedGraphAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkDirectedGraphAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkEnsembleSource.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkEnsembleSource.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkEnsembleSource.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkExecutive.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExecutive.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExecutive.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkExplicitStructuredGridAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExplicitStructuredGridAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExplicitStructuredGridAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkExtentRCBPartitioner.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExtentRCBPartitioner.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExtentRCBPartitioner.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkExtentSplitter.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExtentSplitter.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExtentSplitter.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkExtentTranslator.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExtentTranslator.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkExtentTranslator.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkFilteringInformationKeyManager.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkFilteringInformationKeyManager.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkFilteringInformationKeyManager.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkGraphAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkGraphAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkGraphAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkHierarchicalBoxDataSetAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkHierarchicalBoxDataSetAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkHierarchicalBoxDataSetAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkHyperTreeGridAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkHyperTreeGridAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkHyperTreeGridAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkImageAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkImageInPlaceFilter.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageInPlaceFilter.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageInPlaceFilter.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkImageProgressIterator.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageProgressIterator.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageProgressIterator.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkImageToStructuredGrid.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredGrid.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredGrid.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkImageToStructuredPoints.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredPoints.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredPoints.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkInformationDataObjectMetaDataKey.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationDataObjectMetaDataKey.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationDataObjectMetaDataKey.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkInformationExecutivePortKey.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortKey.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortKey.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkInformationExecutivePortVectorKey.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortVectorKey.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortVectorKey.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkInformationIntegerRequestKey.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationIntegerRequestKey.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkInformationIntegerRequestKey.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkMoleculeAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkMoleculeAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkMoleculeAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkMultiBlockDataSetAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkMultiBlockDataSetAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkMultiBlockDataSetAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkMultiTimeStepAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkMultiTimeStepAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkMultiTimeStepAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkNonOverlappingAMRAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkNonOverlappingAMRAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkNonOverlappingAMRAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkOverlappingAMRAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkOverlappingAMRAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkOverlappingAMRAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkParallelReader.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkParallelReader.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkParallelReader.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkPassInputTypeAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPassInputTypeAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPassInputTypeAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkPiecewiseFunctionAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkPiecewiseFunctionShiftScale.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionShiftScale.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionShiftScale.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkPointSetAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPointSetAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPointSetAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkPolyDataAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPolyDataAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkPolyDataAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkProgressObserver.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkProgressObserver.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkProgressObserver.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkReaderAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkReaderAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkReaderAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkReaderExecutive.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkReaderExecutive.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkReaderExecutive.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkRectilinearGridAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkRectilinearGridAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkRectilinearGridAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkSMPProgressObserver.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSMPProgressObserver.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSMPProgressObserver.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkScalarTree.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkScalarTree.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkScalarTree.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkSelectionAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSelectionAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSelectionAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkSimpleImageToImageFilter.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSimpleImageToImageFilter.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSimpleImageToImageFilter.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkSimpleReader.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSimpleReader.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSimpleReader.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkSimpleScalarTree.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSimpleScalarTree.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSimpleScalarTree.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkSpanSpace.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSpanSpace.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSpanSpace.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkSphereTree.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSphereTree.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkSphereTree.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkStreamingDemandDrivenPipeline.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkStreamingDemandDrivenPipeline.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkStreamingDemandDrivenPipeline.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkStructuredGridAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkStructuredGridAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkStructuredGridAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkTableAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTableAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTableAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkThreadedCompositeDataPipeline.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkThreadedCompositeDataPipeline.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkThreadedCompositeDataPipeline.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkThreadedImageAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkThreadedImageAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkThreadedImageAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkTreeAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTreeAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTreeAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkTrivialConsumer.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTrivialConsumer.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTrivialConsumer.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkTrivialProducer.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTrivialProducer.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkTrivialProducer.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkUndirectedGraphAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUndirectedGraphAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUndirectedGraphAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkUniformGridAMRAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUniformGridAMRAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUniformGridAMRAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkUniformGridPartitioner.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUniformGridPartitioner.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUniformGridPartitioner.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkUnstructuredGridAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridAlgorithm.cxx.o.d"
+  "/root/repo/Common/ExecutionModel/vtkUnstructuredGridBaseAlgorithm.cxx" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridBaseAlgorithm.cxx.o" "gcc" "Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridBaseAlgorithm.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonExecutionModel-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonExecutionModel-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonExecutionModel-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonExecutionModel-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/System/CMakeFiles/CommonSystem.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,145 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonExecutionModel-8.90.pdb"
+  "../../lib/libvtkCommonExecutionModel-8.90.so"
+  "../../lib/libvtkCommonExecutionModel-8.90.so.1"
+  "../../lib/libvtkCommonExecutionModel-8.90.so.8.90.0"
+  "CMakeFiles/CommonExecutionModel.dir/vtkAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkAlgorithmOutput.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkAlgorithmOutput.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkAnnotationLayersAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkAnnotationLayersAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkArrayDataAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkArrayDataAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCachedStreamingDemandDrivenPipeline.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCachedStreamingDemandDrivenPipeline.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCastToConcrete.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCastToConcrete.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataPipeline.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataPipeline.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataSetAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkCompositeDataSetAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDataObjectAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDataObjectAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDataSetAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDataSetAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDemandDrivenPipeline.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDemandDrivenPipeline.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDirectedGraphAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkDirectedGraphAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkEnsembleSource.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkEnsembleSource.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExecutive.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExecutive.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExplicitStructuredGridAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExplicitStructuredGridAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExtentRCBPartitioner.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExtentRCBPartitioner.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExtentSplitter.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExtentSplitter.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExtentTranslator.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkExtentTranslator.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkFilteringInformationKeyManager.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkFilteringInformationKeyManager.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkGraphAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkGraphAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkHierarchicalBoxDataSetAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkHierarchicalBoxDataSetAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkHyperTreeGridAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkHyperTreeGridAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageInPlaceFilter.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageInPlaceFilter.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageProgressIterator.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageProgressIterator.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredGrid.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredGrid.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredPoints.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkImageToStructuredPoints.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationDataObjectMetaDataKey.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationDataObjectMetaDataKey.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortKey.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortKey.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortVectorKey.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationExecutivePortVectorKey.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationIntegerRequestKey.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkInformationIntegerRequestKey.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkMoleculeAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkMoleculeAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkMultiBlockDataSetAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkMultiBlockDataSetAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkMultiTimeStepAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkMultiTimeStepAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkNonOverlappingAMRAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkNonOverlappingAMRAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkOverlappingAMRAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkOverlappingAMRAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkParallelReader.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkParallelReader.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPassInputTypeAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPassInputTypeAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionShiftScale.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPiecewiseFunctionShiftScale.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPointSetAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPointSetAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPolyDataAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkPolyDataAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkProgressObserver.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkProgressObserver.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkReaderAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkReaderAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkReaderExecutive.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkReaderExecutive.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkRectilinearGridAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkRectilinearGridAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSMPProgressObserver.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSMPProgressObserver.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkScalarTree.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkScalarTree.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSelectionAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSelectionAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSimpleImageToImageFilter.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSimpleImageToImageFilter.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSimpleReader.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSimpleReader.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSimpleScalarTree.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSimpleScalarTree.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSpanSpace.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSpanSpace.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSphereTree.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkSphereTree.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkStreamingDemandDrivenPipeline.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkStreamingDemandDrivenPipeline.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkStructuredGridAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkStructuredGridAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTableAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTableAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkThreadedCompositeDataPipeline.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkThreadedCompositeDataPipeline.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkThreadedImageAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkThreadedImageAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTreeAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTreeAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTrivialConsumer.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTrivialConsumer.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTrivialProducer.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkTrivialProducer.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUndirectedGraphAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUndirectedGraphAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUniformGridAMRAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUniformGridAMRAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUniformGridPartitioner.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUniformGridPartitioner.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridAlgorithm.cxx.o.d"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridBaseAlgorithm.cxx.o"
+  "CMakeFiles/CommonExecutionModel.dir/vtkUnstructuredGridBaseAlgorithm.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonExecutionModel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
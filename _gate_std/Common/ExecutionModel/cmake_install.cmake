@@ -0,0 +1,174 @@
+# Install script for directory: /root/repo/Common/ExecutionModel
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Common/ExecutionModel/vtkAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkAlgorithmOutput.h"
+    "/root/repo/Common/ExecutionModel/vtkAnnotationLayersAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkArrayDataAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkCachedStreamingDemandDrivenPipeline.h"
+    "/root/repo/Common/ExecutionModel/vtkCastToConcrete.h"
+    "/root/repo/Common/ExecutionModel/vtkCompositeDataPipeline.h"
+    "/root/repo/Common/ExecutionModel/vtkCompositeDataSetAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkDataObjectAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkDataSetAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkDemandDrivenPipeline.h"
+    "/root/repo/Common/ExecutionModel/vtkDirectedGraphAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkEnsembleSource.h"
+    "/root/repo/Common/ExecutionModel/vtkExecutive.h"
+    "/root/repo/Common/ExecutionModel/vtkExplicitStructuredGridAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkExtentRCBPartitioner.h"
+    "/root/repo/Common/ExecutionModel/vtkExtentSplitter.h"
+    "/root/repo/Common/ExecutionModel/vtkExtentTranslator.h"
+    "/root/repo/Common/ExecutionModel/vtkFilteringInformationKeyManager.h"
+    "/root/repo/Common/ExecutionModel/vtkGraphAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkHierarchicalBoxDataSetAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkHyperTreeGridAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkImageAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkImageInPlaceFilter.h"
+    "/root/repo/Common/ExecutionModel/vtkImageProgressIterator.h"
+    "/root/repo/Common/ExecutionModel/vtkImageToStructuredGrid.h"
+    "/root/repo/Common/ExecutionModel/vtkImageToStructuredPoints.h"
+    "/root/repo/Common/ExecutionModel/vtkInformationDataObjectMetaDataKey.h"
+    "/root/repo/Common/ExecutionModel/vtkInformationExecutivePortKey.h"
+    "/root/repo/Common/ExecutionModel/vtkInformationExecutivePortVectorKey.h"
+    "/root/repo/Common/ExecutionModel/vtkInformationIntegerRequestKey.h"
+    "/root/repo/Common/ExecutionModel/vtkMoleculeAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkMultiBlockDataSetAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkMultiTimeStepAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkParallelReader.h"
+    "/root/repo/Common/ExecutionModel/vtkPassInputTypeAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkPiecewiseFunctionAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkPiecewiseFunctionShiftScale.h"
+    "/root/repo/Common/ExecutionModel/vtkPointSetAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkPolyDataAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkProgressObserver.h"
+    "/root/repo/Common/ExecutionModel/vtkReaderAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkReaderExecutive.h"
+    "/root/repo/Common/ExecutionModel/vtkRectilinearGridAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkSMPProgressObserver.h"
+    "/root/repo/Common/ExecutionModel/vtkScalarTree.h"
+    "/root/repo/Common/ExecutionModel/vtkSelectionAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkSimpleImageToImageFilter.h"
+    "/root/repo/Common/ExecutionModel/vtkSimpleReader.h"
+    "/root/repo/Common/ExecutionModel/vtkSimpleScalarTree.h"
+    "/root/repo/Common/ExecutionModel/vtkSpanSpace.h"
+    "/root/repo/Common/ExecutionModel/vtkSphereTree.h"
+    "/root/repo/Common/ExecutionModel/vtkStreamingDemandDrivenPipeline.h"
+    "/root/repo/Common/ExecutionModel/vtkStructuredGridAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkTableAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkThreadedCompositeDataPipeline.h"
+    "/root/repo/Common/ExecutionModel/vtkThreadedImageAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkTreeAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkTrivialConsumer.h"
+    "/root/repo/Common/ExecutionModel/vtkTrivialProducer.h"
+    "/root/repo/Common/ExecutionModel/vtkUndirectedGraphAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkUniformGridPartitioner.h"
+    "/root/repo/Common/ExecutionModel/vtkUnstructuredGridAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkUnstructuredGridBaseAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkNonOverlappingAMRAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkOverlappingAMRAlgorithm.h"
+    "/root/repo/Common/ExecutionModel/vtkUniformGridAMRAlgorithm.h"
+    "/root/repo/_gate_std/Common/ExecutionModel/vtkCommonExecutionModelModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkCommonExecutionModel-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkCommonExecutionModel-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkCommonExecutionModel-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkCommonExecutionModel-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkCommonExecutionModel-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkCommonExecutionModel-8.90.so")
+    endif()
+  endif()
+endif()
+
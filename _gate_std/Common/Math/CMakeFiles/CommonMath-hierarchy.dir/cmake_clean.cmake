@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonMath-hierarchy.txt"
+  "CMakeFiles/CommonMath-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonMath-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,37 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/Math/vtkAmoebaMinimizer.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkAmoebaMinimizer.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkAmoebaMinimizer.cxx.o.d"
+  "/root/repo/Common/Math/vtkFunctionSet.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkFunctionSet.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkFunctionSet.cxx.o.d"
+  "/root/repo/Common/Math/vtkInitialValueProblemSolver.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkInitialValueProblemSolver.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkInitialValueProblemSolver.cxx.o.d"
+  "/root/repo/Common/Math/vtkMatrix3x3.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkMatrix3x3.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkMatrix3x3.cxx.o.d"
+  "/root/repo/Common/Math/vtkMatrix4x4.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkMatrix4x4.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkMatrix4x4.cxx.o.d"
+  "/root/repo/Common/Math/vtkPolynomialSolversUnivariate.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkPolynomialSolversUnivariate.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkPolynomialSolversUnivariate.cxx.o.d"
+  "/root/repo/Common/Math/vtkQuaternionInterpolator.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkQuaternionInterpolator.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkQuaternionInterpolator.cxx.o.d"
+  "/root/repo/Common/Math/vtkRungeKutta2.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkRungeKutta2.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkRungeKutta2.cxx.o.d"
+  "/root/repo/Common/Math/vtkRungeKutta4.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkRungeKutta4.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkRungeKutta4.cxx.o.d"
+  "/root/repo/Common/Math/vtkRungeKutta45.cxx" "Common/Math/CMakeFiles/CommonMath.dir/vtkRungeKutta45.cxx.o" "gcc" "Common/Math/CMakeFiles/CommonMath.dir/vtkRungeKutta45.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonMath-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonMath-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonMath-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonMath-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
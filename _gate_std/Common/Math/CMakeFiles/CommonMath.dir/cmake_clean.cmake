@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonMath-8.90.pdb"
+  "../../lib/libvtkCommonMath-8.90.so"
+  "../../lib/libvtkCommonMath-8.90.so.1"
+  "../../lib/libvtkCommonMath-8.90.so.8.90.0"
+  "CMakeFiles/CommonMath.dir/vtkAmoebaMinimizer.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkAmoebaMinimizer.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkFunctionSet.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkFunctionSet.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkInitialValueProblemSolver.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkInitialValueProblemSolver.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkMatrix3x3.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkMatrix3x3.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkMatrix4x4.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkMatrix4x4.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkPolynomialSolversUnivariate.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkPolynomialSolversUnivariate.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkQuaternionInterpolator.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkQuaternionInterpolator.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkRungeKutta2.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkRungeKutta2.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkRungeKutta4.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkRungeKutta4.cxx.o.d"
+  "CMakeFiles/CommonMath.dir/vtkRungeKutta45.cxx.o"
+  "CMakeFiles/CommonMath.dir/vtkRungeKutta45.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonMath.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
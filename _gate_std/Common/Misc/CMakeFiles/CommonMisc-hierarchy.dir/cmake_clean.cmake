@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonMisc-hierarchy.txt"
+  "CMakeFiles/CommonMisc-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonMisc-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/Misc/vtkContourValues.cxx" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkContourValues.cxx.o" "gcc" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkContourValues.cxx.o.d"
+  "/root/repo/Common/Misc/vtkErrorCode.cxx" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkErrorCode.cxx.o" "gcc" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkErrorCode.cxx.o.d"
+  "/root/repo/Common/Misc/vtkFunctionParser.cxx" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkFunctionParser.cxx.o" "gcc" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkFunctionParser.cxx.o.d"
+  "/root/repo/Common/Misc/vtkHeap.cxx" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkHeap.cxx.o" "gcc" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkHeap.cxx.o.d"
+  "/root/repo/Common/Misc/vtkPolygonBuilder.cxx" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkPolygonBuilder.cxx.o" "gcc" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkPolygonBuilder.cxx.o.d"
+  "/root/repo/Common/Misc/vtkResourceFileLocator.cxx" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkResourceFileLocator.cxx.o" "gcc" "Common/Misc/CMakeFiles/CommonMisc.dir/vtkResourceFileLocator.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonMisc-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonMisc-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonMisc-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonMisc-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
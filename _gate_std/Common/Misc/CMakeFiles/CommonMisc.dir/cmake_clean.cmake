@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonMisc-8.90.pdb"
+  "../../lib/libvtkCommonMisc-8.90.so"
+  "../../lib/libvtkCommonMisc-8.90.so.1"
+  "../../lib/libvtkCommonMisc-8.90.so.8.90.0"
+  "CMakeFiles/CommonMisc.dir/vtkContourValues.cxx.o"
+  "CMakeFiles/CommonMisc.dir/vtkContourValues.cxx.o.d"
+  "CMakeFiles/CommonMisc.dir/vtkErrorCode.cxx.o"
+  "CMakeFiles/CommonMisc.dir/vtkErrorCode.cxx.o.d"
+  "CMakeFiles/CommonMisc.dir/vtkFunctionParser.cxx.o"
+  "CMakeFiles/CommonMisc.dir/vtkFunctionParser.cxx.o.d"
+  "CMakeFiles/CommonMisc.dir/vtkHeap.cxx.o"
+  "CMakeFiles/CommonMisc.dir/vtkHeap.cxx.o.d"
+  "CMakeFiles/CommonMisc.dir/vtkPolygonBuilder.cxx.o"
+  "CMakeFiles/CommonMisc.dir/vtkPolygonBuilder.cxx.o.d"
+  "CMakeFiles/CommonMisc.dir/vtkResourceFileLocator.cxx.o"
+  "CMakeFiles/CommonMisc.dir/vtkResourceFileLocator.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonMisc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
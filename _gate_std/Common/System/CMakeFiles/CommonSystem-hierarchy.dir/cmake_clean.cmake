@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonSystem-hierarchy.txt"
+  "CMakeFiles/CommonSystem-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonSystem-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
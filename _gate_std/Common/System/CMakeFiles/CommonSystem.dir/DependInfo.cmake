@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/System/vtkClientSocket.cxx" "Common/System/CMakeFiles/CommonSystem.dir/vtkClientSocket.cxx.o" "gcc" "Common/System/CMakeFiles/CommonSystem.dir/vtkClientSocket.cxx.o.d"
+  "/root/repo/Common/System/vtkDirectory.cxx" "Common/System/CMakeFiles/CommonSystem.dir/vtkDirectory.cxx.o" "gcc" "Common/System/CMakeFiles/CommonSystem.dir/vtkDirectory.cxx.o.d"
+  "/root/repo/Common/System/vtkServerSocket.cxx" "Common/System/CMakeFiles/CommonSystem.dir/vtkServerSocket.cxx.o" "gcc" "Common/System/CMakeFiles/CommonSystem.dir/vtkServerSocket.cxx.o.d"
+  "/root/repo/Common/System/vtkSocket.cxx" "Common/System/CMakeFiles/CommonSystem.dir/vtkSocket.cxx.o" "gcc" "Common/System/CMakeFiles/CommonSystem.dir/vtkSocket.cxx.o.d"
+  "/root/repo/Common/System/vtkSocketCollection.cxx" "Common/System/CMakeFiles/CommonSystem.dir/vtkSocketCollection.cxx.o" "gcc" "Common/System/CMakeFiles/CommonSystem.dir/vtkSocketCollection.cxx.o.d"
+  "/root/repo/Common/System/vtkThreadMessager.cxx" "Common/System/CMakeFiles/CommonSystem.dir/vtkThreadMessager.cxx.o" "gcc" "Common/System/CMakeFiles/CommonSystem.dir/vtkThreadMessager.cxx.o.d"
+  "/root/repo/Common/System/vtkTimerLog.cxx" "Common/System/CMakeFiles/CommonSystem.dir/vtkTimerLog.cxx.o" "gcc" "Common/System/CMakeFiles/CommonSystem.dir/vtkTimerLog.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonSystem-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonSystem-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonSystem-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonSystem-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonSystem-8.90.pdb"
+  "../../lib/libvtkCommonSystem-8.90.so"
+  "../../lib/libvtkCommonSystem-8.90.so.1"
+  "../../lib/libvtkCommonSystem-8.90.so.8.90.0"
+  "CMakeFiles/CommonSystem.dir/vtkClientSocket.cxx.o"
+  "CMakeFiles/CommonSystem.dir/vtkClientSocket.cxx.o.d"
+  "CMakeFiles/CommonSystem.dir/vtkDirectory.cxx.o"
+  "CMakeFiles/CommonSystem.dir/vtkDirectory.cxx.o.d"
+  "CMakeFiles/CommonSystem.dir/vtkServerSocket.cxx.o"
+  "CMakeFiles/CommonSystem.dir/vtkServerSocket.cxx.o.d"
+  "CMakeFiles/CommonSystem.dir/vtkSocket.cxx.o"
+  "CMakeFiles/CommonSystem.dir/vtkSocket.cxx.o.d"
+  "CMakeFiles/CommonSystem.dir/vtkSocketCollection.cxx.o"
+  "CMakeFiles/CommonSystem.dir/vtkSocketCollection.cxx.o.d"
+  "CMakeFiles/CommonSystem.dir/vtkThreadMessager.cxx.o"
+  "CMakeFiles/CommonSystem.dir/vtkThreadMessager.cxx.o.d"
+  "CMakeFiles/CommonSystem.dir/vtkTimerLog.cxx.o"
+  "CMakeFiles/CommonSystem.dir/vtkTimerLog.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonSystem.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkCommonTransforms-hierarchy.txt"
+  "CMakeFiles/CommonTransforms-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CommonTransforms-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,44 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Common/Transforms/vtkAbstractTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkAbstractTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkAbstractTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkCylindricalTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkCylindricalTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkCylindricalTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkGeneralTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkGeneralTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkGeneralTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkHomogeneousTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkHomogeneousTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkHomogeneousTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkIdentityTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkIdentityTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkIdentityTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkLandmarkTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkLandmarkTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkLandmarkTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkLinearTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkLinearTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkLinearTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkMatrixToHomogeneousTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkMatrixToHomogeneousTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkMatrixToHomogeneousTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkMatrixToLinearTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkMatrixToLinearTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkMatrixToLinearTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkPerspectiveTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkPerspectiveTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkPerspectiveTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkSphericalTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkSphericalTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkSphericalTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkThinPlateSplineTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkThinPlateSplineTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkThinPlateSplineTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkTransform.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkTransform2D.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkTransform2D.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkTransform2D.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkTransformCollection.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkTransformCollection.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkTransformCollection.cxx.o.d"
+  "/root/repo/Common/Transforms/vtkWarpTransform.cxx" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkWarpTransform.cxx.o" "gcc" "Common/Transforms/CMakeFiles/CommonTransforms.dir/vtkWarpTransform.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkCommonTransforms-8.90.so" "/root/repo/_gate_std/lib/libvtkCommonTransforms-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkCommonTransforms-8.90.so.1" "/root/repo/_gate_std/lib/libvtkCommonTransforms-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkCommonTransforms-8.90.pdb"
+  "../../lib/libvtkCommonTransforms-8.90.so"
+  "../../lib/libvtkCommonTransforms-8.90.so.1"
+  "../../lib/libvtkCommonTransforms-8.90.so.8.90.0"
+  "CMakeFiles/CommonTransforms.dir/vtkAbstractTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkAbstractTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkCylindricalTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkCylindricalTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkGeneralTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkGeneralTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkHomogeneousTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkHomogeneousTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkIdentityTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkIdentityTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkLandmarkTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkLandmarkTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkLinearTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkLinearTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkMatrixToHomogeneousTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkMatrixToHomogeneousTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkMatrixToLinearTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkMatrixToLinearTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkPerspectiveTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkPerspectiveTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkSphericalTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkSphericalTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkThinPlateSplineTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkThinPlateSplineTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkTransform.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkTransform2D.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkTransform2D.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkTransformCollection.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkTransformCollection.cxx.o.d"
+  "CMakeFiles/CommonTransforms.dir/vtkWarpTransform.cxx.o"
+  "CMakeFiles/CommonTransforms.dir/vtkWarpTransform.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/CommonTransforms.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
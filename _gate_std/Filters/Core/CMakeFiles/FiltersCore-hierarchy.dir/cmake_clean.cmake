@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkFiltersCore-hierarchy.txt"
+  "CMakeFiles/FiltersCore-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FiltersCore-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
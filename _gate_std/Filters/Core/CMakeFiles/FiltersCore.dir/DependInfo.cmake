@@ -0,0 +1,134 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Filters/Core/vtk3DLinearGridCrinkleExtractor.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtk3DLinearGridCrinkleExtractor.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtk3DLinearGridCrinkleExtractor.cxx.o.d"
+  "/root/repo/Filters/Core/vtk3DLinearGridPlaneCutter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtk3DLinearGridPlaneCutter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtk3DLinearGridPlaneCutter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAppendArcLength.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendArcLength.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendArcLength.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAppendCompositeDataLeaves.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendCompositeDataLeaves.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendCompositeDataLeaves.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAppendDataSets.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendDataSets.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendDataSets.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAppendFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAppendPolyData.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendPolyData.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendPolyData.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAppendSelection.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendSelection.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAppendSelection.cxx.o.d"
+  "/root/repo/Filters/Core/vtkArrayCalculator.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkArrayCalculator.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkArrayCalculator.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAssignAttribute.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAssignAttribute.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAssignAttribute.cxx.o.d"
+  "/root/repo/Filters/Core/vtkAttributeDataToFieldDataFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAttributeDataToFieldDataFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkAttributeDataToFieldDataFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkBinCellDataFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkBinCellDataFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkBinCellDataFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkCellDataToPointData.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCellDataToPointData.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCellDataToPointData.cxx.o.d"
+  "/root/repo/Filters/Core/vtkCenterOfMass.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCenterOfMass.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCenterOfMass.cxx.o.d"
+  "/root/repo/Filters/Core/vtkCleanPolyData.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCleanPolyData.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCleanPolyData.cxx.o.d"
+  "/root/repo/Filters/Core/vtkClipPolyData.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkClipPolyData.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkClipPolyData.cxx.o.d"
+  "/root/repo/Filters/Core/vtkCompositeCutter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCompositeCutter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCompositeCutter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkCompositeDataProbeFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCompositeDataProbeFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCompositeDataProbeFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkConnectivityFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkConnectivityFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkConnectivityFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkContour3DLinearGrid.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContour3DLinearGrid.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContour3DLinearGrid.cxx.o.d"
+  "/root/repo/Filters/Core/vtkContourFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContourFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContourFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkContourGrid.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContourGrid.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContourGrid.cxx.o.d"
+  "/root/repo/Filters/Core/vtkContourHelper.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContourHelper.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkContourHelper.cxx.o.d"
+  "/root/repo/Filters/Core/vtkCutter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCutter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkCutter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDataObjectGenerator.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataObjectGenerator.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataObjectGenerator.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDataObjectToDataSetFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataObjectToDataSetFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataObjectToDataSetFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDataSetEdgeSubdivisionCriterion.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataSetEdgeSubdivisionCriterion.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataSetEdgeSubdivisionCriterion.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDataSetToDataObjectFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataSetToDataObjectFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDataSetToDataObjectFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDecimatePolylineFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDecimatePolylineFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDecimatePolylineFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDecimatePro.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDecimatePro.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDecimatePro.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDelaunay2D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDelaunay2D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDelaunay2D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkDelaunay3D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDelaunay3D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkDelaunay3D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkEdgeSubdivisionCriterion.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkEdgeSubdivisionCriterion.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkEdgeSubdivisionCriterion.cxx.o.d"
+  "/root/repo/Filters/Core/vtkElevationFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkElevationFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkElevationFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkExecutionTimer.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkExecutionTimer.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkExecutionTimer.cxx.o.d"
+  "/root/repo/Filters/Core/vtkExplicitStructuredGridCrop.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridCrop.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridCrop.cxx.o.d"
+  "/root/repo/Filters/Core/vtkExplicitStructuredGridToUnstructuredGrid.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridToUnstructuredGrid.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridToUnstructuredGrid.cxx.o.d"
+  "/root/repo/Filters/Core/vtkFeatureEdges.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFeatureEdges.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFeatureEdges.cxx.o.d"
+  "/root/repo/Filters/Core/vtkFieldDataToAttributeDataFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFieldDataToAttributeDataFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFieldDataToAttributeDataFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkFlyingEdges2D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFlyingEdges2D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFlyingEdges2D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkFlyingEdges3D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFlyingEdges3D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFlyingEdges3D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkFlyingEdgesPlaneCutter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFlyingEdgesPlaneCutter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkFlyingEdgesPlaneCutter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkGlyph2D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkGlyph2D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkGlyph2D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkGlyph3D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkGlyph3D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkGlyph3D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkGridSynchronizedTemplates3D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkGridSynchronizedTemplates3D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkGridSynchronizedTemplates3D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkHedgeHog.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkHedgeHog.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkHedgeHog.cxx.o.d"
+  "/root/repo/Filters/Core/vtkHull.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkHull.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkHull.cxx.o.d"
+  "/root/repo/Filters/Core/vtkIdFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkIdFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkIdFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkImageAppend.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkImageAppend.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkImageAppend.cxx.o.d"
+  "/root/repo/Filters/Core/vtkImageDataToExplicitStructuredGrid.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkImageDataToExplicitStructuredGrid.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkImageDataToExplicitStructuredGrid.cxx.o.d"
+  "/root/repo/Filters/Core/vtkImplicitPolyDataDistance.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkImplicitPolyDataDistance.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkImplicitPolyDataDistance.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMarchingCubes.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMarchingCubes.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMarchingCubes.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMarchingSquares.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMarchingSquares.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMarchingSquares.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMaskFields.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMaskFields.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMaskFields.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMaskPoints.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMaskPoints.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMaskPoints.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMaskPolyData.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMaskPolyData.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMaskPolyData.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMassProperties.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMassProperties.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMassProperties.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMergeDataObjectFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMergeDataObjectFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMergeDataObjectFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMergeFields.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMergeFields.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMergeFields.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMergeFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMergeFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMergeFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMoleculeAppend.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMoleculeAppend.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMoleculeAppend.cxx.o.d"
+  "/root/repo/Filters/Core/vtkMultiObjectMassProperties.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMultiObjectMassProperties.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkMultiObjectMassProperties.cxx.o.d"
+  "/root/repo/Filters/Core/vtkPlaneCutter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPlaneCutter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPlaneCutter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkPointDataToCellData.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPointDataToCellData.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPointDataToCellData.cxx.o.d"
+  "/root/repo/Filters/Core/vtkPolyDataConnectivityFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPolyDataConnectivityFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPolyDataConnectivityFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkPolyDataNormals.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPolyDataNormals.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPolyDataNormals.cxx.o.d"
+  "/root/repo/Filters/Core/vtkPolyDataTangents.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPolyDataTangents.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkPolyDataTangents.cxx.o.d"
+  "/root/repo/Filters/Core/vtkProbeFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkProbeFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkProbeFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkQuadricClustering.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkQuadricClustering.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkQuadricClustering.cxx.o.d"
+  "/root/repo/Filters/Core/vtkQuadricDecimation.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkQuadricDecimation.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkQuadricDecimation.cxx.o.d"
+  "/root/repo/Filters/Core/vtkRearrangeFields.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkRearrangeFields.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkRearrangeFields.cxx.o.d"
+  "/root/repo/Filters/Core/vtkRectilinearSynchronizedTemplates.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkRectilinearSynchronizedTemplates.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkRectilinearSynchronizedTemplates.cxx.o.d"
+  "/root/repo/Filters/Core/vtkRemoveDuplicatePolys.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkRemoveDuplicatePolys.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkRemoveDuplicatePolys.cxx.o.d"
+  "/root/repo/Filters/Core/vtkResampleToImage.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkResampleToImage.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkResampleToImage.cxx.o.d"
+  "/root/repo/Filters/Core/vtkResampleWithDataSet.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkResampleWithDataSet.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkResampleWithDataSet.cxx.o.d"
+  "/root/repo/Filters/Core/vtkReverseSense.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkReverseSense.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkReverseSense.cxx.o.d"
+  "/root/repo/Filters/Core/vtkSimpleElevationFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSimpleElevationFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSimpleElevationFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkSmoothPolyDataFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSmoothPolyDataFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSmoothPolyDataFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkSphereTreeFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSphereTreeFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSphereTreeFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkStaticCleanPolyData.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStaticCleanPolyData.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStaticCleanPolyData.cxx.o.d"
+  "/root/repo/Filters/Core/vtkStreamerBase.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStreamerBase.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStreamerBase.cxx.o.d"
+  "/root/repo/Filters/Core/vtkStreamingTessellator.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStreamingTessellator.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStreamingTessellator.cxx.o.d"
+  "/root/repo/Filters/Core/vtkStripper.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStripper.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStripper.cxx.o.d"
+  "/root/repo/Filters/Core/vtkStructuredGridAppend.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStructuredGridAppend.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStructuredGridAppend.cxx.o.d"
+  "/root/repo/Filters/Core/vtkStructuredGridOutlineFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStructuredGridOutlineFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkStructuredGridOutlineFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkSynchronizedTemplates2D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates2D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates2D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkSynchronizedTemplates3D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates3D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates3D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkSynchronizedTemplatesCutter3D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplatesCutter3D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplatesCutter3D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkTensorGlyph.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTensorGlyph.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTensorGlyph.cxx.o.d"
+  "/root/repo/Filters/Core/vtkThreshold.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkThreshold.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkThreshold.cxx.o.d"
+  "/root/repo/Filters/Core/vtkThresholdPoints.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkThresholdPoints.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkThresholdPoints.cxx.o.d"
+  "/root/repo/Filters/Core/vtkTransposeTable.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTransposeTable.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTransposeTable.cxx.o.d"
+  "/root/repo/Filters/Core/vtkTriangleFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTriangleFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTriangleFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkTriangleMeshPointNormals.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTriangleMeshPointNormals.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTriangleMeshPointNormals.cxx.o.d"
+  "/root/repo/Filters/Core/vtkTubeFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTubeFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkTubeFilter.cxx.o.d"
+  "/root/repo/Filters/Core/vtkUnstructuredGridQuadricDecimation.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkUnstructuredGridQuadricDecimation.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkUnstructuredGridQuadricDecimation.cxx.o.d"
+  "/root/repo/Filters/Core/vtkUnstructuredGridToExplicitStructuredGrid.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkUnstructuredGridToExplicitStructuredGrid.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkUnstructuredGridToExplicitStructuredGrid.cxx.o.d"
+  "/root/repo/Filters/Core/vtkVectorDot.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkVectorDot.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkVectorDot.cxx.o.d"
+  "/root/repo/Filters/Core/vtkVectorNorm.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkVectorNorm.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkVectorNorm.cxx.o.d"
+  "/root/repo/Filters/Core/vtkVoronoi2D.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkVoronoi2D.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkVoronoi2D.cxx.o.d"
+  "/root/repo/Filters/Core/vtkWindowedSincPolyDataFilter.cxx" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkWindowedSincPolyDataFilter.cxx.o" "gcc" "Filters/Core/CMakeFiles/FiltersCore.dir/vtkWindowedSincPolyDataFilter.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkFiltersCore-8.90.so" "/root/repo/_gate_std/lib/libvtkFiltersCore-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkFiltersCore-8.90.so.1" "/root/repo/_gate_std/lib/libvtkFiltersCore-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/System/CMakeFiles/CommonSystem.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,213 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkFiltersCore-8.90.pdb"
+  "../../lib/libvtkFiltersCore-8.90.so"
+  "../../lib/libvtkFiltersCore-8.90.so.1"
+  "../../lib/libvtkFiltersCore-8.90.so.8.90.0"
+  "CMakeFiles/FiltersCore.dir/vtk3DLinearGridCrinkleExtractor.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtk3DLinearGridCrinkleExtractor.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtk3DLinearGridPlaneCutter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtk3DLinearGridPlaneCutter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAppendArcLength.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAppendArcLength.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAppendCompositeDataLeaves.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAppendCompositeDataLeaves.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAppendDataSets.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAppendDataSets.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAppendFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAppendFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAppendPolyData.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAppendPolyData.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAppendSelection.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAppendSelection.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkArrayCalculator.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkArrayCalculator.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAssignAttribute.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAssignAttribute.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkAttributeDataToFieldDataFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkAttributeDataToFieldDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkBinCellDataFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkBinCellDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkCellDataToPointData.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkCellDataToPointData.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkCenterOfMass.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkCenterOfMass.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkCleanPolyData.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkCleanPolyData.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkClipPolyData.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkClipPolyData.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkCompositeCutter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkCompositeCutter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkCompositeDataProbeFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkCompositeDataProbeFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkConnectivityFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkConnectivityFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkContour3DLinearGrid.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkContour3DLinearGrid.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkContourFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkContourFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkContourGrid.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkContourGrid.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkContourHelper.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkContourHelper.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkCutter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkCutter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDataObjectGenerator.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDataObjectGenerator.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDataObjectToDataSetFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDataObjectToDataSetFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDataSetEdgeSubdivisionCriterion.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDataSetEdgeSubdivisionCriterion.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDataSetToDataObjectFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDataSetToDataObjectFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDecimatePolylineFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDecimatePolylineFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDecimatePro.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDecimatePro.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDelaunay2D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDelaunay2D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkDelaunay3D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkDelaunay3D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkEdgeSubdivisionCriterion.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkEdgeSubdivisionCriterion.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkElevationFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkElevationFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkExecutionTimer.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkExecutionTimer.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridCrop.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridCrop.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridToUnstructuredGrid.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkExplicitStructuredGridToUnstructuredGrid.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkFeatureEdges.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkFeatureEdges.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkFieldDataToAttributeDataFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkFieldDataToAttributeDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkFlyingEdges2D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkFlyingEdges2D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkFlyingEdges3D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkFlyingEdges3D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkFlyingEdgesPlaneCutter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkFlyingEdgesPlaneCutter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkGlyph2D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkGlyph2D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkGlyph3D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkGlyph3D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkGridSynchronizedTemplates3D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkGridSynchronizedTemplates3D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkHedgeHog.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkHedgeHog.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkHull.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkHull.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkIdFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkIdFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkImageAppend.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkImageAppend.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkImageDataToExplicitStructuredGrid.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkImageDataToExplicitStructuredGrid.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkImplicitPolyDataDistance.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkImplicitPolyDataDistance.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMarchingCubes.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMarchingCubes.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMarchingSquares.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMarchingSquares.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMaskFields.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMaskFields.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMaskPoints.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMaskPoints.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMaskPolyData.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMaskPolyData.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMassProperties.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMassProperties.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMergeDataObjectFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMergeDataObjectFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMergeFields.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMergeFields.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMergeFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMergeFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMoleculeAppend.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMoleculeAppend.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkMultiObjectMassProperties.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkMultiObjectMassProperties.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkPlaneCutter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkPlaneCutter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkPointDataToCellData.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkPointDataToCellData.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkPolyDataConnectivityFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkPolyDataConnectivityFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkPolyDataNormals.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkPolyDataNormals.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkPolyDataTangents.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkPolyDataTangents.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkProbeFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkProbeFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkQuadricClustering.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkQuadricClustering.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkQuadricDecimation.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkQuadricDecimation.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkRearrangeFields.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkRearrangeFields.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkRectilinearSynchronizedTemplates.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkRectilinearSynchronizedTemplates.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkRemoveDuplicatePolys.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkRemoveDuplicatePolys.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkResampleToImage.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkResampleToImage.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkResampleWithDataSet.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkResampleWithDataSet.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkReverseSense.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkReverseSense.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkSimpleElevationFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkSimpleElevationFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkSmoothPolyDataFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkSmoothPolyDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkSphereTreeFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkSphereTreeFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkStaticCleanPolyData.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkStaticCleanPolyData.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkStreamerBase.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkStreamerBase.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkStreamingTessellator.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkStreamingTessellator.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkStripper.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkStripper.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkStructuredGridAppend.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkStructuredGridAppend.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkStructuredGridOutlineFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkStructuredGridOutlineFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates2D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates2D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates3D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplates3D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplatesCutter3D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkSynchronizedTemplatesCutter3D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkTensorGlyph.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkTensorGlyph.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkThreshold.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkThreshold.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkThresholdPoints.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkThresholdPoints.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkTransposeTable.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkTransposeTable.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkTriangleFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkTriangleFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkTriangleMeshPointNormals.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkTriangleMeshPointNormals.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkTubeFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkTubeFilter.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkUnstructuredGridQuadricDecimation.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkUnstructuredGridQuadricDecimation.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkUnstructuredGridToExplicitStructuredGrid.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkUnstructuredGridToExplicitStructuredGrid.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkVectorDot.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkVectorDot.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkVectorNorm.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkVectorNorm.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkVoronoi2D.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkVoronoi2D.cxx.o.d"
+  "CMakeFiles/FiltersCore.dir/vtkWindowedSincPolyDataFilter.cxx.o"
+  "CMakeFiles/FiltersCore.dir/vtkWindowedSincPolyDataFilter.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FiltersCore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,208 @@
+# Install script for directory: /root/repo/Filters/Core
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Filters/Core/vtk3DLinearGridPlaneCutter.h"
+    "/root/repo/Filters/Core/vtkAppendArcLength.h"
+    "/root/repo/Filters/Core/vtkAppendCompositeDataLeaves.h"
+    "/root/repo/Filters/Core/vtkAppendDataSets.h"
+    "/root/repo/Filters/Core/vtkAppendFilter.h"
+    "/root/repo/Filters/Core/vtkAppendPolyData.h"
+    "/root/repo/Filters/Core/vtkAppendSelection.h"
+    "/root/repo/Filters/Core/vtkArrayCalculator.h"
+    "/root/repo/Filters/Core/vtkAssignAttribute.h"
+    "/root/repo/Filters/Core/vtkAttributeDataToFieldDataFilter.h"
+    "/root/repo/Filters/Core/vtkBinCellDataFilter.h"
+    "/root/repo/Filters/Core/vtkCellDataToPointData.h"
+    "/root/repo/Filters/Core/vtkCenterOfMass.h"
+    "/root/repo/Filters/Core/vtkCleanPolyData.h"
+    "/root/repo/Filters/Core/vtkClipPolyData.h"
+    "/root/repo/Filters/Core/vtkCompositeCutter.h"
+    "/root/repo/Filters/Core/vtkCompositeDataProbeFilter.h"
+    "/root/repo/Filters/Core/vtkConnectivityFilter.h"
+    "/root/repo/Filters/Core/vtkContour3DLinearGrid.h"
+    "/root/repo/Filters/Core/vtkContourFilter.h"
+    "/root/repo/Filters/Core/vtkContourGrid.h"
+    "/root/repo/Filters/Core/vtkContourHelper.h"
+    "/root/repo/Filters/Core/vtk3DLinearGridCrinkleExtractor.h"
+    "/root/repo/Filters/Core/vtkCutter.h"
+    "/root/repo/Filters/Core/vtkDataObjectGenerator.h"
+    "/root/repo/Filters/Core/vtkDataObjectToDataSetFilter.h"
+    "/root/repo/Filters/Core/vtkDataSetEdgeSubdivisionCriterion.h"
+    "/root/repo/Filters/Core/vtkDataSetToDataObjectFilter.h"
+    "/root/repo/Filters/Core/vtkDecimatePolylineFilter.h"
+    "/root/repo/Filters/Core/vtkDecimatePro.h"
+    "/root/repo/Filters/Core/vtkDelaunay2D.h"
+    "/root/repo/Filters/Core/vtkDelaunay3D.h"
+    "/root/repo/Filters/Core/vtkEdgeSubdivisionCriterion.h"
+    "/root/repo/Filters/Core/vtkElevationFilter.h"
+    "/root/repo/Filters/Core/vtkExecutionTimer.h"
+    "/root/repo/Filters/Core/vtkExplicitStructuredGridCrop.h"
+    "/root/repo/Filters/Core/vtkExplicitStructuredGridToUnstructuredGrid.h"
+    "/root/repo/Filters/Core/vtkFeatureEdges.h"
+    "/root/repo/Filters/Core/vtkFieldDataToAttributeDataFilter.h"
+    "/root/repo/Filters/Core/vtkFlyingEdges2D.h"
+    "/root/repo/Filters/Core/vtkFlyingEdges3D.h"
+    "/root/repo/Filters/Core/vtkFlyingEdgesPlaneCutter.h"
+    "/root/repo/Filters/Core/vtkGlyph2D.h"
+    "/root/repo/Filters/Core/vtkGlyph3D.h"
+    "/root/repo/Filters/Core/vtkGridSynchronizedTemplates3D.h"
+    "/root/repo/Filters/Core/vtkHedgeHog.h"
+    "/root/repo/Filters/Core/vtkHull.h"
+    "/root/repo/Filters/Core/vtkIdFilter.h"
+    "/root/repo/Filters/Core/vtkImageDataToExplicitStructuredGrid.h"
+    "/root/repo/Filters/Core/vtkImageAppend.h"
+    "/root/repo/Filters/Core/vtkImplicitPolyDataDistance.h"
+    "/root/repo/Filters/Core/vtkMarchingCubes.h"
+    "/root/repo/Filters/Core/vtkMarchingSquares.h"
+    "/root/repo/Filters/Core/vtkMaskFields.h"
+    "/root/repo/Filters/Core/vtkMaskPoints.h"
+    "/root/repo/Filters/Core/vtkMaskPolyData.h"
+    "/root/repo/Filters/Core/vtkMassProperties.h"
+    "/root/repo/Filters/Core/vtkMergeDataObjectFilter.h"
+    "/root/repo/Filters/Core/vtkMergeFields.h"
+    "/root/repo/Filters/Core/vtkMergeFilter.h"
+    "/root/repo/Filters/Core/vtkMoleculeAppend.h"
+    "/root/repo/Filters/Core/vtkMultiObjectMassProperties.h"
+    "/root/repo/Filters/Core/vtkPlaneCutter.h"
+    "/root/repo/Filters/Core/vtkPointDataToCellData.h"
+    "/root/repo/Filters/Core/vtkPolyDataConnectivityFilter.h"
+    "/root/repo/Filters/Core/vtkPolyDataNormals.h"
+    "/root/repo/Filters/Core/vtkPolyDataTangents.h"
+    "/root/repo/Filters/Core/vtkProbeFilter.h"
+    "/root/repo/Filters/Core/vtkQuadricClustering.h"
+    "/root/repo/Filters/Core/vtkQuadricDecimation.h"
+    "/root/repo/Filters/Core/vtkRearrangeFields.h"
+    "/root/repo/Filters/Core/vtkRectilinearSynchronizedTemplates.h"
+    "/root/repo/Filters/Core/vtkRemoveDuplicatePolys.h"
+    "/root/repo/Filters/Core/vtkResampleToImage.h"
+    "/root/repo/Filters/Core/vtkResampleWithDataSet.h"
+    "/root/repo/Filters/Core/vtkReverseSense.h"
+    "/root/repo/Filters/Core/vtkSimpleElevationFilter.h"
+    "/root/repo/Filters/Core/vtkSmoothPolyDataFilter.h"
+    "/root/repo/Filters/Core/vtkSphereTreeFilter.h"
+    "/root/repo/Filters/Core/vtkStaticCleanPolyData.h"
+    "/root/repo/Filters/Core/vtkStreamerBase.h"
+    "/root/repo/Filters/Core/vtkStreamingTessellator.h"
+    "/root/repo/Filters/Core/vtkStripper.h"
+    "/root/repo/Filters/Core/vtkStructuredGridAppend.h"
+    "/root/repo/Filters/Core/vtkStructuredGridOutlineFilter.h"
+    "/root/repo/Filters/Core/vtkSynchronizedTemplates2D.h"
+    "/root/repo/Filters/Core/vtkSynchronizedTemplates3D.h"
+    "/root/repo/Filters/Core/vtkSynchronizedTemplatesCutter3D.h"
+    "/root/repo/Filters/Core/vtkTensorGlyph.h"
+    "/root/repo/Filters/Core/vtkThreshold.h"
+    "/root/repo/Filters/Core/vtkThresholdPoints.h"
+    "/root/repo/Filters/Core/vtkTransposeTable.h"
+    "/root/repo/Filters/Core/vtkTriangleFilter.h"
+    "/root/repo/Filters/Core/vtkTriangleMeshPointNormals.h"
+    "/root/repo/Filters/Core/vtkTubeFilter.h"
+    "/root/repo/Filters/Core/vtkUnstructuredGridQuadricDecimation.h"
+    "/root/repo/Filters/Core/vtkUnstructuredGridToExplicitStructuredGrid.h"
+    "/root/repo/Filters/Core/vtkVectorDot.h"
+    "/root/repo/Filters/Core/vtkVectorNorm.h"
+    "/root/repo/Filters/Core/vtkVoronoi2D.h"
+    "/root/repo/Filters/Core/vtkWindowedSincPolyDataFilter.h"
+    "/root/repo/_gate_std/Filters/Core/vtkFiltersCoreModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkFiltersCore-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkFiltersCore-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkFiltersCore-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkFiltersCore-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkFiltersCore-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersCore-8.90.so")
+    endif()
+  endif()
+endif()
+
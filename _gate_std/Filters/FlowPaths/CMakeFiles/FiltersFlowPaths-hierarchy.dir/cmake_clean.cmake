@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkFiltersFlowPaths-hierarchy.txt"
+  "CMakeFiles/FiltersFlowPaths-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FiltersFlowPaths-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
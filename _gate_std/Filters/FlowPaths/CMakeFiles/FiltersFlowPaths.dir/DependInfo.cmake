@@ -0,0 +1,55 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Filters/FlowPaths/vtkAMRInterpolatedVelocityField.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkAMRInterpolatedVelocityField.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkAMRInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkAbstractInterpolatedVelocityField.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkAbstractInterpolatedVelocityField.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkAbstractInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkCachingInterpolatedVelocityField.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkCachingInterpolatedVelocityField.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkCachingInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkCellLocatorInterpolatedVelocityField.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkCellLocatorInterpolatedVelocityField.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkCellLocatorInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkCompositeInterpolatedVelocityField.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkCompositeInterpolatedVelocityField.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkCompositeInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkEvenlySpacedStreamlines2D.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkEvenlySpacedStreamlines2D.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkEvenlySpacedStreamlines2D.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkInterpolatedVelocityField.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkInterpolatedVelocityField.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkLagrangianBasicIntegrationModel.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianBasicIntegrationModel.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianBasicIntegrationModel.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkLagrangianMatidaIntegrationModel.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianMatidaIntegrationModel.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianMatidaIntegrationModel.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkLagrangianParticle.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticle.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticle.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkLagrangianParticleTracker.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticleTracker.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticleTracker.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkModifiedBSPTree.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkModifiedBSPTree.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkModifiedBSPTree.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkParticlePathFilter.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkParticlePathFilter.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkParticlePathFilter.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkParticleTracer.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracer.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracer.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkParticleTracerBase.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracerBase.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracerBase.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkStreaklineFilter.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkStreaklineFilter.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkStreaklineFilter.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkStreamTracer.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkStreamTracer.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkStreamTracer.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkTemporalInterpolatedVelocityField.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkTemporalInterpolatedVelocityField.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkTemporalInterpolatedVelocityField.cxx.o.d"
+  "/root/repo/Filters/FlowPaths/vtkTemporalStreamTracer.cxx" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkTemporalStreamTracer.cxx.o" "gcc" "Filters/FlowPaths/CMakeFiles/FiltersFlowPaths.dir/vtkTemporalStreamTracer.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkFiltersFlowPaths-8.90.so" "/root/repo/_gate_std/lib/libvtkFiltersFlowPaths-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkFiltersFlowPaths-8.90.so.1" "/root/repo/_gate_std/lib/libvtkFiltersFlowPaths-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Filters/Geometry/CMakeFiles/FiltersGeometry.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Filters/Sources/CMakeFiles/FiltersSources.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/IO/Core/CMakeFiles/IOCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Filters/Core/CMakeFiles/FiltersCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
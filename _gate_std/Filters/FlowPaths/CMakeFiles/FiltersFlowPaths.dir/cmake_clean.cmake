@@ -0,0 +1,49 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkFiltersFlowPaths-8.90.pdb"
+  "../../lib/libvtkFiltersFlowPaths-8.90.so"
+  "../../lib/libvtkFiltersFlowPaths-8.90.so.1"
+  "../../lib/libvtkFiltersFlowPaths-8.90.so.8.90.0"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkAMRInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkAMRInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkAbstractInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkAbstractInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkCachingInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkCachingInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkCellLocatorInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkCellLocatorInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkCompositeInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkCompositeInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkEvenlySpacedStreamlines2D.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkEvenlySpacedStreamlines2D.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianBasicIntegrationModel.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianBasicIntegrationModel.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianMatidaIntegrationModel.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianMatidaIntegrationModel.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticle.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticle.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticleTracker.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkLagrangianParticleTracker.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkModifiedBSPTree.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkModifiedBSPTree.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkParticlePathFilter.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkParticlePathFilter.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracer.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracer.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracerBase.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkParticleTracerBase.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkStreaklineFilter.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkStreaklineFilter.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkStreamTracer.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkStreamTracer.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkTemporalInterpolatedVelocityField.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkTemporalInterpolatedVelocityField.cxx.o.d"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkTemporalStreamTracer.cxx.o"
+  "CMakeFiles/FiltersFlowPaths.dir/vtkTemporalStreamTracer.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FiltersFlowPaths.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
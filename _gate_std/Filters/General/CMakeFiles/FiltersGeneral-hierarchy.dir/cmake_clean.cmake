@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkFiltersGeneral-hierarchy.txt"
+  "CMakeFiles/FiltersGeneral-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FiltersGeneral-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
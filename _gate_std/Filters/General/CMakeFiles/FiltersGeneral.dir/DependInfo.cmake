@@ -0,0 +1,151 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Filters/General/vtkAnnotationLink.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAnnotationLink.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAnnotationLink.cxx.o.d"
+  "/root/repo/Filters/General/vtkAppendPoints.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAppendPoints.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAppendPoints.cxx.o.d"
+  "/root/repo/Filters/General/vtkApproximatingSubdivisionFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkApproximatingSubdivisionFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkApproximatingSubdivisionFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkAreaContourSpectrumFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAreaContourSpectrumFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAreaContourSpectrumFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkAxes.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAxes.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkAxes.cxx.o.d"
+  "/root/repo/Filters/General/vtkBlankStructuredGrid.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGrid.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGrid.cxx.o.d"
+  "/root/repo/Filters/General/vtkBlankStructuredGridWithImage.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGridWithImage.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGridWithImage.cxx.o.d"
+  "/root/repo/Filters/General/vtkBlockIdScalars.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBlockIdScalars.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBlockIdScalars.cxx.o.d"
+  "/root/repo/Filters/General/vtkBooleanOperationPolyDataFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBooleanOperationPolyDataFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBooleanOperationPolyDataFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkBoxClipDataSet.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBoxClipDataSet.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBoxClipDataSet.cxx.o.d"
+  "/root/repo/Filters/General/vtkBrownianPoints.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBrownianPoints.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkBrownianPoints.cxx.o.d"
+  "/root/repo/Filters/General/vtkCellCenters.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellCenters.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellCenters.cxx.o.d"
+  "/root/repo/Filters/General/vtkCellDerivatives.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellDerivatives.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellDerivatives.cxx.o.d"
+  "/root/repo/Filters/General/vtkCellTreeLocator.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellTreeLocator.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellTreeLocator.cxx.o.d"
+  "/root/repo/Filters/General/vtkCellValidator.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellValidator.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCellValidator.cxx.o.d"
+  "/root/repo/Filters/General/vtkClipClosedSurface.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipClosedSurface.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipClosedSurface.cxx.o.d"
+  "/root/repo/Filters/General/vtkClipConvexPolyData.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipConvexPolyData.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipConvexPolyData.cxx.o.d"
+  "/root/repo/Filters/General/vtkClipDataSet.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipDataSet.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipDataSet.cxx.o.d"
+  "/root/repo/Filters/General/vtkClipVolume.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipVolume.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkClipVolume.cxx.o.d"
+  "/root/repo/Filters/General/vtkCoincidentPoints.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCoincidentPoints.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCoincidentPoints.cxx.o.d"
+  "/root/repo/Filters/General/vtkContourTriangulator.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkContourTriangulator.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkContourTriangulator.cxx.o.d"
+  "/root/repo/Filters/General/vtkCountFaces.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCountFaces.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCountFaces.cxx.o.d"
+  "/root/repo/Filters/General/vtkCountVertices.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCountVertices.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCountVertices.cxx.o.d"
+  "/root/repo/Filters/General/vtkCursor2D.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCursor2D.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCursor2D.cxx.o.d"
+  "/root/repo/Filters/General/vtkCursor3D.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCursor3D.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCursor3D.cxx.o.d"
+  "/root/repo/Filters/General/vtkCurvatures.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCurvatures.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkCurvatures.cxx.o.d"
+  "/root/repo/Filters/General/vtkDataSetGradient.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDataSetGradient.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDataSetGradient.cxx.o.d"
+  "/root/repo/Filters/General/vtkDataSetGradientPrecompute.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDataSetGradientPrecompute.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDataSetGradientPrecompute.cxx.o.d"
+  "/root/repo/Filters/General/vtkDataSetTriangleFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDataSetTriangleFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDataSetTriangleFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkDeformPointSet.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDeformPointSet.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDeformPointSet.cxx.o.d"
+  "/root/repo/Filters/General/vtkDensifyPolyData.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDensifyPolyData.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDensifyPolyData.cxx.o.d"
+  "/root/repo/Filters/General/vtkDicer.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDicer.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDicer.cxx.o.d"
+  "/root/repo/Filters/General/vtkDiscreteFlyingEdges2D.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges2D.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges2D.cxx.o.d"
+  "/root/repo/Filters/General/vtkDiscreteFlyingEdges3D.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges3D.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges3D.cxx.o.d"
+  "/root/repo/Filters/General/vtkDiscreteFlyingEdgesClipper2D.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdgesClipper2D.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdgesClipper2D.cxx.o.d"
+  "/root/repo/Filters/General/vtkDiscreteMarchingCubes.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteMarchingCubes.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDiscreteMarchingCubes.cxx.o.d"
+  "/root/repo/Filters/General/vtkDistancePolyDataFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDistancePolyDataFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkDistancePolyDataFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkEdgePoints.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkEdgePoints.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkEdgePoints.cxx.o.d"
+  "/root/repo/Filters/General/vtkExtractArray.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkExtractArray.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkExtractArray.cxx.o.d"
+  "/root/repo/Filters/General/vtkExtractSelectedFrustum.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkExtractSelectedFrustum.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkExtractSelectedFrustum.cxx.o.d"
+  "/root/repo/Filters/General/vtkExtractSelectionBase.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkExtractSelectionBase.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkExtractSelectionBase.cxx.o.d"
+  "/root/repo/Filters/General/vtkGradientFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGradientFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGradientFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkGraphLayoutFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphLayoutFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphLayoutFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkGraphToPoints.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphToPoints.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphToPoints.cxx.o.d"
+  "/root/repo/Filters/General/vtkGraphWeightEuclideanDistanceFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphWeightEuclideanDistanceFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphWeightEuclideanDistanceFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkGraphWeightFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphWeightFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkGraphWeightFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkHierarchicalDataLevelFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkHierarchicalDataLevelFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkHierarchicalDataLevelFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkHyperStreamline.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkHyperStreamline.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkHyperStreamline.cxx.o.d"
+  "/root/repo/Filters/General/vtkIconGlyphFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkIconGlyphFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkIconGlyphFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkImageDataToPointSet.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkImageDataToPointSet.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkImageDataToPointSet.cxx.o.d"
+  "/root/repo/Filters/General/vtkImageMarchingCubes.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkImageMarchingCubes.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkImageMarchingCubes.cxx.o.d"
+  "/root/repo/Filters/General/vtkInterpolateDataSetAttributes.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkInterpolateDataSetAttributes.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkInterpolateDataSetAttributes.cxx.o.d"
+  "/root/repo/Filters/General/vtkInterpolatingSubdivisionFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkInterpolatingSubdivisionFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkInterpolatingSubdivisionFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkIntersectionPolyDataFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkIntersectionPolyDataFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkIntersectionPolyDataFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkLevelIdScalars.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkLevelIdScalars.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkLevelIdScalars.cxx.o.d"
+  "/root/repo/Filters/General/vtkLinkEdgels.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkLinkEdgels.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkLinkEdgels.cxx.o.d"
+  "/root/repo/Filters/General/vtkLoopBooleanPolyDataFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkLoopBooleanPolyDataFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkLoopBooleanPolyDataFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkMarchingContourFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMarchingContourFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMarchingContourFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkMatricizeArray.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMatricizeArray.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMatricizeArray.cxx.o.d"
+  "/root/repo/Filters/General/vtkMergeCells.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMergeCells.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMergeCells.cxx.o.d"
+  "/root/repo/Filters/General/vtkMultiBlockDataGroupFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiBlockDataGroupFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiBlockDataGroupFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkMultiBlockFromTimeSeriesFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiBlockFromTimeSeriesFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiBlockFromTimeSeriesFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkMultiBlockMergeFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiBlockMergeFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiBlockMergeFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkMultiThreshold.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiThreshold.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkMultiThreshold.cxx.o.d"
+  "/root/repo/Filters/General/vtkNormalizeMatrixVectors.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkNormalizeMatrixVectors.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkNormalizeMatrixVectors.cxx.o.d"
+  "/root/repo/Filters/General/vtkOBBDicer.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkOBBDicer.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkOBBDicer.cxx.o.d"
+  "/root/repo/Filters/General/vtkOBBTree.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkOBBTree.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkOBBTree.cxx.o.d"
+  "/root/repo/Filters/General/vtkOverlappingAMRLevelIdScalars.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkOverlappingAMRLevelIdScalars.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkOverlappingAMRLevelIdScalars.cxx.o.d"
+  "/root/repo/Filters/General/vtkPassArrays.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPassArrays.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPassArrays.cxx.o.d"
+  "/root/repo/Filters/General/vtkPassSelectedArrays.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPassSelectedArrays.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPassSelectedArrays.cxx.o.d"
+  "/root/repo/Filters/General/vtkPassThrough.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPassThrough.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPassThrough.cxx.o.d"
+  "/root/repo/Filters/General/vtkPointConnectivityFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPointConnectivityFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPointConnectivityFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkPolyDataStreamer.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPolyDataStreamer.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPolyDataStreamer.cxx.o.d"
+  "/root/repo/Filters/General/vtkPolyDataToReebGraphFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPolyDataToReebGraphFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkPolyDataToReebGraphFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkProbePolyhedron.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkProbePolyhedron.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkProbePolyhedron.cxx.o.d"
+  "/root/repo/Filters/General/vtkQuadraturePointInterpolator.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointInterpolator.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointInterpolator.cxx.o.d"
+  "/root/repo/Filters/General/vtkQuadraturePointsGenerator.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointsGenerator.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointsGenerator.cxx.o.d"
+  "/root/repo/Filters/General/vtkQuadratureSchemeDictionaryGenerator.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuadratureSchemeDictionaryGenerator.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuadratureSchemeDictionaryGenerator.cxx.o.d"
+  "/root/repo/Filters/General/vtkQuantizePolyDataPoints.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuantizePolyDataPoints.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkQuantizePolyDataPoints.cxx.o.d"
+  "/root/repo/Filters/General/vtkRandomAttributeGenerator.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRandomAttributeGenerator.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRandomAttributeGenerator.cxx.o.d"
+  "/root/repo/Filters/General/vtkRectilinearGridClip.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridClip.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridClip.cxx.o.d"
+  "/root/repo/Filters/General/vtkRectilinearGridToPointSet.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToPointSet.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToPointSet.cxx.o.d"
+  "/root/repo/Filters/General/vtkRectilinearGridToTetrahedra.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToTetrahedra.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToTetrahedra.cxx.o.d"
+  "/root/repo/Filters/General/vtkRecursiveDividingCubes.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRecursiveDividingCubes.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRecursiveDividingCubes.cxx.o.d"
+  "/root/repo/Filters/General/vtkReflectionFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkReflectionFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkReflectionFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkRotationFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRotationFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkRotationFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkSampleImplicitFunctionFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSampleImplicitFunctionFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSampleImplicitFunctionFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkShrinkFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkShrinkFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkShrinkFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkShrinkPolyData.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkShrinkPolyData.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkShrinkPolyData.cxx.o.d"
+  "/root/repo/Filters/General/vtkSpatialRepresentationFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSpatialRepresentationFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSpatialRepresentationFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkSplineFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplineFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplineFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkSplitByCellScalarFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplitByCellScalarFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplitByCellScalarFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkSplitColumnComponents.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplitColumnComponents.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplitColumnComponents.cxx.o.d"
+  "/root/repo/Filters/General/vtkSplitField.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplitField.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSplitField.cxx.o.d"
+  "/root/repo/Filters/General/vtkStructuredGridClip.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkStructuredGridClip.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkStructuredGridClip.cxx.o.d"
+  "/root/repo/Filters/General/vtkSubPixelPositionEdgels.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSubPixelPositionEdgels.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSubPixelPositionEdgels.cxx.o.d"
+  "/root/repo/Filters/General/vtkSubdivisionFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSubdivisionFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSubdivisionFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkSynchronizeTimeFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSynchronizeTimeFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkSynchronizeTimeFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkTableBasedClipDataSet.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTableBasedClipDataSet.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTableBasedClipDataSet.cxx.o.d"
+  "/root/repo/Filters/General/vtkTableToPolyData.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTableToPolyData.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTableToPolyData.cxx.o.d"
+  "/root/repo/Filters/General/vtkTableToStructuredGrid.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTableToStructuredGrid.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTableToStructuredGrid.cxx.o.d"
+  "/root/repo/Filters/General/vtkTemporalPathLineFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTemporalPathLineFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTemporalPathLineFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkTemporalStatistics.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTemporalStatistics.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTemporalStatistics.cxx.o.d"
+  "/root/repo/Filters/General/vtkTessellatorFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTessellatorFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTessellatorFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkTimeSourceExample.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTimeSourceExample.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTimeSourceExample.cxx.o.d"
+  "/root/repo/Filters/General/vtkTransformFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTransformFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTransformFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkTransformPolyDataFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTransformPolyDataFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkTransformPolyDataFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkUncertaintyTubeFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkUncertaintyTubeFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkUncertaintyTubeFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkVertexGlyphFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkVertexGlyphFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkVertexGlyphFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkVolumeContourSpectrumFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkVolumeContourSpectrumFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkVolumeContourSpectrumFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkVoxelContoursToSurfaceFilter.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkVoxelContoursToSurfaceFilter.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkVoxelContoursToSurfaceFilter.cxx.o.d"
+  "/root/repo/Filters/General/vtkWarpLens.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpLens.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpLens.cxx.o.d"
+  "/root/repo/Filters/General/vtkWarpScalar.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpScalar.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpScalar.cxx.o.d"
+  "/root/repo/Filters/General/vtkWarpTo.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpTo.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpTo.cxx.o.d"
+  "/root/repo/Filters/General/vtkWarpVector.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpVector.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkWarpVector.cxx.o.d"
+  "/root/repo/Filters/General/vtkYoungsMaterialInterface.cxx" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkYoungsMaterialInterface.cxx.o" "gcc" "Filters/General/CMakeFiles/FiltersGeneral.dir/vtkYoungsMaterialInterface.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkFiltersGeneral-8.90.so" "/root/repo/_gate_std/lib/libvtkFiltersGeneral-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkFiltersGeneral-8.90.so.1" "/root/repo/_gate_std/lib/libvtkFiltersGeneral-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Filters/Core/CMakeFiles/FiltersCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/System/CMakeFiles/CommonSystem.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,243 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkFiltersGeneral-8.90.pdb"
+  "../../lib/libvtkFiltersGeneral-8.90.so"
+  "../../lib/libvtkFiltersGeneral-8.90.so.1"
+  "../../lib/libvtkFiltersGeneral-8.90.so.8.90.0"
+  "CMakeFiles/FiltersGeneral.dir/vtkAnnotationLink.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkAnnotationLink.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkAppendPoints.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkAppendPoints.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkApproximatingSubdivisionFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkApproximatingSubdivisionFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkAreaContourSpectrumFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkAreaContourSpectrumFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkAxes.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkAxes.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGrid.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGrid.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGridWithImage.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkBlankStructuredGridWithImage.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkBlockIdScalars.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkBlockIdScalars.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkBooleanOperationPolyDataFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkBooleanOperationPolyDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkBoxClipDataSet.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkBoxClipDataSet.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkBrownianPoints.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkBrownianPoints.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellCenters.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellCenters.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellDerivatives.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellDerivatives.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellTreeLocator.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellTreeLocator.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellValidator.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCellValidator.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipClosedSurface.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipClosedSurface.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipConvexPolyData.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipConvexPolyData.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipDataSet.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipDataSet.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipVolume.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkClipVolume.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCoincidentPoints.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCoincidentPoints.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkContourTriangulator.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkContourTriangulator.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCountFaces.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCountFaces.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCountVertices.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCountVertices.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCursor2D.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCursor2D.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCursor3D.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCursor3D.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkCurvatures.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkCurvatures.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDataSetGradient.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDataSetGradient.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDataSetGradientPrecompute.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDataSetGradientPrecompute.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDataSetTriangleFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDataSetTriangleFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDeformPointSet.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDeformPointSet.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDensifyPolyData.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDensifyPolyData.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDicer.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDicer.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges2D.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges2D.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges3D.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdges3D.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdgesClipper2D.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteFlyingEdgesClipper2D.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteMarchingCubes.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDiscreteMarchingCubes.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkDistancePolyDataFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkDistancePolyDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkEdgePoints.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkEdgePoints.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkExtractArray.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkExtractArray.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkExtractSelectedFrustum.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkExtractSelectedFrustum.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkExtractSelectionBase.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkExtractSelectionBase.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkGradientFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkGradientFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphLayoutFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphLayoutFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphToPoints.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphToPoints.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphWeightEuclideanDistanceFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphWeightEuclideanDistanceFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphWeightFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkGraphWeightFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkHierarchicalDataLevelFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkHierarchicalDataLevelFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkHyperStreamline.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkHyperStreamline.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkIconGlyphFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkIconGlyphFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkImageDataToPointSet.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkImageDataToPointSet.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkImageMarchingCubes.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkImageMarchingCubes.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkInterpolateDataSetAttributes.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkInterpolateDataSetAttributes.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkInterpolatingSubdivisionFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkInterpolatingSubdivisionFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkIntersectionPolyDataFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkIntersectionPolyDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkLevelIdScalars.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkLevelIdScalars.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkLinkEdgels.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkLinkEdgels.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkLoopBooleanPolyDataFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkLoopBooleanPolyDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkMarchingContourFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkMarchingContourFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkMatricizeArray.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkMatricizeArray.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkMergeCells.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkMergeCells.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiBlockDataGroupFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiBlockDataGroupFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiBlockFromTimeSeriesFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiBlockFromTimeSeriesFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiBlockMergeFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiBlockMergeFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiThreshold.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkMultiThreshold.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkNormalizeMatrixVectors.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkNormalizeMatrixVectors.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkOBBDicer.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkOBBDicer.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkOBBTree.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkOBBTree.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkOverlappingAMRLevelIdScalars.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkOverlappingAMRLevelIdScalars.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkPassArrays.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkPassArrays.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkPassSelectedArrays.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkPassSelectedArrays.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkPassThrough.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkPassThrough.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkPointConnectivityFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkPointConnectivityFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkPolyDataStreamer.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkPolyDataStreamer.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkPolyDataToReebGraphFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkPolyDataToReebGraphFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkProbePolyhedron.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkProbePolyhedron.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointInterpolator.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointInterpolator.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointsGenerator.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuadraturePointsGenerator.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuadratureSchemeDictionaryGenerator.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuadratureSchemeDictionaryGenerator.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuantizePolyDataPoints.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkQuantizePolyDataPoints.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkRandomAttributeGenerator.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkRandomAttributeGenerator.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridClip.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridClip.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToPointSet.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToPointSet.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToTetrahedra.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkRectilinearGridToTetrahedra.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkRecursiveDividingCubes.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkRecursiveDividingCubes.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkReflectionFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkReflectionFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkRotationFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkRotationFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSampleImplicitFunctionFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSampleImplicitFunctionFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkShrinkFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkShrinkFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkShrinkPolyData.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkShrinkPolyData.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSpatialRepresentationFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSpatialRepresentationFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplineFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplineFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplitByCellScalarFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplitByCellScalarFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplitColumnComponents.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplitColumnComponents.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplitField.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSplitField.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkStructuredGridClip.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkStructuredGridClip.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSubPixelPositionEdgels.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSubPixelPositionEdgels.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSubdivisionFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSubdivisionFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkSynchronizeTimeFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkSynchronizeTimeFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTableBasedClipDataSet.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTableBasedClipDataSet.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTableToPolyData.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTableToPolyData.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTableToStructuredGrid.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTableToStructuredGrid.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTemporalPathLineFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTemporalPathLineFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTemporalStatistics.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTemporalStatistics.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTessellatorFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTessellatorFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTimeSourceExample.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTimeSourceExample.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTransformFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTransformFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkTransformPolyDataFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkTransformPolyDataFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkUncertaintyTubeFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkUncertaintyTubeFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkVertexGlyphFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkVertexGlyphFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkVolumeContourSpectrumFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkVolumeContourSpectrumFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkVoxelContoursToSurfaceFilter.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkVoxelContoursToSurfaceFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpLens.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpLens.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpScalar.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpScalar.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpTo.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpTo.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpVector.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkWarpVector.cxx.o.d"
+  "CMakeFiles/FiltersGeneral.dir/vtkYoungsMaterialInterface.cxx.o"
+  "CMakeFiles/FiltersGeneral.dir/vtkYoungsMaterialInterface.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FiltersGeneral.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,223 @@
+# Install script for directory: /root/repo/Filters/General
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Filters/General/vtkAnnotationLink.h"
+    "/root/repo/Filters/General/vtkAppendPoints.h"
+    "/root/repo/Filters/General/vtkApproximatingSubdivisionFilter.h"
+    "/root/repo/Filters/General/vtkAreaContourSpectrumFilter.h"
+    "/root/repo/Filters/General/vtkAxes.h"
+    "/root/repo/Filters/General/vtkBlankStructuredGrid.h"
+    "/root/repo/Filters/General/vtkBlankStructuredGridWithImage.h"
+    "/root/repo/Filters/General/vtkBlockIdScalars.h"
+    "/root/repo/Filters/General/vtkBooleanOperationPolyDataFilter.h"
+    "/root/repo/Filters/General/vtkBoxClipDataSet.h"
+    "/root/repo/Filters/General/vtkBrownianPoints.h"
+    "/root/repo/Filters/General/vtkCellCenters.h"
+    "/root/repo/Filters/General/vtkCellDerivatives.h"
+    "/root/repo/Filters/General/vtkCellTreeLocator.h"
+    "/root/repo/Filters/General/vtkCellValidator.h"
+    "/root/repo/Filters/General/vtkClipClosedSurface.h"
+    "/root/repo/Filters/General/vtkClipConvexPolyData.h"
+    "/root/repo/Filters/General/vtkClipDataSet.h"
+    "/root/repo/Filters/General/vtkClipVolume.h"
+    "/root/repo/Filters/General/vtkCoincidentPoints.h"
+    "/root/repo/Filters/General/vtkContourTriangulator.h"
+    "/root/repo/Filters/General/vtkCountFaces.h"
+    "/root/repo/Filters/General/vtkCountVertices.h"
+    "/root/repo/Filters/General/vtkCursor2D.h"
+    "/root/repo/Filters/General/vtkCursor3D.h"
+    "/root/repo/Filters/General/vtkCurvatures.h"
+    "/root/repo/Filters/General/vtkDataSetGradient.h"
+    "/root/repo/Filters/General/vtkDataSetGradientPrecompute.h"
+    "/root/repo/Filters/General/vtkDataSetTriangleFilter.h"
+    "/root/repo/Filters/General/vtkDeformPointSet.h"
+    "/root/repo/Filters/General/vtkDensifyPolyData.h"
+    "/root/repo/Filters/General/vtkDicer.h"
+    "/root/repo/Filters/General/vtkDiscreteFlyingEdges2D.h"
+    "/root/repo/Filters/General/vtkDiscreteFlyingEdges3D.h"
+    "/root/repo/Filters/General/vtkDiscreteFlyingEdgesClipper2D.h"
+    "/root/repo/Filters/General/vtkDiscreteMarchingCubes.h"
+    "/root/repo/Filters/General/vtkDistancePolyDataFilter.h"
+    "/root/repo/Filters/General/vtkEdgePoints.h"
+    "/root/repo/Filters/General/vtkExtractArray.h"
+    "/root/repo/Filters/General/vtkExtractSelectedFrustum.h"
+    "/root/repo/Filters/General/vtkExtractSelectionBase.h"
+    "/root/repo/Filters/General/vtkGradientFilter.h"
+    "/root/repo/Filters/General/vtkGraphLayoutFilter.h"
+    "/root/repo/Filters/General/vtkGraphToPoints.h"
+    "/root/repo/Filters/General/vtkGraphWeightEuclideanDistanceFilter.h"
+    "/root/repo/Filters/General/vtkGraphWeightFilter.h"
+    "/root/repo/Filters/General/vtkHierarchicalDataLevelFilter.h"
+    "/root/repo/Filters/General/vtkHyperStreamline.h"
+    "/root/repo/Filters/General/vtkIconGlyphFilter.h"
+    "/root/repo/Filters/General/vtkImageDataToPointSet.h"
+    "/root/repo/Filters/General/vtkImageMarchingCubes.h"
+    "/root/repo/Filters/General/vtkInterpolateDataSetAttributes.h"
+    "/root/repo/Filters/General/vtkInterpolatingSubdivisionFilter.h"
+    "/root/repo/Filters/General/vtkIntersectionPolyDataFilter.h"
+    "/root/repo/Filters/General/vtkLevelIdScalars.h"
+    "/root/repo/Filters/General/vtkLinkEdgels.h"
+    "/root/repo/Filters/General/vtkLoopBooleanPolyDataFilter.h"
+    "/root/repo/Filters/General/vtkMarchingContourFilter.h"
+    "/root/repo/Filters/General/vtkMatricizeArray.h"
+    "/root/repo/Filters/General/vtkMergeCells.h"
+    "/root/repo/Filters/General/vtkMultiBlockDataGroupFilter.h"
+    "/root/repo/Filters/General/vtkMultiBlockFromTimeSeriesFilter.h"
+    "/root/repo/Filters/General/vtkMultiBlockMergeFilter.h"
+    "/root/repo/Filters/General/vtkMultiThreshold.h"
+    "/root/repo/Filters/General/vtkNormalizeMatrixVectors.h"
+    "/root/repo/Filters/General/vtkOBBDicer.h"
+    "/root/repo/Filters/General/vtkOBBTree.h"
+    "/root/repo/Filters/General/vtkOverlappingAMRLevelIdScalars.h"
+    "/root/repo/Filters/General/vtkPassArrays.h"
+    "/root/repo/Filters/General/vtkPassSelectedArrays.h"
+    "/root/repo/Filters/General/vtkPassThrough.h"
+    "/root/repo/Filters/General/vtkPointConnectivityFilter.h"
+    "/root/repo/Filters/General/vtkPolyDataStreamer.h"
+    "/root/repo/Filters/General/vtkPolyDataToReebGraphFilter.h"
+    "/root/repo/Filters/General/vtkProbePolyhedron.h"
+    "/root/repo/Filters/General/vtkQuadraturePointInterpolator.h"
+    "/root/repo/Filters/General/vtkQuadraturePointsGenerator.h"
+    "/root/repo/Filters/General/vtkQuadratureSchemeDictionaryGenerator.h"
+    "/root/repo/Filters/General/vtkQuantizePolyDataPoints.h"
+    "/root/repo/Filters/General/vtkRandomAttributeGenerator.h"
+    "/root/repo/Filters/General/vtkRectilinearGridClip.h"
+    "/root/repo/Filters/General/vtkRectilinearGridToPointSet.h"
+    "/root/repo/Filters/General/vtkRectilinearGridToTetrahedra.h"
+    "/root/repo/Filters/General/vtkRecursiveDividingCubes.h"
+    "/root/repo/Filters/General/vtkReflectionFilter.h"
+    "/root/repo/Filters/General/vtkRotationFilter.h"
+    "/root/repo/Filters/General/vtkSampleImplicitFunctionFilter.h"
+    "/root/repo/Filters/General/vtkShrinkFilter.h"
+    "/root/repo/Filters/General/vtkShrinkPolyData.h"
+    "/root/repo/Filters/General/vtkSpatialRepresentationFilter.h"
+    "/root/repo/Filters/General/vtkSplineFilter.h"
+    "/root/repo/Filters/General/vtkSplitByCellScalarFilter.h"
+    "/root/repo/Filters/General/vtkSplitColumnComponents.h"
+    "/root/repo/Filters/General/vtkSplitField.h"
+    "/root/repo/Filters/General/vtkStructuredGridClip.h"
+    "/root/repo/Filters/General/vtkSubPixelPositionEdgels.h"
+    "/root/repo/Filters/General/vtkSubdivisionFilter.h"
+    "/root/repo/Filters/General/vtkSynchronizeTimeFilter.h"
+    "/root/repo/Filters/General/vtkTableBasedClipDataSet.h"
+    "/root/repo/Filters/General/vtkTableToPolyData.h"
+    "/root/repo/Filters/General/vtkTableToStructuredGrid.h"
+    "/root/repo/Filters/General/vtkTemporalPathLineFilter.h"
+    "/root/repo/Filters/General/vtkTemporalStatistics.h"
+    "/root/repo/Filters/General/vtkTessellatorFilter.h"
+    "/root/repo/Filters/General/vtkTimeSourceExample.h"
+    "/root/repo/Filters/General/vtkTransformFilter.h"
+    "/root/repo/Filters/General/vtkTransformPolyDataFilter.h"
+    "/root/repo/Filters/General/vtkUncertaintyTubeFilter.h"
+    "/root/repo/Filters/General/vtkVertexGlyphFilter.h"
+    "/root/repo/Filters/General/vtkVolumeContourSpectrumFilter.h"
+    "/root/repo/Filters/General/vtkVoxelContoursToSurfaceFilter.h"
+    "/root/repo/Filters/General/vtkWarpLens.h"
+    "/root/repo/Filters/General/vtkWarpScalar.h"
+    "/root/repo/Filters/General/vtkWarpTo.h"
+    "/root/repo/Filters/General/vtkWarpVector.h"
+    "/root/repo/Filters/General/vtkYoungsMaterialInterface.h"
+    "/root/repo/_gate_std/Filters/General/vtkFiltersGeneralModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkFiltersGeneral-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkFiltersGeneral-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkFiltersGeneral-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkFiltersGeneral-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkFiltersGeneral-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersGeneral-8.90.so")
+    endif()
+  endif()
+endif()
+
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkFiltersGeometry-hierarchy.txt"
+  "CMakeFiles/FiltersGeometry-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FiltersGeometry-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,57 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Filters/Geometry/vtkAbstractGridConnectivity.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkAbstractGridConnectivity.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkAbstractGridConnectivity.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkCompositeDataGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkCompositeDataGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkCompositeDataGeometryFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkDataSetGhostGenerator.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkDataSetGhostGenerator.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkDataSetGhostGenerator.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkDataSetRegionSurfaceFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkDataSetRegionSurfaceFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkDataSetRegionSurfaceFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkDataSetSurfaceFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkDataSetSurfaceFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkDataSetSurfaceFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkExplicitStructuredGridSurfaceFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkExplicitStructuredGridSurfaceFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkExplicitStructuredGridSurfaceFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkGeometryFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkHierarchicalDataSetGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkHierarchicalDataSetGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkHierarchicalDataSetGeometryFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkImageDataGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkImageDataGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkImageDataGeometryFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkImageDataToUniformGrid.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkImageDataToUniformGrid.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkImageDataToUniformGrid.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkLinearToQuadraticCellsFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkLinearToQuadraticCellsFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkLinearToQuadraticCellsFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkProjectSphereFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkProjectSphereFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkProjectSphereFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkRectilinearGridGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridGeometryFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkRectilinearGridPartitioner.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridPartitioner.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridPartitioner.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredAMRGridConnectivity.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRGridConnectivity.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRGridConnectivity.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredAMRNeighbor.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRNeighbor.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRNeighbor.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredGridConnectivity.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridConnectivity.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridConnectivity.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredGridGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGeometryFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredGridGhostDataGenerator.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGhostDataGenerator.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGhostDataGenerator.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredGridPartitioner.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridPartitioner.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredGridPartitioner.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredNeighbor.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredNeighbor.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredNeighbor.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkStructuredPointsGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredPointsGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkStructuredPointsGeometryFilter.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkUniformGridGhostDataGenerator.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkUniformGridGhostDataGenerator.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkUniformGridGhostDataGenerator.cxx.o.d"
+  "/root/repo/Filters/Geometry/vtkUnstructuredGridGeometryFilter.cxx" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkUnstructuredGridGeometryFilter.cxx.o" "gcc" "Filters/Geometry/CMakeFiles/FiltersGeometry.dir/vtkUnstructuredGridGeometryFilter.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkFiltersGeometry-8.90.so" "/root/repo/_gate_std/lib/libvtkFiltersGeometry-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkFiltersGeometry-8.90.so.1" "/root/repo/_gate_std/lib/libvtkFiltersGeometry-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Filters/Core/CMakeFiles/FiltersCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkFiltersGeometry-8.90.pdb"
+  "../../lib/libvtkFiltersGeometry-8.90.so"
+  "../../lib/libvtkFiltersGeometry-8.90.so.1"
+  "../../lib/libvtkFiltersGeometry-8.90.so.8.90.0"
+  "CMakeFiles/FiltersGeometry.dir/vtkAbstractGridConnectivity.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkAbstractGridConnectivity.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkCompositeDataGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkCompositeDataGeometryFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkDataSetGhostGenerator.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkDataSetGhostGenerator.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkDataSetRegionSurfaceFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkDataSetRegionSurfaceFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkDataSetSurfaceFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkDataSetSurfaceFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkExplicitStructuredGridSurfaceFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkExplicitStructuredGridSurfaceFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkGeometryFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkHierarchicalDataSetGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkHierarchicalDataSetGeometryFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkImageDataGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkImageDataGeometryFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkImageDataToUniformGrid.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkImageDataToUniformGrid.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkLinearToQuadraticCellsFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkLinearToQuadraticCellsFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkProjectSphereFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkProjectSphereFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridGeometryFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridPartitioner.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkRectilinearGridPartitioner.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRGridConnectivity.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRGridConnectivity.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRNeighbor.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredAMRNeighbor.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridConnectivity.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridConnectivity.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGeometryFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGhostDataGenerator.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridGhostDataGenerator.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridPartitioner.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredGridPartitioner.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredNeighbor.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredNeighbor.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredPointsGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkStructuredPointsGeometryFilter.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkUniformGridGhostDataGenerator.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkUniformGridGhostDataGenerator.cxx.o.d"
+  "CMakeFiles/FiltersGeometry.dir/vtkUnstructuredGridGeometryFilter.cxx.o"
+  "CMakeFiles/FiltersGeometry.dir/vtkUnstructuredGridGeometryFilter.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FiltersGeometry.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkFiltersModeling-hierarchy.txt"
+  "CMakeFiles/FiltersModeling-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FiltersModeling-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
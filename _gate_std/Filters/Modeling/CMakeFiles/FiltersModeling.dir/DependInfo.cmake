@@ -0,0 +1,67 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Filters/Modeling/vtkAdaptiveSubdivisionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkAdaptiveSubdivisionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkAdaptiveSubdivisionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkBandedPolyDataContourFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkBandedPolyDataContourFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkBandedPolyDataContourFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkButterflySubdivisionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkButterflySubdivisionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkButterflySubdivisionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkCollisionDetectionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkCollisionDetectionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkCollisionDetectionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkContourLoopExtraction.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkContourLoopExtraction.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkContourLoopExtraction.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkCookieCutter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkCookieCutter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkCookieCutter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkDijkstraGraphGeodesicPath.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkDijkstraGraphGeodesicPath.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkDijkstraGraphGeodesicPath.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkDijkstraImageGeodesicPath.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkDijkstraImageGeodesicPath.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkDijkstraImageGeodesicPath.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkFillHolesFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkFillHolesFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkFillHolesFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkFitToHeightMapFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkFitToHeightMapFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkFitToHeightMapFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkGeodesicPath.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkGeodesicPath.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkGeodesicPath.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkGraphGeodesicPath.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkGraphGeodesicPath.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkGraphGeodesicPath.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkHausdorffDistancePointSetFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkHausdorffDistancePointSetFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkHausdorffDistancePointSetFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkHyperTreeGridOutlineFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkHyperTreeGridOutlineFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkHyperTreeGridOutlineFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkLinearExtrusionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkLinearExtrusionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkLinearExtrusionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkLinearSubdivisionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkLinearSubdivisionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkLinearSubdivisionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkLoopSubdivisionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkLoopSubdivisionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkLoopSubdivisionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkOutlineFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkOutlineFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkOutlineFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkPolyDataPointSampler.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkPolyDataPointSampler.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkPolyDataPointSampler.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkProjectedTexture.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkProjectedTexture.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkProjectedTexture.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkQuadRotationalExtrusionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkQuadRotationalExtrusionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkQuadRotationalExtrusionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkRibbonFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkRibbonFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkRibbonFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkRotationalExtrusionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkRotationalExtrusionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkRotationalExtrusionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkRuledSurfaceFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkRuledSurfaceFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkRuledSurfaceFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkSectorSource.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSectorSource.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSectorSource.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkSelectEnclosedPoints.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSelectEnclosedPoints.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSelectEnclosedPoints.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkSelectPolyData.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSelectPolyData.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSelectPolyData.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkSpherePuzzle.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSpherePuzzle.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSpherePuzzle.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkSpherePuzzleArrows.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSpherePuzzleArrows.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSpherePuzzleArrows.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkSubdivideTetra.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSubdivideTetra.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkSubdivideTetra.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkTrimmedExtrusionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkTrimmedExtrusionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkTrimmedExtrusionFilter.cxx.o.d"
+  "/root/repo/Filters/Modeling/vtkVolumeOfRevolutionFilter.cxx" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkVolumeOfRevolutionFilter.cxx.o" "gcc" "Filters/Modeling/CMakeFiles/FiltersModeling.dir/vtkVolumeOfRevolutionFilter.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkFiltersModeling-8.90.so" "/root/repo/_gate_std/lib/libvtkFiltersModeling-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkFiltersModeling-8.90.so.1" "/root/repo/_gate_std/lib/libvtkFiltersModeling-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Filters/Sources/CMakeFiles/FiltersSources.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Filters/General/CMakeFiles/FiltersGeneral.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Filters/Core/CMakeFiles/FiltersCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,75 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkFiltersModeling-8.90.pdb"
+  "../../lib/libvtkFiltersModeling-8.90.so"
+  "../../lib/libvtkFiltersModeling-8.90.so.1"
+  "../../lib/libvtkFiltersModeling-8.90.so.8.90.0"
+  "CMakeFiles/FiltersModeling.dir/vtkAdaptiveSubdivisionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkAdaptiveSubdivisionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkBandedPolyDataContourFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkBandedPolyDataContourFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkButterflySubdivisionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkButterflySubdivisionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkCollisionDetectionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkCollisionDetectionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkContourLoopExtraction.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkContourLoopExtraction.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkCookieCutter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkCookieCutter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkDijkstraGraphGeodesicPath.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkDijkstraGraphGeodesicPath.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkDijkstraImageGeodesicPath.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkDijkstraImageGeodesicPath.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkFillHolesFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkFillHolesFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkFitToHeightMapFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkFitToHeightMapFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkGeodesicPath.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkGeodesicPath.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkGraphGeodesicPath.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkGraphGeodesicPath.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkHausdorffDistancePointSetFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkHausdorffDistancePointSetFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkHyperTreeGridOutlineFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkHyperTreeGridOutlineFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkLinearExtrusionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkLinearExtrusionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkLinearSubdivisionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkLinearSubdivisionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkLoopSubdivisionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkLoopSubdivisionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkOutlineFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkOutlineFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkPolyDataPointSampler.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkPolyDataPointSampler.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkProjectedTexture.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkProjectedTexture.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkQuadRotationalExtrusionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkQuadRotationalExtrusionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkRibbonFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkRibbonFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkRotationalExtrusionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkRotationalExtrusionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkRuledSurfaceFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkRuledSurfaceFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkSectorSource.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkSectorSource.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkSelectEnclosedPoints.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkSelectEnclosedPoints.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkSelectPolyData.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkSelectPolyData.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkSpherePuzzle.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkSpherePuzzle.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkSpherePuzzleArrows.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkSpherePuzzleArrows.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkSubdivideTetra.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkSubdivideTetra.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkTrimmedExtrusionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkTrimmedExtrusionFilter.cxx.o.d"
+  "CMakeFiles/FiltersModeling.dir/vtkVolumeOfRevolutionFilter.cxx.o"
+  "CMakeFiles/FiltersModeling.dir/vtkVolumeOfRevolutionFilter.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FiltersModeling.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
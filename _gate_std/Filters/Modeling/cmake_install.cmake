@@ -0,0 +1,139 @@
+# Install script for directory: /root/repo/Filters/Modeling
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Filters/Modeling/vtkAdaptiveSubdivisionFilter.h"
+    "/root/repo/Filters/Modeling/vtkBandedPolyDataContourFilter.h"
+    "/root/repo/Filters/Modeling/vtkButterflySubdivisionFilter.h"
+    "/root/repo/Filters/Modeling/vtkCollisionDetectionFilter.h"
+    "/root/repo/Filters/Modeling/vtkContourLoopExtraction.h"
+    "/root/repo/Filters/Modeling/vtkCookieCutter.h"
+    "/root/repo/Filters/Modeling/vtkDijkstraGraphGeodesicPath.h"
+    "/root/repo/Filters/Modeling/vtkDijkstraImageGeodesicPath.h"
+    "/root/repo/Filters/Modeling/vtkFillHolesFilter.h"
+    "/root/repo/Filters/Modeling/vtkFitToHeightMapFilter.h"
+    "/root/repo/Filters/Modeling/vtkGeodesicPath.h"
+    "/root/repo/Filters/Modeling/vtkGraphGeodesicPath.h"
+    "/root/repo/Filters/Modeling/vtkHausdorffDistancePointSetFilter.h"
+    "/root/repo/Filters/Modeling/vtkHyperTreeGridOutlineFilter.h"
+    "/root/repo/Filters/Modeling/vtkLinearExtrusionFilter.h"
+    "/root/repo/Filters/Modeling/vtkLinearSubdivisionFilter.h"
+    "/root/repo/Filters/Modeling/vtkLoopSubdivisionFilter.h"
+    "/root/repo/Filters/Modeling/vtkOutlineFilter.h"
+    "/root/repo/Filters/Modeling/vtkPolyDataPointSampler.h"
+    "/root/repo/Filters/Modeling/vtkProjectedTexture.h"
+    "/root/repo/Filters/Modeling/vtkQuadRotationalExtrusionFilter.h"
+    "/root/repo/Filters/Modeling/vtkRibbonFilter.h"
+    "/root/repo/Filters/Modeling/vtkRotationalExtrusionFilter.h"
+    "/root/repo/Filters/Modeling/vtkRuledSurfaceFilter.h"
+    "/root/repo/Filters/Modeling/vtkSectorSource.h"
+    "/root/repo/Filters/Modeling/vtkSelectEnclosedPoints.h"
+    "/root/repo/Filters/Modeling/vtkSelectPolyData.h"
+    "/root/repo/Filters/Modeling/vtkSpherePuzzle.h"
+    "/root/repo/Filters/Modeling/vtkSpherePuzzleArrows.h"
+    "/root/repo/Filters/Modeling/vtkSubdivideTetra.h"
+    "/root/repo/Filters/Modeling/vtkTrimmedExtrusionFilter.h"
+    "/root/repo/Filters/Modeling/vtkVolumeOfRevolutionFilter.h"
+    "/root/repo/_gate_std/Filters/Modeling/vtkFiltersModelingModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkFiltersModeling-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkFiltersModeling-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkFiltersModeling-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkFiltersModeling-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkFiltersModeling-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersModeling-8.90.so")
+    endif()
+  endif()
+endif()
+
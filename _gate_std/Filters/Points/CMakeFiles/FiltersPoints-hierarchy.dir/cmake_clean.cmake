@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkFiltersPoints-hierarchy.txt"
+  "CMakeFiles/FiltersPoints-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FiltersPoints-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
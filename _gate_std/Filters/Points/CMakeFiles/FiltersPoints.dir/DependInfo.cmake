@@ -0,0 +1,74 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Filters/Points/vtkBoundedPointSource.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkBoundedPointSource.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkBoundedPointSource.cxx.o.d"
+  "/root/repo/Filters/Points/vtkConnectedPointsFilter.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkConnectedPointsFilter.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkConnectedPointsFilter.cxx.o.d"
+  "/root/repo/Filters/Points/vtkDensifyPointCloudFilter.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkDensifyPointCloudFilter.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkDensifyPointCloudFilter.cxx.o.d"
+  "/root/repo/Filters/Points/vtkEllipsoidalGaussianKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkEllipsoidalGaussianKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkEllipsoidalGaussianKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkEuclideanClusterExtraction.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkEuclideanClusterExtraction.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkEuclideanClusterExtraction.cxx.o.d"
+  "/root/repo/Filters/Points/vtkExtractEnclosedPoints.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractEnclosedPoints.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractEnclosedPoints.cxx.o.d"
+  "/root/repo/Filters/Points/vtkExtractHierarchicalBins.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractHierarchicalBins.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractHierarchicalBins.cxx.o.d"
+  "/root/repo/Filters/Points/vtkExtractPointCloudPiece.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractPointCloudPiece.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractPointCloudPiece.cxx.o.d"
+  "/root/repo/Filters/Points/vtkExtractPoints.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractPoints.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractPoints.cxx.o.d"
+  "/root/repo/Filters/Points/vtkExtractSurface.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractSurface.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkExtractSurface.cxx.o.d"
+  "/root/repo/Filters/Points/vtkFitImplicitFunction.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkFitImplicitFunction.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkFitImplicitFunction.cxx.o.d"
+  "/root/repo/Filters/Points/vtkGaussianKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkGaussianKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkGaussianKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkGeneralizedKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkGeneralizedKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkGeneralizedKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkHierarchicalBinningFilter.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkHierarchicalBinningFilter.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkHierarchicalBinningFilter.cxx.o.d"
+  "/root/repo/Filters/Points/vtkInterpolationKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkInterpolationKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkInterpolationKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkLinearKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkLinearKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkLinearKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkMaskPointsFilter.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkMaskPointsFilter.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkMaskPointsFilter.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPCACurvatureEstimation.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPCACurvatureEstimation.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPCACurvatureEstimation.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPCANormalEstimation.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPCANormalEstimation.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPCANormalEstimation.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPointCloudFilter.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointCloudFilter.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointCloudFilter.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPointDensityFilter.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointDensityFilter.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointDensityFilter.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPointInterpolator.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointInterpolator.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointInterpolator.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPointInterpolator2D.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointInterpolator2D.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointInterpolator2D.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPointKNNGraph.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointKNNGraph.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointKNNGraph.cxx.o.d"
+  "/root/repo/Filters/Points/vtkPointOccupancyFilter.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointOccupancyFilter.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkPointOccupancyFilter.cxx.o.d"
+  "/root/repo/Filters/Points/vtkProbabilisticVoronoiKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkProbabilisticVoronoiKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkProbabilisticVoronoiKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkRadiusOutlierRemoval.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkRadiusOutlierRemoval.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkRadiusOutlierRemoval.cxx.o.d"
+  "/root/repo/Filters/Points/vtkSPHCubicKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHCubicKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHCubicKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkSPHInterpolator.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHInterpolator.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHInterpolator.cxx.o.d"
+  "/root/repo/Filters/Points/vtkSPHKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkSPHQuarticKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHQuarticKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHQuarticKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkSPHQuinticKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHQuinticKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSPHQuinticKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkShepardKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkShepardKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkShepardKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkSignedDistance.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSignedDistance.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkSignedDistance.cxx.o.d"
+  "/root/repo/Filters/Points/vtkStatisticalOutlierRemoval.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkStatisticalOutlierRemoval.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkStatisticalOutlierRemoval.cxx.o.d"
+  "/root/repo/Filters/Points/vtkUnsignedDistance.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkUnsignedDistance.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkUnsignedDistance.cxx.o.d"
+  "/root/repo/Filters/Points/vtkVoronoiKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkVoronoiKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkVoronoiKernel.cxx.o.d"
+  "/root/repo/Filters/Points/vtkVoxelGrid.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkVoxelGrid.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkVoxelGrid.cxx.o.d"
+  "/root/repo/Filters/Points/vtkWendlandQuinticKernel.cxx" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkWendlandQuinticKernel.cxx.o" "gcc" "Filters/Points/CMakeFiles/FiltersPoints.dir/vtkWendlandQuinticKernel.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkFiltersPoints-8.90.so" "/root/repo/_gate_std/lib/libvtkFiltersPoints-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkFiltersPoints-8.90.so.1" "/root/repo/_gate_std/lib/libvtkFiltersPoints-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Filters/Modeling/CMakeFiles/FiltersModeling.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Filters/General/CMakeFiles/FiltersGeneral.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Filters/Core/CMakeFiles/FiltersCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,89 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkFiltersPoints-8.90.pdb"
+  "../../lib/libvtkFiltersPoints-8.90.so"
+  "../../lib/libvtkFiltersPoints-8.90.so.1"
+  "../../lib/libvtkFiltersPoints-8.90.so.8.90.0"
+  "CMakeFiles/FiltersPoints.dir/vtkBoundedPointSource.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkBoundedPointSource.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkConnectedPointsFilter.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkConnectedPointsFilter.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkDensifyPointCloudFilter.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkDensifyPointCloudFilter.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkEllipsoidalGaussianKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkEllipsoidalGaussianKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkEuclideanClusterExtraction.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkEuclideanClusterExtraction.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractEnclosedPoints.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractEnclosedPoints.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractHierarchicalBins.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractHierarchicalBins.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractPointCloudPiece.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractPointCloudPiece.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractPoints.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractPoints.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractSurface.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkExtractSurface.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkFitImplicitFunction.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkFitImplicitFunction.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkGaussianKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkGaussianKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkGeneralizedKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkGeneralizedKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkHierarchicalBinningFilter.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkHierarchicalBinningFilter.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkInterpolationKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkInterpolationKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkLinearKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkLinearKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkMaskPointsFilter.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkMaskPointsFilter.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPCACurvatureEstimation.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPCACurvatureEstimation.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPCANormalEstimation.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPCANormalEstimation.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPointCloudFilter.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPointCloudFilter.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPointDensityFilter.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPointDensityFilter.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPointInterpolator.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPointInterpolator.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPointInterpolator2D.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPointInterpolator2D.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPointKNNGraph.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPointKNNGraph.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkPointOccupancyFilter.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkPointOccupancyFilter.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkProbabilisticVoronoiKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkProbabilisticVoronoiKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkRadiusOutlierRemoval.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkRadiusOutlierRemoval.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHCubicKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHCubicKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHInterpolator.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHInterpolator.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHQuarticKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHQuarticKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHQuinticKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkSPHQuinticKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkShepardKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkShepardKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkSignedDistance.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkSignedDistance.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkStatisticalOutlierRemoval.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkStatisticalOutlierRemoval.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkUnsignedDistance.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkUnsignedDistance.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkVoronoiKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkVoronoiKernel.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkVoxelGrid.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkVoxelGrid.cxx.o.d"
+  "CMakeFiles/FiltersPoints.dir/vtkWendlandQuinticKernel.cxx.o"
+  "CMakeFiles/FiltersPoints.dir/vtkWendlandQuinticKernel.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FiltersPoints.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,146 @@
+# Install script for directory: /root/repo/Filters/Points
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Filters/Points/vtkBoundedPointSource.h"
+    "/root/repo/Filters/Points/vtkConnectedPointsFilter.h"
+    "/root/repo/Filters/Points/vtkDensifyPointCloudFilter.h"
+    "/root/repo/Filters/Points/vtkEllipsoidalGaussianKernel.h"
+    "/root/repo/Filters/Points/vtkEuclideanClusterExtraction.h"
+    "/root/repo/Filters/Points/vtkExtractEnclosedPoints.h"
+    "/root/repo/Filters/Points/vtkExtractHierarchicalBins.h"
+    "/root/repo/Filters/Points/vtkExtractPointCloudPiece.h"
+    "/root/repo/Filters/Points/vtkExtractPoints.h"
+    "/root/repo/Filters/Points/vtkExtractSurface.h"
+    "/root/repo/Filters/Points/vtkFitImplicitFunction.h"
+    "/root/repo/Filters/Points/vtkGaussianKernel.h"
+    "/root/repo/Filters/Points/vtkGeneralizedKernel.h"
+    "/root/repo/Filters/Points/vtkHierarchicalBinningFilter.h"
+    "/root/repo/Filters/Points/vtkInterpolationKernel.h"
+    "/root/repo/Filters/Points/vtkLinearKernel.h"
+    "/root/repo/Filters/Points/vtkMaskPointsFilter.h"
+    "/root/repo/Filters/Points/vtkPCACurvatureEstimation.h"
+    "/root/repo/Filters/Points/vtkPCANormalEstimation.h"
+    "/root/repo/Filters/Points/vtkPointCloudFilter.h"
+    "/root/repo/Filters/Points/vtkPointDensityFilter.h"
+    "/root/repo/Filters/Points/vtkPointInterpolator.h"
+    "/root/repo/Filters/Points/vtkPointInterpolator2D.h"
+    "/root/repo/Filters/Points/vtkPointKNNGraph.h"
+    "/root/repo/Filters/Points/vtkPointOccupancyFilter.h"
+    "/root/repo/Filters/Points/vtkProbabilisticVoronoiKernel.h"
+    "/root/repo/Filters/Points/vtkRadiusOutlierRemoval.h"
+    "/root/repo/Filters/Points/vtkSPHCubicKernel.h"
+    "/root/repo/Filters/Points/vtkSPHInterpolator.h"
+    "/root/repo/Filters/Points/vtkSPHKernel.h"
+    "/root/repo/Filters/Points/vtkSPHQuarticKernel.h"
+    "/root/repo/Filters/Points/vtkSPHQuinticKernel.h"
+    "/root/repo/Filters/Points/vtkShepardKernel.h"
+    "/root/repo/Filters/Points/vtkSignedDistance.h"
+    "/root/repo/Filters/Points/vtkStatisticalOutlierRemoval.h"
+    "/root/repo/Filters/Points/vtkUnsignedDistance.h"
+    "/root/repo/Filters/Points/vtkVoronoiKernel.h"
+    "/root/repo/Filters/Points/vtkVoxelGrid.h"
+    "/root/repo/Filters/Points/vtkWendlandQuinticKernel.h"
+    "/root/repo/_gate_std/Filters/Points/vtkFiltersPointsModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkFiltersPoints-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkFiltersPoints-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkFiltersPoints-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkFiltersPoints-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkFiltersPoints-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersPoints-8.90.so")
+    endif()
+  endif()
+endif()
+
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkFiltersSources-hierarchy.txt"
+  "CMakeFiles/FiltersSources-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FiltersSources-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,72 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Filters/Sources/vtkArcSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkArcSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkArcSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkArrowSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkArrowSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkArrowSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkButtonSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkButtonSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkButtonSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkCellTypeSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkCellTypeSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkCellTypeSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkConeSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkConeSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkConeSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkCubeSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkCubeSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkCubeSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkCylinderSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkCylinderSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkCylinderSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkDiagonalMatrixSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkDiagonalMatrixSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkDiagonalMatrixSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkDiskSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkDiskSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkDiskSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkEllipseArcSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkEllipseArcSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkEllipseArcSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkEllipticalButtonSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkEllipticalButtonSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkEllipticalButtonSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkFrustumSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkFrustumSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkFrustumSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkGlyphSource2D.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkGlyphSource2D.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkGlyphSource2D.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkGraphToPolyData.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkGraphToPolyData.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkGraphToPolyData.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkHyperTreeGridSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkHyperTreeGridSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkHyperTreeGridSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkLineSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkLineSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkLineSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkOutlineCornerFilter.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkOutlineCornerFilter.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkOutlineCornerFilter.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkOutlineCornerSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkOutlineCornerSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkOutlineCornerSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkOutlineSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkOutlineSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkOutlineSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkParametricFunctionSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkParametricFunctionSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkParametricFunctionSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkPlaneSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPlaneSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPlaneSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkPlatonicSolidSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPlatonicSolidSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPlatonicSolidSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkPointSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPointSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPointSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkPolyLineSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPolyLineSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPolyLineSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkPolyPointSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPolyPointSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkPolyPointSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkProgrammableDataObjectSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkProgrammableDataObjectSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkProgrammableDataObjectSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkProgrammableSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkProgrammableSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkProgrammableSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkRandomHyperTreeGridSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkRandomHyperTreeGridSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkRandomHyperTreeGridSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkRectangularButtonSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkRectangularButtonSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkRectangularButtonSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkRegularPolygonSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkRegularPolygonSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkRegularPolygonSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkSelectionSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkSelectionSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkSelectionSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkSphereSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkSphereSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkSphereSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkSuperquadricSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkSuperquadricSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkSuperquadricSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkTessellatedBoxSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkTessellatedBoxSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkTessellatedBoxSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkTextSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkTextSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkTextSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkTexturedSphereSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkTexturedSphereSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkTexturedSphereSource.cxx.o.d"
+  "/root/repo/Filters/Sources/vtkUniformHyperTreeGridSource.cxx" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkUniformHyperTreeGridSource.cxx.o" "gcc" "Filters/Sources/CMakeFiles/FiltersSources.dir/vtkUniformHyperTreeGridSource.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkFiltersSources-8.90.so" "/root/repo/_gate_std/lib/libvtkFiltersSources-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkFiltersSources-8.90.so.1" "/root/repo/_gate_std/lib/libvtkFiltersSources-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Filters/General/CMakeFiles/FiltersGeneral.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ComputationalGeometry/CMakeFiles/CommonComputationalGeometry.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Filters/Core/CMakeFiles/FiltersCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
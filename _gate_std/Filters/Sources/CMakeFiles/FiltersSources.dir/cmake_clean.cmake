@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkFiltersSources-8.90.pdb"
+  "../../lib/libvtkFiltersSources-8.90.so"
+  "../../lib/libvtkFiltersSources-8.90.so.1"
+  "../../lib/libvtkFiltersSources-8.90.so.8.90.0"
+  "CMakeFiles/FiltersSources.dir/vtkArcSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkArcSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkArrowSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkArrowSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkButtonSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkButtonSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkCellTypeSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkCellTypeSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkConeSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkConeSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkCubeSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkCubeSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkCylinderSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkCylinderSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkDiagonalMatrixSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkDiagonalMatrixSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkDiskSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkDiskSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkEllipseArcSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkEllipseArcSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkEllipticalButtonSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkEllipticalButtonSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkFrustumSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkFrustumSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkGlyphSource2D.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkGlyphSource2D.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkGraphToPolyData.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkGraphToPolyData.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkHyperTreeGridSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkHyperTreeGridSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkLineSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkLineSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkOutlineCornerFilter.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkOutlineCornerFilter.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkOutlineCornerSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkOutlineCornerSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkOutlineSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkOutlineSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkParametricFunctionSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkParametricFunctionSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkPlaneSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkPlaneSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkPlatonicSolidSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkPlatonicSolidSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkPointSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkPointSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkPolyLineSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkPolyLineSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkPolyPointSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkPolyPointSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkProgrammableDataObjectSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkProgrammableDataObjectSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkProgrammableSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkProgrammableSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkRandomHyperTreeGridSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkRandomHyperTreeGridSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkRectangularButtonSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkRectangularButtonSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkRegularPolygonSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkRegularPolygonSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkSelectionSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkSelectionSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkSphereSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkSphereSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkSuperquadricSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkSuperquadricSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkTessellatedBoxSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkTessellatedBoxSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkTextSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkTextSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkTexturedSphereSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkTexturedSphereSource.cxx.o.d"
+  "CMakeFiles/FiltersSources.dir/vtkUniformHyperTreeGridSource.cxx.o"
+  "CMakeFiles/FiltersSources.dir/vtkUniformHyperTreeGridSource.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/FiltersSources.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,144 @@
+# Install script for directory: /root/repo/Filters/Sources
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/Filters/Sources/vtkArcSource.h"
+    "/root/repo/Filters/Sources/vtkArrowSource.h"
+    "/root/repo/Filters/Sources/vtkButtonSource.h"
+    "/root/repo/Filters/Sources/vtkCellTypeSource.h"
+    "/root/repo/Filters/Sources/vtkConeSource.h"
+    "/root/repo/Filters/Sources/vtkCubeSource.h"
+    "/root/repo/Filters/Sources/vtkCylinderSource.h"
+    "/root/repo/Filters/Sources/vtkDiagonalMatrixSource.h"
+    "/root/repo/Filters/Sources/vtkDiskSource.h"
+    "/root/repo/Filters/Sources/vtkEllipseArcSource.h"
+    "/root/repo/Filters/Sources/vtkEllipticalButtonSource.h"
+    "/root/repo/Filters/Sources/vtkFrustumSource.h"
+    "/root/repo/Filters/Sources/vtkGlyphSource2D.h"
+    "/root/repo/Filters/Sources/vtkGraphToPolyData.h"
+    "/root/repo/Filters/Sources/vtkHyperTreeGridSource.h"
+    "/root/repo/Filters/Sources/vtkLineSource.h"
+    "/root/repo/Filters/Sources/vtkOutlineCornerFilter.h"
+    "/root/repo/Filters/Sources/vtkOutlineCornerSource.h"
+    "/root/repo/Filters/Sources/vtkOutlineSource.h"
+    "/root/repo/Filters/Sources/vtkParametricFunctionSource.h"
+    "/root/repo/Filters/Sources/vtkPlaneSource.h"
+    "/root/repo/Filters/Sources/vtkPlatonicSolidSource.h"
+    "/root/repo/Filters/Sources/vtkPointSource.h"
+    "/root/repo/Filters/Sources/vtkPolyLineSource.h"
+    "/root/repo/Filters/Sources/vtkPolyPointSource.h"
+    "/root/repo/Filters/Sources/vtkProgrammableDataObjectSource.h"
+    "/root/repo/Filters/Sources/vtkProgrammableSource.h"
+    "/root/repo/Filters/Sources/vtkRandomHyperTreeGridSource.h"
+    "/root/repo/Filters/Sources/vtkRectangularButtonSource.h"
+    "/root/repo/Filters/Sources/vtkRegularPolygonSource.h"
+    "/root/repo/Filters/Sources/vtkSelectionSource.h"
+    "/root/repo/Filters/Sources/vtkSphereSource.h"
+    "/root/repo/Filters/Sources/vtkSuperquadricSource.h"
+    "/root/repo/Filters/Sources/vtkTessellatedBoxSource.h"
+    "/root/repo/Filters/Sources/vtkTextSource.h"
+    "/root/repo/Filters/Sources/vtkTexturedSphereSource.h"
+    "/root/repo/Filters/Sources/vtkUniformHyperTreeGridSource.h"
+    "/root/repo/_gate_std/Filters/Sources/vtkFiltersSourcesModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkFiltersSources-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkFiltersSources-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkFiltersSources-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkFiltersSources-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkFiltersSources-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkFiltersSources-8.90.so")
+    endif()
+  endif()
+endif()
+
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkIOCore-hierarchy.txt"
+  "CMakeFiles/IOCore-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/IOCore-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,65 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/IO/Core/vtkASCIIArrayParser.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkASCIIArrayParser.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkASCIIArrayParser.cxx.o.d"
+  "/root/repo/IO/Core/vtkASCIITextCodec.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkASCIITextCodec.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkASCIITextCodec.cxx.o.d"
+  "/root/repo/IO/Core/vtkAbstractParticleWriter.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkAbstractParticleWriter.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkAbstractParticleWriter.cxx.o.d"
+  "/root/repo/IO/Core/vtkAbstractPolyDataReader.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkAbstractPolyDataReader.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkAbstractPolyDataReader.cxx.o.d"
+  "/root/repo/IO/Core/vtkArrayDataReader.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayDataReader.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayDataReader.cxx.o.d"
+  "/root/repo/IO/Core/vtkArrayDataWriter.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayDataWriter.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayDataWriter.cxx.o.d"
+  "/root/repo/IO/Core/vtkArrayReader.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayReader.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayReader.cxx.o.d"
+  "/root/repo/IO/Core/vtkArrayWriter.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayWriter.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkArrayWriter.cxx.o.d"
+  "/root/repo/IO/Core/vtkBase64InputStream.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkBase64InputStream.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkBase64InputStream.cxx.o.d"
+  "/root/repo/IO/Core/vtkBase64OutputStream.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkBase64OutputStream.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkBase64OutputStream.cxx.o.d"
+  "/root/repo/IO/Core/vtkBase64Utilities.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkBase64Utilities.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkBase64Utilities.cxx.o.d"
+  "/root/repo/IO/Core/vtkDataCompressor.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkDataCompressor.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkDataCompressor.cxx.o.d"
+  "/root/repo/IO/Core/vtkDelimitedTextWriter.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkDelimitedTextWriter.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkDelimitedTextWriter.cxx.o.d"
+  "/root/repo/IO/Core/vtkGlobFileNames.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkGlobFileNames.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkGlobFileNames.cxx.o.d"
+  "/root/repo/IO/Core/vtkInputStream.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkInputStream.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkInputStream.cxx.o.d"
+  "/root/repo/IO/Core/vtkJavaScriptDataWriter.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkJavaScriptDataWriter.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkJavaScriptDataWriter.cxx.o.d"
+  "/root/repo/IO/Core/vtkLZ4DataCompressor.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkLZ4DataCompressor.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkLZ4DataCompressor.cxx.o.d"
+  "/root/repo/IO/Core/vtkLZMADataCompressor.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkLZMADataCompressor.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkLZMADataCompressor.cxx.o.d"
+  "/root/repo/IO/Core/vtkNumberToString.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkNumberToString.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkNumberToString.cxx.o.d"
+  "/root/repo/IO/Core/vtkOutputStream.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkOutputStream.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkOutputStream.cxx.o.d"
+  "/root/repo/IO/Core/vtkSortFileNames.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkSortFileNames.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkSortFileNames.cxx.o.d"
+  "/root/repo/IO/Core/vtkTextCodec.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkTextCodec.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkTextCodec.cxx.o.d"
+  "/root/repo/IO/Core/vtkTextCodecFactory.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkTextCodecFactory.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkTextCodecFactory.cxx.o.d"
+  "/root/repo/IO/Core/vtkUTF16TextCodec.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkUTF16TextCodec.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkUTF16TextCodec.cxx.o.d"
+  "/root/repo/IO/Core/vtkUTF8TextCodec.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkUTF8TextCodec.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkUTF8TextCodec.cxx.o.d"
+  "/root/repo/IO/Core/vtkWriter.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkWriter.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkWriter.cxx.o.d"
+  "/root/repo/IO/Core/vtkZLibDataCompressor.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkZLibDataCompressor.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkZLibDataCompressor.cxx.o.d"
+  "/root/repo/IO/Core/vtkZstdDataCompressor.cxx" "IO/Core/CMakeFiles/IOCore.dir/vtkZstdDataCompressor.cxx.o" "gcc" "IO/Core/CMakeFiles/IOCore.dir/vtkZstdDataCompressor.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkIOCore-8.90.so" "/root/repo/_gate_std/lib/libvtkIOCore-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkIOCore-8.90.so.1" "/root/repo/_gate_std/lib/libvtkIOCore-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/ThirdParty/lz4/vtklz4/CMakeFiles/lz4.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/ThirdParty/lzma/vtklzma/CMakeFiles/lzma.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/ThirdParty/zlib/vtkzlib/CMakeFiles/zlib.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/ThirdParty/zstd/vtkzstd/CMakeFiles/zstd.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkIOCore-8.90.pdb"
+  "../../lib/libvtkIOCore-8.90.so"
+  "../../lib/libvtkIOCore-8.90.so.1"
+  "../../lib/libvtkIOCore-8.90.so.8.90.0"
+  "CMakeFiles/IOCore.dir/vtkASCIIArrayParser.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkASCIIArrayParser.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkASCIITextCodec.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkASCIITextCodec.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkAbstractParticleWriter.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkAbstractParticleWriter.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkAbstractPolyDataReader.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkAbstractPolyDataReader.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkArrayDataReader.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkArrayDataReader.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkArrayDataWriter.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkArrayDataWriter.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkArrayReader.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkArrayReader.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkArrayWriter.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkArrayWriter.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkBase64InputStream.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkBase64InputStream.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkBase64OutputStream.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkBase64OutputStream.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkBase64Utilities.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkBase64Utilities.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkDataCompressor.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkDataCompressor.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkDelimitedTextWriter.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkDelimitedTextWriter.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkGlobFileNames.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkGlobFileNames.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkInputStream.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkInputStream.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkJavaScriptDataWriter.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkJavaScriptDataWriter.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkLZ4DataCompressor.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkLZ4DataCompressor.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkLZMADataCompressor.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkLZMADataCompressor.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkNumberToString.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkNumberToString.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkOutputStream.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkOutputStream.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkSortFileNames.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkSortFileNames.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkTextCodec.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkTextCodec.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkTextCodecFactory.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkTextCodecFactory.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkUTF16TextCodec.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkUTF16TextCodec.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkUTF8TextCodec.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkUTF8TextCodec.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkWriter.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkWriter.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkZLibDataCompressor.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkZLibDataCompressor.cxx.o.d"
+  "CMakeFiles/IOCore.dir/vtkZstdDataCompressor.cxx.o"
+  "CMakeFiles/IOCore.dir/vtkZstdDataCompressor.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IOCore.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkIOXML-hierarchy.txt"
+  "CMakeFiles/IOXML-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/IOXML-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
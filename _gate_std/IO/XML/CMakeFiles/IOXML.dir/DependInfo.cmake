@@ -0,0 +1,88 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/IO/XML/vtkRTXMLPolyDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkRTXMLPolyDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkRTXMLPolyDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLCompositeDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLCompositeDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLCompositeDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLCompositeDataWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLCompositeDataWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLCompositeDataWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLDataObjectWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLDataObjectWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLDataObjectWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLDataSetWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLDataSetWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLDataSetWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLFileReadTester.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLFileReadTester.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLFileReadTester.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLGenericDataObjectReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLGenericDataObjectReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLGenericDataObjectReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLHierarchicalBoxDataFileConverter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataFileConverter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataFileConverter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLHierarchicalBoxDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLHierarchicalBoxDataWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLHierarchicalDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHierarchicalDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLHyperTreeGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLHyperTreeGridWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLImageDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLImageDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLImageDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLImageDataWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLImageDataWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLImageDataWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLMultiBlockDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLMultiBlockDataWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLMultiGroupDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLMultiGroupDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLMultiGroupDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPDataObjectReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPDataObjectReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPDataObjectReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPHyperTreeGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPHyperTreeGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPHyperTreeGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPImageDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPImageDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPImageDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPPolyDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPPolyDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPPolyDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPRectilinearGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPRectilinearGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPRectilinearGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPStructuredDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPStructuredDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPStructuredDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPStructuredGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPStructuredGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPStructuredGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPTableReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPTableReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPTableReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPUnstructuredDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPUnstructuredDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPUnstructuredDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPUnstructuredGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPUnstructuredGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPUnstructuredGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPartitionedDataSetCollectionReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPartitionedDataSetCollectionWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPartitionedDataSetReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPartitionedDataSetWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPolyDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPolyDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPolyDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLPolyDataWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPolyDataWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLPolyDataWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLRectilinearGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLRectilinearGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLRectilinearGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLRectilinearGridWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLRectilinearGridWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLRectilinearGridWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLStructuredDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLStructuredDataWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredDataWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredDataWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLStructuredGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLStructuredGridWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredGridWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLStructuredGridWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLTableReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLTableReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLTableReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLTableWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLTableWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLTableWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLUniformGridAMRReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLUniformGridAMRWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLUnstructuredDataReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLUnstructuredDataWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLUnstructuredGridReader.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridReader.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridReader.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLUnstructuredGridWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLWriter.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLWriter.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLWriter.cxx.o.d"
+  "/root/repo/IO/XML/vtkXMLWriterC.cxx" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLWriterC.cxx.o" "gcc" "IO/XML/CMakeFiles/IOXML.dir/vtkXMLWriterC.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkIOXML-8.90.so" "/root/repo/_gate_std/lib/libvtkIOXML-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkIOXML-8.90.so.1" "/root/repo/_gate_std/lib/libvtkIOXML-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/IO/XMLParser/CMakeFiles/IOXMLParser.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/IO/Core/CMakeFiles/IOCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/System/CMakeFiles/CommonSystem.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Misc/CMakeFiles/CommonMisc.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,117 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkIOXML-8.90.pdb"
+  "../../lib/libvtkIOXML-8.90.so"
+  "../../lib/libvtkIOXML-8.90.so.1"
+  "../../lib/libvtkIOXML-8.90.so.8.90.0"
+  "CMakeFiles/IOXML.dir/vtkRTXMLPolyDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkRTXMLPolyDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLCompositeDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLCompositeDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLCompositeDataWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLCompositeDataWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLDataObjectWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLDataObjectWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLDataSetWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLDataSetWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLFileReadTester.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLFileReadTester.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLGenericDataObjectReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLGenericDataObjectReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataFileConverter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataFileConverter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalBoxDataWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLHierarchicalDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLHyperTreeGridWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLImageDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLImageDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLImageDataWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLImageDataWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLMultiBlockDataWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLMultiGroupDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLMultiGroupDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPDataObjectReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPDataObjectReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPHyperTreeGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPHyperTreeGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPImageDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPImageDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPPolyDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPPolyDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPRectilinearGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPRectilinearGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPStructuredDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPStructuredDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPStructuredGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPStructuredGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPTableReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPTableReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPUnstructuredDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPUnstructuredDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPUnstructuredGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPUnstructuredGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetCollectionWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPartitionedDataSetWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPolyDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPolyDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLPolyDataWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLPolyDataWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLRectilinearGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLRectilinearGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLRectilinearGridWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLRectilinearGridWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredDataWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredDataWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredGridWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLStructuredGridWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLTableReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLTableReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLTableWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLTableWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLUniformGridAMRWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredDataWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridReader.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridReader.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLUnstructuredGridWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLWriter.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLWriter.cxx.o.d"
+  "CMakeFiles/IOXML.dir/vtkXMLWriterC.cxx.o"
+  "CMakeFiles/IOXML.dir/vtkXMLWriterC.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IOXML.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
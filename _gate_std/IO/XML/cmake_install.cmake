@@ -0,0 +1,160 @@
+# Install script for directory: /root/repo/IO/XML
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/vtk-8.90" TYPE FILE FILES
+    "/root/repo/IO/XML/vtkRTXMLPolyDataReader.h"
+    "/root/repo/IO/XML/vtkXMLCompositeDataReader.h"
+    "/root/repo/IO/XML/vtkXMLCompositeDataWriter.h"
+    "/root/repo/IO/XML/vtkXMLDataObjectWriter.h"
+    "/root/repo/IO/XML/vtkXMLDataReader.h"
+    "/root/repo/IO/XML/vtkXMLDataSetWriter.h"
+    "/root/repo/IO/XML/vtkXMLFileReadTester.h"
+    "/root/repo/IO/XML/vtkXMLGenericDataObjectReader.h"
+    "/root/repo/IO/XML/vtkXMLHierarchicalBoxDataFileConverter.h"
+    "/root/repo/IO/XML/vtkXMLHierarchicalBoxDataReader.h"
+    "/root/repo/IO/XML/vtkXMLHierarchicalBoxDataWriter.h"
+    "/root/repo/IO/XML/vtkXMLHierarchicalDataReader.h"
+    "/root/repo/IO/XML/vtkXMLHyperTreeGridReader.h"
+    "/root/repo/IO/XML/vtkXMLHyperTreeGridWriter.h"
+    "/root/repo/IO/XML/vtkXMLImageDataReader.h"
+    "/root/repo/IO/XML/vtkXMLImageDataWriter.h"
+    "/root/repo/IO/XML/vtkXMLMultiBlockDataReader.h"
+    "/root/repo/IO/XML/vtkXMLMultiBlockDataWriter.h"
+    "/root/repo/IO/XML/vtkXMLMultiGroupDataReader.h"
+    "/root/repo/IO/XML/vtkXMLPDataObjectReader.h"
+    "/root/repo/IO/XML/vtkXMLPDataReader.h"
+    "/root/repo/IO/XML/vtkXMLPHyperTreeGridReader.h"
+    "/root/repo/IO/XML/vtkXMLPImageDataReader.h"
+    "/root/repo/IO/XML/vtkXMLPPolyDataReader.h"
+    "/root/repo/IO/XML/vtkXMLPRectilinearGridReader.h"
+    "/root/repo/IO/XML/vtkXMLPStructuredDataReader.h"
+    "/root/repo/IO/XML/vtkXMLPStructuredGridReader.h"
+    "/root/repo/IO/XML/vtkXMLPTableReader.h"
+    "/root/repo/IO/XML/vtkXMLPUnstructuredDataReader.h"
+    "/root/repo/IO/XML/vtkXMLPUnstructuredGridReader.h"
+    "/root/repo/IO/XML/vtkXMLPartitionedDataSetCollectionReader.h"
+    "/root/repo/IO/XML/vtkXMLPartitionedDataSetCollectionWriter.h"
+    "/root/repo/IO/XML/vtkXMLPartitionedDataSetReader.h"
+    "/root/repo/IO/XML/vtkXMLPartitionedDataSetWriter.h"
+    "/root/repo/IO/XML/vtkXMLPolyDataReader.h"
+    "/root/repo/IO/XML/vtkXMLPolyDataWriter.h"
+    "/root/repo/IO/XML/vtkXMLReader.h"
+    "/root/repo/IO/XML/vtkXMLRectilinearGridReader.h"
+    "/root/repo/IO/XML/vtkXMLRectilinearGridWriter.h"
+    "/root/repo/IO/XML/vtkXMLStructuredDataReader.h"
+    "/root/repo/IO/XML/vtkXMLStructuredDataWriter.h"
+    "/root/repo/IO/XML/vtkXMLStructuredGridReader.h"
+    "/root/repo/IO/XML/vtkXMLStructuredGridWriter.h"
+    "/root/repo/IO/XML/vtkXMLTableReader.h"
+    "/root/repo/IO/XML/vtkXMLTableWriter.h"
+    "/root/repo/IO/XML/vtkXMLUniformGridAMRReader.h"
+    "/root/repo/IO/XML/vtkXMLUniformGridAMRWriter.h"
+    "/root/repo/IO/XML/vtkXMLUnstructuredDataReader.h"
+    "/root/repo/IO/XML/vtkXMLUnstructuredDataWriter.h"
+    "/root/repo/IO/XML/vtkXMLUnstructuredGridReader.h"
+    "/root/repo/IO/XML/vtkXMLUnstructuredGridWriter.h"
+    "/root/repo/IO/XML/vtkXMLWriter.h"
+    "/root/repo/IO/XML/vtkXMLWriterC.h"
+    "/root/repo/_gate_std/IO/XML/vtkIOXMLModule.h"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "development" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/vtk/hierarchy/VTK" TYPE FILE RENAME "vtkIOXML-hierarchy.txt" FILES "/root/repo/_gate_std/lib/vtk/hierarchy/VTK/vtkIOXML-hierarchy.txt")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_gate_std/lib/libvtkIOXML-8.90.so.8.90.0"
+    "/root/repo/_gate_std/lib/libvtkIOXML-8.90.so.1"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so.8.90.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so.1"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHANGE
+           FILE "${file}"
+           OLD_RPATH "/root/repo/_gate_std/lib:"
+           NEW_RPATH "")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_gate_std/lib/libvtkIOXML-8.90.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so"
+         OLD_RPATH "/root/repo/_gate_std/lib:"
+         NEW_RPATH "")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libvtkIOXML-8.90.so")
+    endif()
+  endif()
+endif()
+
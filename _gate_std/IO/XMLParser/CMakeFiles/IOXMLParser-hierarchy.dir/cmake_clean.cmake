@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../lib/vtk/hierarchy/VTK/vtkIOXMLParser-hierarchy.txt"
+  "CMakeFiles/IOXMLParser-hierarchy"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/IOXMLParser-hierarchy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/IO/XMLParser/vtkXMLDataParser.cxx" "IO/XMLParser/CMakeFiles/IOXMLParser.dir/vtkXMLDataParser.cxx.o" "gcc" "IO/XMLParser/CMakeFiles/IOXMLParser.dir/vtkXMLDataParser.cxx.o.d"
+  "/root/repo/IO/XMLParser/vtkXMLParser.cxx" "IO/XMLParser/CMakeFiles/IOXMLParser.dir/vtkXMLParser.cxx.o" "gcc" "IO/XMLParser/CMakeFiles/IOXMLParser.dir/vtkXMLParser.cxx.o.d"
+  "/root/repo/IO/XMLParser/vtkXMLUtilities.cxx" "IO/XMLParser/CMakeFiles/IOXMLParser.dir/vtkXMLUtilities.cxx.o" "gcc" "IO/XMLParser/CMakeFiles/IOXMLParser.dir/vtkXMLUtilities.cxx.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkIOXMLParser-8.90.so" "/root/repo/_gate_std/lib/libvtkIOXMLParser-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkIOXMLParser-8.90.so.1" "/root/repo/_gate_std/lib/libvtkIOXMLParser-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_std/IO/Core/CMakeFiles/IOCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/ThirdParty/expat/vtkexpat/CMakeFiles/expat.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/ExecutionModel/CMakeFiles/CommonExecutionModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/DataModel/CMakeFiles/CommonDataModel.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Transforms/CMakeFiles/CommonTransforms.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Math/CMakeFiles/CommonMath.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Common/Core/CMakeFiles/CommonCore.dir/DependInfo.cmake"
+  "/root/repo/_gate_std/Utilities/KWSys/vtksys/CMakeFiles/vtksys.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
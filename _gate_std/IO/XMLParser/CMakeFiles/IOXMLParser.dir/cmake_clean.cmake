@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../lib/libvtkIOXMLParser-8.90.pdb"
+  "../../lib/libvtkIOXMLParser-8.90.so"
+  "../../lib/libvtkIOXMLParser-8.90.so.1"
+  "../../lib/libvtkIOXMLParser-8.90.so.8.90.0"
+  "CMakeFiles/IOXMLParser.dir/vtkXMLDataParser.cxx.o"
+  "CMakeFiles/IOXMLParser.dir/vtkXMLDataParser.cxx.o.d"
+  "CMakeFiles/IOXMLParser.dir/vtkXMLParser.cxx.o"
+  "CMakeFiles/IOXMLParser.dir/vtkXMLParser.cxx.o.d"
+  "CMakeFiles/IOXMLParser.dir/vtkXMLUtilities.cxx.o"
+  "CMakeFiles/IOXMLParser.dir/vtkXMLUtilities.cxx.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/IOXMLParser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
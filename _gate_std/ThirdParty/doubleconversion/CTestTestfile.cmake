@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ThirdParty/doubleconversion
+# Build directory: /root/repo/_gate_std/ThirdParty/doubleconversion
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("vtkdoubleconversion")
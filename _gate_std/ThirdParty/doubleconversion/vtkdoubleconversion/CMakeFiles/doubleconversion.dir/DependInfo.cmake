@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/bignum-dtoa.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/bignum-dtoa.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/bignum-dtoa.cc.o.d"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/bignum.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/bignum.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/bignum.cc.o.d"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/cached-powers.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/cached-powers.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/cached-powers.cc.o.d"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/diy-fp.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/diy-fp.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/diy-fp.cc.o.d"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/double-conversion.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/double-conversion.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/double-conversion.cc.o.d"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/fast-dtoa.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/fast-dtoa.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/fast-dtoa.cc.o.d"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/fixed-dtoa.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/fixed-dtoa.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/fixed-dtoa.cc.o.d"
+  "/root/repo/ThirdParty/doubleconversion/vtkdoubleconversion/double-conversion/strtod.cc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/strtod.cc.o" "gcc" "ThirdParty/doubleconversion/vtkdoubleconversion/CMakeFiles/doubleconversion.dir/double-conversion/strtod.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_gate_std/lib/libvtkdoubleconversion-8.90.so" "/root/repo/_gate_std/lib/libvtkdoubleconversion-8.90.so.8.90.0"
+  "/root/repo/_gate_std/lib/libvtkdoubleconversion-8.90.so.1" "/root/repo/_gate_std/lib/libvtkdoubleconversion-8.90.so.8.90.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")